@@ -0,0 +1,4183 @@
+
+_alloc_small_dump:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "pagingtestlib.h"
+
+int main() {
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+    setup();
+    printf(1, COUNT_MSG, 5);
+       e:	bb 05 00 00 00       	mov    $0x5,%ebx
+int main() {
+      13:	51                   	push   %ecx
+    setup();
+      14:	e8 b7 02 00 00       	call   2d0 <setup>
+    printf(1, COUNT_MSG, 5);
+      19:	83 ec 04             	sub    $0x4,%esp
+      1c:	6a 05                	push   $0x5
+      1e:	68 6c 38 00 00       	push   $0x386c
+      23:	6a 01                	push   $0x1
+      25:	e8 e6 28 00 00       	call   2910 <printf>
+      2a:	83 c4 10             	add    $0x10,%esp
+    for (int i = 0; i < 5; ++i) {
+        int pid = fork();
+      2d:	e8 29 27 00 00       	call   275b <fork>
+        if (pid == 0) {
+      32:	85 c0                	test   %eax,%eax
+      34:	74 0f                	je     45 <main+0x45>
+            test_allocation_no_fork(300 * 1024 * 1024, "300MB", "100MB", 5 * 1024 * 1024, 100 * 1024 * 1024, 150 * 1024 * 1024, 100 * 1024 * 1024, 0);
+            exit();
+        } else {
+            wait();
+      36:	e8 30 27 00 00       	call   276b <wait>
+    for (int i = 0; i < 5; ++i) {
+      3b:	83 eb 01             	sub    $0x1,%ebx
+      3e:	75 ed                	jne    2d <main+0x2d>
+        }
+    }
+    finish();
+      40:	e8 eb 02 00 00       	call   330 <finish>
+            test_allocation_no_fork(300 * 1024 * 1024, "300MB", "100MB", 5 * 1024 * 1024, 100 * 1024 * 1024, 150 * 1024 * 1024, 100 * 1024 * 1024, 0);
+      45:	6a 00                	push   $0x0
+      47:	68 00 00 40 06       	push   $0x6400000
+      4c:	68 00 00 60 09       	push   $0x9600000
+      51:	68 00 00 40 06       	push   $0x6400000
+      56:	68 00 00 50 00       	push   $0x500000
+      5b:	68 b0 3a 00 00       	push   $0x3ab0
+      60:	68 b6 3a 00 00       	push   $0x3ab6
+      65:	68 00 00 c0 12       	push   $0x12c00000
+      6a:	e8 f1 0a 00 00       	call   b60 <test_allocation_no_fork>
+            exit();
+      6f:	83 c4 20             	add    $0x20,%esp
+      72:	e8 ec 26 00 00       	call   2763 <exit>
+      77:	66 90                	xchg   %ax,%ax
+      79:	66 90                	xchg   %ax,%ax
+      7b:	66 90                	xchg   %ax,%ax
+      7d:	66 90                	xchg   %ax,%ax
+      7f:	90                   	nop
+
+00000080 <test_out_of_bounds_internal>:
+      80:	55                   	push   %ebp
+      81:	89 e5                	mov    %esp,%ebp
+      83:	83 ec 14             	sub    $0x14,%esp
+      86:	6a 00                	push   $0x0
+      88:	e8 5e 27 00 00       	call   27eb <sbrk>
+      8d:	03 05 04 44 00 00    	add    0x4404,%eax
+      93:	83 c4 10             	add    $0x10,%esp
+      96:	0f b6 00             	movzbl (%eax),%eax
+      99:	c9                   	leave
+      9a:	c3                   	ret
+      9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      9f:	90                   	nop
+
+000000a0 <dump_for.part.0>:
+      a0:	55                   	push   %ebp
+      a1:	89 e5                	mov    %esp,%ebp
+      a3:	56                   	push   %esi
+      a4:	89 d6                	mov    %edx,%esi
+      a6:	53                   	push   %ebx
+      a7:	89 c3                	mov    %eax,%ebx
+      a9:	a1 20 44 00 00       	mov    0x4420,%eax
+      ae:	85 c0                	test   %eax,%eax
+      b0:	78 3e                	js     f0 <dump_for.part.0+0x50>
+      b2:	50                   	push   %eax
+      b3:	53                   	push   %ebx
+      b4:	68 38 2c 00 00       	push   $0x2c38
+      b9:	6a 01                	push   $0x1
+      bb:	e8 50 28 00 00       	call   2910 <printf>
+      c0:	83 c4 10             	add    $0x10,%esp
+      c3:	83 ec 0c             	sub    $0xc,%esp
+      c6:	56                   	push   %esi
+      c7:	e8 67 27 00 00       	call   2833 <dumppagetable>
+      cc:	a1 20 44 00 00       	mov    0x4420,%eax
+      d1:	83 c4 10             	add    $0x10,%esp
+      d4:	85 c0                	test   %eax,%eax
+      d6:	78 30                	js     108 <dump_for.part.0+0x68>
+      d8:	50                   	push   %eax
+      d9:	53                   	push   %ebx
+      da:	68 90 2c 00 00       	push   $0x2c90
+      df:	6a 01                	push   $0x1
+      e1:	e8 2a 28 00 00       	call   2910 <printf>
+      e6:	83 c4 10             	add    $0x10,%esp
+      e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      ec:	5b                   	pop    %ebx
+      ed:	5e                   	pop    %esi
+      ee:	5d                   	pop    %ebp
+      ef:	c3                   	ret
+      f0:	83 ec 04             	sub    $0x4,%esp
+      f3:	53                   	push   %ebx
+      f4:	68 64 2c 00 00       	push   $0x2c64
+      f9:	6a 01                	push   $0x1
+      fb:	e8 10 28 00 00       	call   2910 <printf>
+     100:	83 c4 10             	add    $0x10,%esp
+     103:	eb be                	jmp    c3 <dump_for.part.0+0x23>
+     105:	8d 76 00             	lea    0x0(%esi),%esi
+     108:	83 ec 04             	sub    $0x4,%esp
+     10b:	53                   	push   %ebx
+     10c:	68 c0 2c 00 00       	push   $0x2cc0
+     111:	6a 01                	push   $0x1
+     113:	e8 f8 27 00 00       	call   2910 <printf>
+     118:	83 c4 10             	add    $0x10,%esp
+     11b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     11e:	5b                   	pop    %ebx
+     11f:	5e                   	pop    %esi
+     120:	5d                   	pop    %ebp
+     121:	c3                   	ret
+     122:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     129:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000130 <_allocation_failure_message.part.0>:
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	83 ec 08             	sub    $0x8,%esp
+     136:	0f b6 40 01          	movzbl 0x1(%eax),%eax
+     13a:	3c 41                	cmp    $0x41,%al
+     13c:	74 52                	je     190 <_allocation_failure_message.part.0+0x60>
+     13e:	3c 52                	cmp    $0x52,%al
+     140:	0f 84 92 00 00 00    	je     1d8 <_allocation_failure_message.part.0+0xa8>
+     146:	7e 28                	jle    170 <_allocation_failure_message.part.0+0x40>
+     148:	3c 53                	cmp    $0x53,%al
+     14a:	74 74                	je     1c0 <_allocation_failure_message.part.0+0x90>
+     14c:	3c 73                	cmp    $0x73,%al
+     14e:	0f 85 98 00 00 00    	jne    1ec <_allocation_failure_message.part.0+0xbc>
+     154:	83 ec 08             	sub    $0x8,%esp
+     157:	68 f0 2d 00 00       	push   $0x2df0
+     15c:	6a 01                	push   $0x1
+     15e:	e8 ad 27 00 00       	call   2910 <printf>
+     163:	83 c4 10             	add    $0x10,%esp
+     166:	c9                   	leave
+     167:	c3                   	ret
+     168:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16f:	90                   	nop
+     170:	3c 46                	cmp    $0x46,%al
+     172:	74 34                	je     1a8 <_allocation_failure_message.part.0+0x78>
+     174:	3c 49                	cmp    $0x49,%al
+     176:	75 74                	jne    1ec <_allocation_failure_message.part.0+0xbc>
+     178:	83 ec 08             	sub    $0x8,%esp
+     17b:	68 38 2d 00 00       	push   $0x2d38
+     180:	6a 01                	push   $0x1
+     182:	e8 89 27 00 00       	call   2910 <printf>
+     187:	83 c4 10             	add    $0x10,%esp
+     18a:	c9                   	leave
+     18b:	c3                   	ret
+     18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     190:	83 ec 08             	sub    $0x8,%esp
+     193:	68 ec 2c 00 00       	push   $0x2cec
+     198:	6a 01                	push   $0x1
+     19a:	e8 71 27 00 00       	call   2910 <printf>
+     19f:	83 c4 10             	add    $0x10,%esp
+     1a2:	c9                   	leave
+     1a3:	c3                   	ret
+     1a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1a8:	83 ec 08             	sub    $0x8,%esp
+     1ab:	68 b7 38 00 00       	push   $0x38b7
+     1b0:	6a 01                	push   $0x1
+     1b2:	e8 59 27 00 00       	call   2910 <printf>
+     1b7:	83 c4 10             	add    $0x10,%esp
+     1ba:	c9                   	leave
+     1bb:	c3                   	ret
+     1bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1c0:	83 ec 08             	sub    $0x8,%esp
+     1c3:	68 ac 2d 00 00       	push   $0x2dac
+     1c8:	6a 01                	push   $0x1
+     1ca:	e8 41 27 00 00       	call   2910 <printf>
+     1cf:	83 c4 10             	add    $0x10,%esp
+     1d2:	c9                   	leave
+     1d3:	c3                   	ret
+     1d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1d8:	83 ec 08             	sub    $0x8,%esp
+     1db:	68 70 2d 00 00       	push   $0x2d70
+     1e0:	6a 01                	push   $0x1
+     1e2:	e8 29 27 00 00       	call   2910 <printf>
+     1e7:	83 c4 10             	add    $0x10,%esp
+     1ea:	c9                   	leave
+     1eb:	c3                   	ret
+     1ec:	83 ec 08             	sub    $0x8,%esp
+     1ef:	68 d1 38 00 00       	push   $0x38d1
+     1f4:	6a 01                	push   $0x1
+     1f6:	e8 15 27 00 00       	call   2910 <printf>
+     1fb:	83 c4 10             	add    $0x10,%esp
+     1fe:	c9                   	leave
+     1ff:	c3                   	ret
+
+00000200 <_show_cow_test_error.part.0>:
+     200:	55                   	push   %ebp
+     201:	89 e5                	mov    %esp,%ebp
+     203:	83 ec 08             	sub    $0x8,%esp
+     206:	0f b6 40 01          	movzbl 0x1(%eax),%eax
+     20a:	3c 66                	cmp    $0x66,%al
+     20c:	74 42                	je     250 <_show_cow_test_error.part.0+0x50>
+     20e:	7f 20                	jg     230 <_show_cow_test_error.part.0+0x30>
+     210:	3c 50                	cmp    $0x50,%al
+     212:	74 6c                	je     280 <_show_cow_test_error.part.0+0x80>
+     214:	3c 63                	cmp    $0x63,%al
+     216:	75 50                	jne    268 <_show_cow_test_error.part.0+0x68>
+     218:	83 ec 08             	sub    $0x8,%esp
+     21b:	68 e4 2e 00 00       	push   $0x2ee4
+     220:	6a 01                	push   $0x1
+     222:	e8 e9 26 00 00       	call   2910 <printf>
+     227:	83 c4 10             	add    $0x10,%esp
+     22a:	c9                   	leave
+     22b:	c3                   	ret
+     22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     230:	3c 70                	cmp    $0x70,%al
+     232:	75 34                	jne    268 <_show_cow_test_error.part.0+0x68>
+     234:	83 ec 08             	sub    $0x8,%esp
+     237:	68 54 2e 00 00       	push   $0x2e54
+     23c:	6a 01                	push   $0x1
+     23e:	e8 cd 26 00 00       	call   2910 <printf>
+     243:	83 c4 10             	add    $0x10,%esp
+     246:	c9                   	leave
+     247:	c3                   	ret
+     248:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     24f:	90                   	nop
+     250:	83 ec 08             	sub    $0x8,%esp
+     253:	68 1c 2e 00 00       	push   $0x2e1c
+     258:	6a 01                	push   $0x1
+     25a:	e8 b1 26 00 00       	call   2910 <printf>
+     25f:	83 c4 10             	add    $0x10,%esp
+     262:	c9                   	leave
+     263:	c3                   	ret
+     264:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     268:	83 ec 08             	sub    $0x8,%esp
+     26b:	68 30 2f 00 00       	push   $0x2f30
+     270:	6a 01                	push   $0x1
+     272:	e8 99 26 00 00       	call   2910 <printf>
+     277:	83 c4 10             	add    $0x10,%esp
+     27a:	c9                   	leave
+     27b:	c3                   	ret
+     27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     280:	83 ec 08             	sub    $0x8,%esp
+     283:	68 a4 2e 00 00       	push   $0x2ea4
+     288:	6a 01                	push   $0x1
+     28a:	e8 81 26 00 00       	call   2910 <printf>
+     28f:	83 c4 10             	add    $0x10,%esp
+     292:	c9                   	leave
+     293:	c3                   	ret
+     294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     29f:	90                   	nop
+
+000002a0 <dump_for>:
+     2a0:	55                   	push   %ebp
+     2a1:	8b 0d 24 44 00 00    	mov    0x4424,%ecx
+     2a7:	89 e5                	mov    %esp,%ebp
+     2a9:	8b 45 08             	mov    0x8(%ebp),%eax
+     2ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+     2af:	85 c9                	test   %ecx,%ecx
+     2b1:	74 0d                	je     2c0 <dump_for+0x20>
+     2b3:	5d                   	pop    %ebp
+     2b4:	e9 e7 fd ff ff       	jmp    a0 <dump_for.part.0>
+     2b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2c0:	5d                   	pop    %ebp
+     2c1:	c3                   	ret
+     2c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <setup>:
+     2d0:	55                   	push   %ebp
+     2d1:	89 e5                	mov    %esp,%ebp
+     2d3:	83 ec 08             	sub    $0x8,%esp
+     2d6:	c7 05 20 44 00 00 ff 	movl   $0xffffffff,0x4420
+     2dd:	ff ff ff 
+     2e0:	e8 fe 24 00 00       	call   27e3 <getpid>
+     2e5:	83 f8 01             	cmp    $0x1,%eax
+     2e8:	74 06                	je     2f0 <setup+0x20>
+     2ea:	c9                   	leave
+     2eb:	c3                   	ret
+     2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2f0:	83 ec 04             	sub    $0x4,%esp
+     2f3:	6a 01                	push   $0x1
+     2f5:	6a 01                	push   $0x1
+     2f7:	68 ed 38 00 00       	push   $0x38ed
+     2fc:	e8 aa 24 00 00       	call   27ab <mknod>
+     301:	58                   	pop    %eax
+     302:	5a                   	pop    %edx
+     303:	6a 02                	push   $0x2
+     305:	68 ed 38 00 00       	push   $0x38ed
+     30a:	e8 94 24 00 00       	call   27a3 <open>
+     30f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     316:	e8 c0 24 00 00       	call   27db <dup>
+     31b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     322:	e8 b4 24 00 00       	call   27db <dup>
+     327:	83 c4 10             	add    $0x10,%esp
+     32a:	c9                   	leave
+     32b:	c3                   	ret
+     32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <finish>:
+     330:	55                   	push   %ebp
+     331:	89 e5                	mov    %esp,%ebp
+     333:	83 ec 08             	sub    $0x8,%esp
+     336:	e8 a8 24 00 00       	call   27e3 <getpid>
+     33b:	e8 23 24 00 00       	call   2763 <exit>
+
+00000340 <test_simple_crash_no_fork>:
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	83 ec 08             	sub    $0x8,%esp
+     346:	ff 55 08             	call   *0x8(%ebp)
+     349:	83 ec 04             	sub    $0x4,%esp
+     34c:	ff 75 0c             	push   0xc(%ebp)
+     34f:	68 f5 38 00 00       	push   $0x38f5
+     354:	6a 01                	push   $0x1
+     356:	e8 b5 25 00 00       	call   2910 <printf>
+     35b:	83 c4 10             	add    $0x10,%esp
+     35e:	c9                   	leave
+     35f:	c3                   	ret
+
+00000360 <test_simple_crash>:
+     360:	55                   	push   %ebp
+     361:	89 e5                	mov    %esp,%ebp
+     363:	53                   	push   %ebx
+     364:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     367:	83 ec 20             	sub    $0x20,%esp
+     36a:	50                   	push   %eax
+     36b:	e8 03 24 00 00       	call   2773 <pipe>
+     370:	e8 e6 23 00 00       	call   275b <fork>
+     375:	83 c4 10             	add    $0x10,%esp
+     378:	83 f8 ff             	cmp    $0xffffffff,%eax
+     37b:	0f 84 7f 00 00 00    	je     400 <test_simple_crash+0xa0>
+     381:	85 c0                	test   %eax,%eax
+     383:	0f 84 90 00 00 00    	je     419 <test_simple_crash+0xb9>
+     389:	83 ec 0c             	sub    $0xc,%esp
+     38c:	ff 75 f4             	push   -0xc(%ebp)
+     38f:	e8 f7 23 00 00       	call   278b <close>
+     394:	83 c4 0c             	add    $0xc,%esp
+     397:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     39a:	6a 01                	push   $0x1
+     39c:	50                   	push   %eax
+     39d:	ff 75 f0             	push   -0x10(%ebp)
+     3a0:	e8 d6 23 00 00       	call   277b <read>
+     3a5:	89 c3                	mov    %eax,%ebx
+     3a7:	e8 bf 23 00 00       	call   276b <wait>
+     3ac:	58                   	pop    %eax
+     3ad:	ff 75 f0             	push   -0x10(%ebp)
+     3b0:	e8 d6 23 00 00       	call   278b <close>
+     3b5:	83 c4 10             	add    $0x10,%esp
+     3b8:	83 fb 01             	cmp    $0x1,%ebx
+     3bb:	74 23                	je     3e0 <test_simple_crash+0x80>
+     3bd:	83 ec 04             	sub    $0x4,%esp
+     3c0:	ff 75 0c             	push   0xc(%ebp)
+     3c3:	68 f5 38 00 00       	push   $0x38f5
+     3c8:	6a 01                	push   $0x1
+     3ca:	e8 41 25 00 00       	call   2910 <printf>
+     3cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3d2:	83 c4 10             	add    $0x10,%esp
+     3d5:	b8 01 00 00 00       	mov    $0x1,%eax
+     3da:	c9                   	leave
+     3db:	c3                   	ret
+     3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3e0:	83 ec 04             	sub    $0x4,%esp
+     3e3:	ff 75 10             	push   0x10(%ebp)
+     3e6:	68 f5 38 00 00       	push   $0x38f5
+     3eb:	6a 01                	push   $0x1
+     3ed:	e8 1e 25 00 00       	call   2910 <printf>
+     3f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3f5:	83 c4 10             	add    $0x10,%esp
+     3f8:	31 c0                	xor    %eax,%eax
+     3fa:	c9                   	leave
+     3fb:	c3                   	ret
+     3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     400:	83 ec 08             	sub    $0x8,%esp
+     403:	68 f9 38 00 00       	push   $0x38f9
+     408:	6a 01                	push   $0x1
+     40a:	e8 01 25 00 00       	call   2910 <printf>
+     40f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     412:	83 c4 10             	add    $0x10,%esp
+     415:	31 c0                	xor    %eax,%eax
+     417:	c9                   	leave
+     418:	c3                   	ret
+     419:	83 ec 0c             	sub    $0xc,%esp
+     41c:	6a 01                	push   $0x1
+     41e:	e8 68 23 00 00       	call   278b <close>
+     423:	5a                   	pop    %edx
+     424:	ff 75 f4             	push   -0xc(%ebp)
+     427:	e8 af 23 00 00       	call   27db <dup>
+     42c:	ff 55 08             	call   *0x8(%ebp)
+     42f:	83 c4 0c             	add    $0xc,%esp
+     432:	6a 01                	push   $0x1
+     434:	68 12 39 00 00       	push   $0x3912
+     439:	6a 01                	push   $0x1
+     43b:	e8 43 23 00 00       	call   2783 <write>
+     440:	e8 1e 23 00 00       	call   2763 <exit>
+     445:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <test_out_of_bounds_fork>:
+     450:	55                   	push   %ebp
+     451:	89 e5                	mov    %esp,%ebp
+     453:	8b 45 08             	mov    0x8(%ebp),%eax
+     456:	a3 04 44 00 00       	mov    %eax,0x4404
+     45b:	c7 45 08 80 00 00 00 	movl   $0x80,0x8(%ebp)
+     462:	5d                   	pop    %ebp
+     463:	e9 f8 fe ff ff       	jmp    360 <test_simple_crash>
+     468:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46f:	90                   	nop
+
+00000470 <test_out_of_bounds_no_fork>:
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	83 ec 14             	sub    $0x14,%esp
+     476:	8b 45 08             	mov    0x8(%ebp),%eax
+     479:	a3 04 44 00 00       	mov    %eax,0x4404
+     47e:	6a 00                	push   $0x0
+     480:	e8 66 23 00 00       	call   27eb <sbrk>
+     485:	83 c4 0c             	add    $0xc,%esp
+     488:	03 05 04 44 00 00    	add    0x4404,%eax
+     48e:	0f b6 00             	movzbl (%eax),%eax
+     491:	ff 75 0c             	push   0xc(%ebp)
+     494:	68 f5 38 00 00       	push   $0x38f5
+     499:	6a 01                	push   $0x1
+     49b:	e8 70 24 00 00       	call   2910 <printf>
+     4a0:	83 c4 10             	add    $0x10,%esp
+     4a3:	c9                   	leave
+     4a4:	c3                   	ret
+     4a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <_allocation_failure_message>:
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+     4b9:	83 f8 02             	cmp    $0x2,%eax
+     4bc:	74 22                	je     4e0 <_allocation_failure_message+0x30>
+     4be:	85 c0                	test   %eax,%eax
+     4c0:	75 23                	jne    4e5 <_allocation_failure_message+0x35>
+     4c2:	c7 45 0c 14 39 00 00 	movl   $0x3914,0xc(%ebp)
+     4c9:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+     4d0:	5d                   	pop    %ebp
+     4d1:	e9 3a 24 00 00       	jmp    2910 <printf>
+     4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4dd:	8d 76 00             	lea    0x0(%esi),%esi
+     4e0:	80 3a 4e             	cmpb   $0x4e,(%edx)
+     4e3:	74 1b                	je     500 <_allocation_failure_message+0x50>
+     4e5:	c7 45 0c d1 38 00 00 	movl   $0x38d1,0xc(%ebp)
+     4ec:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+     4f3:	5d                   	pop    %ebp
+     4f4:	e9 17 24 00 00       	jmp    2910 <printf>
+     4f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     500:	89 d0                	mov    %edx,%eax
+     502:	5d                   	pop    %ebp
+     503:	e9 28 fc ff ff       	jmp    130 <_allocation_failure_message.part.0>
+     508:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50f:	90                   	nop
+
+00000510 <_fail_allocation_test>:
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	83 ec 18             	sub    $0x18,%esp
+     516:	8b 45 0c             	mov    0xc(%ebp),%eax
+     519:	83 7d 08 ff          	cmpl   $0xffffffff,0x8(%ebp)
+     51d:	c6 45 f6 4e          	movb   $0x4e,-0xa(%ebp)
+     521:	88 45 f7             	mov    %al,-0x9(%ebp)
+     524:	75 0a                	jne    530 <_fail_allocation_test+0x20>
+     526:	8d 45 f6             	lea    -0xa(%ebp),%eax
+     529:	e8 02 fc ff ff       	call   130 <_allocation_failure_message.part.0>
+     52e:	c9                   	leave
+     52f:	c3                   	ret
+     530:	50                   	push   %eax
+     531:	8d 45 f6             	lea    -0xa(%ebp),%eax
+     534:	6a 02                	push   $0x2
+     536:	50                   	push   %eax
+     537:	ff 75 08             	push   0x8(%ebp)
+     53a:	e8 44 22 00 00       	call   2783 <write>
+     53f:	e8 1f 22 00 00       	call   2763 <exit>
+     544:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     54b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     54f:	90                   	nop
+
+00000550 <_pass_allocation_test>:
+     550:	55                   	push   %ebp
+     551:	ba 59 59 00 00       	mov    $0x5959,%edx
+     556:	89 e5                	mov    %esp,%ebp
+     558:	83 ec 18             	sub    $0x18,%esp
+     55b:	83 7d 08 ff          	cmpl   $0xffffffff,0x8(%ebp)
+     55f:	66 89 55 f6          	mov    %dx,-0xa(%ebp)
+     563:	75 14                	jne    579 <_pass_allocation_test+0x29>
+     565:	83 ec 04             	sub    $0x4,%esp
+     568:	ff 75 0c             	push   0xc(%ebp)
+     56b:	68 31 39 00 00       	push   $0x3931
+     570:	6a 01                	push   $0x1
+     572:	e8 99 23 00 00       	call   2910 <printf>
+     577:	c9                   	leave
+     578:	c3                   	ret
+     579:	50                   	push   %eax
+     57a:	8d 45 f6             	lea    -0xa(%ebp),%eax
+     57d:	6a 02                	push   $0x2
+     57f:	50                   	push   %eax
+     580:	ff 75 08             	push   0x8(%ebp)
+     583:	e8 fb 21 00 00       	call   2783 <write>
+     588:	e8 d6 21 00 00       	call   2763 <exit>
+     58d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000590 <_test_allocation_generic>:
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	57                   	push   %edi
+     594:	56                   	push   %esi
+     595:	53                   	push   %ebx
+     596:	83 ec 3c             	sub    $0x3c,%esp
+     599:	8b 7d 08             	mov    0x8(%ebp),%edi
+     59c:	8b 75 20             	mov    0x20(%ebp),%esi
+     59f:	8b 5d 2c             	mov    0x2c(%ebp),%ebx
+     5a2:	ff 75 18             	push   0x18(%ebp)
+     5a5:	ff 75 14             	push   0x14(%ebp)
+     5a8:	68 f0 2f 00 00       	push   $0x2ff0
+     5ad:	6a 01                	push   $0x1
+     5af:	e8 5c 23 00 00       	call   2910 <printf>
+     5b4:	83 c4 10             	add    $0x10,%esp
+     5b7:	85 db                	test   %ebx,%ebx
+     5b9:	0f 85 79 02 00 00    	jne    838 <_test_allocation_generic+0x2a8>
+     5bf:	85 ff                	test   %edi,%edi
+     5c1:	0f 85 8b 02 00 00    	jne    852 <_test_allocation_generic+0x2c2>
+     5c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5ca:	85 c0                	test   %eax,%eax
+     5cc:	0f 85 26 02 00 00    	jne    7f8 <_test_allocation_generic+0x268>
+     5d2:	8b 4d 30             	mov    0x30(%ebp),%ecx
+     5d5:	85 c9                	test   %ecx,%ecx
+     5d7:	0f 85 3e 02 00 00    	jne    81b <_test_allocation_generic+0x28b>
+     5dd:	e8 01 22 00 00       	call   27e3 <getpid>
+     5e2:	8b 15 24 44 00 00    	mov    0x4424,%edx
+     5e8:	85 d2                	test   %edx,%edx
+     5ea:	74 0c                	je     5f8 <_test_allocation_generic+0x68>
+     5ec:	89 c2                	mov    %eax,%edx
+     5ee:	b8 5d 39 00 00       	mov    $0x395d,%eax
+     5f3:	e8 a8 fa ff ff       	call   a0 <dump_for.part.0>
+     5f8:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+     5ff:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+     606:	85 ff                	test   %edi,%edi
+     608:	0f 84 c0 00 00 00    	je     6ce <_test_allocation_generic+0x13e>
+     60e:	83 ec 0c             	sub    $0xc,%esp
+     611:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     614:	50                   	push   %eax
+     615:	e8 59 21 00 00       	call   2773 <pipe>
+     61a:	e8 3c 21 00 00       	call   275b <fork>
+     61f:	83 c4 10             	add    $0x10,%esp
+     622:	83 f8 ff             	cmp    $0xffffffff,%eax
+     625:	0f 84 8d 02 00 00    	je     8b8 <_test_allocation_generic+0x328>
+     62b:	85 c0                	test   %eax,%eax
+     62d:	0f 84 8d 00 00 00    	je     6c0 <_test_allocation_generic+0x130>
+     633:	83 ec 0c             	sub    $0xc,%esp
+     636:	ff 75 d8             	push   -0x28(%ebp)
+     639:	8d 7d de             	lea    -0x22(%ebp),%edi
+     63c:	e8 4a 21 00 00       	call   278b <close>
+     641:	e8 25 21 00 00       	call   276b <wait>
+     646:	83 c4 0c             	add    $0xc,%esp
+     649:	6a 0a                	push   $0xa
+     64b:	57                   	push   %edi
+     64c:	ff 75 d4             	push   -0x2c(%ebp)
+     64f:	e8 27 21 00 00       	call   277b <read>
+     654:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     657:	59                   	pop    %ecx
+     658:	ff 75 d4             	push   -0x2c(%ebp)
+     65b:	e8 2b 21 00 00       	call   278b <close>
+     660:	8b 45 0c             	mov    0xc(%ebp),%eax
+     663:	83 c4 10             	add    $0x10,%esp
+     666:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     669:	85 c0                	test   %eax,%eax
+     66b:	0f 84 5f 02 00 00    	je     8d0 <_test_allocation_generic+0x340>
+     671:	83 fa 04             	cmp    $0x4,%edx
+     674:	0f 85 11 04 00 00    	jne    a8b <_test_allocation_generic+0x4fb>
+     67a:	80 7d de 59          	cmpb   $0x59,-0x22(%ebp)
+     67e:	0f 85 81 03 00 00    	jne    a05 <_test_allocation_generic+0x475>
+     684:	80 7d e0 59          	cmpb   $0x59,-0x20(%ebp)
+     688:	74 44                	je     6ce <_test_allocation_generic+0x13e>
+     68a:	83 ec 08             	sub    $0x8,%esp
+     68d:	68 a4 31 00 00       	push   $0x31a4
+     692:	6a 01                	push   $0x1
+     694:	e8 77 22 00 00       	call   2910 <printf>
+     699:	83 c4 10             	add    $0x10,%esp
+     69c:	80 7d e0 4e          	cmpb   $0x4e,-0x20(%ebp)
+     6a0:	0f 85 47 02 00 00    	jne    8ed <_test_allocation_generic+0x35d>
+     6a6:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     6a9:	e8 82 fa ff ff       	call   130 <_allocation_failure_message.part.0>
+     6ae:	66 90                	xchg   %ax,%ax
+     6b0:	31 c0                	xor    %eax,%eax
+     6b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6b5:	5b                   	pop    %ebx
+     6b6:	5e                   	pop    %esi
+     6b7:	5f                   	pop    %edi
+     6b8:	5d                   	pop    %ebp
+     6b9:	c3                   	ret
+     6ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     6c0:	83 ec 0c             	sub    $0xc,%esp
+     6c3:	ff 75 d4             	push   -0x2c(%ebp)
+     6c6:	e8 c0 20 00 00       	call   278b <close>
+     6cb:	83 c4 10             	add    $0x10,%esp
+     6ce:	83 ec 0c             	sub    $0xc,%esp
+     6d1:	ff 75 10             	push   0x10(%ebp)
+     6d4:	e8 12 21 00 00       	call   27eb <sbrk>
+     6d9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     6e0:	89 c7                	mov    %eax,%edi
+     6e2:	e8 04 21 00 00       	call   27eb <sbrk>
+     6e7:	83 c4 10             	add    $0x10,%esp
+     6ea:	83 ff ff             	cmp    $0xffffffff,%edi
+     6ed:	0f 84 15 02 00 00    	je     908 <_test_allocation_generic+0x378>
+     6f3:	29 f8                	sub    %edi,%eax
+     6f5:	3b 45 10             	cmp    0x10(%ebp),%eax
+     6f8:	74 26                	je     720 <_test_allocation_generic+0x190>
+     6fa:	0f b7 15 be 3a 00 00 	movzwl 0x3abe,%edx
+     701:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     704:	66 89 55 de          	mov    %dx,-0x22(%ebp)
+     708:	83 f8 ff             	cmp    $0xffffffff,%eax
+     70b:	0f 85 08 04 00 00    	jne    b19 <_test_allocation_generic+0x589>
+     711:	8d 45 de             	lea    -0x22(%ebp),%eax
+     714:	e8 17 fa ff ff       	call   130 <_allocation_failure_message.part.0>
+     719:	eb 95                	jmp    6b0 <_test_allocation_generic+0x120>
+     71b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     71f:	90                   	nop
+     720:	e8 be 20 00 00       	call   27e3 <getpid>
+     725:	8b 15 24 44 00 00    	mov    0x4424,%edx
+     72b:	85 d2                	test   %edx,%edx
+     72d:	0f 85 6d 01 00 00    	jne    8a0 <_test_allocation_generic+0x310>
+     733:	8b 4d 1c             	mov    0x1c(%ebp),%ecx
+     736:	01 f9                	add    %edi,%ecx
+     738:	89 c8                	mov    %ecx,%eax
+     73a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+     73d:	85 f6                	test   %esi,%esi
+     73f:	7e 1e                	jle    75f <_test_allocation_generic+0x1cf>
+     741:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     748:	85 db                	test   %ebx,%ebx
+     74a:	74 09                	je     755 <_test_allocation_generic+0x1c5>
+     74c:	80 38 00             	cmpb   $0x0,(%eax)
+     74f:	0f 85 2b 01 00 00    	jne    880 <_test_allocation_generic+0x2f0>
+     755:	c6 00 41             	movb   $0x41,(%eax)
+     758:	83 c0 01             	add    $0x1,%eax
+     75b:	39 d0                	cmp    %edx,%eax
+     75d:	75 e9                	jne    748 <_test_allocation_generic+0x1b8>
+     75f:	8b 55 28             	mov    0x28(%ebp),%edx
+     762:	03 7d 24             	add    0x24(%ebp),%edi
+     765:	89 f8                	mov    %edi,%eax
+     767:	01 fa                	add    %edi,%edx
+     769:	83 7d 28 00          	cmpl   $0x0,0x28(%ebp)
+     76d:	7e 18                	jle    787 <_test_allocation_generic+0x1f7>
+     76f:	90                   	nop
+     770:	85 db                	test   %ebx,%ebx
+     772:	74 09                	je     77d <_test_allocation_generic+0x1ed>
+     774:	80 38 00             	cmpb   $0x0,(%eax)
+     777:	0f 85 03 01 00 00    	jne    880 <_test_allocation_generic+0x2f0>
+     77d:	c6 00 42             	movb   $0x42,(%eax)
+     780:	83 c0 01             	add    $0x1,%eax
+     783:	39 d0                	cmp    %edx,%eax
+     785:	75 e9                	jne    770 <_test_allocation_generic+0x1e0>
+     787:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     78a:	e8 54 20 00 00       	call   27e3 <getpid>
+     78f:	8b 15 24 44 00 00    	mov    0x4424,%edx
+     795:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     798:	85 d2                	test   %edx,%edx
+     79a:	74 12                	je     7ae <_test_allocation_generic+0x21e>
+     79c:	89 c2                	mov    %eax,%edx
+     79e:	b8 8b 39 00 00       	mov    $0x398b,%eax
+     7a3:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     7a6:	e8 f5 f8 ff ff       	call   a0 <dump_for.part.0>
+     7ab:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     7ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     7b1:	85 db                	test   %ebx,%ebx
+     7b3:	0f 85 a7 01 00 00    	jne    960 <_test_allocation_generic+0x3d0>
+     7b9:	85 f6                	test   %esi,%esi
+     7bb:	0f 8e a8 02 00 00    	jle    a69 <_test_allocation_generic+0x4d9>
+     7c1:	31 c0                	xor    %eax,%eax
+     7c3:	eb 0e                	jmp    7d3 <_test_allocation_generic+0x243>
+     7c5:	8d 76 00             	lea    0x0(%esi),%esi
+     7c8:	83 c0 01             	add    $0x1,%eax
+     7cb:	39 c6                	cmp    %eax,%esi
+     7cd:	0f 8e 55 01 00 00    	jle    928 <_test_allocation_generic+0x398>
+     7d3:	80 3c 01 41          	cmpb   $0x41,(%ecx,%eax,1)
+     7d7:	74 ef                	je     7c8 <_test_allocation_generic+0x238>
+     7d9:	0f b7 15 c4 3a 00 00 	movzwl 0x3ac4,%edx
+     7e0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     7e3:	66 89 55 de          	mov    %dx,-0x22(%ebp)
+     7e7:	83 f8 ff             	cmp    $0xffffffff,%eax
+     7ea:	0f 84 21 ff ff ff    	je     711 <_test_allocation_generic+0x181>
+     7f0:	e9 24 03 00 00       	jmp    b19 <_test_allocation_generic+0x589>
+     7f5:	8d 76 00             	lea    0x0(%esi),%esi
+     7f8:	b8 30 39 00 00       	mov    $0x3930,%eax
+     7fd:	83 ec 04             	sub    $0x4,%esp
+     800:	50                   	push   %eax
+     801:	68 80 30 00 00       	push   $0x3080
+     806:	6a 01                	push   $0x1
+     808:	e8 03 21 00 00       	call   2910 <printf>
+     80d:	8b 4d 30             	mov    0x30(%ebp),%ecx
+     810:	83 c4 10             	add    $0x10,%esp
+     813:	85 c9                	test   %ecx,%ecx
+     815:	0f 84 c2 fd ff ff    	je     5dd <_test_allocation_generic+0x4d>
+     81b:	83 ec 08             	sub    $0x8,%esp
+     81e:	68 b8 30 00 00       	push   $0x30b8
+     823:	6a 01                	push   $0x1
+     825:	e8 e6 20 00 00       	call   2910 <printf>
+     82a:	83 c4 10             	add    $0x10,%esp
+     82d:	e9 ab fd ff ff       	jmp    5dd <_test_allocation_generic+0x4d>
+     832:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     838:	83 ec 08             	sub    $0x8,%esp
+     83b:	68 30 30 00 00       	push   $0x3030
+     840:	6a 01                	push   $0x1
+     842:	e8 c9 20 00 00       	call   2910 <printf>
+     847:	83 c4 10             	add    $0x10,%esp
+     84a:	85 ff                	test   %edi,%edi
+     84c:	0f 84 75 fd ff ff    	je     5c7 <_test_allocation_generic+0x37>
+     852:	83 ec 08             	sub    $0x8,%esp
+     855:	68 48 39 00 00       	push   $0x3948
+     85a:	6a 01                	push   $0x1
+     85c:	e8 af 20 00 00       	call   2910 <printf>
+     861:	8b 45 0c             	mov    0xc(%ebp),%eax
+     864:	83 c4 10             	add    $0x10,%esp
+     867:	85 c0                	test   %eax,%eax
+     869:	0f 84 63 fd ff ff    	je     5d2 <_test_allocation_generic+0x42>
+     86f:	b8 41 39 00 00       	mov    $0x3941,%eax
+     874:	eb 87                	jmp    7fd <_test_allocation_generic+0x26d>
+     876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     87d:	8d 76 00             	lea    0x0(%esi),%esi
+     880:	0f b7 15 c0 3a 00 00 	movzwl 0x3ac0,%edx
+     887:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     88a:	66 89 55 de          	mov    %dx,-0x22(%ebp)
+     88e:	83 f8 ff             	cmp    $0xffffffff,%eax
+     891:	0f 84 7a fe ff ff    	je     711 <_test_allocation_generic+0x181>
+     897:	e9 7d 02 00 00       	jmp    b19 <_test_allocation_generic+0x589>
+     89c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     8a0:	89 c2                	mov    %eax,%edx
+     8a2:	b8 75 39 00 00       	mov    $0x3975,%eax
+     8a7:	e8 f4 f7 ff ff       	call   a0 <dump_for.part.0>
+     8ac:	e9 82 fe ff ff       	jmp    733 <_test_allocation_generic+0x1a3>
+     8b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8b8:	83 ec 08             	sub    $0x8,%esp
+     8bb:	68 f9 38 00 00       	push   $0x38f9
+     8c0:	6a 01                	push   $0x1
+     8c2:	e8 49 20 00 00       	call   2910 <printf>
+     8c7:	83 c4 10             	add    $0x10,%esp
+     8ca:	e9 ff fd ff ff       	jmp    6ce <_test_allocation_generic+0x13e>
+     8cf:	90                   	nop
+     8d0:	85 d2                	test   %edx,%edx
+     8d2:	0f 8e e9 01 00 00    	jle    ac1 <_test_allocation_generic+0x531>
+     8d8:	0f b6 45 de          	movzbl -0x22(%ebp),%eax
+     8dc:	3c 59                	cmp    $0x59,%al
+     8de:	0f 84 be 01 00 00    	je     aa2 <_test_allocation_generic+0x512>
+     8e4:	83 fa 02             	cmp    $0x2,%edx
+     8e7:	0f 84 04 01 00 00    	je     9f1 <_test_allocation_generic+0x461>
+     8ed:	83 ec 08             	sub    $0x8,%esp
+     8f0:	68 d1 38 00 00       	push   $0x38d1
+     8f5:	6a 01                	push   $0x1
+     8f7:	e8 14 20 00 00       	call   2910 <printf>
+     8fc:	83 c4 10             	add    $0x10,%esp
+     8ff:	e9 ac fd ff ff       	jmp    6b0 <_test_allocation_generic+0x120>
+     904:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     908:	0f b7 15 bc 3a 00 00 	movzwl 0x3abc,%edx
+     90f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     912:	66 89 55 de          	mov    %dx,-0x22(%ebp)
+     916:	83 f8 ff             	cmp    $0xffffffff,%eax
+     919:	0f 84 f2 fd ff ff    	je     711 <_test_allocation_generic+0x181>
+     91f:	e9 f5 01 00 00       	jmp    b19 <_test_allocation_generic+0x589>
+     924:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     928:	8b 75 28             	mov    0x28(%ebp),%esi
+     92b:	85 f6                	test   %esi,%esi
+     92d:	0f 8e 4b 01 00 00    	jle    a7e <_test_allocation_generic+0x4ee>
+     933:	8b 55 28             	mov    0x28(%ebp),%edx
+     936:	31 c0                	xor    %eax,%eax
+     938:	eb 11                	jmp    94b <_test_allocation_generic+0x3bb>
+     93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     940:	83 c0 01             	add    $0x1,%eax
+     943:	39 c2                	cmp    %eax,%edx
+     945:	0f 8e 33 01 00 00    	jle    a7e <_test_allocation_generic+0x4ee>
+     94b:	80 3c 07 42          	cmpb   $0x42,(%edi,%eax,1)
+     94f:	74 ef                	je     940 <_test_allocation_generic+0x3b0>
+     951:	e9 83 fe ff ff       	jmp    7d9 <_test_allocation_generic+0x249>
+     956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     95d:	8d 76 00             	lea    0x0(%esi),%esi
+     960:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     963:	e8 f3 1d 00 00       	call   275b <fork>
+     968:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     96b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     96e:	89 c3                	mov    %eax,%ebx
+     970:	0f 84 8c 01 00 00    	je     b02 <_test_allocation_generic+0x572>
+     976:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     979:	85 c0                	test   %eax,%eax
+     97b:	0f 84 a2 00 00 00    	je     a23 <_test_allocation_generic+0x493>
+     981:	e8 e5 1d 00 00       	call   276b <wait>
+     986:	e8 58 1e 00 00       	call   27e3 <getpid>
+     98b:	8b 15 24 44 00 00    	mov    0x4424,%edx
+     991:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     994:	85 d2                	test   %edx,%edx
+     996:	74 0f                	je     9a7 <_test_allocation_generic+0x417>
+     998:	89 c2                	mov    %eax,%edx
+     99a:	b8 bd 39 00 00       	mov    $0x39bd,%eax
+     99f:	e8 fc f6 ff ff       	call   a0 <dump_for.part.0>
+     9a4:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     9a7:	85 f6                	test   %esi,%esi
+     9a9:	0f 8f 12 fe ff ff    	jg     7c1 <_test_allocation_generic+0x231>
+     9af:	8b 45 28             	mov    0x28(%ebp),%eax
+     9b2:	85 c0                	test   %eax,%eax
+     9b4:	0f 8f 79 ff ff ff    	jg     933 <_test_allocation_generic+0x3a3>
+     9ba:	ba 6c 2f 00 00       	mov    $0x2f6c,%edx
+     9bf:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     9c2:	b9 59 59 00 00       	mov    $0x5959,%ecx
+     9c7:	66 89 4d de          	mov    %cx,-0x22(%ebp)
+     9cb:	83 f8 ff             	cmp    $0xffffffff,%eax
+     9ce:	0f 85 45 01 00 00    	jne    b19 <_test_allocation_generic+0x589>
+     9d4:	83 ec 04             	sub    $0x4,%esp
+     9d7:	52                   	push   %edx
+     9d8:	68 31 39 00 00       	push   $0x3931
+     9dd:	6a 01                	push   $0x1
+     9df:	e8 2c 1f 00 00       	call   2910 <printf>
+     9e4:	83 c4 10             	add    $0x10,%esp
+     9e7:	b8 01 00 00 00       	mov    $0x1,%eax
+     9ec:	e9 c1 fc ff ff       	jmp    6b2 <_test_allocation_generic+0x122>
+     9f1:	3c 4e                	cmp    $0x4e,%al
+     9f3:	0f 85 f4 fe ff ff    	jne    8ed <_test_allocation_generic+0x35d>
+     9f9:	89 f8                	mov    %edi,%eax
+     9fb:	e8 30 f7 ff ff       	call   130 <_allocation_failure_message.part.0>
+     a00:	e9 ab fc ff ff       	jmp    6b0 <_test_allocation_generic+0x120>
+     a05:	83 ec 08             	sub    $0x8,%esp
+     a08:	68 80 31 00 00       	push   $0x3180
+     a0d:	6a 01                	push   $0x1
+     a0f:	e8 fc 1e 00 00       	call   2910 <printf>
+     a14:	83 c4 10             	add    $0x10,%esp
+     a17:	80 7d de 4e          	cmpb   $0x4e,-0x22(%ebp)
+     a1b:	0f 85 cc fe ff ff    	jne    8ed <_test_allocation_generic+0x35d>
+     a21:	eb d6                	jmp    9f9 <_test_allocation_generic+0x469>
+     a23:	e8 bb 1d 00 00       	call   27e3 <getpid>
+     a28:	8b 15 24 44 00 00    	mov    0x4424,%edx
+     a2e:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     a31:	85 d2                	test   %edx,%edx
+     a33:	74 0f                	je     a44 <_test_allocation_generic+0x4b4>
+     a35:	89 c2                	mov    %eax,%edx
+     a37:	b8 a2 39 00 00       	mov    $0x39a2,%eax
+     a3c:	e8 5f f6 ff ff       	call   a0 <dump_for.part.0>
+     a41:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     a44:	85 f6                	test   %esi,%esi
+     a46:	0f 8e 92 00 00 00    	jle    ade <_test_allocation_generic+0x54e>
+     a4c:	89 c8                	mov    %ecx,%eax
+     a4e:	01 ce                	add    %ecx,%esi
+     a50:	eb 0d                	jmp    a5f <_test_allocation_generic+0x4cf>
+     a52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     a58:	83 c0 01             	add    $0x1,%eax
+     a5b:	39 c6                	cmp    %eax,%esi
+     a5d:	74 7f                	je     ade <_test_allocation_generic+0x54e>
+     a5f:	80 38 41             	cmpb   $0x41,(%eax)
+     a62:	74 f4                	je     a58 <_test_allocation_generic+0x4c8>
+     a64:	e9 70 fd ff ff       	jmp    7d9 <_test_allocation_generic+0x249>
+     a69:	8b 4d 28             	mov    0x28(%ebp),%ecx
+     a6c:	85 c9                	test   %ecx,%ecx
+     a6e:	0f 8f bf fe ff ff    	jg     933 <_test_allocation_generic+0x3a3>
+     a74:	ba c0 2f 00 00       	mov    $0x2fc0,%edx
+     a79:	e9 41 ff ff ff       	jmp    9bf <_test_allocation_generic+0x42f>
+     a7e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     a81:	85 db                	test   %ebx,%ebx
+     a83:	0f 85 31 ff ff ff    	jne    9ba <_test_allocation_generic+0x42a>
+     a89:	eb e9                	jmp    a74 <_test_allocation_generic+0x4e4>
+     a8b:	83 ec 08             	sub    $0x8,%esp
+     a8e:	68 14 31 00 00       	push   $0x3114
+     a93:	6a 01                	push   $0x1
+     a95:	e8 76 1e 00 00       	call   2910 <printf>
+     a9a:	83 c4 10             	add    $0x10,%esp
+     a9d:	e9 0e fc ff ff       	jmp    6b0 <_test_allocation_generic+0x120>
+     aa2:	ff 75 18             	push   0x18(%ebp)
+     aa5:	ff 75 14             	push   0x14(%ebp)
+     aa8:	68 d0 31 00 00       	push   $0x31d0
+     aad:	6a 01                	push   $0x1
+     aaf:	e8 5c 1e 00 00       	call   2910 <printf>
+     ab4:	83 c4 10             	add    $0x10,%esp
+     ab7:	b8 01 00 00 00       	mov    $0x1,%eax
+     abc:	e9 f1 fb ff ff       	jmp    6b2 <_test_allocation_generic+0x122>
+     ac1:	0f 85 26 fe ff ff    	jne    8ed <_test_allocation_generic+0x35d>
+     ac7:	83 ec 08             	sub    $0x8,%esp
+     aca:	68 14 39 00 00       	push   $0x3914
+     acf:	6a 01                	push   $0x1
+     ad1:	e8 3a 1e 00 00       	call   2910 <printf>
+     ad6:	83 c4 10             	add    $0x10,%esp
+     ad9:	e9 d2 fb ff ff       	jmp    6b0 <_test_allocation_generic+0x120>
+     ade:	8b 75 28             	mov    0x28(%ebp),%esi
+     ae1:	85 f6                	test   %esi,%esi
+     ae3:	7e 46                	jle    b2b <_test_allocation_generic+0x59b>
+     ae5:	8b 45 28             	mov    0x28(%ebp),%eax
+     ae8:	eb 0d                	jmp    af7 <_test_allocation_generic+0x567>
+     aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     af0:	83 c3 01             	add    $0x1,%ebx
+     af3:	39 d8                	cmp    %ebx,%eax
+     af5:	74 34                	je     b2b <_test_allocation_generic+0x59b>
+     af7:	80 3c 1f 42          	cmpb   $0x42,(%edi,%ebx,1)
+     afb:	74 f3                	je     af0 <_test_allocation_generic+0x560>
+     afd:	e9 d7 fc ff ff       	jmp    7d9 <_test_allocation_generic+0x249>
+     b02:	0f b7 15 c2 3a 00 00 	movzwl 0x3ac2,%edx
+     b09:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     b0c:	66 89 55 de          	mov    %dx,-0x22(%ebp)
+     b10:	83 f8 ff             	cmp    $0xffffffff,%eax
+     b13:	0f 84 f8 fb ff ff    	je     711 <_test_allocation_generic+0x181>
+     b19:	52                   	push   %edx
+     b1a:	8d 55 de             	lea    -0x22(%ebp),%edx
+     b1d:	6a 02                	push   $0x2
+     b1f:	52                   	push   %edx
+     b20:	50                   	push   %eax
+     b21:	e8 5d 1c 00 00       	call   2783 <write>
+     b26:	e8 38 1c 00 00       	call   2763 <exit>
+     b2b:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+     b2e:	51                   	push   %ecx
+     b2f:	51                   	push   %ecx
+     b30:	68 14 32 00 00       	push   $0x3214
+     b35:	ff 75 d8             	push   -0x28(%ebp)
+     b38:	e8 13 fa ff ff       	call   550 <_pass_allocation_test>
+     b3d:	83 c4 10             	add    $0x10,%esp
+     b40:	83 7d 30 00          	cmpl   $0x0,0x30(%ebp)
+     b44:	74 0b                	je     b51 <_test_allocation_generic+0x5c1>
+     b46:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     b49:	c6 04 19 58          	movb   $0x58,(%ecx,%ebx,1)
+     b4d:	c6 04 1f 59          	movb   $0x59,(%edi,%ebx,1)
+     b51:	e8 0d 1c 00 00       	call   2763 <exit>
+     b56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b60 <test_allocation_no_fork>:
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	83 ec 0c             	sub    $0xc,%esp
+     b66:	6a 00                	push   $0x0
+     b68:	ff 75 24             	push   0x24(%ebp)
+     b6b:	ff 75 20             	push   0x20(%ebp)
+     b6e:	ff 75 1c             	push   0x1c(%ebp)
+     b71:	ff 75 18             	push   0x18(%ebp)
+     b74:	ff 75 14             	push   0x14(%ebp)
+     b77:	ff 75 10             	push   0x10(%ebp)
+     b7a:	ff 75 0c             	push   0xc(%ebp)
+     b7d:	ff 75 08             	push   0x8(%ebp)
+     b80:	6a 00                	push   $0x0
+     b82:	6a 00                	push   $0x0
+     b84:	e8 07 fa ff ff       	call   590 <_test_allocation_generic>
+     b89:	c9                   	leave
+     b8a:	c3                   	ret
+     b8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b8f:	90                   	nop
+
+00000b90 <test_allocation_then_fork>:
+     b90:	55                   	push   %ebp
+     b91:	89 e5                	mov    %esp,%ebp
+     b93:	83 ec 0c             	sub    $0xc,%esp
+     b96:	ff 75 28             	push   0x28(%ebp)
+     b99:	ff 75 24             	push   0x24(%ebp)
+     b9c:	ff 75 20             	push   0x20(%ebp)
+     b9f:	ff 75 1c             	push   0x1c(%ebp)
+     ba2:	ff 75 18             	push   0x18(%ebp)
+     ba5:	ff 75 14             	push   0x14(%ebp)
+     ba8:	ff 75 10             	push   0x10(%ebp)
+     bab:	ff 75 0c             	push   0xc(%ebp)
+     bae:	ff 75 08             	push   0x8(%ebp)
+     bb1:	6a 01                	push   $0x1
+     bb3:	6a 00                	push   $0x0
+     bb5:	e8 d6 f9 ff ff       	call   590 <_test_allocation_generic>
+     bba:	c9                   	leave
+     bbb:	c3                   	ret
+     bbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000bc0 <test_allocation_fork>:
+     bc0:	55                   	push   %ebp
+     bc1:	89 e5                	mov    %esp,%ebp
+     bc3:	83 ec 0c             	sub    $0xc,%esp
+     bc6:	6a 00                	push   $0x0
+     bc8:	6a 01                	push   $0x1
+     bca:	ff 75 20             	push   0x20(%ebp)
+     bcd:	ff 75 1c             	push   0x1c(%ebp)
+     bd0:	ff 75 18             	push   0x18(%ebp)
+     bd3:	ff 75 14             	push   0x14(%ebp)
+     bd6:	ff 75 10             	push   0x10(%ebp)
+     bd9:	ff 75 0c             	push   0xc(%ebp)
+     bdc:	ff 75 08             	push   0x8(%ebp)
+     bdf:	6a 00                	push   $0x0
+     be1:	6a 01                	push   $0x1
+     be3:	e8 a8 f9 ff ff       	call   590 <_test_allocation_generic>
+     be8:	c9                   	leave
+     be9:	c3                   	ret
+     bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000bf0 <wait_forever>:
+     bf0:	55                   	push   %ebp
+     bf1:	89 e5                	mov    %esp,%ebp
+     bf3:	83 ec 08             	sub    $0x8,%esp
+     bf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bfd:	8d 76 00             	lea    0x0(%esi),%esi
+     c00:	83 ec 0c             	sub    $0xc,%esp
+     c03:	68 e8 03 00 00       	push   $0x3e8
+     c08:	e8 e6 1b 00 00       	call   27f3 <sleep>
+     c0d:	83 c4 10             	add    $0x10,%esp
+     c10:	eb ee                	jmp    c00 <wait_forever+0x10>
+     c12:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000c20 <test_copy_on_write_main_child>:
+     c20:	55                   	push   %ebp
+     c21:	89 e5                	mov    %esp,%ebp
+     c23:	57                   	push   %edi
+     c24:	56                   	push   %esi
+     c25:	53                   	push   %ebx
+     c26:	81 ec 88 00 00 00    	sub    $0x88,%esp
+     c2c:	8b 45 08             	mov    0x8(%ebp),%eax
+     c2f:	8b 7d 14             	mov    0x14(%ebp),%edi
+     c32:	89 45 80             	mov    %eax,-0x80(%ebp)
+     c35:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c38:	89 7d 90             	mov    %edi,-0x70(%ebp)
+     c3b:	89 45 84             	mov    %eax,-0x7c(%ebp)
+     c3e:	50                   	push   %eax
+     c3f:	e8 a7 1b 00 00       	call   27eb <sbrk>
+     c44:	89 45 88             	mov    %eax,-0x78(%ebp)
+     c47:	89 c7                	mov    %eax,%edi
+     c49:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     c50:	e8 96 1b 00 00       	call   27eb <sbrk>
+     c55:	83 c4 10             	add    $0x10,%esp
+     c58:	89 45 8c             	mov    %eax,-0x74(%ebp)
+     c5b:	39 c7                	cmp    %eax,%edi
+     c5d:	73 13                	jae    c72 <test_copy_on_write_main_child+0x52>
+     c5f:	8b 55 8c             	mov    -0x74(%ebp),%edx
+     c62:	89 f8                	mov    %edi,%eax
+     c64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c68:	c6 00 41             	movb   $0x41,(%eax)
+     c6b:	83 c0 01             	add    $0x1,%eax
+     c6e:	39 c2                	cmp    %eax,%edx
+     c70:	75 f6                	jne    c68 <test_copy_on_write_main_child+0x48>
+     c72:	31 c0                	xor    %eax,%eax
+     c74:	b9 10 00 00 00       	mov    $0x10,%ecx
+     c79:	8d 7d a8             	lea    -0x58(%ebp),%edi
+     c7c:	83 7d 90 10          	cmpl   $0x10,-0x70(%ebp)
+     c80:	f3 ab                	rep stos %eax,%es:(%edi)
+     c82:	0f 8f 38 02 00 00    	jg     ec0 <test_copy_on_write_main_child+0x2a0>
+     c88:	e8 56 1b 00 00       	call   27e3 <getpid>
+     c8d:	8b 15 24 44 00 00    	mov    0x4424,%edx
+     c93:	85 d2                	test   %edx,%edx
+     c95:	0f 85 b5 01 00 00    	jne    e50 <test_copy_on_write_main_child+0x230>
+     c9b:	8b 45 90             	mov    -0x70(%ebp),%eax
+     c9e:	85 c0                	test   %eax,%eax
+     ca0:	0f 8e 50 02 00 00    	jle    ef6 <test_copy_on_write_main_child+0x2d6>
+     ca6:	31 c0                	xor    %eax,%eax
+     ca8:	31 f6                	xor    %esi,%esi
+     caa:	bf 20 00 00 00       	mov    $0x20,%edi
+     caf:	89 45 94             	mov    %eax,-0x6c(%ebp)
+     cb2:	e9 90 00 00 00       	jmp    d47 <test_copy_on_write_main_child+0x127>
+     cb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cbe:	66 90                	xchg   %ax,%ax
+     cc0:	85 c0                	test   %eax,%eax
+     cc2:	0f 84 58 02 00 00    	je     f20 <test_copy_on_write_main_child+0x300>
+     cc8:	83 ec 04             	sub    $0x4,%esp
+     ccb:	8d 45 9f             	lea    -0x61(%ebp),%eax
+     cce:	c6 45 9f 58          	movb   $0x58,-0x61(%ebp)
+     cd2:	6a 01                	push   $0x1
+     cd4:	50                   	push   %eax
+     cd5:	ff 75 a0             	push   -0x60(%ebp)
+     cd8:	e8 9e 1a 00 00       	call   277b <read>
+     cdd:	58                   	pop    %eax
+     cde:	80 7d 9f 2b          	cmpb   $0x2b,-0x61(%ebp)
+     ce2:	b8 63 00 00 00       	mov    $0x63,%eax
+     ce7:	0f 45 f8             	cmovne %eax,%edi
+     cea:	b8 01 00 00 00       	mov    $0x1,%eax
+     cef:	0f 44 45 94          	cmove  -0x6c(%ebp),%eax
+     cf3:	89 45 94             	mov    %eax,-0x6c(%ebp)
+     cf6:	ff 75 a0             	push   -0x60(%ebp)
+     cf9:	e8 8d 1a 00 00       	call   278b <close>
+     cfe:	58                   	pop    %eax
+     cff:	ff 75 a4             	push   -0x5c(%ebp)
+     d02:	e8 84 1a 00 00       	call   278b <close>
+     d07:	e8 d7 1a 00 00       	call   27e3 <getpid>
+     d0c:	8b 15 24 44 00 00    	mov    0x4424,%edx
+     d12:	83 c4 10             	add    $0x10,%esp
+     d15:	85 d2                	test   %edx,%edx
+     d17:	74 22                	je     d3b <test_copy_on_write_main_child+0x11b>
+     d19:	89 c2                	mov    %eax,%edx
+     d1b:	b8 f6 39 00 00       	mov    $0x39f6,%eax
+     d20:	e8 7b f3 ff ff       	call   a0 <dump_for.part.0>
+     d25:	8b 0d 24 44 00 00    	mov    0x4424,%ecx
+     d2b:	85 c9                	test   %ecx,%ecx
+     d2d:	74 0c                	je     d3b <test_copy_on_write_main_child+0x11b>
+     d2f:	89 da                	mov    %ebx,%edx
+     d31:	b8 0e 3a 00 00       	mov    $0x3a0e,%eax
+     d36:	e8 65 f3 ff ff       	call   a0 <dump_for.part.0>
+     d3b:	83 c6 01             	add    $0x1,%esi
+     d3e:	39 75 90             	cmp    %esi,-0x70(%ebp)
+     d41:	0f 84 49 01 00 00    	je     e90 <test_copy_on_write_main_child+0x270>
+     d47:	83 ec 0c             	sub    $0xc,%esp
+     d4a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d4d:	50                   	push   %eax
+     d4e:	e8 20 1a 00 00       	call   2773 <pipe>
+     d53:	e8 03 1a 00 00       	call   275b <fork>
+     d58:	83 c4 10             	add    $0x10,%esp
+     d5b:	89 44 b5 a8          	mov    %eax,-0x58(%ebp,%esi,4)
+     d5f:	89 c3                	mov    %eax,%ebx
+     d61:	83 f8 ff             	cmp    $0xffffffff,%eax
+     d64:	0f 85 56 ff ff ff    	jne    cc0 <test_copy_on_write_main_child+0xa0>
+     d6a:	83 ec 08             	sub    $0x8,%esp
+     d6d:	68 c4 38 00 00       	push   $0x38c4
+     d72:	6a 02                	push   $0x2
+     d74:	e8 97 1b 00 00       	call   2910 <printf>
+     d79:	8b 7d 84             	mov    -0x7c(%ebp),%edi
+     d7c:	8b 55 88             	mov    -0x78(%ebp),%edx
+     d7f:	83 c4 10             	add    $0x10,%esp
+     d82:	8b 4d 8c             	mov    -0x74(%ebp),%ecx
+     d85:	89 f8                	mov    %edi,%eax
+     d87:	c1 e8 1f             	shr    $0x1f,%eax
+     d8a:	01 f8                	add    %edi,%eax
+     d8c:	bf 66 00 00 00       	mov    $0x66,%edi
+     d91:	d1 f8                	sar    %eax
+     d93:	c6 04 02 41          	movb   $0x41,(%edx,%eax,1)
+     d97:	b8 01 00 00 00       	mov    $0x1,%eax
+     d9c:	39 ca                	cmp    %ecx,%edx
+     d9e:	73 27                	jae    dc7 <test_copy_on_write_main_child+0x1a7>
+     da0:	8b 4d 88             	mov    -0x78(%ebp),%ecx
+     da3:	8b 55 8c             	mov    -0x74(%ebp),%edx
+     da6:	be 70 00 00 00       	mov    $0x70,%esi
+     dab:	bb 01 00 00 00       	mov    $0x1,%ebx
+     db0:	80 39 41             	cmpb   $0x41,(%ecx)
+     db3:	0f 45 fe             	cmovne %esi,%edi
+     db6:	0f 45 c3             	cmovne %ebx,%eax
+     db9:	83 c1 01             	add    $0x1,%ecx
+     dbc:	39 d1                	cmp    %edx,%ecx
+     dbe:	75 f0                	jne    db0 <test_copy_on_write_main_child+0x190>
+     dc0:	8b 55 90             	mov    -0x70(%ebp),%edx
+     dc3:	85 d2                	test   %edx,%edx
+     dc5:	7e 27                	jle    dee <test_copy_on_write_main_child+0x1ce>
+     dc7:	89 45 94             	mov    %eax,-0x6c(%ebp)
+     dca:	8b 75 90             	mov    -0x70(%ebp),%esi
+     dcd:	31 db                	xor    %ebx,%ebx
+     dcf:	90                   	nop
+     dd0:	83 ec 0c             	sub    $0xc,%esp
+     dd3:	ff 74 9d a8          	push   -0x58(%ebp,%ebx,4)
+     dd7:	83 c3 01             	add    $0x1,%ebx
+     dda:	e8 b4 19 00 00       	call   2793 <kill>
+     ddf:	e8 87 19 00 00       	call   276b <wait>
+     de4:	83 c4 10             	add    $0x10,%esp
+     de7:	39 de                	cmp    %ebx,%esi
+     de9:	7f e5                	jg     dd0 <test_copy_on_write_main_child+0x1b0>
+     deb:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     dee:	8b 55 88             	mov    -0x78(%ebp),%edx
+     df1:	8b 75 8c             	mov    -0x74(%ebp),%esi
+     df4:	39 f2                	cmp    %esi,%edx
+     df6:	73 20                	jae    e18 <test_copy_on_write_main_child+0x1f8>
+     df8:	bb 70 00 00 00       	mov    $0x70,%ebx
+     dfd:	b9 01 00 00 00       	mov    $0x1,%ecx
+     e02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     e08:	80 3a 41             	cmpb   $0x41,(%edx)
+     e0b:	0f 45 fb             	cmovne %ebx,%edi
+     e0e:	0f 45 c1             	cmovne %ecx,%eax
+     e11:	83 c2 01             	add    $0x1,%edx
+     e14:	39 d6                	cmp    %edx,%esi
+     e16:	75 f0                	jne    e08 <test_copy_on_write_main_child+0x1e8>
+     e18:	85 c0                	test   %eax,%eax
+     e1a:	74 4c                	je     e68 <test_copy_on_write_main_child+0x248>
+     e1c:	b8 4e 20 00 00       	mov    $0x204e,%eax
+     e21:	83 ec 04             	sub    $0x4,%esp
+     e24:	66 89 45 a0          	mov    %ax,-0x60(%ebp)
+     e28:	89 f8                	mov    %edi,%eax
+     e2a:	88 45 a1             	mov    %al,-0x5f(%ebp)
+     e2d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e30:	6a 02                	push   $0x2
+     e32:	50                   	push   %eax
+     e33:	ff 75 80             	push   -0x80(%ebp)
+     e36:	e8 48 19 00 00       	call   2783 <write>
+     e3b:	83 c4 10             	add    $0x10,%esp
+     e3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e41:	5b                   	pop    %ebx
+     e42:	5e                   	pop    %esi
+     e43:	5f                   	pop    %edi
+     e44:	5d                   	pop    %ebp
+     e45:	c3                   	ret
+     e46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e4d:	8d 76 00             	lea    0x0(%esi),%esi
+     e50:	89 c2                	mov    %eax,%edx
+     e52:	b8 dd 39 00 00       	mov    $0x39dd,%eax
+     e57:	e8 44 f2 ff ff       	call   a0 <dump_for.part.0>
+     e5c:	e9 3a fe ff ff       	jmp    c9b <test_copy_on_write_main_child+0x7b>
+     e61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e68:	8b 45 80             	mov    -0x80(%ebp),%eax
+     e6b:	c7 45 10 02 00 00 00 	movl   $0x2,0x10(%ebp)
+     e72:	c7 45 0c 25 3a 00 00 	movl   $0x3a25,0xc(%ebp)
+     e79:	89 45 08             	mov    %eax,0x8(%ebp)
+     e7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e7f:	5b                   	pop    %ebx
+     e80:	5e                   	pop    %esi
+     e81:	5f                   	pop    %edi
+     e82:	5d                   	pop    %ebp
+     e83:	e9 fb 18 00 00       	jmp    2783 <write>
+     e88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e8f:	90                   	nop
+     e90:	8b 55 84             	mov    -0x7c(%ebp),%edx
+     e93:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     e96:	89 d1                	mov    %edx,%ecx
+     e98:	c1 e9 1f             	shr    $0x1f,%ecx
+     e9b:	01 d1                	add    %edx,%ecx
+     e9d:	8b 55 88             	mov    -0x78(%ebp),%edx
+     ea0:	d1 f9                	sar    %ecx
+     ea2:	c6 04 0a 41          	movb   $0x41,(%edx,%ecx,1)
+     ea6:	8b 4d 8c             	mov    -0x74(%ebp),%ecx
+     ea9:	39 ca                	cmp    %ecx,%edx
+     eab:	0f 82 ef fe ff ff    	jb     da0 <test_copy_on_write_main_child+0x180>
+     eb1:	e9 11 ff ff ff       	jmp    dc7 <test_copy_on_write_main_child+0x1a7>
+     eb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ebd:	8d 76 00             	lea    0x0(%esi),%esi
+     ec0:	83 ec 08             	sub    $0x8,%esp
+     ec3:	68 60 32 00 00       	push   $0x3260
+     ec8:	6a 02                	push   $0x2
+     eca:	e8 41 1a 00 00       	call   2910 <printf>
+     ecf:	e8 0f 19 00 00       	call   27e3 <getpid>
+     ed4:	8b 0d 24 44 00 00    	mov    0x4424,%ecx
+     eda:	83 c4 10             	add    $0x10,%esp
+     edd:	85 c9                	test   %ecx,%ecx
+     edf:	0f 84 c1 fd ff ff    	je     ca6 <test_copy_on_write_main_child+0x86>
+     ee5:	89 c2                	mov    %eax,%edx
+     ee7:	b8 dd 39 00 00       	mov    $0x39dd,%eax
+     eec:	e8 af f1 ff ff       	call   a0 <dump_for.part.0>
+     ef1:	e9 b0 fd ff ff       	jmp    ca6 <test_copy_on_write_main_child+0x86>
+     ef6:	8b 7d 84             	mov    -0x7c(%ebp),%edi
+     ef9:	89 f8                	mov    %edi,%eax
+     efb:	c1 e8 1f             	shr    $0x1f,%eax
+     efe:	01 f8                	add    %edi,%eax
+     f00:	8b 7d 88             	mov    -0x78(%ebp),%edi
+     f03:	d1 f8                	sar    %eax
+     f05:	c6 04 07 41          	movb   $0x41,(%edi,%eax,1)
+     f09:	8b 45 8c             	mov    -0x74(%ebp),%eax
+     f0c:	39 c7                	cmp    %eax,%edi
+     f0e:	0f 83 54 ff ff ff    	jae    e68 <test_copy_on_write_main_child+0x248>
+     f14:	bf 20 00 00 00       	mov    $0x20,%edi
+     f19:	31 c0                	xor    %eax,%eax
+     f1b:	e9 80 fe ff ff       	jmp    da0 <test_copy_on_write_main_child+0x180>
+     f20:	e8 be 18 00 00       	call   27e3 <getpid>
+     f25:	89 c2                	mov    %eax,%edx
+     f27:	a1 24 44 00 00       	mov    0x4424,%eax
+     f2c:	85 c0                	test   %eax,%eax
+     f2e:	74 0a                	je     f3a <test_copy_on_write_main_child+0x31a>
+     f30:	b8 98 32 00 00       	mov    $0x3298,%eax
+     f35:	e8 66 f1 ff ff       	call   a0 <dump_for.part.0>
+     f3a:	8b 45 88             	mov    -0x78(%ebp),%eax
+     f3d:	8b 4d 8c             	mov    -0x74(%ebp),%ecx
+     f40:	39 c8                	cmp    %ecx,%eax
+     f42:	73 12                	jae    f56 <test_copy_on_write_main_child+0x336>
+     f44:	ba 01 00 00 00       	mov    $0x1,%edx
+     f49:	80 38 41             	cmpb   $0x41,(%eax)
+     f4c:	0f 45 da             	cmovne %edx,%ebx
+     f4f:	83 c0 01             	add    $0x1,%eax
+     f52:	39 c1                	cmp    %eax,%ecx
+     f54:	75 f3                	jne    f49 <test_copy_on_write_main_child+0x329>
+     f56:	8b 7d 84             	mov    -0x7c(%ebp),%edi
+     f59:	8b 4d 88             	mov    -0x78(%ebp),%ecx
+     f5c:	89 f8                	mov    %edi,%eax
+     f5e:	c1 e8 1f             	shr    $0x1f,%eax
+     f61:	01 f8                	add    %edi,%eax
+     f63:	d1 f8                	sar    %eax
+     f65:	01 c8                	add    %ecx,%eax
+     f67:	89 c1                	mov    %eax,%ecx
+     f69:	89 45 8c             	mov    %eax,-0x74(%ebp)
+     f6c:	8d 46 42             	lea    0x42(%esi),%eax
+     f6f:	88 01                	mov    %al,(%ecx)
+     f71:	89 f1                	mov    %esi,%ecx
+     f73:	8d 47 ff             	lea    -0x1(%edi),%eax
+     f76:	c1 e1 0c             	shl    $0xc,%ecx
+     f79:	39 cf                	cmp    %ecx,%edi
+     f7b:	89 4d 94             	mov    %ecx,-0x6c(%ebp)
+     f7e:	0f 4f c1             	cmovg  %ecx,%eax
+     f81:	89 45 90             	mov    %eax,-0x70(%ebp)
+     f84:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+     f8a:	7f 6d                	jg     ff9 <test_copy_on_write_main_child+0x3d9>
+     f8c:	e8 52 18 00 00       	call   27e3 <getpid>
+     f91:	89 c2                	mov    %eax,%edx
+     f93:	a1 24 44 00 00       	mov    0x4424,%eax
+     f98:	85 c0                	test   %eax,%eax
+     f9a:	74 0a                	je     fa6 <test_copy_on_write_main_child+0x386>
+     f9c:	b8 b8 32 00 00       	mov    $0x32b8,%eax
+     fa1:	e8 fa f0 ff ff       	call   a0 <dump_for.part.0>
+     fa6:	8b 7d 88             	mov    -0x78(%ebp),%edi
+     fa9:	8b 45 90             	mov    -0x70(%ebp),%eax
+     fac:	01 f8                	add    %edi,%eax
+     fae:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     fb1:	81 ef 00 10 00 00    	sub    $0x1000,%edi
+     fb7:	0f 88 f6 00 00 00    	js     10b3 <test_copy_on_write_main_child+0x493>
+     fbd:	8b 4d 84             	mov    -0x7c(%ebp),%ecx
+     fc0:	39 cf                	cmp    %ecx,%edi
+     fc2:	0f 8d eb 00 00 00    	jge    10b3 <test_copy_on_write_main_child+0x493>
+     fc8:	c6 00 43             	movb   $0x43,(%eax)
+     fcb:	8b 45 84             	mov    -0x7c(%ebp),%eax
+     fce:	83 e8 03             	sub    $0x3,%eax
+     fd1:	89 45 94             	mov    %eax,-0x6c(%ebp)
+     fd4:	8b 4d 88             	mov    -0x78(%ebp),%ecx
+     fd7:	b8 d9 39 00 00       	mov    $0x39d9,%eax
+     fdc:	80 3c 39 41          	cmpb   $0x41,(%ecx,%edi,1)
+     fe0:	0f 84 a4 00 00 00    	je     108a <test_copy_on_write_main_child+0x46a>
+     fe6:	83 ec 04             	sub    $0x4,%esp
+     fe9:	6a 01                	push   $0x1
+     feb:	50                   	push   %eax
+     fec:	ff 75 a4             	push   -0x5c(%ebp)
+     fef:	e8 8f 17 00 00       	call   2783 <write>
+     ff4:	e8 f7 fb ff ff       	call   bf0 <wait_forever>
+     ff9:	e8 e5 17 00 00       	call   27e3 <getpid>
+     ffe:	89 c2                	mov    %eax,%edx
+    1000:	a1 24 44 00 00       	mov    0x4424,%eax
+    1005:	85 c0                	test   %eax,%eax
+    1007:	74 0a                	je     1013 <test_copy_on_write_main_child+0x3f3>
+    1009:	b8 dc 32 00 00       	mov    $0x32dc,%eax
+    100e:	e8 8d f0 ff ff       	call   a0 <dump_for.part.0>
+    1013:	8b 45 94             	mov    -0x6c(%ebp),%eax
+    1016:	8d b8 00 f0 ff ff    	lea    -0x1000(%eax),%edi
+    101c:	8b 45 84             	mov    -0x7c(%ebp),%eax
+    101f:	39 c7                	cmp    %eax,%edi
+    1021:	0f 8d b4 00 00 00    	jge    10db <test_copy_on_write_main_child+0x4bb>
+    1027:	85 ff                	test   %edi,%edi
+    1029:	0f 88 ac 00 00 00    	js     10db <test_copy_on_write_main_child+0x4bb>
+    102f:	8b 45 88             	mov    -0x78(%ebp),%eax
+    1032:	8b 4d 90             	mov    -0x70(%ebp),%ecx
+    1035:	c6 04 08 43          	movb   $0x43,(%eax,%ecx,1)
+    1039:	e8 a5 17 00 00       	call   27e3 <getpid>
+    103e:	89 c2                	mov    %eax,%edx
+    1040:	8b 45 94             	mov    -0x6c(%ebp),%eax
+    1043:	05 00 10 00 00       	add    $0x1000,%eax
+    1048:	89 45 94             	mov    %eax,-0x6c(%ebp)
+    104b:	a1 24 44 00 00       	mov    0x4424,%eax
+    1050:	85 c0                	test   %eax,%eax
+    1052:	74 6a                	je     10be <test_copy_on_write_main_child+0x49e>
+    1054:	b8 fc 32 00 00       	mov    $0x32fc,%eax
+    1059:	e8 42 f0 ff ff       	call   a0 <dump_for.part.0>
+    105e:	8b 45 94             	mov    -0x6c(%ebp),%eax
+    1061:	39 45 84             	cmp    %eax,-0x7c(%ebp)
+    1064:	7e 60                	jle    10c6 <test_copy_on_write_main_child+0x4a6>
+    1066:	e8 78 17 00 00       	call   27e3 <getpid>
+    106b:	8b 0d 24 44 00 00    	mov    0x4424,%ecx
+    1071:	89 c2                	mov    %eax,%edx
+    1073:	85 c9                	test   %ecx,%ecx
+    1075:	0f 84 59 ff ff ff    	je     fd4 <test_copy_on_write_main_child+0x3b4>
+    107b:	b8 1c 33 00 00       	mov    $0x331c,%eax
+    1080:	e8 1b f0 ff ff       	call   a0 <dump_for.part.0>
+    1085:	e9 4a ff ff ff       	jmp    fd4 <test_copy_on_write_main_child+0x3b4>
+    108a:	8b 7d 8c             	mov    -0x74(%ebp),%edi
+    108d:	83 c6 42             	add    $0x42,%esi
+    1090:	0f be 17             	movsbl (%edi),%edx
+    1093:	39 f2                	cmp    %esi,%edx
+    1095:	0f 85 4b ff ff ff    	jne    fe6 <test_copy_on_write_main_child+0x3c6>
+    109b:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+    109e:	80 3c 39 41          	cmpb   $0x41,(%ecx,%edi,1)
+    10a2:	75 05                	jne    10a9 <test_copy_on_write_main_child+0x489>
+    10a4:	80 e3 01             	and    $0x1,%bl
+    10a7:	74 28                	je     10d1 <test_copy_on_write_main_child+0x4b1>
+    10a9:	b8 d9 39 00 00       	mov    $0x39d9,%eax
+    10ae:	e9 33 ff ff ff       	jmp    fe6 <test_copy_on_write_main_child+0x3c6>
+    10b3:	8b 7d 84             	mov    -0x7c(%ebp),%edi
+    10b6:	83 ef 02             	sub    $0x2,%edi
+    10b9:	e9 0a ff ff ff       	jmp    fc8 <test_copy_on_write_main_child+0x3a8>
+    10be:	8b 4d 94             	mov    -0x6c(%ebp),%ecx
+    10c1:	39 4d 84             	cmp    %ecx,-0x7c(%ebp)
+    10c4:	7f a0                	jg     1066 <test_copy_on_write_main_child+0x446>
+    10c6:	8b 45 84             	mov    -0x7c(%ebp),%eax
+    10c9:	83 e8 03             	sub    $0x3,%eax
+    10cc:	89 45 94             	mov    %eax,-0x6c(%ebp)
+    10cf:	eb 95                	jmp    1066 <test_copy_on_write_main_child+0x446>
+    10d1:	b8 db 39 00 00       	mov    $0x39db,%eax
+    10d6:	e9 0b ff ff ff       	jmp    fe6 <test_copy_on_write_main_child+0x3c6>
+    10db:	8b 45 84             	mov    -0x7c(%ebp),%eax
+    10de:	8d 78 fe             	lea    -0x2(%eax),%edi
+    10e1:	e9 49 ff ff ff       	jmp    102f <test_copy_on_write_main_child+0x40f>
+    10e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000010f0 <test_copy_on_write_main_child_alt>:
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	57                   	push   %edi
+    10f4:	56                   	push   %esi
+    10f5:	53                   	push   %ebx
+    10f6:	81 ec 08 01 00 00    	sub    $0x108,%esp
+    10fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+    10ff:	56                   	push   %esi
+    1100:	e8 e6 16 00 00       	call   27eb <sbrk>
+    1105:	89 85 0c ff ff ff    	mov    %eax,-0xf4(%ebp)
+    110b:	89 c7                	mov    %eax,%edi
+    110d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    1114:	e8 d2 16 00 00       	call   27eb <sbrk>
+    1119:	83 c4 10             	add    $0x10,%esp
+    111c:	89 85 10 ff ff ff    	mov    %eax,-0xf0(%ebp)
+    1122:	39 c7                	cmp    %eax,%edi
+    1124:	73 14                	jae    113a <test_copy_on_write_main_child_alt+0x4a>
+    1126:	8b 95 10 ff ff ff    	mov    -0xf0(%ebp),%edx
+    112c:	89 f8                	mov    %edi,%eax
+    112e:	66 90                	xchg   %ax,%ax
+    1130:	c6 00 41             	movb   $0x41,(%eax)
+    1133:	83 c0 01             	add    $0x1,%eax
+    1136:	39 c2                	cmp    %eax,%edx
+    1138:	75 f6                	jne    1130 <test_copy_on_write_main_child_alt+0x40>
+    113a:	31 c0                	xor    %eax,%eax
+    113c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    1141:	8d bd 28 ff ff ff    	lea    -0xd8(%ebp),%edi
+    1147:	83 7d 14 10          	cmpl   $0x10,0x14(%ebp)
+    114b:	f3 ab                	rep stos %eax,%es:(%edi)
+    114d:	0f 8f 35 02 00 00    	jg     1388 <test_copy_on_write_main_child_alt+0x298>
+    1153:	8b 45 14             	mov    0x14(%ebp),%eax
+    1156:	85 c0                	test   %eax,%eax
+    1158:	0f 8e d5 03 00 00    	jle    1533 <test_copy_on_write_main_child_alt+0x443>
+    115e:	8b 7d 14             	mov    0x14(%ebp),%edi
+    1161:	31 db                	xor    %ebx,%ebx
+    1163:	eb 18                	jmp    117d <test_copy_on_write_main_child_alt+0x8d>
+    1165:	8d 76 00             	lea    0x0(%esi),%esi
+    1168:	8d 53 01             	lea    0x1(%ebx),%edx
+    116b:	85 c0                	test   %eax,%eax
+    116d:	0f 84 2d 02 00 00    	je     13a0 <test_copy_on_write_main_child_alt+0x2b0>
+    1173:	39 fa                	cmp    %edi,%edx
+    1175:	0f 8d 1d 03 00 00    	jge    1498 <test_copy_on_write_main_child_alt+0x3a8>
+    117b:	89 d3                	mov    %edx,%ebx
+    117d:	83 ec 0c             	sub    $0xc,%esp
+    1180:	6a 01                	push   $0x1
+    1182:	e8 6c 16 00 00       	call   27f3 <sleep>
+    1187:	8d 84 dd 68 ff ff ff 	lea    -0x98(%ebp,%ebx,8),%eax
+    118e:	89 04 24             	mov    %eax,(%esp)
+    1191:	e8 dd 15 00 00       	call   2773 <pipe>
+    1196:	e8 c0 15 00 00       	call   275b <fork>
+    119b:	83 c4 10             	add    $0x10,%esp
+    119e:	89 84 9d 28 ff ff ff 	mov    %eax,-0xd8(%ebp,%ebx,4)
+    11a5:	83 f8 ff             	cmp    $0xffffffff,%eax
+    11a8:	75 be                	jne    1168 <test_copy_on_write_main_child_alt+0x78>
+    11aa:	83 ec 08             	sub    $0x8,%esp
+    11ad:	bf 01 00 00 00       	mov    $0x1,%edi
+    11b2:	68 c4 38 00 00       	push   $0x38c4
+    11b7:	6a 02                	push   $0x2
+    11b9:	e8 52 17 00 00       	call   2910 <printf>
+    11be:	83 c4 10             	add    $0x10,%esp
+    11c1:	b9 66 00 00 00       	mov    $0x66,%ecx
+    11c6:	8b 45 14             	mov    0x14(%ebp),%eax
+    11c9:	31 db                	xor    %ebx,%ebx
+    11cb:	85 c0                	test   %eax,%eax
+    11cd:	0f 8e 67 03 00 00    	jle    153a <test_copy_on_write_main_child_alt+0x44a>
+    11d3:	89 de                	mov    %ebx,%esi
+    11d5:	89 bd 14 ff ff ff    	mov    %edi,-0xec(%ebp)
+    11db:	89 cb                	mov    %ecx,%ebx
+    11dd:	eb 59                	jmp    1238 <test_copy_on_write_main_child_alt+0x148>
+    11df:	90                   	nop
+    11e0:	3c 2b                	cmp    $0x2b,%al
+    11e2:	b8 63 00 00 00       	mov    $0x63,%eax
+    11e7:	0f 45 d8             	cmovne %eax,%ebx
+    11ea:	b8 01 00 00 00       	mov    $0x1,%eax
+    11ef:	0f 44 85 14 ff ff ff 	cmove  -0xec(%ebp),%eax
+    11f6:	89 85 14 ff ff ff    	mov    %eax,-0xec(%ebp)
+    11fc:	83 ec 0c             	sub    $0xc,%esp
+    11ff:	ff b4 f5 68 ff ff ff 	push   -0x98(%ebp,%esi,8)
+    1206:	e8 80 15 00 00       	call   278b <close>
+    120b:	58                   	pop    %eax
+    120c:	ff b4 f5 6c ff ff ff 	push   -0x94(%ebp,%esi,8)
+    1213:	e8 73 15 00 00       	call   278b <close>
+    1218:	a1 24 44 00 00       	mov    0x4424,%eax
+    121d:	83 c4 10             	add    $0x10,%esp
+    1220:	85 c0                	test   %eax,%eax
+    1222:	74 0c                	je     1230 <test_copy_on_write_main_child_alt+0x140>
+    1224:	89 fa                	mov    %edi,%edx
+    1226:	b8 28 3a 00 00       	mov    $0x3a28,%eax
+    122b:	e8 70 ee ff ff       	call   a0 <dump_for.part.0>
+    1230:	83 c6 01             	add    $0x1,%esi
+    1233:	39 75 14             	cmp    %esi,0x14(%ebp)
+    1236:	74 58                	je     1290 <test_copy_on_write_main_child_alt+0x1a0>
+    1238:	8b bc b5 28 ff ff ff 	mov    -0xd8(%ebp,%esi,4),%edi
+    123f:	83 ff ff             	cmp    $0xffffffff,%edi
+    1242:	74 ec                	je     1230 <test_copy_on_write_main_child_alt+0x140>
+    1244:	83 ec 04             	sub    $0x4,%esp
+    1247:	8d 85 26 ff ff ff    	lea    -0xda(%ebp),%eax
+    124d:	c6 85 26 ff ff ff 58 	movb   $0x58,-0xda(%ebp)
+    1254:	6a 01                	push   $0x1
+    1256:	50                   	push   %eax
+    1257:	ff b4 f5 68 ff ff ff 	push   -0x98(%ebp,%esi,8)
+    125e:	e8 18 15 00 00       	call   277b <read>
+    1263:	0f b6 85 26 ff ff ff 	movzbl -0xda(%ebp),%eax
+    126a:	83 c4 10             	add    $0x10,%esp
+    126d:	3c 58                	cmp    $0x58,%al
+    126f:	0f 85 6b ff ff ff    	jne    11e0 <test_copy_on_write_main_child_alt+0xf0>
+    1275:	c7 85 14 ff ff ff 01 	movl   $0x1,-0xec(%ebp)
+    127c:	00 00 00 
+    127f:	bb 50 00 00 00       	mov    $0x50,%ebx
+    1284:	e9 73 ff ff ff       	jmp    11fc <test_copy_on_write_main_child_alt+0x10c>
+    1289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1290:	8b bd 14 ff ff ff    	mov    -0xec(%ebp),%edi
+    1296:	88 9d 14 ff ff ff    	mov    %bl,-0xec(%ebp)
+    129c:	e8 42 15 00 00       	call   27e3 <getpid>
+    12a1:	8b 35 24 44 00 00    	mov    0x4424,%esi
+    12a7:	0f b6 8d 14 ff ff ff 	movzbl -0xec(%ebp),%ecx
+    12ae:	85 f6                	test   %esi,%esi
+    12b0:	74 19                	je     12cb <test_copy_on_write_main_child_alt+0x1db>
+    12b2:	89 c2                	mov    %eax,%edx
+    12b4:	b8 39 3a 00 00       	mov    $0x3a39,%eax
+    12b9:	88 8d 14 ff ff ff    	mov    %cl,-0xec(%ebp)
+    12bf:	e8 dc ed ff ff       	call   a0 <dump_for.part.0>
+    12c4:	0f b6 8d 14 ff ff ff 	movzbl -0xec(%ebp),%ecx
+    12cb:	31 db                	xor    %ebx,%ebx
+    12cd:	8b 75 14             	mov    0x14(%ebp),%esi
+    12d0:	89 bd 14 ff ff ff    	mov    %edi,-0xec(%ebp)
+    12d6:	89 df                	mov    %ebx,%edi
+    12d8:	89 cb                	mov    %ecx,%ebx
+    12da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    12e0:	83 ec 0c             	sub    $0xc,%esp
+    12e3:	ff b4 bd 28 ff ff ff 	push   -0xd8(%ebp,%edi,4)
+    12ea:	83 c7 01             	add    $0x1,%edi
+    12ed:	e8 a1 14 00 00       	call   2793 <kill>
+    12f2:	e8 74 14 00 00       	call   276b <wait>
+    12f7:	83 c4 10             	add    $0x10,%esp
+    12fa:	39 fe                	cmp    %edi,%esi
+    12fc:	75 e2                	jne    12e0 <test_copy_on_write_main_child_alt+0x1f0>
+    12fe:	8b bd 14 ff ff ff    	mov    -0xec(%ebp),%edi
+    1304:	89 d9                	mov    %ebx,%ecx
+    1306:	8b 9d 0c ff ff ff    	mov    -0xf4(%ebp),%ebx
+    130c:	8b b5 10 ff ff ff    	mov    -0xf0(%ebp),%esi
+    1312:	39 f3                	cmp    %esi,%ebx
+    1314:	73 1a                	jae    1330 <test_copy_on_write_main_child_alt+0x240>
+    1316:	ba 70 00 00 00       	mov    $0x70,%edx
+    131b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1320:	80 3b 41             	cmpb   $0x41,(%ebx)
+    1323:	0f 45 ca             	cmovne %edx,%ecx
+    1326:	0f 45 f8             	cmovne %eax,%edi
+    1329:	83 c3 01             	add    $0x1,%ebx
+    132c:	39 de                	cmp    %ebx,%esi
+    132e:	75 f0                	jne    1320 <test_copy_on_write_main_child_alt+0x230>
+    1330:	85 ff                	test   %edi,%edi
+    1332:	74 34                	je     1368 <test_copy_on_write_main_child_alt+0x278>
+    1334:	83 ec 04             	sub    $0x4,%esp
+    1337:	8d 85 26 ff ff ff    	lea    -0xda(%ebp),%eax
+    133d:	bb 4e 20 00 00       	mov    $0x204e,%ebx
+    1342:	66 89 9d 26 ff ff ff 	mov    %bx,-0xda(%ebp)
+    1349:	88 8d 27 ff ff ff    	mov    %cl,-0xd9(%ebp)
+    134f:	6a 02                	push   $0x2
+    1351:	50                   	push   %eax
+    1352:	ff 75 08             	push   0x8(%ebp)
+    1355:	e8 29 14 00 00       	call   2783 <write>
+    135a:	83 c4 10             	add    $0x10,%esp
+    135d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1360:	5b                   	pop    %ebx
+    1361:	5e                   	pop    %esi
+    1362:	5f                   	pop    %edi
+    1363:	5d                   	pop    %ebp
+    1364:	c3                   	ret
+    1365:	8d 76 00             	lea    0x0(%esi),%esi
+    1368:	83 ec 04             	sub    $0x4,%esp
+    136b:	6a 02                	push   $0x2
+    136d:	68 25 3a 00 00       	push   $0x3a25
+    1372:	ff 75 08             	push   0x8(%ebp)
+    1375:	e8 09 14 00 00       	call   2783 <write>
+    137a:	83 c4 10             	add    $0x10,%esp
+    137d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1380:	5b                   	pop    %ebx
+    1381:	5e                   	pop    %esi
+    1382:	5f                   	pop    %edi
+    1383:	5d                   	pop    %ebp
+    1384:	c3                   	ret
+    1385:	8d 76 00             	lea    0x0(%esi),%esi
+    1388:	83 ec 08             	sub    $0x8,%esp
+    138b:	68 60 32 00 00       	push   $0x3260
+    1390:	6a 02                	push   $0x2
+    1392:	e8 79 15 00 00       	call   2910 <printf>
+    1397:	83 c4 10             	add    $0x10,%esp
+    139a:	e9 bf fd ff ff       	jmp    115e <test_copy_on_write_main_child_alt+0x6e>
+    139f:	90                   	nop
+    13a0:	89 c7                	mov    %eax,%edi
+    13a2:	8b 95 10 ff ff ff    	mov    -0xf0(%ebp),%edx
+    13a8:	8b 85 0c ff ff ff    	mov    -0xf4(%ebp),%eax
+    13ae:	39 d0                	cmp    %edx,%eax
+    13b0:	73 1b                	jae    13cd <test_copy_on_write_main_child_alt+0x2dd>
+    13b2:	b9 01 00 00 00       	mov    $0x1,%ecx
+    13b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13be:	66 90                	xchg   %ax,%ax
+    13c0:	80 38 41             	cmpb   $0x41,(%eax)
+    13c3:	0f 45 f9             	cmovne %ecx,%edi
+    13c6:	83 c0 01             	add    $0x1,%eax
+    13c9:	39 c2                	cmp    %eax,%edx
+    13cb:	75 f3                	jne    13c0 <test_copy_on_write_main_child_alt+0x2d0>
+    13cd:	89 f0                	mov    %esi,%eax
+    13cf:	8b 95 0c ff ff ff    	mov    -0xf4(%ebp),%edx
+    13d5:	c1 e8 1f             	shr    $0x1f,%eax
+    13d8:	01 f0                	add    %esi,%eax
+    13da:	d1 f8                	sar    %eax
+    13dc:	01 d0                	add    %edx,%eax
+    13de:	89 c1                	mov    %eax,%ecx
+    13e0:	89 85 08 ff ff ff    	mov    %eax,-0xf8(%ebp)
+    13e6:	8d 43 42             	lea    0x42(%ebx),%eax
+    13e9:	88 01                	mov    %al,(%ecx)
+    13eb:	89 d9                	mov    %ebx,%ecx
+    13ed:	8d 46 ff             	lea    -0x1(%esi),%eax
+    13f0:	c1 e1 0c             	shl    $0xc,%ecx
+    13f3:	39 ce                	cmp    %ecx,%esi
+    13f5:	0f 4f c1             	cmovg  %ecx,%eax
+    13f8:	01 d0                	add    %edx,%eax
+    13fa:	89 c2                	mov    %eax,%edx
+    13fc:	89 85 04 ff ff ff    	mov    %eax,-0xfc(%ebp)
+    1402:	8d 43 43             	lea    0x43(%ebx),%eax
+    1405:	88 02                	mov    %al,(%edx)
+    1407:	8d 81 00 f0 ff ff    	lea    -0x1000(%ecx),%eax
+    140d:	39 c6                	cmp    %eax,%esi
+    140f:	0f 8e 9b 00 00 00    	jle    14b0 <test_copy_on_write_main_child_alt+0x3c0>
+    1415:	85 c0                	test   %eax,%eax
+    1417:	0f 88 93 00 00 00    	js     14b0 <test_copy_on_write_main_child_alt+0x3c0>
+    141d:	8d 91 00 10 00 00    	lea    0x1000(%ecx),%edx
+    1423:	8d 4e fd             	lea    -0x3(%esi),%ecx
+    1426:	39 d6                	cmp    %edx,%esi
+    1428:	0f 4e d1             	cmovle %ecx,%edx
+    142b:	8b 8d 0c ff ff ff    	mov    -0xf4(%ebp),%ecx
+    1431:	01 c1                	add    %eax,%ecx
+    1433:	80 39 41             	cmpb   $0x41,(%ecx)
+    1436:	0f 84 cc 00 00 00    	je     1508 <test_copy_on_write_main_child_alt+0x418>
+    143c:	bf 01 00 00 00       	mov    $0x1,%edi
+    1441:	83 ec 0c             	sub    $0xc,%esp
+    1444:	89 95 10 ff ff ff    	mov    %edx,-0xf0(%ebp)
+    144a:	89 8d 14 ff ff ff    	mov    %ecx,-0xec(%ebp)
+    1450:	6a 05                	push   $0x5
+    1452:	e8 9c 13 00 00       	call   27f3 <sleep>
+    1457:	8b 8d 14 ff ff ff    	mov    -0xec(%ebp),%ecx
+    145d:	83 c4 10             	add    $0x10,%esp
+    1460:	8b 95 10 ff ff ff    	mov    -0xf0(%ebp),%edx
+    1466:	b8 d9 39 00 00       	mov    $0x39d9,%eax
+    146b:	80 39 41             	cmpb   $0x41,(%ecx)
+    146e:	74 50                	je     14c0 <test_copy_on_write_main_child_alt+0x3d0>
+    1470:	83 ec 04             	sub    $0x4,%esp
+    1473:	6a 01                	push   $0x1
+    1475:	50                   	push   %eax
+    1476:	ff b4 dd 6c ff ff ff 	push   -0x94(%ebp,%ebx,8)
+    147d:	e8 01 13 00 00       	call   2783 <write>
+    1482:	8b 45 18             	mov    0x18(%ebp),%eax
+    1485:	83 c4 10             	add    $0x10,%esp
+    1488:	85 c0                	test   %eax,%eax
+    148a:	74 1c                	je     14a8 <test_copy_on_write_main_child_alt+0x3b8>
+    148c:	e8 d2 12 00 00       	call   2763 <exit>
+    1491:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1498:	b9 20 00 00 00       	mov    $0x20,%ecx
+    149d:	31 ff                	xor    %edi,%edi
+    149f:	e9 22 fd ff ff       	jmp    11c6 <test_copy_on_write_main_child_alt+0xd6>
+    14a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    14a8:	e8 43 f7 ff ff       	call   bf0 <wait_forever>
+    14ad:	8d 76 00             	lea    0x0(%esi),%esi
+    14b0:	8d 46 fe             	lea    -0x2(%esi),%eax
+    14b3:	e9 65 ff ff ff       	jmp    141d <test_copy_on_write_main_child_alt+0x32d>
+    14b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14bf:	90                   	nop
+    14c0:	8b 8d 0c ff ff ff    	mov    -0xf4(%ebp),%ecx
+    14c6:	80 3c 11 41          	cmpb   $0x41,(%ecx,%edx,1)
+    14ca:	75 a4                	jne    1470 <test_copy_on_write_main_child_alt+0x380>
+    14cc:	8b 8d 04 ff ff ff    	mov    -0xfc(%ebp),%ecx
+    14d2:	0f be 11             	movsbl (%ecx),%edx
+    14d5:	8d 4b 43             	lea    0x43(%ebx),%ecx
+    14d8:	39 ca                	cmp    %ecx,%edx
+    14da:	75 94                	jne    1470 <test_copy_on_write_main_child_alt+0x380>
+    14dc:	8b 85 08 ff ff ff    	mov    -0xf8(%ebp),%eax
+    14e2:	0f be 08             	movsbl (%eax),%ecx
+    14e5:	8d 43 42             	lea    0x42(%ebx),%eax
+    14e8:	39 c1                	cmp    %eax,%ecx
+    14ea:	75 0e                	jne    14fa <test_copy_on_write_main_child_alt+0x40a>
+    14ec:	83 e7 01             	and    $0x1,%edi
+    14ef:	b8 db 39 00 00       	mov    $0x39db,%eax
+    14f4:	0f 84 76 ff ff ff    	je     1470 <test_copy_on_write_main_child_alt+0x380>
+    14fa:	b8 d9 39 00 00       	mov    $0x39d9,%eax
+    14ff:	e9 6c ff ff ff       	jmp    1470 <test_copy_on_write_main_child_alt+0x380>
+    1504:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1508:	8b 85 08 ff ff ff    	mov    -0xf8(%ebp),%eax
+    150e:	0f be 30             	movsbl (%eax),%esi
+    1511:	8d 43 42             	lea    0x42(%ebx),%eax
+    1514:	39 c6                	cmp    %eax,%esi
+    1516:	0f 85 20 ff ff ff    	jne    143c <test_copy_on_write_main_child_alt+0x34c>
+    151c:	8b 85 0c ff ff ff    	mov    -0xf4(%ebp),%eax
+    1522:	80 3c 10 41          	cmpb   $0x41,(%eax,%edx,1)
+    1526:	b8 01 00 00 00       	mov    $0x1,%eax
+    152b:	0f 45 f8             	cmovne %eax,%edi
+    152e:	e9 0e ff ff ff       	jmp    1441 <test_copy_on_write_main_child_alt+0x351>
+    1533:	b9 20 00 00 00       	mov    $0x20,%ecx
+    1538:	31 ff                	xor    %edi,%edi
+    153a:	88 8d 14 ff ff ff    	mov    %cl,-0xec(%ebp)
+    1540:	e8 9e 12 00 00       	call   27e3 <getpid>
+    1545:	8b 15 24 44 00 00    	mov    0x4424,%edx
+    154b:	0f b6 8d 14 ff ff ff 	movzbl -0xec(%ebp),%ecx
+    1552:	85 d2                	test   %edx,%edx
+    1554:	0f 84 ac fd ff ff    	je     1306 <test_copy_on_write_main_child_alt+0x216>
+    155a:	89 c2                	mov    %eax,%edx
+    155c:	b8 39 3a 00 00       	mov    $0x3a39,%eax
+    1561:	88 8d 14 ff ff ff    	mov    %cl,-0xec(%ebp)
+    1567:	e8 34 eb ff ff       	call   a0 <dump_for.part.0>
+    156c:	0f b6 8d 14 ff ff ff 	movzbl -0xec(%ebp),%ecx
+    1573:	e9 8e fd ff ff       	jmp    1306 <test_copy_on_write_main_child_alt+0x216>
+    1578:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    157f:	90                   	nop
+
+00001580 <_show_cow_test_error>:
+    1580:	55                   	push   %ebp
+    1581:	89 e5                	mov    %esp,%ebp
+    1583:	83 ec 08             	sub    $0x8,%esp
+    1586:	8b 55 08             	mov    0x8(%ebp),%edx
+    1589:	0f b6 02             	movzbl (%edx),%eax
+    158c:	3c 58                	cmp    $0x58,%al
+    158e:	74 20                	je     15b0 <_show_cow_test_error+0x30>
+    1590:	3c 4e                	cmp    $0x4e,%al
+    1592:	74 0c                	je     15a0 <_show_cow_test_error+0x20>
+    1594:	c9                   	leave
+    1595:	c3                   	ret
+    1596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    159d:	8d 76 00             	lea    0x0(%esi),%esi
+    15a0:	c9                   	leave
+    15a1:	89 d0                	mov    %edx,%eax
+    15a3:	e9 58 ec ff ff       	jmp    200 <_show_cow_test_error.part.0>
+    15a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15af:	90                   	nop
+    15b0:	83 ec 08             	sub    $0x8,%esp
+    15b3:	68 3c 33 00 00       	push   $0x333c
+    15b8:	6a 01                	push   $0x1
+    15ba:	e8 51 13 00 00       	call   2910 <printf>
+    15bf:	83 c4 10             	add    $0x10,%esp
+    15c2:	c9                   	leave
+    15c3:	c3                   	ret
+    15c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15cf:	90                   	nop
+
+000015d0 <test_copy_on_write_less_forks>:
+    15d0:	55                   	push   %ebp
+    15d1:	89 e5                	mov    %esp,%ebp
+    15d3:	57                   	push   %edi
+    15d4:	56                   	push   %esi
+    15d5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    15d8:	8d 7d de             	lea    -0x22(%ebp),%edi
+    15db:	53                   	push   %ebx
+    15dc:	83 ec 28             	sub    $0x28,%esp
+    15df:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    15e2:	8b 75 10             	mov    0x10(%ebp),%esi
+    15e5:	50                   	push   %eax
+    15e6:	e8 88 11 00 00       	call   2773 <pipe>
+    15eb:	56                   	push   %esi
+    15ec:	53                   	push   %ebx
+    15ed:	ff 75 08             	push   0x8(%ebp)
+    15f0:	ff 75 e4             	push   -0x1c(%ebp)
+    15f3:	e8 28 f6 ff ff       	call   c20 <test_copy_on_write_main_child>
+    15f8:	83 c4 1c             	add    $0x1c,%esp
+    15fb:	b8 58 58 00 00       	mov    $0x5858,%eax
+    1600:	66 89 45 de          	mov    %ax,-0x22(%ebp)
+    1604:	6a 02                	push   $0x2
+    1606:	57                   	push   %edi
+    1607:	ff 75 e0             	push   -0x20(%ebp)
+    160a:	e8 6c 11 00 00       	call   277b <read>
+    160f:	5a                   	pop    %edx
+    1610:	ff 75 e0             	push   -0x20(%ebp)
+    1613:	e8 73 11 00 00       	call   278b <close>
+    1618:	59                   	pop    %ecx
+    1619:	ff 75 e4             	push   -0x1c(%ebp)
+    161c:	e8 6a 11 00 00       	call   278b <close>
+    1621:	0f b6 45 de          	movzbl -0x22(%ebp),%eax
+    1625:	83 c4 10             	add    $0x10,%esp
+    1628:	3c 59                	cmp    $0x59,%al
+    162a:	74 14                	je     1640 <test_copy_on_write_less_forks+0x70>
+    162c:	3c 58                	cmp    $0x58,%al
+    162e:	74 40                	je     1670 <test_copy_on_write_less_forks+0xa0>
+    1630:	3c 4e                	cmp    $0x4e,%al
+    1632:	74 2c                	je     1660 <test_copy_on_write_less_forks+0x90>
+    1634:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1637:	31 c0                	xor    %eax,%eax
+    1639:	5b                   	pop    %ebx
+    163a:	5e                   	pop    %esi
+    163b:	5f                   	pop    %edi
+    163c:	5d                   	pop    %ebp
+    163d:	c3                   	ret
+    163e:	66 90                	xchg   %ax,%ax
+    1640:	56                   	push   %esi
+    1641:	53                   	push   %ebx
+    1642:	68 70 33 00 00       	push   $0x3370
+    1647:	6a 01                	push   $0x1
+    1649:	e8 c2 12 00 00       	call   2910 <printf>
+    164e:	83 c4 10             	add    $0x10,%esp
+    1651:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1654:	b8 01 00 00 00       	mov    $0x1,%eax
+    1659:	5b                   	pop    %ebx
+    165a:	5e                   	pop    %esi
+    165b:	5f                   	pop    %edi
+    165c:	5d                   	pop    %ebp
+    165d:	c3                   	ret
+    165e:	66 90                	xchg   %ax,%ax
+    1660:	89 f8                	mov    %edi,%eax
+    1662:	e8 99 eb ff ff       	call   200 <_show_cow_test_error.part.0>
+    1667:	eb cb                	jmp    1634 <test_copy_on_write_less_forks+0x64>
+    1669:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1670:	83 ec 08             	sub    $0x8,%esp
+    1673:	68 3c 33 00 00       	push   $0x333c
+    1678:	6a 01                	push   $0x1
+    167a:	e8 91 12 00 00       	call   2910 <printf>
+    167f:	83 c4 10             	add    $0x10,%esp
+    1682:	eb b0                	jmp    1634 <test_copy_on_write_less_forks+0x64>
+    1684:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    168b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    168f:	90                   	nop
+
+00001690 <test_copy_on_write_less_forks_alt>:
+    1690:	55                   	push   %ebp
+    1691:	89 e5                	mov    %esp,%ebp
+    1693:	57                   	push   %edi
+    1694:	56                   	push   %esi
+    1695:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1698:	8d 7d de             	lea    -0x22(%ebp),%edi
+    169b:	53                   	push   %ebx
+    169c:	83 ec 28             	sub    $0x28,%esp
+    169f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    16a2:	8b 75 10             	mov    0x10(%ebp),%esi
+    16a5:	50                   	push   %eax
+    16a6:	e8 c8 10 00 00       	call   2773 <pipe>
+    16ab:	58                   	pop    %eax
+    16ac:	ff 75 14             	push   0x14(%ebp)
+    16af:	56                   	push   %esi
+    16b0:	53                   	push   %ebx
+    16b1:	ff 75 08             	push   0x8(%ebp)
+    16b4:	ff 75 e4             	push   -0x1c(%ebp)
+    16b7:	e8 34 fa ff ff       	call   10f0 <test_copy_on_write_main_child_alt>
+    16bc:	83 c4 1c             	add    $0x1c,%esp
+    16bf:	ba 58 58 00 00       	mov    $0x5858,%edx
+    16c4:	66 89 55 de          	mov    %dx,-0x22(%ebp)
+    16c8:	6a 02                	push   $0x2
+    16ca:	57                   	push   %edi
+    16cb:	ff 75 e0             	push   -0x20(%ebp)
+    16ce:	e8 a8 10 00 00       	call   277b <read>
+    16d3:	59                   	pop    %ecx
+    16d4:	ff 75 e0             	push   -0x20(%ebp)
+    16d7:	e8 af 10 00 00       	call   278b <close>
+    16dc:	58                   	pop    %eax
+    16dd:	ff 75 e4             	push   -0x1c(%ebp)
+    16e0:	e8 a6 10 00 00       	call   278b <close>
+    16e5:	0f b6 45 de          	movzbl -0x22(%ebp),%eax
+    16e9:	83 c4 10             	add    $0x10,%esp
+    16ec:	3c 59                	cmp    $0x59,%al
+    16ee:	74 18                	je     1708 <test_copy_on_write_less_forks_alt+0x78>
+    16f0:	3c 58                	cmp    $0x58,%al
+    16f2:	74 4c                	je     1740 <test_copy_on_write_less_forks_alt+0xb0>
+    16f4:	3c 4e                	cmp    $0x4e,%al
+    16f6:	74 38                	je     1730 <test_copy_on_write_less_forks_alt+0xa0>
+    16f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16fb:	31 c0                	xor    %eax,%eax
+    16fd:	5b                   	pop    %ebx
+    16fe:	5e                   	pop    %esi
+    16ff:	5f                   	pop    %edi
+    1700:	5d                   	pop    %ebp
+    1701:	c3                   	ret
+    1702:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1708:	56                   	push   %esi
+    1709:	53                   	push   %ebx
+    170a:	68 70 33 00 00       	push   $0x3370
+    170f:	6a 01                	push   $0x1
+    1711:	e8 fa 11 00 00       	call   2910 <printf>
+    1716:	83 c4 10             	add    $0x10,%esp
+    1719:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    171c:	b8 01 00 00 00       	mov    $0x1,%eax
+    1721:	5b                   	pop    %ebx
+    1722:	5e                   	pop    %esi
+    1723:	5f                   	pop    %edi
+    1724:	5d                   	pop    %ebp
+    1725:	c3                   	ret
+    1726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    172d:	8d 76 00             	lea    0x0(%esi),%esi
+    1730:	89 f8                	mov    %edi,%eax
+    1732:	e8 c9 ea ff ff       	call   200 <_show_cow_test_error.part.0>
+    1737:	eb bf                	jmp    16f8 <test_copy_on_write_less_forks_alt+0x68>
+    1739:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1740:	83 ec 08             	sub    $0x8,%esp
+    1743:	68 3c 33 00 00       	push   $0x333c
+    1748:	6a 01                	push   $0x1
+    174a:	e8 c1 11 00 00       	call   2910 <printf>
+    174f:	83 c4 10             	add    $0x10,%esp
+    1752:	eb a4                	jmp    16f8 <test_copy_on_write_less_forks_alt+0x68>
+    1754:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    175b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    175f:	90                   	nop
+
+00001760 <_test_copy_on_write>:
+    1760:	55                   	push   %ebp
+    1761:	89 e5                	mov    %esp,%ebp
+    1763:	53                   	push   %ebx
+    1764:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1767:	83 ec 30             	sub    $0x30,%esp
+    176a:	50                   	push   %eax
+    176b:	e8 03 10 00 00       	call   2773 <pipe>
+    1770:	e8 e6 0f 00 00       	call   275b <fork>
+    1775:	83 c4 10             	add    $0x10,%esp
+    1778:	83 f8 ff             	cmp    $0xffffffff,%eax
+    177b:	0f 84 cf 00 00 00    	je     1850 <_test_copy_on_write+0xf0>
+    1781:	85 c0                	test   %eax,%eax
+    1783:	0f 84 5e 01 00 00    	je     18e7 <_test_copy_on_write+0x187>
+    1789:	7f 0d                	jg     1798 <_test_copy_on_write+0x38>
+    178b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    178e:	31 c0                	xor    %eax,%eax
+    1790:	c9                   	leave
+    1791:	c3                   	ret
+    1792:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1798:	83 ec 08             	sub    $0x8,%esp
+    179b:	68 4b 3a 00 00       	push   $0x3a4b
+    17a0:	6a 01                	push   $0x1
+    17a2:	e8 69 11 00 00       	call   2910 <printf>
+    17a7:	8b 45 1c             	mov    0x1c(%ebp),%eax
+    17aa:	83 c4 10             	add    $0x10,%esp
+    17ad:	85 c0                	test   %eax,%eax
+    17af:	0f 8f bb 00 00 00    	jg     1870 <_test_copy_on_write+0x110>
+    17b5:	ff 75 10             	push   0x10(%ebp)
+    17b8:	ff 75 0c             	push   0xc(%ebp)
+    17bb:	68 e0 33 00 00       	push   $0x33e0
+    17c0:	6a 01                	push   $0x1
+    17c2:	e8 49 11 00 00       	call   2910 <printf>
+    17c7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+    17ca:	83 c4 10             	add    $0x10,%esp
+    17cd:	85 db                	test   %ebx,%ebx
+    17cf:	0f 85 db 00 00 00    	jne    18b0 <_test_copy_on_write+0x150>
+    17d5:	83 ec 08             	sub    $0x8,%esp
+    17d8:	8d 5d ee             	lea    -0x12(%ebp),%ebx
+    17db:	68 2f 39 00 00       	push   $0x392f
+    17e0:	6a 01                	push   $0x1
+    17e2:	e8 29 11 00 00       	call   2910 <printf>
+    17e7:	31 c0                	xor    %eax,%eax
+    17e9:	c7 45 ee 58 58 00 00 	movl   $0x5858,-0x12(%ebp)
+    17f0:	c7 45 f2 00 00 00 00 	movl   $0x0,-0xe(%ebp)
+    17f7:	66 89 45 f6          	mov    %ax,-0xa(%ebp)
+    17fb:	5a                   	pop    %edx
+    17fc:	ff 75 e8             	push   -0x18(%ebp)
+    17ff:	e8 87 0f 00 00       	call   278b <close>
+    1804:	83 c4 0c             	add    $0xc,%esp
+    1807:	6a 0a                	push   $0xa
+    1809:	53                   	push   %ebx
+    180a:	ff 75 e4             	push   -0x1c(%ebp)
+    180d:	e8 69 0f 00 00       	call   277b <read>
+    1812:	e8 54 0f 00 00       	call   276b <wait>
+    1817:	59                   	pop    %ecx
+    1818:	ff 75 e4             	push   -0x1c(%ebp)
+    181b:	e8 6b 0f 00 00       	call   278b <close>
+    1820:	0f b6 45 ee          	movzbl -0x12(%ebp),%eax
+    1824:	83 c4 10             	add    $0x10,%esp
+    1827:	3c 59                	cmp    $0x59,%al
+    1829:	74 65                	je     1890 <_test_copy_on_write+0x130>
+    182b:	3c 58                	cmp    $0x58,%al
+    182d:	0f 84 9d 00 00 00    	je     18d0 <_test_copy_on_write+0x170>
+    1833:	3c 4e                	cmp    $0x4e,%al
+    1835:	0f 85 50 ff ff ff    	jne    178b <_test_copy_on_write+0x2b>
+    183b:	89 d8                	mov    %ebx,%eax
+    183d:	e8 be e9 ff ff       	call   200 <_show_cow_test_error.part.0>
+    1842:	e9 44 ff ff ff       	jmp    178b <_test_copy_on_write+0x2b>
+    1847:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    184e:	66 90                	xchg   %ax,%ax
+    1850:	83 ec 08             	sub    $0x8,%esp
+    1853:	68 f9 38 00 00       	push   $0x38f9
+    1858:	6a 01                	push   $0x1
+    185a:	e8 b1 10 00 00       	call   2910 <printf>
+    185f:	83 c4 10             	add    $0x10,%esp
+    1862:	e9 24 ff ff ff       	jmp    178b <_test_copy_on_write+0x2b>
+    1867:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    186e:	66 90                	xchg   %ax,%ax
+    1870:	83 ec 04             	sub    $0x4,%esp
+    1873:	ff 75 20             	push   0x20(%ebp)
+    1876:	68 68 3a 00 00       	push   $0x3a68
+    187b:	6a 01                	push   $0x1
+    187d:	e8 8e 10 00 00       	call   2910 <printf>
+    1882:	83 c4 10             	add    $0x10,%esp
+    1885:	e9 2b ff ff ff       	jmp    17b5 <_test_copy_on_write+0x55>
+    188a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    1890:	ff 75 10             	push   0x10(%ebp)
+    1893:	ff 75 0c             	push   0xc(%ebp)
+    1896:	68 70 33 00 00       	push   $0x3370
+    189b:	6a 01                	push   $0x1
+    189d:	e8 6e 10 00 00       	call   2910 <printf>
+    18a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    18a5:	83 c4 10             	add    $0x10,%esp
+    18a8:	b8 01 00 00 00       	mov    $0x1,%eax
+    18ad:	c9                   	leave
+    18ae:	c3                   	ret
+    18af:	90                   	nop
+    18b0:	83 ec 08             	sub    $0x8,%esp
+    18b3:	68 2c 34 00 00       	push   $0x342c
+    18b8:	6a 01                	push   $0x1
+    18ba:	e8 51 10 00 00       	call   2910 <printf>
+    18bf:	83 c4 10             	add    $0x10,%esp
+    18c2:	e9 0e ff ff ff       	jmp    17d5 <_test_copy_on_write+0x75>
+    18c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ce:	66 90                	xchg   %ax,%ax
+    18d0:	83 ec 08             	sub    $0x8,%esp
+    18d3:	68 3c 33 00 00       	push   $0x333c
+    18d8:	6a 01                	push   $0x1
+    18da:	e8 31 10 00 00       	call   2910 <printf>
+    18df:	83 c4 10             	add    $0x10,%esp
+    18e2:	e9 a4 fe ff ff       	jmp    178b <_test_copy_on_write+0x2b>
+    18e7:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+    18eb:	7e 0e                	jle    18fb <_test_copy_on_write+0x19b>
+    18ed:	83 ec 0c             	sub    $0xc,%esp
+    18f0:	ff 75 1c             	push   0x1c(%ebp)
+    18f3:	e8 f3 0e 00 00       	call   27eb <sbrk>
+    18f8:	83 c4 10             	add    $0x10,%esp
+    18fb:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    18ff:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1902:	74 1d                	je     1921 <_test_copy_on_write+0x1c1>
+    1904:	83 ec 0c             	sub    $0xc,%esp
+    1907:	ff 75 18             	push   0x18(%ebp)
+    190a:	ff 75 10             	push   0x10(%ebp)
+    190d:	ff 75 0c             	push   0xc(%ebp)
+    1910:	ff 75 08             	push   0x8(%ebp)
+    1913:	50                   	push   %eax
+    1914:	e8 d7 f7 ff ff       	call   10f0 <test_copy_on_write_main_child_alt>
+    1919:	83 c4 20             	add    $0x20,%esp
+    191c:	e8 42 0e 00 00       	call   2763 <exit>
+    1921:	ff 75 10             	push   0x10(%ebp)
+    1924:	ff 75 0c             	push   0xc(%ebp)
+    1927:	ff 75 08             	push   0x8(%ebp)
+    192a:	50                   	push   %eax
+    192b:	e8 f0 f2 ff ff       	call   c20 <test_copy_on_write_main_child>
+    1930:	83 c4 10             	add    $0x10,%esp
+    1933:	eb e7                	jmp    191c <_test_copy_on_write+0x1bc>
+    1935:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    193c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001940 <test_copy_on_write>:
+    1940:	55                   	push   %ebp
+    1941:	89 e5                	mov    %esp,%ebp
+    1943:	83 ec 0c             	sub    $0xc,%esp
+    1946:	68 30 39 00 00       	push   $0x3930
+    194b:	6a 00                	push   $0x0
+    194d:	6a 00                	push   $0x0
+    194f:	6a 00                	push   $0x0
+    1951:	ff 75 10             	push   0x10(%ebp)
+    1954:	ff 75 0c             	push   0xc(%ebp)
+    1957:	ff 75 08             	push   0x8(%ebp)
+    195a:	e8 01 fe ff ff       	call   1760 <_test_copy_on_write>
+    195f:	c9                   	leave
+    1960:	c3                   	ret
+    1961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    196f:	90                   	nop
+
+00001970 <test_copy_on_write_alloc_unused>:
+    1970:	55                   	push   %ebp
+    1971:	89 e5                	mov    %esp,%ebp
+    1973:	83 ec 0c             	sub    $0xc,%esp
+    1976:	ff 75 0c             	push   0xc(%ebp)
+    1979:	ff 75 08             	push   0x8(%ebp)
+    197c:	6a 00                	push   $0x0
+    197e:	6a 00                	push   $0x0
+    1980:	ff 75 18             	push   0x18(%ebp)
+    1983:	ff 75 14             	push   0x14(%ebp)
+    1986:	ff 75 10             	push   0x10(%ebp)
+    1989:	e8 d2 fd ff ff       	call   1760 <_test_copy_on_write>
+    198e:	c9                   	leave
+    198f:	c3                   	ret
+
+00001990 <test_copy_on_write_alt>:
+    1990:	55                   	push   %ebp
+    1991:	89 e5                	mov    %esp,%ebp
+    1993:	83 ec 0c             	sub    $0xc,%esp
+    1996:	68 30 39 00 00       	push   $0x3930
+    199b:	6a 00                	push   $0x0
+    199d:	6a 00                	push   $0x0
+    199f:	6a 01                	push   $0x1
+    19a1:	ff 75 10             	push   0x10(%ebp)
+    19a4:	ff 75 0c             	push   0xc(%ebp)
+    19a7:	ff 75 08             	push   0x8(%ebp)
+    19aa:	e8 b1 fd ff ff       	call   1760 <_test_copy_on_write>
+    19af:	c9                   	leave
+    19b0:	c3                   	ret
+    19b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19bf:	90                   	nop
+
+000019c0 <test_read_into_alloc_no_fork>:
+    19c0:	55                   	push   %ebp
+    19c1:	89 e5                	mov    %esp,%ebp
+    19c3:	57                   	push   %edi
+    19c4:	56                   	push   %esi
+    19c5:	53                   	push   %ebx
+    19c6:	83 ec 28             	sub    $0x28,%esp
+    19c9:	8b 75 10             	mov    0x10(%ebp),%esi
+    19cc:	ff 75 14             	push   0x14(%ebp)
+    19cf:	ff 75 18             	push   0x18(%ebp)
+    19d2:	56                   	push   %esi
+    19d3:	68 5c 34 00 00       	push   $0x345c
+    19d8:	6a 01                	push   $0x1
+    19da:	e8 31 0f 00 00       	call   2910 <printf>
+    19df:	83 c4 18             	add    $0x18,%esp
+    19e2:	68 01 02 00 00       	push   $0x201
+    19e7:	68 93 3a 00 00       	push   $0x3a93
+    19ec:	e8 b2 0d 00 00       	call   27a3 <open>
+    19f1:	ba c0 44 00 00       	mov    $0x44c0,%edx
+    19f6:	83 c4 10             	add    $0x10,%esp
+    19f9:	89 c7                	mov    %eax,%edi
+    19fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    19ff:	90                   	nop
+    1a00:	c7 02 58 58 58 58    	movl   $0x58585858,(%edx)
+    1a06:	83 c2 04             	add    $0x4,%edx
+    1a09:	81 fa 40 45 00 00    	cmp    $0x4540,%edx
+    1a0f:	75 ef                	jne    1a00 <test_read_into_alloc_no_fork+0x40>
+    1a11:	85 f6                	test   %esi,%esi
+    1a13:	0f 8e 8f 01 00 00    	jle    1ba8 <test_read_into_alloc_no_fork+0x1e8>
+    1a19:	31 db                	xor    %ebx,%ebx
+    1a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1a1f:	90                   	nop
+    1a20:	83 ec 04             	sub    $0x4,%esp
+    1a23:	83 eb 80             	sub    $0xffffff80,%ebx
+    1a26:	68 80 00 00 00       	push   $0x80
+    1a2b:	68 c0 44 00 00       	push   $0x44c0
+    1a30:	57                   	push   %edi
+    1a31:	e8 4d 0d 00 00       	call   2783 <write>
+    1a36:	83 c4 10             	add    $0x10,%esp
+    1a39:	39 de                	cmp    %ebx,%esi
+    1a3b:	7f e3                	jg     1a20 <test_read_into_alloc_no_fork+0x60>
+    1a3d:	83 ec 0c             	sub    $0xc,%esp
+    1a40:	57                   	push   %edi
+    1a41:	e8 45 0d 00 00       	call   278b <close>
+    1a46:	58                   	pop    %eax
+    1a47:	5a                   	pop    %edx
+    1a48:	6a 00                	push   $0x0
+    1a4a:	68 93 3a 00 00       	push   $0x3a93
+    1a4f:	e8 4f 0d 00 00       	call   27a3 <open>
+    1a54:	83 c4 10             	add    $0x10,%esp
+    1a57:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1a5a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1a5d:	0f 84 ed 00 00 00    	je     1b50 <test_read_into_alloc_no_fork+0x190>
+    1a63:	83 ec 0c             	sub    $0xc,%esp
+    1a66:	31 db                	xor    %ebx,%ebx
+    1a68:	6a 00                	push   $0x0
+    1a6a:	e8 7c 0d 00 00       	call   27eb <sbrk>
+    1a6f:	89 c7                	mov    %eax,%edi
+    1a71:	58                   	pop    %eax
+    1a72:	ff 75 08             	push   0x8(%ebp)
+    1a75:	e8 71 0d 00 00       	call   27eb <sbrk>
+    1a7a:	83 c4 0c             	add    $0xc,%esp
+    1a7d:	03 7d 0c             	add    0xc(%ebp),%edi
+    1a80:	56                   	push   %esi
+    1a81:	57                   	push   %edi
+    1a82:	ff 75 e4             	push   -0x1c(%ebp)
+    1a85:	e8 f1 0c 00 00       	call   277b <read>
+    1a8a:	83 c4 10             	add    $0x10,%esp
+    1a8d:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+    1a91:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1a94:	0f 95 c3             	setne  %bl
+    1a97:	89 f8                	mov    %edi,%eax
+    1a99:	8d 0c 3e             	lea    (%esi,%edi,1),%ecx
+    1a9c:	ba 01 00 00 00       	mov    $0x1,%edx
+    1aa1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1aa8:	80 38 58             	cmpb   $0x58,(%eax)
+    1aab:	0f 45 da             	cmovne %edx,%ebx
+    1aae:	83 c0 01             	add    $0x1,%eax
+    1ab1:	39 c1                	cmp    %eax,%ecx
+    1ab3:	75 f3                	jne    1aa8 <test_read_into_alloc_no_fork+0xe8>
+    1ab5:	80 3c 37 00          	cmpb   $0x0,(%edi,%esi,1)
+    1ab9:	74 3d                	je     1af8 <test_read_into_alloc_no_fork+0x138>
+    1abb:	83 ec 0c             	sub    $0xc,%esp
+    1abe:	ff 75 e4             	push   -0x1c(%ebp)
+    1ac1:	e8 c5 0c 00 00       	call   278b <close>
+    1ac6:	c7 04 24 93 3a 00 00 	movl   $0x3a93,(%esp)
+    1acd:	e8 e1 0c 00 00       	call   27b3 <unlink>
+    1ad2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1ad5:	83 c4 10             	add    $0x10,%esp
+    1ad8:	39 c6                	cmp    %eax,%esi
+    1ada:	75 60                	jne    1b3c <test_read_into_alloc_no_fork+0x17c>
+    1adc:	83 ec 08             	sub    $0x8,%esp
+    1adf:	68 a4 34 00 00       	push   $0x34a4
+    1ae4:	6a 01                	push   $0x1
+    1ae6:	e8 25 0e 00 00       	call   2910 <printf>
+    1aeb:	83 c4 10             	add    $0x10,%esp
+    1aee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1af1:	31 c0                	xor    %eax,%eax
+    1af3:	5b                   	pop    %ebx
+    1af4:	5e                   	pop    %esi
+    1af5:	5f                   	pop    %edi
+    1af6:	5d                   	pop    %ebp
+    1af7:	c3                   	ret
+    1af8:	83 ec 0c             	sub    $0xc,%esp
+    1afb:	ff 75 e4             	push   -0x1c(%ebp)
+    1afe:	e8 88 0c 00 00       	call   278b <close>
+    1b03:	c7 04 24 93 3a 00 00 	movl   $0x3a93,(%esp)
+    1b0a:	e8 a4 0c 00 00       	call   27b3 <unlink>
+    1b0f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1b12:	83 c4 10             	add    $0x10,%esp
+    1b15:	39 c6                	cmp    %eax,%esi
+    1b17:	75 23                	jne    1b3c <test_read_into_alloc_no_fork+0x17c>
+    1b19:	85 db                	test   %ebx,%ebx
+    1b1b:	75 bf                	jne    1adc <test_read_into_alloc_no_fork+0x11c>
+    1b1d:	83 ec 08             	sub    $0x8,%esp
+    1b20:	68 0c 35 00 00       	push   $0x350c
+    1b25:	6a 01                	push   $0x1
+    1b27:	e8 e4 0d 00 00       	call   2910 <printf>
+    1b2c:	83 c4 10             	add    $0x10,%esp
+    1b2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b32:	b8 01 00 00 00       	mov    $0x1,%eax
+    1b37:	5b                   	pop    %ebx
+    1b38:	5e                   	pop    %esi
+    1b39:	5f                   	pop    %edi
+    1b3a:	5d                   	pop    %ebp
+    1b3b:	c3                   	ret
+    1b3c:	83 ec 08             	sub    $0x8,%esp
+    1b3f:	68 dc 34 00 00       	push   $0x34dc
+    1b44:	6a 01                	push   $0x1
+    1b46:	e8 c5 0d 00 00       	call   2910 <printf>
+    1b4b:	83 c4 10             	add    $0x10,%esp
+    1b4e:	eb 9e                	jmp    1aee <test_read_into_alloc_no_fork+0x12e>
+    1b50:	83 ec 08             	sub    $0x8,%esp
+    1b53:	31 db                	xor    %ebx,%ebx
+    1b55:	68 85 3a 00 00       	push   $0x3a85
+    1b5a:	6a 02                	push   $0x2
+    1b5c:	e8 af 0d 00 00       	call   2910 <printf>
+    1b61:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    1b68:	e8 7e 0c 00 00       	call   27eb <sbrk>
+    1b6d:	89 c7                	mov    %eax,%edi
+    1b6f:	58                   	pop    %eax
+    1b70:	ff 75 08             	push   0x8(%ebp)
+    1b73:	e8 73 0c 00 00       	call   27eb <sbrk>
+    1b78:	83 c4 0c             	add    $0xc,%esp
+    1b7b:	03 7d 0c             	add    0xc(%ebp),%edi
+    1b7e:	56                   	push   %esi
+    1b7f:	57                   	push   %edi
+    1b80:	6a ff                	push   $0xffffffff
+    1b82:	e8 f4 0b 00 00       	call   277b <read>
+    1b87:	83 c4 10             	add    $0x10,%esp
+    1b8a:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+    1b8e:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+    1b95:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1b98:	0f 95 c3             	setne  %bl
+    1b9b:	85 f6                	test   %esi,%esi
+    1b9d:	0f 8f f4 fe ff ff    	jg     1a97 <test_read_into_alloc_no_fork+0xd7>
+    1ba3:	e9 0d ff ff ff       	jmp    1ab5 <test_read_into_alloc_no_fork+0xf5>
+    1ba8:	83 ec 0c             	sub    $0xc,%esp
+    1bab:	57                   	push   %edi
+    1bac:	e8 da 0b 00 00       	call   278b <close>
+    1bb1:	5a                   	pop    %edx
+    1bb2:	59                   	pop    %ecx
+    1bb3:	6a 00                	push   $0x0
+    1bb5:	68 93 3a 00 00       	push   $0x3a93
+    1bba:	e8 e4 0b 00 00       	call   27a3 <open>
+    1bbf:	83 c4 10             	add    $0x10,%esp
+    1bc2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1bc5:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1bc8:	74 86                	je     1b50 <test_read_into_alloc_no_fork+0x190>
+    1bca:	83 ec 0c             	sub    $0xc,%esp
+    1bcd:	6a 00                	push   $0x0
+    1bcf:	e8 17 0c 00 00       	call   27eb <sbrk>
+    1bd4:	5b                   	pop    %ebx
+    1bd5:	ff 75 08             	push   0x8(%ebp)
+    1bd8:	31 db                	xor    %ebx,%ebx
+    1bda:	89 c7                	mov    %eax,%edi
+    1bdc:	e8 0a 0c 00 00       	call   27eb <sbrk>
+    1be1:	83 c4 0c             	add    $0xc,%esp
+    1be4:	03 7d 0c             	add    0xc(%ebp),%edi
+    1be7:	56                   	push   %esi
+    1be8:	57                   	push   %edi
+    1be9:	ff 75 e4             	push   -0x1c(%ebp)
+    1bec:	e8 8a 0b 00 00       	call   277b <read>
+    1bf1:	83 c4 10             	add    $0x10,%esp
+    1bf4:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+    1bf8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1bfb:	0f 95 c3             	setne  %bl
+    1bfe:	e9 b2 fe ff ff       	jmp    1ab5 <test_read_into_alloc_no_fork+0xf5>
+    1c03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001c10 <test_read_into_alloc>:
+    1c10:	55                   	push   %ebp
+    1c11:	89 e5                	mov    %esp,%ebp
+    1c13:	83 ec 24             	sub    $0x24,%esp
+    1c16:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1c19:	50                   	push   %eax
+    1c1a:	e8 54 0b 00 00       	call   2773 <pipe>
+    1c1f:	e8 37 0b 00 00       	call   275b <fork>
+    1c24:	83 c4 10             	add    $0x10,%esp
+    1c27:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1c2a:	74 3c                	je     1c68 <test_read_into_alloc+0x58>
+    1c2c:	85 c0                	test   %eax,%eax
+    1c2e:	74 4e                	je     1c7e <test_read_into_alloc+0x6e>
+    1c30:	83 ec 0c             	sub    $0xc,%esp
+    1c33:	ff 75 f4             	push   -0xc(%ebp)
+    1c36:	e8 50 0b 00 00       	call   278b <close>
+    1c3b:	83 c4 0c             	add    $0xc,%esp
+    1c3e:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    1c41:	c6 45 ef 4e          	movb   $0x4e,-0x11(%ebp)
+    1c45:	6a 01                	push   $0x1
+    1c47:	50                   	push   %eax
+    1c48:	ff 75 f0             	push   -0x10(%ebp)
+    1c4b:	e8 2b 0b 00 00       	call   277b <read>
+    1c50:	e8 16 0b 00 00       	call   276b <wait>
+    1c55:	83 c4 10             	add    $0x10,%esp
+    1c58:	31 c0                	xor    %eax,%eax
+    1c5a:	80 7d ef 59          	cmpb   $0x59,-0x11(%ebp)
+    1c5e:	c9                   	leave
+    1c5f:	0f 94 c0             	sete   %al
+    1c62:	c3                   	ret
+    1c63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1c67:	90                   	nop
+    1c68:	83 ec 08             	sub    $0x8,%esp
+    1c6b:	68 f9 38 00 00       	push   $0x38f9
+    1c70:	6a 01                	push   $0x1
+    1c72:	e8 99 0c 00 00       	call   2910 <printf>
+    1c77:	83 c4 10             	add    $0x10,%esp
+    1c7a:	31 c0                	xor    %eax,%eax
+    1c7c:	c9                   	leave
+    1c7d:	c3                   	ret
+    1c7e:	83 ec 0c             	sub    $0xc,%esp
+    1c81:	ff 75 f0             	push   -0x10(%ebp)
+    1c84:	e8 02 0b 00 00       	call   278b <close>
+    1c89:	c6 45 ef 4e          	movb   $0x4e,-0x11(%ebp)
+    1c8d:	5a                   	pop    %edx
+    1c8e:	ff 75 18             	push   0x18(%ebp)
+    1c91:	ff 75 14             	push   0x14(%ebp)
+    1c94:	ff 75 10             	push   0x10(%ebp)
+    1c97:	ff 75 0c             	push   0xc(%ebp)
+    1c9a:	ff 75 08             	push   0x8(%ebp)
+    1c9d:	e8 1e fd ff ff       	call   19c0 <test_read_into_alloc_no_fork>
+    1ca2:	83 c4 20             	add    $0x20,%esp
+    1ca5:	85 c0                	test   %eax,%eax
+    1ca7:	74 04                	je     1cad <test_read_into_alloc+0x9d>
+    1ca9:	c6 45 ef 59          	movb   $0x59,-0x11(%ebp)
+    1cad:	50                   	push   %eax
+    1cae:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    1cb1:	6a 01                	push   $0x1
+    1cb3:	50                   	push   %eax
+    1cb4:	ff 75 f4             	push   -0xc(%ebp)
+    1cb7:	e8 c7 0a 00 00       	call   2783 <write>
+    1cbc:	e8 a2 0a 00 00       	call   2763 <exit>
+    1cc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ccf:	90                   	nop
+
+00001cd0 <test_read_into_cow_less_forks>:
+    1cd0:	55                   	push   %ebp
+    1cd1:	89 e5                	mov    %esp,%ebp
+    1cd3:	57                   	push   %edi
+    1cd4:	56                   	push   %esi
+    1cd5:	53                   	push   %ebx
+    1cd6:	83 ec 38             	sub    $0x38,%esp
+    1cd9:	8b 7d 10             	mov    0x10(%ebp),%edi
+    1cdc:	ff 75 14             	push   0x14(%ebp)
+    1cdf:	ff 75 18             	push   0x18(%ebp)
+    1ce2:	57                   	push   %edi
+    1ce3:	68 38 35 00 00       	push   $0x3538
+    1ce8:	6a 01                	push   $0x1
+    1cea:	e8 21 0c 00 00       	call   2910 <printf>
+    1cef:	83 c4 18             	add    $0x18,%esp
+    1cf2:	68 01 02 00 00       	push   $0x201
+    1cf7:	68 93 3a 00 00       	push   $0x3a93
+    1cfc:	e8 a2 0a 00 00       	call   27a3 <open>
+    1d01:	ba 40 44 00 00       	mov    $0x4440,%edx
+    1d06:	83 c4 10             	add    $0x10,%esp
+    1d09:	89 c6                	mov    %eax,%esi
+    1d0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d0f:	90                   	nop
+    1d10:	c7 02 58 58 58 58    	movl   $0x58585858,(%edx)
+    1d16:	83 c2 04             	add    $0x4,%edx
+    1d19:	81 fa c0 44 00 00    	cmp    $0x44c0,%edx
+    1d1f:	75 ef                	jne    1d10 <test_read_into_cow_less_forks+0x40>
+    1d21:	31 db                	xor    %ebx,%ebx
+    1d23:	85 ff                	test   %edi,%edi
+    1d25:	7e 26                	jle    1d4d <test_read_into_cow_less_forks+0x7d>
+    1d27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d2e:	66 90                	xchg   %ax,%ax
+    1d30:	83 ec 04             	sub    $0x4,%esp
+    1d33:	83 eb 80             	sub    $0xffffff80,%ebx
+    1d36:	68 80 00 00 00       	push   $0x80
+    1d3b:	68 40 44 00 00       	push   $0x4440
+    1d40:	56                   	push   %esi
+    1d41:	e8 3d 0a 00 00       	call   2783 <write>
+    1d46:	83 c4 10             	add    $0x10,%esp
+    1d49:	39 df                	cmp    %ebx,%edi
+    1d4b:	7f e3                	jg     1d30 <test_read_into_cow_less_forks+0x60>
+    1d4d:	83 ec 0c             	sub    $0xc,%esp
+    1d50:	56                   	push   %esi
+    1d51:	e8 35 0a 00 00       	call   278b <close>
+    1d56:	5b                   	pop    %ebx
+    1d57:	5e                   	pop    %esi
+    1d58:	6a 00                	push   $0x0
+    1d5a:	68 93 3a 00 00       	push   $0x3a93
+    1d5f:	e8 3f 0a 00 00       	call   27a3 <open>
+    1d64:	83 c4 10             	add    $0x10,%esp
+    1d67:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    1d6a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1d6d:	0f 84 06 01 00 00    	je     1e79 <test_read_into_cow_less_forks+0x1a9>
+    1d73:	83 ec 0c             	sub    $0xc,%esp
+    1d76:	6a 00                	push   $0x0
+    1d78:	e8 6e 0a 00 00       	call   27eb <sbrk>
+    1d7d:	89 c3                	mov    %eax,%ebx
+    1d7f:	58                   	pop    %eax
+    1d80:	ff 75 08             	push   0x8(%ebp)
+    1d83:	e8 63 0a 00 00       	call   27eb <sbrk>
+    1d88:	8b 55 08             	mov    0x8(%ebp),%edx
+    1d8b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1d8e:	83 c4 10             	add    $0x10,%esp
+    1d91:	89 d8                	mov    %ebx,%eax
+    1d93:	01 da                	add    %ebx,%edx
+    1d95:	85 c9                	test   %ecx,%ecx
+    1d97:	7e 11                	jle    1daa <test_read_into_cow_less_forks+0xda>
+    1d99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1da0:	c6 00 59             	movb   $0x59,(%eax)
+    1da3:	83 c0 01             	add    $0x1,%eax
+    1da6:	39 d0                	cmp    %edx,%eax
+    1da8:	75 f6                	jne    1da0 <test_read_into_cow_less_forks+0xd0>
+    1daa:	83 ec 0c             	sub    $0xc,%esp
+    1dad:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1db0:	50                   	push   %eax
+    1db1:	e8 bd 09 00 00       	call   2773 <pipe>
+    1db6:	e8 a0 09 00 00       	call   275b <fork>
+    1dbb:	83 c4 10             	add    $0x10,%esp
+    1dbe:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1dc1:	0f 84 6c 01 00 00    	je     1f33 <test_read_into_cow_less_forks+0x263>
+    1dc7:	85 c0                	test   %eax,%eax
+    1dc9:	0f 84 c1 00 00 00    	je     1e90 <test_read_into_cow_less_forks+0x1c0>
+    1dcf:	83 ec 0c             	sub    $0xc,%esp
+    1dd2:	ff 75 e4             	push   -0x1c(%ebp)
+    1dd5:	e8 b1 09 00 00       	call   278b <close>
+    1dda:	83 c4 0c             	add    $0xc,%esp
+    1ddd:	8d 45 df             	lea    -0x21(%ebp),%eax
+    1de0:	c6 45 df 4e          	movb   $0x4e,-0x21(%ebp)
+    1de4:	6a 01                	push   $0x1
+    1de6:	50                   	push   %eax
+    1de7:	ff 75 e0             	push   -0x20(%ebp)
+    1dea:	e8 8c 09 00 00       	call   277b <read>
+    1def:	58                   	pop    %eax
+    1df0:	ff 75 e0             	push   -0x20(%ebp)
+    1df3:	e8 93 09 00 00       	call   278b <close>
+    1df8:	e8 6e 09 00 00       	call   276b <wait>
+    1dfd:	5a                   	pop    %edx
+    1dfe:	59                   	pop    %ecx
+    1dff:	68 d0 35 00 00       	push   $0x35d0
+    1e04:	6a 01                	push   $0x1
+    1e06:	e8 05 0b 00 00       	call   2910 <printf>
+    1e0b:	8b 75 08             	mov    0x8(%ebp),%esi
+    1e0e:	83 c4 10             	add    $0x10,%esp
+    1e11:	85 f6                	test   %esi,%esi
+    1e13:	7e 4b                	jle    1e60 <test_read_into_cow_less_forks+0x190>
+    1e15:	8b 75 08             	mov    0x8(%ebp),%esi
+    1e18:	31 c0                	xor    %eax,%eax
+    1e1a:	ba 01 00 00 00       	mov    $0x1,%edx
+    1e1f:	01 de                	add    %ebx,%esi
+    1e21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e28:	80 3b 59             	cmpb   $0x59,(%ebx)
+    1e2b:	0f 45 c2             	cmovne %edx,%eax
+    1e2e:	83 c3 01             	add    $0x1,%ebx
+    1e31:	39 f3                	cmp    %esi,%ebx
+    1e33:	75 f3                	jne    1e28 <test_read_into_cow_less_forks+0x158>
+    1e35:	85 c0                	test   %eax,%eax
+    1e37:	74 27                	je     1e60 <test_read_into_cow_less_forks+0x190>
+    1e39:	83 ec 08             	sub    $0x8,%esp
+    1e3c:	68 10 36 00 00       	push   $0x3610
+    1e41:	6a 01                	push   $0x1
+    1e43:	e8 c8 0a 00 00       	call   2910 <printf>
+    1e48:	83 c4 10             	add    $0x10,%esp
+    1e4b:	31 d2                	xor    %edx,%edx
+    1e4d:	31 c0                	xor    %eax,%eax
+    1e4f:	80 7d df 59          	cmpb   $0x59,-0x21(%ebp)
+    1e53:	0f 94 c0             	sete   %al
+    1e56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e59:	5b                   	pop    %ebx
+    1e5a:	01 d0                	add    %edx,%eax
+    1e5c:	5e                   	pop    %esi
+    1e5d:	5f                   	pop    %edi
+    1e5e:	5d                   	pop    %ebp
+    1e5f:	c3                   	ret
+    1e60:	83 ec 08             	sub    $0x8,%esp
+    1e63:	68 4c 36 00 00       	push   $0x364c
+    1e68:	6a 01                	push   $0x1
+    1e6a:	e8 a1 0a 00 00       	call   2910 <printf>
+    1e6f:	83 c4 10             	add    $0x10,%esp
+    1e72:	ba 01 00 00 00       	mov    $0x1,%edx
+    1e77:	eb d4                	jmp    1e4d <test_read_into_cow_less_forks+0x17d>
+    1e79:	83 ec 08             	sub    $0x8,%esp
+    1e7c:	68 85 3a 00 00       	push   $0x3a85
+    1e81:	6a 02                	push   $0x2
+    1e83:	e8 88 0a 00 00       	call   2910 <printf>
+    1e88:	83 c4 10             	add    $0x10,%esp
+    1e8b:	e9 e3 fe ff ff       	jmp    1d73 <test_read_into_cow_less_forks+0xa3>
+    1e90:	03 5d 0c             	add    0xc(%ebp),%ebx
+    1e93:	83 ec 0c             	sub    $0xc,%esp
+    1e96:	ff 75 e0             	push   -0x20(%ebp)
+    1e99:	e8 ed 08 00 00       	call   278b <close>
+    1e9e:	83 c4 0c             	add    $0xc,%esp
+    1ea1:	57                   	push   %edi
+    1ea2:	53                   	push   %ebx
+    1ea3:	ff 75 d4             	push   -0x2c(%ebp)
+    1ea6:	e8 d0 08 00 00       	call   277b <read>
+    1eab:	31 d2                	xor    %edx,%edx
+    1ead:	83 c4 10             	add    $0x10,%esp
+    1eb0:	80 7b ff 59          	cmpb   $0x59,-0x1(%ebx)
+    1eb4:	89 c6                	mov    %eax,%esi
+    1eb6:	0f 95 c2             	setne  %dl
+    1eb9:	85 ff                	test   %edi,%edi
+    1ebb:	7e 1b                	jle    1ed8 <test_read_into_cow_less_forks+0x208>
+    1ebd:	8d 0c 1f             	lea    (%edi,%ebx,1),%ecx
+    1ec0:	89 d8                	mov    %ebx,%eax
+    1ec2:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1ec5:	80 38 58             	cmpb   $0x58,(%eax)
+    1ec8:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1ecd:	0f 45 d1             	cmovne %ecx,%edx
+    1ed0:	83 c0 01             	add    $0x1,%eax
+    1ed3:	39 45 d0             	cmp    %eax,-0x30(%ebp)
+    1ed6:	75 ed                	jne    1ec5 <test_read_into_cow_less_forks+0x1f5>
+    1ed8:	80 3c 3b 59          	cmpb   $0x59,(%ebx,%edi,1)
+    1edc:	74 68                	je     1f46 <test_read_into_cow_less_forks+0x276>
+    1ede:	83 ec 0c             	sub    $0xc,%esp
+    1ee1:	ff 75 d4             	push   -0x2c(%ebp)
+    1ee4:	e8 a2 08 00 00       	call   278b <close>
+    1ee9:	c7 04 24 93 3a 00 00 	movl   $0x3a93,(%esp)
+    1ef0:	e8 be 08 00 00       	call   27b3 <unlink>
+    1ef5:	83 c4 10             	add    $0x10,%esp
+    1ef8:	39 f7                	cmp    %esi,%edi
+    1efa:	0f 85 93 00 00 00    	jne    1f93 <test_read_into_cow_less_forks+0x2c3>
+    1f00:	50                   	push   %eax
+    1f01:	50                   	push   %eax
+    1f02:	68 a4 34 00 00       	push   $0x34a4
+    1f07:	6a 01                	push   $0x1
+    1f09:	e8 02 0a 00 00       	call   2910 <printf>
+    1f0e:	83 c4 0c             	add    $0xc,%esp
+    1f11:	6a 01                	push   $0x1
+    1f13:	68 9c 3a 00 00       	push   $0x3a9c
+    1f18:	ff 75 e4             	push   -0x1c(%ebp)
+    1f1b:	e8 63 08 00 00       	call   2783 <write>
+    1f20:	83 c4 10             	add    $0x10,%esp
+    1f23:	83 ec 0c             	sub    $0xc,%esp
+    1f26:	ff 75 e4             	push   -0x1c(%ebp)
+    1f29:	e8 5d 08 00 00       	call   278b <close>
+    1f2e:	e8 30 08 00 00       	call   2763 <exit>
+    1f33:	50                   	push   %eax
+    1f34:	50                   	push   %eax
+    1f35:	68 f9 38 00 00       	push   $0x38f9
+    1f3a:	6a 01                	push   $0x1
+    1f3c:	e8 cf 09 00 00       	call   2910 <printf>
+    1f41:	e8 1d 08 00 00       	call   2763 <exit>
+    1f46:	83 ec 0c             	sub    $0xc,%esp
+    1f49:	89 55 d0             	mov    %edx,-0x30(%ebp)
+    1f4c:	ff 75 d4             	push   -0x2c(%ebp)
+    1f4f:	e8 37 08 00 00       	call   278b <close>
+    1f54:	c7 04 24 93 3a 00 00 	movl   $0x3a93,(%esp)
+    1f5b:	e8 53 08 00 00       	call   27b3 <unlink>
+    1f60:	83 c4 10             	add    $0x10,%esp
+    1f63:	39 f7                	cmp    %esi,%edi
+    1f65:	75 2c                	jne    1f93 <test_read_into_cow_less_forks+0x2c3>
+    1f67:	8b 55 d0             	mov    -0x30(%ebp),%edx
+    1f6a:	85 d2                	test   %edx,%edx
+    1f6c:	75 92                	jne    1f00 <test_read_into_cow_less_forks+0x230>
+    1f6e:	57                   	push   %edi
+    1f6f:	57                   	push   %edi
+    1f70:	68 90 35 00 00       	push   $0x3590
+    1f75:	6a 01                	push   $0x1
+    1f77:	e8 94 09 00 00       	call   2910 <printf>
+    1f7c:	83 c4 0c             	add    $0xc,%esp
+    1f7f:	6a 01                	push   $0x1
+    1f81:	68 26 3a 00 00       	push   $0x3a26
+    1f86:	ff 75 e4             	push   -0x1c(%ebp)
+    1f89:	e8 f5 07 00 00       	call   2783 <write>
+    1f8e:	83 c4 10             	add    $0x10,%esp
+    1f91:	eb 90                	jmp    1f23 <test_read_into_cow_less_forks+0x253>
+    1f93:	50                   	push   %eax
+    1f94:	50                   	push   %eax
+    1f95:	68 dc 34 00 00       	push   $0x34dc
+    1f9a:	e9 68 ff ff ff       	jmp    1f07 <test_read_into_cow_less_forks+0x237>
+    1f9f:	90                   	nop
+
+00001fa0 <test_read_into_cow>:
+    1fa0:	55                   	push   %ebp
+    1fa1:	89 e5                	mov    %esp,%ebp
+    1fa3:	83 ec 24             	sub    $0x24,%esp
+    1fa6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1fa9:	50                   	push   %eax
+    1faa:	e8 c4 07 00 00       	call   2773 <pipe>
+    1faf:	e8 a7 07 00 00       	call   275b <fork>
+    1fb4:	83 c4 10             	add    $0x10,%esp
+    1fb7:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1fba:	74 37                	je     1ff3 <test_read_into_cow+0x53>
+    1fbc:	85 c0                	test   %eax,%eax
+    1fbe:	74 46                	je     2006 <test_read_into_cow+0x66>
+    1fc0:	83 ec 0c             	sub    $0xc,%esp
+    1fc3:	ff 75 f4             	push   -0xc(%ebp)
+    1fc6:	e8 c0 07 00 00       	call   278b <close>
+    1fcb:	83 c4 0c             	add    $0xc,%esp
+    1fce:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    1fd1:	c6 45 ef 4e          	movb   $0x4e,-0x11(%ebp)
+    1fd5:	6a 01                	push   $0x1
+    1fd7:	50                   	push   %eax
+    1fd8:	ff 75 f0             	push   -0x10(%ebp)
+    1fdb:	e8 9b 07 00 00       	call   277b <read>
+    1fe0:	e8 86 07 00 00       	call   276b <wait>
+    1fe5:	83 c4 10             	add    $0x10,%esp
+    1fe8:	31 c0                	xor    %eax,%eax
+    1fea:	80 7d ef 59          	cmpb   $0x59,-0x11(%ebp)
+    1fee:	c9                   	leave
+    1fef:	0f 94 c0             	sete   %al
+    1ff2:	c3                   	ret
+    1ff3:	51                   	push   %ecx
+    1ff4:	51                   	push   %ecx
+    1ff5:	68 f9 38 00 00       	push   $0x38f9
+    1ffa:	6a 01                	push   $0x1
+    1ffc:	e8 0f 09 00 00       	call   2910 <printf>
+    2001:	e8 5d 07 00 00       	call   2763 <exit>
+    2006:	83 ec 0c             	sub    $0xc,%esp
+    2009:	ff 75 f0             	push   -0x10(%ebp)
+    200c:	e8 7a 07 00 00       	call   278b <close>
+    2011:	c6 45 ef 4e          	movb   $0x4e,-0x11(%ebp)
+    2015:	5a                   	pop    %edx
+    2016:	ff 75 18             	push   0x18(%ebp)
+    2019:	ff 75 14             	push   0x14(%ebp)
+    201c:	ff 75 10             	push   0x10(%ebp)
+    201f:	ff 75 0c             	push   0xc(%ebp)
+    2022:	ff 75 08             	push   0x8(%ebp)
+    2025:	e8 a6 fc ff ff       	call   1cd0 <test_read_into_cow_less_forks>
+    202a:	83 c4 20             	add    $0x20,%esp
+    202d:	85 c0                	test   %eax,%eax
+    202f:	74 04                	je     2035 <test_read_into_cow+0x95>
+    2031:	c6 45 ef 59          	movb   $0x59,-0x11(%ebp)
+    2035:	50                   	push   %eax
+    2036:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    2039:	6a 01                	push   $0x1
+    203b:	50                   	push   %eax
+    203c:	ff 75 f4             	push   -0xc(%ebp)
+    203f:	e8 3f 07 00 00       	call   2783 <write>
+    2044:	e8 1a 07 00 00       	call   2763 <exit>
+    2049:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002050 <test_dealloc_cow_less_forks>:
+    2050:	55                   	push   %ebp
+    2051:	89 e5                	mov    %esp,%ebp
+    2053:	57                   	push   %edi
+    2054:	56                   	push   %esi
+    2055:	53                   	push   %ebx
+    2056:	83 ec 18             	sub    $0x18,%esp
+    2059:	8b 75 08             	mov    0x8(%ebp),%esi
+    205c:	6a 00                	push   $0x0
+    205e:	e8 88 07 00 00       	call   27eb <sbrk>
+    2063:	89 34 24             	mov    %esi,(%esp)
+    2066:	89 c3                	mov    %eax,%ebx
+    2068:	e8 7e 07 00 00       	call   27eb <sbrk>
+    206d:	58                   	pop    %eax
+    206e:	5a                   	pop    %edx
+    206f:	68 9c 36 00 00       	push   $0x369c
+    2074:	6a 01                	push   $0x1
+    2076:	e8 95 08 00 00       	call   2910 <printf>
+    207b:	83 c4 10             	add    $0x10,%esp
+    207e:	85 f6                	test   %esi,%esi
+    2080:	7e 5e                	jle    20e0 <test_dealloc_cow_less_forks+0x90>
+    2082:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+    2085:	89 d8                	mov    %ebx,%eax
+    2087:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    208e:	66 90                	xchg   %ax,%ax
+    2090:	c6 00 59             	movb   $0x59,(%eax)
+    2093:	83 c0 01             	add    $0x1,%eax
+    2096:	39 f8                	cmp    %edi,%eax
+    2098:	75 f6                	jne    2090 <test_dealloc_cow_less_forks+0x40>
+    209a:	e8 bc 06 00 00       	call   275b <fork>
+    209f:	85 c0                	test   %eax,%eax
+    20a1:	74 6a                	je     210d <test_dealloc_cow_less_forks+0xbd>
+    20a3:	e8 c3 06 00 00       	call   276b <wait>
+    20a8:	31 c0                	xor    %eax,%eax
+    20aa:	ba 01 00 00 00       	mov    $0x1,%edx
+    20af:	90                   	nop
+    20b0:	80 3b 59             	cmpb   $0x59,(%ebx)
+    20b3:	0f 45 c2             	cmovne %edx,%eax
+    20b6:	83 c3 01             	add    $0x1,%ebx
+    20b9:	39 fb                	cmp    %edi,%ebx
+    20bb:	75 f3                	jne    20b0 <test_dealloc_cow_less_forks+0x60>
+    20bd:	85 c0                	test   %eax,%eax
+    20bf:	74 2d                	je     20ee <test_dealloc_cow_less_forks+0x9e>
+    20c1:	83 ec 08             	sub    $0x8,%esp
+    20c4:	68 08 37 00 00       	push   $0x3708
+    20c9:	6a 01                	push   $0x1
+    20cb:	e8 40 08 00 00       	call   2910 <printf>
+    20d0:	83 c4 10             	add    $0x10,%esp
+    20d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    20d6:	31 c0                	xor    %eax,%eax
+    20d8:	5b                   	pop    %ebx
+    20d9:	5e                   	pop    %esi
+    20da:	5f                   	pop    %edi
+    20db:	5d                   	pop    %ebp
+    20dc:	c3                   	ret
+    20dd:	8d 76 00             	lea    0x0(%esi),%esi
+    20e0:	e8 76 06 00 00       	call   275b <fork>
+    20e5:	85 c0                	test   %eax,%eax
+    20e7:	74 24                	je     210d <test_dealloc_cow_less_forks+0xbd>
+    20e9:	e8 7d 06 00 00       	call   276b <wait>
+    20ee:	83 ec 08             	sub    $0x8,%esp
+    20f1:	68 48 37 00 00       	push   $0x3748
+    20f6:	6a 01                	push   $0x1
+    20f8:	e8 13 08 00 00       	call   2910 <printf>
+    20fd:	83 c4 10             	add    $0x10,%esp
+    2100:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2103:	b8 01 00 00 00       	mov    $0x1,%eax
+    2108:	5b                   	pop    %ebx
+    2109:	5e                   	pop    %esi
+    210a:	5f                   	pop    %edi
+    210b:	5d                   	pop    %ebp
+    210c:	c3                   	ret
+    210d:	83 ec 0c             	sub    $0xc,%esp
+    2110:	f7 de                	neg    %esi
+    2112:	56                   	push   %esi
+    2113:	e8 d3 06 00 00       	call   27eb <sbrk>
+    2118:	e8 46 06 00 00       	call   2763 <exit>
+    211d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002120 <test_copy_on_write_control_parent_child>:
+    2120:	55                   	push   %ebp
+    2121:	89 e5                	mov    %esp,%ebp
+    2123:	57                   	push   %edi
+    2124:	56                   	push   %esi
+    2125:	53                   	push   %ebx
+    2126:	83 ec 48             	sub    $0x48,%esp
+    2129:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    212c:	8b 75 0c             	mov    0xc(%ebp),%esi
+    212f:	6a 00                	push   $0x0
+    2131:	e8 b5 06 00 00       	call   27eb <sbrk>
+    2136:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    2139:	ba a6 3a 00 00       	mov    $0x3aa6,%edx
+    213e:	89 c7                	mov    %eax,%edi
+    2140:	b8 9e 3a 00 00       	mov    $0x3a9e,%eax
+    2145:	85 c9                	test   %ecx,%ecx
+    2147:	89 d1                	mov    %edx,%ecx
+    2149:	0f 45 c8             	cmovne %eax,%ecx
+    214c:	85 f6                	test   %esi,%esi
+    214e:	0f 44 c2             	cmove  %edx,%eax
+    2151:	89 0c 24             	mov    %ecx,(%esp)
+    2154:	50                   	push   %eax
+    2155:	53                   	push   %ebx
+    2156:	68 8c 37 00 00       	push   $0x378c
+    215b:	6a 01                	push   $0x1
+    215d:	e8 ae 07 00 00       	call   2910 <printf>
+    2162:	83 c4 14             	add    $0x14,%esp
+    2165:	53                   	push   %ebx
+    2166:	e8 80 06 00 00       	call   27eb <sbrk>
+    216b:	83 c4 10             	add    $0x10,%esp
+    216e:	8d 14 3b             	lea    (%ebx,%edi,1),%edx
+    2171:	89 f8                	mov    %edi,%eax
+    2173:	85 db                	test   %ebx,%ebx
+    2175:	7e 13                	jle    218a <test_copy_on_write_control_parent_child+0x6a>
+    2177:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    217e:	66 90                	xchg   %ax,%ax
+    2180:	c6 00 58             	movb   $0x58,(%eax)
+    2183:	83 c0 01             	add    $0x1,%eax
+    2186:	39 d0                	cmp    %edx,%eax
+    2188:	75 f6                	jne    2180 <test_copy_on_write_control_parent_child+0x60>
+    218a:	83 ec 0c             	sub    $0xc,%esp
+    218d:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    2190:	83 eb 01             	sub    $0x1,%ebx
+    2193:	50                   	push   %eax
+    2194:	e8 da 05 00 00       	call   2773 <pipe>
+    2199:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    219c:	89 04 24             	mov    %eax,(%esp)
+    219f:	e8 cf 05 00 00       	call   2773 <pipe>
+    21a4:	e8 b2 05 00 00       	call   275b <fork>
+    21a9:	83 c4 10             	add    $0x10,%esp
+    21ac:	89 c2                	mov    %eax,%edx
+    21ae:	85 c0                	test   %eax,%eax
+    21b0:	0f 84 ac 01 00 00    	je     2362 <test_copy_on_write_control_parent_child+0x242>
+    21b6:	85 f6                	test   %esi,%esi
+    21b8:	74 46                	je     2200 <test_copy_on_write_control_parent_child+0xe0>
+    21ba:	85 db                	test   %ebx,%ebx
+    21bc:	0f 88 32 01 00 00    	js     22f4 <test_copy_on_write_control_parent_child+0x1d4>
+    21c2:	89 d8                	mov    %ebx,%eax
+    21c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    21c8:	c6 04 07 5a          	movb   $0x5a,(%edi,%eax,1)
+    21cc:	83 e8 01             	sub    $0x1,%eax
+    21cf:	73 f7                	jae    21c8 <test_copy_on_write_control_parent_child+0xa8>
+    21d1:	83 ec 04             	sub    $0x4,%esp
+    21d4:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    21d7:	6a 01                	push   $0x1
+    21d9:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    21dc:	50                   	push   %eax
+    21dd:	ff 75 d8             	push   -0x28(%ebp)
+    21e0:	e8 96 05 00 00       	call   277b <read>
+    21e5:	83 c4 0c             	add    $0xc,%esp
+    21e8:	6a 01                	push   $0x1
+    21ea:	68 ae 3a 00 00       	push   $0x3aae
+    21ef:	ff 75 e4             	push   -0x1c(%ebp)
+    21f2:	e8 8c 05 00 00       	call   2783 <write>
+    21f7:	83 c4 10             	add    $0x10,%esp
+    21fa:	eb 35                	jmp    2231 <test_copy_on_write_control_parent_child+0x111>
+    21fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2200:	83 ec 04             	sub    $0x4,%esp
+    2203:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    2206:	6a 01                	push   $0x1
+    2208:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    220b:	50                   	push   %eax
+    220c:	ff 75 d8             	push   -0x28(%ebp)
+    220f:	e8 67 05 00 00       	call   277b <read>
+    2214:	83 c4 0c             	add    $0xc,%esp
+    2217:	6a 01                	push   $0x1
+    2219:	68 ae 3a 00 00       	push   $0x3aae
+    221e:	ff 75 e4             	push   -0x1c(%ebp)
+    2221:	e8 5d 05 00 00       	call   2783 <write>
+    2226:	83 c4 10             	add    $0x10,%esp
+    2229:	85 db                	test   %ebx,%ebx
+    222b:	0f 88 ec 00 00 00    	js     231d <test_copy_on_write_control_parent_child+0x1fd>
+    2231:	83 fe 01             	cmp    $0x1,%esi
+    2234:	b9 01 00 00 00       	mov    $0x1,%ecx
+    2239:	19 d2                	sbb    %edx,%edx
+    223b:	31 f6                	xor    %esi,%esi
+    223d:	83 e2 fe             	and    $0xfffffffe,%edx
+    2240:	83 c2 5a             	add    $0x5a,%edx
+    2243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2247:	90                   	nop
+    2248:	0f be 04 1f          	movsbl (%edi,%ebx,1),%eax
+    224c:	39 d0                	cmp    %edx,%eax
+    224e:	0f 45 f1             	cmovne %ecx,%esi
+    2251:	83 eb 01             	sub    $0x1,%ebx
+    2254:	73 f2                	jae    2248 <test_copy_on_write_control_parent_child+0x128>
+    2256:	83 ec 04             	sub    $0x4,%esp
+    2259:	c6 45 d7 4e          	movb   $0x4e,-0x29(%ebp)
+    225d:	6a 01                	push   $0x1
+    225f:	ff 75 c4             	push   -0x3c(%ebp)
+    2262:	ff 75 d8             	push   -0x28(%ebp)
+    2265:	e8 11 05 00 00       	call   277b <read>
+    226a:	58                   	pop    %eax
+    226b:	ff 75 d8             	push   -0x28(%ebp)
+    226e:	e8 18 05 00 00       	call   278b <close>
+    2273:	58                   	pop    %eax
+    2274:	ff 75 e0             	push   -0x20(%ebp)
+    2277:	e8 0f 05 00 00       	call   278b <close>
+    227c:	58                   	pop    %eax
+    227d:	ff 75 dc             	push   -0x24(%ebp)
+    2280:	e8 06 05 00 00       	call   278b <close>
+    2285:	58                   	pop    %eax
+    2286:	ff 75 e4             	push   -0x1c(%ebp)
+    2289:	e8 fd 04 00 00       	call   278b <close>
+    228e:	e8 d8 04 00 00       	call   276b <wait>
+    2293:	83 c4 10             	add    $0x10,%esp
+    2296:	85 f6                	test   %esi,%esi
+    2298:	75 46                	jne    22e0 <test_copy_on_write_control_parent_child+0x1c0>
+    229a:	80 7d d7 59          	cmpb   $0x59,-0x29(%ebp)
+    229e:	74 20                	je     22c0 <test_copy_on_write_control_parent_child+0x1a0>
+    22a0:	83 ec 08             	sub    $0x8,%esp
+    22a3:	68 f0 37 00 00       	push   $0x37f0
+    22a8:	6a 01                	push   $0x1
+    22aa:	e8 61 06 00 00       	call   2910 <printf>
+    22af:	83 c4 10             	add    $0x10,%esp
+    22b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    22b5:	31 c0                	xor    %eax,%eax
+    22b7:	5b                   	pop    %ebx
+    22b8:	5e                   	pop    %esi
+    22b9:	5f                   	pop    %edi
+    22ba:	5d                   	pop    %ebp
+    22bb:	c3                   	ret
+    22bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    22c0:	83 ec 08             	sub    $0x8,%esp
+    22c3:	68 14 38 00 00       	push   $0x3814
+    22c8:	6a 01                	push   $0x1
+    22ca:	e8 41 06 00 00       	call   2910 <printf>
+    22cf:	83 c4 10             	add    $0x10,%esp
+    22d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    22d5:	b8 01 00 00 00       	mov    $0x1,%eax
+    22da:	5b                   	pop    %ebx
+    22db:	5e                   	pop    %esi
+    22dc:	5f                   	pop    %edi
+    22dd:	5d                   	pop    %ebp
+    22de:	c3                   	ret
+    22df:	90                   	nop
+    22e0:	83 ec 08             	sub    $0x8,%esp
+    22e3:	68 cc 37 00 00       	push   $0x37cc
+    22e8:	6a 01                	push   $0x1
+    22ea:	e8 21 06 00 00       	call   2910 <printf>
+    22ef:	83 c4 10             	add    $0x10,%esp
+    22f2:	eb be                	jmp    22b2 <test_copy_on_write_control_parent_child+0x192>
+    22f4:	83 ec 04             	sub    $0x4,%esp
+    22f7:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    22fa:	6a 01                	push   $0x1
+    22fc:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    22ff:	50                   	push   %eax
+    2300:	ff 75 d8             	push   -0x28(%ebp)
+    2303:	e8 73 04 00 00       	call   277b <read>
+    2308:	83 c4 0c             	add    $0xc,%esp
+    230b:	6a 01                	push   $0x1
+    230d:	68 ae 3a 00 00       	push   $0x3aae
+    2312:	ff 75 e4             	push   -0x1c(%ebp)
+    2315:	e8 69 04 00 00       	call   2783 <write>
+    231a:	83 c4 10             	add    $0x10,%esp
+    231d:	83 ec 04             	sub    $0x4,%esp
+    2320:	c6 45 d7 4e          	movb   $0x4e,-0x29(%ebp)
+    2324:	6a 01                	push   $0x1
+    2326:	ff 75 c4             	push   -0x3c(%ebp)
+    2329:	ff 75 d8             	push   -0x28(%ebp)
+    232c:	e8 4a 04 00 00       	call   277b <read>
+    2331:	5a                   	pop    %edx
+    2332:	ff 75 d8             	push   -0x28(%ebp)
+    2335:	e8 51 04 00 00       	call   278b <close>
+    233a:	59                   	pop    %ecx
+    233b:	ff 75 e0             	push   -0x20(%ebp)
+    233e:	e8 48 04 00 00       	call   278b <close>
+    2343:	5b                   	pop    %ebx
+    2344:	ff 75 dc             	push   -0x24(%ebp)
+    2347:	e8 3f 04 00 00       	call   278b <close>
+    234c:	5e                   	pop    %esi
+    234d:	ff 75 e4             	push   -0x1c(%ebp)
+    2350:	e8 36 04 00 00       	call   278b <close>
+    2355:	e8 11 04 00 00       	call   276b <wait>
+    235a:	83 c4 10             	add    $0x10,%esp
+    235d:	e9 38 ff ff ff       	jmp    229a <test_copy_on_write_control_parent_child+0x17a>
+    2362:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+    2366:	75 68                	jne    23d0 <test_copy_on_write_control_parent_child+0x2b0>
+    2368:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    236b:	51                   	push   %ecx
+    236c:	6a 01                	push   $0x1
+    236e:	68 ae 3a 00 00       	push   $0x3aae
+    2373:	ff 75 dc             	push   -0x24(%ebp)
+    2376:	e8 08 04 00 00       	call   2783 <write>
+    237b:	83 c4 0c             	add    $0xc,%esp
+    237e:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    2381:	6a 01                	push   $0x1
+    2383:	50                   	push   %eax
+    2384:	ff 75 e0             	push   -0x20(%ebp)
+    2387:	e8 ef 03 00 00       	call   277b <read>
+    238c:	83 c4 10             	add    $0x10,%esp
+    238f:	85 db                	test   %ebx,%ebx
+    2391:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+    2394:	0f 88 95 00 00 00    	js     242f <test_copy_on_write_control_parent_child+0x30f>
+    239a:	83 7d 10 01          	cmpl   $0x1,0x10(%ebp)
+    239e:	b9 01 00 00 00       	mov    $0x1,%ecx
+    23a3:	19 c0                	sbb    %eax,%eax
+    23a5:	83 c0 59             	add    $0x59,%eax
+    23a8:	0f be 34 1f          	movsbl (%edi,%ebx,1),%esi
+    23ac:	39 f0                	cmp    %esi,%eax
+    23ae:	0f 45 d1             	cmovne %ecx,%edx
+    23b1:	83 eb 01             	sub    $0x1,%ebx
+    23b4:	73 f2                	jae    23a8 <test_copy_on_write_control_parent_child+0x288>
+    23b6:	85 d2                	test   %edx,%edx
+    23b8:	74 75                	je     242f <test_copy_on_write_control_parent_child+0x30f>
+    23ba:	b8 9c 3a 00 00       	mov    $0x3a9c,%eax
+    23bf:	52                   	push   %edx
+    23c0:	6a 01                	push   $0x1
+    23c2:	50                   	push   %eax
+    23c3:	ff 75 dc             	push   -0x24(%ebp)
+    23c6:	e8 b8 03 00 00       	call   2783 <write>
+    23cb:	e8 93 03 00 00       	call   2763 <exit>
+    23d0:	85 db                	test   %ebx,%ebx
+    23d2:	78 37                	js     240b <test_copy_on_write_control_parent_child+0x2eb>
+    23d4:	89 d8                	mov    %ebx,%eax
+    23d6:	c6 04 07 59          	movb   $0x59,(%edi,%eax,1)
+    23da:	83 e8 01             	sub    $0x1,%eax
+    23dd:	73 f7                	jae    23d6 <test_copy_on_write_control_parent_child+0x2b6>
+    23df:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+    23e2:	50                   	push   %eax
+    23e3:	6a 01                	push   $0x1
+    23e5:	68 ae 3a 00 00       	push   $0x3aae
+    23ea:	ff 75 dc             	push   -0x24(%ebp)
+    23ed:	e8 91 03 00 00       	call   2783 <write>
+    23f2:	83 c4 0c             	add    $0xc,%esp
+    23f5:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    23f8:	6a 01                	push   $0x1
+    23fa:	50                   	push   %eax
+    23fb:	ff 75 e0             	push   -0x20(%ebp)
+    23fe:	e8 78 03 00 00       	call   277b <read>
+    2403:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+    2406:	83 c4 10             	add    $0x10,%esp
+    2409:	eb 8f                	jmp    239a <test_copy_on_write_control_parent_child+0x27a>
+    240b:	57                   	push   %edi
+    240c:	6a 01                	push   $0x1
+    240e:	68 ae 3a 00 00       	push   $0x3aae
+    2413:	ff 75 dc             	push   -0x24(%ebp)
+    2416:	e8 68 03 00 00       	call   2783 <write>
+    241b:	83 c4 0c             	add    $0xc,%esp
+    241e:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    2421:	6a 01                	push   $0x1
+    2423:	50                   	push   %eax
+    2424:	ff 75 e0             	push   -0x20(%ebp)
+    2427:	e8 4f 03 00 00       	call   277b <read>
+    242c:	83 c4 10             	add    $0x10,%esp
+    242f:	b8 26 3a 00 00       	mov    $0x3a26,%eax
+    2434:	eb 89                	jmp    23bf <test_copy_on_write_control_parent_child+0x29f>
+    2436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    243d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002440 <test_copy_on_write_control_parent_child_fork>:
+    2440:	55                   	push   %ebp
+    2441:	89 e5                	mov    %esp,%ebp
+    2443:	83 ec 24             	sub    $0x24,%esp
+    2446:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    2449:	c7 45 f0 ff ff ff ff 	movl   $0xffffffff,-0x10(%ebp)
+    2450:	c7 45 f4 ff ff ff ff 	movl   $0xffffffff,-0xc(%ebp)
+    2457:	50                   	push   %eax
+    2458:	e8 16 03 00 00       	call   2773 <pipe>
+    245d:	e8 f9 02 00 00       	call   275b <fork>
+    2462:	83 c4 10             	add    $0x10,%esp
+    2465:	85 c0                	test   %eax,%eax
+    2467:	74 5f                	je     24c8 <test_copy_on_write_control_parent_child_fork+0x88>
+    2469:	83 ec 0c             	sub    $0xc,%esp
+    246c:	ff 75 f4             	push   -0xc(%ebp)
+    246f:	e8 17 03 00 00       	call   278b <close>
+    2474:	83 c4 0c             	add    $0xc,%esp
+    2477:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    247a:	c6 45 ef 3f          	movb   $0x3f,-0x11(%ebp)
+    247e:	6a 01                	push   $0x1
+    2480:	50                   	push   %eax
+    2481:	ff 75 f0             	push   -0x10(%ebp)
+    2484:	e8 f2 02 00 00       	call   277b <read>
+    2489:	58                   	pop    %eax
+    248a:	ff 75 f0             	push   -0x10(%ebp)
+    248d:	e8 f9 02 00 00       	call   278b <close>
+    2492:	e8 d4 02 00 00       	call   276b <wait>
+    2497:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    249b:	31 d2                	xor    %edx,%edx
+    249d:	83 c4 10             	add    $0x10,%esp
+    24a0:	3c 59                	cmp    $0x59,%al
+    24a2:	0f 94 c2             	sete   %dl
+    24a5:	3c 3f                	cmp    $0x3f,%al
+    24a7:	74 07                	je     24b0 <test_copy_on_write_control_parent_child_fork+0x70>
+    24a9:	c9                   	leave
+    24aa:	89 d0                	mov    %edx,%eax
+    24ac:	c3                   	ret
+    24ad:	8d 76 00             	lea    0x0(%esi),%esi
+    24b0:	83 ec 08             	sub    $0x8,%esp
+    24b3:	68 44 38 00 00       	push   $0x3844
+    24b8:	6a 01                	push   $0x1
+    24ba:	e8 51 04 00 00       	call   2910 <printf>
+    24bf:	31 d2                	xor    %edx,%edx
+    24c1:	83 c4 10             	add    $0x10,%esp
+    24c4:	c9                   	leave
+    24c5:	89 d0                	mov    %edx,%eax
+    24c7:	c3                   	ret
+    24c8:	83 ec 0c             	sub    $0xc,%esp
+    24cb:	ff 75 f0             	push   -0x10(%ebp)
+    24ce:	e8 b8 02 00 00       	call   278b <close>
+    24d3:	83 c4 0c             	add    $0xc,%esp
+    24d6:	ff 75 10             	push   0x10(%ebp)
+    24d9:	ff 75 0c             	push   0xc(%ebp)
+    24dc:	ff 75 08             	push   0x8(%ebp)
+    24df:	e8 3c fc ff ff       	call   2120 <test_copy_on_write_control_parent_child>
+    24e4:	83 c4 10             	add    $0x10,%esp
+    24e7:	85 c0                	test   %eax,%eax
+    24e9:	74 18                	je     2503 <test_copy_on_write_control_parent_child_fork+0xc3>
+    24eb:	51                   	push   %ecx
+    24ec:	6a 01                	push   $0x1
+    24ee:	68 26 3a 00 00       	push   $0x3a26
+    24f3:	ff 75 f4             	push   -0xc(%ebp)
+    24f6:	e8 88 02 00 00       	call   2783 <write>
+    24fb:	83 c4 10             	add    $0x10,%esp
+    24fe:	e8 60 02 00 00       	call   2763 <exit>
+    2503:	52                   	push   %edx
+    2504:	6a 01                	push   $0x1
+    2506:	68 9c 3a 00 00       	push   $0x3a9c
+    250b:	ff 75 f4             	push   -0xc(%ebp)
+    250e:	e8 70 02 00 00       	call   2783 <write>
+    2513:	83 c4 10             	add    $0x10,%esp
+    2516:	eb e6                	jmp    24fe <test_copy_on_write_control_parent_child_fork+0xbe>
+    2518:	66 90                	xchg   %ax,%ax
+    251a:	66 90                	xchg   %ax,%ax
+    251c:	66 90                	xchg   %ax,%ax
+    251e:	66 90                	xchg   %ax,%ax
+
+00002520 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    2520:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    2521:	31 c0                	xor    %eax,%eax
+{
+    2523:	89 e5                	mov    %esp,%ebp
+    2525:	53                   	push   %ebx
+    2526:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    2529:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    252c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    2530:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    2534:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    2537:	83 c0 01             	add    $0x1,%eax
+    253a:	84 d2                	test   %dl,%dl
+    253c:	75 f2                	jne    2530 <strcpy+0x10>
+    ;
+  return os;
+}
+    253e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2541:	89 c8                	mov    %ecx,%eax
+    2543:	c9                   	leave
+    2544:	c3                   	ret
+    2545:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    254c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002550 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    2550:	55                   	push   %ebp
+    2551:	89 e5                	mov    %esp,%ebp
+    2553:	53                   	push   %ebx
+    2554:	8b 55 08             	mov    0x8(%ebp),%edx
+    2557:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    255a:	0f b6 02             	movzbl (%edx),%eax
+    255d:	84 c0                	test   %al,%al
+    255f:	75 17                	jne    2578 <strcmp+0x28>
+    2561:	eb 3a                	jmp    259d <strcmp+0x4d>
+    2563:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2567:	90                   	nop
+    2568:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    256c:	83 c2 01             	add    $0x1,%edx
+    256f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    2572:	84 c0                	test   %al,%al
+    2574:	74 1a                	je     2590 <strcmp+0x40>
+    p++, q++;
+    2576:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    2578:	0f b6 19             	movzbl (%ecx),%ebx
+    257b:	38 c3                	cmp    %al,%bl
+    257d:	74 e9                	je     2568 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    257f:	29 d8                	sub    %ebx,%eax
+}
+    2581:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2584:	c9                   	leave
+    2585:	c3                   	ret
+    2586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    258d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    2590:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    2594:	31 c0                	xor    %eax,%eax
+    2596:	29 d8                	sub    %ebx,%eax
+}
+    2598:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    259b:	c9                   	leave
+    259c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    259d:	0f b6 19             	movzbl (%ecx),%ebx
+    25a0:	31 c0                	xor    %eax,%eax
+    25a2:	eb db                	jmp    257f <strcmp+0x2f>
+    25a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    25ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    25af:	90                   	nop
+
+000025b0 <strlen>:
+
+uint
+strlen(char *s)
+{
+    25b0:	55                   	push   %ebp
+    25b1:	89 e5                	mov    %esp,%ebp
+    25b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    25b6:	80 3a 00             	cmpb   $0x0,(%edx)
+    25b9:	74 15                	je     25d0 <strlen+0x20>
+    25bb:	31 c0                	xor    %eax,%eax
+    25bd:	8d 76 00             	lea    0x0(%esi),%esi
+    25c0:	83 c0 01             	add    $0x1,%eax
+    25c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    25c7:	89 c1                	mov    %eax,%ecx
+    25c9:	75 f5                	jne    25c0 <strlen+0x10>
+    ;
+  return n;
+}
+    25cb:	89 c8                	mov    %ecx,%eax
+    25cd:	5d                   	pop    %ebp
+    25ce:	c3                   	ret
+    25cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    25d0:	31 c9                	xor    %ecx,%ecx
+}
+    25d2:	5d                   	pop    %ebp
+    25d3:	89 c8                	mov    %ecx,%eax
+    25d5:	c3                   	ret
+    25d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    25dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000025e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    25e0:	55                   	push   %ebp
+    25e1:	89 e5                	mov    %esp,%ebp
+    25e3:	57                   	push   %edi
+    25e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    25e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    25ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+    25ed:	89 d7                	mov    %edx,%edi
+    25ef:	fc                   	cld
+    25f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    25f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    25f5:	89 d0                	mov    %edx,%eax
+    25f7:	c9                   	leave
+    25f8:	c3                   	ret
+    25f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002600 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    2600:	55                   	push   %ebp
+    2601:	89 e5                	mov    %esp,%ebp
+    2603:	8b 45 08             	mov    0x8(%ebp),%eax
+    2606:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    260a:	0f b6 10             	movzbl (%eax),%edx
+    260d:	84 d2                	test   %dl,%dl
+    260f:	75 12                	jne    2623 <strchr+0x23>
+    2611:	eb 1d                	jmp    2630 <strchr+0x30>
+    2613:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2617:	90                   	nop
+    2618:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    261c:	83 c0 01             	add    $0x1,%eax
+    261f:	84 d2                	test   %dl,%dl
+    2621:	74 0d                	je     2630 <strchr+0x30>
+    if(*s == c)
+    2623:	38 d1                	cmp    %dl,%cl
+    2625:	75 f1                	jne    2618 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    2627:	5d                   	pop    %ebp
+    2628:	c3                   	ret
+    2629:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    2630:	31 c0                	xor    %eax,%eax
+}
+    2632:	5d                   	pop    %ebp
+    2633:	c3                   	ret
+    2634:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    263b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    263f:	90                   	nop
+
+00002640 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    2640:	55                   	push   %ebp
+    2641:	89 e5                	mov    %esp,%ebp
+    2643:	57                   	push   %edi
+    2644:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    2645:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    2648:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    2649:	31 db                	xor    %ebx,%ebx
+{
+    264b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    264e:	eb 27                	jmp    2677 <gets+0x37>
+    cc = read(0, &c, 1);
+    2650:	83 ec 04             	sub    $0x4,%esp
+    2653:	6a 01                	push   $0x1
+    2655:	56                   	push   %esi
+    2656:	6a 00                	push   $0x0
+    2658:	e8 1e 01 00 00       	call   277b <read>
+    if(cc < 1)
+    265d:	83 c4 10             	add    $0x10,%esp
+    2660:	85 c0                	test   %eax,%eax
+    2662:	7e 1d                	jle    2681 <gets+0x41>
+      break;
+    buf[i++] = c;
+    2664:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    2668:	8b 55 08             	mov    0x8(%ebp),%edx
+    266b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    266f:	3c 0a                	cmp    $0xa,%al
+    2671:	74 10                	je     2683 <gets+0x43>
+    2673:	3c 0d                	cmp    $0xd,%al
+    2675:	74 0c                	je     2683 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    2677:	89 df                	mov    %ebx,%edi
+    2679:	83 c3 01             	add    $0x1,%ebx
+    267c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    267f:	7c cf                	jl     2650 <gets+0x10>
+    2681:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    2683:	8b 45 08             	mov    0x8(%ebp),%eax
+    2686:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    268a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    268d:	5b                   	pop    %ebx
+    268e:	5e                   	pop    %esi
+    268f:	5f                   	pop    %edi
+    2690:	5d                   	pop    %ebp
+    2691:	c3                   	ret
+    2692:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2699:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000026a0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    26a0:	55                   	push   %ebp
+    26a1:	89 e5                	mov    %esp,%ebp
+    26a3:	56                   	push   %esi
+    26a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    26a5:	83 ec 08             	sub    $0x8,%esp
+    26a8:	6a 00                	push   $0x0
+    26aa:	ff 75 08             	push   0x8(%ebp)
+    26ad:	e8 f1 00 00 00       	call   27a3 <open>
+  if(fd < 0)
+    26b2:	83 c4 10             	add    $0x10,%esp
+    26b5:	85 c0                	test   %eax,%eax
+    26b7:	78 27                	js     26e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    26b9:	83 ec 08             	sub    $0x8,%esp
+    26bc:	ff 75 0c             	push   0xc(%ebp)
+    26bf:	89 c3                	mov    %eax,%ebx
+    26c1:	50                   	push   %eax
+    26c2:	e8 f4 00 00 00       	call   27bb <fstat>
+  close(fd);
+    26c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    26ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+    26cc:	e8 ba 00 00 00       	call   278b <close>
+  return r;
+    26d1:	83 c4 10             	add    $0x10,%esp
+}
+    26d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    26d7:	89 f0                	mov    %esi,%eax
+    26d9:	5b                   	pop    %ebx
+    26da:	5e                   	pop    %esi
+    26db:	5d                   	pop    %ebp
+    26dc:	c3                   	ret
+    26dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    26e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    26e5:	eb ed                	jmp    26d4 <stat+0x34>
+    26e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26ee:	66 90                	xchg   %ax,%ax
+
+000026f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    26f0:	55                   	push   %ebp
+    26f1:	89 e5                	mov    %esp,%ebp
+    26f3:	53                   	push   %ebx
+    26f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    26f7:	0f be 02             	movsbl (%edx),%eax
+    26fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    26fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    2700:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    2705:	77 1e                	ja     2725 <atoi+0x35>
+    2707:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    270e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    2710:	83 c2 01             	add    $0x1,%edx
+    2713:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    2716:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    271a:	0f be 02             	movsbl (%edx),%eax
+    271d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    2720:	80 fb 09             	cmp    $0x9,%bl
+    2723:	76 eb                	jbe    2710 <atoi+0x20>
+  return n;
+}
+    2725:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2728:	89 c8                	mov    %ecx,%eax
+    272a:	c9                   	leave
+    272b:	c3                   	ret
+    272c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002730 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    2730:	55                   	push   %ebp
+    2731:	89 e5                	mov    %esp,%ebp
+    2733:	57                   	push   %edi
+    2734:	56                   	push   %esi
+    2735:	8b 45 10             	mov    0x10(%ebp),%eax
+    2738:	8b 55 08             	mov    0x8(%ebp),%edx
+    273b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    273e:	85 c0                	test   %eax,%eax
+    2740:	7e 13                	jle    2755 <memmove+0x25>
+    2742:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    2744:	89 d7                	mov    %edx,%edi
+    2746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    274d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    2750:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    2751:	39 f8                	cmp    %edi,%eax
+    2753:	75 fb                	jne    2750 <memmove+0x20>
+  return vdst;
+}
+    2755:	5e                   	pop    %esi
+    2756:	89 d0                	mov    %edx,%eax
+    2758:	5f                   	pop    %edi
+    2759:	5d                   	pop    %ebp
+    275a:	c3                   	ret
+
+0000275b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    275b:	b8 01 00 00 00       	mov    $0x1,%eax
+    2760:	cd 40                	int    $0x40
+    2762:	c3                   	ret
+
+00002763 <exit>:
+SYSCALL(exit)
+    2763:	b8 02 00 00 00       	mov    $0x2,%eax
+    2768:	cd 40                	int    $0x40
+    276a:	c3                   	ret
+
+0000276b <wait>:
+SYSCALL(wait)
+    276b:	b8 03 00 00 00       	mov    $0x3,%eax
+    2770:	cd 40                	int    $0x40
+    2772:	c3                   	ret
+
+00002773 <pipe>:
+SYSCALL(pipe)
+    2773:	b8 04 00 00 00       	mov    $0x4,%eax
+    2778:	cd 40                	int    $0x40
+    277a:	c3                   	ret
+
+0000277b <read>:
+SYSCALL(read)
+    277b:	b8 05 00 00 00       	mov    $0x5,%eax
+    2780:	cd 40                	int    $0x40
+    2782:	c3                   	ret
+
+00002783 <write>:
+SYSCALL(write)
+    2783:	b8 10 00 00 00       	mov    $0x10,%eax
+    2788:	cd 40                	int    $0x40
+    278a:	c3                   	ret
+
+0000278b <close>:
+SYSCALL(close)
+    278b:	b8 15 00 00 00       	mov    $0x15,%eax
+    2790:	cd 40                	int    $0x40
+    2792:	c3                   	ret
+
+00002793 <kill>:
+SYSCALL(kill)
+    2793:	b8 06 00 00 00       	mov    $0x6,%eax
+    2798:	cd 40                	int    $0x40
+    279a:	c3                   	ret
+
+0000279b <exec>:
+SYSCALL(exec)
+    279b:	b8 07 00 00 00       	mov    $0x7,%eax
+    27a0:	cd 40                	int    $0x40
+    27a2:	c3                   	ret
+
+000027a3 <open>:
+SYSCALL(open)
+    27a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    27a8:	cd 40                	int    $0x40
+    27aa:	c3                   	ret
+
+000027ab <mknod>:
+SYSCALL(mknod)
+    27ab:	b8 11 00 00 00       	mov    $0x11,%eax
+    27b0:	cd 40                	int    $0x40
+    27b2:	c3                   	ret
+
+000027b3 <unlink>:
+SYSCALL(unlink)
+    27b3:	b8 12 00 00 00       	mov    $0x12,%eax
+    27b8:	cd 40                	int    $0x40
+    27ba:	c3                   	ret
+
+000027bb <fstat>:
+SYSCALL(fstat)
+    27bb:	b8 08 00 00 00       	mov    $0x8,%eax
+    27c0:	cd 40                	int    $0x40
+    27c2:	c3                   	ret
+
+000027c3 <link>:
+SYSCALL(link)
+    27c3:	b8 13 00 00 00       	mov    $0x13,%eax
+    27c8:	cd 40                	int    $0x40
+    27ca:	c3                   	ret
+
+000027cb <mkdir>:
+SYSCALL(mkdir)
+    27cb:	b8 14 00 00 00       	mov    $0x14,%eax
+    27d0:	cd 40                	int    $0x40
+    27d2:	c3                   	ret
+
+000027d3 <chdir>:
+SYSCALL(chdir)
+    27d3:	b8 09 00 00 00       	mov    $0x9,%eax
+    27d8:	cd 40                	int    $0x40
+    27da:	c3                   	ret
+
+000027db <dup>:
+SYSCALL(dup)
+    27db:	b8 0a 00 00 00       	mov    $0xa,%eax
+    27e0:	cd 40                	int    $0x40
+    27e2:	c3                   	ret
+
+000027e3 <getpid>:
+SYSCALL(getpid)
+    27e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    27e8:	cd 40                	int    $0x40
+    27ea:	c3                   	ret
+
+000027eb <sbrk>:
+SYSCALL(sbrk)
+    27eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    27f0:	cd 40                	int    $0x40
+    27f2:	c3                   	ret
+
+000027f3 <sleep>:
+SYSCALL(sleep)
+    27f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    27f8:	cd 40                	int    $0x40
+    27fa:	c3                   	ret
+
+000027fb <uptime>:
+SYSCALL(uptime)
+    27fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    2800:	cd 40                	int    $0x40
+    2802:	c3                   	ret
+
+00002803 <trace>:
+SYSCALL(trace)
+    2803:	b8 16 00 00 00       	mov    $0x16,%eax
+    2808:	cd 40                	int    $0x40
+    280a:	c3                   	ret
+
+0000280b <csinfo>:
+SYSCALL(csinfo)
+    280b:	b8 17 00 00 00       	mov    $0x17,%eax
+    2810:	cd 40                	int    $0x40
+    2812:	c3                   	ret
+
+00002813 <settickets>:
+SYSCALL(settickets)
+    2813:	b8 18 00 00 00       	mov    $0x18,%eax
+    2818:	cd 40                	int    $0x40
+    281a:	c3                   	ret
+
+0000281b <getprocessesinfo>:
+SYSCALL(getprocessesinfo)
+    281b:	b8 19 00 00 00       	mov    $0x19,%eax
+    2820:	cd 40                	int    $0x40
+    2822:	c3                   	ret
+
+00002823 <yield>:
+SYSCALL(yield)
+    2823:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    2828:	cd 40                	int    $0x40
+    282a:	c3                   	ret
+
+0000282b <random>:
+SYSCALL(random)
+    282b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    2830:	cd 40                	int    $0x40
+    2832:	c3                   	ret
+
+00002833 <dumppagetable>:
+SYSCALL(dumppagetable)
+    2833:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    2838:	cd 40                	int    $0x40
+    283a:	c3                   	ret
+
+0000283b <getcpusinfo>:
+SYSCALL(getcpusinfo)
+    283b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    2840:	cd 40                	int    $0x40
+    2842:	c3                   	ret
+
+00002843 <setsched>:
+SYSCALL(setsched)
+    2843:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    2848:	cd 40                	int    $0x40
+    284a:	c3                   	ret
+
+0000284b <getbcacheinfo>:
+SYSCALL(getbcacheinfo)
+    284b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    2850:	cd 40                	int    $0x40
+    2852:	c3                   	ret
+
+00002853 <getballocinfo>:
+SYSCALL(getballocinfo)
+    2853:	b8 20 00 00 00       	mov    $0x20,%eax
+    2858:	cd 40                	int    $0x40
+    285a:	c3                   	ret
+
+0000285b <getfaultinfo>:
+SYSCALL(getfaultinfo)
+    285b:	b8 21 00 00 00       	mov    $0x21,%eax
+    2860:	cd 40                	int    $0x40
+    2862:	c3                   	ret
+    2863:	66 90                	xchg   %ax,%ax
+    2865:	66 90                	xchg   %ax,%ax
+    2867:	66 90                	xchg   %ax,%ax
+    2869:	66 90                	xchg   %ax,%ax
+    286b:	66 90                	xchg   %ax,%ax
+    286d:	66 90                	xchg   %ax,%ax
+    286f:	90                   	nop
+
+00002870 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    2870:	55                   	push   %ebp
+    2871:	89 e5                	mov    %esp,%ebp
+    2873:	57                   	push   %edi
+    2874:	56                   	push   %esi
+    2875:	53                   	push   %ebx
+    2876:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    2878:	89 d1                	mov    %edx,%ecx
+{
+    287a:	83 ec 3c             	sub    $0x3c,%esp
+    287d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    2880:	85 d2                	test   %edx,%edx
+    2882:	0f 89 80 00 00 00    	jns    2908 <printint+0x98>
+    2888:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    288c:	74 7a                	je     2908 <printint+0x98>
+    x = -xx;
+    288e:	f7 d9                	neg    %ecx
+    neg = 1;
+    2890:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    2895:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    2898:	31 f6                	xor    %esi,%esi
+    289a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    28a0:	89 c8                	mov    %ecx,%eax
+    28a2:	31 d2                	xor    %edx,%edx
+    28a4:	89 f7                	mov    %esi,%edi
+    28a6:	f7 f3                	div    %ebx
+    28a8:	8d 76 01             	lea    0x1(%esi),%esi
+    28ab:	0f b6 92 28 3b 00 00 	movzbl 0x3b28(%edx),%edx
+    28b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    28b6:	89 ca                	mov    %ecx,%edx
+    28b8:	89 c1                	mov    %eax,%ecx
+    28ba:	39 da                	cmp    %ebx,%edx
+    28bc:	73 e2                	jae    28a0 <printint+0x30>
+  if(neg)
+    28be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    28c1:	85 c0                	test   %eax,%eax
+    28c3:	74 07                	je     28cc <printint+0x5c>
+    buf[i++] = '-';
+    28c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    28ca:	89 f7                	mov    %esi,%edi
+    28cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    28cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    28d2:	01 df                	add    %ebx,%edi
+    28d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    28d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    28db:	83 ec 04             	sub    $0x4,%esp
+    28de:	88 45 d7             	mov    %al,-0x29(%ebp)
+    28e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    28e4:	6a 01                	push   $0x1
+    28e6:	50                   	push   %eax
+    28e7:	56                   	push   %esi
+    28e8:	e8 96 fe ff ff       	call   2783 <write>
+  while(--i >= 0)
+    28ed:	89 f8                	mov    %edi,%eax
+    28ef:	83 c4 10             	add    $0x10,%esp
+    28f2:	83 ef 01             	sub    $0x1,%edi
+    28f5:	39 d8                	cmp    %ebx,%eax
+    28f7:	75 df                	jne    28d8 <printint+0x68>
+}
+    28f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    28fc:	5b                   	pop    %ebx
+    28fd:	5e                   	pop    %esi
+    28fe:	5f                   	pop    %edi
+    28ff:	5d                   	pop    %ebp
+    2900:	c3                   	ret
+    2901:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    2908:	31 c0                	xor    %eax,%eax
+    290a:	eb 89                	jmp    2895 <printint+0x25>
+    290c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002910 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    2910:	55                   	push   %ebp
+    2911:	89 e5                	mov    %esp,%ebp
+    2913:	57                   	push   %edi
+    2914:	56                   	push   %esi
+    2915:	53                   	push   %ebx
+    2916:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    2919:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    291c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    291f:	0f b6 1e             	movzbl (%esi),%ebx
+    2922:	83 c6 01             	add    $0x1,%esi
+    2925:	84 db                	test   %bl,%bl
+    2927:	74 67                	je     2990 <printf+0x80>
+    2929:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    292c:	31 d2                	xor    %edx,%edx
+    292e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    2931:	eb 34                	jmp    2967 <printf+0x57>
+    2933:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2937:	90                   	nop
+    2938:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    293b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    2940:	83 f8 25             	cmp    $0x25,%eax
+    2943:	74 18                	je     295d <printf+0x4d>
+  write(fd, &c, 1);
+    2945:	83 ec 04             	sub    $0x4,%esp
+    2948:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    294b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    294e:	6a 01                	push   $0x1
+    2950:	50                   	push   %eax
+    2951:	57                   	push   %edi
+    2952:	e8 2c fe ff ff       	call   2783 <write>
+    2957:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    295a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    295d:	0f b6 1e             	movzbl (%esi),%ebx
+    2960:	83 c6 01             	add    $0x1,%esi
+    2963:	84 db                	test   %bl,%bl
+    2965:	74 29                	je     2990 <printf+0x80>
+    c = fmt[i] & 0xff;
+    2967:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    296a:	85 d2                	test   %edx,%edx
+    296c:	74 ca                	je     2938 <printf+0x28>
+      }
+    } else if(state == '%'){
+    296e:	83 fa 25             	cmp    $0x25,%edx
+    2971:	75 ea                	jne    295d <printf+0x4d>
+      if(c == 'd'){
+    2973:	83 f8 25             	cmp    $0x25,%eax
+    2976:	0f 84 24 01 00 00    	je     2aa0 <printf+0x190>
+    297c:	83 e8 63             	sub    $0x63,%eax
+    297f:	83 f8 15             	cmp    $0x15,%eax
+    2982:	77 1c                	ja     29a0 <printf+0x90>
+    2984:	ff 24 85 d0 3a 00 00 	jmp    *0x3ad0(,%eax,4)
+    298b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    298f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    2990:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2993:	5b                   	pop    %ebx
+    2994:	5e                   	pop    %esi
+    2995:	5f                   	pop    %edi
+    2996:	5d                   	pop    %ebp
+    2997:	c3                   	ret
+    2998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    299f:	90                   	nop
+  write(fd, &c, 1);
+    29a0:	83 ec 04             	sub    $0x4,%esp
+    29a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    29a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    29aa:	6a 01                	push   $0x1
+    29ac:	52                   	push   %edx
+    29ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    29b0:	57                   	push   %edi
+    29b1:	e8 cd fd ff ff       	call   2783 <write>
+    29b6:	83 c4 0c             	add    $0xc,%esp
+    29b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    29bc:	6a 01                	push   $0x1
+    29be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    29c1:	52                   	push   %edx
+    29c2:	57                   	push   %edi
+    29c3:	e8 bb fd ff ff       	call   2783 <write>
+        putc(fd, c);
+    29c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    29cb:	31 d2                	xor    %edx,%edx
+    29cd:	eb 8e                	jmp    295d <printf+0x4d>
+    29cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    29d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    29d3:	83 ec 0c             	sub    $0xc,%esp
+    29d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    29db:	8b 13                	mov    (%ebx),%edx
+    29dd:	6a 00                	push   $0x0
+    29df:	89 f8                	mov    %edi,%eax
+        ap++;
+    29e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    29e4:	e8 87 fe ff ff       	call   2870 <printint>
+        ap++;
+    29e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    29ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    29ef:	31 d2                	xor    %edx,%edx
+    29f1:	e9 67 ff ff ff       	jmp    295d <printf+0x4d>
+    29f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    29fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    2a00:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    2a03:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    2a05:	83 c0 04             	add    $0x4,%eax
+    2a08:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    2a0b:	85 db                	test   %ebx,%ebx
+    2a0d:	0f 84 9d 00 00 00    	je     2ab0 <printf+0x1a0>
+        while(*s != 0){
+    2a13:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    2a16:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    2a18:	84 c0                	test   %al,%al
+    2a1a:	0f 84 3d ff ff ff    	je     295d <printf+0x4d>
+    2a20:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    2a23:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    2a26:	89 de                	mov    %ebx,%esi
+    2a28:	89 d3                	mov    %edx,%ebx
+    2a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    2a30:	83 ec 04             	sub    $0x4,%esp
+    2a33:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    2a36:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    2a39:	6a 01                	push   $0x1
+    2a3b:	53                   	push   %ebx
+    2a3c:	57                   	push   %edi
+    2a3d:	e8 41 fd ff ff       	call   2783 <write>
+        while(*s != 0){
+    2a42:	0f b6 06             	movzbl (%esi),%eax
+    2a45:	83 c4 10             	add    $0x10,%esp
+    2a48:	84 c0                	test   %al,%al
+    2a4a:	75 e4                	jne    2a30 <printf+0x120>
+      state = 0;
+    2a4c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    2a4f:	31 d2                	xor    %edx,%edx
+    2a51:	e9 07 ff ff ff       	jmp    295d <printf+0x4d>
+    2a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a5d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    2a60:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    2a63:	83 ec 0c             	sub    $0xc,%esp
+    2a66:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    2a6b:	8b 13                	mov    (%ebx),%edx
+    2a6d:	6a 01                	push   $0x1
+    2a6f:	e9 6b ff ff ff       	jmp    29df <printf+0xcf>
+    2a74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    2a78:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    2a7b:	83 ec 04             	sub    $0x4,%esp
+    2a7e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    2a81:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    2a83:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    2a86:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    2a89:	6a 01                	push   $0x1
+    2a8b:	52                   	push   %edx
+    2a8c:	57                   	push   %edi
+    2a8d:	e8 f1 fc ff ff       	call   2783 <write>
+        ap++;
+    2a92:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    2a95:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    2a98:	31 d2                	xor    %edx,%edx
+    2a9a:	e9 be fe ff ff       	jmp    295d <printf+0x4d>
+    2a9f:	90                   	nop
+  write(fd, &c, 1);
+    2aa0:	83 ec 04             	sub    $0x4,%esp
+    2aa3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    2aa6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    2aa9:	6a 01                	push   $0x1
+    2aab:	e9 11 ff ff ff       	jmp    29c1 <printf+0xb1>
+    2ab0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    2ab5:	bb c6 3a 00 00       	mov    $0x3ac6,%ebx
+    2aba:	e9 61 ff ff ff       	jmp    2a20 <printf+0x110>
+    2abf:	90                   	nop
+
+00002ac0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    2ac0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2ac1:	a1 40 45 00 00       	mov    0x4540,%eax
+{
+    2ac6:	89 e5                	mov    %esp,%ebp
+    2ac8:	57                   	push   %edi
+    2ac9:	56                   	push   %esi
+    2aca:	53                   	push   %ebx
+    2acb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    2ace:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2ad1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2ad8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2ada:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2adc:	39 ca                	cmp    %ecx,%edx
+    2ade:	73 30                	jae    2b10 <free+0x50>
+    2ae0:	39 c1                	cmp    %eax,%ecx
+    2ae2:	72 04                	jb     2ae8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2ae4:	39 c2                	cmp    %eax,%edx
+    2ae6:	72 f0                	jb     2ad8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    2ae8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    2aeb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    2aee:	39 f8                	cmp    %edi,%eax
+    2af0:	74 2e                	je     2b20 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2af2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    2af5:	8b 42 04             	mov    0x4(%edx),%eax
+    2af8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2afb:	39 f1                	cmp    %esi,%ecx
+    2afd:	74 38                	je     2b37 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    2aff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    2b01:	5b                   	pop    %ebx
+  freep = p;
+    2b02:	89 15 40 45 00 00    	mov    %edx,0x4540
+}
+    2b08:	5e                   	pop    %esi
+    2b09:	5f                   	pop    %edi
+    2b0a:	5d                   	pop    %ebp
+    2b0b:	c3                   	ret
+    2b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2b10:	39 c1                	cmp    %eax,%ecx
+    2b12:	72 d0                	jb     2ae4 <free+0x24>
+    2b14:	eb c2                	jmp    2ad8 <free+0x18>
+    2b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2b1d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    2b20:	03 70 04             	add    0x4(%eax),%esi
+    2b23:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2b26:	8b 02                	mov    (%edx),%eax
+    2b28:	8b 00                	mov    (%eax),%eax
+    2b2a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    2b2d:	8b 42 04             	mov    0x4(%edx),%eax
+    2b30:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    2b33:	39 f1                	cmp    %esi,%ecx
+    2b35:	75 c8                	jne    2aff <free+0x3f>
+    p->s.size += bp->s.size;
+    2b37:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    2b3a:	89 15 40 45 00 00    	mov    %edx,0x4540
+    p->s.size += bp->s.size;
+    2b40:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    2b43:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    2b46:	89 0a                	mov    %ecx,(%edx)
+}
+    2b48:	5b                   	pop    %ebx
+    2b49:	5e                   	pop    %esi
+    2b4a:	5f                   	pop    %edi
+    2b4b:	5d                   	pop    %ebp
+    2b4c:	c3                   	ret
+    2b4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002b50 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    2b50:	55                   	push   %ebp
+    2b51:	89 e5                	mov    %esp,%ebp
+    2b53:	57                   	push   %edi
+    2b54:	56                   	push   %esi
+    2b55:	53                   	push   %ebx
+    2b56:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2b59:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    2b5c:	8b 15 40 45 00 00    	mov    0x4540,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2b62:	8d 78 07             	lea    0x7(%eax),%edi
+    2b65:	c1 ef 03             	shr    $0x3,%edi
+    2b68:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    2b6b:	85 d2                	test   %edx,%edx
+    2b6d:	0f 84 8d 00 00 00    	je     2c00 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2b73:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2b75:	8b 48 04             	mov    0x4(%eax),%ecx
+    2b78:	39 f9                	cmp    %edi,%ecx
+    2b7a:	73 64                	jae    2be0 <malloc+0x90>
+  if(nu < 4096)
+    2b7c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    2b81:	39 df                	cmp    %ebx,%edi
+    2b83:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    2b86:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    2b8d:	eb 0a                	jmp    2b99 <malloc+0x49>
+    2b8f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2b90:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    2b92:	8b 48 04             	mov    0x4(%eax),%ecx
+    2b95:	39 f9                	cmp    %edi,%ecx
+    2b97:	73 47                	jae    2be0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    2b99:	89 c2                	mov    %eax,%edx
+    2b9b:	39 05 40 45 00 00    	cmp    %eax,0x4540
+    2ba1:	75 ed                	jne    2b90 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    2ba3:	83 ec 0c             	sub    $0xc,%esp
+    2ba6:	56                   	push   %esi
+    2ba7:	e8 3f fc ff ff       	call   27eb <sbrk>
+  if(p == (char*)-1)
+    2bac:	83 c4 10             	add    $0x10,%esp
+    2baf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2bb2:	74 1c                	je     2bd0 <malloc+0x80>
+  hp->s.size = nu;
+    2bb4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    2bb7:	83 ec 0c             	sub    $0xc,%esp
+    2bba:	83 c0 08             	add    $0x8,%eax
+    2bbd:	50                   	push   %eax
+    2bbe:	e8 fd fe ff ff       	call   2ac0 <free>
+  return freep;
+    2bc3:	8b 15 40 45 00 00    	mov    0x4540,%edx
+      if((p = morecore(nunits)) == 0)
+    2bc9:	83 c4 10             	add    $0x10,%esp
+    2bcc:	85 d2                	test   %edx,%edx
+    2bce:	75 c0                	jne    2b90 <malloc+0x40>
+        return 0;
+  }
+}
+    2bd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    2bd3:	31 c0                	xor    %eax,%eax
+}
+    2bd5:	5b                   	pop    %ebx
+    2bd6:	5e                   	pop    %esi
+    2bd7:	5f                   	pop    %edi
+    2bd8:	5d                   	pop    %ebp
+    2bd9:	c3                   	ret
+    2bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    2be0:	39 cf                	cmp    %ecx,%edi
+    2be2:	74 4c                	je     2c30 <malloc+0xe0>
+        p->s.size -= nunits;
+    2be4:	29 f9                	sub    %edi,%ecx
+    2be6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    2be9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    2bec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    2bef:	89 15 40 45 00 00    	mov    %edx,0x4540
+}
+    2bf5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    2bf8:	83 c0 08             	add    $0x8,%eax
+}
+    2bfb:	5b                   	pop    %ebx
+    2bfc:	5e                   	pop    %esi
+    2bfd:	5f                   	pop    %edi
+    2bfe:	5d                   	pop    %ebp
+    2bff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    2c00:	c7 05 40 45 00 00 44 	movl   $0x4544,0x4540
+    2c07:	45 00 00 
+    base.s.size = 0;
+    2c0a:	b8 44 45 00 00       	mov    $0x4544,%eax
+    base.s.ptr = freep = prevp = &base;
+    2c0f:	c7 05 44 45 00 00 44 	movl   $0x4544,0x4544
+    2c16:	45 00 00 
+    base.s.size = 0;
+    2c19:	c7 05 48 45 00 00 00 	movl   $0x0,0x4548
+    2c20:	00 00 00 
+    if(p->s.size >= nunits){
+    2c23:	e9 54 ff ff ff       	jmp    2b7c <malloc+0x2c>
+    2c28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    2c30:	8b 08                	mov    (%eax),%ecx
+    2c32:	89 0a                	mov    %ecx,(%edx)
+    2c34:	eb b9                	jmp    2bef <malloc+0x9f>
@@ -0,0 +1,2346 @@
+
+_bcachebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char data[BSIZE];
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	bb 08 00 00 00       	mov    $0x8,%ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 48             	sub    $0x48,%esp
+  uint start, elapsed, gets, hits;
+  struct bcache_info before, after;
+  char *path = "bcachebench.data";
+
+  nreaders = NCPU;
+  if(argc > 1)
+      19:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      1c:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+      1f:	7e 10                	jle    31 <main+0x31>
+    nreaders = atoi(argv[1]);
+      21:	83 ec 0c             	sub    $0xc,%esp
+      24:	ff 70 04             	push   0x4(%eax)
+      27:	e8 84 0c 00 00       	call   cb0 <atoi>
+      2c:	83 c4 10             	add    $0x10,%esp
+      2f:	89 c3                	mov    %eax,%ebx
+
+  memset(data, 'a', sizeof(data));
+      31:	83 ec 04             	sub    $0x4,%esp
+      34:	68 00 02 00 00       	push   $0x200
+      39:	6a 61                	push   $0x61
+      3b:	68 e0 18 00 00       	push   $0x18e0
+      40:	e8 5b 0b 00 00       	call   ba0 <memset>
+  fd = open(path, O_CREATE|O_RDWR);
+      45:	59                   	pop    %ecx
+      46:	5e                   	pop    %esi
+      47:	68 02 02 00 00       	push   $0x202
+      4c:	68 f8 11 00 00       	push   $0x11f8
+      51:	be 64 00 00 00       	mov    $0x64,%esi
+      56:	e8 08 0d 00 00       	call   d63 <open>
+  if(fd < 0){
+      5b:	83 c4 10             	add    $0x10,%esp
+  fd = open(path, O_CREATE|O_RDWR);
+      5e:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+      60:	85 c0                	test   %eax,%eax
+      62:	79 11                	jns    75 <main+0x75>
+      64:	eb 3f                	jmp    a5 <main+0xa5>
+      66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      6d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "bcachebench: cannot create %s\n", path);
+    exit();
+  }
+  for(i = 0; i < NBLOCKS; i++)
+      70:	83 ee 01             	sub    $0x1,%esi
+      73:	74 47                	je     bc <main+0xbc>
+    if(write(fd, data, sizeof(data)) != sizeof(data)){
+      75:	83 ec 04             	sub    $0x4,%esp
+      78:	68 00 02 00 00       	push   $0x200
+      7d:	68 e0 18 00 00       	push   $0x18e0
+      82:	57                   	push   %edi
+      83:	e8 bb 0c 00 00       	call   d43 <write>
+      88:	83 c4 10             	add    $0x10,%esp
+      8b:	3d 00 02 00 00       	cmp    $0x200,%eax
+      90:	74 de                	je     70 <main+0x70>
+      printf(1, "bcachebench: write failed\n");
+      92:	50                   	push   %eax
+      93:	50                   	push   %eax
+      94:	68 09 12 00 00       	push   $0x1209
+      99:	6a 01                	push   $0x1
+      9b:	e8 30 0e 00 00       	call   ed0 <printf>
+      exit();
+      a0:	e8 7e 0c 00 00       	call   d23 <exit>
+    printf(1, "bcachebench: cannot create %s\n", path);
+      a5:	52                   	push   %edx
+      a6:	68 f8 11 00 00       	push   $0x11f8
+      ab:	68 24 12 00 00       	push   $0x1224
+      b0:	6a 01                	push   $0x1
+      b2:	e8 19 0e 00 00       	call   ed0 <printf>
+    exit();
+      b7:	e8 67 0c 00 00       	call   d23 <exit>
+    }
+  close(fd);
+      bc:	83 ec 0c             	sub    $0xc,%esp
+      bf:	57                   	push   %edi
+      c0:	e8 86 0c 00 00       	call   d4b <close>
+
+  getbcacheinfo(&before);
+      c5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+      c8:	89 04 24             	mov    %eax,(%esp)
+      cb:	e8 3b 0d 00 00       	call   e0b <getbcacheinfo>
+  start = uptime();
+      d0:	e8 e6 0c 00 00       	call   dbb <uptime>
+  for(i = 0; i < nreaders; i++){
+      d5:	83 c4 10             	add    $0x10,%esp
+  start = uptime();
+      d8:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < nreaders; i++){
+      da:	85 db                	test   %ebx,%ebx
+      dc:	7e 7d                	jle    15b <main+0x15b>
+      de:	31 ff                	xor    %edi,%edi
+      e0:	eb 0d                	jmp    ef <main+0xef>
+      e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      e8:	83 c7 01             	add    $0x1,%edi
+      eb:	39 fb                	cmp    %edi,%ebx
+      ed:	74 5c                	je     14b <main+0x14b>
+    if(fork() == 0){
+      ef:	e8 27 0c 00 00       	call   d1b <fork>
+      f4:	85 c0                	test   %eax,%eax
+      f6:	75 f0                	jne    e8 <main+0xe8>
+      f8:	be 14 00 00 00       	mov    $0x14,%esi
+      fd:	8d 76 00             	lea    0x0(%esi),%esi
+      for(j = 0; j < NREAD; j++){
+        fd = open(path, O_RDONLY);
+     100:	83 ec 08             	sub    $0x8,%esp
+     103:	6a 00                	push   $0x0
+     105:	68 f8 11 00 00       	push   $0x11f8
+     10a:	e8 54 0c 00 00       	call   d63 <open>
+        while(read(fd, data, sizeof(data)) == sizeof(data))
+     10f:	83 c4 10             	add    $0x10,%esp
+        fd = open(path, O_RDONLY);
+     112:	89 c3                	mov    %eax,%ebx
+        while(read(fd, data, sizeof(data)) == sizeof(data))
+     114:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     118:	83 ec 04             	sub    $0x4,%esp
+     11b:	68 00 02 00 00       	push   $0x200
+     120:	68 e0 18 00 00       	push   $0x18e0
+     125:	53                   	push   %ebx
+     126:	e8 10 0c 00 00       	call   d3b <read>
+     12b:	83 c4 10             	add    $0x10,%esp
+     12e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     133:	74 e3                	je     118 <main+0x118>
+          ;
+        close(fd);
+     135:	83 ec 0c             	sub    $0xc,%esp
+     138:	53                   	push   %ebx
+     139:	e8 0d 0c 00 00       	call   d4b <close>
+      for(j = 0; j < NREAD; j++){
+     13e:	83 c4 10             	add    $0x10,%esp
+     141:	83 ee 01             	sub    $0x1,%esi
+     144:	75 ba                	jne    100 <main+0x100>
+      }
+      exit();
+     146:	e8 d8 0b 00 00       	call   d23 <exit>
+    }
+  }
+  for(i = 0; i < nreaders; i++)
+     14b:	31 ff                	xor    %edi,%edi
+     14d:	eb 08                	jmp    157 <main+0x157>
+    wait();
+     14f:	e8 d7 0b 00 00       	call   d2b <wait>
+  for(i = 0; i < nreaders; i++)
+     154:	83 c7 01             	add    $0x1,%edi
+     157:	39 df                	cmp    %ebx,%edi
+     159:	7c f4                	jl     14f <main+0x14f>
+  elapsed = uptime() - start;
+     15b:	e8 5b 0c 00 00       	call   dbb <uptime>
+  getbcacheinfo(&after);
+     160:	83 ec 0c             	sub    $0xc,%esp
+  elapsed = uptime() - start;
+     163:	29 f0                	sub    %esi,%eax
+     165:	89 c7                	mov    %eax,%edi
+  getbcacheinfo(&after);
+     167:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     16a:	50                   	push   %eax
+     16b:	e8 9b 0c 00 00       	call   e0b <getbcacheinfo>
+  unlink(path);
+     170:	c7 04 24 f8 11 00 00 	movl   $0x11f8,(%esp)
+     177:	e8 f7 0b 00 00       	call   d73 <unlink>
+
+  gets = after.gets - before.gets;
+     17c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     17f:	2b 45 c4             	sub    -0x3c(%ebp),%eax
+  hits = after.hits - before.hits;
+  printf(1, "bcachebench: %d readers x %d passes over %d blocks, %d buffers, %d ticks\n",
+     182:	83 c4 0c             	add    $0xc,%esp
+  gets = after.gets - before.gets;
+     185:	89 c6                	mov    %eax,%esi
+  hits = after.hits - before.hits;
+     187:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     18a:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+     18d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+     190:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  printf(1, "bcachebench: %d readers x %d passes over %d blocks, %d buffers, %d ticks\n",
+     193:	57                   	push   %edi
+     194:	ff 75 d4             	push   -0x2c(%ebp)
+     197:	6a 64                	push   $0x64
+     199:	6a 14                	push   $0x14
+     19b:	53                   	push   %ebx
+     19c:	68 44 12 00 00       	push   $0x1244
+     1a1:	6a 01                	push   $0x1
+     1a3:	e8 28 0d 00 00       	call   ed0 <printf>
+         nreaders, NREAD, NBLOCKS, after.nbuf, elapsed);
+  if(gets > 0)
+     1a8:	83 c4 20             	add    $0x20,%esp
+     1ab:	85 f6                	test   %esi,%esi
+     1ad:	74 97                	je     146 <main+0x146>
+    printf(1, "bget: %d calls, %d%% hits, %d cycles/call\n",
+           gets, hits * 100 / gets, (uint)((after.cycles - before.cycles) / gets));
+     1af:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     1b2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    printf(1, "bget: %d calls, %d%% hits, %d cycles/call\n",
+     1b5:	83 ec 10             	sub    $0x10,%esp
+           gets, hits * 100 / gets, (uint)((after.cycles - before.cycles) / gets));
+     1b8:	2b 45 cc             	sub    -0x34(%ebp),%eax
+     1bb:	1b 55 d0             	sbb    -0x30(%ebp),%edx
+     1be:	31 db                	xor    %ebx,%ebx
+     1c0:	53                   	push   %ebx
+     1c1:	56                   	push   %esi
+     1c2:	52                   	push   %edx
+     1c3:	50                   	push   %eax
+     1c4:	e8 97 08 00 00       	call   a60 <__udivdi3>
+     1c9:	83 c4 14             	add    $0x14,%esp
+    printf(1, "bget: %d calls, %d%% hits, %d cycles/call\n",
+     1cc:	50                   	push   %eax
+  hits = after.hits - before.hits;
+     1cd:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     1d0:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+     1d3:	29 d0                	sub    %edx,%eax
+    printf(1, "bget: %d calls, %d%% hits, %d cycles/call\n",
+     1d5:	31 d2                	xor    %edx,%edx
+           gets, hits * 100 / gets, (uint)((after.cycles - before.cycles) / gets));
+     1d7:	6b c0 64             	imul   $0x64,%eax,%eax
+    printf(1, "bget: %d calls, %d%% hits, %d cycles/call\n",
+     1da:	f7 f6                	div    %esi
+     1dc:	50                   	push   %eax
+     1dd:	56                   	push   %esi
+     1de:	68 90 12 00 00       	push   $0x1290
+     1e3:	6a 01                	push   $0x1
+     1e5:	e8 e6 0c 00 00       	call   ed0 <printf>
+     1ea:	83 c4 20             	add    $0x20,%esp
+     1ed:	e9 54 ff ff ff       	jmp    146 <main+0x146>
+     1f2:	66 90                	xchg   %ax,%ax
+     1f4:	66 90                	xchg   %ax,%ax
+     1f6:	66 90                	xchg   %ax,%ax
+     1f8:	66 90                	xchg   %ax,%ax
+     1fa:	66 90                	xchg   %ax,%ax
+     1fc:	66 90                	xchg   %ax,%ax
+     1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <__absvdi2>:
+    }
+     200:	55                   	push   %ebp
+     201:	89 e5                	mov    %esp,%ebp
+     203:	53                   	push   %ebx
+  }
+     204:	31 db                	xor    %ebx,%ebx
+     206:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     209:	89 da                	mov    %ebx,%edx
+     20b:	c1 e9 1f             	shr    $0x1f,%ecx
+     20e:	89 c8                	mov    %ecx,%eax
+     210:	f7 d8                	neg    %eax
+     212:	83 d2 00             	adc    $0x0,%edx
+     215:	33 45 08             	xor    0x8(%ebp),%eax
+     218:	f7 da                	neg    %edx
+     21a:	33 55 0c             	xor    0xc(%ebp),%edx
+     21d:	01 c8                	add    %ecx,%eax
+     21f:	11 da                	adc    %ebx,%edx
+  for(i = 0; i < nreaders; i++)
+     221:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     224:	c9                   	leave
+     225:	c3                   	ret
+     226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     22d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000230 <__ashldi3>:
+  unlink(path);
+     230:	55                   	push   %ebp
+     231:	89 e5                	mov    %esp,%ebp
+     233:	56                   	push   %esi
+     234:	53                   	push   %ebx
+     235:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     238:	8b 55 08             	mov    0x8(%ebp),%edx
+     23b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  hits = after.hits - before.hits;
+     23e:	89 c8                	mov    %ecx,%eax
+     240:	83 e0 3f             	and    $0x3f,%eax
+         nreaders, NREAD, NBLOCKS, after.nbuf, elapsed);
+     243:	83 e1 20             	and    $0x20,%ecx
+     246:	74 10                	je     258 <__ashldi3+0x28>
+    printf(1, "bget: %d calls, %d%% hits, %d cycles/call\n",
+     248:	8d 48 e0             	lea    -0x20(%eax),%ecx
+}
+     24b:	5b                   	pop    %ebx
+     24c:	31 c0                	xor    %eax,%eax
+     24e:	5e                   	pop    %esi
+     24f:	d3 e2                	shl    %cl,%edx
+     251:	5d                   	pop    %ebp
+     252:	c3                   	ret
+     253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     257:	90                   	nop
+  exit();
+     258:	85 c0                	test   %eax,%eax
+     25a:	74 24                	je     280 <__ashldi3+0x50>
+     25c:	b9 20 00 00 00       	mov    $0x20,%ecx
+     261:	89 d6                	mov    %edx,%esi
+     263:	29 c1                	sub    %eax,%ecx
+     265:	d3 ee                	shr    %cl,%esi
+     267:	89 c1                	mov    %eax,%ecx
+     269:	d3 e3                	shl    %cl,%ebx
+     26b:	d3 e2                	shl    %cl,%edx
+     26d:	09 de                	or     %ebx,%esi
+     26f:	89 d0                	mov    %edx,%eax
+     271:	5b                   	pop    %ebx
+     272:	89 f2                	mov    %esi,%edx
+     274:	5e                   	pop    %esi
+     275:	5d                   	pop    %ebp
+     276:	c3                   	ret
+     277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     27e:	66 90                	xchg   %ax,%ax
+     280:	89 d0                	mov    %edx,%eax
+     282:	89 da                	mov    %ebx,%edx
+     284:	5b                   	pop    %ebx
+     285:	5e                   	pop    %esi
+     286:	5d                   	pop    %ebp
+     287:	c3                   	ret
+     288:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     28f:	90                   	nop
+
+00000290 <__ashrdi3>:
+     290:	55                   	push   %ebp
+     291:	89 e5                	mov    %esp,%ebp
+     293:	56                   	push   %esi
+     294:	53                   	push   %ebx
+     295:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     298:	8b 45 08             	mov    0x8(%ebp),%eax
+     29b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     29e:	89 cb                	mov    %ecx,%ebx
+     2a0:	83 e3 3f             	and    $0x3f,%ebx
+     2a3:	83 e1 20             	and    $0x20,%ecx
+     2a6:	74 18                	je     2c0 <__ashrdi3+0x30>
+     2a8:	89 d0                	mov    %edx,%eax
+     2aa:	8d 4b e0             	lea    -0x20(%ebx),%ecx
+     2ad:	c1 fa 1f             	sar    $0x1f,%edx
+     2b0:	d3 f8                	sar    %cl,%eax
+     2b2:	5b                   	pop    %ebx
+     2b3:	5e                   	pop    %esi
+     2b4:	5d                   	pop    %ebp
+     2b5:	c3                   	ret
+     2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bd:	8d 76 00             	lea    0x0(%esi),%esi
+     2c0:	85 db                	test   %ebx,%ebx
+     2c2:	74 ee                	je     2b2 <__ashrdi3+0x22>
+     2c4:	b9 20 00 00 00       	mov    $0x20,%ecx
+     2c9:	89 d6                	mov    %edx,%esi
+     2cb:	29 d9                	sub    %ebx,%ecx
+     2cd:	d3 e6                	shl    %cl,%esi
+     2cf:	89 d9                	mov    %ebx,%ecx
+     2d1:	5b                   	pop    %ebx
+     2d2:	d3 e8                	shr    %cl,%eax
+     2d4:	d3 fa                	sar    %cl,%edx
+     2d6:	09 f0                	or     %esi,%eax
+     2d8:	5e                   	pop    %esi
+     2d9:	5d                   	pop    %ebp
+     2da:	c3                   	ret
+     2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2df:	90                   	nop
+
+000002e0 <__clzsi2>:
+     2e0:	55                   	push   %ebp
+     2e1:	31 d2                	xor    %edx,%edx
+     2e3:	89 e5                	mov    %esp,%ebp
+     2e5:	53                   	push   %ebx
+     2e6:	8b 45 08             	mov    0x8(%ebp),%eax
+     2e9:	3d ff ff 00 00       	cmp    $0xffff,%eax
+     2ee:	0f 96 c2             	setbe  %dl
+     2f1:	31 db                	xor    %ebx,%ebx
+     2f3:	c1 e2 04             	shl    $0x4,%edx
+     2f6:	89 d1                	mov    %edx,%ecx
+     2f8:	d3 e0                	shl    %cl,%eax
+     2fa:	3d ff ff ff 00       	cmp    $0xffffff,%eax
+     2ff:	0f 96 c3             	setbe  %bl
+     302:	c1 e3 03             	shl    $0x3,%ebx
+     305:	89 d9                	mov    %ebx,%ecx
+     307:	01 da                	add    %ebx,%edx
+     309:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     30c:	c9                   	leave
+     30d:	d3 e0                	shl    %cl,%eax
+     30f:	31 c9                	xor    %ecx,%ecx
+     311:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+     316:	0f 96 c1             	setbe  %cl
+     319:	c1 e1 02             	shl    $0x2,%ecx
+     31c:	d3 e0                	shl    %cl,%eax
+     31e:	01 ca                	add    %ecx,%edx
+     320:	31 c9                	xor    %ecx,%ecx
+     322:	3d ff ff ff 3f       	cmp    $0x3fffffff,%eax
+     327:	0f 96 c1             	setbe  %cl
+     32a:	01 c9                	add    %ecx,%ecx
+     32c:	d3 e0                	shl    %cl,%eax
+     32e:	01 ca                	add    %ecx,%edx
+     330:	f7 d0                	not    %eax
+     332:	c1 e8 1f             	shr    $0x1f,%eax
+     335:	01 d0                	add    %edx,%eax
+     337:	c3                   	ret
+     338:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     33f:	90                   	nop
+
+00000340 <__clzdi2>:
+     340:	55                   	push   %ebp
+     341:	31 c9                	xor    %ecx,%ecx
+     343:	89 e5                	mov    %esp,%ebp
+     345:	56                   	push   %esi
+     346:	53                   	push   %ebx
+     347:	8b 55 0c             	mov    0xc(%ebp),%edx
+     34a:	8b 45 08             	mov    0x8(%ebp),%eax
+     34d:	85 d2                	test   %edx,%edx
+     34f:	0f 94 c1             	sete   %cl
+     352:	31 db                	xor    %ebx,%ebx
+     354:	c1 e1 05             	shl    $0x5,%ecx
+     357:	0f a5 c2             	shld   %cl,%eax,%edx
+     35a:	d3 e0                	shl    %cl,%eax
+     35c:	f6 c1 20             	test   $0x20,%cl
+     35f:	0f 45 d0             	cmovne %eax,%edx
+     362:	0f 45 c3             	cmovne %ebx,%eax
+     365:	31 db                	xor    %ebx,%ebx
+     367:	81 fa 00 00 01 00    	cmp    $0x10000,%edx
+     36d:	0f 92 c3             	setb   %bl
+     370:	89 de                	mov    %ebx,%esi
+     372:	c1 e6 04             	shl    $0x4,%esi
+     375:	8d 1c 0e             	lea    (%esi,%ecx,1),%ebx
+     378:	89 f1                	mov    %esi,%ecx
+     37a:	31 f6                	xor    %esi,%esi
+     37c:	0f a5 c2             	shld   %cl,%eax,%edx
+     37f:	d3 e0                	shl    %cl,%eax
+     381:	f6 c1 20             	test   $0x20,%cl
+     384:	0f 45 d0             	cmovne %eax,%edx
+     387:	0f 45 c6             	cmovne %esi,%eax
+     38a:	31 c9                	xor    %ecx,%ecx
+     38c:	81 fa 00 00 00 01    	cmp    $0x1000000,%edx
+     392:	0f 92 c1             	setb   %cl
+     395:	31 f6                	xor    %esi,%esi
+     397:	c1 e1 03             	shl    $0x3,%ecx
+     39a:	0f a5 c2             	shld   %cl,%eax,%edx
+     39d:	01 cb                	add    %ecx,%ebx
+     39f:	d3 e0                	shl    %cl,%eax
+     3a1:	f6 c1 20             	test   $0x20,%cl
+     3a4:	0f 45 d0             	cmovne %eax,%edx
+     3a7:	0f 45 c6             	cmovne %esi,%eax
+     3aa:	31 c9                	xor    %ecx,%ecx
+     3ac:	81 fa 00 00 00 10    	cmp    $0x10000000,%edx
+     3b2:	0f 92 c1             	setb   %cl
+     3b5:	31 f6                	xor    %esi,%esi
+     3b7:	c1 e1 02             	shl    $0x2,%ecx
+     3ba:	0f a5 c2             	shld   %cl,%eax,%edx
+     3bd:	01 cb                	add    %ecx,%ebx
+     3bf:	d3 e0                	shl    %cl,%eax
+     3c1:	f6 c1 20             	test   $0x20,%cl
+     3c4:	0f 45 d0             	cmovne %eax,%edx
+     3c7:	0f 45 c6             	cmovne %esi,%eax
+     3ca:	31 c9                	xor    %ecx,%ecx
+     3cc:	81 fa 00 00 00 40    	cmp    $0x40000000,%edx
+     3d2:	0f 92 c1             	setb   %cl
+     3d5:	01 c9                	add    %ecx,%ecx
+     3d7:	0f a5 c2             	shld   %cl,%eax,%edx
+     3da:	d3 e0                	shl    %cl,%eax
+     3dc:	f6 c1 20             	test   $0x20,%cl
+     3df:	0f 45 d0             	cmovne %eax,%edx
+     3e2:	01 cb                	add    %ecx,%ebx
+     3e4:	89 d0                	mov    %edx,%eax
+     3e6:	f7 d0                	not    %eax
+     3e8:	c1 e8 1f             	shr    $0x1f,%eax
+     3eb:	01 d8                	add    %ebx,%eax
+     3ed:	5b                   	pop    %ebx
+     3ee:	5e                   	pop    %esi
+     3ef:	5d                   	pop    %ebp
+     3f0:	c3                   	ret
+     3f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ff:	90                   	nop
+
+00000400 <__divmoddi4.part.0>:
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	57                   	push   %edi
+     404:	89 d7                	mov    %edx,%edi
+     406:	56                   	push   %esi
+     407:	89 c6                	mov    %eax,%esi
+     409:	53                   	push   %ebx
+     40a:	83 ec 5c             	sub    $0x5c,%esp
+     40d:	8b 45 08             	mov    0x8(%ebp),%eax
+     410:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     413:	89 45 b0             	mov    %eax,-0x50(%ebp)
+     416:	89 c2                	mov    %eax,%edx
+     418:	89 4d b4             	mov    %ecx,-0x4c(%ebp)
+     41b:	85 c9                	test   %ecx,%ecx
+     41d:	75 24                	jne    443 <__divmoddi4.part.0+0x43>
+     41f:	85 c0                	test   %eax,%eax
+     421:	0f 85 59 01 00 00    	jne    580 <__divmoddi4.part.0+0x180>
+     427:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+     42b:	0f be 45 e7          	movsbl -0x19(%ebp),%eax
+     42f:	8d 48 01             	lea    0x1(%eax),%ecx
+     432:	83 f9 02             	cmp    $0x2,%ecx
+     435:	0f 47 c2             	cmova  %edx,%eax
+     438:	88 45 e7             	mov    %al,-0x19(%ebp)
+     43b:	85 ff                	test   %edi,%edi
+     43d:	0f 84 6d 01 00 00    	je     5b0 <__divmoddi4.part.0+0x1b0>
+     443:	83 ec 08             	sub    $0x8,%esp
+     446:	ff 75 b4             	push   -0x4c(%ebp)
+     449:	ff 75 b0             	push   -0x50(%ebp)
+     44c:	e8 ef fe ff ff       	call   340 <__clzdi2>
+     451:	5b                   	pop    %ebx
+     452:	5a                   	pop    %edx
+     453:	57                   	push   %edi
+     454:	56                   	push   %esi
+     455:	89 c3                	mov    %eax,%ebx
+     457:	83 c3 01             	add    $0x1,%ebx
+     45a:	e8 e1 fe ff ff       	call   340 <__clzdi2>
+     45f:	89 fa                	mov    %edi,%edx
+     461:	83 c4 10             	add    $0x10,%esp
+     464:	29 c3                	sub    %eax,%ebx
+     466:	89 f0                	mov    %esi,%eax
+     468:	89 d9                	mov    %ebx,%ecx
+     46a:	0f ad d0             	shrd   %cl,%edx,%eax
+     46d:	d3 ea                	shr    %cl,%edx
+     46f:	f6 c1 20             	test   $0x20,%cl
+     472:	74 04                	je     478 <__divmoddi4.part.0+0x78>
+     474:	89 d0                	mov    %edx,%eax
+     476:	31 d2                	xor    %edx,%edx
+     478:	b9 40 00 00 00       	mov    $0x40,%ecx
+     47d:	29 d9                	sub    %ebx,%ecx
+     47f:	0f a5 f7             	shld   %cl,%esi,%edi
+     482:	d3 e6                	shl    %cl,%esi
+     484:	f6 c1 20             	test   $0x20,%cl
+     487:	74 04                	je     48d <__divmoddi4.part.0+0x8d>
+     489:	89 f7                	mov    %esi,%edi
+     48b:	31 f6                	xor    %esi,%esi
+     48d:	8d 4b ff             	lea    -0x1(%ebx),%ecx
+     490:	88 4d d0             	mov    %cl,-0x30(%ebp)
+     493:	84 db                	test   %bl,%bl
+     495:	0f 8e 45 01 00 00    	jle    5e0 <__divmoddi4.part.0+0x1e0>
+     49b:	8b 4d b0             	mov    -0x50(%ebp),%ecx
+     49e:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+     4a1:	c7 45 ac 00 00 00 00 	movl   $0x0,-0x54(%ebp)
+     4a8:	83 c1 ff             	add    $0xffffffff,%ecx
+     4ab:	83 d3 ff             	adc    $0xffffffff,%ebx
+     4ae:	89 4d a0             	mov    %ecx,-0x60(%ebp)
+     4b1:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+     4b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4b8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+     4bc:	01 c0                	add    %eax,%eax
+     4be:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+     4c5:	89 d3                	mov    %edx,%ebx
+     4c7:	89 fa                	mov    %edi,%edx
+     4c9:	89 c1                	mov    %eax,%ecx
+     4cb:	0f a4 f7 01          	shld   $0x1,%esi,%edi
+     4cf:	89 d0                	mov    %edx,%eax
+     4d1:	31 d2                	xor    %edx,%edx
+     4d3:	01 f6                	add    %esi,%esi
+     4d5:	09 da                	or     %ebx,%edx
+     4d7:	89 fb                	mov    %edi,%ebx
+     4d9:	8b 7d ac             	mov    -0x54(%ebp),%edi
+     4dc:	c1 e8 1f             	shr    $0x1f,%eax
+     4df:	09 c8                	or     %ecx,%eax
+     4e1:	89 f1                	mov    %esi,%ecx
+     4e3:	89 55 cc             	mov    %edx,-0x34(%ebp)
+     4e6:	83 e7 01             	and    $0x1,%edi
+     4e9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+     4ec:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     4ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     4f2:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+     4f5:	09 ce                	or     %ecx,%esi
+     4f7:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+     4fa:	09 df                	or     %ebx,%edi
+     4fc:	8b 5d a4             	mov    -0x5c(%ebp),%ebx
+     4ff:	29 c1                	sub    %eax,%ecx
+     501:	8b 45 b0             	mov    -0x50(%ebp),%eax
+     504:	19 d3                	sbb    %edx,%ebx
+     506:	89 ca                	mov    %ecx,%edx
+     508:	89 d9                	mov    %ebx,%ecx
+     50a:	89 5d 9c             	mov    %ebx,-0x64(%ebp)
+     50d:	c1 f9 1f             	sar    $0x1f,%ecx
+     510:	89 55 98             	mov    %edx,-0x68(%ebp)
+     513:	8b 55 cc             	mov    -0x34(%ebp),%edx
+     516:	21 c8                	and    %ecx,%eax
+     518:	89 cb                	mov    %ecx,%ebx
+     51a:	89 4d ac             	mov    %ecx,-0x54(%ebp)
+     51d:	89 45 b8             	mov    %eax,-0x48(%ebp)
+     520:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+     523:	21 c3                	and    %eax,%ebx
+     525:	8b 45 c8             	mov    -0x38(%ebp),%eax
+     528:	2b 45 b8             	sub    -0x48(%ebp),%eax
+     52b:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+     52e:	1b 55 bc             	sbb    -0x44(%ebp),%edx
+     531:	80 6d d0 01          	subb   $0x1,-0x30(%ebp)
+     535:	0f b6 5d d0          	movzbl -0x30(%ebp),%ebx
+     539:	80 fb ff             	cmp    $0xff,%bl
+     53c:	0f 85 76 ff ff ff    	jne    4b8 <__divmoddi4.part.0+0xb8>
+     542:	8b 5d 9c             	mov    -0x64(%ebp),%ebx
+     545:	89 d9                	mov    %ebx,%ecx
+     547:	31 db                	xor    %ebx,%ebx
+     549:	c1 e9 1f             	shr    $0x1f,%ecx
+     54c:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+     54f:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     552:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     555:	85 db                	test   %ebx,%ebx
+     557:	74 08                	je     561 <__divmoddi4.part.0+0x161>
+     559:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     55c:	89 03                	mov    %eax,(%ebx)
+     55e:	89 53 04             	mov    %edx,0x4(%ebx)
+     561:	89 f0                	mov    %esi,%eax
+     563:	89 fa                	mov    %edi,%edx
+     565:	0f a4 f2 01          	shld   $0x1,%esi,%edx
+     569:	01 f0                	add    %esi,%eax
+     56b:	0b 55 d4             	or     -0x2c(%ebp),%edx
+     56e:	0b 45 d0             	or     -0x30(%ebp),%eax
+     571:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     574:	5b                   	pop    %ebx
+     575:	5e                   	pop    %esi
+     576:	5f                   	pop    %edi
+     577:	5d                   	pop    %ebp
+     578:	c3                   	ret
+     579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     580:	8b 45 b0             	mov    -0x50(%ebp),%eax
+     583:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     586:	83 f0 01             	xor    $0x1,%eax
+     589:	09 d0                	or     %edx,%eax
+     58b:	0f 85 aa fe ff ff    	jne    43b <__divmoddi4.part.0+0x3b>
+     591:	8b 55 10             	mov    0x10(%ebp),%edx
+     594:	85 d2                	test   %edx,%edx
+     596:	74 10                	je     5a8 <__divmoddi4.part.0+0x1a8>
+     598:	8b 45 10             	mov    0x10(%ebp),%eax
+     59b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+     5a1:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+     5a8:	89 f0                	mov    %esi,%eax
+     5aa:	89 fa                	mov    %edi,%edx
+     5ac:	eb c3                	jmp    571 <__divmoddi4.part.0+0x171>
+     5ae:	66 90                	xchg   %ax,%ax
+     5b0:	8b 45 10             	mov    0x10(%ebp),%eax
+     5b3:	8b 4d b0             	mov    -0x50(%ebp),%ecx
+     5b6:	85 c0                	test   %eax,%eax
+     5b8:	74 12                	je     5cc <__divmoddi4.part.0+0x1cc>
+     5ba:	89 f0                	mov    %esi,%eax
+     5bc:	31 d2                	xor    %edx,%edx
+     5be:	f7 f1                	div    %ecx
+     5c0:	8b 45 10             	mov    0x10(%ebp),%eax
+     5c3:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+     5ca:	89 10                	mov    %edx,(%eax)
+     5cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5cf:	89 f0                	mov    %esi,%eax
+     5d1:	31 d2                	xor    %edx,%edx
+     5d3:	5b                   	pop    %ebx
+     5d4:	5e                   	pop    %esi
+     5d5:	f7 f1                	div    %ecx
+     5d7:	5f                   	pop    %edi
+     5d8:	31 d2                	xor    %edx,%edx
+     5da:	5d                   	pop    %ebp
+     5db:	c3                   	ret
+     5dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5e0:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+     5e7:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     5ee:	e9 5f ff ff ff       	jmp    552 <__divmoddi4.part.0+0x152>
+     5f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000600 <__ctzsi2>:
+     600:	55                   	push   %ebp
+     601:	31 d2                	xor    %edx,%edx
+     603:	89 e5                	mov    %esp,%ebp
+     605:	53                   	push   %ebx
+     606:	8b 45 08             	mov    0x8(%ebp),%eax
+     609:	66 85 c0             	test   %ax,%ax
+     60c:	0f 94 c2             	sete   %dl
+     60f:	31 db                	xor    %ebx,%ebx
+     611:	c1 e2 04             	shl    $0x4,%edx
+     614:	89 d1                	mov    %edx,%ecx
+     616:	d3 e8                	shr    %cl,%eax
+     618:	84 c0                	test   %al,%al
+     61a:	0f 94 c3             	sete   %bl
+     61d:	c1 e3 03             	shl    $0x3,%ebx
+     620:	89 d9                	mov    %ebx,%ecx
+     622:	01 da                	add    %ebx,%edx
+     624:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     627:	c9                   	leave
+     628:	d3 e8                	shr    %cl,%eax
+     62a:	31 c9                	xor    %ecx,%ecx
+     62c:	a8 0f                	test   $0xf,%al
+     62e:	0f 94 c1             	sete   %cl
+     631:	c1 e1 02             	shl    $0x2,%ecx
+     634:	d3 e8                	shr    %cl,%eax
+     636:	01 ca                	add    %ecx,%edx
+     638:	31 c9                	xor    %ecx,%ecx
+     63a:	a8 03                	test   $0x3,%al
+     63c:	0f 94 c1             	sete   %cl
+     63f:	01 c9                	add    %ecx,%ecx
+     641:	0f a3 c8             	bt     %ecx,%eax
+     644:	0f 93 c0             	setae  %al
+     647:	01 ca                	add    %ecx,%edx
+     649:	0f b6 c0             	movzbl %al,%eax
+     64c:	01 d0                	add    %edx,%eax
+     64e:	c3                   	ret
+     64f:	90                   	nop
+
+00000650 <__ctzdi2>:
+     650:	55                   	push   %ebp
+     651:	89 e5                	mov    %esp,%ebp
+     653:	56                   	push   %esi
+     654:	53                   	push   %ebx
+     655:	8b 45 08             	mov    0x8(%ebp),%eax
+     658:	8b 55 0c             	mov    0xc(%ebp),%edx
+     65b:	85 c0                	test   %eax,%eax
+     65d:	0f 94 c1             	sete   %cl
+     660:	31 db                	xor    %ebx,%ebx
+     662:	0f b6 c9             	movzbl %cl,%ecx
+     665:	c1 e1 05             	shl    $0x5,%ecx
+     668:	0f ad d0             	shrd   %cl,%edx,%eax
+     66b:	d3 ea                	shr    %cl,%edx
+     66d:	f6 c1 20             	test   $0x20,%cl
+     670:	0f 45 c2             	cmovne %edx,%eax
+     673:	0f 45 d3             	cmovne %ebx,%edx
+     676:	0f b7 d8             	movzwl %ax,%ebx
+     679:	83 cb 00             	or     $0x0,%ebx
+     67c:	0f 94 c3             	sete   %bl
+     67f:	0f b6 db             	movzbl %bl,%ebx
+     682:	89 de                	mov    %ebx,%esi
+     684:	c1 e6 04             	shl    $0x4,%esi
+     687:	8d 1c 31             	lea    (%ecx,%esi,1),%ebx
+     68a:	89 f1                	mov    %esi,%ecx
+     68c:	31 f6                	xor    %esi,%esi
+     68e:	0f ad d0             	shrd   %cl,%edx,%eax
+     691:	d3 ea                	shr    %cl,%edx
+     693:	f6 c1 20             	test   $0x20,%cl
+     696:	0f 45 c2             	cmovne %edx,%eax
+     699:	0f 45 d6             	cmovne %esi,%edx
+     69c:	0f b6 c8             	movzbl %al,%ecx
+     69f:	83 c9 00             	or     $0x0,%ecx
+     6a2:	0f 94 c1             	sete   %cl
+     6a5:	31 f6                	xor    %esi,%esi
+     6a7:	0f b6 c9             	movzbl %cl,%ecx
+     6aa:	c1 e1 03             	shl    $0x3,%ecx
+     6ad:	0f ad d0             	shrd   %cl,%edx,%eax
+     6b0:	01 cb                	add    %ecx,%ebx
+     6b2:	d3 ea                	shr    %cl,%edx
+     6b4:	f6 c1 20             	test   $0x20,%cl
+     6b7:	0f 45 c2             	cmovne %edx,%eax
+     6ba:	0f 45 d6             	cmovne %esi,%edx
+     6bd:	89 c1                	mov    %eax,%ecx
+     6bf:	83 e1 0f             	and    $0xf,%ecx
+     6c2:	83 c9 00             	or     $0x0,%ecx
+     6c5:	0f 94 c1             	sete   %cl
+     6c8:	31 f6                	xor    %esi,%esi
+     6ca:	0f b6 c9             	movzbl %cl,%ecx
+     6cd:	c1 e1 02             	shl    $0x2,%ecx
+     6d0:	0f ad d0             	shrd   %cl,%edx,%eax
+     6d3:	01 cb                	add    %ecx,%ebx
+     6d5:	d3 ea                	shr    %cl,%edx
+     6d7:	f6 c1 20             	test   $0x20,%cl
+     6da:	0f 45 c2             	cmovne %edx,%eax
+     6dd:	0f 45 d6             	cmovne %esi,%edx
+     6e0:	89 c1                	mov    %eax,%ecx
+     6e2:	83 e1 03             	and    $0x3,%ecx
+     6e5:	83 c9 00             	or     $0x0,%ecx
+     6e8:	0f 94 c1             	sete   %cl
+     6eb:	0f b6 c9             	movzbl %cl,%ecx
+     6ee:	01 c9                	add    %ecx,%ecx
+     6f0:	0f ad d0             	shrd   %cl,%edx,%eax
+     6f3:	d3 ea                	shr    %cl,%edx
+     6f5:	f6 c1 20             	test   $0x20,%cl
+     6f8:	0f 45 c2             	cmovne %edx,%eax
+     6fb:	01 cb                	add    %ecx,%ebx
+     6fd:	f7 d0                	not    %eax
+     6ff:	83 e0 01             	and    $0x1,%eax
+     702:	01 d8                	add    %ebx,%eax
+     704:	5b                   	pop    %ebx
+     705:	5e                   	pop    %esi
+     706:	5d                   	pop    %ebp
+     707:	c3                   	ret
+     708:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70f:	90                   	nop
+
+00000710 <__divmoddi4>:
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	57                   	push   %edi
+     714:	56                   	push   %esi
+     715:	53                   	push   %ebx
+     716:	8b 45 08             	mov    0x8(%ebp),%eax
+     719:	8b 55 0c             	mov    0xc(%ebp),%edx
+     71c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     71f:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     722:	8b 75 18             	mov    0x18(%ebp),%esi
+     725:	39 d8                	cmp    %ebx,%eax
+     727:	89 d7                	mov    %edx,%edi
+     729:	19 cf                	sbb    %ecx,%edi
+     72b:	72 13                	jb     740 <__divmoddi4+0x30>
+     72d:	89 75 10             	mov    %esi,0x10(%ebp)
+     730:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     733:	89 4d 0c             	mov    %ecx,0xc(%ebp)
+     736:	5b                   	pop    %ebx
+     737:	5e                   	pop    %esi
+     738:	5f                   	pop    %edi
+     739:	5d                   	pop    %ebp
+     73a:	e9 c1 fc ff ff       	jmp    400 <__divmoddi4.part.0>
+     73f:	90                   	nop
+     740:	85 f6                	test   %esi,%esi
+     742:	74 05                	je     749 <__divmoddi4+0x39>
+     744:	89 06                	mov    %eax,(%esi)
+     746:	89 56 04             	mov    %edx,0x4(%esi)
+     749:	5b                   	pop    %ebx
+     74a:	31 c0                	xor    %eax,%eax
+     74c:	5e                   	pop    %esi
+     74d:	31 d2                	xor    %edx,%edx
+     74f:	5f                   	pop    %edi
+     750:	5d                   	pop    %ebp
+     751:	c3                   	ret
+     752:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     759:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000760 <__divdi3>:
+     760:	55                   	push   %ebp
+     761:	89 e5                	mov    %esp,%ebp
+     763:	57                   	push   %edi
+     764:	56                   	push   %esi
+     765:	53                   	push   %ebx
+     766:	83 ec 1c             	sub    $0x1c,%esp
+     769:	8b 55 0c             	mov    0xc(%ebp),%edx
+     76c:	8b 45 08             	mov    0x8(%ebp),%eax
+     76f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     772:	8b 55 14             	mov    0x14(%ebp),%edx
+     775:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     778:	8b 45 10             	mov    0x10(%ebp),%eax
+     77b:	89 d3                	mov    %edx,%ebx
+     77d:	89 d7                	mov    %edx,%edi
+     77f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+     782:	31 d2                	xor    %edx,%edx
+     784:	c1 eb 1f             	shr    $0x1f,%ebx
+     787:	89 c6                	mov    %eax,%esi
+     789:	89 45 d8             	mov    %eax,-0x28(%ebp)
+     78c:	89 d9                	mov    %ebx,%ecx
+     78e:	89 d8                	mov    %ebx,%eax
+     790:	89 d3                	mov    %edx,%ebx
+     792:	f7 d9                	neg    %ecx
+     794:	83 d3 00             	adc    $0x0,%ebx
+     797:	31 f1                	xor    %esi,%ecx
+     799:	f7 db                	neg    %ebx
+     79b:	31 fb                	xor    %edi,%ebx
+     79d:	01 c1                	add    %eax,%ecx
+     79f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     7a2:	11 d3                	adc    %edx,%ebx
+     7a4:	89 ce                	mov    %ecx,%esi
+     7a6:	89 df                	mov    %ebx,%edi
+     7a8:	c1 e8 1f             	shr    $0x1f,%eax
+     7ab:	31 db                	xor    %ebx,%ebx
+     7ad:	89 c1                	mov    %eax,%ecx
+     7af:	89 da                	mov    %ebx,%edx
+     7b1:	f7 d8                	neg    %eax
+     7b3:	83 d2 00             	adc    $0x0,%edx
+     7b6:	33 45 e0             	xor    -0x20(%ebp),%eax
+     7b9:	f7 da                	neg    %edx
+     7bb:	33 55 e4             	xor    -0x1c(%ebp),%edx
+     7be:	01 c8                	add    %ecx,%eax
+     7c0:	11 da                	adc    %ebx,%edx
+     7c2:	89 fb                	mov    %edi,%ebx
+     7c4:	39 f0                	cmp    %esi,%eax
+     7c6:	89 d7                	mov    %edx,%edi
+     7c8:	19 df                	sbb    %ebx,%edi
+     7ca:	72 44                	jb     810 <__divdi3+0xb0>
+     7cc:	83 ec 04             	sub    $0x4,%esp
+     7cf:	6a 00                	push   $0x0
+     7d1:	53                   	push   %ebx
+     7d2:	56                   	push   %esi
+     7d3:	e8 28 fc ff ff       	call   400 <__divmoddi4.part.0>
+     7d8:	83 c4 10             	add    $0x10,%esp
+     7db:	89 c6                	mov    %eax,%esi
+     7dd:	89 d7                	mov    %edx,%edi
+     7df:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     7e2:	33 55 e4             	xor    -0x1c(%ebp),%edx
+     7e5:	31 db                	xor    %ebx,%ebx
+     7e7:	89 d1                	mov    %edx,%ecx
+     7e9:	89 da                	mov    %ebx,%edx
+     7eb:	c1 e9 1f             	shr    $0x1f,%ecx
+     7ee:	89 c8                	mov    %ecx,%eax
+     7f0:	f7 d8                	neg    %eax
+     7f2:	83 d2 00             	adc    $0x0,%edx
+     7f5:	31 f0                	xor    %esi,%eax
+     7f7:	f7 da                	neg    %edx
+     7f9:	31 fa                	xor    %edi,%edx
+     7fb:	01 c8                	add    %ecx,%eax
+     7fd:	11 da                	adc    %ebx,%edx
+     7ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     802:	5b                   	pop    %ebx
+     803:	5e                   	pop    %esi
+     804:	5f                   	pop    %edi
+     805:	5d                   	pop    %ebp
+     806:	c3                   	ret
+     807:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80e:	66 90                	xchg   %ax,%ax
+     810:	31 f6                	xor    %esi,%esi
+     812:	31 ff                	xor    %edi,%edi
+     814:	eb c9                	jmp    7df <__divdi3+0x7f>
+     816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000820 <__ffsdi2>:
+     820:	55                   	push   %ebp
+     821:	89 e5                	mov    %esp,%ebp
+     823:	53                   	push   %ebx
+     824:	83 ec 04             	sub    $0x4,%esp
+     827:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     82a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     82d:	89 da                	mov    %ebx,%edx
+     82f:	09 ca                	or     %ecx,%edx
+     831:	74 1d                	je     850 <__ffsdi2+0x30>
+     833:	83 ec 08             	sub    $0x8,%esp
+     836:	53                   	push   %ebx
+     837:	51                   	push   %ecx
+     838:	e8 13 fe ff ff       	call   650 <__ctzdi2>
+     83d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     840:	83 c4 10             	add    $0x10,%esp
+     843:	c9                   	leave
+     844:	83 c0 01             	add    $0x1,%eax
+     847:	c3                   	ret
+     848:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     84f:	90                   	nop
+     850:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     853:	31 c0                	xor    %eax,%eax
+     855:	c9                   	leave
+     856:	c3                   	ret
+     857:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     85e:	66 90                	xchg   %ax,%ax
+
+00000860 <__lshrdi3>:
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	56                   	push   %esi
+     864:	53                   	push   %ebx
+     865:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     868:	8b 45 08             	mov    0x8(%ebp),%eax
+     86b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     86e:	89 cb                	mov    %ecx,%ebx
+     870:	83 e3 3f             	and    $0x3f,%ebx
+     873:	83 e1 20             	and    $0x20,%ecx
+     876:	74 10                	je     888 <__lshrdi3+0x28>
+     878:	89 d0                	mov    %edx,%eax
+     87a:	8d 4b e0             	lea    -0x20(%ebx),%ecx
+     87d:	31 d2                	xor    %edx,%edx
+     87f:	d3 e8                	shr    %cl,%eax
+     881:	5b                   	pop    %ebx
+     882:	5e                   	pop    %esi
+     883:	5d                   	pop    %ebp
+     884:	c3                   	ret
+     885:	8d 76 00             	lea    0x0(%esi),%esi
+     888:	85 db                	test   %ebx,%ebx
+     88a:	74 f5                	je     881 <__lshrdi3+0x21>
+     88c:	b9 20 00 00 00       	mov    $0x20,%ecx
+     891:	89 d6                	mov    %edx,%esi
+     893:	29 d9                	sub    %ebx,%ecx
+     895:	d3 e6                	shl    %cl,%esi
+     897:	89 d9                	mov    %ebx,%ecx
+     899:	5b                   	pop    %ebx
+     89a:	d3 e8                	shr    %cl,%eax
+     89c:	d3 ea                	shr    %cl,%edx
+     89e:	09 f0                	or     %esi,%eax
+     8a0:	5e                   	pop    %esi
+     8a1:	5d                   	pop    %ebp
+     8a2:	c3                   	ret
+     8a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008b0 <__moddi3>:
+     8b0:	55                   	push   %ebp
+     8b1:	31 d2                	xor    %edx,%edx
+     8b3:	89 e5                	mov    %esp,%ebp
+     8b5:	57                   	push   %edi
+     8b6:	56                   	push   %esi
+     8b7:	53                   	push   %ebx
+     8b8:	89 d3                	mov    %edx,%ebx
+     8ba:	83 ec 2c             	sub    $0x2c,%esp
+     8bd:	8b 45 14             	mov    0x14(%ebp),%eax
+     8c0:	c1 e8 1f             	shr    $0x1f,%eax
+     8c3:	89 c1                	mov    %eax,%ecx
+     8c5:	f7 d9                	neg    %ecx
+     8c7:	83 d3 00             	adc    $0x0,%ebx
+     8ca:	33 4d 10             	xor    0x10(%ebp),%ecx
+     8cd:	f7 db                	neg    %ebx
+     8cf:	33 5d 14             	xor    0x14(%ebp),%ebx
+     8d2:	01 c1                	add    %eax,%ecx
+     8d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8d7:	11 d3                	adc    %edx,%ebx
+     8d9:	31 ff                	xor    %edi,%edi
+     8db:	c1 e8 1f             	shr    $0x1f,%eax
+     8de:	89 fa                	mov    %edi,%edx
+     8e0:	89 c6                	mov    %eax,%esi
+     8e2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     8e5:	f7 d8                	neg    %eax
+     8e7:	83 d2 00             	adc    $0x0,%edx
+     8ea:	33 45 08             	xor    0x8(%ebp),%eax
+     8ed:	f7 da                	neg    %edx
+     8ef:	33 55 0c             	xor    0xc(%ebp),%edx
+     8f2:	01 f0                	add    %esi,%eax
+     8f4:	11 fa                	adc    %edi,%edx
+     8f6:	39 c8                	cmp    %ecx,%eax
+     8f8:	89 d7                	mov    %edx,%edi
+     8fa:	19 df                	sbb    %ebx,%edi
+     8fc:	72 17                	jb     915 <__moddi3+0x65>
+     8fe:	83 ec 04             	sub    $0x4,%esp
+     901:	8d 75 e0             	lea    -0x20(%ebp),%esi
+     904:	56                   	push   %esi
+     905:	53                   	push   %ebx
+     906:	51                   	push   %ecx
+     907:	e8 f4 fa ff ff       	call   400 <__divmoddi4.part.0>
+     90c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     90f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     912:	83 c4 10             	add    $0x10,%esp
+     915:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     918:	31 db                	xor    %ebx,%ebx
+     91a:	89 df                	mov    %ebx,%edi
+     91c:	89 ce                	mov    %ecx,%esi
+     91e:	f7 de                	neg    %esi
+     920:	83 d7 00             	adc    $0x0,%edi
+     923:	31 c6                	xor    %eax,%esi
+     925:	f7 df                	neg    %edi
+     927:	89 f0                	mov    %esi,%eax
+     929:	31 d7                	xor    %edx,%edi
+     92b:	01 c8                	add    %ecx,%eax
+     92d:	89 fa                	mov    %edi,%edx
+     92f:	11 da                	adc    %ebx,%edx
+     931:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     934:	5b                   	pop    %ebx
+     935:	5e                   	pop    %esi
+     936:	5f                   	pop    %edi
+     937:	5d                   	pop    %ebp
+     938:	c3                   	ret
+     939:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000940 <__popcountsi2>:
+     940:	55                   	push   %ebp
+     941:	89 e5                	mov    %esp,%ebp
+     943:	8b 45 08             	mov    0x8(%ebp),%eax
+     946:	5d                   	pop    %ebp
+     947:	89 c2                	mov    %eax,%edx
+     949:	d1 ea                	shr    %edx
+     94b:	81 e2 55 55 55 55    	and    $0x55555555,%edx
+     951:	29 d0                	sub    %edx,%eax
+     953:	89 c2                	mov    %eax,%edx
+     955:	25 33 33 33 33       	and    $0x33333333,%eax
+     95a:	c1 ea 02             	shr    $0x2,%edx
+     95d:	81 e2 33 33 33 33    	and    $0x33333333,%edx
+     963:	01 c2                	add    %eax,%edx
+     965:	89 d0                	mov    %edx,%eax
+     967:	c1 e8 04             	shr    $0x4,%eax
+     96a:	01 d0                	add    %edx,%eax
+     96c:	25 0f 0f 0f 0f       	and    $0xf0f0f0f,%eax
+     971:	89 c2                	mov    %eax,%edx
+     973:	c1 ea 10             	shr    $0x10,%edx
+     976:	01 c2                	add    %eax,%edx
+     978:	89 d0                	mov    %edx,%eax
+     97a:	c1 e8 08             	shr    $0x8,%eax
+     97d:	01 d0                	add    %edx,%eax
+     97f:	83 e0 3f             	and    $0x3f,%eax
+     982:	c3                   	ret
+     983:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     98a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000990 <__popcountdi2>:
+     990:	55                   	push   %ebp
+     991:	89 e5                	mov    %esp,%ebp
+     993:	57                   	push   %edi
+     994:	56                   	push   %esi
+     995:	53                   	push   %ebx
+     996:	83 ec 24             	sub    $0x24,%esp
+     999:	8b 45 08             	mov    0x8(%ebp),%eax
+     99c:	8b 55 0c             	mov    0xc(%ebp),%edx
+     99f:	89 c1                	mov    %eax,%ecx
+     9a1:	89 d3                	mov    %edx,%ebx
+     9a3:	0f ac d1 01          	shrd   $0x1,%edx,%ecx
+     9a7:	d1 eb                	shr    %ebx
+     9a9:	89 cf                	mov    %ecx,%edi
+     9ab:	81 e7 55 55 55 55    	and    $0x55555555,%edi
+     9b1:	89 7d e0             	mov    %edi,-0x20(%ebp)
+     9b4:	89 df                	mov    %ebx,%edi
+     9b6:	81 e7 55 55 55 55    	and    $0x55555555,%edi
+     9bc:	2b 45 e0             	sub    -0x20(%ebp),%eax
+     9bf:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     9c2:	89 c1                	mov    %eax,%ecx
+     9c4:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+     9c7:	0f ac d1 02          	shrd   $0x2,%edx,%ecx
+     9cb:	89 d3                	mov    %edx,%ebx
+     9cd:	89 ce                	mov    %ecx,%esi
+     9cf:	c1 eb 02             	shr    $0x2,%ebx
+     9d2:	81 e6 33 33 33 33    	and    $0x33333333,%esi
+     9d8:	89 df                	mov    %ebx,%edi
+     9da:	89 75 d8             	mov    %esi,-0x28(%ebp)
+     9dd:	89 c6                	mov    %eax,%esi
+     9df:	89 d0                	mov    %edx,%eax
+     9e1:	81 e7 33 33 33 33    	and    $0x33333333,%edi
+     9e7:	81 e6 33 33 33 33    	and    $0x33333333,%esi
+     9ed:	25 33 33 33 33       	and    $0x33333333,%eax
+     9f2:	89 7d dc             	mov    %edi,-0x24(%ebp)
+     9f5:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     9f8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     9fb:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     9fe:	89 75 d0             	mov    %esi,-0x30(%ebp)
+     a01:	03 45 d0             	add    -0x30(%ebp),%eax
+     a04:	89 c1                	mov    %eax,%ecx
+     a06:	13 55 d4             	adc    -0x2c(%ebp),%edx
+     a09:	89 d3                	mov    %edx,%ebx
+     a0b:	0f ac d1 04          	shrd   $0x4,%edx,%ecx
+     a0f:	c1 eb 04             	shr    $0x4,%ebx
+     a12:	01 c1                	add    %eax,%ecx
+     a14:	89 c8                	mov    %ecx,%eax
+     a16:	11 d3                	adc    %edx,%ebx
+     a18:	25 0f 0f 0f 0f       	and    $0xf0f0f0f,%eax
+     a1d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     a20:	89 d8                	mov    %ebx,%eax
+     a22:	25 0f 0f 0f 0f       	and    $0xf0f0f0f,%eax
+     a27:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     a2a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     a2d:	89 d0                	mov    %edx,%eax
+     a2f:	31 d2                	xor    %edx,%edx
+     a31:	03 45 e8             	add    -0x18(%ebp),%eax
+     a34:	13 55 ec             	adc    -0x14(%ebp),%edx
+     a37:	89 c1                	mov    %eax,%ecx
+     a39:	89 d3                	mov    %edx,%ebx
+     a3b:	0f ac d1 10          	shrd   $0x10,%edx,%ecx
+     a3f:	c1 eb 10             	shr    $0x10,%ebx
+     a42:	01 c1                	add    %eax,%ecx
+     a44:	11 d3                	adc    %edx,%ebx
+     a46:	89 c8                	mov    %ecx,%eax
+     a48:	83 c4 24             	add    $0x24,%esp
+     a4b:	0f ac d8 08          	shrd   $0x8,%ebx,%eax
+     a4f:	5b                   	pop    %ebx
+     a50:	5e                   	pop    %esi
+     a51:	01 c8                	add    %ecx,%eax
+     a53:	5f                   	pop    %edi
+     a54:	5d                   	pop    %ebp
+     a55:	83 e0 7f             	and    $0x7f,%eax
+     a58:	c3                   	ret
+     a59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a60 <__udivdi3>:
+     a60:	55                   	push   %ebp
+     a61:	89 e5                	mov    %esp,%ebp
+     a63:	56                   	push   %esi
+     a64:	53                   	push   %ebx
+     a65:	8b 45 08             	mov    0x8(%ebp),%eax
+     a68:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     a6e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     a71:	39 d8                	cmp    %ebx,%eax
+     a73:	89 d6                	mov    %edx,%esi
+     a75:	19 ce                	sbb    %ecx,%esi
+     a77:	72 17                	jb     a90 <__udivdi3+0x30>
+     a79:	c7 45 10 00 00 00 00 	movl   $0x0,0x10(%ebp)
+     a80:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     a83:	89 4d 0c             	mov    %ecx,0xc(%ebp)
+     a86:	5b                   	pop    %ebx
+     a87:	5e                   	pop    %esi
+     a88:	5d                   	pop    %ebp
+     a89:	e9 72 f9 ff ff       	jmp    400 <__divmoddi4.part.0>
+     a8e:	66 90                	xchg   %ax,%ax
+     a90:	5b                   	pop    %ebx
+     a91:	31 c0                	xor    %eax,%eax
+     a93:	31 d2                	xor    %edx,%edx
+     a95:	5e                   	pop    %esi
+     a96:	5d                   	pop    %ebp
+     a97:	c3                   	ret
+     a98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a9f:	90                   	nop
+
+00000aa0 <__umoddi3>:
+     aa0:	55                   	push   %ebp
+     aa1:	89 e5                	mov    %esp,%ebp
+     aa3:	56                   	push   %esi
+     aa4:	53                   	push   %ebx
+     aa5:	83 ec 10             	sub    $0x10,%esp
+     aa8:	8b 45 08             	mov    0x8(%ebp),%eax
+     aab:	8b 55 0c             	mov    0xc(%ebp),%edx
+     aae:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     ab1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+     ab4:	89 d6                	mov    %edx,%esi
+     ab6:	39 c8                	cmp    %ecx,%eax
+     ab8:	19 de                	sbb    %ebx,%esi
+     aba:	72 17                	jb     ad3 <__umoddi3+0x33>
+     abc:	83 ec 04             	sub    $0x4,%esp
+     abf:	8d 75 f0             	lea    -0x10(%ebp),%esi
+     ac2:	56                   	push   %esi
+     ac3:	53                   	push   %ebx
+     ac4:	51                   	push   %ecx
+     ac5:	e8 36 f9 ff ff       	call   400 <__divmoddi4.part.0>
+     aca:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     acd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     ad0:	83 c4 10             	add    $0x10,%esp
+     ad3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ad6:	5b                   	pop    %ebx
+     ad7:	5e                   	pop    %esi
+     ad8:	5d                   	pop    %ebp
+     ad9:	c3                   	ret
+     ada:	66 90                	xchg   %ax,%ax
+     adc:	66 90                	xchg   %ax,%ax
+     ade:	66 90                	xchg   %ax,%ax
+
+00000ae0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     ae0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     ae1:	31 c0                	xor    %eax,%eax
+{
+     ae3:	89 e5                	mov    %esp,%ebp
+     ae5:	53                   	push   %ebx
+     ae6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     ae9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     aec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     af0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     af4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     af7:	83 c0 01             	add    $0x1,%eax
+     afa:	84 d2                	test   %dl,%dl
+     afc:	75 f2                	jne    af0 <strcpy+0x10>
+    ;
+  return os;
+}
+     afe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b01:	89 c8                	mov    %ecx,%eax
+     b03:	c9                   	leave
+     b04:	c3                   	ret
+     b05:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b10 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     b10:	55                   	push   %ebp
+     b11:	89 e5                	mov    %esp,%ebp
+     b13:	53                   	push   %ebx
+     b14:	8b 55 08             	mov    0x8(%ebp),%edx
+     b17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     b1a:	0f b6 02             	movzbl (%edx),%eax
+     b1d:	84 c0                	test   %al,%al
+     b1f:	75 17                	jne    b38 <strcmp+0x28>
+     b21:	eb 3a                	jmp    b5d <strcmp+0x4d>
+     b23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b27:	90                   	nop
+     b28:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     b2c:	83 c2 01             	add    $0x1,%edx
+     b2f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     b32:	84 c0                	test   %al,%al
+     b34:	74 1a                	je     b50 <strcmp+0x40>
+    p++, q++;
+     b36:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     b38:	0f b6 19             	movzbl (%ecx),%ebx
+     b3b:	38 c3                	cmp    %al,%bl
+     b3d:	74 e9                	je     b28 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     b3f:	29 d8                	sub    %ebx,%eax
+}
+     b41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b44:	c9                   	leave
+     b45:	c3                   	ret
+     b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b4d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     b50:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     b54:	31 c0                	xor    %eax,%eax
+     b56:	29 d8                	sub    %ebx,%eax
+}
+     b58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b5b:	c9                   	leave
+     b5c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     b5d:	0f b6 19             	movzbl (%ecx),%ebx
+     b60:	31 c0                	xor    %eax,%eax
+     b62:	eb db                	jmp    b3f <strcmp+0x2f>
+     b64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b6f:	90                   	nop
+
+00000b70 <strlen>:
+
+uint
+strlen(char *s)
+{
+     b70:	55                   	push   %ebp
+     b71:	89 e5                	mov    %esp,%ebp
+     b73:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     b76:	80 3a 00             	cmpb   $0x0,(%edx)
+     b79:	74 15                	je     b90 <strlen+0x20>
+     b7b:	31 c0                	xor    %eax,%eax
+     b7d:	8d 76 00             	lea    0x0(%esi),%esi
+     b80:	83 c0 01             	add    $0x1,%eax
+     b83:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     b87:	89 c1                	mov    %eax,%ecx
+     b89:	75 f5                	jne    b80 <strlen+0x10>
+    ;
+  return n;
+}
+     b8b:	89 c8                	mov    %ecx,%eax
+     b8d:	5d                   	pop    %ebp
+     b8e:	c3                   	ret
+     b8f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     b90:	31 c9                	xor    %ecx,%ecx
+}
+     b92:	5d                   	pop    %ebp
+     b93:	89 c8                	mov    %ecx,%eax
+     b95:	c3                   	ret
+     b96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ba0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     ba0:	55                   	push   %ebp
+     ba1:	89 e5                	mov    %esp,%ebp
+     ba3:	57                   	push   %edi
+     ba4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     ba7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     baa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bad:	89 d7                	mov    %edx,%edi
+     baf:	fc                   	cld
+     bb0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     bb2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     bb5:	89 d0                	mov    %edx,%eax
+     bb7:	c9                   	leave
+     bb8:	c3                   	ret
+     bb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000bc0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     bc0:	55                   	push   %ebp
+     bc1:	89 e5                	mov    %esp,%ebp
+     bc3:	8b 45 08             	mov    0x8(%ebp),%eax
+     bc6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     bca:	0f b6 10             	movzbl (%eax),%edx
+     bcd:	84 d2                	test   %dl,%dl
+     bcf:	75 12                	jne    be3 <strchr+0x23>
+     bd1:	eb 1d                	jmp    bf0 <strchr+0x30>
+     bd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bd7:	90                   	nop
+     bd8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     bdc:	83 c0 01             	add    $0x1,%eax
+     bdf:	84 d2                	test   %dl,%dl
+     be1:	74 0d                	je     bf0 <strchr+0x30>
+    if(*s == c)
+     be3:	38 d1                	cmp    %dl,%cl
+     be5:	75 f1                	jne    bd8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     be7:	5d                   	pop    %ebp
+     be8:	c3                   	ret
+     be9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     bf0:	31 c0                	xor    %eax,%eax
+}
+     bf2:	5d                   	pop    %ebp
+     bf3:	c3                   	ret
+     bf4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bff:	90                   	nop
+
+00000c00 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     c00:	55                   	push   %ebp
+     c01:	89 e5                	mov    %esp,%ebp
+     c03:	57                   	push   %edi
+     c04:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     c05:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     c08:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     c09:	31 db                	xor    %ebx,%ebx
+{
+     c0b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     c0e:	eb 27                	jmp    c37 <gets+0x37>
+    cc = read(0, &c, 1);
+     c10:	83 ec 04             	sub    $0x4,%esp
+     c13:	6a 01                	push   $0x1
+     c15:	56                   	push   %esi
+     c16:	6a 00                	push   $0x0
+     c18:	e8 1e 01 00 00       	call   d3b <read>
+    if(cc < 1)
+     c1d:	83 c4 10             	add    $0x10,%esp
+     c20:	85 c0                	test   %eax,%eax
+     c22:	7e 1d                	jle    c41 <gets+0x41>
+      break;
+    buf[i++] = c;
+     c24:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     c28:	8b 55 08             	mov    0x8(%ebp),%edx
+     c2b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     c2f:	3c 0a                	cmp    $0xa,%al
+     c31:	74 10                	je     c43 <gets+0x43>
+     c33:	3c 0d                	cmp    $0xd,%al
+     c35:	74 0c                	je     c43 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     c37:	89 df                	mov    %ebx,%edi
+     c39:	83 c3 01             	add    $0x1,%ebx
+     c3c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     c3f:	7c cf                	jl     c10 <gets+0x10>
+     c41:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     c43:	8b 45 08             	mov    0x8(%ebp),%eax
+     c46:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     c4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c4d:	5b                   	pop    %ebx
+     c4e:	5e                   	pop    %esi
+     c4f:	5f                   	pop    %edi
+     c50:	5d                   	pop    %ebp
+     c51:	c3                   	ret
+     c52:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000c60 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     c60:	55                   	push   %ebp
+     c61:	89 e5                	mov    %esp,%ebp
+     c63:	56                   	push   %esi
+     c64:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     c65:	83 ec 08             	sub    $0x8,%esp
+     c68:	6a 00                	push   $0x0
+     c6a:	ff 75 08             	push   0x8(%ebp)
+     c6d:	e8 f1 00 00 00       	call   d63 <open>
+  if(fd < 0)
+     c72:	83 c4 10             	add    $0x10,%esp
+     c75:	85 c0                	test   %eax,%eax
+     c77:	78 27                	js     ca0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     c79:	83 ec 08             	sub    $0x8,%esp
+     c7c:	ff 75 0c             	push   0xc(%ebp)
+     c7f:	89 c3                	mov    %eax,%ebx
+     c81:	50                   	push   %eax
+     c82:	e8 f4 00 00 00       	call   d7b <fstat>
+  close(fd);
+     c87:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     c8a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     c8c:	e8 ba 00 00 00       	call   d4b <close>
+  return r;
+     c91:	83 c4 10             	add    $0x10,%esp
+}
+     c94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c97:	89 f0                	mov    %esi,%eax
+     c99:	5b                   	pop    %ebx
+     c9a:	5e                   	pop    %esi
+     c9b:	5d                   	pop    %ebp
+     c9c:	c3                   	ret
+     c9d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     ca0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     ca5:	eb ed                	jmp    c94 <stat+0x34>
+     ca7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cae:	66 90                	xchg   %ax,%ax
+
+00000cb0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	53                   	push   %ebx
+     cb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     cb7:	0f be 02             	movsbl (%edx),%eax
+     cba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     cbd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     cc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     cc5:	77 1e                	ja     ce5 <atoi+0x35>
+     cc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     cd0:	83 c2 01             	add    $0x1,%edx
+     cd3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     cd6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     cda:	0f be 02             	movsbl (%edx),%eax
+     cdd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     ce0:	80 fb 09             	cmp    $0x9,%bl
+     ce3:	76 eb                	jbe    cd0 <atoi+0x20>
+  return n;
+}
+     ce5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ce8:	89 c8                	mov    %ecx,%eax
+     cea:	c9                   	leave
+     ceb:	c3                   	ret
+     cec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000cf0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     cf0:	55                   	push   %ebp
+     cf1:	89 e5                	mov    %esp,%ebp
+     cf3:	57                   	push   %edi
+     cf4:	56                   	push   %esi
+     cf5:	8b 45 10             	mov    0x10(%ebp),%eax
+     cf8:	8b 55 08             	mov    0x8(%ebp),%edx
+     cfb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     cfe:	85 c0                	test   %eax,%eax
+     d00:	7e 13                	jle    d15 <memmove+0x25>
+     d02:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     d04:	89 d7                	mov    %edx,%edi
+     d06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d0d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     d10:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     d11:	39 f8                	cmp    %edi,%eax
+     d13:	75 fb                	jne    d10 <memmove+0x20>
+  return vdst;
+}
+     d15:	5e                   	pop    %esi
+     d16:	89 d0                	mov    %edx,%eax
+     d18:	5f                   	pop    %edi
+     d19:	5d                   	pop    %ebp
+     d1a:	c3                   	ret
+
+00000d1b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     d1b:	b8 01 00 00 00       	mov    $0x1,%eax
+     d20:	cd 40                	int    $0x40
+     d22:	c3                   	ret
+
+00000d23 <exit>:
+SYSCALL(exit)
+     d23:	b8 02 00 00 00       	mov    $0x2,%eax
+     d28:	cd 40                	int    $0x40
+     d2a:	c3                   	ret
+
+00000d2b <wait>:
+SYSCALL(wait)
+     d2b:	b8 03 00 00 00       	mov    $0x3,%eax
+     d30:	cd 40                	int    $0x40
+     d32:	c3                   	ret
+
+00000d33 <pipe>:
+SYSCALL(pipe)
+     d33:	b8 04 00 00 00       	mov    $0x4,%eax
+     d38:	cd 40                	int    $0x40
+     d3a:	c3                   	ret
+
+00000d3b <read>:
+SYSCALL(read)
+     d3b:	b8 05 00 00 00       	mov    $0x5,%eax
+     d40:	cd 40                	int    $0x40
+     d42:	c3                   	ret
+
+00000d43 <write>:
+SYSCALL(write)
+     d43:	b8 10 00 00 00       	mov    $0x10,%eax
+     d48:	cd 40                	int    $0x40
+     d4a:	c3                   	ret
+
+00000d4b <close>:
+SYSCALL(close)
+     d4b:	b8 15 00 00 00       	mov    $0x15,%eax
+     d50:	cd 40                	int    $0x40
+     d52:	c3                   	ret
+
+00000d53 <kill>:
+SYSCALL(kill)
+     d53:	b8 06 00 00 00       	mov    $0x6,%eax
+     d58:	cd 40                	int    $0x40
+     d5a:	c3                   	ret
+
+00000d5b <exec>:
+SYSCALL(exec)
+     d5b:	b8 07 00 00 00       	mov    $0x7,%eax
+     d60:	cd 40                	int    $0x40
+     d62:	c3                   	ret
+
+00000d63 <open>:
+SYSCALL(open)
+     d63:	b8 0f 00 00 00       	mov    $0xf,%eax
+     d68:	cd 40                	int    $0x40
+     d6a:	c3                   	ret
+
+00000d6b <mknod>:
+SYSCALL(mknod)
+     d6b:	b8 11 00 00 00       	mov    $0x11,%eax
+     d70:	cd 40                	int    $0x40
+     d72:	c3                   	ret
+
+00000d73 <unlink>:
+SYSCALL(unlink)
+     d73:	b8 12 00 00 00       	mov    $0x12,%eax
+     d78:	cd 40                	int    $0x40
+     d7a:	c3                   	ret
+
+00000d7b <fstat>:
+SYSCALL(fstat)
+     d7b:	b8 08 00 00 00       	mov    $0x8,%eax
+     d80:	cd 40                	int    $0x40
+     d82:	c3                   	ret
+
+00000d83 <link>:
+SYSCALL(link)
+     d83:	b8 13 00 00 00       	mov    $0x13,%eax
+     d88:	cd 40                	int    $0x40
+     d8a:	c3                   	ret
+
+00000d8b <mkdir>:
+SYSCALL(mkdir)
+     d8b:	b8 14 00 00 00       	mov    $0x14,%eax
+     d90:	cd 40                	int    $0x40
+     d92:	c3                   	ret
+
+00000d93 <chdir>:
+SYSCALL(chdir)
+     d93:	b8 09 00 00 00       	mov    $0x9,%eax
+     d98:	cd 40                	int    $0x40
+     d9a:	c3                   	ret
+
+00000d9b <dup>:
+SYSCALL(dup)
+     d9b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     da0:	cd 40                	int    $0x40
+     da2:	c3                   	ret
+
+00000da3 <getpid>:
+SYSCALL(getpid)
+     da3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     da8:	cd 40                	int    $0x40
+     daa:	c3                   	ret
+
+00000dab <sbrk>:
+SYSCALL(sbrk)
+     dab:	b8 0c 00 00 00       	mov    $0xc,%eax
+     db0:	cd 40                	int    $0x40
+     db2:	c3                   	ret
+
+00000db3 <sleep>:
+SYSCALL(sleep)
+     db3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     db8:	cd 40                	int    $0x40
+     dba:	c3                   	ret
+
+00000dbb <uptime>:
+SYSCALL(uptime)
+     dbb:	b8 0e 00 00 00       	mov    $0xe,%eax
+     dc0:	cd 40                	int    $0x40
+     dc2:	c3                   	ret
+
+00000dc3 <trace>:
+SYSCALL(trace)
+     dc3:	b8 16 00 00 00       	mov    $0x16,%eax
+     dc8:	cd 40                	int    $0x40
+     dca:	c3                   	ret
+
+00000dcb <csinfo>:
+SYSCALL(csinfo)
+     dcb:	b8 17 00 00 00       	mov    $0x17,%eax
+     dd0:	cd 40                	int    $0x40
+     dd2:	c3                   	ret
+
+00000dd3 <settickets>:
+SYSCALL(settickets)
+     dd3:	b8 18 00 00 00       	mov    $0x18,%eax
+     dd8:	cd 40                	int    $0x40
+     dda:	c3                   	ret
+
+00000ddb <getprocessesinfo>:
+SYSCALL(getprocessesinfo)
+     ddb:	b8 19 00 00 00       	mov    $0x19,%eax
+     de0:	cd 40                	int    $0x40
+     de2:	c3                   	ret
+
+00000de3 <yield>:
+SYSCALL(yield)
+     de3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     de8:	cd 40                	int    $0x40
+     dea:	c3                   	ret
+
+00000deb <random>:
+SYSCALL(random)
+     deb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     df0:	cd 40                	int    $0x40
+     df2:	c3                   	ret
+
+00000df3 <dumppagetable>:
+SYSCALL(dumppagetable)
+     df3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     df8:	cd 40                	int    $0x40
+     dfa:	c3                   	ret
+
+00000dfb <getcpusinfo>:
+SYSCALL(getcpusinfo)
+     dfb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     e00:	cd 40                	int    $0x40
+     e02:	c3                   	ret
+
+00000e03 <setsched>:
+SYSCALL(setsched)
+     e03:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     e08:	cd 40                	int    $0x40
+     e0a:	c3                   	ret
+
+00000e0b <getbcacheinfo>:
+SYSCALL(getbcacheinfo)
+     e0b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     e10:	cd 40                	int    $0x40
+     e12:	c3                   	ret
+
+00000e13 <getballocinfo>:
+SYSCALL(getballocinfo)
+     e13:	b8 20 00 00 00       	mov    $0x20,%eax
+     e18:	cd 40                	int    $0x40
+     e1a:	c3                   	ret
+
+00000e1b <getfaultinfo>:
+SYSCALL(getfaultinfo)
+     e1b:	b8 21 00 00 00       	mov    $0x21,%eax
+     e20:	cd 40                	int    $0x40
+     e22:	c3                   	ret
+     e23:	66 90                	xchg   %ax,%ax
+     e25:	66 90                	xchg   %ax,%ax
+     e27:	66 90                	xchg   %ax,%ax
+     e29:	66 90                	xchg   %ax,%ax
+     e2b:	66 90                	xchg   %ax,%ax
+     e2d:	66 90                	xchg   %ax,%ax
+     e2f:	90                   	nop
+
+00000e30 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     e30:	55                   	push   %ebp
+     e31:	89 e5                	mov    %esp,%ebp
+     e33:	57                   	push   %edi
+     e34:	56                   	push   %esi
+     e35:	53                   	push   %ebx
+     e36:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     e38:	89 d1                	mov    %edx,%ecx
+{
+     e3a:	83 ec 3c             	sub    $0x3c,%esp
+     e3d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     e40:	85 d2                	test   %edx,%edx
+     e42:	0f 89 80 00 00 00    	jns    ec8 <printint+0x98>
+     e48:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     e4c:	74 7a                	je     ec8 <printint+0x98>
+    x = -xx;
+     e4e:	f7 d9                	neg    %ecx
+    neg = 1;
+     e50:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     e55:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     e58:	31 f6                	xor    %esi,%esi
+     e5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     e60:	89 c8                	mov    %ecx,%eax
+     e62:	31 d2                	xor    %edx,%edx
+     e64:	89 f7                	mov    %esi,%edi
+     e66:	f7 f3                	div    %ebx
+     e68:	8d 76 01             	lea    0x1(%esi),%esi
+     e6b:	0f b6 92 1c 13 00 00 	movzbl 0x131c(%edx),%edx
+     e72:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     e76:	89 ca                	mov    %ecx,%edx
+     e78:	89 c1                	mov    %eax,%ecx
+     e7a:	39 da                	cmp    %ebx,%edx
+     e7c:	73 e2                	jae    e60 <printint+0x30>
+  if(neg)
+     e7e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     e81:	85 c0                	test   %eax,%eax
+     e83:	74 07                	je     e8c <printint+0x5c>
+    buf[i++] = '-';
+     e85:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     e8a:	89 f7                	mov    %esi,%edi
+     e8c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     e8f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     e92:	01 df                	add    %ebx,%edi
+     e94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     e98:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     e9b:	83 ec 04             	sub    $0x4,%esp
+     e9e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     ea1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     ea4:	6a 01                	push   $0x1
+     ea6:	50                   	push   %eax
+     ea7:	56                   	push   %esi
+     ea8:	e8 96 fe ff ff       	call   d43 <write>
+  while(--i >= 0)
+     ead:	89 f8                	mov    %edi,%eax
+     eaf:	83 c4 10             	add    $0x10,%esp
+     eb2:	83 ef 01             	sub    $0x1,%edi
+     eb5:	39 d8                	cmp    %ebx,%eax
+     eb7:	75 df                	jne    e98 <printint+0x68>
+}
+     eb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ebc:	5b                   	pop    %ebx
+     ebd:	5e                   	pop    %esi
+     ebe:	5f                   	pop    %edi
+     ebf:	5d                   	pop    %ebp
+     ec0:	c3                   	ret
+     ec1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     ec8:	31 c0                	xor    %eax,%eax
+     eca:	eb 89                	jmp    e55 <printint+0x25>
+     ecc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ed0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     ed0:	55                   	push   %ebp
+     ed1:	89 e5                	mov    %esp,%ebp
+     ed3:	57                   	push   %edi
+     ed4:	56                   	push   %esi
+     ed5:	53                   	push   %ebx
+     ed6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     ed9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     edc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     edf:	0f b6 1e             	movzbl (%esi),%ebx
+     ee2:	83 c6 01             	add    $0x1,%esi
+     ee5:	84 db                	test   %bl,%bl
+     ee7:	74 67                	je     f50 <printf+0x80>
+     ee9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     eec:	31 d2                	xor    %edx,%edx
+     eee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     ef1:	eb 34                	jmp    f27 <printf+0x57>
+     ef3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ef7:	90                   	nop
+     ef8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     efb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     f00:	83 f8 25             	cmp    $0x25,%eax
+     f03:	74 18                	je     f1d <printf+0x4d>
+  write(fd, &c, 1);
+     f05:	83 ec 04             	sub    $0x4,%esp
+     f08:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     f0b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     f0e:	6a 01                	push   $0x1
+     f10:	50                   	push   %eax
+     f11:	57                   	push   %edi
+     f12:	e8 2c fe ff ff       	call   d43 <write>
+     f17:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     f1a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     f1d:	0f b6 1e             	movzbl (%esi),%ebx
+     f20:	83 c6 01             	add    $0x1,%esi
+     f23:	84 db                	test   %bl,%bl
+     f25:	74 29                	je     f50 <printf+0x80>
+    c = fmt[i] & 0xff;
+     f27:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     f2a:	85 d2                	test   %edx,%edx
+     f2c:	74 ca                	je     ef8 <printf+0x28>
+      }
+    } else if(state == '%'){
+     f2e:	83 fa 25             	cmp    $0x25,%edx
+     f31:	75 ea                	jne    f1d <printf+0x4d>
+      if(c == 'd'){
+     f33:	83 f8 25             	cmp    $0x25,%eax
+     f36:	0f 84 24 01 00 00    	je     1060 <printf+0x190>
+     f3c:	83 e8 63             	sub    $0x63,%eax
+     f3f:	83 f8 15             	cmp    $0x15,%eax
+     f42:	77 1c                	ja     f60 <printf+0x90>
+     f44:	ff 24 85 c4 12 00 00 	jmp    *0x12c4(,%eax,4)
+     f4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f4f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     f50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f53:	5b                   	pop    %ebx
+     f54:	5e                   	pop    %esi
+     f55:	5f                   	pop    %edi
+     f56:	5d                   	pop    %ebp
+     f57:	c3                   	ret
+     f58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f5f:	90                   	nop
+  write(fd, &c, 1);
+     f60:	83 ec 04             	sub    $0x4,%esp
+     f63:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     f66:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     f6a:	6a 01                	push   $0x1
+     f6c:	52                   	push   %edx
+     f6d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     f70:	57                   	push   %edi
+     f71:	e8 cd fd ff ff       	call   d43 <write>
+     f76:	83 c4 0c             	add    $0xc,%esp
+     f79:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     f7c:	6a 01                	push   $0x1
+     f7e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     f81:	52                   	push   %edx
+     f82:	57                   	push   %edi
+     f83:	e8 bb fd ff ff       	call   d43 <write>
+        putc(fd, c);
+     f88:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     f8b:	31 d2                	xor    %edx,%edx
+     f8d:	eb 8e                	jmp    f1d <printf+0x4d>
+     f8f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     f90:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     f93:	83 ec 0c             	sub    $0xc,%esp
+     f96:	b9 10 00 00 00       	mov    $0x10,%ecx
+     f9b:	8b 13                	mov    (%ebx),%edx
+     f9d:	6a 00                	push   $0x0
+     f9f:	89 f8                	mov    %edi,%eax
+        ap++;
+     fa1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     fa4:	e8 87 fe ff ff       	call   e30 <printint>
+        ap++;
+     fa9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     fac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     faf:	31 d2                	xor    %edx,%edx
+     fb1:	e9 67 ff ff ff       	jmp    f1d <printf+0x4d>
+     fb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fbd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     fc0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     fc3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     fc5:	83 c0 04             	add    $0x4,%eax
+     fc8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     fcb:	85 db                	test   %ebx,%ebx
+     fcd:	0f 84 9d 00 00 00    	je     1070 <printf+0x1a0>
+        while(*s != 0){
+     fd3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     fd6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     fd8:	84 c0                	test   %al,%al
+     fda:	0f 84 3d ff ff ff    	je     f1d <printf+0x4d>
+     fe0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     fe3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     fe6:	89 de                	mov    %ebx,%esi
+     fe8:	89 d3                	mov    %edx,%ebx
+     fea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     ff0:	83 ec 04             	sub    $0x4,%esp
+     ff3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     ff6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     ff9:	6a 01                	push   $0x1
+     ffb:	53                   	push   %ebx
+     ffc:	57                   	push   %edi
+     ffd:	e8 41 fd ff ff       	call   d43 <write>
+        while(*s != 0){
+    1002:	0f b6 06             	movzbl (%esi),%eax
+    1005:	83 c4 10             	add    $0x10,%esp
+    1008:	84 c0                	test   %al,%al
+    100a:	75 e4                	jne    ff0 <printf+0x120>
+      state = 0;
+    100c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    100f:	31 d2                	xor    %edx,%edx
+    1011:	e9 07 ff ff ff       	jmp    f1d <printf+0x4d>
+    1016:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    101d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1020:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1023:	83 ec 0c             	sub    $0xc,%esp
+    1026:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    102b:	8b 13                	mov    (%ebx),%edx
+    102d:	6a 01                	push   $0x1
+    102f:	e9 6b ff ff ff       	jmp    f9f <printf+0xcf>
+    1034:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1038:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    103b:	83 ec 04             	sub    $0x4,%esp
+    103e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1041:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1043:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1046:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1049:	6a 01                	push   $0x1
+    104b:	52                   	push   %edx
+    104c:	57                   	push   %edi
+    104d:	e8 f1 fc ff ff       	call   d43 <write>
+        ap++;
+    1052:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1055:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1058:	31 d2                	xor    %edx,%edx
+    105a:	e9 be fe ff ff       	jmp    f1d <printf+0x4d>
+    105f:	90                   	nop
+  write(fd, &c, 1);
+    1060:	83 ec 04             	sub    $0x4,%esp
+    1063:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1066:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1069:	6a 01                	push   $0x1
+    106b:	e9 11 ff ff ff       	jmp    f81 <printf+0xb1>
+    1070:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1075:	bb bb 12 00 00       	mov    $0x12bb,%ebx
+    107a:	e9 61 ff ff ff       	jmp    fe0 <printf+0x110>
+    107f:	90                   	nop
+
+00001080 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1080:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1081:	a1 e0 1a 00 00       	mov    0x1ae0,%eax
+{
+    1086:	89 e5                	mov    %esp,%ebp
+    1088:	57                   	push   %edi
+    1089:	56                   	push   %esi
+    108a:	53                   	push   %ebx
+    108b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    108e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1091:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1098:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    109a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    109c:	39 ca                	cmp    %ecx,%edx
+    109e:	73 30                	jae    10d0 <free+0x50>
+    10a0:	39 c1                	cmp    %eax,%ecx
+    10a2:	72 04                	jb     10a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    10a4:	39 c2                	cmp    %eax,%edx
+    10a6:	72 f0                	jb     1098 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    10a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    10ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    10ae:	39 f8                	cmp    %edi,%eax
+    10b0:	74 2e                	je     10e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    10b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    10b5:	8b 42 04             	mov    0x4(%edx),%eax
+    10b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    10bb:	39 f1                	cmp    %esi,%ecx
+    10bd:	74 38                	je     10f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    10bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    10c1:	5b                   	pop    %ebx
+  freep = p;
+    10c2:	89 15 e0 1a 00 00    	mov    %edx,0x1ae0
+}
+    10c8:	5e                   	pop    %esi
+    10c9:	5f                   	pop    %edi
+    10ca:	5d                   	pop    %ebp
+    10cb:	c3                   	ret
+    10cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    10d0:	39 c1                	cmp    %eax,%ecx
+    10d2:	72 d0                	jb     10a4 <free+0x24>
+    10d4:	eb c2                	jmp    1098 <free+0x18>
+    10d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    10e0:	03 70 04             	add    0x4(%eax),%esi
+    10e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    10e6:	8b 02                	mov    (%edx),%eax
+    10e8:	8b 00                	mov    (%eax),%eax
+    10ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    10ed:	8b 42 04             	mov    0x4(%edx),%eax
+    10f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    10f3:	39 f1                	cmp    %esi,%ecx
+    10f5:	75 c8                	jne    10bf <free+0x3f>
+    p->s.size += bp->s.size;
+    10f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    10fa:	89 15 e0 1a 00 00    	mov    %edx,0x1ae0
+    p->s.size += bp->s.size;
+    1100:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1103:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1106:	89 0a                	mov    %ecx,(%edx)
+}
+    1108:	5b                   	pop    %ebx
+    1109:	5e                   	pop    %esi
+    110a:	5f                   	pop    %edi
+    110b:	5d                   	pop    %ebp
+    110c:	c3                   	ret
+    110d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001110 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	57                   	push   %edi
+    1114:	56                   	push   %esi
+    1115:	53                   	push   %ebx
+    1116:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1119:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    111c:	8b 15 e0 1a 00 00    	mov    0x1ae0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1122:	8d 78 07             	lea    0x7(%eax),%edi
+    1125:	c1 ef 03             	shr    $0x3,%edi
+    1128:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    112b:	85 d2                	test   %edx,%edx
+    112d:	0f 84 8d 00 00 00    	je     11c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1133:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1135:	8b 48 04             	mov    0x4(%eax),%ecx
+    1138:	39 f9                	cmp    %edi,%ecx
+    113a:	73 64                	jae    11a0 <malloc+0x90>
+  if(nu < 4096)
+    113c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1141:	39 df                	cmp    %ebx,%edi
+    1143:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1146:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    114d:	eb 0a                	jmp    1159 <malloc+0x49>
+    114f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1150:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1152:	8b 48 04             	mov    0x4(%eax),%ecx
+    1155:	39 f9                	cmp    %edi,%ecx
+    1157:	73 47                	jae    11a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1159:	89 c2                	mov    %eax,%edx
+    115b:	39 05 e0 1a 00 00    	cmp    %eax,0x1ae0
+    1161:	75 ed                	jne    1150 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1163:	83 ec 0c             	sub    $0xc,%esp
+    1166:	56                   	push   %esi
+    1167:	e8 3f fc ff ff       	call   dab <sbrk>
+  if(p == (char*)-1)
+    116c:	83 c4 10             	add    $0x10,%esp
+    116f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1172:	74 1c                	je     1190 <malloc+0x80>
+  hp->s.size = nu;
+    1174:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1177:	83 ec 0c             	sub    $0xc,%esp
+    117a:	83 c0 08             	add    $0x8,%eax
+    117d:	50                   	push   %eax
+    117e:	e8 fd fe ff ff       	call   1080 <free>
+  return freep;
+    1183:	8b 15 e0 1a 00 00    	mov    0x1ae0,%edx
+      if((p = morecore(nunits)) == 0)
+    1189:	83 c4 10             	add    $0x10,%esp
+    118c:	85 d2                	test   %edx,%edx
+    118e:	75 c0                	jne    1150 <malloc+0x40>
+        return 0;
+  }
+}
+    1190:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1193:	31 c0                	xor    %eax,%eax
+}
+    1195:	5b                   	pop    %ebx
+    1196:	5e                   	pop    %esi
+    1197:	5f                   	pop    %edi
+    1198:	5d                   	pop    %ebp
+    1199:	c3                   	ret
+    119a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    11a0:	39 cf                	cmp    %ecx,%edi
+    11a2:	74 4c                	je     11f0 <malloc+0xe0>
+        p->s.size -= nunits;
+    11a4:	29 f9                	sub    %edi,%ecx
+    11a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    11a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    11ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    11af:	89 15 e0 1a 00 00    	mov    %edx,0x1ae0
+}
+    11b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    11b8:	83 c0 08             	add    $0x8,%eax
+}
+    11bb:	5b                   	pop    %ebx
+    11bc:	5e                   	pop    %esi
+    11bd:	5f                   	pop    %edi
+    11be:	5d                   	pop    %ebp
+    11bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    11c0:	c7 05 e0 1a 00 00 e4 	movl   $0x1ae4,0x1ae0
+    11c7:	1a 00 00 
+    base.s.size = 0;
+    11ca:	b8 e4 1a 00 00       	mov    $0x1ae4,%eax
+    base.s.ptr = freep = prevp = &base;
+    11cf:	c7 05 e4 1a 00 00 e4 	movl   $0x1ae4,0x1ae4
+    11d6:	1a 00 00 
+    base.s.size = 0;
+    11d9:	c7 05 e8 1a 00 00 00 	movl   $0x0,0x1ae8
+    11e0:	00 00 00 
+    if(p->s.size >= nunits){
+    11e3:	e9 54 ff ff ff       	jmp    113c <malloc+0x2c>
+    11e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    11f0:	8b 08                	mov    (%eax),%ecx
+    11f2:	89 0a                	mov    %ecx,(%edx)
+    11f4:	eb b9                	jmp    11af <malloc+0x9f>
@@ -0,0 +1,74 @@
+// Buffer cache benchmark.
+// Writes a file, then has one reader per CPU read it over and
+// over (like stressfs, but reading) and reports the buffer
+// cache hit rate and the average cycles bget() spent per lookup.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+#include "param.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "buf.h"
+#include "arith64.c"
+
+#define NBLOCKS 100
+#define NREAD   20
+
+char data[BSIZE];
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i, j, nreaders;
+  uint start, elapsed, gets, hits;
+  struct bcache_info before, after;
+  char *path = "bcachebench.data";
+
+  nreaders = NCPU;
+  if(argc > 1)
+    nreaders = atoi(argv[1]);
+
+  memset(data, 'a', sizeof(data));
+  fd = open(path, O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "bcachebench: cannot create %s\n", path);
+    exit();
+  }
+  for(i = 0; i < NBLOCKS; i++)
+    if(write(fd, data, sizeof(data)) != sizeof(data)){
+      printf(1, "bcachebench: write failed\n");
+      exit();
+    }
+  close(fd);
+
+  getbcacheinfo(&before);
+  start = uptime();
+  for(i = 0; i < nreaders; i++){
+    if(fork() == 0){
+      for(j = 0; j < NREAD; j++){
+        fd = open(path, O_RDONLY);
+        while(read(fd, data, sizeof(data)) == sizeof(data))
+          ;
+        close(fd);
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < nreaders; i++)
+    wait();
+  elapsed = uptime() - start;
+  getbcacheinfo(&after);
+  unlink(path);
+
+  gets = after.gets - before.gets;
+  hits = after.hits - before.hits;
+  printf(1, "bcachebench: %d readers x %d passes over %d blocks, %d buffers, %d ticks\n",
+         nreaders, NREAD, NBLOCKS, after.nbuf, elapsed);
+  if(gets > 0)
+    printf(1, "bget: %d calls, %d%% hits, %d cycles/call\n",
+           gets, hits * 100 / gets, (uint)((after.cycles - before.cycles) / gets));
+  exit();
+}
@@ -1,9 +1,13 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
-// cached copies of disk block contents.  Caching disk blocks
-// in memory reduces the number of disk reads and also provides
-// a synchronization point for disk blocks used by multiple processes.
+// The buffer cache is a hash table of buf structures holding
+// cached copies of disk block contents.  The block data lives in
+// pages from kalloc(), BPP blocks to a page: the cache grows a
+// page at a time on misses while free memory is plentiful, and
+// kalloc() calls bshrink() to take unused pages back when memory
+// runs low.  Caching disk blocks in memory reduces the number of
+// disk reads and also provides a synchronization point for disk
+// blocks used by multiple processes.
 //
 // Interface:
 // * To get a buffer for a particular disk block, call bread.
@@ -12,26 +16,60 @@
 // * Do not use the buffer after calling brelse.
 // * Only one process at a time can use a buffer,
 //     so do not keep them longer than necessary.
+// * To overlap disk writes with other work, call bstart
+//     instead of bwrite, and bwait before the next use.
+// * breadahead starts reading a block that will be needed
+//     soon without waiting for it or keeping the buffer.
 //
 // The implementation uses two state flags internally:
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+//
+// Locking: each hash bucket has a lock protecting its chain and
+// the refcnt of the buffers on it, so lookups of different blocks
+// proceed in parallel.  bcache.lock protects the LRU list and
+// serializes misses; a buffer only changes identity (and bucket)
+// while bcache.lock and both bucket locks are held.  Lock order is
+// bcache.lock, then bucket locks; a bucket lock is never held while
+// waiting for bcache.lock.  A buffer is on the LRU list exactly
+// when its data is non-zero, i.e. its page belongs to the cache.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "x86.h"
+
+#define NBUCKET 61  // hash buckets (prime)
+#define HASH(dev, blockno) (((dev) * 31 + (blockno)) % NBUCKET)
+#define BPP (PGSIZE/BSIZE)  // buffers per kalloc() page
+#define NCHUNK (NBUF/BPP)   // most pages the cache may hold
+#define BMIN (3*LOGSIZE)    // default for bcache.min
+#define BFREEMIN 1024       // grow only while kalloc() has this many free pages
+
+struct bucket {
+  struct spinlock lock;
+  struct buf *head;    // Chain of buffers through hnext
+  uint gets;           // Statistics, see bcacheinfo()
+  uint hits;
+  unsigned long long cycles;
+};
 
 struct {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct buf buf[NBUF];      // buf[i*BPP..] hold the blocks of chunk[i]
+  char *chunk[NCHUNK];       // Pages holding block data, or 0
+  uint nbuf;                 // Buffers with data
+  uint min;                  // Never shrink below this many; see breserve()
+  struct bucket bucket[NBUCKET];
 
   // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
+  // head.next is most recently released.
   struct buf head;
 } bcache;
 
@@ -39,59 +77,263 @@ void
 binit(void)
 {
   struct buf *b;
+  struct bucket *bk;
 
   initlock(&bcache.lock, "bcache");
+  bcache.min = BMIN;
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++)
+    initlock(&bk->lock, "bcache.bucket");
 
 //PAGEBREAK!
-  // Create linked list of buffers
+  // The list of buffers starts out empty; bget() grows it.
   bcache.head.prev = &bcache.head;
   bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++)
     initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
-  }
 }
 
-// Look through buffer cache for block on device dev.
-// If not found, allocate a buffer.
-// In either case, return locked buffer.
-static struct buf*
-bget(uint dev, uint blockno)
+// Add a page worth of buffers to the cache, parked under a block
+// number no one will ask for at the LRU tail, where bget() looks
+// first.  Returns 0 if the cache is at its limit or memory is
+// short.  Caller must hold bcache.lock.
+static int
+bgrow(void)
 {
+  int i;
+  char *page;
   struct buf *b;
+  struct bucket *bk;
 
-  acquire(&bcache.lock);
+  for(i = 0; i < NCHUNK && bcache.chunk[i]; i++)
+    ;
+  if(i == NCHUNK)
+    return 0;
+  if(bcache.nbuf >= bcache.min && kfreepages() < BFREEMIN)
+    return 0;
+  if((page = kalloc()) == 0)
+    return 0;
+  bcache.chunk[i] = page;
+  bcache.nbuf += BPP;
 
-  // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+  bk = &bcache.bucket[HASH((uint)-1, 0)];
+  acquire(&bk->lock);
+  for(b = &bcache.buf[i*BPP]; b < &bcache.buf[(i+1)*BPP]; b++){
+    b->dev = -1;
+    b->blockno = 0;
+    b->flags = 0;
+    b->data = (uchar*)page;
+    page += BSIZE;
+    b->hnext = bk->head;
+    bk->head = b;
+    b->prev = bcache.head.prev;
+    b->next = &bcache.head;
+    bcache.head.prev->next = b;
+    bcache.head.prev = b;
+  }
+  release(&bk->lock);
+  return 1;
+}
+
+// Remove b from the chain of bucket bk.
+// Caller must hold bk->lock.
+static void
+bunlink(struct bucket *bk, struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp = &bk->head; *pp != b; pp = &(*pp)->hnext)
+    ;
+  *pp = b->hnext;
+}
+
+// Take the BPP buffers of chunk i out of the cache, provided
+// none of them is in use or dirty.  Each one is unhooked from
+// its bucket as it is checked, so no lookup can find it; if a
+// later one turns out to be busy, or its bucket is locked, the
+// earlier ones go back.  Putting them back may wait for their
+// bucket locks, which is safe: the caller can't hold one, or
+// the tryacquire() above would have failed, and a bucket lock
+// is held while waiting for another lock only by bget() with
+// bcache.lock, which is ours.
+// Returns 1 if the chunk's page may now be freed.
+// Caller must hold bcache.lock.
+static int
+bdetach(int i)
+{
+  struct buf *b, *first, *last;
+  struct bucket *bk;
+  int idle;
+
+  first = &bcache.buf[i*BPP];
+  last = first + BPP;
+  for(b = first; b < last; b++){
+    bk = &bcache.bucket[HASH(b->dev, b->blockno)];
+    if(!tryacquire(&bk->lock))
+      break;
+    idle = b->refcnt == 0 && (b->flags & B_DIRTY) == 0;
+    if(idle)
+      bunlink(bk, b);
+    release(&bk->lock);
+    if(!idle)
+      break;
+  }
+  if(b < last){
+    last = b;
+    for(b = first; b < last; b++){
+      bk = &bcache.bucket[HASH(b->dev, b->blockno)];
+      acquire(&bk->lock);
+      b->hnext = bk->head;
+      bk->head = b;
+      release(&bk->lock);
     }
+    return 0;
+  }
+  for(b = first; b < last; b++){
+    b->next->prev = b->prev;
+    b->prev->next = b->next;
+    b->data = 0;
+  }
+  return 1;
+}
+
+// Keep at least n buffers in the cache, growing it past
+// BFREEMIN if need be.  The log calls this once it knows how
+// many buffers a commit can pin and lock at once.
+void
+breserve(uint n)
+{
+  if(n > NBUF)
+    panic("breserve");
+  acquire(&bcache.lock);
+  if(n > bcache.min)
+    bcache.min = n;
+  release(&bcache.lock);
+}
+
+// Give up to n pages of unused, clean buffers back to kalloc(),
+// which calls this when free memory runs low.  Returns the number
+// of pages freed.  kalloc() may be called with any lock held,
+// including the cache's own (from bgrow()), so this never spins
+// on a lock a caller might hold: if bcache.lock or a bucket lock
+// is busy, it gives up on that and frees less.
+int
+bshrink(int n)
+{
+  int i, freed;
+  char *page;
+
+  if(bcache.nbuf <= bcache.min || !tryacquire(&bcache.lock))
+    return 0;
+
+  freed = 0;
+  for(i = 0; i < NCHUNK && freed < n && bcache.nbuf - BPP >= bcache.min; i++){
+    if(bcache.chunk[i] == 0 || !bdetach(i))
+      continue;
+    page = bcache.chunk[i];
+    bcache.chunk[i] = 0;
+    bcache.nbuf -= BPP;
+    kfree(page);
+    freed++;
   }
+  release(&bcache.lock);
+  return freed;
+}
+
+// Return the buffer for (dev, blockno) in bucket bk, or 0.
+// Caller must hold bk->lock.
+static struct buf*
+bfind(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bk->head; b; b = b->hnext)
+    if(b->dev == dev && b->blockno == blockno)
+      return b;
+  return 0;
+}
+
+// Give (dev, blockno) the least recently released unused buffer
+// that is clean: "clean" because B_DIRTY and not locked means
+// log.c hasn't yet committed the changes to the buffer.  Returns
+// the buffer, now on bk's chain, or 0 if every buffer is in use.
+// The block must not be cached already.  Caller must hold
+// bcache.lock and bk->lock, the block's bucket lock.
+static struct buf*
+brecycle(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+  struct bucket *vk;
 
-  // Not cached; recycle some unused buffer and clean buffer
-  // "clean" because B_DIRTY and not locked means log.c
-  // hasn't yet committed the changes to the buffer.
   for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
+    vk = &bcache.bucket[HASH(b->dev, b->blockno)];
+    if(vk != bk)
+      acquire(&vk->lock);
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0){
+      bunlink(vk, b);
+      if(vk != bk)
+        release(&vk->lock);
       b->dev = dev;
       b->blockno = blockno;
       b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
+      b->hnext = bk->head;
+      bk->head = b;
       return b;
     }
+    if(vk != bk)
+      release(&vk->lock);
   }
-  panic("bget: no buffers");
+  return 0;
 }
 
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return locked buffer.
+static struct buf*
+bget(uint dev, uint blockno)
+{
+  struct buf *b;
+  struct bucket *bk;
+  unsigned long long start;
+
+  start = rdtsc();
+  bk = &bcache.bucket[HASH(dev, blockno)];
+  acquire(&bk->lock);
+  bk->gets++;
+
+  // Is the block already cached?
+  if((b = bfind(bk, dev, blockno)) != 0){
+    bk->hits++;
+    goto found;
+  }
+
+  // Not cached.  Take bcache.lock, which must come first,
+  // and look again in case another miss just brought it in.
+  release(&bk->lock);
+  acquire(&bcache.lock);
+
+  // Rather than evict a cached block, grow the cache if there
+  // are no parked buffers left at the LRU tail.
+  b = bcache.head.prev;
+  if(b == &bcache.head || b->dev != (uint)-1)
+    bgrow();
+
+  acquire(&bk->lock);
+  if((b = bfind(bk, dev, blockno)) != 0){
+    release(&bcache.lock);
+    goto found;
+  }
+
+  if((b = brecycle(bk, dev, blockno)) == 0)
+    panic("bget: no buffers");
+  release(&bcache.lock);
+
+found:
+  b->refcnt++;
+  bk->cycles += rdtsc() - start;
+  release(&bk->lock);
+  acquiresleep(&b->lock);
+  return b;
+}
 // Return a locked buf with the contents of the indicated block.
 struct buf*
 bread(uint dev, uint blockno)
@@ -115,6 +357,73 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Start writing b's contents to disk, without waiting.
+// Must be locked; call bwait(b) before using or releasing it.
+void
+bstart(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("bstart");
+  b->flags |= B_DIRTY;
+  idesubmit(b);
+}
+
+// Wait for a write started by bstart() to finish.
+void
+bwait(struct buf *b)
+{
+  idewaitbuf(b);
+}
+
+static void bput(struct buf*);
+
+// Called from ideintr() when a read-ahead finishes.
+static void
+breaddone(struct buf *b)
+{
+  b->iodone = 0;
+  bput(b);
+}
+
+// Start reading block blockno into the cache, if it isn't there
+// already, and return without waiting for the disk.  A later
+// bread() of the block sleeps until the data is in.
+void
+breadahead(uint dev, uint blockno)
+{
+  struct buf *b;
+  struct bucket *bk;
+
+  // Only a hint: never wait.  Skip the block if it is cached
+  // already, maybe in use or being read, and give up rather
+  // than sleep or panic if no buffer is free.
+  bk = &bcache.bucket[HASH(dev, blockno)];
+  acquire(&bk->lock);
+  b = bfind(bk, dev, blockno);
+  release(&bk->lock);
+  if(b)
+    return;
+
+  acquire(&bcache.lock);
+  b = bcache.head.prev;
+  if(b == &bcache.head || b->dev != (uint)-1)
+    bgrow();
+  acquire(&bk->lock);
+  b = 0;
+  if(bfind(bk, dev, blockno) == 0 && (b = brecycle(bk, dev, blockno)) != 0){
+    // b had no references, so no one holds its lock
+    // and this does not sleep.
+    b->refcnt++;
+    acquiresleep(&b->lock);
+  }
+  release(&bk->lock);
+  release(&bcache.lock);
+  if(b == 0)
+    return;
+  b->iodone = breaddone;
+  idesubmit(b);
+}
+
 // Release a locked buffer.
 // Move to the head of the MRU list.
 void
@@ -122,22 +431,58 @@ brelse(struct buf *b)
 {
   if(!holdingsleep(&b->lock))
     panic("brelse");
+  bput(b);
+}
+
+// Unlock b and drop a reference, on behalf of whoever
+// locked it.
+static void
+bput(struct buf *b)
+{
+  struct bucket *bk;
+  int refcnt;
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
-  b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  bk = &bcache.bucket[HASH(b->dev, b->blockno)];
+  acquire(&bk->lock);
+  refcnt = --b->refcnt;
+  release(&bk->lock);
+
+  if (refcnt == 0) {
+    // no one is waiting for it.  The LRU order is only a
+    // hint for bget(), so it is fine if b was recycled
+    // between the two critical sections; if bshrink() took
+    // its page away meanwhile, b is no longer on the list.
+    acquire(&bcache.lock);
+    if(b->data){
+      b->next->prev = b->prev;
+      b->prev->next = b->next;
+      b->next = bcache.head.next;
+      b->prev = &bcache.head;
+      bcache.head.next->prev = b;
+      bcache.head.next = b;
+    }
+    release(&bcache.lock);
+  }
+}
+
+// Report buffer cache statistics.
+void
+bcacheinfo(struct bcache_info *bi)
+{
+  struct bucket *bk;
+
+  bi->nbuf = bcache.nbuf;
+  bi->gets = bi->hits = 0;
+  bi->cycles = 0;
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++){
+    acquire(&bk->lock);
+    bi->gets += bk->gets;
+    bi->hits += bk->hits;
+    bi->cycles += bk->cycles;
+    release(&bk->lock);
   }
-  
-  release(&bcache.lock);
 }
 //PAGEBREAK!
 // Blank page.
@@ -0,0 +1,41 @@
+#!/bin/sh
+# Block size benchmark.
+#
+# For each block size, rebuilds the kernel, user programs and
+# fs.img with make BSIZE=n, boots xv6, runs fsbench, and collects
+# its report, so the small-file and large-file numbers can be
+# compared across block sizes.
+#
+# usage: ./bsizebench.sh [block sizes]
+# Leaves the tree built for the last block size; make clean
+# before building the default again.
+
+sizes=${*:-"512 1024 2048 4096"}
+QEMU=${QEMU:-qemu-system-i386}
+CPUS=${CPUS:-2}
+TIMEOUT=${TIMEOUT:-120}
+
+for bs in $sizes; do
+  make -s clean
+  make -s BSIZE=$bs xv6.img fs.img > /dev/null || exit 1
+
+  (sleep 2; echo fsbench; sleep $TIMEOUT) |
+    $QEMU -nographic -smp $CPUS -m 512 \
+      -drive file=fs.img,index=1,media=disk,format=raw \
+      -drive file=xv6.img,index=0,media=disk,format=raw > bsizebench.out 2>&1 &
+  pid=$!
+  t=0
+  while [ $t -lt $TIMEOUT ] && ! grep -q "fsbench done" bsizebench.out; do
+    sleep 1
+    t=$((t + 1))
+  done
+  kill -9 $pid 2>/dev/null
+  wait $pid 2>/dev/null
+
+  if ! grep -q "fsbench done" bsizebench.out; then
+    echo "bsizebench: BSIZE $bs: fsbench did not finish; see bsizebench.out"
+    exit 1
+  fi
+  grep "^fsbench: " bsizebench.out | tr -d '\r'
+done
+rm -f bsizebench.out
@@ -6,9 +6,19 @@ struct buf {
   uint refcnt;
   struct buf *prev; // LRU cache list
   struct buf *next;
+  struct buf *hnext; // hash bucket chain
   struct buf *qnext; // disk queue
-  uchar data[BSIZE];
+  void (*iodone)(struct buf*); // called when an async request finishes
+  uchar *data;      // BSIZE bytes in a page owned by bio.c
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
 
+// Buffer cache statistics, see getbcacheinfo().
+struct bcache_info {
+  uint nbuf;                   // Buffers in the cache
+  uint gets;                   // Calls to bget()
+  uint hits;                   // ... that found the block cached
+  unsigned long long cycles;   // Total cycles spent looking up
+};
+
@@ -0,0 +1,61 @@
+// Copy-on-write fault benchmark.
+// Touches a heap, forks, and has the child write one byte per
+// page (each write copies a shared page); once the child is
+// gone the parent writes every page again (each write only
+// re-enables PTE_W on a page it now owns alone).
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define PGSIZE  4096
+#define NPAGES  1024
+
+void
+report(char *what, int n, uint elapsed)
+{
+  printf(1, "cowbench: %d %s faults in %d ticks", n, what, elapsed);
+  if(elapsed > 0)
+    printf(1, " (%d faults/100 ticks)", n * 100 / elapsed);
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  int n, pid;
+  uint start;
+  char *a, *p;
+
+  n = NPAGES;
+  if(argc > 1)
+    n = atoi(argv[1]);
+
+  a = sbrk(n * PGSIZE);
+  if(a == (char*)-1){
+    printf(1, "cowbench: sbrk failed\n");
+    exit();
+  }
+  for(p = a; p < a + n * PGSIZE; p += PGSIZE)
+    *p = 1;
+
+  pid = fork();
+  if(pid < 0){
+    printf(1, "cowbench: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    start = uptime();
+    for(p = a; p < a + n * PGSIZE; p += PGSIZE)
+      *p = 2;
+    report("copy", n, uptime() - start);
+    exit();
+  }
+  wait();
+
+  start = uptime();
+  for(p = a; p < a + n * PGSIZE; p += PGSIZE)
+    *p = 3;
+  report("reuse", n, uptime() - start);
+  exit();
+}
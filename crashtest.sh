@@ -0,0 +1,46 @@
+#!/bin/sh
+# Crash-recovery test.
+#
+# Boots xv6 on a copy of fs.img, types a write-heavy command at
+# the shell, kills qemu at a random moment, and runs fsck on the
+# image.  fsck replays the log as the kernel would on the next
+# boot and checks the file system invariants, so a failure means
+# some crash point leaves the disk inconsistent.
+#
+# usage: ./crashtest.sh [runs [command]]
+# The crashed image of the first failing run is kept in crash.img.
+
+runs=${1:-20}
+cmd=${2:-"stressfs; usertests"}
+QEMU=${QEMU:-qemu-system-i386}
+CPUS=${CPUS:-2}
+
+make -s xv6.img fs.img fsck || exit 1
+
+i=0
+while [ $i -lt $runs ]; do
+  i=$((i + 1))
+  cp fs.img crash.img
+
+  # Kill somewhere between 3 and 13 seconds after boot.
+  ms=$(( $(od -An -N2 -tu2 /dev/urandom) % 10000 + 3000 ))
+  delay=$((ms / 1000)).$(printf %03d $((ms % 1000)))
+
+  (sleep 2; echo "$cmd"; sleep $((ms / 1000 + 1))) |
+    $QEMU -nographic -smp $CPUS -m 512 \
+      -drive file=crash.img,index=1,media=disk,format=raw \
+      -drive file=xv6.img,index=0,media=disk,format=raw > crash.out 2>&1 &
+  pid=$!
+  sleep $delay
+  kill -9 $pid 2>/dev/null
+  wait $pid 2>/dev/null
+
+  echo "run $i: killed after ${delay}s"
+  if ! ./fsck crash.img; then
+    echo "crashtest: run $i left an inconsistent file system"
+    echo "crashtest: console output in crash.out, image in crash.img"
+    exit 1
+  fi
+done
+rm -f crash.img crash.out
+echo "crashtest: $runs runs ok"
@@ -1,5 +1,8 @@
+struct balloc_info;
+struct bcache_info;
 struct buf;
 struct context;
+struct fault_info;
 struct file;
 struct inode;
 struct pipe;
@@ -13,9 +16,15 @@ struct superblock;
 typedef uint pte_t;
 
 // bio.c
+void            bcacheinfo(struct bcache_info*);
 void            binit(void);
 struct buf*     bread(uint, uint);
+void            breadahead(uint, uint);
 void            brelse(struct buf*);
+void            breserve(uint);
+int             bshrink(int);
+void            bstart(struct buf*);
+void            bwait(struct buf*);
 void            bwrite(struct buf*);
 
 // console.c
@@ -38,10 +47,14 @@ int             filewrite(struct file*, char*, int n);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
+void            ballocinfo(int dev, struct balloc_info*);
+void            ballocinit(int dev);
+void            dcacheput(uint, uint, char*, uint, uint);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
+void            iexec(struct inode*, int);
 void            iinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
@@ -59,6 +72,8 @@ int             writei(struct inode*, char*, uint, uint);
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            idesubmit(struct buf*);
+void            idewaitbuf(struct buf*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -67,7 +82,11 @@ void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+char*           kalloc_zeroed(void);
+void            kzerofill(void);
+void            kzeroinfo(uint*, uint*);
 void            kfree(char*);
+int             kfreepages(void);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
 
@@ -86,6 +105,7 @@ void            microdelay(int);
 // log.c
 void            initlog(int dev);
 void            log_write(struct buf*);
+int             logopblocks(void);
 void            begin_op();
 void            end_op();
 
@@ -109,10 +129,13 @@ void            exit(void);
 int             fork(void);
 int             growproc(int);
 int             kill(int);
+void            kthread(char*, void(*)(void));
 void            pinit(void);
 void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
+int             setsched(int);
+int             settickets(int);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
 int             wait(void);
@@ -131,6 +154,7 @@ void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
 void            release(struct spinlock*);
+int             tryacquire(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
 
@@ -152,6 +176,7 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argout(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
@@ -164,6 +189,8 @@ void            timerinit(void);
 void            idtinit(void);
 extern uint     ticks;
 void            tvinit(void);
+int             pagefault(uint, int);
+void            faultinfo(struct fault_info*);
 extern struct spinlock tickslock;
 
 // uart.c
@@ -181,6 +208,10 @@ int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
+int             loadpage(struct proc*, uint);
+int             prefault(struct proc*, uint, uint, int);
+void            textinit(void);
+void            textpurge(uint, uint);
 pde_t*          copyuvm(pde_t*, uint);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
@@ -191,6 +222,7 @@ int mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm);
 //Reference Counters
 void increment_refcount(uint pa);
 void decrement_refcount(uint pa);
+int decrement_refcount_if_shared(uint pa);
 uint get_refcount(uint pa);
 
 
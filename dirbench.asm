@@ -0,0 +1,1468 @@
+
+_dirbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  path[8] = 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf d0 07 00 00       	mov    $0x7d0,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  int i, j, n, fd, miss;
+  uint start, create, lookup;
+
+  n = NFILE;
+  if(argc > 1)
+  19:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  1c:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+  1f:	7e 1a                	jle    3b <main+0x3b>
+    n = atoi(argv[1]);
+  21:	83 ec 0c             	sub    $0xc,%esp
+  24:	ff 70 04             	push   0x4(%eax)
+  27:	e8 44 04 00 00       	call   470 <atoi>
+  2c:	89 c7                	mov    %eax,%edi
+  if(n > 10000)
+  2e:	b8 10 27 00 00       	mov    $0x2710,%eax
+  33:	39 c7                	cmp    %eax,%edi
+  35:	0f 4f f8             	cmovg  %eax,%edi
+  38:	83 c4 10             	add    $0x10,%esp
+    n = 10000;
+
+  if(mkdir("db") < 0){
+  3b:	83 ec 0c             	sub    $0xc,%esp
+  3e:	68 bc 09 00 00       	push   $0x9bc
+  43:	e8 03 05 00 00       	call   54b <mkdir>
+  48:	83 c4 10             	add    $0x10,%esp
+  4b:	85 c0                	test   %eax,%eax
+  4d:	0f 88 ff 00 00 00    	js     152 <main+0x152>
+    printf(1, "dirbench: mkdir db failed\n");
+    exit();
+  }
+  printf(1, "dirbench: files  create-ticks  lookup-ticks (per %d)\n", BATCH);
+  53:	51                   	push   %ecx
+  miss = 0;
+  54:	31 db                	xor    %ebx,%ebx
+  for(i = 0; i < n; ){
+  56:	31 f6                	xor    %esi,%esi
+  printf(1, "dirbench: files  create-ticks  lookup-ticks (per %d)\n", BATCH);
+  58:	68 fa 00 00 00       	push   $0xfa
+  5d:	68 38 0a 00 00       	push   $0xa38
+  62:	6a 01                	push   $0x1
+  64:	e8 27 06 00 00       	call   690 <printf>
+  for(i = 0; i < n; ){
+  69:	83 c4 10             	add    $0x10,%esp
+  6c:	39 fb                	cmp    %edi,%ebx
+  6e:	0f 8d 20 01 00 00    	jge    194 <main+0x194>
+    start = uptime();
+  74:	e8 02 05 00 00       	call   57b <uptime>
+  79:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  7c:	eb 24                	jmp    a2 <main+0xa2>
+  7e:	66 90                	xchg   %ax,%ax
+      mkname('f', i);
+      if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+        printf(1, "dirbench: create %s failed\n", path);
+        exit();
+      }
+      close(fd);
+  80:	83 ec 0c             	sub    $0xc,%esp
+    } while(++i < n && i % BATCH != 0);
+  83:	83 c3 01             	add    $0x1,%ebx
+      close(fd);
+  86:	50                   	push   %eax
+  87:	e8 7f 04 00 00       	call   50b <close>
+    } while(++i < n && i % BATCH != 0);
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	39 df                	cmp    %ebx,%edi
+  91:	74 49                	je     dc <main+0xdc>
+  93:	69 c3 d5 78 e9 26    	imul   $0x26e978d5,%ebx,%eax
+  99:	d1 c8                	ror    %eax
+  9b:	3d dd 24 06 01       	cmp    $0x10624dd,%eax
+  a0:	76 3a                	jbe    dc <main+0xdc>
+      mkname('f', i);
+  a2:	83 ec 08             	sub    $0x8,%esp
+  a5:	53                   	push   %ebx
+  a6:	6a 66                	push   $0x66
+  a8:	e8 33 01 00 00       	call   1e0 <mkname>
+      if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+  ad:	58                   	pop    %eax
+  ae:	5a                   	pop    %edx
+  af:	68 02 02 00 00       	push   $0x202
+  b4:	68 c0 0d 00 00       	push   $0xdc0
+  b9:	e8 65 04 00 00       	call   523 <open>
+  be:	83 c4 10             	add    $0x10,%esp
+  c1:	85 c0                	test   %eax,%eax
+  c3:	79 bb                	jns    80 <main+0x80>
+        printf(1, "dirbench: create %s failed\n", path);
+  c5:	51                   	push   %ecx
+  c6:	68 c0 0d 00 00       	push   $0xdc0
+  cb:	68 da 09 00 00       	push   $0x9da
+  d0:	6a 01                	push   $0x1
+  d2:	e8 b9 05 00 00       	call   690 <printf>
+        exit();
+  d7:	e8 07 04 00 00       	call   4e3 <exit>
+    create = uptime() - start;
+  dc:	e8 9a 04 00 00       	call   57b <uptime>
+  e1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+
+    start = uptime();
+  e4:	e8 92 04 00 00       	call   57b <uptime>
+    for(j = 0; j < BATCH; j++, miss++){
+      mkname('m', miss % 10000);
+  e9:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    start = uptime();
+  ec:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    for(j = 0; j < BATCH; j++, miss++){
+  ef:	8d 86 fa 00 00 00    	lea    0xfa(%esi),%eax
+      mkname('m', miss % 10000);
+  f5:	89 c3                	mov    %eax,%ebx
+  f7:	eb 0e                	jmp    107 <main+0x107>
+  f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    for(j = 0; j < BATCH; j++, miss++){
+ 100:	83 c6 01             	add    $0x1,%esi
+ 103:	39 f3                	cmp    %esi,%ebx
+ 105:	74 5e                	je     165 <main+0x165>
+      mkname('m', miss % 10000);
+ 107:	b8 59 17 b7 d1       	mov    $0xd1b71759,%eax
+ 10c:	83 ec 08             	sub    $0x8,%esp
+ 10f:	f7 e6                	mul    %esi
+ 111:	89 f0                	mov    %esi,%eax
+ 113:	c1 ea 0d             	shr    $0xd,%edx
+ 116:	69 d2 10 27 00 00    	imul   $0x2710,%edx,%edx
+ 11c:	29 d0                	sub    %edx,%eax
+ 11e:	50                   	push   %eax
+ 11f:	6a 6d                	push   $0x6d
+ 121:	e8 ba 00 00 00       	call   1e0 <mkname>
+      if(open(path, O_RDONLY) >= 0){
+ 126:	58                   	pop    %eax
+ 127:	5a                   	pop    %edx
+ 128:	6a 00                	push   $0x0
+ 12a:	68 c0 0d 00 00       	push   $0xdc0
+ 12f:	e8 ef 03 00 00       	call   523 <open>
+ 134:	83 c4 10             	add    $0x10,%esp
+ 137:	85 c0                	test   %eax,%eax
+ 139:	78 c5                	js     100 <main+0x100>
+        printf(1, "dirbench: open %s succeeded\n", path);
+ 13b:	53                   	push   %ebx
+ 13c:	68 c0 0d 00 00       	push   $0xdc0
+ 141:	68 f6 09 00 00       	push   $0x9f6
+ 146:	6a 01                	push   $0x1
+ 148:	e8 43 05 00 00       	call   690 <printf>
+        exit();
+ 14d:	e8 91 03 00 00       	call   4e3 <exit>
+    printf(1, "dirbench: mkdir db failed\n");
+ 152:	53                   	push   %ebx
+ 153:	53                   	push   %ebx
+ 154:	68 bf 09 00 00       	push   $0x9bf
+ 159:	6a 01                	push   $0x1
+ 15b:	e8 30 05 00 00       	call   690 <printf>
+    exit();
+ 160:	e8 7e 03 00 00       	call   4e3 <exit>
+      }
+    }
+    lookup = uptime() - start;
+ 165:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+ 168:	e8 0e 04 00 00       	call   57b <uptime>
+ 16d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+    printf(1, "dirbench: %d  %d  %d\n", i, create, lookup);
+ 170:	83 ec 0c             	sub    $0xc,%esp
+    lookup = uptime() - start;
+ 173:	29 c8                	sub    %ecx,%eax
+    printf(1, "dirbench: %d  %d  %d\n", i, create, lookup);
+ 175:	50                   	push   %eax
+    create = uptime() - start;
+ 176:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 179:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 17c:	29 c8                	sub    %ecx,%eax
+    printf(1, "dirbench: %d  %d  %d\n", i, create, lookup);
+ 17e:	50                   	push   %eax
+ 17f:	53                   	push   %ebx
+ 180:	68 13 0a 00 00       	push   $0xa13
+ 185:	6a 01                	push   $0x1
+ 187:	e8 04 05 00 00       	call   690 <printf>
+ 18c:	83 c4 20             	add    $0x20,%esp
+ 18f:	e9 d8 fe ff ff       	jmp    6c <main+0x6c>
+  }
+
+  for(i = 0; i < n; i++){
+ 194:	31 db                	xor    %ebx,%ebx
+ 196:	eb 1c                	jmp    1b4 <main+0x1b4>
+    mkname('f', i);
+ 198:	51                   	push   %ecx
+ 199:	51                   	push   %ecx
+ 19a:	53                   	push   %ebx
+  for(i = 0; i < n; i++){
+ 19b:	83 c3 01             	add    $0x1,%ebx
+    mkname('f', i);
+ 19e:	6a 66                	push   $0x66
+ 1a0:	e8 3b 00 00 00       	call   1e0 <mkname>
+    unlink(path);
+ 1a5:	c7 04 24 c0 0d 00 00 	movl   $0xdc0,(%esp)
+ 1ac:	e8 82 03 00 00       	call   533 <unlink>
+  for(i = 0; i < n; i++){
+ 1b1:	83 c4 10             	add    $0x10,%esp
+ 1b4:	39 fb                	cmp    %edi,%ebx
+ 1b6:	7c e0                	jl     198 <main+0x198>
+  }
+  unlink("db");
+ 1b8:	83 ec 0c             	sub    $0xc,%esp
+ 1bb:	68 bc 09 00 00       	push   $0x9bc
+ 1c0:	e8 6e 03 00 00       	call   533 <unlink>
+  printf(1, "dirbench done\n");
+ 1c5:	58                   	pop    %eax
+ 1c6:	5a                   	pop    %edx
+ 1c7:	68 29 0a 00 00       	push   $0xa29
+ 1cc:	6a 01                	push   $0x1
+ 1ce:	e8 bd 04 00 00       	call   690 <printf>
+  exit();
+ 1d3:	e8 0b 03 00 00       	call   4e3 <exit>
+ 1d8:	66 90                	xchg   %ax,%ax
+ 1da:	66 90                	xchg   %ax,%ax
+ 1dc:	66 90                	xchg   %ax,%ax
+ 1de:	66 90                	xchg   %ax,%ax
+
+000001e0 <mkname>:
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	56                   	push   %esi
+ 1e5:	53                   	push   %ebx
+ 1e6:	83 ec 14             	sub    $0x14,%esp
+ 1e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 1ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  strcpy(path, "db/");
+ 1ef:	68 b8 09 00 00       	push   $0x9b8
+ 1f4:	68 c0 0d 00 00       	push   $0xdc0
+  path[4] = '0' + i / 1000;
+ 1f9:	89 f7                	mov    %esi,%edi
+ 1fb:	c1 ff 1f             	sar    $0x1f,%edi
+  strcpy(path, "db/");
+ 1fe:	e8 9d 00 00 00       	call   2a0 <strcpy>
+  path[4] = '0' + i / 1000;
+ 203:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+  path[3] = c;
+ 208:	88 1d c3 0d 00 00    	mov    %bl,0xdc3
+  path[5] = '0' + (i / 100) % 10;
+ 20e:	bb 67 66 66 66       	mov    $0x66666667,%ebx
+  path[4] = '0' + i / 1000;
+ 213:	f7 ee                	imul   %esi
+  path[5] = '0' + (i / 100) % 10;
+ 215:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+  path[8] = 0;
+ 21a:	c6 05 c8 0d 00 00 00 	movb   $0x0,0xdc8
+}
+ 221:	83 c4 10             	add    $0x10,%esp
+  path[4] = '0' + i / 1000;
+ 224:	c1 fa 06             	sar    $0x6,%edx
+ 227:	29 fa                	sub    %edi,%edx
+ 229:	83 c2 30             	add    $0x30,%edx
+ 22c:	88 15 c4 0d 00 00    	mov    %dl,0xdc4
+  path[5] = '0' + (i / 100) % 10;
+ 232:	f7 ee                	imul   %esi
+ 234:	c1 fa 05             	sar    $0x5,%edx
+ 237:	89 d1                	mov    %edx,%ecx
+ 239:	29 f9                	sub    %edi,%ecx
+ 23b:	89 c8                	mov    %ecx,%eax
+ 23d:	f7 eb                	imul   %ebx
+ 23f:	89 c8                	mov    %ecx,%eax
+ 241:	c1 f8 1f             	sar    $0x1f,%eax
+ 244:	c1 fa 02             	sar    $0x2,%edx
+ 247:	29 c2                	sub    %eax,%edx
+ 249:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 24c:	01 c0                	add    %eax,%eax
+ 24e:	29 c1                	sub    %eax,%ecx
+  path[6] = '0' + (i / 10) % 10;
+ 250:	89 f0                	mov    %esi,%eax
+ 252:	f7 eb                	imul   %ebx
+  path[5] = '0' + (i / 100) % 10;
+ 254:	83 c1 30             	add    $0x30,%ecx
+ 257:	88 0d c5 0d 00 00    	mov    %cl,0xdc5
+  path[6] = '0' + (i / 10) % 10;
+ 25d:	c1 fa 02             	sar    $0x2,%edx
+ 260:	89 d1                	mov    %edx,%ecx
+ 262:	29 f9                	sub    %edi,%ecx
+ 264:	89 c8                	mov    %ecx,%eax
+ 266:	f7 eb                	imul   %ebx
+ 268:	89 c8                	mov    %ecx,%eax
+ 26a:	c1 f8 1f             	sar    $0x1f,%eax
+ 26d:	c1 fa 02             	sar    $0x2,%edx
+ 270:	29 c2                	sub    %eax,%edx
+ 272:	89 c8                	mov    %ecx,%eax
+ 274:	8d 14 92             	lea    (%edx,%edx,4),%edx
+ 277:	01 d2                	add    %edx,%edx
+ 279:	29 d0                	sub    %edx,%eax
+ 27b:	83 c0 30             	add    $0x30,%eax
+ 27e:	a2 c6 0d 00 00       	mov    %al,0xdc6
+  path[7] = '0' + i % 10;
+ 283:	8d 04 89             	lea    (%ecx,%ecx,4),%eax
+ 286:	01 c0                	add    %eax,%eax
+ 288:	29 c6                	sub    %eax,%esi
+ 28a:	8d 46 30             	lea    0x30(%esi),%eax
+ 28d:	a2 c7 0d 00 00       	mov    %al,0xdc7
+}
+ 292:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 295:	5b                   	pop    %ebx
+ 296:	5e                   	pop    %esi
+ 297:	5f                   	pop    %edi
+ 298:	5d                   	pop    %ebp
+ 299:	c3                   	ret
+ 29a:	66 90                	xchg   %ax,%ax
+ 29c:	66 90                	xchg   %ax,%ax
+ 29e:	66 90                	xchg   %ax,%ax
+
+000002a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 2a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2a1:	31 c0                	xor    %eax,%eax
+{
+ 2a3:	89 e5                	mov    %esp,%ebp
+ 2a5:	53                   	push   %ebx
+ 2a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2b7:	83 c0 01             	add    $0x1,%eax
+ 2ba:	84 d2                	test   %dl,%dl
+ 2bc:	75 f2                	jne    2b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2c1:	89 c8                	mov    %ecx,%eax
+ 2c3:	c9                   	leave
+ 2c4:	c3                   	ret
+ 2c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	53                   	push   %ebx
+ 2d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2da:	0f b6 02             	movzbl (%edx),%eax
+ 2dd:	84 c0                	test   %al,%al
+ 2df:	75 17                	jne    2f8 <strcmp+0x28>
+ 2e1:	eb 3a                	jmp    31d <strcmp+0x4d>
+ 2e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2e7:	90                   	nop
+ 2e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2ec:	83 c2 01             	add    $0x1,%edx
+ 2ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2f2:	84 c0                	test   %al,%al
+ 2f4:	74 1a                	je     310 <strcmp+0x40>
+    p++, q++;
+ 2f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2fb:	38 c3                	cmp    %al,%bl
+ 2fd:	74 e9                	je     2e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2ff:	29 d8                	sub    %ebx,%eax
+}
+ 301:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 304:	c9                   	leave
+ 305:	c3                   	ret
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 310:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 314:	31 c0                	xor    %eax,%eax
+ 316:	29 d8                	sub    %ebx,%eax
+}
+ 318:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 31b:	c9                   	leave
+ 31c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 31d:	0f b6 19             	movzbl (%ecx),%ebx
+ 320:	31 c0                	xor    %eax,%eax
+ 322:	eb db                	jmp    2ff <strcmp+0x2f>
+ 324:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 32f:	90                   	nop
+
+00000330 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 336:	80 3a 00             	cmpb   $0x0,(%edx)
+ 339:	74 15                	je     350 <strlen+0x20>
+ 33b:	31 c0                	xor    %eax,%eax
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+ 340:	83 c0 01             	add    $0x1,%eax
+ 343:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 347:	89 c1                	mov    %eax,%ecx
+ 349:	75 f5                	jne    340 <strlen+0x10>
+    ;
+  return n;
+}
+ 34b:	89 c8                	mov    %ecx,%eax
+ 34d:	5d                   	pop    %ebp
+ 34e:	c3                   	ret
+ 34f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 350:	31 c9                	xor    %ecx,%ecx
+}
+ 352:	5d                   	pop    %ebp
+ 353:	89 c8                	mov    %ecx,%eax
+ 355:	c3                   	ret
+ 356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000360 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	57                   	push   %edi
+ 364:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 367:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 36a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 36d:	89 d7                	mov    %edx,%edi
+ 36f:	fc                   	cld
+ 370:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 372:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 375:	89 d0                	mov    %edx,%eax
+ 377:	c9                   	leave
+ 378:	c3                   	ret
+ 379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	8b 45 08             	mov    0x8(%ebp),%eax
+ 386:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 38a:	0f b6 10             	movzbl (%eax),%edx
+ 38d:	84 d2                	test   %dl,%dl
+ 38f:	75 12                	jne    3a3 <strchr+0x23>
+ 391:	eb 1d                	jmp    3b0 <strchr+0x30>
+ 393:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 397:	90                   	nop
+ 398:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 39c:	83 c0 01             	add    $0x1,%eax
+ 39f:	84 d2                	test   %dl,%dl
+ 3a1:	74 0d                	je     3b0 <strchr+0x30>
+    if(*s == c)
+ 3a3:	38 d1                	cmp    %dl,%cl
+ 3a5:	75 f1                	jne    398 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3a7:	5d                   	pop    %ebp
+ 3a8:	c3                   	ret
+ 3a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3b0:	31 c0                	xor    %eax,%eax
+}
+ 3b2:	5d                   	pop    %ebp
+ 3b3:	c3                   	ret
+ 3b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+
+000003c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3c9:	31 db                	xor    %ebx,%ebx
+{
+ 3cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3ce:	eb 27                	jmp    3f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3d0:	83 ec 04             	sub    $0x4,%esp
+ 3d3:	6a 01                	push   $0x1
+ 3d5:	56                   	push   %esi
+ 3d6:	6a 00                	push   $0x0
+ 3d8:	e8 1e 01 00 00       	call   4fb <read>
+    if(cc < 1)
+ 3dd:	83 c4 10             	add    $0x10,%esp
+ 3e0:	85 c0                	test   %eax,%eax
+ 3e2:	7e 1d                	jle    401 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3ef:	3c 0a                	cmp    $0xa,%al
+ 3f1:	74 10                	je     403 <gets+0x43>
+ 3f3:	3c 0d                	cmp    $0xd,%al
+ 3f5:	74 0c                	je     403 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3f7:	89 df                	mov    %ebx,%edi
+ 3f9:	83 c3 01             	add    $0x1,%ebx
+ 3fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3ff:	7c cf                	jl     3d0 <gets+0x10>
+ 401:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 403:	8b 45 08             	mov    0x8(%ebp),%eax
+ 406:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 40a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 40d:	5b                   	pop    %ebx
+ 40e:	5e                   	pop    %esi
+ 40f:	5f                   	pop    %edi
+ 410:	5d                   	pop    %ebp
+ 411:	c3                   	ret
+ 412:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	56                   	push   %esi
+ 424:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 425:	83 ec 08             	sub    $0x8,%esp
+ 428:	6a 00                	push   $0x0
+ 42a:	ff 75 08             	push   0x8(%ebp)
+ 42d:	e8 f1 00 00 00       	call   523 <open>
+  if(fd < 0)
+ 432:	83 c4 10             	add    $0x10,%esp
+ 435:	85 c0                	test   %eax,%eax
+ 437:	78 27                	js     460 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 439:	83 ec 08             	sub    $0x8,%esp
+ 43c:	ff 75 0c             	push   0xc(%ebp)
+ 43f:	89 c3                	mov    %eax,%ebx
+ 441:	50                   	push   %eax
+ 442:	e8 f4 00 00 00       	call   53b <fstat>
+  close(fd);
+ 447:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 44a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 44c:	e8 ba 00 00 00       	call   50b <close>
+  return r;
+ 451:	83 c4 10             	add    $0x10,%esp
+}
+ 454:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 457:	89 f0                	mov    %esi,%eax
+ 459:	5b                   	pop    %ebx
+ 45a:	5e                   	pop    %esi
+ 45b:	5d                   	pop    %ebp
+ 45c:	c3                   	ret
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 460:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 465:	eb ed                	jmp    454 <stat+0x34>
+ 467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46e:	66 90                	xchg   %ax,%ax
+
+00000470 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	53                   	push   %ebx
+ 474:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 477:	0f be 02             	movsbl (%edx),%eax
+ 47a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 47d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 480:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 485:	77 1e                	ja     4a5 <atoi+0x35>
+ 487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 490:	83 c2 01             	add    $0x1,%edx
+ 493:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 496:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 49a:	0f be 02             	movsbl (%edx),%eax
+ 49d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4a0:	80 fb 09             	cmp    $0x9,%bl
+ 4a3:	76 eb                	jbe    490 <atoi+0x20>
+  return n;
+}
+ 4a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4a8:	89 c8                	mov    %ecx,%eax
+ 4aa:	c9                   	leave
+ 4ab:	c3                   	ret
+ 4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	56                   	push   %esi
+ 4b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4be:	85 c0                	test   %eax,%eax
+ 4c0:	7e 13                	jle    4d5 <memmove+0x25>
+ 4c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4c4:	89 d7                	mov    %edx,%edi
+ 4c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4d1:	39 f8                	cmp    %edi,%eax
+ 4d3:	75 fb                	jne    4d0 <memmove+0x20>
+  return vdst;
+}
+ 4d5:	5e                   	pop    %esi
+ 4d6:	89 d0                	mov    %edx,%eax
+ 4d8:	5f                   	pop    %edi
+ 4d9:	5d                   	pop    %ebp
+ 4da:	c3                   	ret
+
+000004db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4db:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <exit>:
+SYSCALL(exit)
+ 4e3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <wait>:
+SYSCALL(wait)
+ 4eb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <pipe>:
+SYSCALL(pipe)
+ 4f3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <read>:
+SYSCALL(read)
+ 4fb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <write>:
+SYSCALL(write)
+ 503:	b8 10 00 00 00       	mov    $0x10,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <close>:
+SYSCALL(close)
+ 50b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <kill>:
+SYSCALL(kill)
+ 513:	b8 06 00 00 00       	mov    $0x6,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <exec>:
+SYSCALL(exec)
+ 51b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <open>:
+SYSCALL(open)
+ 523:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <mknod>:
+SYSCALL(mknod)
+ 52b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <unlink>:
+SYSCALL(unlink)
+ 533:	b8 12 00 00 00       	mov    $0x12,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <fstat>:
+SYSCALL(fstat)
+ 53b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <link>:
+SYSCALL(link)
+ 543:	b8 13 00 00 00       	mov    $0x13,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <mkdir>:
+SYSCALL(mkdir)
+ 54b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <chdir>:
+SYSCALL(chdir)
+ 553:	b8 09 00 00 00       	mov    $0x9,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <dup>:
+SYSCALL(dup)
+ 55b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <getpid>:
+SYSCALL(getpid)
+ 563:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <sbrk>:
+SYSCALL(sbrk)
+ 56b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <sleep>:
+SYSCALL(sleep)
+ 573:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <uptime>:
+SYSCALL(uptime)
+ 57b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <trace>:
+SYSCALL(trace)
+ 583:	b8 16 00 00 00       	mov    $0x16,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <csinfo>:
+SYSCALL(csinfo)
+ 58b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <settickets>:
+SYSCALL(settickets)
+ 593:	b8 18 00 00 00       	mov    $0x18,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <getprocessesinfo>:
+SYSCALL(getprocessesinfo)
+ 59b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <yield>:
+SYSCALL(yield)
+ 5a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <random>:
+SYSCALL(random)
+ 5ab:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <dumppagetable>:
+SYSCALL(dumppagetable)
+ 5b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <getcpusinfo>:
+SYSCALL(getcpusinfo)
+ 5bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <setsched>:
+SYSCALL(setsched)
+ 5c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <getbcacheinfo>:
+SYSCALL(getbcacheinfo)
+ 5cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <getballocinfo>:
+SYSCALL(getballocinfo)
+ 5d3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <getfaultinfo>:
+SYSCALL(getfaultinfo)
+ 5db:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+ 5e3:	66 90                	xchg   %ax,%ax
+ 5e5:	66 90                	xchg   %ax,%ax
+ 5e7:	66 90                	xchg   %ax,%ax
+ 5e9:	66 90                	xchg   %ax,%ax
+ 5eb:	66 90                	xchg   %ax,%ax
+ 5ed:	66 90                	xchg   %ax,%ax
+ 5ef:	90                   	nop
+
+000005f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	56                   	push   %esi
+ 5f5:	53                   	push   %ebx
+ 5f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5f8:	89 d1                	mov    %edx,%ecx
+{
+ 5fa:	83 ec 3c             	sub    $0x3c,%esp
+ 5fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 600:	85 d2                	test   %edx,%edx
+ 602:	0f 89 80 00 00 00    	jns    688 <printint+0x98>
+ 608:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 60c:	74 7a                	je     688 <printint+0x98>
+    x = -xx;
+ 60e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 610:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 615:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 618:	31 f6                	xor    %esi,%esi
+ 61a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 620:	89 c8                	mov    %ecx,%eax
+ 622:	31 d2                	xor    %edx,%edx
+ 624:	89 f7                	mov    %esi,%edi
+ 626:	f7 f3                	div    %ebx
+ 628:	8d 76 01             	lea    0x1(%esi),%esi
+ 62b:	0f b6 92 d0 0a 00 00 	movzbl 0xad0(%edx),%edx
+ 632:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 636:	89 ca                	mov    %ecx,%edx
+ 638:	89 c1                	mov    %eax,%ecx
+ 63a:	39 da                	cmp    %ebx,%edx
+ 63c:	73 e2                	jae    620 <printint+0x30>
+  if(neg)
+ 63e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 641:	85 c0                	test   %eax,%eax
+ 643:	74 07                	je     64c <printint+0x5c>
+    buf[i++] = '-';
+ 645:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 64a:	89 f7                	mov    %esi,%edi
+ 64c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 64f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 652:	01 df                	add    %ebx,%edi
+ 654:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 658:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 65b:	83 ec 04             	sub    $0x4,%esp
+ 65e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 661:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 664:	6a 01                	push   $0x1
+ 666:	50                   	push   %eax
+ 667:	56                   	push   %esi
+ 668:	e8 96 fe ff ff       	call   503 <write>
+  while(--i >= 0)
+ 66d:	89 f8                	mov    %edi,%eax
+ 66f:	83 c4 10             	add    $0x10,%esp
+ 672:	83 ef 01             	sub    $0x1,%edi
+ 675:	39 d8                	cmp    %ebx,%eax
+ 677:	75 df                	jne    658 <printint+0x68>
+}
+ 679:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 67c:	5b                   	pop    %ebx
+ 67d:	5e                   	pop    %esi
+ 67e:	5f                   	pop    %edi
+ 67f:	5d                   	pop    %ebp
+ 680:	c3                   	ret
+ 681:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 688:	31 c0                	xor    %eax,%eax
+ 68a:	eb 89                	jmp    615 <printint+0x25>
+ 68c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000690 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	57                   	push   %edi
+ 694:	56                   	push   %esi
+ 695:	53                   	push   %ebx
+ 696:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 699:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 69c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 69f:	0f b6 1e             	movzbl (%esi),%ebx
+ 6a2:	83 c6 01             	add    $0x1,%esi
+ 6a5:	84 db                	test   %bl,%bl
+ 6a7:	74 67                	je     710 <printf+0x80>
+ 6a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6ac:	31 d2                	xor    %edx,%edx
+ 6ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6b1:	eb 34                	jmp    6e7 <printf+0x57>
+ 6b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6b7:	90                   	nop
+ 6b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6c0:	83 f8 25             	cmp    $0x25,%eax
+ 6c3:	74 18                	je     6dd <printf+0x4d>
+  write(fd, &c, 1);
+ 6c5:	83 ec 04             	sub    $0x4,%esp
+ 6c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ce:	6a 01                	push   $0x1
+ 6d0:	50                   	push   %eax
+ 6d1:	57                   	push   %edi
+ 6d2:	e8 2c fe ff ff       	call   503 <write>
+ 6d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6dd:	0f b6 1e             	movzbl (%esi),%ebx
+ 6e0:	83 c6 01             	add    $0x1,%esi
+ 6e3:	84 db                	test   %bl,%bl
+ 6e5:	74 29                	je     710 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6ea:	85 d2                	test   %edx,%edx
+ 6ec:	74 ca                	je     6b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6ee:	83 fa 25             	cmp    $0x25,%edx
+ 6f1:	75 ea                	jne    6dd <printf+0x4d>
+      if(c == 'd'){
+ 6f3:	83 f8 25             	cmp    $0x25,%eax
+ 6f6:	0f 84 24 01 00 00    	je     820 <printf+0x190>
+ 6fc:	83 e8 63             	sub    $0x63,%eax
+ 6ff:	83 f8 15             	cmp    $0x15,%eax
+ 702:	77 1c                	ja     720 <printf+0x90>
+ 704:	ff 24 85 78 0a 00 00 	jmp    *0xa78(,%eax,4)
+ 70b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 70f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 710:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 713:	5b                   	pop    %ebx
+ 714:	5e                   	pop    %esi
+ 715:	5f                   	pop    %edi
+ 716:	5d                   	pop    %ebp
+ 717:	c3                   	ret
+ 718:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71f:	90                   	nop
+  write(fd, &c, 1);
+ 720:	83 ec 04             	sub    $0x4,%esp
+ 723:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 726:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 72a:	6a 01                	push   $0x1
+ 72c:	52                   	push   %edx
+ 72d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 730:	57                   	push   %edi
+ 731:	e8 cd fd ff ff       	call   503 <write>
+ 736:	83 c4 0c             	add    $0xc,%esp
+ 739:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 73c:	6a 01                	push   $0x1
+ 73e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 741:	52                   	push   %edx
+ 742:	57                   	push   %edi
+ 743:	e8 bb fd ff ff       	call   503 <write>
+        putc(fd, c);
+ 748:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 74b:	31 d2                	xor    %edx,%edx
+ 74d:	eb 8e                	jmp    6dd <printf+0x4d>
+ 74f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 750:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 753:	83 ec 0c             	sub    $0xc,%esp
+ 756:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 75b:	8b 13                	mov    (%ebx),%edx
+ 75d:	6a 00                	push   $0x0
+ 75f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 761:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 764:	e8 87 fe ff ff       	call   5f0 <printint>
+        ap++;
+ 769:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 76c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 76f:	31 d2                	xor    %edx,%edx
+ 771:	e9 67 ff ff ff       	jmp    6dd <printf+0x4d>
+ 776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 780:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 783:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 785:	83 c0 04             	add    $0x4,%eax
+ 788:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 78b:	85 db                	test   %ebx,%ebx
+ 78d:	0f 84 9d 00 00 00    	je     830 <printf+0x1a0>
+        while(*s != 0){
+ 793:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 796:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 798:	84 c0                	test   %al,%al
+ 79a:	0f 84 3d ff ff ff    	je     6dd <printf+0x4d>
+ 7a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7a6:	89 de                	mov    %ebx,%esi
+ 7a8:	89 d3                	mov    %edx,%ebx
+ 7aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7b0:	83 ec 04             	sub    $0x4,%esp
+ 7b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7b9:	6a 01                	push   $0x1
+ 7bb:	53                   	push   %ebx
+ 7bc:	57                   	push   %edi
+ 7bd:	e8 41 fd ff ff       	call   503 <write>
+        while(*s != 0){
+ 7c2:	0f b6 06             	movzbl (%esi),%eax
+ 7c5:	83 c4 10             	add    $0x10,%esp
+ 7c8:	84 c0                	test   %al,%al
+ 7ca:	75 e4                	jne    7b0 <printf+0x120>
+      state = 0;
+ 7cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7cf:	31 d2                	xor    %edx,%edx
+ 7d1:	e9 07 ff ff ff       	jmp    6dd <printf+0x4d>
+ 7d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7e3:	83 ec 0c             	sub    $0xc,%esp
+ 7e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7eb:	8b 13                	mov    (%ebx),%edx
+ 7ed:	6a 01                	push   $0x1
+ 7ef:	e9 6b ff ff ff       	jmp    75f <printf+0xcf>
+ 7f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7fb:	83 ec 04             	sub    $0x4,%esp
+ 7fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 801:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 803:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 806:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 809:	6a 01                	push   $0x1
+ 80b:	52                   	push   %edx
+ 80c:	57                   	push   %edi
+ 80d:	e8 f1 fc ff ff       	call   503 <write>
+        ap++;
+ 812:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 815:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 818:	31 d2                	xor    %edx,%edx
+ 81a:	e9 be fe ff ff       	jmp    6dd <printf+0x4d>
+ 81f:	90                   	nop
+  write(fd, &c, 1);
+ 820:	83 ec 04             	sub    $0x4,%esp
+ 823:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 826:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 829:	6a 01                	push   $0x1
+ 82b:	e9 11 ff ff ff       	jmp    741 <printf+0xb1>
+ 830:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 835:	bb 6e 0a 00 00       	mov    $0xa6e,%ebx
+ 83a:	e9 61 ff ff ff       	jmp    7a0 <printf+0x110>
+ 83f:	90                   	nop
+
+00000840 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 840:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 841:	a1 e0 0d 00 00       	mov    0xde0,%eax
+{
+ 846:	89 e5                	mov    %esp,%ebp
+ 848:	57                   	push   %edi
+ 849:	56                   	push   %esi
+ 84a:	53                   	push   %ebx
+ 84b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 84e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 851:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 858:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 85a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 85c:	39 ca                	cmp    %ecx,%edx
+ 85e:	73 30                	jae    890 <free+0x50>
+ 860:	39 c1                	cmp    %eax,%ecx
+ 862:	72 04                	jb     868 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 864:	39 c2                	cmp    %eax,%edx
+ 866:	72 f0                	jb     858 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 868:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 86b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 86e:	39 f8                	cmp    %edi,%eax
+ 870:	74 2e                	je     8a0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 872:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 875:	8b 42 04             	mov    0x4(%edx),%eax
+ 878:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 87b:	39 f1                	cmp    %esi,%ecx
+ 87d:	74 38                	je     8b7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 87f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 881:	5b                   	pop    %ebx
+  freep = p;
+ 882:	89 15 e0 0d 00 00    	mov    %edx,0xde0
+}
+ 888:	5e                   	pop    %esi
+ 889:	5f                   	pop    %edi
+ 88a:	5d                   	pop    %ebp
+ 88b:	c3                   	ret
+ 88c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 890:	39 c1                	cmp    %eax,%ecx
+ 892:	72 d0                	jb     864 <free+0x24>
+ 894:	eb c2                	jmp    858 <free+0x18>
+ 896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8a0:	03 70 04             	add    0x4(%eax),%esi
+ 8a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8a6:	8b 02                	mov    (%edx),%eax
+ 8a8:	8b 00                	mov    (%eax),%eax
+ 8aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8ad:	8b 42 04             	mov    0x4(%edx),%eax
+ 8b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8b3:	39 f1                	cmp    %esi,%ecx
+ 8b5:	75 c8                	jne    87f <free+0x3f>
+    p->s.size += bp->s.size;
+ 8b7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8ba:	89 15 e0 0d 00 00    	mov    %edx,0xde0
+    p->s.size += bp->s.size;
+ 8c0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8c3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8c6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8c8:	5b                   	pop    %ebx
+ 8c9:	5e                   	pop    %esi
+ 8ca:	5f                   	pop    %edi
+ 8cb:	5d                   	pop    %ebp
+ 8cc:	c3                   	ret
+ 8cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008d0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	57                   	push   %edi
+ 8d4:	56                   	push   %esi
+ 8d5:	53                   	push   %ebx
+ 8d6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8dc:	8b 15 e0 0d 00 00    	mov    0xde0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8e2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8e5:	c1 ef 03             	shr    $0x3,%edi
+ 8e8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8eb:	85 d2                	test   %edx,%edx
+ 8ed:	0f 84 8d 00 00 00    	je     980 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8f3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8f5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8f8:	39 f9                	cmp    %edi,%ecx
+ 8fa:	73 64                	jae    960 <malloc+0x90>
+  if(nu < 4096)
+ 8fc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 901:	39 df                	cmp    %ebx,%edi
+ 903:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 906:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 90d:	eb 0a                	jmp    919 <malloc+0x49>
+ 90f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 910:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 912:	8b 48 04             	mov    0x4(%eax),%ecx
+ 915:	39 f9                	cmp    %edi,%ecx
+ 917:	73 47                	jae    960 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 919:	89 c2                	mov    %eax,%edx
+ 91b:	39 05 e0 0d 00 00    	cmp    %eax,0xde0
+ 921:	75 ed                	jne    910 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 923:	83 ec 0c             	sub    $0xc,%esp
+ 926:	56                   	push   %esi
+ 927:	e8 3f fc ff ff       	call   56b <sbrk>
+  if(p == (char*)-1)
+ 92c:	83 c4 10             	add    $0x10,%esp
+ 92f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 932:	74 1c                	je     950 <malloc+0x80>
+  hp->s.size = nu;
+ 934:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 937:	83 ec 0c             	sub    $0xc,%esp
+ 93a:	83 c0 08             	add    $0x8,%eax
+ 93d:	50                   	push   %eax
+ 93e:	e8 fd fe ff ff       	call   840 <free>
+  return freep;
+ 943:	8b 15 e0 0d 00 00    	mov    0xde0,%edx
+      if((p = morecore(nunits)) == 0)
+ 949:	83 c4 10             	add    $0x10,%esp
+ 94c:	85 d2                	test   %edx,%edx
+ 94e:	75 c0                	jne    910 <malloc+0x40>
+        return 0;
+  }
+}
+ 950:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 953:	31 c0                	xor    %eax,%eax
+}
+ 955:	5b                   	pop    %ebx
+ 956:	5e                   	pop    %esi
+ 957:	5f                   	pop    %edi
+ 958:	5d                   	pop    %ebp
+ 959:	c3                   	ret
+ 95a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 960:	39 cf                	cmp    %ecx,%edi
+ 962:	74 4c                	je     9b0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 964:	29 f9                	sub    %edi,%ecx
+ 966:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 969:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 96c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 96f:	89 15 e0 0d 00 00    	mov    %edx,0xde0
+}
+ 975:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 978:	83 c0 08             	add    $0x8,%eax
+}
+ 97b:	5b                   	pop    %ebx
+ 97c:	5e                   	pop    %esi
+ 97d:	5f                   	pop    %edi
+ 97e:	5d                   	pop    %ebp
+ 97f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 980:	c7 05 e0 0d 00 00 e4 	movl   $0xde4,0xde0
+ 987:	0d 00 00 
+    base.s.size = 0;
+ 98a:	b8 e4 0d 00 00       	mov    $0xde4,%eax
+    base.s.ptr = freep = prevp = &base;
+ 98f:	c7 05 e4 0d 00 00 e4 	movl   $0xde4,0xde4
+ 996:	0d 00 00 
+    base.s.size = 0;
+ 999:	c7 05 e8 0d 00 00 00 	movl   $0x0,0xde8
+ 9a0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9a3:	e9 54 ff ff ff       	jmp    8fc <malloc+0x2c>
+ 9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9b0:	8b 08                	mov    (%eax),%ecx
+ 9b2:	89 0a                	mov    %ecx,(%edx)
+ 9b4:	eb b9                	jmp    96f <malloc+0x9f>
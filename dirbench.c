@@ -0,0 +1,81 @@
+// Large directory benchmark.
+// Creates NFILE files in one directory, BATCH at a time, and after
+// each batch reports the ticks the batch's creates took and the
+// ticks BATCH lookups of names that are not there take, so the
+// cost of create and lookup can be followed as the directory grows.
+// The names looked up are all different, so the name cache cannot
+// answer them.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define NFILE  2000
+#define BATCH  250
+
+char path[32];
+
+// Set path to "db/<c>nnnn".
+void
+mkname(char c, int i)
+{
+  strcpy(path, "db/");
+  path[3] = c;
+  path[4] = '0' + i / 1000;
+  path[5] = '0' + (i / 100) % 10;
+  path[6] = '0' + (i / 10) % 10;
+  path[7] = '0' + i % 10;
+  path[8] = 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, n, fd, miss;
+  uint start, create, lookup;
+
+  n = NFILE;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  if(n > 10000)
+    n = 10000;
+
+  if(mkdir("db") < 0){
+    printf(1, "dirbench: mkdir db failed\n");
+    exit();
+  }
+  printf(1, "dirbench: files  create-ticks  lookup-ticks (per %d)\n", BATCH);
+  miss = 0;
+  for(i = 0; i < n; ){
+    start = uptime();
+    do {
+      mkname('f', i);
+      if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+        printf(1, "dirbench: create %s failed\n", path);
+        exit();
+      }
+      close(fd);
+    } while(++i < n && i % BATCH != 0);
+    create = uptime() - start;
+
+    start = uptime();
+    for(j = 0; j < BATCH; j++, miss++){
+      mkname('m', miss % 10000);
+      if(open(path, O_RDONLY) >= 0){
+        printf(1, "dirbench: open %s succeeded\n", path);
+        exit();
+      }
+    }
+    lookup = uptime() - start;
+    printf(1, "dirbench: %d  %d  %d\n", i, create, lookup);
+  }
+
+  for(i = 0; i < n; i++){
+    mkname('f', i);
+    unlink(path);
+  }
+  unlink("db");
+  printf(1, "dirbench done\n");
+  exit();
+}
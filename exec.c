@@ -2,6 +2,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "defs.h"
 #include "x86.h"
@@ -11,11 +12,12 @@ int
 exec(char *path, char **argv)
 {
   char *s, *last;
-  int i, off;
+  int i, off, nseg;
   uint argc, sz, sp, ustack[3+MAXARG+1];
   struct elfhdr elf;
-  struct inode *ip;
+  struct inode *ip, *exe, *oldexe;
   struct proghdr ph;
+  struct segment seg[NSEG];
   pde_t *pgdir, *oldpgdir;
 
   begin_op();
@@ -26,6 +28,7 @@ exec(char *path, char **argv)
   }
   ilock(ip);
   pgdir = 0;
+  exe = 0;
 
   // Check ELF header
   if(readi(ip, (char*)&elf, 0, sizeof(elf)) < sizeof(elf))
@@ -36,8 +39,11 @@ exec(char *path, char **argv)
   if((pgdir = setupkvm()) == 0)
     goto bad;
 
-  // Load program into memory.
+  // Note where each segment is in the file.  Pages are read in
+  // when the program first touches them, see loadpage().
   sz = 0;
+  nseg = 0;
+  memset(seg, 0, sizeof(seg));
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
@@ -45,17 +51,26 @@ exec(char *path, char **argv)
       continue;
     if(ph.memsz < ph.filesz)
       goto bad;
-    if(ph.vaddr + ph.memsz < ph.vaddr)
-      goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+    if(ph.vaddr + ph.memsz < ph.vaddr || ph.vaddr + ph.memsz >= KERNBASE)
       goto bad;
     if(ph.vaddr % PGSIZE != 0)
       goto bad;
-    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+    if(ph.memsz == 0)
+      continue;
+    if(nseg == NSEG || ph.off + ph.filesz < ph.off)
       goto bad;
+    seg[nseg].va = ph.vaddr;
+    seg[nseg].memsz = ph.memsz;
+    seg[nseg].off = ph.off;
+    seg[nseg].filesz = ph.filesz;
+    nseg++;
+    if(ph.vaddr + ph.memsz > sz)
+      sz = ph.vaddr + ph.memsz;
   }
-  iunlockput(ip);
+  iexec(ip, 1);
+  iunlock(ip);
   end_op();
+  exe = ip;
   ip = 0;
 
   // Allocate two pages at the next page boundary.
@@ -93,12 +108,21 @@ exec(char *path, char **argv)
 
   // Commit to the user image.
   oldpgdir = proc->pgdir;
+  oldexe = proc->exe;
   proc->pgdir = pgdir;
   proc->sz = sz;
+  proc->exe = exe;
+  memmove(proc->seg, seg, sizeof(seg));
   proc->tf->eip = elf.entry;  // main
   proc->tf->esp = sp;
   switchuvm(proc);
   freevm(oldpgdir);
+  if(oldexe){
+    iexec(oldexe, -1);
+    begin_op();
+    iput(oldexe);
+    end_op();
+  }
   return 0;
 
  bad:
@@ -108,5 +132,11 @@ exec(char *path, char **argv)
     iunlockput(ip);
     end_op();
   }
+  if(exe){
+    iexec(exe, -1);
+    begin_op();
+    iput(exe);
+    end_op();
+  }
   return -1;
 }
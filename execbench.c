@@ -0,0 +1,56 @@
+// Exec latency benchmark.
+// Times fork+exec+exit+wait of the largest program, usertests,
+// which exits as soon as it starts when given -x, and of itself,
+// a small program, the same way for comparison.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NEXEC 100
+
+char *bigargv[] = { "usertests", "-x", 0 };
+char *smallargv[] = { "execbench", "-x", 0 };
+
+void
+run(char **argv, int n)
+{
+  int i, pid;
+  uint start, elapsed;
+
+  start = uptime();
+  for(i = 0; i < n; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(1, "execbench: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec(argv[0], argv);
+      printf(1, "execbench: exec %s failed\n", argv[0]);
+      exit();
+    }
+    wait();
+  }
+  elapsed = uptime() - start;
+
+  printf(1, "execbench: %d execs of %s in %d ticks", n, argv[0], elapsed);
+  if(elapsed > 0)
+    printf(1, " (%d execs/100 ticks)", n * 100 / elapsed);
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  int n;
+
+  if(argc > 1 && strcmp(argv[1], "-x") == 0)
+    exit();
+  n = NEXEC;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  run(bigargv, n);
+  run(smallargv, n);
+  exit();
+}
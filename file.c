@@ -130,7 +130,7 @@ filewrite(struct file *f, char *addr, int n)
     // and 2 blocks of slop for non-aligned writes.
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
-    int max = ((LOGSIZE-1-1-2) / 2) * 512;
+    int max = ((logopblocks()-1-1-2) / 2) * BSIZE;
     int i = 0;
     while(i < n){
       int n1 = n - i;
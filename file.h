@@ -14,17 +14,27 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  int nexec;          // Processes running it; set under icache.lock, see iexec()
   struct sleeplock lock;
   int flags;          // I_VALID
+  struct inode *hnext;  // Hash chain, see iget()
+  struct inode *prev;   // Free list, while ref is 0
+  struct inode *next;
+  uint ranext;        // Block after the last one readi() read
+  uint rawin;         // Read-ahead window, in blocks
+  uint raend;         // Blocks before this have been read ahead
 
   short type;         // copy of disk inode
   short major;
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint addrs[NDIRECT+2];
+  uint mapgrp;        // 1 + which run of NINDIRECT blocks map[] holds, or 0
+  uint map[NINDIRECT];  // Copy of that run's indirect block, see bmap()
 };
 #define I_VALID 0x2
+#define I_TEXT  0x4  // Has pages in the text cache, see textpurge()
 
 // table mapping major device number to
 // device functions
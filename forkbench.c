@@ -0,0 +1,62 @@
+// Fork latency benchmark.
+// Grows the heap to a few MB, touches every page, then times
+// fork+exit+wait of the whole address space, and reports how
+// many of the zeroed pages (page tables, mostly) came cleared
+// ahead of time from the idle loop.
+
+#include "types.h"
+#include "stat.h"
+#include "mmu.h"
+#include "param.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "user.h"
+
+#define MB      (1024*1024)
+#define HEAPSZ  (4*MB)
+#define NFORK   200
+
+int
+main(int argc, char *argv[])
+{
+  int i, n, pid;
+  uint start, elapsed;
+  char *a, *p;
+  struct fault_info before, after;
+
+  n = NFORK;
+  if(argc > 1)
+    n = atoi(argv[1]);
+
+  a = sbrk(HEAPSZ);
+  if(a == (char*)-1){
+    printf(1, "forkbench: sbrk failed\n");
+    exit();
+  }
+  for(p = a; p < a + HEAPSZ; p += PGSIZE)
+    *p = 1;
+
+  getfaultinfo(&before);
+  start = uptime();
+  for(i = 0; i < n; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(1, "forkbench: fork failed\n");
+      exit();
+    }
+    if(pid == 0)
+      exit();
+    wait();
+  }
+  elapsed = uptime() - start;
+  getfaultinfo(&after);
+
+  printf(1, "forkbench: %d forks of a %d KB process in %d ticks",
+         n, (uint)sbrk(0) / 1024, elapsed);
+  if(elapsed > 0)
+    printf(1, " (%d forks/100 ticks)", n * 100 / elapsed);
+  printf(1, "\n");
+  printf(1, "forkbench: %d zeroed pages from the idle pool, %d cleared on demand\n",
+         after.zpool - before.zpool, after.zclear - before.zclear);
+  exit();
+}
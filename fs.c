@@ -14,15 +14,26 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 #include "file.h"
+#include "x86.h"
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define RAMIN 4   // blocks read ahead after the first sequential read
+#define RAMAX 32  // largest read-ahead window, in blocks
+#define NBITMAP 1024  // most bitmap blocks the allocator can summarize
+#define NIHASH 61     // inode cache hash buckets (prime)
+#define DIRSPLIT 4    // longest bucket dirsplit() will split, in blocks
+#define DIRXOP (2*DIRFLAT + 2*DIRSPLIT + 8)  // blocks dirlink() may add to a transaction
+#define IHASH(dev, inum) (((dev) * 31 + (inum)) % NIHASH)
 static void itrunc(struct inode*);
+static void dcacheinit(void);
+static void dcachepurge(uint, uint);
 // there should be one superblock per disk device, but we run with
 // only one device
 struct superblock sb; 
@@ -51,25 +62,98 @@ bzero(int dev, int bno)
 }
 
 // Blocks.
+//
+// The allocator keeps in memory the number of free blocks each
+// bitmap block describes, so balloc() never reads a full bitmap
+// block, and a hint of where to start looking: just past the
+// block it last allocated.  A caller growing a file passes the
+// block after the file's previous one as a goal, and balloc()
+// takes the first free block at or after it, so files come out
+// contiguous on disk when free space allows.
+// The counts change only while the bitmap block they describe
+// is locked.
 
-// Allocate a zeroed disk block.
-static uint
-balloc(uint dev)
+struct {
+  struct spinlock lock;
+  uint nbmap;            // Bitmap blocks
+  uint nfree[NBITMAP];   // Free blocks described by each
+  uint hint;             // Where to search when there is no goal
+  uint allocs;           // Statistics, see ballocinfo()
+  uint wanted;
+  uint contig;
+  unsigned long long cycles;
+} bcount;
+
+// Count the free blocks.  Runs once at boot, after the log has
+// been recovered.
+void
+ballocinit(int dev)
 {
-  int b, bi, m;
+  int g, bi;
   struct buf *bp;
 
-  bp = 0;
-  for(b = 0; b < sb.size; b += BPB){
-    bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+  initlock(&bcount.lock, "bcount");
+  bcount.nbmap = (sb.size + BPB - 1) / BPB;
+  if(bcount.nbmap > NBITMAP)
+    panic("ballocinit: too many bitmap blocks");
+  for(g = 0; g < bcount.nbmap; g++){
+    bp = bread(dev, sb.bmapstart + g);
+    for(bi = 0; bi < BPB && g*BPB + bi < sb.size; bi++)
+      if((bp->data[bi/8] & (1 << (bi % 8))) == 0)
+        bcount.nfree[g]++;
+    brelse(bp);
+  }
+  bcount.hint = sb.bmapstart + bcount.nbmap;
+}
+
+// Allocate a zeroed disk block, the first free one at or after
+// goal if goal is not 0.
+static uint
+balloc(uint dev, uint goal)
+{
+  int i, g, b, bi, m;
+  struct buf *bp;
+  unsigned long long start;
+
+  start = rdtsc();
+  b = goal;
+  if(b == 0 || b >= sb.size)
+    b = bcount.hint;
+
+  // Try the rest of b's bitmap block, the blocks after it, and
+  // finally the start of b's bitmap block again.
+  for(i = 0; i <= bcount.nbmap; i++){
+    g = (b/BPB + i) % bcount.nbmap;
+    if(bcount.nfree[g] == 0)
+      continue;
+    bp = bread(dev, sb.bmapstart + g);
+    for(bi = i == 0 ? b%BPB : 0; bi < BPB && g*BPB + bi < sb.size; bi++){
+      if(bi%8 == 0 && bp->data[bi/8] == 0xff){
+        bi += 7;
+        continue;
+      }
       m = 1 << (bi % 8);
       if((bp->data[bi/8] & m) == 0){  // Is block free?
         bp->data[bi/8] |= m;  // Mark block in use.
         log_write(bp);
+        b = g*BPB + bi;
+        acquire(&bcount.lock);
+        bcount.nfree[g]--;
+        bcount.hint = b + 1;
+        release(&bcount.lock);
         brelse(bp);
-        bzero(dev, b + bi);
-        return b + bi;
+        bzero(dev, b);
+
+        acquire(&bcount.lock);
+        bcount.allocs++;
+        if(goal){
+          bcount.wanted++;
+          if(b == goal)
+            bcount.contig++;
+        }
+        bcount.cycles += rdtsc() - start;
+        release(&bcount.lock);
+        return b;
       }
     }
     brelse(bp);
@@ -92,9 +176,48 @@ bfree(int dev, uint b)
     panic("freeing free block");
   bp->data[bi/8] &= ~m;
   log_write(bp);
+  acquire(&bcount.lock);
+  bcount.nfree[b/BPB]++;
+  release(&bcount.lock);
   brelse(bp);
 }
 
+// Report allocator statistics, and how fragmented free space is.
+void
+ballocinfo(int dev, struct balloc_info *bi)
+{
+  int g, i, run;
+  uint b;
+  struct buf *bp;
+
+  acquire(&bcount.lock);
+  bi->nfree = 0;
+  for(g = 0; g < bcount.nbmap; g++)
+    bi->nfree += bcount.nfree[g];
+  bi->allocs = bcount.allocs;
+  bi->wanted = bcount.wanted;
+  bi->contig = bcount.contig;
+  bi->cycles = bcount.cycles;
+  release(&bcount.lock);
+
+  bi->nblocks = sb.nblocks;
+  bi->nextent = bi->maxextent = 0;
+  run = 0;
+  for(g = 0; g < bcount.nbmap; g++){
+    bp = bread(dev, sb.bmapstart + g);
+    for(i = 0; i < BPB && (b = g*BPB + i) < sb.size; i++){
+      if(bp->data[i/8] & (1 << (i % 8))){
+        run = 0;
+        continue;
+      }
+      if(run++ == 0)
+        bi->nextent++;
+      bi->maxextent = max(bi->maxextent, run);
+    }
+    brelse(bp);
+  }
+}
+
 // Inodes.
 //
 // An inode describes a single unnamed file.
@@ -120,18 +243,19 @@ bfree(int dev, uint b)
 //   is non-zero. ialloc() allocates, iput() frees if
 //   the link count has fallen to zero.
 //
-// * Referencing in cache: an entry in the inode cache
-//   is free if ip->ref is zero. Otherwise ip->ref tracks
-//   the number of in-memory pointers to the entry (open
-//   files and current directories). iget() to find or
-//   create a cache entry and increment its ref, iput()
-//   to decrement ref.
+// * Referencing in cache: ip->ref tracks the number of
+//   in-memory pointers to the entry (open files and current
+//   directories). iget() to find or create a cache entry and
+//   increment its ref, iput() to decrement ref. An entry
+//   whose ref is zero stays cached, on a free list in the
+//   order the references went away, until iget() recycles
+//   the least recently used one for a different inode.
 //
 // * Valid: the information (type, size, &c) in an inode
 //   cache entry is only correct when the I_VALID bit
 //   is set in ip->flags. ilock() reads the inode from
 //   the disk and sets I_VALID, while iput() clears
-//   I_VALID if ip->ref has fallen to zero.
+//   I_VALID when it frees the inode.
 //
 // * Locked: file system code may only examine and modify
 //   the information in an inode and its content if it
@@ -155,26 +279,66 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 
+// iget() finds entries through a hash table on (dev, inum).
+// icache.lock protects the table, the free list, and every
+// entry's dev, inum, ref and list pointers.
+//
+// ialloc() starts looking for a free on-disk inode at
+// icache.nextfree: every inode before it was in use when last
+// looked at, unless iput() has since freed one and moved the
+// hint back.
+
 struct {
   struct spinlock lock;
   struct inode inode[NINODE];
+  struct inode *bucket[NIHASH];  // Chains through hnext
+  struct inode free;             // free.next is least recently used
+  uint nextfree;                 // Where ialloc() starts
 } icache;
 
+// Remove ip from the free list.  Caller must hold icache.lock.
+static void
+iunfree(struct inode *ip)
+{
+  ip->next->prev = ip->prev;
+  ip->prev->next = ip->next;
+}
+
+// Add ip to the tail of the free list.  Caller must hold
+// icache.lock.
+static void
+ifree(struct inode *ip)
+{
+  ip->next = &icache.free;
+  ip->prev = icache.free.prev;
+  icache.free.prev->next = ip;
+  icache.free.prev = ip;
+}
+
 void
 iinit(int dev)
 {
   int i = 0;
   
   initlock(&icache.lock, "icache");
+  dcacheinit();
+  icache.free.next = icache.free.prev = &icache.free;
   for(i = 0; i < NINODE; i++) {
     initsleeplock(&icache.inode[i].lock, "inode");
+    ifree(&icache.inode[i]);
   }
+  icache.nextfree = 1;
   
   readsb(dev, &sb);
+  if(sb.bsize != BSIZE){
+    cprintf("iinit: file system block size %d, kernel's %d\n",
+            sb.bsize, BSIZE);
+    panic("iinit: block size");
+  }
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
- inodestart %d bmap start %d\n", sb.size, sb.nblocks,
+ inodestart %d bmap start %d bsize %d\n", sb.size, sb.nblocks,
           sb.ninodes, sb.nlog, sb.logstart, sb.inodestart,
-          sb.bmapstart);
+          sb.bmapstart, sb.bsize);
 }
 
 static struct inode* iget(uint dev, uint inum);
@@ -185,11 +349,18 @@ static struct inode* iget(uint dev, uint inum);
 struct inode*
 ialloc(uint dev, short type)
 {
-  int inum;
+  int i, inum, start;
   struct buf *bp;
   struct dinode *dip;
 
-  for(inum = 1; inum < sb.ninodes; inum++){
+  acquire(&icache.lock);
+  start = icache.nextfree;
+  release(&icache.lock);
+
+  // Look from the hint to the end, then wrap around: a free
+  // inode before the hint is rare but possible.
+  for(i = 0; i < sb.ninodes - 1; i++){
+    inum = 1 + (start - 1 + i) % (sb.ninodes - 1);
     bp = bread(dev, IBLOCK(inum, sb));
     dip = (struct dinode*)bp->data + inum%IPB;
     if(dip->type == 0){  // a free inode
@@ -197,6 +368,10 @@ ialloc(uint dev, short type)
       dip->type = type;
       log_write(bp);   // mark it allocated on the disk
       brelse(bp);
+      acquire(&icache.lock);
+      if(icache.nextfree <= inum)
+        icache.nextfree = inum + 1;
+      release(&icache.lock);
       return iget(dev, inum);
     }
     brelse(bp);
@@ -229,31 +404,42 @@ iupdate(struct inode *ip)
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip, **pp;
 
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
+  for(ip = icache.bucket[IHASH(dev, inum)]; ip; ip = ip->hnext){
+    if(ip->dev == dev && ip->inum == inum){
+      if(ip->ref++ == 0)
+        iunfree(ip);
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
+  // Recycle the least recently used unreferenced entry.
+  ip = icache.free.next;
+  if(ip == &icache.free)
     panic("iget: no inodes");
-
-  ip = empty;
+  iunfree(ip);
+  if(ip->flags & I_TEXT)
+    textpurge(ip->dev, ip->inum);
+  if(ip->inum){
+    pp = &icache.bucket[IHASH(ip->dev, ip->inum)];
+    while(*pp != ip)
+      pp = &(*pp)->hnext;
+    *pp = ip->hnext;
+  }
   ip->dev = dev;
   ip->inum = inum;
+  ip->hnext = icache.bucket[IHASH(dev, inum)];
+  icache.bucket[IHASH(dev, inum)] = ip;
   ip->ref = 1;
+  ip->nexec = 0;
   ip->flags = 0;
+  ip->ranext = ip->rawin = ip->raend = 0;
+  ip->mapgrp = 0;
   release(&icache.lock);
 
   return ip;
@@ -270,6 +456,23 @@ idup(struct inode *ip)
   return ip;
 }
 
+// Count delta more processes running ip as their program.
+// Processes page their program in from the file for as long as
+// they run (see loadpage()), so writei() refuses to change a
+// file while its count is above zero.  exec() raises the count
+// holding ip's lock, so a writei() that got the lock first
+// finishes before the program starts.  The caller must hold a
+// reference to ip for as long as it counts.
+void
+iexec(struct inode *ip, int delta)
+{
+  acquire(&icache.lock);
+  ip->nexec += delta;
+  if(ip->nexec < 0)
+    panic("iexec");
+  release(&icache.lock);
+}
+
 // Lock the given inode.
 // Reads the inode from disk if necessary.
 void
@@ -323,13 +526,18 @@ iput(struct inode *ip)
   if(ip->ref == 1 && (ip->flags & I_VALID) && ip->nlink == 0){
     // inode has no links and no other references: truncate and free.
     release(&icache.lock);
+    if(ip->type == T_DIR)
+      dcachepurge(ip->dev, ip->inum);
     itrunc(ip);
     ip->type = 0;
     iupdate(ip);
     acquire(&icache.lock);
     ip->flags = 0;
+    if(ip->inum < icache.nextfree)
+      icache.nextfree = ip->inum;
   }
-  ip->ref--;
+  if(--ip->ref == 0)
+    ifree(ip);
   release(&icache.lock);
 }
 
@@ -347,38 +555,113 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT].  The NINDIRECT*NINDIRECT
+// after those are listed, NINDIRECT at a time, in the blocks
+// listed in block ip->addrs[NDIRECT+1].
+//
+// Each run of NINDIRECT blocks past the direct ones is thus
+// listed in one indirect block; call run g's the g'th leaf.
+// The in-memory inode keeps a copy of the last leaf bmap()
+// used in ip->map, so sequential access reads each leaf once
+// instead of once per block.
+
+// Return the address of leaf g of ip, or 0 if it doesn't
+// exist and alloc is not set.
+static uint
+leaf(struct inode *ip, uint g, int alloc)
+{
+  uint addr, *a;
+  struct buf *bp;
+
+  if(g == 0){
+    if((addr = ip->addrs[NDIRECT]) == 0 && alloc)
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev, 0);
+    return addr;
+  }
+
+  // Load doubly-indirect block, allocating if necessary.
+  if((addr = ip->addrs[NDIRECT+1]) == 0){
+    if(!alloc)
+      return 0;
+    ip->addrs[NDIRECT+1] = addr = balloc(ip->dev, 0);
+  }
+  bp = bread(ip->dev, addr);
+  a = (uint*)bp->data;
+  if((addr = a[g-1]) == 0 && alloc){
+    a[g-1] = addr = balloc(ip->dev, 0);
+    log_write(bp);
+  }
+  brelse(bp);
+  return addr;
+}
 
 // Return the disk block address of the nth block in inode ip.
-// If there is no such block, bmap allocates one.
+// If there is no such block, bmap allocates one, preferably
+// the one after block n-1.
 static uint
 bmap(struct inode *ip, uint bn)
 {
-  uint addr, *a;
+  uint addr, g, prev;
   struct buf *bp;
 
   if(bn < NDIRECT){
-    if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+    if((addr = ip->addrs[bn]) == 0){
+      prev = bn > 0 ? ip->addrs[bn-1] : 0;
+      ip->addrs[bn] = addr = balloc(ip->dev, prev ? prev + 1 : 0);
+    }
     return addr;
   }
   bn -= NDIRECT;
 
-  if(bn < NINDIRECT){
-    // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
-    bp = bread(ip->dev, addr);
-    a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
-      log_write(bp);
-    }
-    brelse(bp);
-    return addr;
+  if(bn >= NINDIRECT + NINDIRECT*NINDIRECT)
+    panic("bmap: out of range");
+  g = bn / NINDIRECT;
+  bn %= NINDIRECT;
+
+  // Copy leaf g into ip->map unless it is there already.
+  // A leaf that doesn't exist yet maps nothing.
+  if(ip->mapgrp != g + 1){
+    if((addr = leaf(ip, g, 0)) != 0){
+      bp = bread(ip->dev, addr);
+      memmove(ip->map, bp->data, sizeof(ip->map));
+      brelse(bp);
+    } else
+      memset(ip->map, 0, sizeof(ip->map));
+    ip->mapgrp = g + 1;
   }
+  if((addr = ip->map[bn]) != 0)
+    return addr;
 
-  panic("bmap: out of range");
+  // Allocate the block, and the leaf if necessary, and
+  // record it in both the leaf and its copy.
+  if(bn > 0)
+    prev = ip->map[bn-1];
+  else
+    prev = g == 0 ? ip->addrs[NDIRECT-1] : 0;
+  bp = bread(ip->dev, leaf(ip, g, 1));
+  ((uint*)bp->data)[bn] = ip->map[bn] = addr =
+    balloc(ip->dev, prev ? prev + 1 : 0);
+  log_write(bp);
+  brelse(bp);
+  return addr;
+}
+
+// Free the blocks listed in indirect block addr, then addr.
+static void
+freeleaf(uint dev, uint addr)
+{
+  int j;
+  struct buf *bp;
+  uint *a;
+
+  bp = bread(dev, addr);
+  a = (uint*)bp->data;
+  for(j = 0; j < NINDIRECT; j++){
+    if(a[j])
+      bfree(dev, a[j]);
+  }
+  brelse(bp);
+  bfree(dev, addr);
 }
 
 // Truncate inode (discard contents).
@@ -393,6 +676,10 @@ itrunc(struct inode *ip)
   struct buf *bp;
   uint *a;
 
+  if(ip->flags & I_TEXT){
+    textpurge(ip->dev, ip->inum);
+    ip->flags &= ~I_TEXT;
+  }
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
       bfree(ip->dev, ip->addrs[i]);
@@ -401,17 +688,23 @@ itrunc(struct inode *ip)
   }
 
   if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+    freeleaf(ip->dev, ip->addrs[NDIRECT]);
+    ip->addrs[NDIRECT] = 0;
+  }
+
+  if(ip->addrs[NDIRECT+1]){
+    bp = bread(ip->dev, ip->addrs[NDIRECT+1]);
     a = (uint*)bp->data;
     for(j = 0; j < NINDIRECT; j++){
       if(a[j])
-        bfree(ip->dev, a[j]);
+        freeleaf(ip->dev, a[j]);
     }
     brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
+    bfree(ip->dev, ip->addrs[NDIRECT+1]);
+    ip->addrs[NDIRECT+1] = 0;
   }
 
+  ip->mapgrp = 0;
   ip->size = 0;
   iupdate(ip);
 }
@@ -428,11 +721,38 @@ stati(struct inode *ip, struct stat *st)
 }
 
 //PAGEBREAK!
+// Read-ahead.  A read that starts in the block where the previous
+// readi() of ip stopped (or the one after it) is sequential; each
+// sequential read doubles the window of blocks after it that are
+// fetched into the buffer cache without waiting, up to RAMAX.
+// Any other read closes the window until the pattern resumes.
+// Blocks [first, last] have just been read.  Caller holds ip->lock.
+static void
+readahead(struct inode *ip, uint first, uint last)
+{
+  uint bn, end;
+
+  if(first == ip->ranext || first + 1 == ip->ranext)
+    ip->rawin = ip->rawin ? min(2*ip->rawin, RAMAX) : RAMIN;
+  else
+    ip->rawin = ip->raend = 0;
+  ip->ranext = last + 1;
+  if(ip->rawin == 0)
+    return;
+
+  // Every block inside ip->size is allocated, so bmap()
+  // only looks up addresses here.
+  end = min(last + 1 + ip->rawin, (ip->size + BSIZE - 1) / BSIZE);
+  for(bn = max(ip->raend, last + 1); bn < end; bn++)
+    breadahead(ip->dev, bmap(ip, bn));
+  ip->raend = max(ip->raend, end);
+}
+
 // Read data from inode.
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, first;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -446,6 +766,7 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   if(off + n > ip->size)
     n = ip->size - off;
 
+  first = off/BSIZE;
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
@@ -459,6 +780,8 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
   }
+  if(n > 0)
+    readahead(ip, first, (off - 1)/BSIZE);
   return n;
 }
 
@@ -478,8 +801,14 @@ writei(struct inode *ip, char *src, uint off, uint n)
 
   if(off > ip->size || off + n < off)
     return -1;
-  if(off + n > MAXFILE*BSIZE)
+  if(n > 0 && (off + n - 1)/BSIZE >= MAXFILE)
     return -1;
+  if(ip->nexec > 0)
+    return -1;  // a running program, see iexec()
+  if(ip->flags & I_TEXT){
+    textpurge(ip->dev, ip->inum);
+    ip->flags &= ~I_TEXT;
+  }
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
@@ -505,39 +834,361 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+// Directory name cache.
+//
+// Remembers the result of recent lookups of a name in a
+// directory: the inode and the offset of its entry, or that
+// the directory has no such entry.  The table is direct-mapped
+// on (dev, directory, name); a new entry replaces whatever was
+// in its slot.  Entries are added and changed only with the
+// directory locked, by dirlookup(), dirlink() and sys_unlink(),
+// so they always match the directory contents.  namex() reads
+// them without locking the directory; see dcachelookup().
+// When a directory is freed, its entries are dropped, so that a
+// later directory with the same i-number starts afresh.
+
+struct dcentry {
+  uint dev;
+  uint dir;              // Directory i-number, 0 if slot unused
+  char name[DIRSIZ];
+  uint inum;             // Named i-number, 0 if no such entry
+  uint off;              // Offset of the entry in the directory
+};
+
+struct {
+  struct spinlock lock;
+  struct dcentry entry[NDCACHE];
+} dcache;
+
+static void
+dcacheinit(void)
+{
+  initlock(&dcache.lock, "dcache");
+}
+
+static struct dcentry*
+dcslot(uint dev, uint dir, char *name)
+{
+  uint h;
+  int i;
+
+  h = dev*31 + dir;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h*31 + name[i];
+  return &dcache.entry[h % NDCACHE];
+}
+
+// Record that name in directory dir names inode inum (0 if it
+// names nothing) at offset off.  Caller must hold the directory
+// locked.
+void
+dcacheput(uint dev, uint dir, char *name, uint inum, uint off)
+{
+  struct dcentry *e;
+
+  acquire(&dcache.lock);
+  e = dcslot(dev, dir, name);
+  e->dev = dev;
+  e->dir = dir;
+  strncpy(e->name, name, DIRSIZ);
+  e->inum = inum;
+  e->off = off;
+  release(&dcache.lock);
+}
+
+// Look up name in directory dp in the name cache.  On a hit,
+// set *ipp to a reference to the named inode, or 0 if dp has no
+// such entry, and *poff (if poff != 0) to the entry's offset, and
+// return 1.  Return 0 on a miss.
+// dp need not be locked: taking the inode reference under
+// dcache.lock means that the entry cannot be removed, and the
+// inode freed, in between.
+static int
+dcachelookup(struct inode *dp, char *name, struct inode **ipp, uint *poff)
+{
+  struct dcentry *e;
+
+  acquire(&dcache.lock);
+  e = dcslot(dp->dev, dp->inum, name);
+  if(e->dir != dp->inum || e->dev != dp->dev ||
+     namecmp(e->name, name) != 0){
+    release(&dcache.lock);
+    return 0;
+  }
+  *ipp = 0;
+  if(e->inum){
+    *ipp = iget(e->dev, e->inum);
+    if(poff)
+      *poff = e->off;
+  }
+  release(&dcache.lock);
+  return 1;
+}
+
+// Forget the entries of directory dir, which is being freed.
+static void
+dcachepurge(uint dev, uint dir)
+{
+  struct dcentry *e;
+
+  acquire(&dcache.lock);
+  for(e = dcache.entry; e < dcache.entry+NDCACHE; e++)
+    if(e->dev == dev && e->dir == dir)
+      e->dir = 0;
+  release(&dcache.lock);
+}
+
+// Indexed directories, see fs.h.  Callers hold dp locked.
+
+// Slot i of block 0's bucket table, and the link slot of a
+// bucket block.
+#define DIRTAB(de, i) (((ushort*)(de)[2 + (i)/DIRTPE].name)[(i)%DIRTPE])
+#define DIRNEXT(de)   (((ushort*)(de)[DPB-1].name)[0])
+
+// Add a zeroed block to the end of dp and return its number.
+static uint
+dirgrow(struct inode *dp)
+{
+  uint blk;
+
+  blk = dp->size / BSIZE;
+  bmap(dp, blk);  // balloc() zeroes it
+  dp->size += BSIZE;
+  iupdate(dp);
+  return blk;
+}
+
+// Return the first block of the bucket name hashes to.
+static uint
+dirchain(struct inode *dp, char *name)
+{
+  uint blk;
+  struct buf *bp;
+
+  bp = bread(dp->dev, bmap(dp, 0));
+  blk = DIRTAB((struct dirent*)bp->data,
+               dirbucket(dirhash(name), dp->minor));
+  brelse(bp);
+  return blk;
+}
+
+// Find name in indexed directory dp.  Return its inum and set
+// *poff to its offset, or return 0.
+static uint
+dirfind(struct inode *dp, char *name, uint *poff)
+{
+  int i, n;
+  uint blk, inum;
+  struct buf *bp;
+  struct dirent *de;
+
+  // "." and ".." are the first two slots of block 0.
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0){
+    blk = 0;
+    n = 2;
+  } else {
+    blk = dirchain(dp, name);
+    n = DPB - 1;
+  }
+  do {
+    bp = bread(dp->dev, bmap(dp, blk));
+    de = (struct dirent*)bp->data;
+    for(i = 0; i < n; i++){
+      if(de[i].inum && namecmp(name, de[i].name) == 0){
+        inum = de[i].inum;
+        brelse(bp);
+        *poff = blk*BSIZE + i*sizeof(*de);
+        return inum;
+      }
+    }
+    blk = n == 2 ? 0 : DIRNEXT(de);
+    brelse(bp);
+  } while(blk);
+  return 0;
+}
+
+// Add (name, inum) to the bucket starting at block blk,
+// lengthening it if it is full.  Return 1 if it grew.
+static int
+dirput(struct inode *dp, uint blk, char *name, uint inum)
+{
+  int i, grew;
+  struct buf *bp;
+  struct dirent *de;
+
+  grew = 0;
+  for(;;){
+    bp = bread(dp->dev, bmap(dp, blk));
+    de = (struct dirent*)bp->data;
+    for(i = 0; i < DPB - 1; i++){
+      if(de[i].inum == 0){
+        strncpy(de[i].name, name, DIRSIZ);
+        de[i].inum = inum;
+        log_write(bp);
+        brelse(bp);
+        dcacheput(dp->dev, dp->inum, name, inum, blk*BSIZE + i*sizeof(*de));
+        return grew;
+      }
+    }
+    if(DIRNEXT(de) == 0){
+      DIRNEXT(de) = dirgrow(dp);
+      log_write(bp);
+      grew = 1;
+    }
+    blk = DIRNEXT(de);
+    brelse(bp);
+  }
+}
+
+// Convert flat directory dp, of DIRFLAT blocks, to an indexed
+// directory of DIRFLAT buckets.  Returns -1 if there was no
+// memory to do it in.
+static int
+dirindex(struct inode *dp)
+{
+  int i, n;
+  uint blk;
+  struct buf *bp;
+  struct dirent *old, *de;
+
+  if((old = (struct dirent*)kalloc()) == 0)
+    return -1;
+  n = dp->size / sizeof(*old);
+  if(readi(dp, (char*)old, 0, dp->size) != dp->size)
+    panic("dirindex read");
+
+  dirgrow(dp);
+  for(blk = 0; blk < dp->size / BSIZE; blk++){
+    bp = bread(dp->dev, bmap(dp, blk));
+    de = (struct dirent*)bp->data;
+    memset(de, 0, BSIZE);
+    if(blk == 0){
+      de[0] = old[0];  // "."
+      de[1] = old[1];  // ".."
+      for(i = 0; i < DIRFLAT; i++)
+        DIRTAB(de, i) = i + 1;
+    }
+    log_write(bp);
+    brelse(bp);
+  }
+  dp->major = DIRINDEX;
+  dp->minor = DIRFLAT;
+  iupdate(dp);
+
+  for(i = 2; i < n; i++)
+    if(old[i].inum)
+      dirput(dp, dirchain(dp, old[i].name), old[i].name, old[i].inum);
+  kfree((char*)old);
+  return 0;
+}
+
+// Add a bucket to indexed directory dp by splitting the next
+// bucket in linear hashing order, unless that bucket is too
+// long to rewrite in one transaction or the table is full.
+static void
+dirsplit(struct inode *dp)
+{
+  int i, moved;
+  uint nb, p, s, n, first, nblk, blk, next;
+  struct buf *bp;
+  struct dirent *de;
+
+  nb = dp->minor;
+  if(nb >= DIRNTAB)
+    return;
+  for(p = 1; p*2 <= nb; p *= 2)
+    ;
+  s = nb - p;
+
+  bp = bread(dp->dev, bmap(dp, 0));
+  first = DIRTAB((struct dirent*)bp->data, s);
+  brelse(bp);
+  for(n = 0, blk = first; blk; n++){
+    bp = bread(dp->dev, bmap(dp, blk));
+    blk = DIRNEXT((struct dirent*)bp->data);
+    brelse(bp);
+  }
+  if(n > DIRSPLIT)
+    return;
+
+  nblk = dirgrow(dp);
+  bp = bread(dp->dev, bmap(dp, 0));
+  DIRTAB((struct dirent*)bp->data, nb) = nblk;
+  log_write(bp);
+  brelse(bp);
+  dp->minor = nb + 1;
+  iupdate(dp);
+
+  // Move the entries that now hash to the new bucket.
+  for(blk = first; blk; blk = next){
+    bp = bread(dp->dev, bmap(dp, blk));
+    de = (struct dirent*)bp->data;
+    moved = 0;
+    for(i = 0; i < DPB - 1; i++){
+      if(de[i].inum && dirbucket(dirhash(de[i].name), nb + 1) != s){
+        dirput(dp, nblk, de[i].name, de[i].inum);
+        memset(&de[i], 0, sizeof(de[i]));
+        moved = 1;
+      }
+    }
+    next = DIRNEXT(de);
+    if(moved)
+      log_write(bp);
+    brelse(bp);
+  }
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
+// Caller must hold dp locked.
 struct inode*
 dirlookup(struct inode *dp, char *name, uint *poff)
 {
   uint off, inum;
   struct dirent de;
+  struct inode *ip;
 
   if(dp->type != T_DIR)
     panic("dirlookup not DIR");
 
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlink read");
-    if(de.inum == 0)
-      continue;
-    if(namecmp(name, de.name) == 0){
-      // entry matches path element
-      if(poff)
-        *poff = off;
-      inum = de.inum;
-      return iget(dp->dev, inum);
+  if(dcachelookup(dp, name, &ip, poff))
+    return ip;
+
+  inum = 0;
+  if(dp->major == DIRINDEX)
+    inum = dirfind(dp, name, &off);
+  else {
+    for(off = 0; off < dp->size; off += sizeof(de)){
+      if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+        panic("dirlink read");
+      if(de.inum == 0)
+        continue;
+      if(namecmp(name, de.name) == 0){
+        // entry matches path element
+        inum = de.inum;
+        break;
+      }
     }
   }
 
-  return 0;
+  if(inum == 0){
+    dcacheput(dp->dev, dp->inum, name, 0, 0);
+    return 0;
+  }
+  if(poff)
+    *poff = off;
+  dcacheput(dp->dev, dp->inum, name, inum, off);
+  return iget(dp->dev, inum);
 }
 
 // Write a new directory entry (name, inum) into the directory dp.
+// Indexing a directory, or adding a bucket to one, writes up to
+// DIRXOP blocks, so neither is done unless log transactions
+// have room for that on top of MAXOPBLOCKS.
 int
 dirlink(struct inode *dp, char *name, uint inum)
 {
-  int off;
+  int off, room;
   struct dirent de;
   struct inode *ip;
 
@@ -547,6 +1198,13 @@ dirlink(struct inode *dp, char *name, uint inum)
     return -1;
   }
 
+  room = logopblocks() >= MAXOPBLOCKS + DIRXOP;
+  if(dp->major == DIRINDEX){
+    if(dirput(dp, dirchain(dp, name), name, inum) && room)
+      dirsplit(dp);
+    return 0;
+  }
+
   // Look for an empty dirent.
   for(off = 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
@@ -555,10 +1213,17 @@ dirlink(struct inode *dp, char *name, uint inum)
       break;
   }
 
+  if(off == dp->size && dp->size == DIRFLAT*BSIZE && room &&
+     dirindex(dp) == 0){
+    dirput(dp, dirchain(dp, name), name, inum);
+    return 0;
+  }
+
   strncpy(de.name, name, DIRSIZ);
   de.inum = inum;
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("dirlink");
+  dcacheput(dp->dev, dp->inum, name, inum, off);
 
   return 0;
 }
@@ -618,6 +1283,16 @@ namex(char *path, int nameiparent, char *name)
     ip = idup(proc->cwd);
 
   while((path = skipelem(path, name)) != 0){
+    // Most lookups hit in the name cache, and then need
+    // neither the directory's lock nor its contents.
+    if(!(nameiparent && *path == '\0') &&
+       dcachelookup(ip, name, &next, 0)){
+      iput(ip);
+      if(next == 0)
+        return 0;
+      ip = next;
+      continue;
+    }
     ilock(ip);
     if(ip->type != T_DIR){
       iunlockput(ip);
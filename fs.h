@@ -3,7 +3,18 @@
 
 
 #define ROOTINO 1  // root i-number
-#define BSIZE 512  // block size
+
+// Block size.  The kernel, mkfs and fsck must agree on it, so it
+// is a build parameter (make BSIZE=n, then make clean); mkfs
+// records it in the super block and the kernel checks it at boot.
+// A block is a whole number of disk sectors, and a buffer holds a
+// block in at most one page.
+#ifndef BSIZE
+#define BSIZE 512
+#endif
+#if BSIZE % 512 != 0 || BSIZE > 4096
+#error "BSIZE must be a multiple of 512 no larger than 4096"
+#endif
 
 // Disk layout:
 // [ boot block | super block | log | inode blocks |
@@ -19,11 +30,15 @@ struct superblock {
   uint logstart;     // Block number of first log block
   uint inodestart;   // Block number of first inode block
   uint bmapstart;    // Block number of first free map block
+  uint bsize;        // Block size (bytes)
 };
 
-#define NDIRECT 12
+// The log header block names at most this many log blocks.
+#define MAXLOGSLOTS (BSIZE / sizeof(uint) - 1)
+
+#define NDIRECT 11
 #define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+#define MAXFILE (NDIRECT + NINDIRECT + NINDIRECT*NINDIRECT)
 
 // On-disk inode structure
 struct dinode {
@@ -32,7 +47,8 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  uint addrs[NDIRECT+2];   // Data block addresses, then indirect
+                           // and doubly-indirect blocks
 };
 
 // Inodes per block.
@@ -55,3 +71,66 @@ struct dirent {
   char name[DIRSIZ];
 };
 
+// Indexed directories.
+//
+// A directory starts out flat, an array of dirents searched in
+// order.  When a flat directory of DIRFLAT full blocks needs
+// another entry, the kernel converts it to the indexed format,
+// which hashes names into buckets of blocks:
+//  - The inode's major is DIRINDEX and its minor is the number
+//    of buckets.  Buckets are added one at a time by linear
+//    hashing, see dirbucket().
+//  - Block 0 holds "." and ".." in its first two slots, then a
+//    table giving the first block of each bucket, DIRTPE block
+//    numbers to a slot.
+//  - Each other block belongs to one bucket.  Its last slot holds
+//    the number of the bucket's next block, or 0.
+// The table and link slots have inum 0, so code that reads a
+// directory as a flat array of dirents (ls, fsck, isdirempty())
+// skips them like free slots.
+#define DIRINDEX 1
+#define DPB      (BSIZE / sizeof(struct dirent))  // dirents per block
+#define DIRFLAT  (4096 / BSIZE)  // largest flat directory to convert (a page)
+#define DIRTPE   (DIRSIZ / sizeof(ushort))
+#define DIRNTAB  ((DPB - 2) * DIRTPE)  // most buckets
+
+// Hash a directory entry name (FNV-1a).
+static inline uint
+dirhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261u;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619;
+  return h;
+}
+
+// Return the bucket for hash h in a directory of nbucket buckets.
+// With p the largest power of two not above nbucket, buckets below
+// nbucket-p have already been split in two using h mod 2p, the
+// rest use h mod p.
+static inline uint
+dirbucket(uint h, uint nbucket)
+{
+  uint p;
+
+  for(p = 1; p*2 <= nbucket; p *= 2)
+    ;
+  if(h % (2*p) < nbucket)
+    return h % (2*p);
+  return h % p;
+}
+
+// Block allocator statistics, see getballocinfo().
+struct balloc_info {
+  uint nblocks;                // Data blocks in the file system
+  uint nfree;                  // ... that are free
+  uint nextent;                // Runs of consecutive free blocks
+  uint maxextent;              // Length of the longest run
+  uint allocs;                 // Calls to balloc()
+  uint wanted;                 // ... that asked for a particular block
+  uint contig;                 // ... and got it
+  unsigned long long cycles;   // Total cycles spent allocating
+};
@@ -0,0 +1,2840 @@
+
+_fsbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  unlink(path);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 60             	sub    $0x60,%esp
+  struct balloc_info before, after;
+  uint allocs, wanted;
+
+  printf(1, "fsbench: BSIZE %d, %d files of %d bytes, %d KB file\n",
+      14:	68 00 10 00 00       	push   $0x1000
+      19:	68 00 04 00 00       	push   $0x400
+      1e:	6a 64                	push   $0x64
+      20:	68 00 02 00 00       	push   $0x200
+      25:	68 74 17 00 00       	push   $0x1774
+      2a:	6a 01                	push   $0x1
+      2c:	e8 ef 12 00 00       	call   1320 <printf>
+         BSIZE, NSMALL, SMALLSZ, LARGESZ / 1024);
+  getballocinfo(&before);
+      31:	83 c4 14             	add    $0x14,%esp
+      34:	8d 45 a0             	lea    -0x60(%ebp),%eax
+      37:	50                   	push   %eax
+      38:	e8 26 12 00 00       	call   1263 <getballocinfo>
+  smallfiles();
+      3d:	e8 fe 09 00 00       	call   a40 <smallfiles>
+  largefile();
+      42:	e8 e9 0c 00 00       	call   d30 <largefile>
+  getballocinfo(&after);
+      47:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+      4a:	89 04 24             	mov    %eax,(%esp)
+      4d:	e8 11 12 00 00       	call   1263 <getballocinfo>
+
+  allocs = after.allocs - before.allocs;
+  wanted = after.wanted - before.wanted;
+      52:	8b 55 d8             	mov    -0x28(%ebp),%edx
+      55:	2b 55 b4             	sub    -0x4c(%ebp),%edx
+  if(allocs > 0)
+      58:	83 c4 10             	add    $0x10,%esp
+  allocs = after.allocs - before.allocs;
+      5b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  wanted = after.wanted - before.wanted;
+      5e:	89 d6                	mov    %edx,%esi
+  if(allocs > 0)
+      60:	2b 45 b0             	sub    -0x50(%ebp),%eax
+      63:	75 33                	jne    98 <main+0x98>
+    printf(1, "fsbench: balloc %d calls, %d cycles/call\n", allocs,
+           (uint)((after.cycles - before.cycles) / allocs));
+  if(wanted > 0)
+      65:	85 f6                	test   %esi,%esi
+      67:	75 5e                	jne    c7 <main+0xc7>
+    printf(1, "fsbench: %d%% of %d goals met\n",
+           (after.contig - before.contig) * 100 / wanted, wanted);
+  printf(1, "fsbench: %d of %d blocks free in %d runs, longest %d\n",
+      69:	83 ec 08             	sub    $0x8,%esp
+      6c:	ff 75 d0             	push   -0x30(%ebp)
+      6f:	ff 75 cc             	push   -0x34(%ebp)
+      72:	ff 75 c4             	push   -0x3c(%ebp)
+      75:	ff 75 c8             	push   -0x38(%ebp)
+      78:	68 f8 17 00 00       	push   $0x17f8
+      7d:	6a 01                	push   $0x1
+      7f:	e8 9c 12 00 00       	call   1320 <printf>
+         after.nfree, after.nblocks, after.nextent, after.maxextent);
+  printf(1, "fsbench done\n");
+      84:	83 c4 18             	add    $0x18,%esp
+      87:	68 63 17 00 00       	push   $0x1763
+      8c:	6a 01                	push   $0x1
+      8e:	e8 8d 12 00 00       	call   1320 <printf>
+  exit();
+      93:	e8 db 10 00 00       	call   1173 <exit>
+           (uint)((after.cycles - before.cycles) / allocs));
+      98:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      9b:	89 c7                	mov    %eax,%edi
+      9d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+      a0:	2b 45 bc             	sub    -0x44(%ebp),%eax
+      a3:	1b 55 c0             	sbb    -0x40(%ebp),%edx
+      a6:	31 db                	xor    %ebx,%ebx
+      a8:	53                   	push   %ebx
+      a9:	57                   	push   %edi
+      aa:	52                   	push   %edx
+      ab:	50                   	push   %eax
+      ac:	e8 9f 08 00 00       	call   950 <__udivdi3>
+      b1:	83 c4 10             	add    $0x10,%esp
+    printf(1, "fsbench: balloc %d calls, %d cycles/call\n", allocs,
+      b4:	50                   	push   %eax
+      b5:	57                   	push   %edi
+      b6:	68 ac 17 00 00       	push   $0x17ac
+      bb:	6a 01                	push   $0x1
+      bd:	e8 5e 12 00 00       	call   1320 <printf>
+      c2:	83 c4 10             	add    $0x10,%esp
+      c5:	eb 9e                	jmp    65 <main+0x65>
+    printf(1, "fsbench: %d%% of %d goals met\n",
+      c7:	56                   	push   %esi
+           (after.contig - before.contig) * 100 / wanted, wanted);
+      c8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    printf(1, "fsbench: %d%% of %d goals met\n",
+      cb:	31 d2                	xor    %edx,%edx
+           (after.contig - before.contig) * 100 / wanted, wanted);
+      cd:	2b 45 b8             	sub    -0x48(%ebp),%eax
+      d0:	6b c0 64             	imul   $0x64,%eax,%eax
+    printf(1, "fsbench: %d%% of %d goals met\n",
+      d3:	f7 f6                	div    %esi
+      d5:	50                   	push   %eax
+      d6:	68 d8 17 00 00       	push   $0x17d8
+      db:	6a 01                	push   $0x1
+      dd:	e8 3e 12 00 00       	call   1320 <printf>
+      e2:	83 c4 10             	add    $0x10,%esp
+      e5:	eb 82                	jmp    69 <main+0x69>
+      e7:	66 90                	xchg   %ax,%ax
+      e9:	66 90                	xchg   %ax,%ax
+      eb:	66 90                	xchg   %ax,%ax
+      ed:	66 90                	xchg   %ax,%ax
+      ef:	90                   	nop
+
+000000f0 <__absvdi2>:
+  start = uptime();
+      f0:	55                   	push   %ebp
+      f1:	89 e5                	mov    %esp,%ebp
+      f3:	53                   	push   %ebx
+  for(i = 0; i < NSMALL; i++){
+      f4:	31 db                	xor    %ebx,%ebx
+      f6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+      f9:	89 da                	mov    %ebx,%edx
+      fb:	c1 e9 1f             	shr    $0x1f,%ecx
+      fe:	89 c8                	mov    %ecx,%eax
+     100:	f7 d8                	neg    %eax
+     102:	83 d2 00             	adc    $0x0,%edx
+     105:	33 45 08             	xor    0x8(%ebp),%eax
+     108:	f7 da                	neg    %edx
+     10a:	33 55 0c             	xor    0xc(%ebp),%edx
+     10d:	01 c8                	add    %ecx,%eax
+     10f:	11 da                	adc    %ebx,%edx
+    name[1] = '0' + i / 100;
+     111:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     114:	c9                   	leave
+     115:	c3                   	ret
+     116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     11d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000120 <__ashldi3>:
+      printf(1, "fsbench: read %s failed\n", name);
+     120:	55                   	push   %ebp
+     121:	89 e5                	mov    %esp,%ebp
+     123:	56                   	push   %esi
+     124:	53                   	push   %ebx
+     125:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     128:	8b 55 08             	mov    0x8(%ebp),%edx
+     12b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    close(fd);
+     12e:	89 c8                	mov    %ecx,%eax
+     130:	83 e0 3f             	and    $0x3f,%eax
+  rate("small read", NSMALL, uptime() - start, "files");
+     133:	83 e1 20             	and    $0x20,%ecx
+     136:	74 10                	je     148 <__ashldi3+0x28>
+  start = uptime();
+     138:	8d 48 e0             	lea    -0x20(%eax),%ecx
+    }
+     13b:	5b                   	pop    %ebx
+      exit();
+     13c:	31 c0                	xor    %eax,%eax
+    }
+     13e:	5e                   	pop    %esi
+      exit();
+     13f:	d3 e2                	shl    %cl,%edx
+    }
+     141:	5d                   	pop    %ebp
+     142:	c3                   	ret
+     143:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     147:	90                   	nop
+    name[1] = '0' + i / 100;
+     148:	85 c0                	test   %eax,%eax
+     14a:	74 24                	je     170 <__ashldi3+0x50>
+    name[3] = '0' + i % 10;
+     14c:	b9 20 00 00 00       	mov    $0x20,%ecx
+     151:	89 d6                	mov    %edx,%esi
+     153:	29 c1                	sub    %eax,%ecx
+     155:	d3 ee                	shr    %cl,%esi
+     157:	89 c1                	mov    %eax,%ecx
+     159:	d3 e3                	shl    %cl,%ebx
+      exit();
+     15b:	d3 e2                	shl    %cl,%edx
+     15d:	09 de                	or     %ebx,%esi
+     15f:	89 d0                	mov    %edx,%eax
+    }
+     161:	5b                   	pop    %ebx
+      exit();
+     162:	89 f2                	mov    %esi,%edx
+    }
+     164:	5e                   	pop    %esi
+     165:	5d                   	pop    %ebp
+     166:	c3                   	ret
+     167:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16e:	66 90                	xchg   %ax,%ax
+     170:	89 d0                	mov    %edx,%eax
+     172:	89 da                	mov    %ebx,%edx
+     174:	5b                   	pop    %ebx
+     175:	5e                   	pop    %esi
+     176:	5d                   	pop    %ebp
+     177:	c3                   	ret
+     178:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     17f:	90                   	nop
+
+00000180 <__ashrdi3>:
+
+     180:	55                   	push   %ebp
+     181:	89 e5                	mov    %esp,%ebp
+     183:	56                   	push   %esi
+     184:	53                   	push   %ebx
+     185:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     188:	8b 45 08             	mov    0x8(%ebp),%eax
+     18b:	8b 55 0c             	mov    0xc(%ebp),%edx
+{
+     18e:	89 cb                	mov    %ecx,%ebx
+     190:	83 e3 3f             	and    $0x3f,%ebx
+  uint start;
+     193:	83 e1 20             	and    $0x20,%ecx
+     196:	74 18                	je     1b0 <__ashrdi3+0x30>
+  for(tot = 0; tot < LARGESZ; tot += n)
+     198:	89 d0                	mov    %edx,%eax
+
+     19a:	8d 4b e0             	lea    -0x20(%ebx),%ecx
+  for(tot = 0; tot < LARGESZ; tot += n)
+     19d:	c1 fa 1f             	sar    $0x1f,%edx
+     1a0:	d3 f8                	sar    %cl,%eax
+    if((n = write(fd, buf, sizeof(buf))) != sizeof(buf)){
+     1a2:	5b                   	pop    %ebx
+     1a3:	5e                   	pop    %esi
+     1a4:	5d                   	pop    %ebp
+     1a5:	c3                   	ret
+     1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ad:	8d 76 00             	lea    0x0(%esi),%esi
+  if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+     1b0:	85 db                	test   %ebx,%ebx
+     1b2:	74 ee                	je     1a2 <__ashrdi3+0x22>
+    exit();
+     1b4:	b9 20 00 00 00       	mov    $0x20,%ecx
+     1b9:	89 d6                	mov    %edx,%esi
+     1bb:	29 d9                	sub    %ebx,%ecx
+     1bd:	d3 e6                	shl    %cl,%esi
+     1bf:	89 d9                	mov    %ebx,%ecx
+    if((n = write(fd, buf, sizeof(buf))) != sizeof(buf)){
+     1c1:	5b                   	pop    %ebx
+    exit();
+     1c2:	d3 e8                	shr    %cl,%eax
+  for(tot = 0; tot < LARGESZ; tot += n)
+     1c4:	d3 fa                	sar    %cl,%edx
+     1c6:	09 f0                	or     %esi,%eax
+    if((n = write(fd, buf, sizeof(buf))) != sizeof(buf)){
+     1c8:	5e                   	pop    %esi
+     1c9:	5d                   	pop    %ebp
+     1ca:	c3                   	ret
+     1cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1cf:	90                   	nop
+
+000001d0 <__clzsi2>:
+  rate("large write", LARGESZ / 1024, uptime() - start, "KB");
+     1d0:	55                   	push   %ebp
+  if((fd = open(path, O_RDONLY)) < 0){
+     1d1:	31 d2                	xor    %edx,%edx
+  rate("large write", LARGESZ / 1024, uptime() - start, "KB");
+     1d3:	89 e5                	mov    %esp,%ebp
+     1d5:	53                   	push   %ebx
+     1d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((fd = open(path, O_RDONLY)) < 0){
+     1d9:	3d ff ff 00 00       	cmp    $0xffff,%eax
+     1de:	0f 96 c2             	setbe  %dl
+    printf(1, "fsbench: cannot open %s\n", path);
+     1e1:	31 db                	xor    %ebx,%ebx
+  if((fd = open(path, O_RDONLY)) < 0){
+     1e3:	c1 e2 04             	shl    $0x4,%edx
+     1e6:	89 d1                	mov    %edx,%ecx
+     1e8:	d3 e0                	shl    %cl,%eax
+    printf(1, "fsbench: cannot open %s\n", path);
+     1ea:	3d ff ff ff 00       	cmp    $0xffffff,%eax
+     1ef:	0f 96 c3             	setbe  %bl
+     1f2:	c1 e3 03             	shl    $0x3,%ebx
+     1f5:	89 d9                	mov    %ebx,%ecx
+     1f7:	01 da                	add    %ebx,%edx
+  for(tot = 0; (n = read(fd, buf, sizeof(buf))) > 0; tot += n)
+     1f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1fc:	c9                   	leave
+    printf(1, "fsbench: cannot open %s\n", path);
+     1fd:	d3 e0                	shl    %cl,%eax
+    exit();
+     1ff:	31 c9                	xor    %ecx,%ecx
+     201:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+     206:	0f 96 c1             	setbe  %cl
+     209:	c1 e1 02             	shl    $0x2,%ecx
+     20c:	d3 e0                	shl    %cl,%eax
+     20e:	01 ca                	add    %ecx,%edx
+  }
+     210:	31 c9                	xor    %ecx,%ecx
+     212:	3d ff ff ff 3f       	cmp    $0x3fffffff,%eax
+     217:	0f 96 c1             	setbe  %cl
+     21a:	01 c9                	add    %ecx,%ecx
+     21c:	d3 e0                	shl    %cl,%eax
+     21e:	01 ca                	add    %ecx,%edx
+  start = uptime();
+     220:	f7 d0                	not    %eax
+     222:	c1 e8 1f             	shr    $0x1f,%eax
+     225:	01 d0                	add    %edx,%eax
+  for(tot = 0; (n = read(fd, buf, sizeof(buf))) > 0; tot += n)
+     227:	c3                   	ret
+     228:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     22f:	90                   	nop
+
+00000230 <__clzdi2>:
+  if(tot != LARGESZ){
+     230:	55                   	push   %ebp
+    exit();
+     231:	31 c9                	xor    %ecx,%ecx
+  if(tot != LARGESZ){
+     233:	89 e5                	mov    %esp,%ebp
+     235:	56                   	push   %esi
+     236:	53                   	push   %ebx
+     237:	8b 55 0c             	mov    0xc(%ebp),%edx
+     23a:	8b 45 08             	mov    0x8(%ebp),%eax
+    exit();
+     23d:	85 d2                	test   %edx,%edx
+     23f:	0f 94 c1             	sete   %cl
+     242:	31 db                	xor    %ebx,%ebx
+     244:	c1 e1 05             	shl    $0x5,%ecx
+     247:	0f a5 c2             	shld   %cl,%eax,%edx
+     24a:	d3 e0                	shl    %cl,%eax
+     24c:	f6 c1 20             	test   $0x20,%cl
+     24f:	0f 45 d0             	cmovne %eax,%edx
+     252:	0f 45 c3             	cmovne %ebx,%eax
+  }
+     255:	31 db                	xor    %ebx,%ebx
+     257:	81 fa 00 00 01 00    	cmp    $0x10000,%edx
+     25d:	0f 92 c3             	setb   %bl
+     260:	89 de                	mov    %ebx,%esi
+     262:	c1 e6 04             	shl    $0x4,%esi
+     265:	8d 1c 0e             	lea    (%esi,%ecx,1),%ebx
+     268:	89 f1                	mov    %esi,%ecx
+     26a:	31 f6                	xor    %esi,%esi
+     26c:	0f a5 c2             	shld   %cl,%eax,%edx
+     26f:	d3 e0                	shl    %cl,%eax
+     271:	f6 c1 20             	test   $0x20,%cl
+     274:	0f 45 d0             	cmovne %eax,%edx
+     277:	0f 45 c6             	cmovne %esi,%eax
+  rate("large read", LARGESZ / 1024, uptime() - start, "KB");
+     27a:	31 c9                	xor    %ecx,%ecx
+     27c:	81 fa 00 00 00 01    	cmp    $0x1000000,%edx
+     282:	0f 92 c1             	setb   %cl
+     285:	31 f6                	xor    %esi,%esi
+     287:	c1 e1 03             	shl    $0x3,%ecx
+     28a:	0f a5 c2             	shld   %cl,%eax,%edx
+     28d:	01 cb                	add    %ecx,%ebx
+     28f:	d3 e0                	shl    %cl,%eax
+     291:	f6 c1 20             	test   $0x20,%cl
+     294:	0f 45 d0             	cmovne %eax,%edx
+     297:	0f 45 c6             	cmovne %esi,%eax
+  unlink(path);
+     29a:	31 c9                	xor    %ecx,%ecx
+     29c:	81 fa 00 00 00 10    	cmp    $0x10000000,%edx
+     2a2:	0f 92 c1             	setb   %cl
+     2a5:	31 f6                	xor    %esi,%esi
+     2a7:	c1 e1 02             	shl    $0x2,%ecx
+     2aa:	0f a5 c2             	shld   %cl,%eax,%edx
+     2ad:	01 cb                	add    %ecx,%ebx
+     2af:	d3 e0                	shl    %cl,%eax
+     2b1:	f6 c1 20             	test   $0x20,%cl
+     2b4:	0f 45 d0             	cmovne %eax,%edx
+     2b7:	0f 45 c6             	cmovne %esi,%eax
+}
+     2ba:	31 c9                	xor    %ecx,%ecx
+     2bc:	81 fa 00 00 00 40    	cmp    $0x40000000,%edx
+     2c2:	0f 92 c1             	setb   %cl
+     2c5:	01 c9                	add    %ecx,%ecx
+     2c7:	0f a5 c2             	shld   %cl,%eax,%edx
+     2ca:	d3 e0                	shl    %cl,%eax
+     2cc:	f6 c1 20             	test   $0x20,%cl
+     2cf:	0f 45 d0             	cmovne %eax,%edx
+     2d2:	01 cb                	add    %ecx,%ebx
+
+     2d4:	89 d0                	mov    %edx,%eax
+     2d6:	f7 d0                	not    %eax
+     2d8:	c1 e8 1f             	shr    $0x1f,%eax
+     2db:	01 d8                	add    %ebx,%eax
+int
+     2dd:	5b                   	pop    %ebx
+     2de:	5e                   	pop    %esi
+     2df:	5d                   	pop    %ebp
+     2e0:	c3                   	ret
+     2e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ef:	90                   	nop
+
+000002f0 <__divmoddi4.part.0>:
+}
+     2f0:	55                   	push   %ebp
+     2f1:	89 e5                	mov    %esp,%ebp
+     2f3:	57                   	push   %edi
+     2f4:	89 d7                	mov    %edx,%edi
+     2f6:	56                   	push   %esi
+     2f7:	89 c6                	mov    %eax,%esi
+     2f9:	53                   	push   %ebx
+     2fa:	83 ec 5c             	sub    $0x5c,%esp
+     2fd:	8b 45 08             	mov    0x8(%ebp),%eax
+     300:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     303:	89 45 b0             	mov    %eax,-0x50(%ebp)
+     306:	89 c2                	mov    %eax,%edx
+     308:	89 4d b4             	mov    %ecx,-0x4c(%ebp)
+     30b:	85 c9                	test   %ecx,%ecx
+     30d:	75 24                	jne    333 <__divmoddi4.part.0+0x43>
+     30f:	85 c0                	test   %eax,%eax
+     311:	0f 85 59 01 00 00    	jne    470 <__divmoddi4.part.0+0x180>
+     317:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+     31b:	0f be 45 e7          	movsbl -0x19(%ebp),%eax
+     31f:	8d 48 01             	lea    0x1(%eax),%ecx
+     322:	83 f9 02             	cmp    $0x2,%ecx
+     325:	0f 47 c2             	cmova  %edx,%eax
+     328:	88 45 e7             	mov    %al,-0x19(%ebp)
+     32b:	85 ff                	test   %edi,%edi
+     32d:	0f 84 6d 01 00 00    	je     4a0 <__divmoddi4.part.0+0x1b0>
+     333:	83 ec 08             	sub    $0x8,%esp
+     336:	ff 75 b4             	push   -0x4c(%ebp)
+     339:	ff 75 b0             	push   -0x50(%ebp)
+     33c:	e8 ef fe ff ff       	call   230 <__clzdi2>
+     341:	5b                   	pop    %ebx
+     342:	5a                   	pop    %edx
+     343:	57                   	push   %edi
+     344:	56                   	push   %esi
+     345:	89 c3                	mov    %eax,%ebx
+     347:	83 c3 01             	add    $0x1,%ebx
+     34a:	e8 e1 fe ff ff       	call   230 <__clzdi2>
+     34f:	89 fa                	mov    %edi,%edx
+     351:	83 c4 10             	add    $0x10,%esp
+     354:	29 c3                	sub    %eax,%ebx
+     356:	89 f0                	mov    %esi,%eax
+     358:	89 d9                	mov    %ebx,%ecx
+     35a:	0f ad d0             	shrd   %cl,%edx,%eax
+     35d:	d3 ea                	shr    %cl,%edx
+     35f:	f6 c1 20             	test   $0x20,%cl
+     362:	74 04                	je     368 <__divmoddi4.part.0+0x78>
+     364:	89 d0                	mov    %edx,%eax
+     366:	31 d2                	xor    %edx,%edx
+     368:	b9 40 00 00 00       	mov    $0x40,%ecx
+     36d:	29 d9                	sub    %ebx,%ecx
+     36f:	0f a5 f7             	shld   %cl,%esi,%edi
+     372:	d3 e6                	shl    %cl,%esi
+     374:	f6 c1 20             	test   $0x20,%cl
+     377:	74 04                	je     37d <__divmoddi4.part.0+0x8d>
+     379:	89 f7                	mov    %esi,%edi
+     37b:	31 f6                	xor    %esi,%esi
+     37d:	8d 4b ff             	lea    -0x1(%ebx),%ecx
+     380:	88 4d d0             	mov    %cl,-0x30(%ebp)
+     383:	84 db                	test   %bl,%bl
+     385:	0f 8e 45 01 00 00    	jle    4d0 <__divmoddi4.part.0+0x1e0>
+     38b:	8b 4d b0             	mov    -0x50(%ebp),%ecx
+     38e:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+     391:	c7 45 ac 00 00 00 00 	movl   $0x0,-0x54(%ebp)
+     398:	83 c1 ff             	add    $0xffffffff,%ecx
+     39b:	83 d3 ff             	adc    $0xffffffff,%ebx
+     39e:	89 4d a0             	mov    %ecx,-0x60(%ebp)
+     3a1:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+     3a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3a8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+     3ac:	01 c0                	add    %eax,%eax
+     3ae:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+     3b5:	89 d3                	mov    %edx,%ebx
+     3b7:	89 fa                	mov    %edi,%edx
+     3b9:	89 c1                	mov    %eax,%ecx
+     3bb:	0f a4 f7 01          	shld   $0x1,%esi,%edi
+     3bf:	89 d0                	mov    %edx,%eax
+     3c1:	31 d2                	xor    %edx,%edx
+     3c3:	01 f6                	add    %esi,%esi
+     3c5:	09 da                	or     %ebx,%edx
+     3c7:	89 fb                	mov    %edi,%ebx
+     3c9:	8b 7d ac             	mov    -0x54(%ebp),%edi
+     3cc:	c1 e8 1f             	shr    $0x1f,%eax
+     3cf:	09 c8                	or     %ecx,%eax
+     3d1:	89 f1                	mov    %esi,%ecx
+     3d3:	89 55 cc             	mov    %edx,-0x34(%ebp)
+     3d6:	83 e7 01             	and    $0x1,%edi
+     3d9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+     3dc:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     3df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     3e2:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+     3e5:	09 ce                	or     %ecx,%esi
+     3e7:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+     3ea:	09 df                	or     %ebx,%edi
+     3ec:	8b 5d a4             	mov    -0x5c(%ebp),%ebx
+     3ef:	29 c1                	sub    %eax,%ecx
+     3f1:	8b 45 b0             	mov    -0x50(%ebp),%eax
+     3f4:	19 d3                	sbb    %edx,%ebx
+     3f6:	89 ca                	mov    %ecx,%edx
+     3f8:	89 d9                	mov    %ebx,%ecx
+     3fa:	89 5d 9c             	mov    %ebx,-0x64(%ebp)
+     3fd:	c1 f9 1f             	sar    $0x1f,%ecx
+     400:	89 55 98             	mov    %edx,-0x68(%ebp)
+     403:	8b 55 cc             	mov    -0x34(%ebp),%edx
+     406:	21 c8                	and    %ecx,%eax
+     408:	89 cb                	mov    %ecx,%ebx
+     40a:	89 4d ac             	mov    %ecx,-0x54(%ebp)
+     40d:	89 45 b8             	mov    %eax,-0x48(%ebp)
+     410:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+     413:	21 c3                	and    %eax,%ebx
+     415:	8b 45 c8             	mov    -0x38(%ebp),%eax
+     418:	2b 45 b8             	sub    -0x48(%ebp),%eax
+     41b:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+     41e:	1b 55 bc             	sbb    -0x44(%ebp),%edx
+     421:	80 6d d0 01          	subb   $0x1,-0x30(%ebp)
+     425:	0f b6 5d d0          	movzbl -0x30(%ebp),%ebx
+     429:	80 fb ff             	cmp    $0xff,%bl
+     42c:	0f 85 76 ff ff ff    	jne    3a8 <__divmoddi4.part.0+0xb8>
+     432:	8b 5d 9c             	mov    -0x64(%ebp),%ebx
+     435:	89 d9                	mov    %ebx,%ecx
+     437:	31 db                	xor    %ebx,%ebx
+     439:	c1 e9 1f             	shr    $0x1f,%ecx
+     43c:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+     43f:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     442:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     445:	85 db                	test   %ebx,%ebx
+     447:	74 08                	je     451 <__divmoddi4.part.0+0x161>
+     449:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     44c:	89 03                	mov    %eax,(%ebx)
+     44e:	89 53 04             	mov    %edx,0x4(%ebx)
+     451:	89 f0                	mov    %esi,%eax
+     453:	89 fa                	mov    %edi,%edx
+     455:	0f a4 f2 01          	shld   $0x1,%esi,%edx
+     459:	01 f0                	add    %esi,%eax
+     45b:	0b 55 d4             	or     -0x2c(%ebp),%edx
+     45e:	0b 45 d0             	or     -0x30(%ebp),%eax
+     461:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     464:	5b                   	pop    %ebx
+     465:	5e                   	pop    %esi
+     466:	5f                   	pop    %edi
+     467:	5d                   	pop    %ebp
+     468:	c3                   	ret
+     469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     470:	8b 45 b0             	mov    -0x50(%ebp),%eax
+     473:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     476:	83 f0 01             	xor    $0x1,%eax
+     479:	09 d0                	or     %edx,%eax
+     47b:	0f 85 aa fe ff ff    	jne    32b <__divmoddi4.part.0+0x3b>
+     481:	8b 55 10             	mov    0x10(%ebp),%edx
+     484:	85 d2                	test   %edx,%edx
+     486:	74 10                	je     498 <__divmoddi4.part.0+0x1a8>
+     488:	8b 45 10             	mov    0x10(%ebp),%eax
+     48b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+     491:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+     498:	89 f0                	mov    %esi,%eax
+     49a:	89 fa                	mov    %edi,%edx
+     49c:	eb c3                	jmp    461 <__divmoddi4.part.0+0x171>
+     49e:	66 90                	xchg   %ax,%ax
+     4a0:	8b 45 10             	mov    0x10(%ebp),%eax
+     4a3:	8b 4d b0             	mov    -0x50(%ebp),%ecx
+     4a6:	85 c0                	test   %eax,%eax
+     4a8:	74 12                	je     4bc <__divmoddi4.part.0+0x1cc>
+     4aa:	89 f0                	mov    %esi,%eax
+     4ac:	31 d2                	xor    %edx,%edx
+     4ae:	f7 f1                	div    %ecx
+     4b0:	8b 45 10             	mov    0x10(%ebp),%eax
+     4b3:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+     4ba:	89 10                	mov    %edx,(%eax)
+     4bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4bf:	89 f0                	mov    %esi,%eax
+     4c1:	31 d2                	xor    %edx,%edx
+     4c3:	5b                   	pop    %ebx
+     4c4:	5e                   	pop    %esi
+     4c5:	f7 f1                	div    %ecx
+     4c7:	5f                   	pop    %edi
+     4c8:	31 d2                	xor    %edx,%edx
+     4ca:	5d                   	pop    %ebp
+     4cb:	c3                   	ret
+     4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4d0:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+     4d7:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     4de:	e9 5f ff ff ff       	jmp    442 <__divmoddi4.part.0+0x152>
+     4e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004f0 <__ctzsi2>:
+
+     4f0:	55                   	push   %ebp
+         BSIZE, NSMALL, SMALLSZ, LARGESZ / 1024);
+     4f1:	31 d2                	xor    %edx,%edx
+
+     4f3:	89 e5                	mov    %esp,%ebp
+     4f5:	53                   	push   %ebx
+     4f6:	8b 45 08             	mov    0x8(%ebp),%eax
+         BSIZE, NSMALL, SMALLSZ, LARGESZ / 1024);
+     4f9:	66 85 c0             	test   %ax,%ax
+     4fc:	0f 94 c2             	sete   %dl
+  getballocinfo(&before);
+     4ff:	31 db                	xor    %ebx,%ebx
+         BSIZE, NSMALL, SMALLSZ, LARGESZ / 1024);
+     501:	c1 e2 04             	shl    $0x4,%edx
+     504:	89 d1                	mov    %edx,%ecx
+     506:	d3 e8                	shr    %cl,%eax
+  getballocinfo(&before);
+     508:	84 c0                	test   %al,%al
+     50a:	0f 94 c3             	sete   %bl
+     50d:	c1 e3 03             	shl    $0x3,%ebx
+     510:	89 d9                	mov    %ebx,%ecx
+     512:	01 da                	add    %ebx,%edx
+
+     514:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     517:	c9                   	leave
+  getballocinfo(&before);
+     518:	d3 e8                	shr    %cl,%eax
+  smallfiles();
+     51a:	31 c9                	xor    %ecx,%ecx
+     51c:	a8 0f                	test   $0xf,%al
+     51e:	0f 94 c1             	sete   %cl
+     521:	c1 e1 02             	shl    $0x2,%ecx
+     524:	d3 e8                	shr    %cl,%eax
+     526:	01 ca                	add    %ecx,%edx
+  largefile();
+     528:	31 c9                	xor    %ecx,%ecx
+     52a:	a8 03                	test   $0x3,%al
+     52c:	0f 94 c1             	sete   %cl
+     52f:	01 c9                	add    %ecx,%ecx
+  getballocinfo(&after);
+     531:	0f a3 c8             	bt     %ecx,%eax
+     534:	0f 93 c0             	setae  %al
+  largefile();
+     537:	01 ca                	add    %ecx,%edx
+  getballocinfo(&after);
+     539:	0f b6 c0             	movzbl %al,%eax
+     53c:	01 d0                	add    %edx,%eax
+
+     53e:	c3                   	ret
+     53f:	90                   	nop
+
+00000540 <__ctzdi2>:
+  if(allocs > 0)
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	56                   	push   %esi
+     544:	53                   	push   %ebx
+     545:	8b 45 08             	mov    0x8(%ebp),%eax
+     548:	8b 55 0c             	mov    0xc(%ebp),%edx
+           (uint)((after.cycles - before.cycles) / allocs));
+     54b:	85 c0                	test   %eax,%eax
+     54d:	0f 94 c1             	sete   %cl
+     550:	31 db                	xor    %ebx,%ebx
+     552:	0f b6 c9             	movzbl %cl,%ecx
+     555:	c1 e1 05             	shl    $0x5,%ecx
+     558:	0f ad d0             	shrd   %cl,%edx,%eax
+     55b:	d3 ea                	shr    %cl,%edx
+     55d:	f6 c1 20             	test   $0x20,%cl
+     560:	0f 45 c2             	cmovne %edx,%eax
+     563:	0f 45 d3             	cmovne %ebx,%edx
+  if(wanted > 0)
+     566:	0f b7 d8             	movzwl %ax,%ebx
+     569:	83 cb 00             	or     $0x0,%ebx
+     56c:	0f 94 c3             	sete   %bl
+     56f:	0f b6 db             	movzbl %bl,%ebx
+     572:	89 de                	mov    %ebx,%esi
+     574:	c1 e6 04             	shl    $0x4,%esi
+     577:	8d 1c 31             	lea    (%ecx,%esi,1),%ebx
+     57a:	89 f1                	mov    %esi,%ecx
+     57c:	31 f6                	xor    %esi,%esi
+     57e:	0f ad d0             	shrd   %cl,%edx,%eax
+     581:	d3 ea                	shr    %cl,%edx
+     583:	f6 c1 20             	test   $0x20,%cl
+     586:	0f 45 c2             	cmovne %edx,%eax
+     589:	0f 45 d6             	cmovne %esi,%edx
+    printf(1, "fsbench: %d%% of %d goals met\n",
+     58c:	0f b6 c8             	movzbl %al,%ecx
+     58f:	83 c9 00             	or     $0x0,%ecx
+     592:	0f 94 c1             	sete   %cl
+     595:	31 f6                	xor    %esi,%esi
+     597:	0f b6 c9             	movzbl %cl,%ecx
+     59a:	c1 e1 03             	shl    $0x3,%ecx
+     59d:	0f ad d0             	shrd   %cl,%edx,%eax
+     5a0:	01 cb                	add    %ecx,%ebx
+     5a2:	d3 ea                	shr    %cl,%edx
+     5a4:	f6 c1 20             	test   $0x20,%cl
+     5a7:	0f 45 c2             	cmovne %edx,%eax
+     5aa:	0f 45 d6             	cmovne %esi,%edx
+           (after.contig - before.contig) * 100 / wanted, wanted);
+     5ad:	89 c1                	mov    %eax,%ecx
+     5af:	83 e1 0f             	and    $0xf,%ecx
+     5b2:	83 c9 00             	or     $0x0,%ecx
+     5b5:	0f 94 c1             	sete   %cl
+     5b8:	31 f6                	xor    %esi,%esi
+     5ba:	0f b6 c9             	movzbl %cl,%ecx
+     5bd:	c1 e1 02             	shl    $0x2,%ecx
+     5c0:	0f ad d0             	shrd   %cl,%edx,%eax
+     5c3:	01 cb                	add    %ecx,%ebx
+     5c5:	d3 ea                	shr    %cl,%edx
+     5c7:	f6 c1 20             	test   $0x20,%cl
+     5ca:	0f 45 c2             	cmovne %edx,%eax
+     5cd:	0f 45 d6             	cmovne %esi,%edx
+  printf(1, "fsbench: %d of %d blocks free in %d runs, longest %d\n",
+     5d0:	89 c1                	mov    %eax,%ecx
+     5d2:	83 e1 03             	and    $0x3,%ecx
+     5d5:	83 c9 00             	or     $0x0,%ecx
+     5d8:	0f 94 c1             	sete   %cl
+     5db:	0f b6 c9             	movzbl %cl,%ecx
+     5de:	01 c9                	add    %ecx,%ecx
+     5e0:	0f ad d0             	shrd   %cl,%edx,%eax
+     5e3:	d3 ea                	shr    %cl,%edx
+     5e5:	f6 c1 20             	test   $0x20,%cl
+     5e8:	0f 45 c2             	cmovne %edx,%eax
+     5eb:	01 cb                	add    %ecx,%ebx
+         after.nfree, after.nblocks, after.nextent, after.maxextent);
+     5ed:	f7 d0                	not    %eax
+     5ef:	83 e0 01             	and    $0x1,%eax
+     5f2:	01 d8                	add    %ebx,%eax
+  printf(1, "fsbench done\n");
+     5f4:	5b                   	pop    %ebx
+     5f5:	5e                   	pop    %esi
+     5f6:	5d                   	pop    %ebp
+     5f7:	c3                   	ret
+     5f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ff:	90                   	nop
+
+00000600 <__divmoddi4>:
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+     603:	57                   	push   %edi
+     604:	56                   	push   %esi
+     605:	53                   	push   %ebx
+     606:	8b 45 08             	mov    0x8(%ebp),%eax
+     609:	8b 55 0c             	mov    0xc(%ebp),%edx
+     60c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     60f:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     612:	8b 75 18             	mov    0x18(%ebp),%esi
+     615:	39 d8                	cmp    %ebx,%eax
+     617:	89 d7                	mov    %edx,%edi
+     619:	19 cf                	sbb    %ecx,%edi
+     61b:	72 13                	jb     630 <__divmoddi4+0x30>
+     61d:	89 75 10             	mov    %esi,0x10(%ebp)
+     620:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     623:	89 4d 0c             	mov    %ecx,0xc(%ebp)
+     626:	5b                   	pop    %ebx
+     627:	5e                   	pop    %esi
+     628:	5f                   	pop    %edi
+     629:	5d                   	pop    %ebp
+     62a:	e9 c1 fc ff ff       	jmp    2f0 <__divmoddi4.part.0>
+     62f:	90                   	nop
+     630:	85 f6                	test   %esi,%esi
+     632:	74 05                	je     639 <__divmoddi4+0x39>
+     634:	89 06                	mov    %eax,(%esi)
+     636:	89 56 04             	mov    %edx,0x4(%esi)
+     639:	5b                   	pop    %ebx
+     63a:	31 c0                	xor    %eax,%eax
+     63c:	5e                   	pop    %esi
+     63d:	31 d2                	xor    %edx,%edx
+     63f:	5f                   	pop    %edi
+     640:	5d                   	pop    %ebp
+     641:	c3                   	ret
+     642:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     649:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <__divdi3>:
+     650:	55                   	push   %ebp
+     651:	89 e5                	mov    %esp,%ebp
+     653:	57                   	push   %edi
+     654:	56                   	push   %esi
+     655:	53                   	push   %ebx
+     656:	83 ec 1c             	sub    $0x1c,%esp
+     659:	8b 55 0c             	mov    0xc(%ebp),%edx
+     65c:	8b 45 08             	mov    0x8(%ebp),%eax
+     65f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     662:	8b 55 14             	mov    0x14(%ebp),%edx
+     665:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     668:	8b 45 10             	mov    0x10(%ebp),%eax
+     66b:	89 d3                	mov    %edx,%ebx
+     66d:	89 d7                	mov    %edx,%edi
+     66f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+     672:	31 d2                	xor    %edx,%edx
+     674:	c1 eb 1f             	shr    $0x1f,%ebx
+     677:	89 c6                	mov    %eax,%esi
+     679:	89 45 d8             	mov    %eax,-0x28(%ebp)
+     67c:	89 d9                	mov    %ebx,%ecx
+     67e:	89 d8                	mov    %ebx,%eax
+     680:	89 d3                	mov    %edx,%ebx
+     682:	f7 d9                	neg    %ecx
+     684:	83 d3 00             	adc    $0x0,%ebx
+     687:	31 f1                	xor    %esi,%ecx
+     689:	f7 db                	neg    %ebx
+     68b:	31 fb                	xor    %edi,%ebx
+     68d:	01 c1                	add    %eax,%ecx
+     68f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     692:	11 d3                	adc    %edx,%ebx
+     694:	89 ce                	mov    %ecx,%esi
+     696:	89 df                	mov    %ebx,%edi
+     698:	c1 e8 1f             	shr    $0x1f,%eax
+     69b:	31 db                	xor    %ebx,%ebx
+     69d:	89 c1                	mov    %eax,%ecx
+     69f:	89 da                	mov    %ebx,%edx
+     6a1:	f7 d8                	neg    %eax
+     6a3:	83 d2 00             	adc    $0x0,%edx
+     6a6:	33 45 e0             	xor    -0x20(%ebp),%eax
+     6a9:	f7 da                	neg    %edx
+     6ab:	33 55 e4             	xor    -0x1c(%ebp),%edx
+     6ae:	01 c8                	add    %ecx,%eax
+     6b0:	11 da                	adc    %ebx,%edx
+     6b2:	89 fb                	mov    %edi,%ebx
+     6b4:	39 f0                	cmp    %esi,%eax
+     6b6:	89 d7                	mov    %edx,%edi
+     6b8:	19 df                	sbb    %ebx,%edi
+     6ba:	72 44                	jb     700 <__divdi3+0xb0>
+     6bc:	83 ec 04             	sub    $0x4,%esp
+     6bf:	6a 00                	push   $0x0
+     6c1:	53                   	push   %ebx
+     6c2:	56                   	push   %esi
+     6c3:	e8 28 fc ff ff       	call   2f0 <__divmoddi4.part.0>
+     6c8:	83 c4 10             	add    $0x10,%esp
+     6cb:	89 c6                	mov    %eax,%esi
+     6cd:	89 d7                	mov    %edx,%edi
+     6cf:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     6d2:	33 55 e4             	xor    -0x1c(%ebp),%edx
+     6d5:	31 db                	xor    %ebx,%ebx
+     6d7:	89 d1                	mov    %edx,%ecx
+     6d9:	89 da                	mov    %ebx,%edx
+     6db:	c1 e9 1f             	shr    $0x1f,%ecx
+     6de:	89 c8                	mov    %ecx,%eax
+     6e0:	f7 d8                	neg    %eax
+     6e2:	83 d2 00             	adc    $0x0,%edx
+     6e5:	31 f0                	xor    %esi,%eax
+     6e7:	f7 da                	neg    %edx
+     6e9:	31 fa                	xor    %edi,%edx
+     6eb:	01 c8                	add    %ecx,%eax
+     6ed:	11 da                	adc    %ebx,%edx
+     6ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6f2:	5b                   	pop    %ebx
+     6f3:	5e                   	pop    %esi
+     6f4:	5f                   	pop    %edi
+     6f5:	5d                   	pop    %ebp
+     6f6:	c3                   	ret
+     6f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6fe:	66 90                	xchg   %ax,%ax
+     700:	31 f6                	xor    %esi,%esi
+     702:	31 ff                	xor    %edi,%edi
+     704:	eb c9                	jmp    6cf <__divdi3+0x7f>
+     706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000710 <__ffsdi2>:
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	53                   	push   %ebx
+     714:	83 ec 04             	sub    $0x4,%esp
+     717:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     71a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     71d:	89 da                	mov    %ebx,%edx
+     71f:	09 ca                	or     %ecx,%edx
+     721:	74 1d                	je     740 <__ffsdi2+0x30>
+     723:	83 ec 08             	sub    $0x8,%esp
+     726:	53                   	push   %ebx
+     727:	51                   	push   %ecx
+     728:	e8 13 fe ff ff       	call   540 <__ctzdi2>
+     72d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     730:	83 c4 10             	add    $0x10,%esp
+     733:	c9                   	leave
+     734:	83 c0 01             	add    $0x1,%eax
+     737:	c3                   	ret
+     738:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     73f:	90                   	nop
+     740:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     743:	31 c0                	xor    %eax,%eax
+     745:	c9                   	leave
+     746:	c3                   	ret
+     747:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     74e:	66 90                	xchg   %ax,%ax
+
+00000750 <__lshrdi3>:
+     750:	55                   	push   %ebp
+     751:	89 e5                	mov    %esp,%ebp
+     753:	56                   	push   %esi
+     754:	53                   	push   %ebx
+     755:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     758:	8b 45 08             	mov    0x8(%ebp),%eax
+     75b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     75e:	89 cb                	mov    %ecx,%ebx
+     760:	83 e3 3f             	and    $0x3f,%ebx
+     763:	83 e1 20             	and    $0x20,%ecx
+     766:	74 10                	je     778 <__lshrdi3+0x28>
+     768:	89 d0                	mov    %edx,%eax
+     76a:	8d 4b e0             	lea    -0x20(%ebx),%ecx
+     76d:	31 d2                	xor    %edx,%edx
+     76f:	d3 e8                	shr    %cl,%eax
+     771:	5b                   	pop    %ebx
+     772:	5e                   	pop    %esi
+     773:	5d                   	pop    %ebp
+     774:	c3                   	ret
+     775:	8d 76 00             	lea    0x0(%esi),%esi
+     778:	85 db                	test   %ebx,%ebx
+     77a:	74 f5                	je     771 <__lshrdi3+0x21>
+     77c:	b9 20 00 00 00       	mov    $0x20,%ecx
+     781:	89 d6                	mov    %edx,%esi
+     783:	29 d9                	sub    %ebx,%ecx
+     785:	d3 e6                	shl    %cl,%esi
+     787:	89 d9                	mov    %ebx,%ecx
+     789:	5b                   	pop    %ebx
+     78a:	d3 e8                	shr    %cl,%eax
+     78c:	d3 ea                	shr    %cl,%edx
+     78e:	09 f0                	or     %esi,%eax
+     790:	5e                   	pop    %esi
+     791:	5d                   	pop    %ebp
+     792:	c3                   	ret
+     793:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007a0 <__moddi3>:
+     7a0:	55                   	push   %ebp
+     7a1:	31 d2                	xor    %edx,%edx
+     7a3:	89 e5                	mov    %esp,%ebp
+     7a5:	57                   	push   %edi
+     7a6:	56                   	push   %esi
+     7a7:	53                   	push   %ebx
+     7a8:	89 d3                	mov    %edx,%ebx
+     7aa:	83 ec 2c             	sub    $0x2c,%esp
+     7ad:	8b 45 14             	mov    0x14(%ebp),%eax
+     7b0:	c1 e8 1f             	shr    $0x1f,%eax
+     7b3:	89 c1                	mov    %eax,%ecx
+     7b5:	f7 d9                	neg    %ecx
+     7b7:	83 d3 00             	adc    $0x0,%ebx
+     7ba:	33 4d 10             	xor    0x10(%ebp),%ecx
+     7bd:	f7 db                	neg    %ebx
+     7bf:	33 5d 14             	xor    0x14(%ebp),%ebx
+     7c2:	01 c1                	add    %eax,%ecx
+     7c4:	8b 45 0c             	mov    0xc(%ebp),%eax
+     7c7:	11 d3                	adc    %edx,%ebx
+     7c9:	31 ff                	xor    %edi,%edi
+     7cb:	c1 e8 1f             	shr    $0x1f,%eax
+     7ce:	89 fa                	mov    %edi,%edx
+     7d0:	89 c6                	mov    %eax,%esi
+     7d2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     7d5:	f7 d8                	neg    %eax
+     7d7:	83 d2 00             	adc    $0x0,%edx
+     7da:	33 45 08             	xor    0x8(%ebp),%eax
+     7dd:	f7 da                	neg    %edx
+     7df:	33 55 0c             	xor    0xc(%ebp),%edx
+     7e2:	01 f0                	add    %esi,%eax
+     7e4:	11 fa                	adc    %edi,%edx
+     7e6:	39 c8                	cmp    %ecx,%eax
+     7e8:	89 d7                	mov    %edx,%edi
+     7ea:	19 df                	sbb    %ebx,%edi
+     7ec:	72 17                	jb     805 <__moddi3+0x65>
+     7ee:	83 ec 04             	sub    $0x4,%esp
+     7f1:	8d 75 e0             	lea    -0x20(%ebp),%esi
+     7f4:	56                   	push   %esi
+     7f5:	53                   	push   %ebx
+     7f6:	51                   	push   %ecx
+     7f7:	e8 f4 fa ff ff       	call   2f0 <__divmoddi4.part.0>
+     7fc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     7ff:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     802:	83 c4 10             	add    $0x10,%esp
+     805:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     808:	31 db                	xor    %ebx,%ebx
+     80a:	89 df                	mov    %ebx,%edi
+     80c:	89 ce                	mov    %ecx,%esi
+     80e:	f7 de                	neg    %esi
+     810:	83 d7 00             	adc    $0x0,%edi
+     813:	31 c6                	xor    %eax,%esi
+     815:	f7 df                	neg    %edi
+     817:	89 f0                	mov    %esi,%eax
+     819:	31 d7                	xor    %edx,%edi
+     81b:	01 c8                	add    %ecx,%eax
+     81d:	89 fa                	mov    %edi,%edx
+     81f:	11 da                	adc    %ebx,%edx
+     821:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     824:	5b                   	pop    %ebx
+     825:	5e                   	pop    %esi
+     826:	5f                   	pop    %edi
+     827:	5d                   	pop    %ebp
+     828:	c3                   	ret
+     829:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000830 <__popcountsi2>:
+     830:	55                   	push   %ebp
+     831:	89 e5                	mov    %esp,%ebp
+     833:	8b 45 08             	mov    0x8(%ebp),%eax
+     836:	5d                   	pop    %ebp
+     837:	89 c2                	mov    %eax,%edx
+     839:	d1 ea                	shr    %edx
+     83b:	81 e2 55 55 55 55    	and    $0x55555555,%edx
+     841:	29 d0                	sub    %edx,%eax
+     843:	89 c2                	mov    %eax,%edx
+     845:	25 33 33 33 33       	and    $0x33333333,%eax
+     84a:	c1 ea 02             	shr    $0x2,%edx
+     84d:	81 e2 33 33 33 33    	and    $0x33333333,%edx
+     853:	01 c2                	add    %eax,%edx
+     855:	89 d0                	mov    %edx,%eax
+     857:	c1 e8 04             	shr    $0x4,%eax
+     85a:	01 d0                	add    %edx,%eax
+     85c:	25 0f 0f 0f 0f       	and    $0xf0f0f0f,%eax
+     861:	89 c2                	mov    %eax,%edx
+     863:	c1 ea 10             	shr    $0x10,%edx
+     866:	01 c2                	add    %eax,%edx
+     868:	89 d0                	mov    %edx,%eax
+     86a:	c1 e8 08             	shr    $0x8,%eax
+     86d:	01 d0                	add    %edx,%eax
+     86f:	83 e0 3f             	and    $0x3f,%eax
+     872:	c3                   	ret
+     873:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     87a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000880 <__popcountdi2>:
+     880:	55                   	push   %ebp
+     881:	89 e5                	mov    %esp,%ebp
+     883:	57                   	push   %edi
+     884:	56                   	push   %esi
+     885:	53                   	push   %ebx
+     886:	83 ec 24             	sub    $0x24,%esp
+     889:	8b 45 08             	mov    0x8(%ebp),%eax
+     88c:	8b 55 0c             	mov    0xc(%ebp),%edx
+     88f:	89 c1                	mov    %eax,%ecx
+     891:	89 d3                	mov    %edx,%ebx
+     893:	0f ac d1 01          	shrd   $0x1,%edx,%ecx
+     897:	d1 eb                	shr    %ebx
+     899:	89 cf                	mov    %ecx,%edi
+     89b:	81 e7 55 55 55 55    	and    $0x55555555,%edi
+     8a1:	89 7d e0             	mov    %edi,-0x20(%ebp)
+     8a4:	89 df                	mov    %ebx,%edi
+     8a6:	81 e7 55 55 55 55    	and    $0x55555555,%edi
+     8ac:	2b 45 e0             	sub    -0x20(%ebp),%eax
+     8af:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     8b2:	89 c1                	mov    %eax,%ecx
+     8b4:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+     8b7:	0f ac d1 02          	shrd   $0x2,%edx,%ecx
+     8bb:	89 d3                	mov    %edx,%ebx
+     8bd:	89 ce                	mov    %ecx,%esi
+     8bf:	c1 eb 02             	shr    $0x2,%ebx
+     8c2:	81 e6 33 33 33 33    	and    $0x33333333,%esi
+     8c8:	89 df                	mov    %ebx,%edi
+     8ca:	89 75 d8             	mov    %esi,-0x28(%ebp)
+     8cd:	89 c6                	mov    %eax,%esi
+     8cf:	89 d0                	mov    %edx,%eax
+     8d1:	81 e7 33 33 33 33    	and    $0x33333333,%edi
+     8d7:	81 e6 33 33 33 33    	and    $0x33333333,%esi
+     8dd:	25 33 33 33 33       	and    $0x33333333,%eax
+     8e2:	89 7d dc             	mov    %edi,-0x24(%ebp)
+     8e5:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     8e8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     8eb:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     8ee:	89 75 d0             	mov    %esi,-0x30(%ebp)
+     8f1:	03 45 d0             	add    -0x30(%ebp),%eax
+     8f4:	89 c1                	mov    %eax,%ecx
+     8f6:	13 55 d4             	adc    -0x2c(%ebp),%edx
+     8f9:	89 d3                	mov    %edx,%ebx
+     8fb:	0f ac d1 04          	shrd   $0x4,%edx,%ecx
+     8ff:	c1 eb 04             	shr    $0x4,%ebx
+     902:	01 c1                	add    %eax,%ecx
+     904:	89 c8                	mov    %ecx,%eax
+     906:	11 d3                	adc    %edx,%ebx
+     908:	25 0f 0f 0f 0f       	and    $0xf0f0f0f,%eax
+     90d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     910:	89 d8                	mov    %ebx,%eax
+     912:	25 0f 0f 0f 0f       	and    $0xf0f0f0f,%eax
+     917:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     91a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     91d:	89 d0                	mov    %edx,%eax
+     91f:	31 d2                	xor    %edx,%edx
+     921:	03 45 e8             	add    -0x18(%ebp),%eax
+     924:	13 55 ec             	adc    -0x14(%ebp),%edx
+     927:	89 c1                	mov    %eax,%ecx
+     929:	89 d3                	mov    %edx,%ebx
+     92b:	0f ac d1 10          	shrd   $0x10,%edx,%ecx
+     92f:	c1 eb 10             	shr    $0x10,%ebx
+     932:	01 c1                	add    %eax,%ecx
+     934:	11 d3                	adc    %edx,%ebx
+     936:	89 c8                	mov    %ecx,%eax
+     938:	83 c4 24             	add    $0x24,%esp
+     93b:	0f ac d8 08          	shrd   $0x8,%ebx,%eax
+     93f:	5b                   	pop    %ebx
+     940:	5e                   	pop    %esi
+     941:	01 c8                	add    %ecx,%eax
+     943:	5f                   	pop    %edi
+     944:	5d                   	pop    %ebp
+     945:	83 e0 7f             	and    $0x7f,%eax
+     948:	c3                   	ret
+     949:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000950 <__udivdi3>:
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	56                   	push   %esi
+     954:	53                   	push   %ebx
+     955:	8b 45 08             	mov    0x8(%ebp),%eax
+     958:	8b 55 0c             	mov    0xc(%ebp),%edx
+     95b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     95e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     961:	39 d8                	cmp    %ebx,%eax
+     963:	89 d6                	mov    %edx,%esi
+     965:	19 ce                	sbb    %ecx,%esi
+     967:	72 17                	jb     980 <__udivdi3+0x30>
+     969:	c7 45 10 00 00 00 00 	movl   $0x0,0x10(%ebp)
+     970:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     973:	89 4d 0c             	mov    %ecx,0xc(%ebp)
+     976:	5b                   	pop    %ebx
+     977:	5e                   	pop    %esi
+     978:	5d                   	pop    %ebp
+     979:	e9 72 f9 ff ff       	jmp    2f0 <__divmoddi4.part.0>
+     97e:	66 90                	xchg   %ax,%ax
+     980:	5b                   	pop    %ebx
+     981:	31 c0                	xor    %eax,%eax
+     983:	31 d2                	xor    %edx,%edx
+     985:	5e                   	pop    %esi
+     986:	5d                   	pop    %ebp
+     987:	c3                   	ret
+     988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     98f:	90                   	nop
+
+00000990 <__umoddi3>:
+     990:	55                   	push   %ebp
+     991:	89 e5                	mov    %esp,%ebp
+     993:	56                   	push   %esi
+     994:	53                   	push   %ebx
+     995:	83 ec 10             	sub    $0x10,%esp
+     998:	8b 45 08             	mov    0x8(%ebp),%eax
+     99b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     99e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     9a1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+     9a4:	89 d6                	mov    %edx,%esi
+     9a6:	39 c8                	cmp    %ecx,%eax
+     9a8:	19 de                	sbb    %ebx,%esi
+     9aa:	72 17                	jb     9c3 <__umoddi3+0x33>
+     9ac:	83 ec 04             	sub    $0x4,%esp
+     9af:	8d 75 f0             	lea    -0x10(%ebp),%esi
+     9b2:	56                   	push   %esi
+     9b3:	53                   	push   %ebx
+     9b4:	51                   	push   %ecx
+     9b5:	e8 36 f9 ff ff       	call   2f0 <__divmoddi4.part.0>
+     9ba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     9bd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     9c0:	83 c4 10             	add    $0x10,%esp
+     9c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9c6:	5b                   	pop    %ebx
+     9c7:	5e                   	pop    %esi
+     9c8:	5d                   	pop    %ebp
+     9c9:	c3                   	ret
+     9ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009d0 <rate>:
+{
+     9d0:	55                   	push   %ebp
+     9d1:	89 e5                	mov    %esp,%ebp
+     9d3:	57                   	push   %edi
+     9d4:	56                   	push   %esi
+     9d5:	53                   	push   %ebx
+     9d6:	83 ec 0c             	sub    $0xc,%esp
+     9d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     9dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+     9df:	8b 7d 14             	mov    0x14(%ebp),%edi
+  printf(1, "fsbench: %s %d ticks", what, elapsed);
+     9e2:	53                   	push   %ebx
+     9e3:	ff 75 08             	push   0x8(%ebp)
+     9e6:	68 48 16 00 00       	push   $0x1648
+     9eb:	6a 01                	push   $0x1
+     9ed:	e8 2e 09 00 00       	call   1320 <printf>
+  if(elapsed > 0)
+     9f2:	83 c4 10             	add    $0x10,%esp
+     9f5:	85 db                	test   %ebx,%ebx
+     9f7:	75 1f                	jne    a18 <rate+0x48>
+  printf(1, "\n");
+     9f9:	c7 45 0c cf 16 00 00 	movl   $0x16cf,0xc(%ebp)
+     a00:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+     a07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a0a:	5b                   	pop    %ebx
+     a0b:	5e                   	pop    %esi
+     a0c:	5f                   	pop    %edi
+     a0d:	5d                   	pop    %ebp
+  printf(1, "\n");
+     a0e:	e9 0d 09 00 00       	jmp    1320 <printf>
+     a13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a17:	90                   	nop
+    printf(1, " (%d %s/100 ticks)", n * 100 / elapsed, unit);
+     a18:	6b c6 64             	imul   $0x64,%esi,%eax
+     a1b:	31 d2                	xor    %edx,%edx
+     a1d:	57                   	push   %edi
+     a1e:	f7 f3                	div    %ebx
+     a20:	50                   	push   %eax
+     a21:	68 5d 16 00 00       	push   $0x165d
+     a26:	6a 01                	push   $0x1
+     a28:	e8 f3 08 00 00       	call   1320 <printf>
+     a2d:	83 c4 10             	add    $0x10,%esp
+     a30:	eb c7                	jmp    9f9 <rate+0x29>
+     a32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a40 <smallfiles>:
+{
+     a40:	55                   	push   %ebp
+     a41:	89 e5                	mov    %esp,%ebp
+     a43:	57                   	push   %edi
+     a44:	56                   	push   %esi
+     a45:	8d 75 e0             	lea    -0x20(%ebp),%esi
+     a48:	53                   	push   %ebx
+  for(i = 0; i < NSMALL; i++){
+     a49:	31 db                	xor    %ebx,%ebx
+{
+     a4b:	83 ec 30             	sub    $0x30,%esp
+  name[0] = 's';
+     a4e:	c6 45 e0 73          	movb   $0x73,-0x20(%ebp)
+  name[4] = 0;
+     a52:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  memset(buf, 's', SMALLSZ);
+     a56:	68 00 04 00 00       	push   $0x400
+     a5b:	6a 73                	push   $0x73
+     a5d:	68 e0 1e 00 00       	push   $0x1ee0
+     a62:	e8 89 05 00 00       	call   ff0 <memset>
+  start = uptime();
+     a67:	e8 9f 07 00 00       	call   120b <uptime>
+     a6c:	83 c4 10             	add    $0x10,%esp
+     a6f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(i = 0; i < NSMALL; i++){
+     a72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[2] = '0' + (i / 10) % 10;
+     a78:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+     a7d:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i / 100;
+     a80:	c6 45 e1 30          	movb   $0x30,-0x1f(%ebp)
+    name[2] = '0' + (i / 10) % 10;
+     a84:	f7 e3                	mul    %ebx
+     a86:	c1 ea 03             	shr    $0x3,%edx
+     a89:	8d 42 30             	lea    0x30(%edx),%eax
+    name[3] = '0' + i % 10;
+     a8c:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[2] = '0' + (i / 10) % 10;
+     a8f:	88 45 e2             	mov    %al,-0x1e(%ebp)
+    name[3] = '0' + i % 10;
+     a92:	01 d2                	add    %edx,%edx
+     a94:	89 d8                	mov    %ebx,%eax
+     a96:	29 d0                	sub    %edx,%eax
+     a98:	83 c0 30             	add    $0x30,%eax
+     a9b:	88 45 e3             	mov    %al,-0x1d(%ebp)
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+     a9e:	68 02 02 00 00       	push   $0x202
+     aa3:	56                   	push   %esi
+     aa4:	e8 0a 07 00 00       	call   11b3 <open>
+     aa9:	83 c4 10             	add    $0x10,%esp
+     aac:	89 c7                	mov    %eax,%edi
+     aae:	85 c0                	test   %eax,%eax
+     ab0:	0f 88 30 02 00 00    	js     ce6 <smallfiles+0x2a6>
+    if(write(fd, buf, SMALLSZ) != SMALLSZ){
+     ab6:	83 ec 04             	sub    $0x4,%esp
+     ab9:	68 00 04 00 00       	push   $0x400
+     abe:	68 e0 1e 00 00       	push   $0x1ee0
+     ac3:	50                   	push   %eax
+     ac4:	e8 ca 06 00 00       	call   1193 <write>
+     ac9:	83 c4 10             	add    $0x10,%esp
+     acc:	3d 00 04 00 00       	cmp    $0x400,%eax
+     ad1:	0f 85 39 02 00 00    	jne    d10 <smallfiles+0x2d0>
+    close(fd);
+     ad7:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NSMALL; i++){
+     ada:	83 c3 01             	add    $0x1,%ebx
+    close(fd);
+     add:	57                   	push   %edi
+     ade:	e8 b8 06 00 00       	call   119b <close>
+  for(i = 0; i < NSMALL; i++){
+     ae3:	83 c4 10             	add    $0x10,%esp
+     ae6:	83 fb 64             	cmp    $0x64,%ebx
+     ae9:	75 8d                	jne    a78 <smallfiles+0x38>
+  rate("small create", NSMALL, uptime() - start, "files");
+     aeb:	e8 1b 07 00 00       	call   120b <uptime>
+     af0:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     af3:	29 c8                	sub    %ecx,%eax
+  printf(1, "fsbench: %s %d ticks", what, elapsed);
+     af5:	50                   	push   %eax
+  rate("small create", NSMALL, uptime() - start, "files");
+     af6:	89 c3                	mov    %eax,%ebx
+  printf(1, "fsbench: %s %d ticks", what, elapsed);
+     af8:	68 a5 16 00 00       	push   $0x16a5
+     afd:	68 48 16 00 00       	push   $0x1648
+     b02:	6a 01                	push   $0x1
+     b04:	e8 17 08 00 00       	call   1320 <printf>
+  if(elapsed > 0)
+     b09:	83 c4 10             	add    $0x10,%esp
+     b0c:	85 db                	test   %ebx,%ebx
+     b0e:	0f 85 57 01 00 00    	jne    c6b <smallfiles+0x22b>
+  printf(1, "\n");
+     b14:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < NSMALL; i++){
+     b17:	31 db                	xor    %ebx,%ebx
+  printf(1, "\n");
+     b19:	68 cf 16 00 00       	push   $0x16cf
+     b1e:	6a 01                	push   $0x1
+     b20:	e8 fb 07 00 00       	call   1320 <printf>
+  start = uptime();
+     b25:	e8 e1 06 00 00       	call   120b <uptime>
+     b2a:	83 c4 10             	add    $0x10,%esp
+     b2d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    name[2] = '0' + (i / 10) % 10;
+     b30:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    if((fd = open(name, O_RDONLY)) < 0 || read(fd, buf, IOSZ) != SMALLSZ){
+     b35:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i / 100;
+     b38:	c6 45 e1 30          	movb   $0x30,-0x1f(%ebp)
+    name[2] = '0' + (i / 10) % 10;
+     b3c:	f7 e3                	mul    %ebx
+     b3e:	c1 ea 03             	shr    $0x3,%edx
+     b41:	8d 42 30             	lea    0x30(%edx),%eax
+    name[3] = '0' + i % 10;
+     b44:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[2] = '0' + (i / 10) % 10;
+     b47:	88 45 e2             	mov    %al,-0x1e(%ebp)
+    name[3] = '0' + i % 10;
+     b4a:	01 d2                	add    %edx,%edx
+     b4c:	89 d8                	mov    %ebx,%eax
+     b4e:	29 d0                	sub    %edx,%eax
+     b50:	83 c0 30             	add    $0x30,%eax
+     b53:	88 45 e3             	mov    %al,-0x1d(%ebp)
+    if((fd = open(name, O_RDONLY)) < 0 || read(fd, buf, IOSZ) != SMALLSZ){
+     b56:	6a 00                	push   $0x0
+     b58:	56                   	push   %esi
+     b59:	e8 55 06 00 00       	call   11b3 <open>
+     b5e:	83 c4 10             	add    $0x10,%esp
+     b61:	89 c7                	mov    %eax,%edi
+     b63:	85 c0                	test   %eax,%eax
+     b65:	0f 88 66 01 00 00    	js     cd1 <smallfiles+0x291>
+     b6b:	83 ec 04             	sub    $0x4,%esp
+     b6e:	68 00 20 00 00       	push   $0x2000
+     b73:	68 e0 1e 00 00       	push   $0x1ee0
+     b78:	50                   	push   %eax
+     b79:	e8 0d 06 00 00       	call   118b <read>
+     b7e:	83 c4 10             	add    $0x10,%esp
+     b81:	3d 00 04 00 00       	cmp    $0x400,%eax
+     b86:	0f 85 45 01 00 00    	jne    cd1 <smallfiles+0x291>
+    close(fd);
+     b8c:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NSMALL; i++){
+     b8f:	83 c3 01             	add    $0x1,%ebx
+    close(fd);
+     b92:	57                   	push   %edi
+     b93:	e8 03 06 00 00       	call   119b <close>
+  for(i = 0; i < NSMALL; i++){
+     b98:	83 c4 10             	add    $0x10,%esp
+     b9b:	83 fb 64             	cmp    $0x64,%ebx
+     b9e:	75 90                	jne    b30 <smallfiles+0xf0>
+  rate("small read", NSMALL, uptime() - start, "files");
+     ba0:	e8 66 06 00 00       	call   120b <uptime>
+     ba5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     ba8:	29 c8                	sub    %ecx,%eax
+  printf(1, "fsbench: %s %d ticks", what, elapsed);
+     baa:	50                   	push   %eax
+  rate("small read", NSMALL, uptime() - start, "files");
+     bab:	89 c3                	mov    %eax,%ebx
+  printf(1, "fsbench: %s %d ticks", what, elapsed);
+     bad:	68 d1 16 00 00       	push   $0x16d1
+     bb2:	68 48 16 00 00       	push   $0x1648
+     bb7:	6a 01                	push   $0x1
+     bb9:	e8 62 07 00 00       	call   1320 <printf>
+  if(elapsed > 0)
+     bbe:	83 c4 10             	add    $0x10,%esp
+     bc1:	85 db                	test   %ebx,%ebx
+     bc3:	0f 85 c5 00 00 00    	jne    c8e <smallfiles+0x24e>
+  printf(1, "\n");
+     bc9:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < NSMALL; i++){
+     bcc:	31 ff                	xor    %edi,%edi
+    name[2] = '0' + (i / 10) % 10;
+     bce:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+  printf(1, "\n");
+     bd3:	68 cf 16 00 00       	push   $0x16cf
+     bd8:	6a 01                	push   $0x1
+     bda:	e8 41 07 00 00       	call   1320 <printf>
+  start = uptime();
+     bdf:	e8 27 06 00 00       	call   120b <uptime>
+     be4:	83 c4 10             	add    $0x10,%esp
+     be7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(i = 0; i < NSMALL; i++){
+     bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[2] = '0' + (i / 10) % 10;
+     bf0:	89 f8                	mov    %edi,%eax
+    if(unlink(name) < 0){
+     bf2:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i / 100;
+     bf5:	c6 45 e1 30          	movb   $0x30,-0x1f(%ebp)
+    name[2] = '0' + (i / 10) % 10;
+     bf9:	f7 e3                	mul    %ebx
+     bfb:	c1 ea 03             	shr    $0x3,%edx
+     bfe:	8d 42 30             	lea    0x30(%edx),%eax
+    name[3] = '0' + i % 10;
+     c01:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[2] = '0' + (i / 10) % 10;
+     c04:	88 45 e2             	mov    %al,-0x1e(%ebp)
+    name[3] = '0' + i % 10;
+     c07:	01 d2                	add    %edx,%edx
+     c09:	89 f8                	mov    %edi,%eax
+     c0b:	29 d0                	sub    %edx,%eax
+     c0d:	83 c0 30             	add    $0x30,%eax
+     c10:	88 45 e3             	mov    %al,-0x1d(%ebp)
+    if(unlink(name) < 0){
+     c13:	56                   	push   %esi
+     c14:	e8 aa 05 00 00       	call   11c3 <unlink>
+     c19:	83 c4 10             	add    $0x10,%esp
+     c1c:	85 c0                	test   %eax,%eax
+     c1e:	0f 88 d7 00 00 00    	js     cfb <smallfiles+0x2bb>
+  for(i = 0; i < NSMALL; i++){
+     c24:	83 c7 01             	add    $0x1,%edi
+     c27:	83 ff 64             	cmp    $0x64,%edi
+     c2a:	75 c4                	jne    bf0 <smallfiles+0x1b0>
+  rate("small unlink", NSMALL, uptime() - start, "files");
+     c2c:	e8 da 05 00 00       	call   120b <uptime>
+     c31:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     c34:	29 c8                	sub    %ecx,%eax
+  printf(1, "fsbench: %s %d ticks", what, elapsed);
+     c36:	50                   	push   %eax
+  rate("small unlink", NSMALL, uptime() - start, "files");
+     c37:	89 c3                	mov    %eax,%ebx
+  printf(1, "fsbench: %s %d ticks", what, elapsed);
+     c39:	68 f7 16 00 00       	push   $0x16f7
+     c3e:	68 48 16 00 00       	push   $0x1648
+     c43:	6a 01                	push   $0x1
+     c45:	e8 d6 06 00 00       	call   1320 <printf>
+  if(elapsed > 0)
+     c4a:	83 c4 10             	add    $0x10,%esp
+     c4d:	85 db                	test   %ebx,%ebx
+     c4f:	75 60                	jne    cb1 <smallfiles+0x271>
+  printf(1, "\n");
+     c51:	83 ec 08             	sub    $0x8,%esp
+     c54:	68 cf 16 00 00       	push   $0x16cf
+     c59:	6a 01                	push   $0x1
+     c5b:	e8 c0 06 00 00       	call   1320 <printf>
+}
+     c60:	83 c4 10             	add    $0x10,%esp
+     c63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c66:	5b                   	pop    %ebx
+     c67:	5e                   	pop    %esi
+     c68:	5f                   	pop    %edi
+     c69:	5d                   	pop    %ebp
+     c6a:	c3                   	ret
+    printf(1, " (%d %s/100 ticks)", n * 100 / elapsed, unit);
+     c6b:	b8 10 27 00 00       	mov    $0x2710,%eax
+     c70:	31 d2                	xor    %edx,%edx
+     c72:	68 b2 16 00 00       	push   $0x16b2
+     c77:	f7 f3                	div    %ebx
+     c79:	50                   	push   %eax
+     c7a:	68 5d 16 00 00       	push   $0x165d
+     c7f:	6a 01                	push   $0x1
+     c81:	e8 9a 06 00 00       	call   1320 <printf>
+     c86:	83 c4 10             	add    $0x10,%esp
+     c89:	e9 86 fe ff ff       	jmp    b14 <smallfiles+0xd4>
+     c8e:	b8 10 27 00 00       	mov    $0x2710,%eax
+     c93:	31 d2                	xor    %edx,%edx
+     c95:	68 b2 16 00 00       	push   $0x16b2
+     c9a:	f7 f3                	div    %ebx
+     c9c:	50                   	push   %eax
+     c9d:	68 5d 16 00 00       	push   $0x165d
+     ca2:	6a 01                	push   $0x1
+     ca4:	e8 77 06 00 00       	call   1320 <printf>
+     ca9:	83 c4 10             	add    $0x10,%esp
+     cac:	e9 18 ff ff ff       	jmp    bc9 <smallfiles+0x189>
+     cb1:	b8 10 27 00 00       	mov    $0x2710,%eax
+     cb6:	31 d2                	xor    %edx,%edx
+     cb8:	68 b2 16 00 00       	push   $0x16b2
+     cbd:	f7 f3                	div    %ebx
+     cbf:	50                   	push   %eax
+     cc0:	68 5d 16 00 00       	push   $0x165d
+     cc5:	6a 01                	push   $0x1
+     cc7:	e8 54 06 00 00       	call   1320 <printf>
+     ccc:	83 c4 10             	add    $0x10,%esp
+     ccf:	eb 80                	jmp    c51 <smallfiles+0x211>
+      printf(1, "fsbench: read %s failed\n", name);
+     cd1:	83 ec 04             	sub    $0x4,%esp
+     cd4:	56                   	push   %esi
+     cd5:	68 b8 16 00 00       	push   $0x16b8
+     cda:	6a 01                	push   $0x1
+     cdc:	e8 3f 06 00 00       	call   1320 <printf>
+      exit();
+     ce1:	e8 8d 04 00 00       	call   1173 <exit>
+      printf(1, "fsbench: cannot create %s\n", name);
+     ce6:	83 ec 04             	sub    $0x4,%esp
+     ce9:	56                   	push   %esi
+     cea:	68 70 16 00 00       	push   $0x1670
+     cef:	6a 01                	push   $0x1
+     cf1:	e8 2a 06 00 00       	call   1320 <printf>
+      exit();
+     cf6:	e8 78 04 00 00       	call   1173 <exit>
+      printf(1, "fsbench: unlink %s failed\n", name);
+     cfb:	83 ec 04             	sub    $0x4,%esp
+     cfe:	56                   	push   %esi
+     cff:	68 dc 16 00 00       	push   $0x16dc
+     d04:	6a 01                	push   $0x1
+     d06:	e8 15 06 00 00       	call   1320 <printf>
+      exit();
+     d0b:	e8 63 04 00 00       	call   1173 <exit>
+      printf(1, "fsbench: write %s failed\n", name);
+     d10:	83 ec 04             	sub    $0x4,%esp
+     d13:	56                   	push   %esi
+     d14:	68 8b 16 00 00       	push   $0x168b
+     d19:	6a 01                	push   $0x1
+     d1b:	e8 00 06 00 00       	call   1320 <printf>
+      exit();
+     d20:	e8 4e 04 00 00       	call   1173 <exit>
+     d25:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d30 <largefile>:
+{
+     d30:	55                   	push   %ebp
+     d31:	89 e5                	mov    %esp,%ebp
+     d33:	57                   	push   %edi
+     d34:	56                   	push   %esi
+     d35:	53                   	push   %ebx
+     d36:	83 ec 10             	sub    $0x10,%esp
+  memset(buf, 'l', sizeof(buf));
+     d39:	68 00 20 00 00       	push   $0x2000
+     d3e:	6a 6c                	push   $0x6c
+     d40:	68 e0 1e 00 00       	push   $0x1ee0
+     d45:	e8 a6 02 00 00       	call   ff0 <memset>
+  if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+     d4a:	5e                   	pop    %esi
+     d4b:	5f                   	pop    %edi
+     d4c:	68 02 02 00 00       	push   $0x202
+     d51:	68 04 17 00 00       	push   $0x1704
+     d56:	e8 58 04 00 00       	call   11b3 <open>
+     d5b:	83 c4 10             	add    $0x10,%esp
+     d5e:	85 c0                	test   %eax,%eax
+     d60:	0f 88 7a 01 00 00    	js     ee0 <largefile+0x1b0>
+     d66:	89 c6                	mov    %eax,%esi
+  start = uptime();
+     d68:	bb 00 02 00 00       	mov    $0x200,%ebx
+     d6d:	e8 99 04 00 00       	call   120b <uptime>
+     d72:	89 c7                	mov    %eax,%edi
+  for(tot = 0; tot < LARGESZ; tot += n)
+     d74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((n = write(fd, buf, sizeof(buf))) != sizeof(buf)){
+     d78:	83 ec 04             	sub    $0x4,%esp
+     d7b:	68 00 20 00 00       	push   $0x2000
+     d80:	68 e0 1e 00 00       	push   $0x1ee0
+     d85:	56                   	push   %esi
+     d86:	e8 08 04 00 00       	call   1193 <write>
+     d8b:	83 c4 10             	add    $0x10,%esp
+     d8e:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     d93:	0f 85 2e 01 00 00    	jne    ec7 <largefile+0x197>
+  for(tot = 0; tot < LARGESZ; tot += n)
+     d99:	83 eb 01             	sub    $0x1,%ebx
+     d9c:	75 da                	jne    d78 <largefile+0x48>
+  close(fd);
+     d9e:	83 ec 0c             	sub    $0xc,%esp
+     da1:	56                   	push   %esi
+     da2:	e8 f4 03 00 00       	call   119b <close>
+  rate("large write", LARGESZ / 1024, uptime() - start, "KB");
+     da7:	e8 5f 04 00 00       	call   120b <uptime>
+     dac:	29 f8                	sub    %edi,%eax
+  printf(1, "fsbench: %s %d ticks", what, elapsed);
+     dae:	50                   	push   %eax
+  rate("large write", LARGESZ / 1024, uptime() - start, "KB");
+     daf:	89 c3                	mov    %eax,%ebx
+  printf(1, "fsbench: %s %d ticks", what, elapsed);
+     db1:	68 12 17 00 00       	push   $0x1712
+     db6:	68 48 16 00 00       	push   $0x1648
+     dbb:	6a 01                	push   $0x1
+     dbd:	e8 5e 05 00 00       	call   1320 <printf>
+  if(elapsed > 0)
+     dc2:	83 c4 20             	add    $0x20,%esp
+     dc5:	85 db                	test   %ebx,%ebx
+     dc7:	0f 85 b7 00 00 00    	jne    e84 <largefile+0x154>
+  printf(1, "\n");
+     dcd:	83 ec 08             	sub    $0x8,%esp
+     dd0:	68 cf 16 00 00       	push   $0x16cf
+     dd5:	6a 01                	push   $0x1
+     dd7:	e8 44 05 00 00       	call   1320 <printf>
+  if((fd = open(path, O_RDONLY)) < 0){
+     ddc:	5a                   	pop    %edx
+     ddd:	59                   	pop    %ecx
+     dde:	6a 00                	push   $0x0
+     de0:	68 04 17 00 00       	push   $0x1704
+     de5:	e8 c9 03 00 00       	call   11b3 <open>
+     dea:	83 c4 10             	add    $0x10,%esp
+     ded:	89 c6                	mov    %eax,%esi
+     def:	85 c0                	test   %eax,%eax
+     df1:	0f 88 17 01 00 00    	js     f0e <largefile+0x1de>
+  start = uptime();
+     df7:	e8 0f 04 00 00       	call   120b <uptime>
+  for(tot = 0; (n = read(fd, buf, sizeof(buf))) > 0; tot += n)
+     dfc:	31 db                	xor    %ebx,%ebx
+  start = uptime();
+     dfe:	89 c7                	mov    %eax,%edi
+  for(tot = 0; (n = read(fd, buf, sizeof(buf))) > 0; tot += n)
+     e00:	eb 08                	jmp    e0a <largefile+0xda>
+     e02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     e08:	01 c3                	add    %eax,%ebx
+     e0a:	83 ec 04             	sub    $0x4,%esp
+     e0d:	68 00 20 00 00       	push   $0x2000
+     e12:	68 e0 1e 00 00       	push   $0x1ee0
+     e17:	56                   	push   %esi
+     e18:	e8 6e 03 00 00       	call   118b <read>
+     e1d:	83 c4 10             	add    $0x10,%esp
+     e20:	85 c0                	test   %eax,%eax
+     e22:	7f e4                	jg     e08 <largefile+0xd8>
+  close(fd);
+     e24:	83 ec 0c             	sub    $0xc,%esp
+     e27:	56                   	push   %esi
+     e28:	e8 6e 03 00 00       	call   119b <close>
+  if(tot != LARGESZ){
+     e2d:	83 c4 10             	add    $0x10,%esp
+     e30:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+     e36:	0f 85 bb 00 00 00    	jne    ef7 <largefile+0x1c7>
+  rate("large read", LARGESZ / 1024, uptime() - start, "KB");
+     e3c:	e8 ca 03 00 00       	call   120b <uptime>
+     e41:	29 f8                	sub    %edi,%eax
+  printf(1, "fsbench: %s %d ticks", what, elapsed);
+     e43:	50                   	push   %eax
+  rate("large read", LARGESZ / 1024, uptime() - start, "KB");
+     e44:	89 c3                	mov    %eax,%ebx
+  printf(1, "fsbench: %s %d ticks", what, elapsed);
+     e46:	68 58 17 00 00       	push   $0x1758
+     e4b:	68 48 16 00 00       	push   $0x1648
+     e50:	6a 01                	push   $0x1
+     e52:	e8 c9 04 00 00       	call   1320 <printf>
+  if(elapsed > 0)
+     e57:	83 c4 10             	add    $0x10,%esp
+     e5a:	85 db                	test   %ebx,%ebx
+     e5c:	75 49                	jne    ea7 <largefile+0x177>
+  printf(1, "\n");
+     e5e:	83 ec 08             	sub    $0x8,%esp
+     e61:	68 cf 16 00 00       	push   $0x16cf
+     e66:	6a 01                	push   $0x1
+     e68:	e8 b3 04 00 00       	call   1320 <printf>
+  unlink(path);
+     e6d:	c7 04 24 04 17 00 00 	movl   $0x1704,(%esp)
+     e74:	e8 4a 03 00 00       	call   11c3 <unlink>
+}
+     e79:	83 c4 10             	add    $0x10,%esp
+     e7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e7f:	5b                   	pop    %ebx
+     e80:	5e                   	pop    %esi
+     e81:	5f                   	pop    %edi
+     e82:	5d                   	pop    %ebp
+     e83:	c3                   	ret
+    printf(1, " (%d %s/100 ticks)", n * 100 / elapsed, unit);
+     e84:	b8 00 40 06 00       	mov    $0x64000,%eax
+     e89:	31 d2                	xor    %edx,%edx
+     e8b:	68 1e 17 00 00       	push   $0x171e
+     e90:	f7 f3                	div    %ebx
+     e92:	50                   	push   %eax
+     e93:	68 5d 16 00 00       	push   $0x165d
+     e98:	6a 01                	push   $0x1
+     e9a:	e8 81 04 00 00       	call   1320 <printf>
+     e9f:	83 c4 10             	add    $0x10,%esp
+     ea2:	e9 26 ff ff ff       	jmp    dcd <largefile+0x9d>
+     ea7:	b8 00 40 06 00       	mov    $0x64000,%eax
+     eac:	31 d2                	xor    %edx,%edx
+     eae:	68 1e 17 00 00       	push   $0x171e
+     eb3:	f7 f3                	div    %ebx
+     eb5:	50                   	push   %eax
+     eb6:	68 5d 16 00 00       	push   $0x165d
+     ebb:	6a 01                	push   $0x1
+     ebd:	e8 5e 04 00 00       	call   1320 <printf>
+     ec2:	83 c4 10             	add    $0x10,%esp
+     ec5:	eb 97                	jmp    e5e <largefile+0x12e>
+      printf(1, "fsbench: write %s failed\n", path);
+     ec7:	83 ec 04             	sub    $0x4,%esp
+     eca:	68 04 17 00 00       	push   $0x1704
+     ecf:	68 8b 16 00 00       	push   $0x168b
+     ed4:	6a 01                	push   $0x1
+     ed6:	e8 45 04 00 00       	call   1320 <printf>
+      exit();
+     edb:	e8 93 02 00 00       	call   1173 <exit>
+    printf(1, "fsbench: cannot create %s\n", path);
+     ee0:	53                   	push   %ebx
+     ee1:	68 04 17 00 00       	push   $0x1704
+     ee6:	68 70 16 00 00       	push   $0x1670
+     eeb:	6a 01                	push   $0x1
+     eed:	e8 2e 04 00 00       	call   1320 <printf>
+    exit();
+     ef2:	e8 7c 02 00 00       	call   1173 <exit>
+    printf(1, "fsbench: read %d bytes of %s\n", tot, path);
+     ef7:	68 04 17 00 00       	push   $0x1704
+     efc:	53                   	push   %ebx
+     efd:	68 3a 17 00 00       	push   $0x173a
+     f02:	6a 01                	push   $0x1
+     f04:	e8 17 04 00 00       	call   1320 <printf>
+    exit();
+     f09:	e8 65 02 00 00       	call   1173 <exit>
+    printf(1, "fsbench: cannot open %s\n", path);
+     f0e:	50                   	push   %eax
+     f0f:	68 04 17 00 00       	push   $0x1704
+     f14:	68 21 17 00 00       	push   $0x1721
+     f19:	6a 01                	push   $0x1
+     f1b:	e8 00 04 00 00       	call   1320 <printf>
+    exit();
+     f20:	e8 4e 02 00 00       	call   1173 <exit>
+     f25:	66 90                	xchg   %ax,%ax
+     f27:	66 90                	xchg   %ax,%ax
+     f29:	66 90                	xchg   %ax,%ax
+     f2b:	66 90                	xchg   %ax,%ax
+     f2d:	66 90                	xchg   %ax,%ax
+     f2f:	90                   	nop
+
+00000f30 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     f30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     f31:	31 c0                	xor    %eax,%eax
+{
+     f33:	89 e5                	mov    %esp,%ebp
+     f35:	53                   	push   %ebx
+     f36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     f39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     f3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     f40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     f44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     f47:	83 c0 01             	add    $0x1,%eax
+     f4a:	84 d2                	test   %dl,%dl
+     f4c:	75 f2                	jne    f40 <strcpy+0x10>
+    ;
+  return os;
+}
+     f4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f51:	89 c8                	mov    %ecx,%eax
+     f53:	c9                   	leave
+     f54:	c3                   	ret
+     f55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000f60 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	53                   	push   %ebx
+     f64:	8b 55 08             	mov    0x8(%ebp),%edx
+     f67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     f6a:	0f b6 02             	movzbl (%edx),%eax
+     f6d:	84 c0                	test   %al,%al
+     f6f:	75 17                	jne    f88 <strcmp+0x28>
+     f71:	eb 3a                	jmp    fad <strcmp+0x4d>
+     f73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f77:	90                   	nop
+     f78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     f7c:	83 c2 01             	add    $0x1,%edx
+     f7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     f82:	84 c0                	test   %al,%al
+     f84:	74 1a                	je     fa0 <strcmp+0x40>
+    p++, q++;
+     f86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     f88:	0f b6 19             	movzbl (%ecx),%ebx
+     f8b:	38 c3                	cmp    %al,%bl
+     f8d:	74 e9                	je     f78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     f8f:	29 d8                	sub    %ebx,%eax
+}
+     f91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f94:	c9                   	leave
+     f95:	c3                   	ret
+     f96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     fa0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     fa4:	31 c0                	xor    %eax,%eax
+     fa6:	29 d8                	sub    %ebx,%eax
+}
+     fa8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fab:	c9                   	leave
+     fac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     fad:	0f b6 19             	movzbl (%ecx),%ebx
+     fb0:	31 c0                	xor    %eax,%eax
+     fb2:	eb db                	jmp    f8f <strcmp+0x2f>
+     fb4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fbf:	90                   	nop
+
+00000fc0 <strlen>:
+
+uint
+strlen(char *s)
+{
+     fc0:	55                   	push   %ebp
+     fc1:	89 e5                	mov    %esp,%ebp
+     fc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     fc6:	80 3a 00             	cmpb   $0x0,(%edx)
+     fc9:	74 15                	je     fe0 <strlen+0x20>
+     fcb:	31 c0                	xor    %eax,%eax
+     fcd:	8d 76 00             	lea    0x0(%esi),%esi
+     fd0:	83 c0 01             	add    $0x1,%eax
+     fd3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     fd7:	89 c1                	mov    %eax,%ecx
+     fd9:	75 f5                	jne    fd0 <strlen+0x10>
+    ;
+  return n;
+}
+     fdb:	89 c8                	mov    %ecx,%eax
+     fdd:	5d                   	pop    %ebp
+     fde:	c3                   	ret
+     fdf:	90                   	nop
+  for(n = 0; s[n]; n++)
+     fe0:	31 c9                	xor    %ecx,%ecx
+}
+     fe2:	5d                   	pop    %ebp
+     fe3:	89 c8                	mov    %ecx,%eax
+     fe5:	c3                   	ret
+     fe6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ff0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	57                   	push   %edi
+     ff4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     ff7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     ffa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ffd:	89 d7                	mov    %edx,%edi
+     fff:	fc                   	cld
+    1000:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    1002:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    1005:	89 d0                	mov    %edx,%eax
+    1007:	c9                   	leave
+    1008:	c3                   	ret
+    1009:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001010 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	8b 45 08             	mov    0x8(%ebp),%eax
+    1016:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    101a:	0f b6 10             	movzbl (%eax),%edx
+    101d:	84 d2                	test   %dl,%dl
+    101f:	75 12                	jne    1033 <strchr+0x23>
+    1021:	eb 1d                	jmp    1040 <strchr+0x30>
+    1023:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1027:	90                   	nop
+    1028:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    102c:	83 c0 01             	add    $0x1,%eax
+    102f:	84 d2                	test   %dl,%dl
+    1031:	74 0d                	je     1040 <strchr+0x30>
+    if(*s == c)
+    1033:	38 d1                	cmp    %dl,%cl
+    1035:	75 f1                	jne    1028 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1037:	5d                   	pop    %ebp
+    1038:	c3                   	ret
+    1039:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1040:	31 c0                	xor    %eax,%eax
+}
+    1042:	5d                   	pop    %ebp
+    1043:	c3                   	ret
+    1044:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    104b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    104f:	90                   	nop
+
+00001050 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1050:	55                   	push   %ebp
+    1051:	89 e5                	mov    %esp,%ebp
+    1053:	57                   	push   %edi
+    1054:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1055:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1058:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1059:	31 db                	xor    %ebx,%ebx
+{
+    105b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    105e:	eb 27                	jmp    1087 <gets+0x37>
+    cc = read(0, &c, 1);
+    1060:	83 ec 04             	sub    $0x4,%esp
+    1063:	6a 01                	push   $0x1
+    1065:	56                   	push   %esi
+    1066:	6a 00                	push   $0x0
+    1068:	e8 1e 01 00 00       	call   118b <read>
+    if(cc < 1)
+    106d:	83 c4 10             	add    $0x10,%esp
+    1070:	85 c0                	test   %eax,%eax
+    1072:	7e 1d                	jle    1091 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1074:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1078:	8b 55 08             	mov    0x8(%ebp),%edx
+    107b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    107f:	3c 0a                	cmp    $0xa,%al
+    1081:	74 10                	je     1093 <gets+0x43>
+    1083:	3c 0d                	cmp    $0xd,%al
+    1085:	74 0c                	je     1093 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1087:	89 df                	mov    %ebx,%edi
+    1089:	83 c3 01             	add    $0x1,%ebx
+    108c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    108f:	7c cf                	jl     1060 <gets+0x10>
+    1091:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1093:	8b 45 08             	mov    0x8(%ebp),%eax
+    1096:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    109a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    109d:	5b                   	pop    %ebx
+    109e:	5e                   	pop    %esi
+    109f:	5f                   	pop    %edi
+    10a0:	5d                   	pop    %ebp
+    10a1:	c3                   	ret
+    10a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000010b0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    10b0:	55                   	push   %ebp
+    10b1:	89 e5                	mov    %esp,%ebp
+    10b3:	56                   	push   %esi
+    10b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    10b5:	83 ec 08             	sub    $0x8,%esp
+    10b8:	6a 00                	push   $0x0
+    10ba:	ff 75 08             	push   0x8(%ebp)
+    10bd:	e8 f1 00 00 00       	call   11b3 <open>
+  if(fd < 0)
+    10c2:	83 c4 10             	add    $0x10,%esp
+    10c5:	85 c0                	test   %eax,%eax
+    10c7:	78 27                	js     10f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    10c9:	83 ec 08             	sub    $0x8,%esp
+    10cc:	ff 75 0c             	push   0xc(%ebp)
+    10cf:	89 c3                	mov    %eax,%ebx
+    10d1:	50                   	push   %eax
+    10d2:	e8 f4 00 00 00       	call   11cb <fstat>
+  close(fd);
+    10d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    10da:	89 c6                	mov    %eax,%esi
+  close(fd);
+    10dc:	e8 ba 00 00 00       	call   119b <close>
+  return r;
+    10e1:	83 c4 10             	add    $0x10,%esp
+}
+    10e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10e7:	89 f0                	mov    %esi,%eax
+    10e9:	5b                   	pop    %ebx
+    10ea:	5e                   	pop    %esi
+    10eb:	5d                   	pop    %ebp
+    10ec:	c3                   	ret
+    10ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    10f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    10f5:	eb ed                	jmp    10e4 <stat+0x34>
+    10f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10fe:	66 90                	xchg   %ax,%ax
+
+00001100 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1100:	55                   	push   %ebp
+    1101:	89 e5                	mov    %esp,%ebp
+    1103:	53                   	push   %ebx
+    1104:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    1107:	0f be 02             	movsbl (%edx),%eax
+    110a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    110d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    1110:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    1115:	77 1e                	ja     1135 <atoi+0x35>
+    1117:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    1120:	83 c2 01             	add    $0x1,%edx
+    1123:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    1126:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    112a:	0f be 02             	movsbl (%edx),%eax
+    112d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1130:	80 fb 09             	cmp    $0x9,%bl
+    1133:	76 eb                	jbe    1120 <atoi+0x20>
+  return n;
+}
+    1135:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1138:	89 c8                	mov    %ecx,%eax
+    113a:	c9                   	leave
+    113b:	c3                   	ret
+    113c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001140 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	57                   	push   %edi
+    1144:	56                   	push   %esi
+    1145:	8b 45 10             	mov    0x10(%ebp),%eax
+    1148:	8b 55 08             	mov    0x8(%ebp),%edx
+    114b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    114e:	85 c0                	test   %eax,%eax
+    1150:	7e 13                	jle    1165 <memmove+0x25>
+    1152:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1154:	89 d7                	mov    %edx,%edi
+    1156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    115d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1160:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1161:	39 f8                	cmp    %edi,%eax
+    1163:	75 fb                	jne    1160 <memmove+0x20>
+  return vdst;
+}
+    1165:	5e                   	pop    %esi
+    1166:	89 d0                	mov    %edx,%eax
+    1168:	5f                   	pop    %edi
+    1169:	5d                   	pop    %ebp
+    116a:	c3                   	ret
+
+0000116b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    116b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1170:	cd 40                	int    $0x40
+    1172:	c3                   	ret
+
+00001173 <exit>:
+SYSCALL(exit)
+    1173:	b8 02 00 00 00       	mov    $0x2,%eax
+    1178:	cd 40                	int    $0x40
+    117a:	c3                   	ret
+
+0000117b <wait>:
+SYSCALL(wait)
+    117b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1180:	cd 40                	int    $0x40
+    1182:	c3                   	ret
+
+00001183 <pipe>:
+SYSCALL(pipe)
+    1183:	b8 04 00 00 00       	mov    $0x4,%eax
+    1188:	cd 40                	int    $0x40
+    118a:	c3                   	ret
+
+0000118b <read>:
+SYSCALL(read)
+    118b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1190:	cd 40                	int    $0x40
+    1192:	c3                   	ret
+
+00001193 <write>:
+SYSCALL(write)
+    1193:	b8 10 00 00 00       	mov    $0x10,%eax
+    1198:	cd 40                	int    $0x40
+    119a:	c3                   	ret
+
+0000119b <close>:
+SYSCALL(close)
+    119b:	b8 15 00 00 00       	mov    $0x15,%eax
+    11a0:	cd 40                	int    $0x40
+    11a2:	c3                   	ret
+
+000011a3 <kill>:
+SYSCALL(kill)
+    11a3:	b8 06 00 00 00       	mov    $0x6,%eax
+    11a8:	cd 40                	int    $0x40
+    11aa:	c3                   	ret
+
+000011ab <exec>:
+SYSCALL(exec)
+    11ab:	b8 07 00 00 00       	mov    $0x7,%eax
+    11b0:	cd 40                	int    $0x40
+    11b2:	c3                   	ret
+
+000011b3 <open>:
+SYSCALL(open)
+    11b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    11b8:	cd 40                	int    $0x40
+    11ba:	c3                   	ret
+
+000011bb <mknod>:
+SYSCALL(mknod)
+    11bb:	b8 11 00 00 00       	mov    $0x11,%eax
+    11c0:	cd 40                	int    $0x40
+    11c2:	c3                   	ret
+
+000011c3 <unlink>:
+SYSCALL(unlink)
+    11c3:	b8 12 00 00 00       	mov    $0x12,%eax
+    11c8:	cd 40                	int    $0x40
+    11ca:	c3                   	ret
+
+000011cb <fstat>:
+SYSCALL(fstat)
+    11cb:	b8 08 00 00 00       	mov    $0x8,%eax
+    11d0:	cd 40                	int    $0x40
+    11d2:	c3                   	ret
+
+000011d3 <link>:
+SYSCALL(link)
+    11d3:	b8 13 00 00 00       	mov    $0x13,%eax
+    11d8:	cd 40                	int    $0x40
+    11da:	c3                   	ret
+
+000011db <mkdir>:
+SYSCALL(mkdir)
+    11db:	b8 14 00 00 00       	mov    $0x14,%eax
+    11e0:	cd 40                	int    $0x40
+    11e2:	c3                   	ret
+
+000011e3 <chdir>:
+SYSCALL(chdir)
+    11e3:	b8 09 00 00 00       	mov    $0x9,%eax
+    11e8:	cd 40                	int    $0x40
+    11ea:	c3                   	ret
+
+000011eb <dup>:
+SYSCALL(dup)
+    11eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    11f0:	cd 40                	int    $0x40
+    11f2:	c3                   	ret
+
+000011f3 <getpid>:
+SYSCALL(getpid)
+    11f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    11f8:	cd 40                	int    $0x40
+    11fa:	c3                   	ret
+
+000011fb <sbrk>:
+SYSCALL(sbrk)
+    11fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1200:	cd 40                	int    $0x40
+    1202:	c3                   	ret
+
+00001203 <sleep>:
+SYSCALL(sleep)
+    1203:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1208:	cd 40                	int    $0x40
+    120a:	c3                   	ret
+
+0000120b <uptime>:
+SYSCALL(uptime)
+    120b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1210:	cd 40                	int    $0x40
+    1212:	c3                   	ret
+
+00001213 <trace>:
+SYSCALL(trace)
+    1213:	b8 16 00 00 00       	mov    $0x16,%eax
+    1218:	cd 40                	int    $0x40
+    121a:	c3                   	ret
+
+0000121b <csinfo>:
+SYSCALL(csinfo)
+    121b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1220:	cd 40                	int    $0x40
+    1222:	c3                   	ret
+
+00001223 <settickets>:
+SYSCALL(settickets)
+    1223:	b8 18 00 00 00       	mov    $0x18,%eax
+    1228:	cd 40                	int    $0x40
+    122a:	c3                   	ret
+
+0000122b <getprocessesinfo>:
+SYSCALL(getprocessesinfo)
+    122b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1230:	cd 40                	int    $0x40
+    1232:	c3                   	ret
+
+00001233 <yield>:
+SYSCALL(yield)
+    1233:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1238:	cd 40                	int    $0x40
+    123a:	c3                   	ret
+
+0000123b <random>:
+SYSCALL(random)
+    123b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1240:	cd 40                	int    $0x40
+    1242:	c3                   	ret
+
+00001243 <dumppagetable>:
+SYSCALL(dumppagetable)
+    1243:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1248:	cd 40                	int    $0x40
+    124a:	c3                   	ret
+
+0000124b <getcpusinfo>:
+SYSCALL(getcpusinfo)
+    124b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1250:	cd 40                	int    $0x40
+    1252:	c3                   	ret
+
+00001253 <setsched>:
+SYSCALL(setsched)
+    1253:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1258:	cd 40                	int    $0x40
+    125a:	c3                   	ret
+
+0000125b <getbcacheinfo>:
+SYSCALL(getbcacheinfo)
+    125b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1260:	cd 40                	int    $0x40
+    1262:	c3                   	ret
+
+00001263 <getballocinfo>:
+SYSCALL(getballocinfo)
+    1263:	b8 20 00 00 00       	mov    $0x20,%eax
+    1268:	cd 40                	int    $0x40
+    126a:	c3                   	ret
+
+0000126b <getfaultinfo>:
+SYSCALL(getfaultinfo)
+    126b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1270:	cd 40                	int    $0x40
+    1272:	c3                   	ret
+    1273:	66 90                	xchg   %ax,%ax
+    1275:	66 90                	xchg   %ax,%ax
+    1277:	66 90                	xchg   %ax,%ax
+    1279:	66 90                	xchg   %ax,%ax
+    127b:	66 90                	xchg   %ax,%ax
+    127d:	66 90                	xchg   %ax,%ax
+    127f:	90                   	nop
+
+00001280 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1280:	55                   	push   %ebp
+    1281:	89 e5                	mov    %esp,%ebp
+    1283:	57                   	push   %edi
+    1284:	56                   	push   %esi
+    1285:	53                   	push   %ebx
+    1286:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1288:	89 d1                	mov    %edx,%ecx
+{
+    128a:	83 ec 3c             	sub    $0x3c,%esp
+    128d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1290:	85 d2                	test   %edx,%edx
+    1292:	0f 89 80 00 00 00    	jns    1318 <printint+0x98>
+    1298:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    129c:	74 7a                	je     1318 <printint+0x98>
+    x = -xx;
+    129e:	f7 d9                	neg    %ecx
+    neg = 1;
+    12a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    12a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    12a8:	31 f6                	xor    %esi,%esi
+    12aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    12b0:	89 c8                	mov    %ecx,%eax
+    12b2:	31 d2                	xor    %edx,%edx
+    12b4:	89 f7                	mov    %esi,%edi
+    12b6:	f7 f3                	div    %ebx
+    12b8:	8d 76 01             	lea    0x1(%esi),%esi
+    12bb:	0f b6 92 90 18 00 00 	movzbl 0x1890(%edx),%edx
+    12c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    12c6:	89 ca                	mov    %ecx,%edx
+    12c8:	89 c1                	mov    %eax,%ecx
+    12ca:	39 da                	cmp    %ebx,%edx
+    12cc:	73 e2                	jae    12b0 <printint+0x30>
+  if(neg)
+    12ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    12d1:	85 c0                	test   %eax,%eax
+    12d3:	74 07                	je     12dc <printint+0x5c>
+    buf[i++] = '-';
+    12d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    12da:	89 f7                	mov    %esi,%edi
+    12dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    12df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    12e2:	01 df                	add    %ebx,%edi
+    12e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    12e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    12eb:	83 ec 04             	sub    $0x4,%esp
+    12ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+    12f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    12f4:	6a 01                	push   $0x1
+    12f6:	50                   	push   %eax
+    12f7:	56                   	push   %esi
+    12f8:	e8 96 fe ff ff       	call   1193 <write>
+  while(--i >= 0)
+    12fd:	89 f8                	mov    %edi,%eax
+    12ff:	83 c4 10             	add    $0x10,%esp
+    1302:	83 ef 01             	sub    $0x1,%edi
+    1305:	39 d8                	cmp    %ebx,%eax
+    1307:	75 df                	jne    12e8 <printint+0x68>
+}
+    1309:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    130c:	5b                   	pop    %ebx
+    130d:	5e                   	pop    %esi
+    130e:	5f                   	pop    %edi
+    130f:	5d                   	pop    %ebp
+    1310:	c3                   	ret
+    1311:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1318:	31 c0                	xor    %eax,%eax
+    131a:	eb 89                	jmp    12a5 <printint+0x25>
+    131c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001320 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    1320:	55                   	push   %ebp
+    1321:	89 e5                	mov    %esp,%ebp
+    1323:	57                   	push   %edi
+    1324:	56                   	push   %esi
+    1325:	53                   	push   %ebx
+    1326:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1329:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    132c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    132f:	0f b6 1e             	movzbl (%esi),%ebx
+    1332:	83 c6 01             	add    $0x1,%esi
+    1335:	84 db                	test   %bl,%bl
+    1337:	74 67                	je     13a0 <printf+0x80>
+    1339:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    133c:	31 d2                	xor    %edx,%edx
+    133e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1341:	eb 34                	jmp    1377 <printf+0x57>
+    1343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1347:	90                   	nop
+    1348:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    134b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1350:	83 f8 25             	cmp    $0x25,%eax
+    1353:	74 18                	je     136d <printf+0x4d>
+  write(fd, &c, 1);
+    1355:	83 ec 04             	sub    $0x4,%esp
+    1358:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    135b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    135e:	6a 01                	push   $0x1
+    1360:	50                   	push   %eax
+    1361:	57                   	push   %edi
+    1362:	e8 2c fe ff ff       	call   1193 <write>
+    1367:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    136a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    136d:	0f b6 1e             	movzbl (%esi),%ebx
+    1370:	83 c6 01             	add    $0x1,%esi
+    1373:	84 db                	test   %bl,%bl
+    1375:	74 29                	je     13a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1377:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    137a:	85 d2                	test   %edx,%edx
+    137c:	74 ca                	je     1348 <printf+0x28>
+      }
+    } else if(state == '%'){
+    137e:	83 fa 25             	cmp    $0x25,%edx
+    1381:	75 ea                	jne    136d <printf+0x4d>
+      if(c == 'd'){
+    1383:	83 f8 25             	cmp    $0x25,%eax
+    1386:	0f 84 24 01 00 00    	je     14b0 <printf+0x190>
+    138c:	83 e8 63             	sub    $0x63,%eax
+    138f:	83 f8 15             	cmp    $0x15,%eax
+    1392:	77 1c                	ja     13b0 <printf+0x90>
+    1394:	ff 24 85 38 18 00 00 	jmp    *0x1838(,%eax,4)
+    139b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    139f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    13a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13a3:	5b                   	pop    %ebx
+    13a4:	5e                   	pop    %esi
+    13a5:	5f                   	pop    %edi
+    13a6:	5d                   	pop    %ebp
+    13a7:	c3                   	ret
+    13a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13af:	90                   	nop
+  write(fd, &c, 1);
+    13b0:	83 ec 04             	sub    $0x4,%esp
+    13b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    13b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    13ba:	6a 01                	push   $0x1
+    13bc:	52                   	push   %edx
+    13bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    13c0:	57                   	push   %edi
+    13c1:	e8 cd fd ff ff       	call   1193 <write>
+    13c6:	83 c4 0c             	add    $0xc,%esp
+    13c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    13cc:	6a 01                	push   $0x1
+    13ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    13d1:	52                   	push   %edx
+    13d2:	57                   	push   %edi
+    13d3:	e8 bb fd ff ff       	call   1193 <write>
+        putc(fd, c);
+    13d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    13db:	31 d2                	xor    %edx,%edx
+    13dd:	eb 8e                	jmp    136d <printf+0x4d>
+    13df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    13e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    13e3:	83 ec 0c             	sub    $0xc,%esp
+    13e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    13eb:	8b 13                	mov    (%ebx),%edx
+    13ed:	6a 00                	push   $0x0
+    13ef:	89 f8                	mov    %edi,%eax
+        ap++;
+    13f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    13f4:	e8 87 fe ff ff       	call   1280 <printint>
+        ap++;
+    13f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    13fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    13ff:	31 d2                	xor    %edx,%edx
+    1401:	e9 67 ff ff ff       	jmp    136d <printf+0x4d>
+    1406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    140d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1410:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1413:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1415:	83 c0 04             	add    $0x4,%eax
+    1418:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    141b:	85 db                	test   %ebx,%ebx
+    141d:	0f 84 9d 00 00 00    	je     14c0 <printf+0x1a0>
+        while(*s != 0){
+    1423:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1426:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1428:	84 c0                	test   %al,%al
+    142a:	0f 84 3d ff ff ff    	je     136d <printf+0x4d>
+    1430:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1433:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1436:	89 de                	mov    %ebx,%esi
+    1438:	89 d3                	mov    %edx,%ebx
+    143a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1440:	83 ec 04             	sub    $0x4,%esp
+    1443:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1446:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1449:	6a 01                	push   $0x1
+    144b:	53                   	push   %ebx
+    144c:	57                   	push   %edi
+    144d:	e8 41 fd ff ff       	call   1193 <write>
+        while(*s != 0){
+    1452:	0f b6 06             	movzbl (%esi),%eax
+    1455:	83 c4 10             	add    $0x10,%esp
+    1458:	84 c0                	test   %al,%al
+    145a:	75 e4                	jne    1440 <printf+0x120>
+      state = 0;
+    145c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    145f:	31 d2                	xor    %edx,%edx
+    1461:	e9 07 ff ff ff       	jmp    136d <printf+0x4d>
+    1466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    146d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1470:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1473:	83 ec 0c             	sub    $0xc,%esp
+    1476:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    147b:	8b 13                	mov    (%ebx),%edx
+    147d:	6a 01                	push   $0x1
+    147f:	e9 6b ff ff ff       	jmp    13ef <printf+0xcf>
+    1484:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1488:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    148b:	83 ec 04             	sub    $0x4,%esp
+    148e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1491:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1493:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1496:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1499:	6a 01                	push   $0x1
+    149b:	52                   	push   %edx
+    149c:	57                   	push   %edi
+    149d:	e8 f1 fc ff ff       	call   1193 <write>
+        ap++;
+    14a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    14a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    14a8:	31 d2                	xor    %edx,%edx
+    14aa:	e9 be fe ff ff       	jmp    136d <printf+0x4d>
+    14af:	90                   	nop
+  write(fd, &c, 1);
+    14b0:	83 ec 04             	sub    $0x4,%esp
+    14b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    14b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    14b9:	6a 01                	push   $0x1
+    14bb:	e9 11 ff ff ff       	jmp    13d1 <printf+0xb1>
+    14c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    14c5:	bb 2e 18 00 00       	mov    $0x182e,%ebx
+    14ca:	e9 61 ff ff ff       	jmp    1430 <printf+0x110>
+    14cf:	90                   	nop
+
+000014d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    14d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14d1:	a1 e0 3e 00 00       	mov    0x3ee0,%eax
+{
+    14d6:	89 e5                	mov    %esp,%ebp
+    14d8:	57                   	push   %edi
+    14d9:	56                   	push   %esi
+    14da:	53                   	push   %ebx
+    14db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    14de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    14ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14ec:	39 ca                	cmp    %ecx,%edx
+    14ee:	73 30                	jae    1520 <free+0x50>
+    14f0:	39 c1                	cmp    %eax,%ecx
+    14f2:	72 04                	jb     14f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    14f4:	39 c2                	cmp    %eax,%edx
+    14f6:	72 f0                	jb     14e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    14f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    14fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    14fe:	39 f8                	cmp    %edi,%eax
+    1500:	74 2e                	je     1530 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1502:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1505:	8b 42 04             	mov    0x4(%edx),%eax
+    1508:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    150b:	39 f1                	cmp    %esi,%ecx
+    150d:	74 38                	je     1547 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    150f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1511:	5b                   	pop    %ebx
+  freep = p;
+    1512:	89 15 e0 3e 00 00    	mov    %edx,0x3ee0
+}
+    1518:	5e                   	pop    %esi
+    1519:	5f                   	pop    %edi
+    151a:	5d                   	pop    %ebp
+    151b:	c3                   	ret
+    151c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1520:	39 c1                	cmp    %eax,%ecx
+    1522:	72 d0                	jb     14f4 <free+0x24>
+    1524:	eb c2                	jmp    14e8 <free+0x18>
+    1526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    152d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1530:	03 70 04             	add    0x4(%eax),%esi
+    1533:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1536:	8b 02                	mov    (%edx),%eax
+    1538:	8b 00                	mov    (%eax),%eax
+    153a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    153d:	8b 42 04             	mov    0x4(%edx),%eax
+    1540:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1543:	39 f1                	cmp    %esi,%ecx
+    1545:	75 c8                	jne    150f <free+0x3f>
+    p->s.size += bp->s.size;
+    1547:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    154a:	89 15 e0 3e 00 00    	mov    %edx,0x3ee0
+    p->s.size += bp->s.size;
+    1550:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1553:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1556:	89 0a                	mov    %ecx,(%edx)
+}
+    1558:	5b                   	pop    %ebx
+    1559:	5e                   	pop    %esi
+    155a:	5f                   	pop    %edi
+    155b:	5d                   	pop    %ebp
+    155c:	c3                   	ret
+    155d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001560 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1560:	55                   	push   %ebp
+    1561:	89 e5                	mov    %esp,%ebp
+    1563:	57                   	push   %edi
+    1564:	56                   	push   %esi
+    1565:	53                   	push   %ebx
+    1566:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1569:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    156c:	8b 15 e0 3e 00 00    	mov    0x3ee0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1572:	8d 78 07             	lea    0x7(%eax),%edi
+    1575:	c1 ef 03             	shr    $0x3,%edi
+    1578:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    157b:	85 d2                	test   %edx,%edx
+    157d:	0f 84 8d 00 00 00    	je     1610 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1583:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1585:	8b 48 04             	mov    0x4(%eax),%ecx
+    1588:	39 f9                	cmp    %edi,%ecx
+    158a:	73 64                	jae    15f0 <malloc+0x90>
+  if(nu < 4096)
+    158c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1591:	39 df                	cmp    %ebx,%edi
+    1593:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1596:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    159d:	eb 0a                	jmp    15a9 <malloc+0x49>
+    159f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    15a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    15a2:	8b 48 04             	mov    0x4(%eax),%ecx
+    15a5:	39 f9                	cmp    %edi,%ecx
+    15a7:	73 47                	jae    15f0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    15a9:	89 c2                	mov    %eax,%edx
+    15ab:	39 05 e0 3e 00 00    	cmp    %eax,0x3ee0
+    15b1:	75 ed                	jne    15a0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    15b3:	83 ec 0c             	sub    $0xc,%esp
+    15b6:	56                   	push   %esi
+    15b7:	e8 3f fc ff ff       	call   11fb <sbrk>
+  if(p == (char*)-1)
+    15bc:	83 c4 10             	add    $0x10,%esp
+    15bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    15c2:	74 1c                	je     15e0 <malloc+0x80>
+  hp->s.size = nu;
+    15c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    15c7:	83 ec 0c             	sub    $0xc,%esp
+    15ca:	83 c0 08             	add    $0x8,%eax
+    15cd:	50                   	push   %eax
+    15ce:	e8 fd fe ff ff       	call   14d0 <free>
+  return freep;
+    15d3:	8b 15 e0 3e 00 00    	mov    0x3ee0,%edx
+      if((p = morecore(nunits)) == 0)
+    15d9:	83 c4 10             	add    $0x10,%esp
+    15dc:	85 d2                	test   %edx,%edx
+    15de:	75 c0                	jne    15a0 <malloc+0x40>
+        return 0;
+  }
+}
+    15e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    15e3:	31 c0                	xor    %eax,%eax
+}
+    15e5:	5b                   	pop    %ebx
+    15e6:	5e                   	pop    %esi
+    15e7:	5f                   	pop    %edi
+    15e8:	5d                   	pop    %ebp
+    15e9:	c3                   	ret
+    15ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    15f0:	39 cf                	cmp    %ecx,%edi
+    15f2:	74 4c                	je     1640 <malloc+0xe0>
+        p->s.size -= nunits;
+    15f4:	29 f9                	sub    %edi,%ecx
+    15f6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    15f9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    15fc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    15ff:	89 15 e0 3e 00 00    	mov    %edx,0x3ee0
+}
+    1605:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1608:	83 c0 08             	add    $0x8,%eax
+}
+    160b:	5b                   	pop    %ebx
+    160c:	5e                   	pop    %esi
+    160d:	5f                   	pop    %edi
+    160e:	5d                   	pop    %ebp
+    160f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1610:	c7 05 e0 3e 00 00 e4 	movl   $0x3ee4,0x3ee0
+    1617:	3e 00 00 
+    base.s.size = 0;
+    161a:	b8 e4 3e 00 00       	mov    $0x3ee4,%eax
+    base.s.ptr = freep = prevp = &base;
+    161f:	c7 05 e4 3e 00 00 e4 	movl   $0x3ee4,0x3ee4
+    1626:	3e 00 00 
+    base.s.size = 0;
+    1629:	c7 05 e8 3e 00 00 00 	movl   $0x0,0x3ee8
+    1630:	00 00 00 
+    if(p->s.size >= nunits){
+    1633:	e9 54 ff ff ff       	jmp    158c <malloc+0x2c>
+    1638:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    163f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1640:	8b 08                	mov    (%eax),%ecx
+    1642:	89 0a                	mov    %ecx,(%edx)
+    1644:	eb b9                	jmp    15ff <malloc+0x9f>
@@ -0,0 +1,146 @@
+// File system throughput benchmark.
+// Creates, reads back and removes many small files, then writes
+// and reads back one large file, and reports the ticks each phase
+// took, then how the block allocator did.  bsizebench.sh runs it
+// under kernels built with different block sizes.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+#include "arith64.c"
+
+#define NSMALL   100           // small files
+#define SMALLSZ  1024          // bytes per small file
+#define LARGESZ  (4*1024*1024) // bytes in the large file
+#define IOSZ     8192          // bytes per read() or write()
+
+char buf[IOSZ];
+
+void
+rate(char *what, uint n, uint elapsed, char *unit)
+{
+  printf(1, "fsbench: %s %d ticks", what, elapsed);
+  if(elapsed > 0)
+    printf(1, " (%d %s/100 ticks)", n * 100 / elapsed, unit);
+  printf(1, "\n");
+}
+
+void
+smallfiles(void)
+{
+  char name[8];
+  int i, fd;
+  uint start;
+
+  name[0] = 's';
+  name[4] = 0;
+  memset(buf, 's', SMALLSZ);
+
+  start = uptime();
+  for(i = 0; i < NSMALL; i++){
+    name[1] = '0' + i / 100;
+    name[2] = '0' + (i / 10) % 10;
+    name[3] = '0' + i % 10;
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+      printf(1, "fsbench: cannot create %s\n", name);
+      exit();
+    }
+    if(write(fd, buf, SMALLSZ) != SMALLSZ){
+      printf(1, "fsbench: write %s failed\n", name);
+      exit();
+    }
+    close(fd);
+  }
+  rate("small create", NSMALL, uptime() - start, "files");
+
+  start = uptime();
+  for(i = 0; i < NSMALL; i++){
+    name[1] = '0' + i / 100;
+    name[2] = '0' + (i / 10) % 10;
+    name[3] = '0' + i % 10;
+    if((fd = open(name, O_RDONLY)) < 0 || read(fd, buf, IOSZ) != SMALLSZ){
+      printf(1, "fsbench: read %s failed\n", name);
+      exit();
+    }
+    close(fd);
+  }
+  rate("small read", NSMALL, uptime() - start, "files");
+
+  start = uptime();
+  for(i = 0; i < NSMALL; i++){
+    name[1] = '0' + i / 100;
+    name[2] = '0' + (i / 10) % 10;
+    name[3] = '0' + i % 10;
+    if(unlink(name) < 0){
+      printf(1, "fsbench: unlink %s failed\n", name);
+      exit();
+    }
+  }
+  rate("small unlink", NSMALL, uptime() - start, "files");
+}
+
+void
+largefile(void)
+{
+  int fd, n, tot;
+  uint start;
+  char *path = "fsbench.large";
+
+  memset(buf, 'l', sizeof(buf));
+  if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+    printf(1, "fsbench: cannot create %s\n", path);
+    exit();
+  }
+  start = uptime();
+  for(tot = 0; tot < LARGESZ; tot += n)
+    if((n = write(fd, buf, sizeof(buf))) != sizeof(buf)){
+      printf(1, "fsbench: write %s failed\n", path);
+      exit();
+    }
+  close(fd);
+  rate("large write", LARGESZ / 1024, uptime() - start, "KB");
+
+  if((fd = open(path, O_RDONLY)) < 0){
+    printf(1, "fsbench: cannot open %s\n", path);
+    exit();
+  }
+  start = uptime();
+  for(tot = 0; (n = read(fd, buf, sizeof(buf))) > 0; tot += n)
+    ;
+  close(fd);
+  if(tot != LARGESZ){
+    printf(1, "fsbench: read %d bytes of %s\n", tot, path);
+    exit();
+  }
+  rate("large read", LARGESZ / 1024, uptime() - start, "KB");
+  unlink(path);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct balloc_info before, after;
+  uint allocs, wanted;
+
+  printf(1, "fsbench: BSIZE %d, %d files of %d bytes, %d KB file\n",
+         BSIZE, NSMALL, SMALLSZ, LARGESZ / 1024);
+  getballocinfo(&before);
+  smallfiles();
+  largefile();
+  getballocinfo(&after);
+
+  allocs = after.allocs - before.allocs;
+  wanted = after.wanted - before.wanted;
+  if(allocs > 0)
+    printf(1, "fsbench: balloc %d calls, %d cycles/call\n", allocs,
+           (uint)((after.cycles - before.cycles) / allocs));
+  if(wanted > 0)
+    printf(1, "fsbench: %d%% of %d goals met\n",
+           (after.contig - before.contig) * 100 / wanted, wanted);
+  printf(1, "fsbench: %d of %d blocks free in %d runs, longest %d\n",
+         after.nfree, after.nblocks, after.nextent, after.maxextent);
+  printf(1, "fsbench done\n");
+  exit();
+}
@@ -0,0 +1,407 @@
+// Check an xv6 file system image for consistency.
+//
+// First replays the log the way the kernel's recover_from_log()
+// would, in memory (the image itself is not changed), then checks:
+//  - each inode in use has a known type and a block list that
+//    stays inside the data area,
+//  - no block is used twice,
+//  - every block in use is marked in the bitmap,
+//  - each directory starts with "." and "..", and its entries
+//    name inodes that are in use,
+//  - each entry of an indexed directory is in its name's bucket,
+//  - each inode's nlink equals the number of entries naming it
+//    (not counting ".").
+// Blocks marked in the bitmap that nothing uses, and inodes in
+// use that nothing names, are reported as leaks but are not
+// errors: a crash leaks the inode and blocks of a file that was
+// unlinked while still open.
+//
+// Exits 1 if it finds errors, 0 otherwise.
+
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <stdarg.h>
+
+#define stat xv6_stat  // avoid clash with host struct stat
+#include "types.h"
+#include "fs.h"
+#include "stat.h"
+#include "param.h"
+
+struct superblock sb;
+uchar *img;        // the whole image, with the log replayed
+uint datastart;    // first data block
+ushort *owner;     // owner[b]: inode using block b, or 0
+uint *nref;        // nref[i]: directory entries naming inode i
+int errors, leaks;
+
+// convert from intel byte order
+ushort
+xshort(ushort x)
+{
+  uchar *a = (uchar*)&x;
+  return a[0] | (a[1] << 8);
+}
+
+uint
+xint(uint x)
+{
+  uchar *a = (uchar*)&x;
+  return a[0] | (a[1] << 8) | (a[2] << 16) | (a[3] << 24);
+}
+
+void
+error(char *fmt, ...)
+{
+  va_list ap;
+
+  va_start(ap, fmt);
+  printf("fsck: ");
+  vprintf(fmt, ap);
+  printf("\n");
+  va_end(ap);
+  errors++;
+}
+
+void
+leak(char *fmt, ...)
+{
+  va_list ap;
+
+  va_start(ap, fmt);
+  printf("fsck: leak: ");
+  vprintf(fmt, ap);
+  printf("\n");
+  va_end(ap);
+  leaks++;
+}
+
+uchar*
+block(uint b)
+{
+  return img + b*BSIZE;
+}
+
+struct dinode*
+inode(uint inum)
+{
+  return (struct dinode*)block(IBLOCK(inum, sb)) + inum%IPB;
+}
+
+void
+readimg(char *path)
+{
+  int fd;
+  uint size;
+  struct superblock *sp;
+  uchar buf[BSIZE];
+
+  if((fd = open(path, O_RDONLY)) < 0){
+    perror(path);
+    exit(1);
+  }
+  if(pread(fd, buf, BSIZE, BSIZE) != BSIZE){
+    fprintf(stderr, "fsck: %s: cannot read superblock\n", path);
+    exit(1);
+  }
+  sp = (struct superblock*)buf;
+  sb.size = xint(sp->size);
+  sb.nblocks = xint(sp->nblocks);
+  sb.ninodes = xint(sp->ninodes);
+  sb.nlog = xint(sp->nlog);
+  sb.logstart = xint(sp->logstart);
+  sb.inodestart = xint(sp->inodestart);
+  sb.bmapstart = xint(sp->bmapstart);
+  sb.bsize = xint(sp->bsize);
+  if(sb.bsize != BSIZE){
+    fprintf(stderr, "fsck: %s: block size %u, fsck built for %d\n",
+            path, sb.bsize, BSIZE);
+    exit(1);
+  }
+  datastart = sb.bmapstart + sb.size/BPB + 1;
+  if(sb.logstart != 2 || sb.inodestart != sb.logstart + sb.nlog ||
+     sb.bmapstart <= sb.inodestart || datastart + sb.nblocks != sb.size){
+    fprintf(stderr, "fsck: %s: bad superblock\n", path);
+    exit(1);
+  }
+
+  size = sb.size*BSIZE;
+  img = malloc(size);
+  owner = calloc(sb.size, sizeof owner[0]);
+  nref = calloc(sb.ninodes, sizeof nref[0]);
+  if(img == 0 || owner == 0 || nref == 0){
+    fprintf(stderr, "fsck: out of memory\n");
+    exit(1);
+  }
+  if(pread(fd, img, size, 0) != size){
+    fprintf(stderr, "fsck: %s: short image\n", path);
+    exit(1);
+  }
+  close(fd);
+}
+
+// Copy each block named in the log header from its slot to its
+// home location.  A block # of 0 marks a free slot.
+void
+replaylog(void)
+{
+  uint *lh, n, i, b, ninstalled;
+
+  lh = (uint*)block(sb.logstart);
+  n = xint(lh[0]);
+  if(n > sb.nlog - 1){
+    error("log header has %u slots, log holds %u", n, sb.nlog - 1);
+    return;
+  }
+  ninstalled = 0;
+  for(i = 0; i < n; i++){
+    b = xint(lh[1+i]);
+    if(b == 0)
+      continue;
+    if(b >= sb.size){
+      error("log slot %u names block %u", i, b);
+      continue;
+    }
+    memmove(block(b), block(sb.logstart+1+i), BSIZE);
+    ninstalled++;
+  }
+  if(ninstalled)
+    printf("fsck: replayed %u logged blocks\n", ninstalled);
+}
+
+// Record that inode inum uses block b.
+int
+useblock(uint inum, uint b)
+{
+  if(b < datastart || b >= sb.size){
+    error("inode %u uses block %u outside the data area", inum, b);
+    return 0;
+  }
+  if(owner[b]){
+    error("block %u used by inodes %u and %u", b, owner[b], inum);
+    return 0;
+  }
+  owner[b] = inum;
+  return 1;
+}
+
+// Return entry i of indirect block a, or 0 if a is not a
+// data block.
+uint
+indirect(uint a, uint i)
+{
+  if(a < datastart || a >= sb.size)
+    return 0;
+  return xint(((uint*)block(a))[i]);
+}
+
+// Return the address of the file block bn of inode inum, or 0.
+uint
+bmap(uint inum, uint bn)
+{
+  struct dinode *dip = inode(inum);
+
+  if(bn < NDIRECT)
+    return xint(dip->addrs[bn]);
+  bn -= NDIRECT;
+  if(bn < NINDIRECT)
+    return indirect(xint(dip->addrs[NDIRECT]), bn);
+  bn -= NINDIRECT;
+  if(bn < NINDIRECT*NINDIRECT)
+    return indirect(indirect(xint(dip->addrs[NDIRECT+1]), bn / NINDIRECT),
+                    bn % NINDIRECT);
+  return 0;
+}
+
+// Record the blocks listed in indirect block a of inode inum,
+// the first of which is file block bn.  nb is the number of
+// blocks the inode's size covers.
+void
+checkleaf(uint inum, uint a, uint bn, uint nb)
+{
+  uint i, b;
+
+  if(!useblock(inum, a))
+    return;
+  for(i = 0; i < NINDIRECT; i++){
+    if((b = indirect(a, i)) == 0)
+      continue;
+    if(useblock(inum, b) && bn + i >= nb)
+      leak("inode %u has block %u past its end", inum, b);
+  }
+}
+
+void
+checkinode(uint inum)
+{
+  struct dinode *dip = inode(inum);
+  uint i, b, size, nb;
+
+  size = xint(dip->size);
+  nb = size/BSIZE + (size%BSIZE != 0);
+  if(nb > MAXFILE){
+    error("inode %u has size %u", inum, size);
+    nb = MAXFILE;
+  }
+  for(i = 0; i < NDIRECT; i++){
+    if((b = xint(dip->addrs[i])) == 0)
+      continue;
+    if(useblock(inum, b) && i >= nb)
+      leak("inode %u has block %u past its end", inum, b);
+  }
+  if((b = xint(dip->addrs[NDIRECT])) != 0)
+    checkleaf(inum, b, NDIRECT, nb);
+  if((b = xint(dip->addrs[NDIRECT+1])) == 0 || !useblock(inum, b))
+    return;
+  for(i = 0; i < NINDIRECT; i++)
+    if(indirect(b, i) != 0)
+      checkleaf(inum, indirect(b, i), NDIRECT + NINDIRECT*(i+1), nb);
+}
+
+// Check that each entry of indexed directory inum is in the
+// bucket its name hashes to, and that each block is in at most
+// one bucket chain.
+void
+checkindex(uint inum)
+{
+  struct dinode *dip = inode(inum);
+  struct dirent *de;
+  uint nb, nblk, s, blk, b, i, n;
+  uchar *seen;
+
+  nb = xshort(dip->minor);
+  nblk = xint(dip->size) / BSIZE;
+  if(nb == 0 || nb > DIRNTAB || nb >= nblk){
+    error("indexed directory %u has %u buckets in %u blocks", inum, nb, nblk);
+    return;
+  }
+  if((seen = calloc(nblk, 1)) == 0){
+    fprintf(stderr, "fsck: out of memory\n");
+    exit(1);
+  }
+  for(s = 0; s < nb; s++){
+    if((b = bmap(inum, 0)) == 0 || b >= sb.size)
+      break;
+    de = (struct dirent*)block(b);
+    blk = xshort(((ushort*)de[2 + s/DIRTPE].name)[s%DIRTPE]);
+    for(n = 0; blk != 0; n++){
+      if(blk >= nblk || seen[blk]){
+        error("directory %u bucket %u has bad block %u", inum, s, blk);
+        break;
+      }
+      seen[blk] = 1;
+      if((b = bmap(inum, blk)) == 0 || b >= sb.size)
+        break;
+      de = (struct dirent*)block(b);
+      for(i = 0; i < DPB - 1; i++)
+        if(de[i].inum != 0 && dirbucket(dirhash(de[i].name), nb) != s)
+          error("directory %u has %.*s in bucket %u", inum,
+                DIRSIZ, de[i].name, s);
+      blk = xshort(((ushort*)de[DPB-1].name)[0]);
+    }
+  }
+  free(seen);
+}
+
+void
+checkdir(uint inum)
+{
+  struct dinode *dip = inode(inum), *ep;
+  struct dirent *de;
+  uint off, size, b, e;
+
+  size = xint(dip->size);
+  for(off = 0; off + sizeof(*de) <= size && off/BSIZE < MAXFILE;
+      off += sizeof(*de)){
+    if((b = bmap(inum, off/BSIZE)) == 0 || b >= sb.size)
+      continue;
+    de = (struct dirent*)(block(b) + off%BSIZE);
+    e = xshort(de->inum);
+    if(off == 0 && (e != inum || strncmp(de->name, ".", DIRSIZ) != 0))
+      error("directory %u does not start with .", inum);
+    if(off == sizeof(*de) && strncmp(de->name, "..", DIRSIZ) != 0)
+      error("directory %u has no ..", inum);
+    if(e == 0)
+      continue;
+    if(e >= sb.ninodes){
+      error("directory %u names inode %u, out of range", inum, e);
+      continue;
+    }
+    ep = inode(e);
+    if(xshort(ep->type) == 0){
+      error("directory %u names free inode %u", inum, e);
+      continue;
+    }
+    if(strncmp(de->name, ".", DIRSIZ) != 0)
+      nref[e]++;
+  }
+  if(xshort(dip->major) == DIRINDEX)
+    checkindex(inum);
+}
+
+void
+checkbitmap(void)
+{
+  uint b, used;
+
+  for(b = 0; b < sb.size; b++){
+    used = block(BBLOCK(b, sb))[(b%BPB)/8] & (1 << (b%8));
+    if(b < datastart){
+      if(!used)
+        error("metadata block %u is free in the bitmap", b);
+    } else if(owner[b] && !used)
+      error("block %u used by inode %u is free in the bitmap", b, owner[b]);
+    else if(!owner[b] && used)
+      leak("block %u is allocated but unused", b);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  uint inum, type, nlink, ninodes;
+
+  if(argc != 2){
+    fprintf(stderr, "Usage: fsck fs.img\n");
+    exit(1);
+  }
+  readimg(argv[1]);
+  replaylog();
+
+  ninodes = 0;
+  for(inum = 1; inum < sb.ninodes; inum++){
+    type = xshort(inode(inum)->type);
+    if(type == 0)
+      continue;
+    if(type != T_DIR && type != T_FILE && type != T_DEV){
+      error("inode %u has type %u", inum, type);
+      continue;
+    }
+    checkinode(inum);
+    ninodes++;
+  }
+  if(xshort(inode(ROOTINO)->type) != T_DIR)
+    error("root inode %u is not a directory", ROOTINO);
+
+  for(inum = 1; inum < sb.ninodes; inum++)
+    if(xshort(inode(inum)->type) == T_DIR)
+      checkdir(inum);
+
+  for(inum = 1; inum < sb.ninodes; inum++){
+    if(xshort(inode(inum)->type) == 0)
+      continue;
+    nlink = xshort(inode(inum)->nlink);
+    if(nlink == 0 && nref[inum] == 0)
+      leak("inode %u is in use but has no links", inum);
+    else if(nlink != nref[inum])
+      error("inode %u has nlink %u but %u names", inum, nlink, nref[inum]);
+  }
+  checkbitmap();
+
+  printf("fsck: %s: %u inodes, %d errors, %d leaks\n",
+         argv[1], ninodes, errors, leaks);
+  exit(errors ? 1 : 0);
+}
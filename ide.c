@@ -5,10 +5,10 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
-#include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
@@ -23,18 +23,34 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+
+#define SECTOR_PER_BLOCK (BSIZE/SECTOR_SIZE)
+#define MAXMULT       16  // sectors per READ/WRITE MULTIPLE block (qemu's limit)
+#define MAXRUN        (MAXMULT/SECTOR_PER_BLOCK)  // bufs per command
+#define MAXSECTOR     (1<<28)  // 28-bit LBA; the disk size is in the super block
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
-// You must hold idelock while manipulating queue.
+// idequeue points to the buf now being read/written to the disk,
+// followed through qnext by any bufs for the blocks right after
+// it that were merged into the same command (see idemerge).
+// Other requests wait on the pending list, which idesubmit()
+// appends to in O(1) through idetail.  When the disk finishes,
+// ideintr() starts the pending request with the next higher
+// block number, or wraps around to the lowest one (a one-way
+// elevator), so a busy disk sweeps across the platter instead
+// of seeking back and forth in arrival order.
+// You must hold idelock while manipulating either.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static struct buf *idepending;
+static struct buf **idetail = &idepending;
 
 static int havedisk1;
 static void idestart(struct buf*);
 
 // Wait for IDE disk to become ready.
+// Only used at boot; afterwards the disk interrupts when it is.
 static int
 idewait(int checkerr)
 {
@@ -66,37 +82,103 @@ ideinit(void)
     }
   }
 
-  // Switch back to disk 0.
-  outb(0x1f6, 0xe0 | (0<<4));
+  // Let each disk move MAXMULT sectors per interrupt, so that
+  // a merged run of blocks completes in a single ideintr().
+  for(i = havedisk1; i >= 0; i--){
+    outb(0x1f6, 0xe0 | (i<<4));
+    outb(0x1f2, MAXMULT);
+    outb(0x1f7, IDE_CMD_SETMUL);
+    idewait(0);
+  }
+  // Leaves disk 0 selected.
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Start the request for b and the bufs chained after it, which
+// are for consecutive blocks.  Caller must hold idelock.
 static void
 idestart(struct buf *b)
 {
+  struct buf *x;
+  int n;
+
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
-    panic("incorrect blockno");
-  int sector_per_block =  BSIZE/SECTOR_SIZE;
-  int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  for(n = 0, x = b; x; x = x->qnext, n++)
+    if(x->blockno >= MAXSECTOR/SECTOR_PER_BLOCK)
+      panic("incorrect blockno");
+  int sector = b->blockno * SECTOR_PER_BLOCK;
 
-  if (sector_per_block > 7) panic("idestart");
+  if (SECTOR_PER_BLOCK > MAXMULT || n > MAXRUN) panic("idestart");
 
-  idewait(0);
+  // No need to poll: requests are started only when the
+  // disk is idle, at boot or from its completion interrupt.
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, n * SECTOR_PER_BLOCK);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
   if(b->flags & B_DIRTY){
-    outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    outb(0x1f7, IDE_CMD_WRMUL);
+    for(x = b; x; x = x->qnext)
+      outsl(0x1f0, x->data, BSIZE/4);
   } else {
-    outb(0x1f7, read_cmd);
+    outb(0x1f7, IDE_CMD_RDMUL);
+  }
+}
+
+// Remove and return the pending request to run after one
+// for blockno: the lowest block above it, else the lowest.
+// Caller must hold idelock.
+static struct buf*
+idenext(uint blockno)
+{
+  struct buf **pp, **up, **lo, *b;
+
+  up = lo = 0;
+  for(pp = &idepending; *pp; pp = &(*pp)->qnext){
+    b = *pp;
+    if(b->blockno > blockno && (up == 0 || b->blockno < (*up)->blockno))
+      up = pp;
+    if(lo == 0 || b->blockno < (*lo)->blockno)
+      lo = pp;
+  }
+  if(up == 0)
+    up = lo;
+  if(up == 0)
+    return 0;
+  b = *up;
+  *up = b->qnext;
+  if(idetail == &b->qnext)
+    idetail = up;
+  b->qnext = 0;
+  return b;
+}
+
+// Chain onto b any pending requests in the same direction for
+// the blocks that follow it, up to MAXRUN bufs in all, so that
+// idestart() moves them with one command.
+// Caller must hold idelock.
+static void
+idemerge(struct buf *b)
+{
+  struct buf **pp, *last, *x;
+  int n;
+
+  last = b;
+  for(n = 1; n < MAXRUN; n++){
+    for(pp = &idepending; (x = *pp) != 0; pp = &x->qnext)
+      if(x->dev == b->dev && x->blockno == last->blockno + 1 &&
+         (x->flags & B_DIRTY) == (b->flags & B_DIRTY))
+        break;
+    if(x == 0)
+      break;
+    *pp = x->qnext;
+    if(idetail == &x->qnext)
+      idetail = pp;
+    x->qnext = 0;
+    last->qnext = x;
+    last = x;
   }
 }
 
@@ -104,42 +186,64 @@ idestart(struct buf *b)
 void
 ideintr(void)
 {
-  struct buf *b;
+  struct buf *b, *next, *async[MAXRUN];
+  uint blockno;
+  int r, ok, i, n;
 
-  // First queued buffer is the active request.
   acquire(&idelock);
   if((b = idequeue) == 0){
     release(&idelock);
     // cprintf("spurious IDE interrupt\n");
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  // The disk has finished the whole run, so one look at the
+  // status register says whether it worked.
+  r = inb(0x1f7);
+  ok = (r & (IDE_BSY|IDE_DF|IDE_ERR)) == 0;
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  n = 0;
+  for(; b; b = next){
+    // Read data if needed.
+    if(!(b->flags & B_DIRTY) && ok)
+      insl(0x1f0, b->data, BSIZE/4);
+
+    // Wake process waiting for this buf.  Once it is
+    // awake it owns b again, so don't look at it after.
+    next = b->qnext;
+    blockno = b->blockno;
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    if(b->iodone)
+      async[n++] = b;
+    else
+      wakeup(b);
+  }
 
-  // Start disk on next buf in queue.
-  if(idequeue != 0)
+  // Start disk on next run in elevator order.
+  if((idequeue = idenext(blockno)) != 0){
+    idemerge(idequeue);
     idestart(idequeue);
+  }
 
   release(&idelock);
+
+  // Asynchronous requests finish outside idelock, since
+  // the callback takes buffer cache locks.
+  for(i = 0; i < n; i++)
+    async[i]->iodone(async[i]);
 }
 
 //PAGEBREAK!
-// Sync buf with disk.
+// Queue a request to sync buf with disk and return at once.
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
+// When the disk is done, ideintr() wakes anyone in idewaitbuf(b)
+// and then calls b->iodone(b) if it is set.  b must stay locked
+// until then.
 void
-iderw(struct buf *b)
+idesubmit(struct buf *b)
 {
-  struct buf **pp;
-
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
@@ -149,20 +253,34 @@ iderw(struct buf *b)
 
   acquire(&idelock);  //DOC:acquire-lock
 
-  // Append b to idequeue.
+  // Start disk if it is idle, else append b to the pending list.
   b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
-  *pp = b;
-
-  // Start disk if necessary.
-  if(idequeue == b)
+  if(idequeue == 0){
+    idequeue = b;
     idestart(b);
+  } else {
+    *idetail = b;  //DOC:insert-queue
+    idetail = &b->qnext;
+  }
+
+  release(&idelock);
+}
 
-  // Wait for request to finish.
+// Wait for the request for b made by idesubmit() to finish.
+void
+idewaitbuf(struct buf *b)
+{
+  acquire(&idelock);
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
     sleep(b, &idelock);
   }
-
   release(&idelock);
 }
+
+// Sync buf with disk and wait for it.
+void
+iderw(struct buf *b)
+{
+  idesubmit(b);
+  idewaitbuf(b);
+}
@@ -8,6 +8,12 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "proc.h"
+#include "x86.h"
+
+#define KBATCH 32  // pages moved between a CPU's cache and kmem at once
+#define KLOW   128  // reclaim buffer cache pages below this many free
+#define KZPOOL 256  // most free pages kept zeroed ahead of time
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
@@ -20,9 +26,21 @@ struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
-  uint refcount[PHYSTOP>>PGSHIFT];
+  int nfree;                        // pages on freelist
+  uint refcount[PHYSTOP>>PGSHIFT];  // updated atomically, not under lock
 } kmem;
 
+// Pages cleared by idle CPUs, see kzerofill(), for
+// kalloc_zeroed() to hand out without a memset.  Each page is
+// all zeros except for its run link.
+struct {
+  struct spinlock lock;
+  struct run *list;
+  int n;
+  uint hits;                        // kalloc_zeroed() calls served from list
+  uint misses;                      // ... that had to clear a page
+} kzero;
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
@@ -31,7 +49,12 @@ struct {
 void
 kinit1(void *vstart, void *vend)
 {
+  struct cpu *c;
+
   initlock(&kmem.lock, "kmem");
+  for(c = cpus; c < cpus+NCPU; c++)
+    initlock(&c->flock, "kcache");
+  initlock(&kzero.lock, "kzero");
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -52,6 +75,111 @@ freerange(void *vstart, void *vend)
     kfree(p);
 }
 
+// Once kinit2() has run, each CPU keeps a small cache of free
+// pages in its struct cpu.  kalloc() and kfree() work on that
+// cache under its flock, which other CPUs take only when
+// kmem.freelist has run dry (see steal()), and only take
+// kmem.lock to move KBATCH pages at a time to or from the
+// global free list.  Lock order: a cache's flock, then
+// kmem.lock; no one holds two caches' locks at once.
+
+// Move up to n pages from kmem.freelist to c's cache.
+// Caller must hold c->flock.
+static void
+refill(struct cpu *c, int n)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  while(n-- > 0 && (r = kmem.freelist) != 0){
+    kmem.freelist = r->next;
+    kmem.nfree--;
+    r->next = c->freelist;
+    c->freelist = r;
+    c->nfree++;
+  }
+  release(&kmem.lock);
+}
+
+// Move up to n pages from c's cache to kmem.freelist.
+// Caller must hold c->flock.
+static void
+drain(struct cpu *c, int n)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  while(n-- > 0 && (r = c->freelist) != 0){
+    c->freelist = r->next;
+    c->nfree--;
+    r->next = kmem.freelist;
+    kmem.freelist = r;
+    kmem.nfree++;
+  }
+  release(&kmem.lock);
+}
+
+// Take half of each other CPU's cache back to kmem.freelist,
+// for a kalloc() that found the global list empty, so pages
+// parked on idle CPUs do not make it fail.  Returns the number
+// of pages moved.  Caller must hold no cache lock.
+static int
+steal(struct cpu *self)
+{
+  struct cpu *c;
+  int n, moved;
+
+  moved = 0;
+  for(c = cpus; c < cpus+ncpu; c++){
+    if(c == self)
+      continue;
+    acquire(&c->flock);
+    n = (c->nfree + 1) / 2;
+    moved += n;
+    drain(c, n);
+    release(&c->flock);
+  }
+  return moved;
+}
+
+// Pop a page off c's cache, refilling it from kmem.freelist if
+// it is empty.  Returns 0 if both are empty.
+static struct run*
+cachealloc(struct cpu *c)
+{
+  struct run *r;
+
+  acquire(&c->flock);
+  if(c->freelist == 0)
+    refill(c, KBATCH);
+  r = c->freelist;
+  if(r){
+    c->freelist = r->next;
+    c->nfree--;
+  }
+  release(&c->flock);
+  return r;
+}
+
+// Drop one reference to the page at pa.
+// Returns 1 if that was the last one and the page is now free.
+// Pages put on the free list by kinit have no references yet.
+static int
+putref(uint pa)
+{
+  volatile uint *ref;
+  uint n;
+
+  ref = &kmem.refcount[pa >> PGSHIFT];
+  for(;;){
+    n = *ref;
+    if(n == 0)
+      return 1;
+    if(cmpxchg(ref, n, n - 1) == n)
+      return n == 1;
+  }
+}
+
 //PAGEBREAK: 21
 // Free the page of physical memory pointed at by v,
 // which normally should have been returned by a
@@ -61,28 +189,37 @@ void
 kfree(char *v)
 {
   struct run *r;
+  struct cpu *c;
 
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
 
+  // A copy-on-write page still mapped elsewhere only
+  // loses a reference.
+  if(!putref(V2P(v)))
+    return;
+
+#ifdef KALLOCJUNK
   // Fill with junk to catch dangling refs.
-  
+  memset(v, 1, PGSIZE);
+#endif
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
   r = (struct run*)v;
-  
-  if(kmem.refcount[V2P(v) >> PGSHIFT] > 0)         // decrease reference count of page when freed
-    kmem.refcount[V2P(v) >> PGSHIFT] = kmem.refcount[V2P(v) >> PGSHIFT] - 1;
-
-  if(kmem.refcount[V2P(v) >> PGSHIFT] == 0){       //
-	  memset(v, 1, PGSIZE);
-	  r->next = kmem.freelist;
-	  kmem.freelist = r;
-	  //kmem.refcount--;
+  if(!kmem.use_lock){
+    r->next = kmem.freelist;
+    kmem.freelist = r;
+    kmem.nfree++;
+    return;
   }
-  if(kmem.use_lock)
-    release(&kmem.lock);
+  // Whichever CPU's cache this lands in, its lock makes
+  // it safe, so a switch to another CPU here is harmless.
+  c = cpu;
+  acquire(&c->flock);
+  r->next = c->freelist;
+  c->freelist = r;
+  if(++c->nfree > 2*KBATCH)
+    drain(c, KBATCH);
+  release(&c->flock);
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -92,33 +229,149 @@ char*
 kalloc(void)
 {
   struct run *r;
+  struct cpu *c;
+
+  if(!kmem.use_lock){
+    r = kmem.freelist;
+    if(r){
+      kmem.freelist = r->next;
+      kmem.nfree--;
+    }
+  } else {
+    c = cpu;
+    r = cachealloc(c);
+
+    // The global list is empty, but other CPUs may still
+    // have pages cached.
+    if(r == 0 && steal(c) > 0)
+      r = cachealloc(c);
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = kmem.freelist;
+    // Memory is getting low: take pages back from the buffer
+    // cache, and try again if there were none to be had.
+    if(kmem.nfree < KLOW && bshrink(KBATCH) > 0 && r == 0)
+      return kalloc();
+
+    // Last resort: the zeroed pages are free pages too.
+    if(r == 0){
+      acquire(&kzero.lock);
+      if((r = kzero.list) != 0){
+        kzero.list = r->next;
+        kzero.n--;
+      }
+      release(&kzero.lock);
+    }
+  }
   if(r)
-  {
-    
-    kmem.freelist = r->next;
     kmem.refcount[V2P((char*)r)>>PGSHIFT] = 1;
-  }
-  if(kmem.use_lock)
-    release(&kmem.lock);
   return (char*)r;
 }
 
+// Allocate a page of zeros.  Takes a page cleared ahead of time
+// by an idle CPU if there is one, so the caller does not pay
+// for the memset.
+char*
+kalloc_zeroed(void)
+{
+  struct run *r;
+  char *v;
+
+  r = 0;
+  if(kmem.use_lock){
+    acquire(&kzero.lock);
+    if((r = kzero.list) != 0){
+      kzero.list = r->next;
+      kzero.n--;
+      kzero.hits++;
+    } else
+      kzero.misses++;
+    release(&kzero.lock);
+  }
+  if(r){
+    r->next = 0;
+    kmem.refcount[V2P((char*)r)>>PGSHIFT] = 1;
+    return (char*)r;
+  }
+  if((v = kalloc()) != 0)
+    memset(v, 0, PGSIZE);
+  return v;
+}
+
+// Clear a free page and add it to the zeroed pool, unless the
+// pool is full or memory is short.  The scheduler calls this
+// when its CPU has nothing to run, with interrupts on, so it
+// does one page at a time and gets back to looking for work.
+void
+kzerofill(void)
+{
+  struct run *r;
+  char *v;
+
+  if(kzero.n >= KZPOOL || kmem.nfree < KLOW)
+    return;
+  if((v = kalloc()) == 0)
+    return;
+  memset(v, 0, PGSIZE);
+  kmem.refcount[V2P(v)>>PGSHIFT] = 0;
+  r = (struct run*)v;
+  acquire(&kzero.lock);
+  r->next = kzero.list;
+  kzero.list = r;
+  kzero.n++;
+  release(&kzero.lock);
+}
+
+// Report how many kalloc_zeroed() calls found a page in the
+// pool and how many had to clear one.
+void
+kzeroinfo(uint *hits, uint *misses)
+{
+  acquire(&kzero.lock);
+  *hits = kzero.hits;
+  *misses = kzero.misses;
+  release(&kzero.lock);
+}
+
+// Return the number of pages on the global free list.  Pages in
+// per-CPU caches are not counted, and the answer is only a hint.
+int
+kfreepages(void)
+{
+  return kmem.nfree;
+}
+
+// Reference counts of copy-on-write pages.  These are
+// updated with lock-prefixed instructions so that fork
+// and page faults never contend for kmem.lock.
 
 void decrement_refcount(uint pa)
 {
   if(pa >= PHYSTOP || pa < (uint)V2P(end))
     panic("decrementReferenceCount"); 
 
-  acquire(&kmem.lock);
+  xadd(&kmem.refcount[pa >> PGSHIFT], -1);
+}
 
-  kmem.refcount[pa >> PGSHIFT] = kmem.refcount[pa >> PGSHIFT] - 1;
-  
-  release(&kmem.lock);
+// Drop one reference to pa unless the caller holds the only one.
+// Returns 1 if a reference was dropped, 0 if the caller is (now)
+// the sole owner of the page.  Checking and decrementing happen
+// as one atomic step, so two processes sharing a page cannot both
+// decide to copy it and leave it with no owner.
+int decrement_refcount_if_shared(uint pa)
+{
+  volatile uint *ref;
+  uint n;
+
+  if(pa >= PHYSTOP || pa < (uint)V2P(end))
+    panic("decrementReferenceCountIfShared"); 
 
+  ref = &kmem.refcount[pa >> PGSHIFT];
+  for(;;){
+    n = *ref;
+    if(n <= 1)
+      return 0;
+    if(cmpxchg(ref, n, n - 1) == n)
+      return 1;
+  }
 }
 
 void increment_refcount(uint pa)
@@ -126,12 +379,7 @@ void increment_refcount(uint pa)
   if(pa >= PHYSTOP || pa < (uint)V2P(end))
     panic("incrementReferenceCount"); 
 
-  acquire(&kmem.lock);
-
-  kmem.refcount[pa >> PGSHIFT] = kmem.refcount[pa >> PGSHIFT]+ 1;
-  
-  release(&kmem.lock);
-
+  xadd(&kmem.refcount[pa >> PGSHIFT], 1);
 }
 
 
@@ -140,15 +388,5 @@ uint get_refcount(uint pa)
   if( pa >= PHYSTOP || pa < (uint)V2P(end))
     panic("getReferenceCount"); 
 
-  uint count;
-
-  acquire(&kmem.lock);
-
-  count = kmem.refcount[pa >> PGSHIFT];
-  
-  release(&kmem.lock);
-
-  return count;
-
+  return *(volatile uint*)&kmem.refcount[pa >> PGSHIFT];
 } 
-
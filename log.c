@@ -9,116 +9,214 @@
 // Simple logging that allows concurrent FS system calls.
 //
 // A log transaction contains the updates of multiple FS system
-// calls. The logging system only commits when there are
-// no FS system calls active. Thus there is never
-// any reasoning required about whether a commit might
-// write an uncommitted system call's updates to disk.
+// calls. A transaction is only closed when there are no FS
+// system calls active in it. Thus there is never any reasoning
+// required about whether a commit might write an uncommitted
+// system call's updates to disk.
 //
 // A system call should call begin_op()/end_op() to mark
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
 // But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// sleeps until the commit thread has made room.
+//
+// The size of the log comes from the superblock (mkfs makes it
+// about 1/32 of the disk), and initlog() derives from it how
+// many blocks one system call may write, log.opblocks, and how
+// many buffers the cache must keep.  filewrite() splits big
+// writes into transactions of that size.
+//
+// Commits are done by a kernel thread, committer(), in
+// batches: once a transaction has been open for COMMITTICKS
+// clock ticks or fills half the log, it is closed to new
+// system calls, and when the active ones have finished its
+// blocks are copied into the log buffers.  At that point a new
+// transaction opens and system calls go on while the old one
+// is written to the log and committed.  So end_op() no longer
+// waits for the disk, and a system call's changes reach the
+// disk up to COMMITTICKS later, all or nothing.
+//
+// Committed blocks are not copied to their home locations
+// right away.  They stay in the log, and pinned in the buffer
+// cache, until a transaction doesn't fit in the log's free
+// slots; then checkpoint() installs them all at once.  A block
+// written by many transactions in between (an inode or bitmap
+// block, say) goes home once instead of once per commit.
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
-//   header block, containing block #s for block A, B, C, ...
-//   block A
-//   block B
-//   block C
+//   header block, containing block #s for slots 0, 1, 2, ...
+//   slot 0
+//   slot 1
+//   slot 2
 //   ...
-// Log appends are synchronous.
+// A block # of 0 marks a free slot (block 0 is never logged).
+// Each commit writes its blocks to slots that are free in the
+// header on disk, then writes a header naming them and freeing
+// the slots of any older copies of the same blocks.  So the
+// header always names at most one slot per block, and a crash
+// at any point leaves either the old or the new set of slots.
+
+#define COMMITTICKS  10  // commit a transaction at least this often
 
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged block# before commit.
 struct logheader {
   int n;
-  int block[LOGSIZE];
+  int block[MAXLOGSLOTS];
 };
 
 struct log {
   struct spinlock lock;
   int start;
   int size;
+  int nslot;       // log blocks after the header
+  int opblocks;    // blocks each FS sys call may log
   int outstanding; // how many FS sys calls are executing.
-  int committing;  // in commit(), please wait.
+  int closing;     // committer() is waiting for them to finish.
+  uint opened;     // ticks when lh got its first block.
   int dev;
-  struct logheader lh;
+  struct logheader lh;  // the open transaction
+  struct logheader ch;  // the header on disk; only committer() uses it
+  struct buf shadow[MAXLOGSLOTS];  // see install_trans()
 };
 struct log log;
 
 static void recover_from_log(void);
-static void commit();
+static void committer(void);
 
 void
 initlog(int dev)
 {
-  if (sizeof(struct logheader) >= BSIZE)
+  int i;
+
+  if (sizeof(struct logheader) > BSIZE)
     panic("initlog: too big logheader");
 
   struct superblock sb;
   initlock(&log.lock, "log");
+  for (i = 0; i < MAXLOGSLOTS; i++)
+    initsleeplock(&log.shadow[i].lock, "log shadow");
   readsb(dev, &sb);
   log.start = sb.logstart;
   log.size = sb.nlog;
   log.dev = dev;
+
+  // Let three system calls share a transaction, as with the
+  // old fixed LOGSIZE of 3*MAXOPBLOCKS.  The cache has to hold
+  // the open transaction's blocks, the committed ones not yet
+  // installed, and a checkpoint's log buffers, all at once.
+  log.nslot = log.size - 1;
+  if (log.nslot > MAXLOGSLOTS)
+    log.nslot = MAXLOGSLOTS;
+  log.opblocks = log.nslot / 3;
+  if (log.opblocks < MAXOPBLOCKS)
+    log.opblocks = MAXOPBLOCKS;
+  if (log.nslot < log.opblocks)
+    panic("initlog: log too small");
+  breserve(3*log.nslot + MAXOPBLOCKS);
+
   recover_from_log();
+  kthread("commit", committer);
 }
 
-// Copy committed blocks from log to their home location
+// Copy the blocks in lh's slots to their home locations.
+// The cached home buffers may already hold changes from the
+// open transaction, which must not reach the disk yet, so the
+// writes go through shadow bufs that point at the log slots'
+// data.  All the writes are queued before waiting for any, so
+// the disk can take them in elevator order.
+// With unpin set, home buffers that the open transaction hasn't
+// logged again are no longer pinned in the cache.
 static void
-install_trans(void)
+install_trans(struct logheader *lh, int unpin)
 {
-  int tail;
+  int tail, i, n;
+  struct buf *b, *lbuf[MAXLOGSLOTS];
+
+  n = 0;
+  for (tail = 0; tail < lh->n; tail++) {
+    if (lh->block[tail] == 0)
+      continue;
+    lbuf[n] = bread(log.dev, log.start+tail+1); // read log block
+    b = &log.shadow[n];
+    acquiresleep(&b->lock);
+    b->dev = log.dev;
+    b->blockno = lh->block[tail];
+    b->data = lbuf[n]->data;
+    b->flags = B_DIRTY;
+    idesubmit(b);  // write dst to disk
+    n++;
+  }
+  for (i = 0; i < n; i++) {
+    b = &log.shadow[i];
+    idewaitbuf(b);
+    releasesleep(&b->lock);
+    brelse(lbuf[i]);
+  }
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
-    brelse(lbuf);
-    brelse(dbuf);
+  if (!unpin)
+    return;
+  for (tail = 0; tail < lh->n; tail++) {
+    if (lh->block[tail] == 0)
+      continue;
+    b = bread(log.dev, lh->block[tail]);
+    acquire(&log.lock);
+    for (i = 0; i < log.lh.n; i++)
+      if (log.lh.block[i] == b->blockno)
+        break;
+    if (i == log.lh.n)
+      b->flags &= ~B_DIRTY;
+    release(&log.lock);
+    brelse(b);
   }
 }
 
-// Read the log header from disk into the in-memory log header
+// Read the log header from disk into lh
 static void
-read_head(void)
+read_head(struct logheader *lh)
 {
   struct buf *buf = bread(log.dev, log.start);
-  struct logheader *lh = (struct logheader *) (buf->data);
+  struct logheader *hb = (struct logheader *) (buf->data);
   int i;
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
+  lh->n = hb->n;
+  for (i = 0; i < lh->n; i++) {
+    lh->block[i] = hb->block[i];
   }
   brelse(buf);
 }
 
-// Write in-memory log header to disk.
+// Write lh to the log header on disk.
 // This is the true point at which the
-// current transaction commits.
+// transaction commits.
 static void
-write_head(void)
+write_head(struct logheader *lh)
 {
   struct buf *buf = bread(log.dev, log.start);
   struct logheader *hb = (struct logheader *) (buf->data);
   int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+  hb->n = lh->n;
+  for (i = 0; i < lh->n; i++) {
+    hb->block[i] = lh->block[i];
   }
   bwrite(buf);
   brelse(buf);
 }
 
+// Install everything in the log and empty it.
+static void
+checkpoint(int unpin)
+{
+  install_trans(&log.ch, unpin); // copy from log to disk
+  log.ch.n = 0;
+  write_head(&log.ch); // clear the log
+}
+
 static void
 recover_from_log(void)
 {
-  read_head();
-  install_trans(); // if committed, copy from log to disk
-  log.lh.n = 0;
-  write_head(); // clear the log
+  read_head(&log.ch);
+  checkpoint(0); // if committed, copy from log to disk
 }
 
 // called at the start of each FS system call.
@@ -127,9 +225,9 @@ begin_op(void)
 {
   acquire(&log.lock);
   while(1){
-    if(log.committing){
+    if(log.closing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+    } else if(log.lh.n + (log.outstanding+1)*log.opblocks > log.nslot){
       // this op might exhaust log space; wait for commit.
       sleep(&log, &log.lock);
     } else {
@@ -141,67 +239,143 @@ begin_op(void)
 }
 
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
 void
 end_op(void)
 {
-  int do_commit = 0;
-
   acquire(&log.lock);
   log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
-  } else {
-    // begin_op() may be waiting for log space.
-    wakeup(&log);
-  }
+  if(log.outstanding < 0)
+    panic("end_op");
+  // begin_op() may be waiting for log space, or
+  // committer() for the last op to finish.
+  wakeup(&log);
   release(&log.lock);
+}
 
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
-    commit();
-    acquire(&log.lock);
-    log.committing = 0;
-    wakeup(&log);
-    release(&log.lock);
+// Is log slot i free in the header on disk?
+static int
+slotfree(int i)
+{
+  return i >= log.ch.n || log.ch.block[i] == 0;
+}
+
+// Pick a free slot for each block of lh, in slot[], and copy the
+// blocks from the cache into those slots' buffers, returned
+// locked in to[].  Returns 0 if there aren't enough free slots.
+// No system call may be active.
+static int
+snapshot(struct logheader *lh, int *slot, struct buf **to)
+{
+  int tail, i;
+
+  for (i = 0, tail = 0; tail < lh->n; i++) {
+    if (i >= log.nslot)
+      return 0;
+    if (slotfree(i))
+      slot[tail++] = i;
+  }
+  for (tail = 0; tail < lh->n; tail++) {
+    to[tail] = bread(log.dev, log.start+slot[tail]+1); // log block
+    struct buf *from = bread(log.dev, lh->block[tail]); // cache block
+    memmove(to[tail]->data, from->data, BSIZE);
+    brelse(from);
   }
+  return 1;
 }
 
-// Copy modified blocks from cache to log.
+// Write the log buffers in to[] to the log.  The writes
+// overlap; all are done before write_head() commits.
 static void
-write_log(void)
+write_log(struct logheader *lh, struct buf **to)
 {
   int tail;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
-    brelse(from);
-    brelse(to);
+  for (tail = 0; tail < lh->n; tail++)
+    bstart(to[tail]);  // write the log
+  for (tail = 0; tail < lh->n; tail++) {
+    bwait(to[tail]);
+    brelse(to[tail]);
+  }
+}
+
+// Commit lh, whose blocks are in log slots slot[] and buffers to[].
+// The home locations are written later, by checkpoint(); until
+// then the home buffers stay pinned by their B_DIRTY.
+static void
+commit(struct logheader *lh, int *slot, struct buf **to)
+{
+  int tail, i;
+
+  write_log(lh, to);      // Write modified blocks from cache to log
+
+  for (tail = 0; tail < lh->n; tail++) {
+    for (i = 0; i < log.ch.n; i++)
+      if (log.ch.block[i] == lh->block[tail])
+        log.ch.block[i] = 0;  // older copy is superseded
+    log.ch.block[slot[tail]] = lh->block[tail];
+    if (slot[tail] >= log.ch.n)
+      log.ch.n = slot[tail] + 1;
   }
+  while (log.ch.n > 0 && log.ch.block[log.ch.n-1] == 0)
+    log.ch.n--;
+  write_head(&log.ch);    // Write header to disk -- the real commit
 }
 
+// The commit thread.  Closes the open transaction when it is
+// old or big enough, takes a snapshot of it once its system
+// calls have finished (checkpointing first if the log is too
+// full), lets the next transaction start, and then commits
+// the snapshot.
 static void
-commit()
+committer(void)
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
+  // Static, since there is one committer and they are
+  // too big for its kernel stack.
+  static struct logheader lh;
+  static struct buf *to[MAXLOGSLOTS];
+  static int slot[MAXLOGSLOTS];
+
+  acquire(&log.lock);
+  for(;;){
+    // The clock wakes us every tick to check.
+    while(log.lh.n == 0 ||
+          (log.lh.n < log.nslot/2 && ticks - log.opened < COMMITTICKS))
+      sleep(&ticks, &log.lock);
+
+    log.closing = 1;
+    while(log.outstanding > 0)
+      sleep(&log, &log.lock);
+    lh = log.lh;
+    release(&log.lock);
+
+    if(!snapshot(&lh, slot, to)){
+      checkpoint(1);
+      if(!snapshot(&lh, slot, to))
+        panic("committer: log too small");
+    }
+
+    acquire(&log.lock);
     log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+    log.closing = 0;
+    wakeup(&log);
+    release(&log.lock);
+
+    commit(&lh, slot, to);
+
+    acquire(&log.lock);
   }
 }
 
+// How many blocks one FS system call may write.
+int
+logopblocks(void)
+{
+  return log.opblocks;
+}
+
 // Caller has modified b->data and is done with the buffer.
 // Record the block number and pin in the cache with B_DIRTY.
-// commit()/write_log() will do the disk write.
+// committer() will do the disk write.
 //
 // log_write() replaces bwrite(); a typical use is:
 //   bp = bread(...)
@@ -213,7 +387,7 @@ log_write(struct buf *b)
 {
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+  if (log.lh.n >= log.nslot)
     panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
@@ -224,9 +398,11 @@ log_write(struct buf *b)
       break;
   }
   log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
+  if (i == log.lh.n) {
+    if (log.lh.n == 0)
+      log.opened = ticks;
     log.lh.n++;
+  }
   b->flags |= B_DIRTY; // prevent eviction
   release(&log.lock);
 }
-
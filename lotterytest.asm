@@ -0,0 +1,3956 @@
+
+_lotterytest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    }
+    setsched(old_policy);
+}
+
+int main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 08             	sub    $0x8,%esp
+    int total_tests = 0;
+    int passed_tests = 0;
+    int i;
+    if (argc > 1 && strcmp(argv[1], "-c") == 0) {
+      14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      17:	8b 41 04             	mov    0x4(%ecx),%eax
+    if (argc > 1 && strcmp(argv[1], "-c") == 0) {
+      1a:	7f 4f                	jg     6b <main+0x6b>
+        compare_policies();
+        exit();
+    }
+    for (i = 0; tests[i].name; ++i) {
+      1c:	8b 0d 00 2d 00 00    	mov    0x2d00,%ecx
+      22:	bb 00 2d 00 00       	mov    $0x2d00,%ebx
+      27:	31 f6                	xor    %esi,%esi
+      29:	31 ff                	xor    %edi,%edi
+      2b:	85 c9                	test   %ecx,%ecx
+      2d:	74 29                	je     58 <main+0x58>
+      2f:	90                   	nop
+        struct test_case *test = &tests[i];
+        run_test_case(test);
+      30:	83 ec 0c             	sub    $0xc,%esp
+      33:	53                   	push   %ebx
+    for (i = 0; tests[i].name; ++i) {
+      34:	81 c3 14 02 00 00    	add    $0x214,%ebx
+        run_test_case(test);
+      3a:	e8 91 13 00 00       	call   13d0 <run_test_case>
+        total_tests += test->total_tests;
+      3f:	8b 83 f0 fd ff ff    	mov    -0x210(%ebx),%eax
+    for (i = 0; tests[i].name; ++i) {
+      45:	83 c4 10             	add    $0x10,%esp
+        total_tests += test->total_tests;
+      48:	01 c7                	add    %eax,%edi
+        passed_tests += test->total_tests - test->errors;
+      4a:	2b 83 f4 fd ff ff    	sub    -0x20c(%ebx),%eax
+      50:	01 c6                	add    %eax,%esi
+    for (i = 0; tests[i].name; ++i) {
+      52:	8b 03                	mov    (%ebx),%eax
+      54:	85 c0                	test   %eax,%eax
+      56:	75 d8                	jne    30 <main+0x30>
+    }
+    printf(1, "overall: passed %d of %d\n", passed_tests, total_tests);
+      58:	57                   	push   %edi
+      59:	56                   	push   %esi
+      5a:	68 b1 1e 00 00       	push   $0x1eb1
+      5f:	6a 01                	push   $0x1
+      61:	e8 8a 1a 00 00       	call   1af0 <printf>
+    exit();
+      66:	e8 d8 18 00 00       	call   1943 <exit>
+    if (argc > 1 && strcmp(argv[1], "-c") == 0) {
+      6b:	52                   	push   %edx
+      6c:	52                   	push   %edx
+      6d:	68 ae 1e 00 00       	push   $0x1eae
+      72:	ff 70 04             	push   0x4(%eax)
+      75:	e8 b6 16 00 00       	call   1730 <strcmp>
+      7a:	83 c4 10             	add    $0x10,%esp
+      7d:	85 c0                	test   %eax,%eax
+      7f:	75 9b                	jne    1c <main+0x1c>
+        compare_policies();
+      81:	e8 1a 15 00 00       	call   15a0 <compare_policies>
+        exit();
+      86:	e8 b8 18 00 00       	call   1943 <exit>
+      8b:	66 90                	xchg   %ax,%ax
+      8d:	66 90                	xchg   %ax,%ax
+      8f:	90                   	nop
+
+00000090 <run_forever>:
+    while (1) {
+      90:	eb fe                	jmp    90 <run_forever>
+      92:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <yield_forever>:
+void yield_forever() {
+      a0:	55                   	push   %ebp
+      a1:	89 e5                	mov    %esp,%ebp
+      a3:	83 ec 08             	sub    $0x8,%esp
+      a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      ad:	8d 76 00             	lea    0x0(%esi),%esi
+        yield();
+      b0:	e8 4e 19 00 00       	call   1a03 <yield>
+    while (1) {
+      b5:	eb f9                	jmp    b0 <yield_forever+0x10>
+      b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      be:	66 90                	xchg   %ax,%ax
+
+000000c0 <iowait_forever>:
+void iowait_forever() {
+      c0:	55                   	push   %ebp
+      c1:	89 e5                	mov    %esp,%ebp
+      c3:	53                   	push   %ebx
+    pipe(fds);
+      c4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+      c7:	8d 5d ef             	lea    -0x11(%ebp),%ebx
+void iowait_forever() {
+      ca:	83 ec 20             	sub    $0x20,%esp
+    pipe(fds);
+      cd:	50                   	push   %eax
+      ce:	e8 80 18 00 00       	call   1953 <pipe>
+      d3:	83 c4 10             	add    $0x10,%esp
+      d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      dd:	8d 76 00             	lea    0x0(%esi),%esi
+        read(fds[0], temp, 0);
+      e0:	83 ec 04             	sub    $0x4,%esp
+      e3:	6a 00                	push   $0x0
+      e5:	53                   	push   %ebx
+      e6:	ff 75 f0             	push   -0x10(%ebp)
+      e9:	e8 6d 18 00 00       	call   195b <read>
+    while (1) {
+      ee:	83 c4 10             	add    $0x10,%esp
+      f1:	eb ed                	jmp    e0 <iowait_forever+0x20>
+      f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000100 <exit_fast>:
+void exit_fast() {
+     100:	55                   	push   %ebp
+     101:	89 e5                	mov    %esp,%ebp
+     103:	83 ec 08             	sub    $0x8,%esp
+    exit();
+     106:	e8 38 18 00 00       	call   1943 <exit>
+     10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     10f:	90                   	nop
+
+00000110 <__absvdi2>:
+#define arith64_abs(a) arith64_neg(a, a)
+
+// Return the absolute value of a.
+// Note LLINT_MIN cannot be negated.
+arith64_s64 __absvdi2(arith64_s64 a)
+{
+     110:	55                   	push   %ebp
+     111:	89 e5                	mov    %esp,%ebp
+     113:	53                   	push   %ebx
+    return arith64_abs(a);
+     114:	31 db                	xor    %ebx,%ebx
+     116:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     119:	89 da                	mov    %ebx,%edx
+     11b:	c1 e9 1f             	shr    $0x1f,%ecx
+     11e:	89 c8                	mov    %ecx,%eax
+     120:	f7 d8                	neg    %eax
+     122:	83 d2 00             	adc    $0x0,%edx
+     125:	33 45 08             	xor    0x8(%ebp),%eax
+     128:	f7 da                	neg    %edx
+     12a:	33 55 0c             	xor    0xc(%ebp),%edx
+     12d:	01 c8                	add    %ecx,%eax
+     12f:	11 da                	adc    %ebx,%edx
+}
+     131:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     134:	c9                   	leave
+     135:	c3                   	ret
+     136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     13d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000140 <__ashldi3>:
+
+// Return the result of shifting a left by b bits.
+arith64_s64 __ashldi3(arith64_s64 a, int b)
+{
+     140:	55                   	push   %ebp
+     141:	89 e5                	mov    %esp,%ebp
+     143:	56                   	push   %esi
+     144:	53                   	push   %ebx
+     145:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     148:	8b 55 08             	mov    0x8(%ebp),%edx
+     14b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    arith64_word w = {.s64 = a};
+
+    b &= 63;
+     14e:	89 c8                	mov    %ecx,%eax
+     150:	83 e0 3f             	and    $0x3f,%eax
+
+    if (b >= 32)
+     153:	83 e1 20             	and    $0x20,%ecx
+     156:	74 10                	je     168 <__ashldi3+0x28>
+    {
+        w.u32.hi = w.u32.lo << (b - 32);
+     158:	8d 48 e0             	lea    -0x20(%eax),%ecx
+    {
+        w.u32.hi = (w.u32.lo >> (32 - b)) | (w.u32.hi << b);
+        w.u32.lo <<= b;
+    }
+    return w.s64;
+}
+     15b:	5b                   	pop    %ebx
+    return w.s64;
+     15c:	31 c0                	xor    %eax,%eax
+}
+     15e:	5e                   	pop    %esi
+    return w.s64;
+     15f:	d3 e2                	shl    %cl,%edx
+}
+     161:	5d                   	pop    %ebp
+     162:	c3                   	ret
+     163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     167:	90                   	nop
+    } else if (b)
+     168:	85 c0                	test   %eax,%eax
+     16a:	74 24                	je     190 <__ashldi3+0x50>
+        w.u32.hi = (w.u32.lo >> (32 - b)) | (w.u32.hi << b);
+     16c:	b9 20 00 00 00       	mov    $0x20,%ecx
+     171:	89 d6                	mov    %edx,%esi
+     173:	29 c1                	sub    %eax,%ecx
+     175:	d3 ee                	shr    %cl,%esi
+     177:	89 c1                	mov    %eax,%ecx
+     179:	d3 e3                	shl    %cl,%ebx
+    return w.s64;
+     17b:	d3 e2                	shl    %cl,%edx
+     17d:	09 de                	or     %ebx,%esi
+     17f:	89 d0                	mov    %edx,%eax
+}
+     181:	5b                   	pop    %ebx
+    return w.s64;
+     182:	89 f2                	mov    %esi,%edx
+}
+     184:	5e                   	pop    %esi
+     185:	5d                   	pop    %ebp
+     186:	c3                   	ret
+     187:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     18e:	66 90                	xchg   %ax,%ax
+     190:	89 d0                	mov    %edx,%eax
+     192:	89 da                	mov    %ebx,%edx
+     194:	5b                   	pop    %ebx
+     195:	5e                   	pop    %esi
+     196:	5d                   	pop    %ebp
+     197:	c3                   	ret
+     198:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     19f:	90                   	nop
+
+000001a0 <__ashrdi3>:
+
+// Return the result of arithmetically shifting a right by b bits.
+arith64_s64 __ashrdi3(arith64_s64 a, int b)
+{
+     1a0:	55                   	push   %ebp
+     1a1:	89 e5                	mov    %esp,%ebp
+     1a3:	56                   	push   %esi
+     1a4:	53                   	push   %ebx
+     1a5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     1a8:	8b 45 08             	mov    0x8(%ebp),%eax
+     1ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+    arith64_word w = {.s64 = a};
+
+    b &= 63;
+     1ae:	89 cb                	mov    %ecx,%ebx
+     1b0:	83 e3 3f             	and    $0x3f,%ebx
+
+    if (b >= 32)
+     1b3:	83 e1 20             	and    $0x20,%ecx
+     1b6:	74 18                	je     1d0 <__ashrdi3+0x30>
+    } else if (b)
+    {
+        w.u32.lo = (w.u32.hi << (32 - b)) | (w.u32.lo >> b);
+        w.s32.hi >>= b;
+    }
+    return w.s64;
+     1b8:	89 d0                	mov    %edx,%eax
+        w.s32.lo = w.s32.hi >> (b - 32);
+     1ba:	8d 4b e0             	lea    -0x20(%ebx),%ecx
+    return w.s64;
+     1bd:	c1 fa 1f             	sar    $0x1f,%edx
+     1c0:	d3 f8                	sar    %cl,%eax
+}
+     1c2:	5b                   	pop    %ebx
+     1c3:	5e                   	pop    %esi
+     1c4:	5d                   	pop    %ebp
+     1c5:	c3                   	ret
+     1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1cd:	8d 76 00             	lea    0x0(%esi),%esi
+    } else if (b)
+     1d0:	85 db                	test   %ebx,%ebx
+     1d2:	74 ee                	je     1c2 <__ashrdi3+0x22>
+        w.u32.lo = (w.u32.hi << (32 - b)) | (w.u32.lo >> b);
+     1d4:	b9 20 00 00 00       	mov    $0x20,%ecx
+     1d9:	89 d6                	mov    %edx,%esi
+     1db:	29 d9                	sub    %ebx,%ecx
+     1dd:	d3 e6                	shl    %cl,%esi
+     1df:	89 d9                	mov    %ebx,%ecx
+}
+     1e1:	5b                   	pop    %ebx
+        w.u32.lo = (w.u32.hi << (32 - b)) | (w.u32.lo >> b);
+     1e2:	d3 e8                	shr    %cl,%eax
+    return w.s64;
+     1e4:	d3 fa                	sar    %cl,%edx
+     1e6:	09 f0                	or     %esi,%eax
+}
+     1e8:	5e                   	pop    %esi
+     1e9:	5d                   	pop    %ebp
+     1ea:	c3                   	ret
+     1eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1ef:	90                   	nop
+
+000001f0 <__clzsi2>:
+
+// These functions return the number of leading 0-bits in a, starting at the
+// most significant bit position. If a is zero, the result is undefined.
+int __clzsi2(arith64_u32 a)
+{
+     1f0:	55                   	push   %ebp
+    int b, n = 0;
+    b = !(a & 0xffff0000) << 4; n += b; a <<= b;
+     1f1:	31 d2                	xor    %edx,%edx
+{
+     1f3:	89 e5                	mov    %esp,%ebp
+     1f5:	53                   	push   %ebx
+     1f6:	8b 45 08             	mov    0x8(%ebp),%eax
+    b = !(a & 0xffff0000) << 4; n += b; a <<= b;
+     1f9:	3d ff ff 00 00       	cmp    $0xffff,%eax
+     1fe:	0f 96 c2             	setbe  %dl
+    b = !(a & 0xff000000) << 3; n += b; a <<= b;
+     201:	31 db                	xor    %ebx,%ebx
+    b = !(a & 0xffff0000) << 4; n += b; a <<= b;
+     203:	c1 e2 04             	shl    $0x4,%edx
+     206:	89 d1                	mov    %edx,%ecx
+     208:	d3 e0                	shl    %cl,%eax
+    b = !(a & 0xff000000) << 3; n += b; a <<= b;
+     20a:	3d ff ff ff 00       	cmp    $0xffffff,%eax
+     20f:	0f 96 c3             	setbe  %bl
+     212:	c1 e3 03             	shl    $0x3,%ebx
+     215:	89 d9                	mov    %ebx,%ecx
+     217:	01 da                	add    %ebx,%edx
+    b = !(a & 0xf0000000) << 2; n += b; a <<= b;
+    b = !(a & 0xc0000000) << 1; n += b; a <<= b;
+    return n + !(a & 0x80000000);
+}
+     219:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     21c:	c9                   	leave
+    b = !(a & 0xff000000) << 3; n += b; a <<= b;
+     21d:	d3 e0                	shl    %cl,%eax
+    b = !(a & 0xf0000000) << 2; n += b; a <<= b;
+     21f:	31 c9                	xor    %ecx,%ecx
+     221:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+     226:	0f 96 c1             	setbe  %cl
+     229:	c1 e1 02             	shl    $0x2,%ecx
+     22c:	d3 e0                	shl    %cl,%eax
+     22e:	01 ca                	add    %ecx,%edx
+    b = !(a & 0xc0000000) << 1; n += b; a <<= b;
+     230:	31 c9                	xor    %ecx,%ecx
+     232:	3d ff ff ff 3f       	cmp    $0x3fffffff,%eax
+     237:	0f 96 c1             	setbe  %cl
+     23a:	01 c9                	add    %ecx,%ecx
+     23c:	d3 e0                	shl    %cl,%eax
+     23e:	01 ca                	add    %ecx,%edx
+    return n + !(a & 0x80000000);
+     240:	f7 d0                	not    %eax
+     242:	c1 e8 1f             	shr    $0x1f,%eax
+     245:	01 d0                	add    %edx,%eax
+}
+     247:	c3                   	ret
+     248:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     24f:	90                   	nop
+
+00000250 <__clzdi2>:
+
+int __clzdi2(arith64_u64 a)
+{
+     250:	55                   	push   %ebp
+    int b, n = 0;
+    b = !(a & 0xffffffff00000000ULL) << 5; n += b; a <<= b;
+     251:	31 c9                	xor    %ecx,%ecx
+{
+     253:	89 e5                	mov    %esp,%ebp
+     255:	56                   	push   %esi
+     256:	53                   	push   %ebx
+     257:	8b 55 0c             	mov    0xc(%ebp),%edx
+     25a:	8b 45 08             	mov    0x8(%ebp),%eax
+    b = !(a & 0xffffffff00000000ULL) << 5; n += b; a <<= b;
+     25d:	85 d2                	test   %edx,%edx
+     25f:	0f 94 c1             	sete   %cl
+     262:	31 db                	xor    %ebx,%ebx
+     264:	c1 e1 05             	shl    $0x5,%ecx
+     267:	0f a5 c2             	shld   %cl,%eax,%edx
+     26a:	d3 e0                	shl    %cl,%eax
+     26c:	f6 c1 20             	test   $0x20,%cl
+     26f:	0f 45 d0             	cmovne %eax,%edx
+     272:	0f 45 c3             	cmovne %ebx,%eax
+    b = !(a & 0xffff000000000000ULL) << 4; n += b; a <<= b;
+     275:	31 db                	xor    %ebx,%ebx
+     277:	81 fa 00 00 01 00    	cmp    $0x10000,%edx
+     27d:	0f 92 c3             	setb   %bl
+     280:	89 de                	mov    %ebx,%esi
+     282:	c1 e6 04             	shl    $0x4,%esi
+     285:	8d 1c 0e             	lea    (%esi,%ecx,1),%ebx
+     288:	89 f1                	mov    %esi,%ecx
+     28a:	31 f6                	xor    %esi,%esi
+     28c:	0f a5 c2             	shld   %cl,%eax,%edx
+     28f:	d3 e0                	shl    %cl,%eax
+     291:	f6 c1 20             	test   $0x20,%cl
+     294:	0f 45 d0             	cmovne %eax,%edx
+     297:	0f 45 c6             	cmovne %esi,%eax
+    b = !(a & 0xff00000000000000ULL) << 3; n += b; a <<= b;
+     29a:	31 c9                	xor    %ecx,%ecx
+     29c:	81 fa 00 00 00 01    	cmp    $0x1000000,%edx
+     2a2:	0f 92 c1             	setb   %cl
+     2a5:	31 f6                	xor    %esi,%esi
+     2a7:	c1 e1 03             	shl    $0x3,%ecx
+     2aa:	0f a5 c2             	shld   %cl,%eax,%edx
+     2ad:	01 cb                	add    %ecx,%ebx
+     2af:	d3 e0                	shl    %cl,%eax
+     2b1:	f6 c1 20             	test   $0x20,%cl
+     2b4:	0f 45 d0             	cmovne %eax,%edx
+     2b7:	0f 45 c6             	cmovne %esi,%eax
+    b = !(a & 0xf000000000000000ULL) << 2; n += b; a <<= b;
+     2ba:	31 c9                	xor    %ecx,%ecx
+     2bc:	81 fa 00 00 00 10    	cmp    $0x10000000,%edx
+     2c2:	0f 92 c1             	setb   %cl
+     2c5:	31 f6                	xor    %esi,%esi
+     2c7:	c1 e1 02             	shl    $0x2,%ecx
+     2ca:	0f a5 c2             	shld   %cl,%eax,%edx
+     2cd:	01 cb                	add    %ecx,%ebx
+     2cf:	d3 e0                	shl    %cl,%eax
+     2d1:	f6 c1 20             	test   $0x20,%cl
+     2d4:	0f 45 d0             	cmovne %eax,%edx
+     2d7:	0f 45 c6             	cmovne %esi,%eax
+    b = !(a & 0xc000000000000000ULL) << 1; n += b; a <<= b;
+     2da:	31 c9                	xor    %ecx,%ecx
+     2dc:	81 fa 00 00 00 40    	cmp    $0x40000000,%edx
+     2e2:	0f 92 c1             	setb   %cl
+     2e5:	01 c9                	add    %ecx,%ecx
+     2e7:	0f a5 c2             	shld   %cl,%eax,%edx
+     2ea:	d3 e0                	shl    %cl,%eax
+     2ec:	f6 c1 20             	test   $0x20,%cl
+     2ef:	0f 45 d0             	cmovne %eax,%edx
+     2f2:	01 cb                	add    %ecx,%ebx
+    return n + !(a & 0x8000000000000000ULL);
+     2f4:	89 d0                	mov    %edx,%eax
+     2f6:	f7 d0                	not    %eax
+     2f8:	c1 e8 1f             	shr    $0x1f,%eax
+     2fb:	01 d8                	add    %ebx,%eax
+}
+     2fd:	5b                   	pop    %ebx
+     2fe:	5e                   	pop    %esi
+     2ff:	5d                   	pop    %ebp
+     300:	c3                   	ret
+     301:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     308:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30f:	90                   	nop
+
+00000310 <__divmoddi4.part.0>:
+}
+
+// Calculate both the quotient and remainder of the unsigned division of a and
+// b. The return value is the quotient, and the remainder is placed in variable
+// pointed to by c (if it's not NULL).
+arith64_u64 __divmoddi4(arith64_u64 a, arith64_u64 b, arith64_u64 *c)
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	57                   	push   %edi
+     314:	89 d7                	mov    %edx,%edi
+     316:	56                   	push   %esi
+     317:	89 c6                	mov    %eax,%esi
+     319:	53                   	push   %ebx
+     31a:	83 ec 5c             	sub    $0x5c,%esp
+     31d:	8b 45 08             	mov    0x8(%ebp),%eax
+     320:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     323:	89 45 b0             	mov    %eax,-0x50(%ebp)
+     326:	89 c2                	mov    %eax,%edx
+     328:	89 4d b4             	mov    %ecx,-0x4c(%ebp)
+    if (b > a)                                  // divisor > numerator?
+    {
+        if (c) *c = a;                          // remainder = numerator
+        return 0;                               // quotient = 0
+    }
+    if (!arith64_hi(b))                         // divisor is 32-bit
+     32b:	85 c9                	test   %ecx,%ecx
+     32d:	75 24                	jne    353 <__divmoddi4.part.0+0x43>
+    {
+        if (b == 0)                             // divide by 0
+     32f:	85 c0                	test   %eax,%eax
+     331:	0f 85 59 01 00 00    	jne    490 <__divmoddi4.part.0+0x180>
+        {
+            volatile char x = 0; x = 1 / x;     // force an exception
+     337:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+     33b:	0f be 45 e7          	movsbl -0x19(%ebp),%eax
+     33f:	8d 48 01             	lea    0x1(%eax),%ecx
+     342:	83 f9 02             	cmp    $0x2,%ecx
+     345:	0f 47 c2             	cmova  %edx,%eax
+     348:	88 45 e7             	mov    %al,-0x19(%ebp)
+        if (b == 1)                             // divide by 1
+        {
+            if (c) *c = 0;                      // remainder = 0
+            return a;                           // quotient = numerator
+        }
+        if (!arith64_hi(a))                     // numerator is also 32-bit
+     34b:	85 ff                	test   %edi,%edi
+     34d:	0f 84 6d 01 00 00    	je     4c0 <__divmoddi4.part.0+0x1b0>
+            return arith64_lo(a) / arith64_lo(b);
+        }
+    }
+
+    // let's do long division
+    char bits = __clzdi2(b) - __clzdi2(a) + 1;  // number of bits to iterate (a and b are non-zero)
+     353:	83 ec 08             	sub    $0x8,%esp
+     356:	ff 75 b4             	push   -0x4c(%ebp)
+     359:	ff 75 b0             	push   -0x50(%ebp)
+     35c:	e8 ef fe ff ff       	call   250 <__clzdi2>
+     361:	5b                   	pop    %ebx
+     362:	5a                   	pop    %edx
+     363:	57                   	push   %edi
+     364:	56                   	push   %esi
+     365:	89 c3                	mov    %eax,%ebx
+     367:	83 c3 01             	add    $0x1,%ebx
+     36a:	e8 e1 fe ff ff       	call   250 <__clzdi2>
+    arith64_u64 rem = a >> bits;                   // init remainder
+     36f:	89 fa                	mov    %edi,%edx
+    char bits = __clzdi2(b) - __clzdi2(a) + 1;  // number of bits to iterate (a and b are non-zero)
+     371:	83 c4 10             	add    $0x10,%esp
+     374:	29 c3                	sub    %eax,%ebx
+    arith64_u64 rem = a >> bits;                   // init remainder
+     376:	89 f0                	mov    %esi,%eax
+     378:	89 d9                	mov    %ebx,%ecx
+     37a:	0f ad d0             	shrd   %cl,%edx,%eax
+     37d:	d3 ea                	shr    %cl,%edx
+     37f:	f6 c1 20             	test   $0x20,%cl
+     382:	74 04                	je     388 <__divmoddi4.part.0+0x78>
+     384:	89 d0                	mov    %edx,%eax
+     386:	31 d2                	xor    %edx,%edx
+    a <<= 64 - bits;                            // shift numerator to the high bit
+     388:	b9 40 00 00 00       	mov    $0x40,%ecx
+     38d:	29 d9                	sub    %ebx,%ecx
+     38f:	0f a5 f7             	shld   %cl,%esi,%edi
+     392:	d3 e6                	shl    %cl,%esi
+     394:	f6 c1 20             	test   $0x20,%cl
+     397:	74 04                	je     39d <__divmoddi4.part.0+0x8d>
+     399:	89 f7                	mov    %esi,%edi
+     39b:	31 f6                	xor    %esi,%esi
+    arith64_u64 wrap = 0;                          // start with wrap = 0
+    while (bits-- > 0)                          // for each bit
+     39d:	8d 4b ff             	lea    -0x1(%ebx),%ecx
+     3a0:	88 4d d0             	mov    %cl,-0x30(%ebp)
+     3a3:	84 db                	test   %bl,%bl
+     3a5:	0f 8e 45 01 00 00    	jle    4f0 <__divmoddi4.part.0+0x1e0>
+     3ab:	8b 4d b0             	mov    -0x50(%ebp),%ecx
+     3ae:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+    arith64_u64 wrap = 0;                          // start with wrap = 0
+     3b1:	c7 45 ac 00 00 00 00 	movl   $0x0,-0x54(%ebp)
+     3b8:	83 c1 ff             	add    $0xffffffff,%ecx
+     3bb:	83 d3 ff             	adc    $0xffffffff,%ebx
+     3be:	89 4d a0             	mov    %ecx,-0x60(%ebp)
+     3c1:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+     3c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    {
+        rem = (rem << 1) | (a >> 63);           // shift numerator MSB to remainder LSB
+     3c8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+     3cc:	01 c0                	add    %eax,%eax
+        a = (a << 1) | (wrap & 1);              // shift out the numerator, shift in wrap
+     3ce:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+        rem = (rem << 1) | (a >> 63);           // shift numerator MSB to remainder LSB
+     3d5:	89 d3                	mov    %edx,%ebx
+     3d7:	89 fa                	mov    %edi,%edx
+     3d9:	89 c1                	mov    %eax,%ecx
+        a = (a << 1) | (wrap & 1);              // shift out the numerator, shift in wrap
+     3db:	0f a4 f7 01          	shld   $0x1,%esi,%edi
+        rem = (rem << 1) | (a >> 63);           // shift numerator MSB to remainder LSB
+     3df:	89 d0                	mov    %edx,%eax
+     3e1:	31 d2                	xor    %edx,%edx
+        a = (a << 1) | (wrap & 1);              // shift out the numerator, shift in wrap
+     3e3:	01 f6                	add    %esi,%esi
+        rem = (rem << 1) | (a >> 63);           // shift numerator MSB to remainder LSB
+     3e5:	09 da                	or     %ebx,%edx
+        a = (a << 1) | (wrap & 1);              // shift out the numerator, shift in wrap
+     3e7:	89 fb                	mov    %edi,%ebx
+     3e9:	8b 7d ac             	mov    -0x54(%ebp),%edi
+        rem = (rem << 1) | (a >> 63);           // shift numerator MSB to remainder LSB
+     3ec:	c1 e8 1f             	shr    $0x1f,%eax
+     3ef:	09 c8                	or     %ecx,%eax
+        a = (a << 1) | (wrap & 1);              // shift out the numerator, shift in wrap
+     3f1:	89 f1                	mov    %esi,%ecx
+        wrap = ((arith64_s64)(b - rem - 1) >> 63);  // wrap = (b > rem) ? 0 : 0xffffffffffffffff (via sign extension)
+     3f3:	89 55 cc             	mov    %edx,-0x34(%ebp)
+        a = (a << 1) | (wrap & 1);              // shift out the numerator, shift in wrap
+     3f6:	83 e7 01             	and    $0x1,%edi
+        wrap = ((arith64_s64)(b - rem - 1) >> 63);  // wrap = (b > rem) ? 0 : 0xffffffffffffffff (via sign extension)
+     3f9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+        a = (a << 1) | (wrap & 1);              // shift out the numerator, shift in wrap
+     3fc:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     3ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     402:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+     405:	09 ce                	or     %ecx,%esi
+        wrap = ((arith64_s64)(b - rem - 1) >> 63);  // wrap = (b > rem) ? 0 : 0xffffffffffffffff (via sign extension)
+     407:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+        a = (a << 1) | (wrap & 1);              // shift out the numerator, shift in wrap
+     40a:	09 df                	or     %ebx,%edi
+        wrap = ((arith64_s64)(b - rem - 1) >> 63);  // wrap = (b > rem) ? 0 : 0xffffffffffffffff (via sign extension)
+     40c:	8b 5d a4             	mov    -0x5c(%ebp),%ebx
+     40f:	29 c1                	sub    %eax,%ecx
+        rem -= b & wrap;                        // if (wrap) rem -= b
+     411:	8b 45 b0             	mov    -0x50(%ebp),%eax
+        wrap = ((arith64_s64)(b - rem - 1) >> 63);  // wrap = (b > rem) ? 0 : 0xffffffffffffffff (via sign extension)
+     414:	19 d3                	sbb    %edx,%ebx
+     416:	89 ca                	mov    %ecx,%edx
+     418:	89 d9                	mov    %ebx,%ecx
+     41a:	89 5d 9c             	mov    %ebx,-0x64(%ebp)
+     41d:	c1 f9 1f             	sar    $0x1f,%ecx
+     420:	89 55 98             	mov    %edx,-0x68(%ebp)
+        rem -= b & wrap;                        // if (wrap) rem -= b
+     423:	8b 55 cc             	mov    -0x34(%ebp),%edx
+     426:	21 c8                	and    %ecx,%eax
+        wrap = ((arith64_s64)(b - rem - 1) >> 63);  // wrap = (b > rem) ? 0 : 0xffffffffffffffff (via sign extension)
+     428:	89 cb                	mov    %ecx,%ebx
+     42a:	89 4d ac             	mov    %ecx,-0x54(%ebp)
+        rem -= b & wrap;                        // if (wrap) rem -= b
+     42d:	89 45 b8             	mov    %eax,-0x48(%ebp)
+     430:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+     433:	21 c3                	and    %eax,%ebx
+     435:	8b 45 c8             	mov    -0x38(%ebp),%eax
+     438:	2b 45 b8             	sub    -0x48(%ebp),%eax
+     43b:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+     43e:	1b 55 bc             	sbb    -0x44(%ebp),%edx
+    while (bits-- > 0)                          // for each bit
+     441:	80 6d d0 01          	subb   $0x1,-0x30(%ebp)
+     445:	0f b6 5d d0          	movzbl -0x30(%ebp),%ebx
+     449:	80 fb ff             	cmp    $0xff,%bl
+     44c:	0f 85 76 ff ff ff    	jne    3c8 <__divmoddi4.part.0+0xb8>
+     452:	8b 5d 9c             	mov    -0x64(%ebp),%ebx
+     455:	89 d9                	mov    %ebx,%ecx
+     457:	31 db                	xor    %ebx,%ebx
+     459:	c1 e9 1f             	shr    $0x1f,%ecx
+     45c:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+     45f:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    }
+    if (c) *c = rem;                            // maybe set remainder
+     462:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     465:	85 db                	test   %ebx,%ebx
+     467:	74 08                	je     471 <__divmoddi4.part.0+0x161>
+     469:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     46c:	89 03                	mov    %eax,(%ebx)
+     46e:	89 53 04             	mov    %edx,0x4(%ebx)
+    return (a << 1) | (wrap & 1);               // return the quotient
+     471:	89 f0                	mov    %esi,%eax
+     473:	89 fa                	mov    %edi,%edx
+     475:	0f a4 f2 01          	shld   $0x1,%esi,%edx
+     479:	01 f0                	add    %esi,%eax
+     47b:	0b 55 d4             	or     -0x2c(%ebp),%edx
+     47e:	0b 45 d0             	or     -0x30(%ebp),%eax
+}
+     481:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     484:	5b                   	pop    %ebx
+     485:	5e                   	pop    %esi
+     486:	5f                   	pop    %edi
+     487:	5d                   	pop    %ebp
+     488:	c3                   	ret
+     489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        if (b == 1)                             // divide by 1
+     490:	8b 45 b0             	mov    -0x50(%ebp),%eax
+     493:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     496:	83 f0 01             	xor    $0x1,%eax
+     499:	09 d0                	or     %edx,%eax
+     49b:	0f 85 aa fe ff ff    	jne    34b <__divmoddi4.part.0+0x3b>
+            if (c) *c = 0;                      // remainder = 0
+     4a1:	8b 55 10             	mov    0x10(%ebp),%edx
+     4a4:	85 d2                	test   %edx,%edx
+     4a6:	74 10                	je     4b8 <__divmoddi4.part.0+0x1a8>
+     4a8:	8b 45 10             	mov    0x10(%ebp),%eax
+     4ab:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+     4b1:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+            return a;                           // quotient = numerator
+     4b8:	89 f0                	mov    %esi,%eax
+     4ba:	89 fa                	mov    %edi,%edx
+     4bc:	eb c3                	jmp    481 <__divmoddi4.part.0+0x171>
+     4be:	66 90                	xchg   %ax,%ax
+            if (c)                              // use generic 32-bit operators
+     4c0:	8b 45 10             	mov    0x10(%ebp),%eax
+     4c3:	8b 4d b0             	mov    -0x50(%ebp),%ecx
+     4c6:	85 c0                	test   %eax,%eax
+     4c8:	74 12                	je     4dc <__divmoddi4.part.0+0x1cc>
+                *c = arith64_lo(a) % arith64_lo(b);
+     4ca:	89 f0                	mov    %esi,%eax
+     4cc:	31 d2                	xor    %edx,%edx
+     4ce:	f7 f1                	div    %ecx
+     4d0:	8b 45 10             	mov    0x10(%ebp),%eax
+     4d3:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+     4da:	89 10                	mov    %edx,(%eax)
+}
+     4dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+            return arith64_lo(a) / arith64_lo(b);
+     4df:	89 f0                	mov    %esi,%eax
+     4e1:	31 d2                	xor    %edx,%edx
+}
+     4e3:	5b                   	pop    %ebx
+     4e4:	5e                   	pop    %esi
+            return arith64_lo(a) / arith64_lo(b);
+     4e5:	f7 f1                	div    %ecx
+}
+     4e7:	5f                   	pop    %edi
+            return arith64_lo(a) / arith64_lo(b);
+     4e8:	31 d2                	xor    %edx,%edx
+}
+     4ea:	5d                   	pop    %ebp
+     4eb:	c3                   	ret
+     4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    while (bits-- > 0)                          // for each bit
+     4f0:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+     4f7:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     4fe:	e9 5f ff ff ff       	jmp    462 <__divmoddi4.part.0+0x152>
+     503:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000510 <__ctzsi2>:
+{
+     510:	55                   	push   %ebp
+    b = !(a & 0x0000ffff) << 4; n += b; a >>= b;
+     511:	31 d2                	xor    %edx,%edx
+{
+     513:	89 e5                	mov    %esp,%ebp
+     515:	53                   	push   %ebx
+     516:	8b 45 08             	mov    0x8(%ebp),%eax
+    b = !(a & 0x0000ffff) << 4; n += b; a >>= b;
+     519:	66 85 c0             	test   %ax,%ax
+     51c:	0f 94 c2             	sete   %dl
+    b = !(a & 0x000000ff) << 3; n += b; a >>= b;
+     51f:	31 db                	xor    %ebx,%ebx
+    b = !(a & 0x0000ffff) << 4; n += b; a >>= b;
+     521:	c1 e2 04             	shl    $0x4,%edx
+     524:	89 d1                	mov    %edx,%ecx
+     526:	d3 e8                	shr    %cl,%eax
+    b = !(a & 0x000000ff) << 3; n += b; a >>= b;
+     528:	84 c0                	test   %al,%al
+     52a:	0f 94 c3             	sete   %bl
+     52d:	c1 e3 03             	shl    $0x3,%ebx
+     530:	89 d9                	mov    %ebx,%ecx
+     532:	01 da                	add    %ebx,%edx
+}
+     534:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     537:	c9                   	leave
+    b = !(a & 0x000000ff) << 3; n += b; a >>= b;
+     538:	d3 e8                	shr    %cl,%eax
+    b = !(a & 0x0000000f) << 2; n += b; a >>= b;
+     53a:	31 c9                	xor    %ecx,%ecx
+     53c:	a8 0f                	test   $0xf,%al
+     53e:	0f 94 c1             	sete   %cl
+     541:	c1 e1 02             	shl    $0x2,%ecx
+     544:	d3 e8                	shr    %cl,%eax
+     546:	01 ca                	add    %ecx,%edx
+    b = !(a & 0x00000003) << 1; n += b; a >>= b;
+     548:	31 c9                	xor    %ecx,%ecx
+     54a:	a8 03                	test   $0x3,%al
+     54c:	0f 94 c1             	sete   %cl
+     54f:	01 c9                	add    %ecx,%ecx
+    return n + !(a & 0x00000001);
+     551:	0f a3 c8             	bt     %ecx,%eax
+     554:	0f 93 c0             	setae  %al
+    b = !(a & 0x00000003) << 1; n += b; a >>= b;
+     557:	01 ca                	add    %ecx,%edx
+    return n + !(a & 0x00000001);
+     559:	0f b6 c0             	movzbl %al,%eax
+     55c:	01 d0                	add    %edx,%eax
+}
+     55e:	c3                   	ret
+     55f:	90                   	nop
+
+00000560 <__ctzdi2>:
+{
+     560:	55                   	push   %ebp
+     561:	89 e5                	mov    %esp,%ebp
+     563:	56                   	push   %esi
+     564:	53                   	push   %ebx
+     565:	8b 45 08             	mov    0x8(%ebp),%eax
+     568:	8b 55 0c             	mov    0xc(%ebp),%edx
+    b = !(a & 0x00000000ffffffffULL) << 5; n += b; a >>= b;
+     56b:	85 c0                	test   %eax,%eax
+     56d:	0f 94 c1             	sete   %cl
+     570:	31 db                	xor    %ebx,%ebx
+     572:	0f b6 c9             	movzbl %cl,%ecx
+     575:	c1 e1 05             	shl    $0x5,%ecx
+     578:	0f ad d0             	shrd   %cl,%edx,%eax
+     57b:	d3 ea                	shr    %cl,%edx
+     57d:	f6 c1 20             	test   $0x20,%cl
+     580:	0f 45 c2             	cmovne %edx,%eax
+     583:	0f 45 d3             	cmovne %ebx,%edx
+    b = !(a & 0x000000000000ffffULL) << 4; n += b; a >>= b;
+     586:	0f b7 d8             	movzwl %ax,%ebx
+     589:	83 cb 00             	or     $0x0,%ebx
+     58c:	0f 94 c3             	sete   %bl
+     58f:	0f b6 db             	movzbl %bl,%ebx
+     592:	89 de                	mov    %ebx,%esi
+     594:	c1 e6 04             	shl    $0x4,%esi
+     597:	8d 1c 31             	lea    (%ecx,%esi,1),%ebx
+     59a:	89 f1                	mov    %esi,%ecx
+     59c:	31 f6                	xor    %esi,%esi
+     59e:	0f ad d0             	shrd   %cl,%edx,%eax
+     5a1:	d3 ea                	shr    %cl,%edx
+     5a3:	f6 c1 20             	test   $0x20,%cl
+     5a6:	0f 45 c2             	cmovne %edx,%eax
+     5a9:	0f 45 d6             	cmovne %esi,%edx
+    b = !(a & 0x00000000000000ffULL) << 3; n += b; a >>= b;
+     5ac:	0f b6 c8             	movzbl %al,%ecx
+     5af:	83 c9 00             	or     $0x0,%ecx
+     5b2:	0f 94 c1             	sete   %cl
+     5b5:	31 f6                	xor    %esi,%esi
+     5b7:	0f b6 c9             	movzbl %cl,%ecx
+     5ba:	c1 e1 03             	shl    $0x3,%ecx
+     5bd:	0f ad d0             	shrd   %cl,%edx,%eax
+     5c0:	01 cb                	add    %ecx,%ebx
+     5c2:	d3 ea                	shr    %cl,%edx
+     5c4:	f6 c1 20             	test   $0x20,%cl
+     5c7:	0f 45 c2             	cmovne %edx,%eax
+     5ca:	0f 45 d6             	cmovne %esi,%edx
+    b = !(a & 0x000000000000000fULL) << 2; n += b; a >>= b;
+     5cd:	89 c1                	mov    %eax,%ecx
+     5cf:	83 e1 0f             	and    $0xf,%ecx
+     5d2:	83 c9 00             	or     $0x0,%ecx
+     5d5:	0f 94 c1             	sete   %cl
+     5d8:	31 f6                	xor    %esi,%esi
+     5da:	0f b6 c9             	movzbl %cl,%ecx
+     5dd:	c1 e1 02             	shl    $0x2,%ecx
+     5e0:	0f ad d0             	shrd   %cl,%edx,%eax
+     5e3:	01 cb                	add    %ecx,%ebx
+     5e5:	d3 ea                	shr    %cl,%edx
+     5e7:	f6 c1 20             	test   $0x20,%cl
+     5ea:	0f 45 c2             	cmovne %edx,%eax
+     5ed:	0f 45 d6             	cmovne %esi,%edx
+    b = !(a & 0x0000000000000003ULL) << 1; n += b; a >>= b;
+     5f0:	89 c1                	mov    %eax,%ecx
+     5f2:	83 e1 03             	and    $0x3,%ecx
+     5f5:	83 c9 00             	or     $0x0,%ecx
+     5f8:	0f 94 c1             	sete   %cl
+     5fb:	0f b6 c9             	movzbl %cl,%ecx
+     5fe:	01 c9                	add    %ecx,%ecx
+     600:	0f ad d0             	shrd   %cl,%edx,%eax
+     603:	d3 ea                	shr    %cl,%edx
+     605:	f6 c1 20             	test   $0x20,%cl
+     608:	0f 45 c2             	cmovne %edx,%eax
+     60b:	01 cb                	add    %ecx,%ebx
+    return n + !(a & 0x0000000000000001ULL);
+     60d:	f7 d0                	not    %eax
+     60f:	83 e0 01             	and    $0x1,%eax
+     612:	01 d8                	add    %ebx,%eax
+}
+     614:	5b                   	pop    %ebx
+     615:	5e                   	pop    %esi
+     616:	5d                   	pop    %ebp
+     617:	c3                   	ret
+     618:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     61f:	90                   	nop
+
+00000620 <__divmoddi4>:
+{
+     620:	55                   	push   %ebp
+     621:	89 e5                	mov    %esp,%ebp
+     623:	57                   	push   %edi
+     624:	56                   	push   %esi
+     625:	53                   	push   %ebx
+     626:	8b 45 08             	mov    0x8(%ebp),%eax
+     629:	8b 55 0c             	mov    0xc(%ebp),%edx
+     62c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     62f:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     632:	8b 75 18             	mov    0x18(%ebp),%esi
+    if (b > a)                                  // divisor > numerator?
+     635:	39 d8                	cmp    %ebx,%eax
+     637:	89 d7                	mov    %edx,%edi
+     639:	19 cf                	sbb    %ecx,%edi
+     63b:	72 13                	jb     650 <__divmoddi4+0x30>
+     63d:	89 75 10             	mov    %esi,0x10(%ebp)
+     640:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     643:	89 4d 0c             	mov    %ecx,0xc(%ebp)
+}
+     646:	5b                   	pop    %ebx
+     647:	5e                   	pop    %esi
+     648:	5f                   	pop    %edi
+     649:	5d                   	pop    %ebp
+     64a:	e9 c1 fc ff ff       	jmp    310 <__divmoddi4.part.0>
+     64f:	90                   	nop
+        if (c) *c = a;                          // remainder = numerator
+     650:	85 f6                	test   %esi,%esi
+     652:	74 05                	je     659 <__divmoddi4+0x39>
+     654:	89 06                	mov    %eax,(%esi)
+     656:	89 56 04             	mov    %edx,0x4(%esi)
+}
+     659:	5b                   	pop    %ebx
+     65a:	31 c0                	xor    %eax,%eax
+     65c:	5e                   	pop    %esi
+     65d:	31 d2                	xor    %edx,%edx
+     65f:	5f                   	pop    %edi
+     660:	5d                   	pop    %ebp
+     661:	c3                   	ret
+     662:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     669:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000670 <__divdi3>:
+
+// Return the quotient of the signed division of a and b.
+arith64_s64 __divdi3(arith64_s64 a, arith64_s64 b)
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	57                   	push   %edi
+     674:	56                   	push   %esi
+     675:	53                   	push   %ebx
+     676:	83 ec 1c             	sub    $0x1c,%esp
+     679:	8b 55 0c             	mov    0xc(%ebp),%edx
+     67c:	8b 45 08             	mov    0x8(%ebp),%eax
+     67f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     682:	8b 55 14             	mov    0x14(%ebp),%edx
+     685:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     688:	8b 45 10             	mov    0x10(%ebp),%eax
+    arith64_u64 q = __divmoddi4(arith64_abs(a), arith64_abs(b), (void *)0);
+     68b:	89 d3                	mov    %edx,%ebx
+{
+     68d:	89 d7                	mov    %edx,%edi
+     68f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    arith64_u64 q = __divmoddi4(arith64_abs(a), arith64_abs(b), (void *)0);
+     692:	31 d2                	xor    %edx,%edx
+     694:	c1 eb 1f             	shr    $0x1f,%ebx
+{
+     697:	89 c6                	mov    %eax,%esi
+     699:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    arith64_u64 q = __divmoddi4(arith64_abs(a), arith64_abs(b), (void *)0);
+     69c:	89 d9                	mov    %ebx,%ecx
+     69e:	89 d8                	mov    %ebx,%eax
+     6a0:	89 d3                	mov    %edx,%ebx
+     6a2:	f7 d9                	neg    %ecx
+     6a4:	83 d3 00             	adc    $0x0,%ebx
+     6a7:	31 f1                	xor    %esi,%ecx
+     6a9:	f7 db                	neg    %ebx
+     6ab:	31 fb                	xor    %edi,%ebx
+     6ad:	01 c1                	add    %eax,%ecx
+     6af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     6b2:	11 d3                	adc    %edx,%ebx
+     6b4:	89 ce                	mov    %ecx,%esi
+     6b6:	89 df                	mov    %ebx,%edi
+     6b8:	c1 e8 1f             	shr    $0x1f,%eax
+     6bb:	31 db                	xor    %ebx,%ebx
+     6bd:	89 c1                	mov    %eax,%ecx
+     6bf:	89 da                	mov    %ebx,%edx
+     6c1:	f7 d8                	neg    %eax
+     6c3:	83 d2 00             	adc    $0x0,%edx
+     6c6:	33 45 e0             	xor    -0x20(%ebp),%eax
+     6c9:	f7 da                	neg    %edx
+     6cb:	33 55 e4             	xor    -0x1c(%ebp),%edx
+     6ce:	01 c8                	add    %ecx,%eax
+     6d0:	11 da                	adc    %ebx,%edx
+    if (b > a)                                  // divisor > numerator?
+     6d2:	89 fb                	mov    %edi,%ebx
+     6d4:	39 f0                	cmp    %esi,%eax
+     6d6:	89 d7                	mov    %edx,%edi
+     6d8:	19 df                	sbb    %ebx,%edi
+     6da:	72 44                	jb     720 <__divdi3+0xb0>
+     6dc:	83 ec 04             	sub    $0x4,%esp
+     6df:	6a 00                	push   $0x0
+     6e1:	53                   	push   %ebx
+     6e2:	56                   	push   %esi
+     6e3:	e8 28 fc ff ff       	call   310 <__divmoddi4.part.0>
+     6e8:	83 c4 10             	add    $0x10,%esp
+     6eb:	89 c6                	mov    %eax,%esi
+     6ed:	89 d7                	mov    %edx,%edi
+    return arith64_neg(q, a^b); // negate q if a and b signs are different
+     6ef:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     6f2:	33 55 e4             	xor    -0x1c(%ebp),%edx
+     6f5:	31 db                	xor    %ebx,%ebx
+     6f7:	89 d1                	mov    %edx,%ecx
+     6f9:	89 da                	mov    %ebx,%edx
+     6fb:	c1 e9 1f             	shr    $0x1f,%ecx
+     6fe:	89 c8                	mov    %ecx,%eax
+     700:	f7 d8                	neg    %eax
+     702:	83 d2 00             	adc    $0x0,%edx
+     705:	31 f0                	xor    %esi,%eax
+     707:	f7 da                	neg    %edx
+     709:	31 fa                	xor    %edi,%edx
+     70b:	01 c8                	add    %ecx,%eax
+     70d:	11 da                	adc    %ebx,%edx
+}
+     70f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     712:	5b                   	pop    %ebx
+     713:	5e                   	pop    %esi
+     714:	5f                   	pop    %edi
+     715:	5d                   	pop    %ebp
+     716:	c3                   	ret
+     717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71e:	66 90                	xchg   %ax,%ax
+     720:	31 f6                	xor    %esi,%esi
+     722:	31 ff                	xor    %edi,%edi
+     724:	eb c9                	jmp    6ef <__divdi3+0x7f>
+     726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000730 <__ffsdi2>:
+
+// Return the index of the least significant 1-bit in a, or the value zero if a
+// is zero. The least significant bit is index one.
+int __ffsdi2(arith64_u64 a)
+{
+     730:	55                   	push   %ebp
+     731:	89 e5                	mov    %esp,%ebp
+     733:	53                   	push   %ebx
+     734:	83 ec 04             	sub    $0x4,%esp
+     737:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     73a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    return a ? __ctzdi2(a) + 1 : 0;
+     73d:	89 da                	mov    %ebx,%edx
+     73f:	09 ca                	or     %ecx,%edx
+     741:	74 1d                	je     760 <__ffsdi2+0x30>
+     743:	83 ec 08             	sub    $0x8,%esp
+     746:	53                   	push   %ebx
+     747:	51                   	push   %ecx
+     748:	e8 13 fe ff ff       	call   560 <__ctzdi2>
+}
+     74d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return a ? __ctzdi2(a) + 1 : 0;
+     750:	83 c4 10             	add    $0x10,%esp
+}
+     753:	c9                   	leave
+    return a ? __ctzdi2(a) + 1 : 0;
+     754:	83 c0 01             	add    $0x1,%eax
+}
+     757:	c3                   	ret
+     758:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     75f:	90                   	nop
+     760:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     763:	31 c0                	xor    %eax,%eax
+     765:	c9                   	leave
+     766:	c3                   	ret
+     767:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     76e:	66 90                	xchg   %ax,%ax
+
+00000770 <__lshrdi3>:
+
+// Return the result of logically shifting a right by b bits.
+arith64_u64 __lshrdi3(arith64_u64 a, int b)
+{
+     770:	55                   	push   %ebp
+     771:	89 e5                	mov    %esp,%ebp
+     773:	56                   	push   %esi
+     774:	53                   	push   %ebx
+     775:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     778:	8b 45 08             	mov    0x8(%ebp),%eax
+     77b:	8b 55 0c             	mov    0xc(%ebp),%edx
+    arith64_word w = {.u64 = a};
+
+    b &= 63;
+     77e:	89 cb                	mov    %ecx,%ebx
+     780:	83 e3 3f             	and    $0x3f,%ebx
+
+    if (b >= 32)
+     783:	83 e1 20             	and    $0x20,%ecx
+     786:	74 10                	je     798 <__lshrdi3+0x28>
+    } else if (b)
+    {
+        w.u32.lo = (w.u32.hi << (32 - b)) | (w.u32.lo >> b);
+        w.u32.hi >>= b;
+    }
+    return w.u64;
+     788:	89 d0                	mov    %edx,%eax
+        w.u32.lo = w.u32.hi >> (b - 32);
+     78a:	8d 4b e0             	lea    -0x20(%ebx),%ecx
+    return w.u64;
+     78d:	31 d2                	xor    %edx,%edx
+     78f:	d3 e8                	shr    %cl,%eax
+}
+     791:	5b                   	pop    %ebx
+     792:	5e                   	pop    %esi
+     793:	5d                   	pop    %ebp
+     794:	c3                   	ret
+     795:	8d 76 00             	lea    0x0(%esi),%esi
+    } else if (b)
+     798:	85 db                	test   %ebx,%ebx
+     79a:	74 f5                	je     791 <__lshrdi3+0x21>
+        w.u32.lo = (w.u32.hi << (32 - b)) | (w.u32.lo >> b);
+     79c:	b9 20 00 00 00       	mov    $0x20,%ecx
+     7a1:	89 d6                	mov    %edx,%esi
+     7a3:	29 d9                	sub    %ebx,%ecx
+     7a5:	d3 e6                	shl    %cl,%esi
+     7a7:	89 d9                	mov    %ebx,%ecx
+}
+     7a9:	5b                   	pop    %ebx
+        w.u32.lo = (w.u32.hi << (32 - b)) | (w.u32.lo >> b);
+     7aa:	d3 e8                	shr    %cl,%eax
+    return w.u64;
+     7ac:	d3 ea                	shr    %cl,%edx
+     7ae:	09 f0                	or     %esi,%eax
+}
+     7b0:	5e                   	pop    %esi
+     7b1:	5d                   	pop    %ebp
+     7b2:	c3                   	ret
+     7b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007c0 <__moddi3>:
+
+// Return the remainder of the signed division of a and b.
+arith64_s64 __moddi3(arith64_s64 a, arith64_s64 b)
+{
+     7c0:	55                   	push   %ebp
+    arith64_u64 r;
+    __divmoddi4(arith64_abs(a), arith64_abs(b), &r);
+     7c1:	31 d2                	xor    %edx,%edx
+{
+     7c3:	89 e5                	mov    %esp,%ebp
+     7c5:	57                   	push   %edi
+     7c6:	56                   	push   %esi
+     7c7:	53                   	push   %ebx
+    __divmoddi4(arith64_abs(a), arith64_abs(b), &r);
+     7c8:	89 d3                	mov    %edx,%ebx
+{
+     7ca:	83 ec 2c             	sub    $0x2c,%esp
+    __divmoddi4(arith64_abs(a), arith64_abs(b), &r);
+     7cd:	8b 45 14             	mov    0x14(%ebp),%eax
+     7d0:	c1 e8 1f             	shr    $0x1f,%eax
+     7d3:	89 c1                	mov    %eax,%ecx
+     7d5:	f7 d9                	neg    %ecx
+     7d7:	83 d3 00             	adc    $0x0,%ebx
+     7da:	33 4d 10             	xor    0x10(%ebp),%ecx
+     7dd:	f7 db                	neg    %ebx
+     7df:	33 5d 14             	xor    0x14(%ebp),%ebx
+     7e2:	01 c1                	add    %eax,%ecx
+     7e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+     7e7:	11 d3                	adc    %edx,%ebx
+     7e9:	31 ff                	xor    %edi,%edi
+     7eb:	c1 e8 1f             	shr    $0x1f,%eax
+     7ee:	89 fa                	mov    %edi,%edx
+     7f0:	89 c6                	mov    %eax,%esi
+     7f2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     7f5:	f7 d8                	neg    %eax
+     7f7:	83 d2 00             	adc    $0x0,%edx
+     7fa:	33 45 08             	xor    0x8(%ebp),%eax
+     7fd:	f7 da                	neg    %edx
+     7ff:	33 55 0c             	xor    0xc(%ebp),%edx
+     802:	01 f0                	add    %esi,%eax
+     804:	11 fa                	adc    %edi,%edx
+    if (b > a)                                  // divisor > numerator?
+     806:	39 c8                	cmp    %ecx,%eax
+     808:	89 d7                	mov    %edx,%edi
+     80a:	19 df                	sbb    %ebx,%edi
+     80c:	72 17                	jb     825 <__moddi3+0x65>
+     80e:	83 ec 04             	sub    $0x4,%esp
+     811:	8d 75 e0             	lea    -0x20(%ebp),%esi
+     814:	56                   	push   %esi
+     815:	53                   	push   %ebx
+     816:	51                   	push   %ecx
+     817:	e8 f4 fa ff ff       	call   310 <__divmoddi4.part.0>
+    return arith64_neg(r, a); // negate remainder if numerator is negative
+     81c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     81f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     822:	83 c4 10             	add    $0x10,%esp
+     825:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     828:	31 db                	xor    %ebx,%ebx
+     82a:	89 df                	mov    %ebx,%edi
+     82c:	89 ce                	mov    %ecx,%esi
+     82e:	f7 de                	neg    %esi
+     830:	83 d7 00             	adc    $0x0,%edi
+     833:	31 c6                	xor    %eax,%esi
+     835:	f7 df                	neg    %edi
+     837:	89 f0                	mov    %esi,%eax
+     839:	31 d7                	xor    %edx,%edi
+     83b:	01 c8                	add    %ecx,%eax
+     83d:	89 fa                	mov    %edi,%edx
+     83f:	11 da                	adc    %ebx,%edx
+}
+     841:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     844:	5b                   	pop    %ebx
+     845:	5e                   	pop    %esi
+     846:	5f                   	pop    %edi
+     847:	5d                   	pop    %ebp
+     848:	c3                   	ret
+     849:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000850 <__popcountsi2>:
+
+// Return the number of bits set in a.
+int __popcountsi2(arith64_u32 a)
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	8b 45 08             	mov    0x8(%ebp),%eax
+    a = ((a >> 2) & 0x33333333) + (a & 0x33333333);
+    a = (a + (a >> 4)) & 0x0F0F0F0F;
+    a = (a + (a >> 16));
+    // add the bytes, return bottom 6 bits
+    return (a + (a >> 8)) & 63;
+}
+     856:	5d                   	pop    %ebp
+    a = a - ((a >> 1) & 0x55555555);
+     857:	89 c2                	mov    %eax,%edx
+     859:	d1 ea                	shr    %edx
+     85b:	81 e2 55 55 55 55    	and    $0x55555555,%edx
+     861:	29 d0                	sub    %edx,%eax
+    a = ((a >> 2) & 0x33333333) + (a & 0x33333333);
+     863:	89 c2                	mov    %eax,%edx
+     865:	25 33 33 33 33       	and    $0x33333333,%eax
+     86a:	c1 ea 02             	shr    $0x2,%edx
+     86d:	81 e2 33 33 33 33    	and    $0x33333333,%edx
+     873:	01 c2                	add    %eax,%edx
+    a = (a + (a >> 4)) & 0x0F0F0F0F;
+     875:	89 d0                	mov    %edx,%eax
+     877:	c1 e8 04             	shr    $0x4,%eax
+     87a:	01 d0                	add    %edx,%eax
+     87c:	25 0f 0f 0f 0f       	and    $0xf0f0f0f,%eax
+    a = (a + (a >> 16));
+     881:	89 c2                	mov    %eax,%edx
+     883:	c1 ea 10             	shr    $0x10,%edx
+     886:	01 c2                	add    %eax,%edx
+    return (a + (a >> 8)) & 63;
+     888:	89 d0                	mov    %edx,%eax
+     88a:	c1 e8 08             	shr    $0x8,%eax
+     88d:	01 d0                	add    %edx,%eax
+     88f:	83 e0 3f             	and    $0x3f,%eax
+}
+     892:	c3                   	ret
+     893:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     89a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008a0 <__popcountdi2>:
+
+// Return the number of bits set in a.
+int __popcountdi2(arith64_u64 a)
+{
+     8a0:	55                   	push   %ebp
+     8a1:	89 e5                	mov    %esp,%ebp
+     8a3:	57                   	push   %edi
+     8a4:	56                   	push   %esi
+     8a5:	53                   	push   %ebx
+     8a6:	83 ec 24             	sub    $0x24,%esp
+     8a9:	8b 45 08             	mov    0x8(%ebp),%eax
+     8ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+    // collect sums into two low bytes
+    a = a - ((a >> 1) & 0x5555555555555555ULL);
+     8af:	89 c1                	mov    %eax,%ecx
+     8b1:	89 d3                	mov    %edx,%ebx
+     8b3:	0f ac d1 01          	shrd   $0x1,%edx,%ecx
+     8b7:	d1 eb                	shr    %ebx
+     8b9:	89 cf                	mov    %ecx,%edi
+     8bb:	81 e7 55 55 55 55    	and    $0x55555555,%edi
+     8c1:	89 7d e0             	mov    %edi,-0x20(%ebp)
+     8c4:	89 df                	mov    %ebx,%edi
+     8c6:	81 e7 55 55 55 55    	and    $0x55555555,%edi
+     8cc:	2b 45 e0             	sub    -0x20(%ebp),%eax
+     8cf:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    a = ((a >> 2) & 0x3333333333333333ULL) + (a & 0x3333333333333333ULL);
+     8d2:	89 c1                	mov    %eax,%ecx
+    a = a - ((a >> 1) & 0x5555555555555555ULL);
+     8d4:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+    a = ((a >> 2) & 0x3333333333333333ULL) + (a & 0x3333333333333333ULL);
+     8d7:	0f ac d1 02          	shrd   $0x2,%edx,%ecx
+     8db:	89 d3                	mov    %edx,%ebx
+     8dd:	89 ce                	mov    %ecx,%esi
+     8df:	c1 eb 02             	shr    $0x2,%ebx
+     8e2:	81 e6 33 33 33 33    	and    $0x33333333,%esi
+     8e8:	89 df                	mov    %ebx,%edi
+     8ea:	89 75 d8             	mov    %esi,-0x28(%ebp)
+     8ed:	89 c6                	mov    %eax,%esi
+     8ef:	89 d0                	mov    %edx,%eax
+     8f1:	81 e7 33 33 33 33    	and    $0x33333333,%edi
+     8f7:	81 e6 33 33 33 33    	and    $0x33333333,%esi
+     8fd:	25 33 33 33 33       	and    $0x33333333,%eax
+     902:	89 7d dc             	mov    %edi,-0x24(%ebp)
+     905:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     908:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     90b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     90e:	89 75 d0             	mov    %esi,-0x30(%ebp)
+     911:	03 45 d0             	add    -0x30(%ebp),%eax
+    a = (a + (a >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+     914:	89 c1                	mov    %eax,%ecx
+    a = ((a >> 2) & 0x3333333333333333ULL) + (a & 0x3333333333333333ULL);
+     916:	13 55 d4             	adc    -0x2c(%ebp),%edx
+    a = (a + (a >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+     919:	89 d3                	mov    %edx,%ebx
+     91b:	0f ac d1 04          	shrd   $0x4,%edx,%ecx
+     91f:	c1 eb 04             	shr    $0x4,%ebx
+     922:	01 c1                	add    %eax,%ecx
+     924:	89 c8                	mov    %ecx,%eax
+     926:	11 d3                	adc    %edx,%ebx
+     928:	25 0f 0f 0f 0f       	and    $0xf0f0f0f,%eax
+     92d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     930:	89 d8                	mov    %ebx,%eax
+     932:	25 0f 0f 0f 0f       	and    $0xf0f0f0f,%eax
+     937:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    a = (a + (a >> 32));
+     93a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     93d:	89 d0                	mov    %edx,%eax
+     93f:	31 d2                	xor    %edx,%edx
+     941:	03 45 e8             	add    -0x18(%ebp),%eax
+     944:	13 55 ec             	adc    -0x14(%ebp),%edx
+    a = (a + (a >> 16));
+     947:	89 c1                	mov    %eax,%ecx
+     949:	89 d3                	mov    %edx,%ebx
+     94b:	0f ac d1 10          	shrd   $0x10,%edx,%ecx
+     94f:	c1 eb 10             	shr    $0x10,%ebx
+     952:	01 c1                	add    %eax,%ecx
+     954:	11 d3                	adc    %edx,%ebx
+    // add the bytes, return bottom 7 bits
+    return (a + (a >> 8)) & 127;
+     956:	89 c8                	mov    %ecx,%eax
+}
+     958:	83 c4 24             	add    $0x24,%esp
+    return (a + (a >> 8)) & 127;
+     95b:	0f ac d8 08          	shrd   $0x8,%ebx,%eax
+}
+     95f:	5b                   	pop    %ebx
+     960:	5e                   	pop    %esi
+    return (a + (a >> 8)) & 127;
+     961:	01 c8                	add    %ecx,%eax
+}
+     963:	5f                   	pop    %edi
+     964:	5d                   	pop    %ebp
+    return (a + (a >> 8)) & 127;
+     965:	83 e0 7f             	and    $0x7f,%eax
+}
+     968:	c3                   	ret
+     969:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000970 <__udivdi3>:
+
+// Return the quotient of the unsigned division of a and b.
+arith64_u64 __udivdi3(arith64_u64 a, arith64_u64 b)
+{
+     970:	55                   	push   %ebp
+     971:	89 e5                	mov    %esp,%ebp
+     973:	56                   	push   %esi
+     974:	53                   	push   %ebx
+     975:	8b 45 08             	mov    0x8(%ebp),%eax
+     978:	8b 55 0c             	mov    0xc(%ebp),%edx
+     97b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+     97e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+    if (b > a)                                  // divisor > numerator?
+     981:	39 d8                	cmp    %ebx,%eax
+     983:	89 d6                	mov    %edx,%esi
+     985:	19 ce                	sbb    %ecx,%esi
+     987:	72 17                	jb     9a0 <__udivdi3+0x30>
+     989:	c7 45 10 00 00 00 00 	movl   $0x0,0x10(%ebp)
+     990:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     993:	89 4d 0c             	mov    %ecx,0xc(%ebp)
+    return __divmoddi4(a, b, (void *)0);
+}
+     996:	5b                   	pop    %ebx
+     997:	5e                   	pop    %esi
+     998:	5d                   	pop    %ebp
+     999:	e9 72 f9 ff ff       	jmp    310 <__divmoddi4.part.0>
+     99e:	66 90                	xchg   %ax,%ax
+     9a0:	5b                   	pop    %ebx
+     9a1:	31 c0                	xor    %eax,%eax
+     9a3:	31 d2                	xor    %edx,%edx
+     9a5:	5e                   	pop    %esi
+     9a6:	5d                   	pop    %ebp
+     9a7:	c3                   	ret
+     9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9af:	90                   	nop
+
+000009b0 <__umoddi3>:
+
+// Return the remainder of the unsigned division of a and b.
+arith64_u64 __umoddi3(arith64_u64 a, arith64_u64 b)
+{
+     9b0:	55                   	push   %ebp
+     9b1:	89 e5                	mov    %esp,%ebp
+     9b3:	56                   	push   %esi
+     9b4:	53                   	push   %ebx
+     9b5:	83 ec 10             	sub    $0x10,%esp
+     9b8:	8b 45 08             	mov    0x8(%ebp),%eax
+     9bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+     9be:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     9c1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+    if (b > a)                                  // divisor > numerator?
+     9c4:	89 d6                	mov    %edx,%esi
+     9c6:	39 c8                	cmp    %ecx,%eax
+     9c8:	19 de                	sbb    %ebx,%esi
+     9ca:	72 17                	jb     9e3 <__umoddi3+0x33>
+     9cc:	83 ec 04             	sub    $0x4,%esp
+     9cf:	8d 75 f0             	lea    -0x10(%ebp),%esi
+     9d2:	56                   	push   %esi
+     9d3:	53                   	push   %ebx
+     9d4:	51                   	push   %ecx
+     9d5:	e8 36 f9 ff ff       	call   310 <__divmoddi4.part.0>
+    arith64_u64 r;
+    __divmoddi4(a, b, &r);
+    return r;
+     9da:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     9dd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     9e0:	83 c4 10             	add    $0x10,%esp
+}
+     9e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9e6:	5b                   	pop    %ebx
+     9e7:	5e                   	pop    %esi
+     9e8:	5d                   	pop    %ebp
+     9e9:	c3                   	ret
+     9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009f0 <spawn>:
+int spawn(int tickets, function_type function) {
+     9f0:	55                   	push   %ebp
+     9f1:	89 e5                	mov    %esp,%ebp
+     9f3:	83 ec 18             	sub    $0x18,%esp
+    int pid = fork();
+     9f6:	e8 40 0f 00 00       	call   193b <fork>
+    if (pid == 0) {
+     9fb:	85 c0                	test   %eax,%eax
+     9fd:	74 21                	je     a20 <spawn+0x30>
+    } else if (pid != -1) {
+     9ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+     a02:	74 02                	je     a06 <spawn+0x16>
+}
+     a04:	c9                   	leave
+     a05:	c3                   	ret
+        printf(2, "error in fork\n");
+     a06:	83 ec 08             	sub    $0x8,%esp
+     a09:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     a0c:	68 20 1e 00 00       	push   $0x1e20
+     a11:	6a 02                	push   $0x2
+     a13:	e8 d8 10 00 00       	call   1af0 <printf>
+        return -1;
+     a18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a1b:	83 c4 10             	add    $0x10,%esp
+}
+     a1e:	c9                   	leave
+     a1f:	c3                   	ret
+        settickets(tickets);
+     a20:	83 ec 0c             	sub    $0xc,%esp
+     a23:	ff 75 08             	push   0x8(%ebp)
+     a26:	e8 c8 0f 00 00       	call   19f3 <settickets>
+        yield();
+     a2b:	e8 d3 0f 00 00       	call   1a03 <yield>
+        (*function)();
+     a30:	ff 55 0c             	call   *0xc(%ebp)
+        exit();
+     a33:	e8 0b 0f 00 00       	call   1943 <exit>
+     a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a3f:	90                   	nop
+
+00000a40 <find_index_of_pid>:
+int find_index_of_pid(int *list, int list_size, int pid) {
+     a40:	55                   	push   %ebp
+     a41:	89 e5                	mov    %esp,%ebp
+     a43:	53                   	push   %ebx
+     a44:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a47:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     a4a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+    for (i = 0; i < list_size; ++i) {
+     a4d:	85 d2                	test   %edx,%edx
+     a4f:	7e 1f                	jle    a70 <find_index_of_pid+0x30>
+     a51:	31 c0                	xor    %eax,%eax
+     a53:	eb 0a                	jmp    a5f <find_index_of_pid+0x1f>
+     a55:	8d 76 00             	lea    0x0(%esi),%esi
+     a58:	83 c0 01             	add    $0x1,%eax
+     a5b:	39 c2                	cmp    %eax,%edx
+     a5d:	74 11                	je     a70 <find_index_of_pid+0x30>
+        if (list[i] == pid)
+     a5f:	39 1c 81             	cmp    %ebx,(%ecx,%eax,4)
+     a62:	75 f4                	jne    a58 <find_index_of_pid+0x18>
+}
+     a64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a67:	c9                   	leave
+     a68:	c3                   	ret
+     a69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a70:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return -1;
+     a73:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     a78:	c9                   	leave
+     a79:	c3                   	ret
+     a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a80 <wait_for_ticket_counts>:
+void wait_for_ticket_counts(int num_children, int *pids, int *tickets) {
+     a80:	55                   	push   %ebp
+     a81:	89 e5                	mov    %esp,%ebp
+     a83:	57                   	push   %edi
+     a84:	56                   	push   %esi
+     a85:	53                   	push   %ebx
+        getprocessesinfo(&info);
+     a86:	8d 9d e4 fc ff ff    	lea    -0x31c(%ebp),%ebx
+void wait_for_ticket_counts(int num_children, int *pids, int *tickets) {
+     a8c:	81 ec 38 03 00 00    	sub    $0x338,%esp
+     a92:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a95:	8b 7d 08             	mov    0x8(%ebp),%edi
+     a98:	89 85 d0 fc ff ff    	mov    %eax,-0x330(%ebp)
+     a9e:	8b 45 10             	mov    0x10(%ebp),%eax
+     aa1:	89 bd d4 fc ff ff    	mov    %edi,-0x32c(%ebp)
+     aa7:	89 85 cc fc ff ff    	mov    %eax,-0x334(%ebp)
+    settickets(NOT_AS_LARGE_TICKET_COUNT);
+     aad:	68 10 27 00 00       	push   $0x2710
+     ab2:	e8 3c 0f 00 00       	call   19f3 <settickets>
+        yield();
+     ab7:	e8 47 0f 00 00       	call   1a03 <yield>
+        getprocessesinfo(&info);
+     abc:	89 1c 24             	mov    %ebx,(%esp)
+     abf:	e8 37 0f 00 00       	call   19fb <getprocessesinfo>
+        for (i = 0; i < num_children; ++i) {
+     ac4:	83 c4 10             	add    $0x10,%esp
+     ac7:	85 ff                	test   %edi,%edi
+     ac9:	0f 8e 98 00 00 00    	jle    b67 <wait_for_ticket_counts+0xe7>
+     acf:	c7 85 c8 fc ff ff 64 	movl   $0x64,-0x338(%ebp)
+     ad6:	00 00 00 
+     ad9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+            int index = find_index_of_pid(info.pids, info.num_processes, pids[i]);
+     ae0:	8b 8d e4 fc ff ff    	mov    -0x31c(%ebp),%ecx
+        int done = 1;
+     ae6:	bf 01 00 00 00       	mov    $0x1,%edi
+        for (i = 0; i < num_children; ++i) {
+     aeb:	31 f6                	xor    %esi,%esi
+     aed:	8d 76 00             	lea    0x0(%esi),%esi
+            int index = find_index_of_pid(info.pids, info.num_processes, pids[i]);
+     af0:	8b 85 d0 fc ff ff    	mov    -0x330(%ebp),%eax
+     af6:	8b 14 b0             	mov    (%eax,%esi,4),%edx
+    for (i = 0; i < list_size; ++i) {
+     af9:	85 c9                	test   %ecx,%ecx
+     afb:	7e 63                	jle    b60 <wait_for_ticket_counts+0xe0>
+     afd:	31 c0                	xor    %eax,%eax
+     aff:	eb 0e                	jmp    b0f <wait_for_ticket_counts+0x8f>
+     b01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b08:	83 c0 01             	add    $0x1,%eax
+     b0b:	39 c1                	cmp    %eax,%ecx
+     b0d:	74 51                	je     b60 <wait_for_ticket_counts+0xe0>
+        if (list[i] == pid)
+     b0f:	3b 54 83 04          	cmp    0x4(%ebx,%eax,4),%edx
+     b13:	75 f3                	jne    b08 <wait_for_ticket_counts+0x88>
+            if (info.tickets[index] != tickets[i]) done = 0;
+     b15:	8b 95 cc fc ff ff    	mov    -0x334(%ebp),%edx
+     b1b:	8b 14 b2             	mov    (%edx,%esi,4),%edx
+     b1e:	39 94 85 e8 fe ff ff 	cmp    %edx,-0x118(%ebp,%eax,4)
+     b25:	b8 00 00 00 00       	mov    $0x0,%eax
+     b2a:	0f 45 f8             	cmovne %eax,%edi
+        for (i = 0; i < num_children; ++i) {
+     b2d:	83 c6 01             	add    $0x1,%esi
+     b30:	39 b5 d4 fc ff ff    	cmp    %esi,-0x32c(%ebp)
+     b36:	75 b8                	jne    af0 <wait_for_ticket_counts+0x70>
+        if (done)
+     b38:	85 ff                	test   %edi,%edi
+     b3a:	75 2b                	jne    b67 <wait_for_ticket_counts+0xe7>
+    for (yield_count = 0; yield_count < MAX_YIELDS_FOR_SETUP; ++yield_count) {
+     b3c:	83 ad c8 fc ff ff 01 	subl   $0x1,-0x338(%ebp)
+     b43:	74 22                	je     b67 <wait_for_ticket_counts+0xe7>
+        yield();
+     b45:	e8 b9 0e 00 00       	call   1a03 <yield>
+        getprocessesinfo(&info);
+     b4a:	83 ec 0c             	sub    $0xc,%esp
+     b4d:	53                   	push   %ebx
+     b4e:	e8 a8 0e 00 00       	call   19fb <getprocessesinfo>
+     b53:	83 c4 10             	add    $0x10,%esp
+     b56:	eb 88                	jmp    ae0 <wait_for_ticket_counts+0x60>
+     b58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5f:	90                   	nop
+    return -1;
+     b60:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     b65:	eb ae                	jmp    b15 <wait_for_ticket_counts+0x95>
+    settickets(LARGE_TICKET_COUNT);
+     b67:	c7 45 08 a0 86 01 00 	movl   $0x186a0,0x8(%ebp)
+}
+     b6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b71:	5b                   	pop    %ebx
+     b72:	5e                   	pop    %esi
+     b73:	5f                   	pop    %edi
+     b74:	5d                   	pop    %ebp
+    settickets(LARGE_TICKET_COUNT);
+     b75:	e9 79 0e 00 00       	jmp    19f3 <settickets>
+     b7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b80 <check>:
+void check(struct test_case* test, int passed_p, const char *description) {
+     b80:	55                   	push   %ebp
+     b81:	89 e5                	mov    %esp,%ebp
+     b83:	83 ec 08             	sub    $0x8,%esp
+     b86:	8b 45 08             	mov    0x8(%ebp),%eax
+    if (!passed_p) {
+     b89:	8b 55 0c             	mov    0xc(%ebp),%edx
+    test->total_tests++;
+     b8c:	83 40 04 01          	addl   $0x1,0x4(%eax)
+    if (!passed_p) {
+     b90:	85 d2                	test   %edx,%edx
+     b92:	74 0c                	je     ba0 <check+0x20>
+}
+     b94:	c9                   	leave
+     b95:	c3                   	ret
+     b96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b9d:	8d 76 00             	lea    0x0(%esi),%esi
+        test->errors++;
+     ba0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+        printf(1, "*** TEST FAILURE: for scenario '%s': %s\n", test->name, description);
+     ba4:	ff 75 10             	push   0x10(%ebp)
+     ba7:	ff 30                	push   (%eax)
+     ba9:	68 34 1f 00 00       	push   $0x1f34
+     bae:	6a 01                	push   $0x1
+     bb0:	e8 3b 0f 00 00       	call   1af0 <printf>
+}
+     bb5:	83 c4 10             	add    $0x10,%esp
+     bb8:	c9                   	leave
+     bb9:	c3                   	ret
+     bba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000bc0 <execute_and_get_info>:
+        struct processes_info *after) {
+     bc0:	55                   	push   %ebp
+     bc1:	89 e5                	mov    %esp,%ebp
+     bc3:	57                   	push   %edi
+     bc4:	56                   	push   %esi
+     bc5:	53                   	push   %ebx
+     bc6:	83 ec 28             	sub    $0x28,%esp
+     bc9:	8b 7d 08             	mov    0x8(%ebp),%edi
+     bcc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    settickets(LARGE_TICKET_COUNT);
+     bcf:	68 a0 86 01 00       	push   $0x186a0
+     bd4:	e8 1a 0e 00 00       	call   19f3 <settickets>
+    for (i = 0; i < test->num_children; ++i) {
+     bd9:	8b 47 0c             	mov    0xc(%edi),%eax
+     bdc:	83 c4 10             	add    $0x10,%esp
+     bdf:	85 c0                	test   %eax,%eax
+     be1:	7e 45                	jle    c28 <execute_and_get_info+0x68>
+     be3:	31 f6                	xor    %esi,%esi
+     be5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+     be8:	89 f3                	mov    %esi,%ebx
+     bea:	89 fe                	mov    %edi,%esi
+     bec:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     bef:	90                   	nop
+        pids[i] = spawn(test->tickets[i], test->functions[i]);
+     bf0:	8b 84 9e 94 01 00 00 	mov    0x194(%esi,%ebx,4),%eax
+     bf7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     bfa:	8b 44 9e 10          	mov    0x10(%esi,%ebx,4),%eax
+     bfe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    int pid = fork();
+     c01:	e8 35 0d 00 00       	call   193b <fork>
+    if (pid == 0) {
+     c06:	85 c0                	test   %eax,%eax
+     c08:	0f 84 c4 00 00 00    	je     cd2 <execute_and_get_info+0x112>
+    } else if (pid != -1) {
+     c0e:	83 f8 ff             	cmp    $0xffffffff,%eax
+     c11:	0f 84 9e 00 00 00    	je     cb5 <execute_and_get_info+0xf5>
+        pids[i] = spawn(test->tickets[i], test->functions[i]);
+     c17:	89 04 9f             	mov    %eax,(%edi,%ebx,4)
+    for (i = 0; i < test->num_children; ++i) {
+     c1a:	8b 46 0c             	mov    0xc(%esi),%eax
+     c1d:	83 c3 01             	add    $0x1,%ebx
+     c20:	39 d8                	cmp    %ebx,%eax
+     c22:	7f cc                	jg     bf0 <execute_and_get_info+0x30>
+     c24:	89 fb                	mov    %edi,%ebx
+     c26:	89 f7                	mov    %esi,%edi
+    wait_for_ticket_counts(test->num_children, pids, test->tickets);
+     c28:	83 ec 04             	sub    $0x4,%esp
+     c2b:	8d 57 10             	lea    0x10(%edi),%edx
+    for (i = 0; i < test->num_children; ++i) {
+     c2e:	31 f6                	xor    %esi,%esi
+    wait_for_ticket_counts(test->num_children, pids, test->tickets);
+     c30:	52                   	push   %edx
+     c31:	53                   	push   %ebx
+     c32:	50                   	push   %eax
+     c33:	e8 48 fe ff ff       	call   a80 <wait_for_ticket_counts>
+    before->num_processes = after->num_processes = -1;
+     c38:	8b 45 14             	mov    0x14(%ebp),%eax
+     c3b:	c7 00 ff ff ff ff    	movl   $0xffffffff,(%eax)
+     c41:	8b 45 10             	mov    0x10(%ebp),%eax
+     c44:	c7 00 ff ff ff ff    	movl   $0xffffffff,(%eax)
+    sleep(WARMUP_TIME);
+     c4a:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+     c51:	e8 7d 0d 00 00       	call   19d3 <sleep>
+    getprocessesinfo(before);
+     c56:	58                   	pop    %eax
+     c57:	ff 75 10             	push   0x10(%ebp)
+     c5a:	e8 9c 0d 00 00       	call   19fb <getprocessesinfo>
+    sleep(SLEEP_TIME);
+     c5f:	c7 04 24 32 00 00 00 	movl   $0x32,(%esp)
+     c66:	e8 68 0d 00 00       	call   19d3 <sleep>
+    getprocessesinfo(after);
+     c6b:	5a                   	pop    %edx
+     c6c:	ff 75 14             	push   0x14(%ebp)
+     c6f:	e8 87 0d 00 00       	call   19fb <getprocessesinfo>
+    for (i = 0; i < test->num_children; ++i) {
+     c74:	8b 4f 0c             	mov    0xc(%edi),%ecx
+     c77:	83 c4 10             	add    $0x10,%esp
+     c7a:	85 c9                	test   %ecx,%ecx
+     c7c:	7e 2f                	jle    cad <execute_and_get_info+0xed>
+     c7e:	66 90                	xchg   %ax,%ax
+        kill(pids[i]);
+     c80:	83 ec 0c             	sub    $0xc,%esp
+     c83:	ff 34 b3             	push   (%ebx,%esi,4)
+    for (i = 0; i < test->num_children; ++i) {
+     c86:	83 c6 01             	add    $0x1,%esi
+        kill(pids[i]);
+     c89:	e8 e5 0c 00 00       	call   1973 <kill>
+    for (i = 0; i < test->num_children; ++i) {
+     c8e:	8b 47 0c             	mov    0xc(%edi),%eax
+     c91:	83 c4 10             	add    $0x10,%esp
+     c94:	39 f0                	cmp    %esi,%eax
+     c96:	7f e8                	jg     c80 <execute_and_get_info+0xc0>
+    for (i = 0; i < test->num_children; ++i) {
+     c98:	85 c0                	test   %eax,%eax
+     c9a:	7e 11                	jle    cad <execute_and_get_info+0xed>
+     c9c:	31 db                	xor    %ebx,%ebx
+     c9e:	66 90                	xchg   %ax,%ax
+        wait();
+     ca0:	e8 a6 0c 00 00       	call   194b <wait>
+    for (i = 0; i < test->num_children; ++i) {
+     ca5:	83 c3 01             	add    $0x1,%ebx
+     ca8:	39 5f 0c             	cmp    %ebx,0xc(%edi)
+     cab:	7f f3                	jg     ca0 <execute_and_get_info+0xe0>
+}
+     cad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cb0:	5b                   	pop    %ebx
+     cb1:	5e                   	pop    %esi
+     cb2:	5f                   	pop    %edi
+     cb3:	5d                   	pop    %ebp
+     cb4:	c3                   	ret
+        printf(2, "error in fork\n");
+     cb5:	83 ec 08             	sub    $0x8,%esp
+     cb8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     cbb:	68 20 1e 00 00       	push   $0x1e20
+     cc0:	6a 02                	push   $0x2
+     cc2:	e8 29 0e 00 00       	call   1af0 <printf>
+        return -1;
+     cc7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     cca:	83 c4 10             	add    $0x10,%esp
+     ccd:	e9 45 ff ff ff       	jmp    c17 <execute_and_get_info+0x57>
+        settickets(tickets);
+     cd2:	83 ec 0c             	sub    $0xc,%esp
+     cd5:	ff 75 e0             	push   -0x20(%ebp)
+     cd8:	e8 16 0d 00 00       	call   19f3 <settickets>
+        yield();
+     cdd:	e8 21 0d 00 00       	call   1a03 <yield>
+        (*function)();
+     ce2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ce5:	ff d0                	call   *%eax
+        exit();
+     ce7:	e8 57 0c 00 00       	call   1943 <exit>
+     cec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000cf0 <count_ticks>:
+        struct processes_info *after) {
+     cf0:	55                   	push   %ebp
+     cf1:	89 e5                	mov    %esp,%ebp
+     cf3:	57                   	push   %edi
+     cf4:	56                   	push   %esi
+     cf5:	53                   	push   %ebx
+     cf6:	83 ec 1c             	sub    $0x1c,%esp
+    test->total_actual_ticks = 0;
+     cf9:	8b 45 08             	mov    0x8(%ebp),%eax
+        struct processes_info *after) {
+     cfc:	8b 7d 10             	mov    0x10(%ebp),%edi
+    for (i = 0; i < test->num_children; ++i) {
+     cff:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+        struct processes_info *after) {
+     d06:	8b 4d 14             	mov    0x14(%ebp),%ecx
+    test->total_actual_ticks = 0;
+     d09:	c7 80 90 01 00 00 00 	movl   $0x0,0x190(%eax)
+     d10:	00 00 00 
+    for (i = 0; i < test->num_children; ++i) {
+     d13:	8b 40 0c             	mov    0xc(%eax),%eax
+     d16:	85 c0                	test   %eax,%eax
+     d18:	0f 8e ed 00 00 00    	jle    e0b <count_ticks+0x11b>
+     d1e:	66 90                	xchg   %ax,%ax
+        int before_index = find_index_of_pid(before->pids, before->num_processes, pids[i]);
+     d20:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     d23:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d26:	8b 04 90             	mov    (%eax,%edx,4),%eax
+     d29:	8b 17                	mov    (%edi),%edx
+    for (i = 0; i < list_size; ++i) {
+     d2b:	85 d2                	test   %edx,%edx
+     d2d:	0f 8e e5 00 00 00    	jle    e18 <count_ticks+0x128>
+     d33:	31 db                	xor    %ebx,%ebx
+     d35:	eb 14                	jmp    d4b <count_ticks+0x5b>
+     d37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d3e:	66 90                	xchg   %ax,%ax
+     d40:	83 c3 01             	add    $0x1,%ebx
+     d43:	39 da                	cmp    %ebx,%edx
+     d45:	0f 84 cd 00 00 00    	je     e18 <count_ticks+0x128>
+        if (list[i] == pid)
+     d4b:	3b 44 9f 04          	cmp    0x4(%edi,%ebx,4),%eax
+     d4f:	75 ef                	jne    d40 <count_ticks+0x50>
+    test->total_tests++;
+     d51:	8b 75 08             	mov    0x8(%ebp),%esi
+        int after_index = find_index_of_pid(after->pids, after->num_processes, pids[i]);
+     d54:	8b 11                	mov    (%ecx),%edx
+    test->total_tests++;
+     d56:	8b 76 04             	mov    0x4(%esi),%esi
+     d59:	89 75 dc             	mov    %esi,-0x24(%ebp)
+     d5c:	83 c6 01             	add    $0x1,%esi
+     d5f:	89 75 e0             	mov    %esi,-0x20(%ebp)
+    for (i = 0; i < list_size; ++i) {
+     d62:	85 d2                	test   %edx,%edx
+     d64:	0f 8e 1e 01 00 00    	jle    e88 <count_ticks+0x198>
+     d6a:	31 f6                	xor    %esi,%esi
+     d6c:	eb 0d                	jmp    d7b <count_ticks+0x8b>
+     d6e:	66 90                	xchg   %ax,%ax
+     d70:	83 c6 01             	add    $0x1,%esi
+     d73:	39 f2                	cmp    %esi,%edx
+     d75:	0f 84 ad 00 00 00    	je     e28 <count_ticks+0x138>
+        if (list[i] == pid)
+     d7b:	3b 44 b1 04          	cmp    0x4(%ecx,%esi,4),%eax
+     d7f:	75 ef                	jne    d70 <count_ticks+0x80>
+    test->total_tests++;
+     d81:	8b 45 08             	mov    0x8(%ebp),%eax
+     d84:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     d87:	89 50 04             	mov    %edx,0x4(%eax)
+    if (!passed_p) {
+     d8a:	89 d8                	mov    %ebx,%eax
+     d8c:	09 f0                	or     %esi,%eax
+     d8e:	0f 88 9d 00 00 00    	js     e31 <count_ticks+0x141>
+                  test->tickets[i] == before->tickets[before_index] &&
+     d94:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     d97:	8b 45 08             	mov    0x8(%ebp),%eax
+     d9a:	8b 44 90 10          	mov    0x10(%eax,%edx,4),%eax
+    test->total_tests++;
+     d9e:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     da1:	83 c2 02             	add    $0x2,%edx
+            check(test,
+     da4:	3b 84 9f 04 02 00 00 	cmp    0x204(%edi,%ebx,4),%eax
+     dab:	0f 84 bf 00 00 00    	je     e70 <count_ticks+0x180>
+    test->total_tests++;
+     db1:	8b 45 08             	mov    0x8(%ebp),%eax
+     db4:	89 4d 14             	mov    %ecx,0x14(%ebp)
+        test->errors++;
+     db7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+    test->total_tests++;
+     dbb:	89 50 04             	mov    %edx,0x4(%eax)
+        printf(1, "*** TEST FAILURE: for scenario '%s': %s\n", test->name, description);
+     dbe:	68 98 1f 00 00       	push   $0x1f98
+     dc3:	ff 30                	push   (%eax)
+     dc5:	68 34 1f 00 00       	push   $0x1f34
+     dca:	6a 01                	push   $0x1
+     dcc:	e8 1f 0d 00 00       	call   1af0 <printf>
+}
+     dd1:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     dd4:	83 c4 10             	add    $0x10,%esp
+            test->actual_ticks[i] = after->ticks[after_index] - before->ticks[before_index];
+     dd7:	8b 84 b1 04 01 00 00 	mov    0x104(%ecx,%esi,4),%eax
+     dde:	8b 55 08             	mov    0x8(%ebp),%edx
+     de1:	2b 84 9f 04 01 00 00 	sub    0x104(%edi,%ebx,4),%eax
+     de8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+     deb:	89 84 9a 10 01 00 00 	mov    %eax,0x110(%edx,%ebx,4)
+            test->total_actual_ticks += test->actual_ticks[i];
+     df2:	01 82 90 01 00 00    	add    %eax,0x190(%edx)
+    for (i = 0; i < test->num_children; ++i) {
+     df8:	8b 55 08             	mov    0x8(%ebp),%edx
+     dfb:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+     dff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e02:	39 42 0c             	cmp    %eax,0xc(%edx)
+     e05:	0f 8f 15 ff ff ff    	jg     d20 <count_ticks+0x30>
+}
+     e0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e0e:	5b                   	pop    %ebx
+     e0f:	5e                   	pop    %esi
+     e10:	5f                   	pop    %edi
+     e11:	5d                   	pop    %ebp
+     e12:	c3                   	ret
+     e13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e17:	90                   	nop
+    return -1;
+     e18:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+     e1d:	e9 2f ff ff ff       	jmp    d51 <count_ticks+0x61>
+     e22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    test->total_tests++;
+     e28:	8b 45 08             	mov    0x8(%ebp),%eax
+     e2b:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+     e2e:	89 58 04             	mov    %ebx,0x4(%eax)
+        test->errors++;
+     e31:	8b 45 08             	mov    0x8(%ebp),%eax
+     e34:	89 4d 14             	mov    %ecx,0x14(%ebp)
+     e37:	83 40 08 01          	addl   $0x1,0x8(%eax)
+        printf(1, "*** TEST FAILURE: for scenario '%s': %s\n", test->name, description);
+     e3b:	68 60 1f 00 00       	push   $0x1f60
+     e40:	ff 30                	push   (%eax)
+     e42:	68 34 1f 00 00       	push   $0x1f34
+     e47:	6a 01                	push   $0x1
+     e49:	e8 a2 0c 00 00       	call   1af0 <printf>
+            test->actual_ticks[i] = -99999; // obviously bogus count that will fail checks later
+     e4e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     e51:	8b 45 08             	mov    0x8(%ebp),%eax
+     e54:	83 c4 10             	add    $0x10,%esp
+     e57:	c7 84 88 10 01 00 00 	movl   $0xfffe7961,0x110(%eax,%ecx,4)
+     e5e:	61 79 fe ff 
+     e62:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     e65:	eb 91                	jmp    df8 <count_ticks+0x108>
+     e67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e6e:	66 90                	xchg   %ax,%ax
+            check(test,
+     e70:	3b 84 b1 04 02 00 00 	cmp    0x204(%ecx,%esi,4),%eax
+     e77:	0f 85 34 ff ff ff    	jne    db1 <count_ticks+0xc1>
+    test->total_tests++;
+     e7d:	8b 45 08             	mov    0x8(%ebp),%eax
+     e80:	89 50 04             	mov    %edx,0x4(%eax)
+    if (!passed_p) {
+     e83:	e9 4f ff ff ff       	jmp    dd7 <count_ticks+0xe7>
+    test->total_tests++;
+     e88:	8b 45 08             	mov    0x8(%ebp),%eax
+     e8b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     e8e:	89 50 04             	mov    %edx,0x4(%eax)
+    if (!passed_p) {
+     e91:	eb 9e                	jmp    e31 <count_ticks+0x141>
+     e93:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ea0 <dump_test_timings>:
+void dump_test_timings(struct test_case *test) {
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	56                   	push   %esi
+     ea4:	53                   	push   %ebx
+     ea5:	8b 75 08             	mov    0x8(%ebp),%esi
+    printf(1, "-----------------------------------------\n");
+     ea8:	83 ec 08             	sub    $0x8,%esp
+     eab:	68 c8 1f 00 00       	push   $0x1fc8
+     eb0:	6a 01                	push   $0x1
+     eb2:	e8 39 0c 00 00       	call   1af0 <printf>
+    printf(1, "%s expected ticks ratios and observations\n", test->name);
+     eb7:	83 c4 0c             	add    $0xc,%esp
+     eba:	ff 36                	push   (%esi)
+     ebc:	68 f4 1f 00 00       	push   $0x1ff4
+     ec1:	6a 01                	push   $0x1
+     ec3:	e8 28 0c 00 00       	call   1af0 <printf>
+    printf(1, "#\texpect\tobserve\t(description)\n");
+     ec8:	59                   	pop    %ecx
+     ec9:	5b                   	pop    %ebx
+     eca:	68 20 20 00 00       	push   $0x2020
+     ecf:	6a 01                	push   $0x1
+     ed1:	e8 1a 0c 00 00       	call   1af0 <printf>
+    for (i = 0; i < test->num_children; ++i) {
+     ed6:	8b 46 0c             	mov    0xc(%esi),%eax
+     ed9:	83 c4 10             	add    $0x10,%esp
+     edc:	85 c0                	test   %eax,%eax
+     ede:	7e 77                	jle    f57 <dump_test_timings+0xb7>
+     ee0:	31 db                	xor    %ebx,%ebx
+     ee2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        if (test->functions[i] == yield_forever) {
+     ee8:	8b 94 9e 94 01 00 00 	mov    0x194(%esi,%ebx,4),%edx
+            assigned_function = "yield_forever";
+     eef:	b8 2f 1e 00 00       	mov    $0x1e2f,%eax
+        if (test->functions[i] == yield_forever) {
+     ef4:	81 fa a0 00 00 00    	cmp    $0xa0,%edx
+     efa:	74 2d                	je     f29 <dump_test_timings+0x89>
+            assigned_function = "run_forever";
+     efc:	b8 3d 1e 00 00       	mov    $0x1e3d,%eax
+        } else if (test->functions[i] == run_forever) {
+     f01:	81 fa 90 00 00 00    	cmp    $0x90,%edx
+     f07:	74 20                	je     f29 <dump_test_timings+0x89>
+            assigned_function = "iowait_forever";
+     f09:	b8 49 1e 00 00       	mov    $0x1e49,%eax
+        } else if (test->functions[i] == iowait_forever) {
+     f0e:	81 fa c0 00 00 00    	cmp    $0xc0,%edx
+     f14:	74 13                	je     f29 <dump_test_timings+0x89>
+        const char *assigned_function = "(unknown)";
+     f16:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+     f1c:	b8 62 1e 00 00       	mov    $0x1e62,%eax
+     f21:	ba 58 1e 00 00       	mov    $0x1e58,%edx
+     f26:	0f 45 c2             	cmovne %edx,%eax
+        printf(1, "%d\t%d\t%d\t(assigned %d tickets; running %s)\n",
+     f29:	83 ec 04             	sub    $0x4,%esp
+     f2c:	50                   	push   %eax
+     f2d:	ff 74 9e 10          	push   0x10(%esi,%ebx,4)
+     f31:	ff b4 9e 10 01 00 00 	push   0x110(%esi,%ebx,4)
+     f38:	ff b4 9e 90 00 00 00 	push   0x90(%esi,%ebx,4)
+     f3f:	53                   	push   %ebx
+    for (i = 0; i < test->num_children; ++i) {
+     f40:	83 c3 01             	add    $0x1,%ebx
+        printf(1, "%d\t%d\t%d\t(assigned %d tickets; running %s)\n",
+     f43:	68 40 20 00 00       	push   $0x2040
+     f48:	6a 01                	push   $0x1
+     f4a:	e8 a1 0b 00 00       	call   1af0 <printf>
+    for (i = 0; i < test->num_children; ++i) {
+     f4f:	83 c4 20             	add    $0x20,%esp
+     f52:	39 5e 0c             	cmp    %ebx,0xc(%esi)
+     f55:	7f 91                	jg     ee8 <dump_test_timings+0x48>
+    printf(1, "\nNOTE: the 'expect' values above represent the expected\n"
+     f57:	83 ec 08             	sub    $0x8,%esp
+     f5a:	68 6c 20 00 00       	push   $0x206c
+     f5f:	6a 01                	push   $0x1
+     f61:	e8 8a 0b 00 00       	call   1af0 <printf>
+    printf(1, "-----------------------------------------\n");
+     f66:	58                   	pop    %eax
+     f67:	5a                   	pop    %edx
+     f68:	68 c8 1f 00 00       	push   $0x1fc8
+     f6d:	6a 01                	push   $0x1
+     f6f:	e8 7c 0b 00 00       	call   1af0 <printf>
+}
+     f74:	83 c4 10             	add    $0x10,%esp
+     f77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f7a:	5b                   	pop    %ebx
+     f7b:	5e                   	pop    %esi
+     f7c:	5d                   	pop    %ebp
+     f7d:	c3                   	ret
+     f7e:	66 90                	xchg   %ax,%ax
+
+00000f80 <compare_ticks_chi_squared>:
+int compare_ticks_chi_squared(struct test_case *test) {
+     f80:	55                   	push   %ebp
+     f81:	89 e5                	mov    %esp,%ebp
+     f83:	57                   	push   %edi
+     f84:	56                   	push   %esi
+     f85:	53                   	push   %ebx
+     f86:	83 ec 3c             	sub    $0x3c,%esp
+    if (test->num_children < 2) {
+     f89:	8b 45 08             	mov    0x8(%ebp),%eax
+     f8c:	8b 58 0c             	mov    0xc(%eax),%ebx
+     f8f:	b8 01 00 00 00       	mov    $0x1,%eax
+     f94:	83 fb 01             	cmp    $0x1,%ebx
+     f97:	0f 8e 74 01 00 00    	jle    1111 <compare_ticks_chi_squared+0x191>
+     f9d:	8b 45 08             	mov    0x8(%ebp),%eax
+    long long expect_ticks_total = 0;
+     fa0:	31 d2                	xor    %edx,%edx
+     fa2:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+     fa5:	8d b8 90 00 00 00    	lea    0x90(%eax),%edi
+     fab:	31 c0                	xor    %eax,%eax
+     fad:	8d 34 9f             	lea    (%edi,%ebx,4),%esi
+     fb0:	89 7d c8             	mov    %edi,-0x38(%ebp)
+    if (test->num_children < 2) {
+     fb3:	89 f9                	mov    %edi,%ecx
+    long long expect_ticks_total = 0;
+     fb5:	89 d7                	mov    %edx,%edi
+     fb7:	89 75 dc             	mov    %esi,-0x24(%ebp)
+     fba:	89 f3                	mov    %esi,%ebx
+     fbc:	89 c6                	mov    %eax,%esi
+     fbe:	66 90                	xchg   %ax,%ax
+        expect_ticks_total += test->expect_ticks_unscaled[i];
+     fc0:	8b 01                	mov    (%ecx),%eax
+     fc2:	99                   	cltd
+     fc3:	01 c6                	add    %eax,%esi
+     fc5:	11 d7                	adc    %edx,%edi
+    for (i = 0; i < test->num_children; ++i) {
+     fc7:	83 c1 04             	add    $0x4,%ecx
+     fca:	39 cb                	cmp    %ecx,%ebx
+     fcc:	75 f2                	jne    fc0 <compare_ticks_chi_squared+0x40>
+                             * test->total_actual_ticks;
+     fce:	8b 45 08             	mov    0x8(%ebp),%eax
+     fd1:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+     fd4:	89 75 d0             	mov    %esi,-0x30(%ebp)
+     fd7:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+     fda:	8b 7d c8             	mov    -0x38(%ebp),%edi
+     fdd:	8b b0 90 01 00 00    	mov    0x190(%eax),%esi
+    int skipped = 0;
+     fe3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    long long delta = 0;
+     fea:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%ebp)
+                             * test->total_actual_ticks;
+     ff1:	89 f0                	mov    %esi,%eax
+     ff3:	89 75 e0             	mov    %esi,-0x20(%ebp)
+     ff6:	c1 f8 1f             	sar    $0x1f,%eax
+    long long delta = 0;
+     ff9:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+                             * test->total_actual_ticks;
+    1000:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if (scaled_expected > 0) {
+    1003:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+    1006:	89 75 b8             	mov    %esi,-0x48(%ebp)
+    1009:	eb 62                	jmp    106d <compare_ticks_chi_squared+0xed>
+    100b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    100f:	90                   	nop
+    1010:	31 c0                	xor    %eax,%eax
+            cur_delta = FIXED_POINT_BASE * 100000LL;
+    1012:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (scaled_expected > 0) {
+    1017:	39 c8                	cmp    %ecx,%eax
+    1019:	19 d8                	sbb    %ebx,%eax
+            cur_delta = FIXED_POINT_BASE * 100000LL;
+    101b:	b8 00 80 1a 06       	mov    $0x61a8000,%eax
+        if (scaled_expected > 0) {
+    1020:	7d 3d                	jge    105f <compare_ticks_chi_squared+0xdf>
+        long long cur_delta = scaled_expected - (test->actual_ticks[i] << FIXED_POINT_COUNT);
+    1022:	8b 87 80 00 00 00    	mov    0x80(%edi),%eax
+    1028:	89 da                	mov    %ebx,%edx
+    102a:	c1 e0 0a             	shl    $0xa,%eax
+    102d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    1030:	c1 f8 1f             	sar    $0x1f,%eax
+    1033:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1036:	89 c8                	mov    %ecx,%eax
+    1038:	2b 45 c0             	sub    -0x40(%ebp),%eax
+    103b:	1b 55 c4             	sbb    -0x3c(%ebp),%edx
+        cur_delta *= cur_delta;
+    103e:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    1041:	89 d6                	mov    %edx,%esi
+    1043:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+    1046:	0f af f0             	imul   %eax,%esi
+    1049:	8b 45 c0             	mov    -0x40(%ebp),%eax
+            cur_delta /= scaled_expected;
+    104c:	53                   	push   %ebx
+    104d:	51                   	push   %ecx
+        cur_delta *= cur_delta;
+    104e:	f7 e0                	mul    %eax
+    1050:	8d 34 36             	lea    (%esi,%esi,1),%esi
+    1053:	01 f2                	add    %esi,%edx
+            cur_delta /= scaled_expected;
+    1055:	52                   	push   %edx
+    1056:	50                   	push   %eax
+    1057:	e8 14 f6 ff ff       	call   670 <__divdi3>
+    105c:	83 c4 10             	add    $0x10,%esp
+        delta += cur_delta;
+    105f:	01 45 c8             	add    %eax,-0x38(%ebp)
+    1062:	11 55 cc             	adc    %edx,-0x34(%ebp)
+    for (i = 0; i < test->num_children; ++i) {
+    1065:	83 c7 04             	add    $0x4,%edi
+    1068:	39 7d dc             	cmp    %edi,-0x24(%ebp)
+    106b:	74 48                	je     10b5 <compare_ticks_chi_squared+0x135>
+        long long scaled_expected = (test->expect_ticks_unscaled[i] << FIXED_POINT_COUNT) / expect_ticks_total
+    106d:	8b 07                	mov    (%edi),%eax
+    106f:	ff 75 d4             	push   -0x2c(%ebp)
+    1072:	ff 75 d0             	push   -0x30(%ebp)
+    1075:	c1 e0 0a             	shl    $0xa,%eax
+    1078:	99                   	cltd
+    1079:	52                   	push   %edx
+    107a:	50                   	push   %eax
+    107b:	e8 f0 f5 ff ff       	call   670 <__divdi3>
+    1080:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    1083:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    1086:	83 c4 10             	add    $0x10,%esp
+    1089:	89 d9                	mov    %ebx,%ecx
+    108b:	0f af ca             	imul   %edx,%ecx
+    108e:	89 f2                	mov    %esi,%edx
+    1090:	0f af d0             	imul   %eax,%edx
+    1093:	8d 34 11             	lea    (%ecx,%edx,1),%esi
+    1096:	f7 65 e0             	mull   -0x20(%ebp)
+    1099:	89 d3                	mov    %edx,%ebx
+    109b:	89 c1                	mov    %eax,%ecx
+    109d:	01 f3                	add    %esi,%ebx
+        if (scaled_expected == 0) {
+    109f:	89 d8                	mov    %ebx,%eax
+    10a1:	09 c8                	or     %ecx,%eax
+    10a3:	0f 85 67 ff ff ff    	jne    1010 <compare_ticks_chi_squared+0x90>
+            ++skipped;
+    10a9:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+    for (i = 0; i < test->num_children; ++i) {
+    10ad:	83 c7 04             	add    $0x4,%edi
+    10b0:	39 7d dc             	cmp    %edi,-0x24(%ebp)
+    10b3:	75 b8                	jne    106d <compare_ticks_chi_squared+0xed>
+    int degrees_of_freedom = test->num_children - 1 - skipped;
+    10b5:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+    10b8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    test->total_tests++;
+    10bb:	8b 55 08             	mov    0x8(%ebp),%edx
+    if (!passed_p) {
+    10be:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+    int degrees_of_freedom = test->num_children - 1 - skipped;
+    10c1:	89 df                	mov    %ebx,%edi
+    10c3:	8b 75 b8             	mov    -0x48(%ebp),%esi
+    10c6:	29 c7                	sub    %eax,%edi
+    long long expected_value = chi_squared_thresholds[degrees_of_freedom - 1];
+    10c8:	8d 47 fe             	lea    -0x2(%edi),%eax
+    10cb:	8b 1c c5 e0 23 00 00 	mov    0x23e0(,%eax,8),%ebx
+    10d2:	8b 3c c5 e4 23 00 00 	mov    0x23e4(,%eax,8),%edi
+    test->total_tests++;
+    10d9:	8b 45 08             	mov    0x8(%ebp),%eax
+    10dc:	8b 40 04             	mov    0x4(%eax),%eax
+    10df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    10e2:	83 c0 01             	add    $0x1,%eax
+    10e5:	89 42 04             	mov    %eax,0x4(%edx)
+    if (!passed_p) {
+    10e8:	8b 55 c8             	mov    -0x38(%ebp),%edx
+    10eb:	39 da                	cmp    %ebx,%edx
+    10ed:	19 f9                	sbb    %edi,%ecx
+    10ef:	7d 4f                	jge    1140 <compare_ticks_chi_squared+0x1c0>
+    test->total_tests++;
+    10f1:	8b 55 08             	mov    0x8(%ebp),%edx
+    10f4:	83 c0 01             	add    $0x1,%eax
+    10f7:	89 42 04             	mov    %eax,0x4(%edx)
+    if (!passed_p) {
+    10fa:	83 fe 0a             	cmp    $0xa,%esi
+    10fd:	7e 21                	jle    1120 <compare_ticks_chi_squared+0x1a0>
+    int passed_threshold = delta < expected_value;
+    10ff:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    1102:	8b 55 cc             	mov    -0x34(%ebp),%edx
+    1105:	39 d8                	cmp    %ebx,%eax
+    1107:	89 d0                	mov    %edx,%eax
+    1109:	19 f8                	sbb    %edi,%eax
+    110b:	0f 9c c0             	setl   %al
+    110e:	0f b6 c0             	movzbl %al,%eax
+}
+    1111:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1114:	5b                   	pop    %ebx
+    1115:	5e                   	pop    %esi
+    1116:	5f                   	pop    %edi
+    1117:	5d                   	pop    %ebp
+    1118:	c3                   	ret
+    1119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        test->errors++;
+    1120:	8b 45 08             	mov    0x8(%ebp),%eax
+    1123:	83 40 08 01          	addl   $0x1,0x8(%eax)
+        printf(1, "*** TEST FAILURE: for scenario '%s': %s\n", test->name, description);
+    1127:	68 a4 21 00 00       	push   $0x21a4
+    112c:	ff 30                	push   (%eax)
+    112e:	68 34 1f 00 00       	push   $0x1f34
+    1133:	6a 01                	push   $0x1
+    1135:	e8 b6 09 00 00       	call   1af0 <printf>
+}
+    113a:	83 c4 10             	add    $0x10,%esp
+    113d:	eb c0                	jmp    10ff <compare_ticks_chi_squared+0x17f>
+    113f:	90                   	nop
+        test->errors++;
+    1140:	8b 45 08             	mov    0x8(%ebp),%eax
+    1143:	83 40 08 01          	addl   $0x1,0x8(%eax)
+        printf(1, "*** TEST FAILURE: for scenario '%s': %s\n", test->name, description);
+    1147:	68 54 21 00 00       	push   $0x2154
+    114c:	ff 30                	push   (%eax)
+    114e:	68 34 1f 00 00       	push   $0x1f34
+    1153:	6a 01                	push   $0x1
+    1155:	e8 96 09 00 00       	call   1af0 <printf>
+        dump_test_timings(test);
+    115a:	58                   	pop    %eax
+    115b:	ff 75 08             	push   0x8(%ebp)
+    115e:	e8 3d fd ff ff       	call   ea0 <dump_test_timings>
+    check(test, test->total_actual_ticks > 10,
+    1163:	8b 45 08             	mov    0x8(%ebp),%eax
+    test->total_tests++;
+    1166:	8b 55 08             	mov    0x8(%ebp),%edx
+    1169:	83 c4 10             	add    $0x10,%esp
+    check(test, test->total_actual_ticks > 10,
+    116c:	8b b0 90 01 00 00    	mov    0x190(%eax),%esi
+    test->total_tests++;
+    1172:	8b 40 04             	mov    0x4(%eax),%eax
+    1175:	83 c0 01             	add    $0x1,%eax
+    1178:	89 42 04             	mov    %eax,0x4(%edx)
+    if (!passed_p) {
+    117b:	83 fe 0a             	cmp    $0xa,%esi
+    117e:	0f 8f 7b ff ff ff    	jg     10ff <compare_ticks_chi_squared+0x17f>
+    1184:	eb 9a                	jmp    1120 <compare_ticks_chi_squared+0x1a0>
+    1186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001190 <compare_ticks_naive>:
+void compare_ticks_naive(struct test_case *test) {
+    1190:	55                   	push   %ebp
+    1191:	89 e5                	mov    %esp,%ebp
+    1193:	57                   	push   %edi
+    1194:	56                   	push   %esi
+    1195:	53                   	push   %ebx
+    1196:	83 ec 3c             	sub    $0x3c,%esp
+    1199:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if (test->num_children < 2) {
+    119c:	8b 43 0c             	mov    0xc(%ebx),%eax
+    119f:	83 f8 01             	cmp    $0x1,%eax
+    11a2:	0f 8e eb 01 00 00    	jle    1393 <compare_ticks_naive+0x203>
+    11a8:	8d bb 90 00 00 00    	lea    0x90(%ebx),%edi
+    int expect_ticks_total = 0;
+    11ae:	31 d2                	xor    %edx,%edx
+    11b0:	8d 0c 87             	lea    (%edi,%eax,4),%ecx
+    11b3:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    if (test->num_children < 2) {
+    11b6:	89 f8                	mov    %edi,%eax
+    11b8:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+    11bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11bf:	90                   	nop
+        expect_ticks_total += test->expect_ticks_unscaled[i];
+    11c0:	03 10                	add    (%eax),%edx
+    for (i = 0; i < test->num_children; ++i) {
+    11c2:	83 c0 04             	add    $0x4,%eax
+    11c5:	39 c8                	cmp    %ecx,%eax
+    11c7:	75 f7                	jne    11c0 <compare_ticks_naive+0x30>
+        long long scaled_expected = ((long long) test->expect_ticks_unscaled[i] * test->total_actual_ticks) / expect_ticks_total;
+    11c9:	8b 83 90 01 00 00    	mov    0x190(%ebx),%eax
+    11cf:	89 55 c0             	mov    %edx,-0x40(%ebp)
+    11d2:	c1 fa 1f             	sar    $0x1f,%edx
+    11d5:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+    11d8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    int failed_any = 0;
+    11db:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%ebp)
+        int min_expected = scaled_expected * 9 / 10 - 10;
+    11e2:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    11e5:	8d 76 00             	lea    0x0(%esi),%esi
+        long long scaled_expected = ((long long) test->expect_ticks_unscaled[i] * test->total_actual_ticks) / expect_ticks_total;
+    11e8:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    11eb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    11ee:	f7 2f                	imull  (%edi)
+    11f0:	ff 75 c4             	push   -0x3c(%ebp)
+    11f3:	ff 75 c0             	push   -0x40(%ebp)
+    11f6:	52                   	push   %edx
+    11f7:	50                   	push   %eax
+    11f8:	e8 73 f4 ff ff       	call   670 <__divdi3>
+        int in_range = (test->actual_ticks[i] >= min_expected && test->actual_ticks[i] <= max_expected);
+    11fd:	8b bf 80 00 00 00    	mov    0x80(%edi),%edi
+        long long scaled_expected = ((long long) test->expect_ticks_unscaled[i] * test->total_actual_ticks) / expect_ticks_total;
+    1203:	83 c4 10             	add    $0x10,%esp
+    1206:	89 c3                	mov    %eax,%ebx
+        int min_expected = scaled_expected * 9 / 10 - 10;
+    1208:	b8 09 00 00 00       	mov    $0x9,%eax
+    120d:	8d 0c d2             	lea    (%edx,%edx,8),%ecx
+    1210:	89 55 d0             	mov    %edx,-0x30(%ebp)
+    1213:	f7 e3                	mul    %ebx
+    1215:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+        int in_range = (test->actual_ticks[i] >= min_expected && test->actual_ticks[i] <= max_expected);
+    1218:	89 7d d8             	mov    %edi,-0x28(%ebp)
+        int min_expected = scaled_expected * 9 / 10 - 10;
+    121b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    121e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1221:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+    1224:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    1227:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    122a:	89 ca                	mov    %ecx,%edx
+    122c:	0f ac d9 1c          	shrd   $0x1c,%ebx,%ecx
+    1230:	81 e2 ff ff ff 0f    	and    $0xfffffff,%edx
+    1236:	89 de                	mov    %ebx,%esi
+    1238:	81 e1 ff ff ff 0f    	and    $0xfffffff,%ecx
+    123e:	c1 fe 1f             	sar    $0x1f,%esi
+    1241:	01 d1                	add    %edx,%ecx
+    1243:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1246:	89 f0                	mov    %esi,%eax
+    1248:	83 e6 fc             	and    $0xfffffffc,%esi
+    124b:	83 e0 03             	and    $0x3,%eax
+    124e:	c1 ea 18             	shr    $0x18,%edx
+    1251:	01 d1                	add    %edx,%ecx
+    1253:	01 c1                	add    %eax,%ecx
+    1255:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    125a:	f7 e1                	mul    %ecx
+    125c:	89 d0                	mov    %edx,%eax
+    125e:	83 e2 fc             	and    $0xfffffffc,%edx
+    1261:	c1 e8 02             	shr    $0x2,%eax
+    1264:	01 c2                	add    %eax,%edx
+    1266:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1269:	29 d1                	sub    %edx,%ecx
+    126b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    126e:	01 ce                	add    %ecx,%esi
+    1270:	89 f7                	mov    %esi,%edi
+    1272:	c1 ff 1f             	sar    $0x1f,%edi
+    1275:	29 f0                	sub    %esi,%eax
+    1277:	19 fa                	sbb    %edi,%edx
+    1279:	89 c6                	mov    %eax,%esi
+    127b:	31 db                	xor    %ebx,%ebx
+    127d:	69 ca cd cc cc cc    	imul   $0xcccccccd,%edx,%ecx
+    1283:	69 d0 cc cc cc cc    	imul   $0xcccccccc,%eax,%edx
+    1289:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    128e:	01 d1                	add    %edx,%ecx
+    1290:	f7 e6                	mul    %esi
+    1292:	01 ca                	add    %ecx,%edx
+    1294:	89 d1                	mov    %edx,%ecx
+    1296:	c1 e9 1f             	shr    $0x1f,%ecx
+    1299:	01 c1                	add    %eax,%ecx
+    129b:	11 d3                	adc    %edx,%ebx
+    129d:	0f ac d9 01          	shrd   $0x1,%ebx,%ecx
+    12a1:	83 e9 0a             	sub    $0xa,%ecx
+        int in_range = (test->actual_ticks[i] >= min_expected && test->actual_ticks[i] <= max_expected);
+    12a4:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+    12a7:	0f 8c 9e 00 00 00    	jl     134b <compare_ticks_naive+0x1bb>
+        int max_expected = scaled_expected * 11 / 10 + 10;
+    12ad:	b8 0b 00 00 00       	mov    $0xb,%eax
+    12b2:	f7 65 d4             	mull   -0x2c(%ebp)
+    12b5:	6b 4d d0 0b          	imul   $0xb,-0x30(%ebp),%ecx
+    12b9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    12bc:	01 4d e4             	add    %ecx,-0x1c(%ebp)
+    12bf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    12c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    12c5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+    12c8:	89 ce                	mov    %ecx,%esi
+    12ca:	c1 fe 1f             	sar    $0x1f,%esi
+    12cd:	89 f3                	mov    %esi,%ebx
+    12cf:	83 e6 fc             	and    $0xfffffffc,%esi
+    12d2:	83 e3 03             	and    $0x3,%ebx
+    12d5:	89 d8                	mov    %ebx,%eax
+    12d7:	89 cb                	mov    %ecx,%ebx
+    12d9:	89 d1                	mov    %edx,%ecx
+    12db:	81 e2 ff ff ff 0f    	and    $0xfffffff,%edx
+    12e1:	0f ac d9 1c          	shrd   $0x1c,%ebx,%ecx
+    12e5:	81 e1 ff ff ff 0f    	and    $0xfffffff,%ecx
+    12eb:	01 d1                	add    %edx,%ecx
+    12ed:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    12f0:	c1 ea 18             	shr    $0x18,%edx
+    12f3:	01 d1                	add    %edx,%ecx
+    12f5:	01 c1                	add    %eax,%ecx
+    12f7:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    12fc:	f7 e1                	mul    %ecx
+    12fe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1301:	89 d3                	mov    %edx,%ebx
+    1303:	83 e2 fc             	and    $0xfffffffc,%edx
+    1306:	c1 eb 02             	shr    $0x2,%ebx
+    1309:	01 da                	add    %ebx,%edx
+    130b:	29 d1                	sub    %edx,%ecx
+    130d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1310:	01 ce                	add    %ecx,%esi
+    1312:	89 f7                	mov    %esi,%edi
+    1314:	c1 ff 1f             	sar    $0x1f,%edi
+    1317:	29 f0                	sub    %esi,%eax
+    1319:	19 fa                	sbb    %edi,%edx
+    131b:	89 c6                	mov    %eax,%esi
+    131d:	31 db                	xor    %ebx,%ebx
+    131f:	69 ca cd cc cc cc    	imul   $0xcccccccd,%edx,%ecx
+    1325:	69 d0 cc cc cc cc    	imul   $0xcccccccc,%eax,%edx
+    132b:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+    1330:	01 d1                	add    %edx,%ecx
+    1332:	f7 e6                	mul    %esi
+    1334:	01 ca                	add    %ecx,%edx
+    1336:	89 d1                	mov    %edx,%ecx
+    1338:	c1 e9 1f             	shr    $0x1f,%ecx
+    133b:	01 c1                	add    %eax,%ecx
+    133d:	11 d3                	adc    %edx,%ebx
+    133f:	0f ac d9 01          	shrd   $0x1,%ebx,%ecx
+    1343:	83 c1 0a             	add    $0xa,%ecx
+        int in_range = (test->actual_ticks[i] >= min_expected && test->actual_ticks[i] <= max_expected);
+    1346:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+    1349:	7e 07                	jle    1352 <compare_ticks_naive+0x1c2>
+            failed_any = 1;
+    134b:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%ebp)
+    for (i = 0; i < test->num_children; ++i) {
+    1352:	83 45 dc 04          	addl   $0x4,-0x24(%ebp)
+    1356:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    1359:	39 45 c8             	cmp    %eax,-0x38(%ebp)
+    135c:	0f 85 86 fe ff ff    	jne    11e8 <compare_ticks_naive+0x58>
+    test->total_tests++;
+    1362:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if (!passed_p) {
+    1365:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+    test->total_tests++;
+    1368:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+        printf(1, "*** %s failed chi-squared test, but was w/in 10% of expected\n", test->name);
+    136c:	8b 03                	mov    (%ebx),%eax
+    if (!passed_p) {
+    136e:	85 c9                	test   %ecx,%ecx
+    1370:	75 2e                	jne    13a0 <compare_ticks_naive+0x210>
+        printf(1, "*** %s failed chi-squared test, but was w/in 10% of expected\n", test->name);
+    1372:	83 ec 04             	sub    $0x4,%esp
+    1375:	50                   	push   %eax
+    1376:	68 d8 21 00 00       	push   $0x21d8
+    137b:	6a 01                	push   $0x1
+    137d:	e8 6e 07 00 00       	call   1af0 <printf>
+        printf(1, "*** a likely cause is bias in random number generation\n");
+    1382:	58                   	pop    %eax
+    1383:	5a                   	pop    %edx
+    1384:	68 18 22 00 00       	push   $0x2218
+    1389:	6a 01                	push   $0x1
+    138b:	e8 60 07 00 00       	call   1af0 <printf>
+    1390:	83 c4 10             	add    $0x10,%esp
+}
+    1393:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1396:	5b                   	pop    %ebx
+    1397:	5e                   	pop    %esi
+    1398:	5f                   	pop    %edi
+    1399:	5d                   	pop    %ebp
+    139a:	c3                   	ret
+    139b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    139f:	90                   	nop
+        test->errors++;
+    13a0:	83 43 08 01          	addl   $0x1,0x8(%ebx)
+        printf(1, "*** TEST FAILURE: for scenario '%s': %s\n", test->name, description);
+    13a4:	68 50 22 00 00       	push   $0x2250
+    13a9:	50                   	push   %eax
+    13aa:	68 34 1f 00 00       	push   $0x1f34
+    13af:	6a 01                	push   $0x1
+    13b1:	e8 3a 07 00 00       	call   1af0 <printf>
+}
+    13b6:	83 c4 10             	add    $0x10,%esp
+}
+    13b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13bc:	5b                   	pop    %ebx
+    13bd:	5e                   	pop    %esi
+    13be:	5f                   	pop    %edi
+    13bf:	5d                   	pop    %ebp
+    13c0:	c3                   	ret
+    13c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13cf:	90                   	nop
+
+000013d0 <run_test_case>:
+void run_test_case(struct test_case* test) {
+    13d0:	55                   	push   %ebp
+    13d1:	89 e5                	mov    %esp,%ebp
+    13d3:	57                   	push   %edi
+    13d4:	56                   	push   %esi
+    execute_and_get_info(test, pids, &before, &after);
+    13d5:	8d 85 60 f9 ff ff    	lea    -0x6a0(%ebp),%eax
+    13db:	8d bd e4 fc ff ff    	lea    -0x31c(%ebp),%edi
+void run_test_case(struct test_case* test) {
+    13e1:	53                   	push   %ebx
+    execute_and_get_info(test, pids, &before, &after);
+    13e2:	8d b5 e0 f9 ff ff    	lea    -0x620(%ebp),%esi
+void run_test_case(struct test_case* test) {
+    13e8:	81 ec 9c 06 00 00    	sub    $0x69c,%esp
+    13ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    test->total_tests = test->errors = 0;
+    13f1:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    13f8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    execute_and_get_info(test, pids, &before, &after);
+    13ff:	57                   	push   %edi
+    1400:	56                   	push   %esi
+    1401:	50                   	push   %eax
+    1402:	53                   	push   %ebx
+    1403:	e8 b8 f7 ff ff       	call   bc0 <execute_and_get_info>
+          before.num_processes < NPROC && after.num_processes < NPROC &&
+    1408:	8b 85 e0 f9 ff ff    	mov    -0x620(%ebp),%eax
+    check(test, 
+    140e:	83 c4 10             	add    $0x10,%esp
+    1411:	83 f8 3f             	cmp    $0x3f,%eax
+    1414:	7f 0b                	jg     1421 <run_test_case+0x51>
+          before.num_processes < NPROC && after.num_processes < NPROC &&
+    1416:	8b 8d e4 fc ff ff    	mov    -0x31c(%ebp),%ecx
+    141c:	83 f9 3f             	cmp    $0x3f,%ecx
+    141f:	7e 67                	jle    1488 <run_test_case+0xb8>
+    test->total_tests++;
+    1421:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+        test->errors++;
+    1425:	83 43 08 01          	addl   $0x1,0x8(%ebx)
+        printf(1, "*** TEST FAILURE: for scenario '%s': %s\n", test->name, description);
+    1429:	68 84 22 00 00       	push   $0x2284
+    142e:	ff 33                	push   (%ebx)
+    1430:	68 34 1f 00 00       	push   $0x1f34
+    1435:	6a 01                	push   $0x1
+    1437:	e8 b4 06 00 00       	call   1af0 <printf>
+}
+    143c:	83 c4 10             	add    $0x10,%esp
+    count_ticks(test, pids, &before, &after);
+    143f:	8d 85 60 f9 ff ff    	lea    -0x6a0(%ebp),%eax
+    1445:	57                   	push   %edi
+    1446:	56                   	push   %esi
+    1447:	50                   	push   %eax
+    1448:	53                   	push   %ebx
+    1449:	e8 a2 f8 ff ff       	call   cf0 <count_ticks>
+    if (!compare_ticks_chi_squared(test)) {
+    144e:	89 1c 24             	mov    %ebx,(%esp)
+    1451:	e8 2a fb ff ff       	call   f80 <compare_ticks_chi_squared>
+    1456:	83 c4 10             	add    $0x10,%esp
+    1459:	85 c0                	test   %eax,%eax
+    145b:	74 43                	je     14a0 <run_test_case+0xd0>
+    printf(1, "%s: passed %d of %d\n", test->name, test->total_tests - test->errors, test->total_tests);
+    145d:	8b 43 04             	mov    0x4(%ebx),%eax
+    1460:	83 ec 0c             	sub    $0xc,%esp
+    1463:	50                   	push   %eax
+    1464:	2b 43 08             	sub    0x8(%ebx),%eax
+    1467:	50                   	push   %eax
+    1468:	ff 33                	push   (%ebx)
+    146a:	68 6c 1e 00 00       	push   $0x1e6c
+    146f:	6a 01                	push   $0x1
+    1471:	e8 7a 06 00 00       	call   1af0 <printf>
+}
+    1476:	83 c4 20             	add    $0x20,%esp
+    1479:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    147c:	5b                   	pop    %ebx
+    147d:	5e                   	pop    %esi
+    147e:	5f                   	pop    %edi
+    147f:	5d                   	pop    %ebp
+    1480:	c3                   	ret
+    1481:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    check(test, 
+    1488:	39 c8                	cmp    %ecx,%eax
+    148a:	0f 4f c1             	cmovg  %ecx,%eax
+    148d:	39 43 0c             	cmp    %eax,0xc(%ebx)
+    1490:	7d 8f                	jge    1421 <run_test_case+0x51>
+    test->total_tests++;
+    1492:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+    if (!passed_p) {
+    1496:	eb a7                	jmp    143f <run_test_case+0x6f>
+    1498:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    149f:	90                   	nop
+        compare_ticks_naive(test);
+    14a0:	83 ec 0c             	sub    $0xc,%esp
+    14a3:	53                   	push   %ebx
+    14a4:	e8 e7 fc ff ff       	call   1190 <compare_ticks_naive>
+    14a9:	83 c4 10             	add    $0x10,%esp
+    14ac:	eb af                	jmp    145d <run_test_case+0x8d>
+    14ae:	66 90                	xchg   %ax,%ax
+
+000014b0 <max_share_deviation>:
+int max_share_deviation(struct test_case *test) {
+    14b0:	55                   	push   %ebp
+    14b1:	89 e5                	mov    %esp,%ebp
+    14b3:	57                   	push   %edi
+    14b4:	56                   	push   %esi
+    14b5:	53                   	push   %ebx
+    14b6:	83 ec 2c             	sub    $0x2c,%esp
+    14b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    for (i = 0; i < test->num_children; ++i) {
+    14bc:	8b 43 0c             	mov    0xc(%ebx),%eax
+    14bf:	85 c0                	test   %eax,%eax
+    14c1:	0f 8e c9 00 00 00    	jle    1590 <max_share_deviation+0xe0>
+    14c7:	8d b3 90 00 00 00    	lea    0x90(%ebx),%esi
+    long long expect_ticks_total = 0;
+    14cd:	31 d2                	xor    %edx,%edx
+    14cf:	8d 3c 86             	lea    (%esi,%eax,4),%edi
+    14d2:	31 c0                	xor    %eax,%eax
+    14d4:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    for (i = 0; i < test->num_children; ++i) {
+    14d7:	89 f1                	mov    %esi,%ecx
+    long long expect_ticks_total = 0;
+    14d9:	89 fb                	mov    %edi,%ebx
+    14db:	89 c6                	mov    %eax,%esi
+    14dd:	89 d7                	mov    %edx,%edi
+    14df:	90                   	nop
+        expect_ticks_total += test->expect_ticks_unscaled[i];
+    14e0:	8b 01                	mov    (%ecx),%eax
+    14e2:	99                   	cltd
+    14e3:	01 c6                	add    %eax,%esi
+    14e5:	11 d7                	adc    %edx,%edi
+    for (i = 0; i < test->num_children; ++i) {
+    14e7:	83 c1 04             	add    $0x4,%ecx
+    14ea:	39 d9                	cmp    %ebx,%ecx
+    14ec:	75 f2                	jne    14e0 <max_share_deviation+0x30>
+        long long scaled_expected = ((long long) test->expect_ticks_unscaled[i] * test->total_actual_ticks) / expect_ticks_total;
+    14ee:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    14f1:	89 df                	mov    %ebx,%edi
+    14f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    14f6:	89 75 d0             	mov    %esi,-0x30(%ebp)
+    14f9:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    14fc:	8b 83 90 01 00 00    	mov    0x190(%ebx),%eax
+        int deviation = (int) (delta * 1000 / scaled_expected);
+    1502:	89 7d cc             	mov    %edi,-0x34(%ebp)
+        long long scaled_expected = ((long long) test->expect_ticks_unscaled[i] * test->total_actual_ticks) / expect_ticks_total;
+    1505:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    int i, max_deviation = 0;
+    1508:	31 c0                	xor    %eax,%eax
+        int deviation = (int) (delta * 1000 / scaled_expected);
+    150a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    150d:	8d 76 00             	lea    0x0(%esi),%esi
+        long long scaled_expected = ((long long) test->expect_ticks_unscaled[i] * test->total_actual_ticks) / expect_ticks_total;
+    1510:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1513:	f7 2e                	imull  (%esi)
+    1515:	ff 75 d4             	push   -0x2c(%ebp)
+    1518:	ff 75 d0             	push   -0x30(%ebp)
+    151b:	52                   	push   %edx
+    151c:	50                   	push   %eax
+    151d:	e8 4e f1 ff ff       	call   670 <__divdi3>
+    1522:	83 c4 10             	add    $0x10,%esp
+    1525:	89 c1                	mov    %eax,%ecx
+        if (scaled_expected == 0)
+    1527:	89 d0                	mov    %edx,%eax
+        long long scaled_expected = ((long long) test->expect_ticks_unscaled[i] * test->total_actual_ticks) / expect_ticks_total;
+    1529:	89 d3                	mov    %edx,%ebx
+        if (scaled_expected == 0)
+    152b:	09 c8                	or     %ecx,%eax
+    152d:	74 4b                	je     157a <max_share_deviation+0xca>
+        long long delta = test->actual_ticks[i] - scaled_expected;
+    152f:	8b 86 80 00 00 00    	mov    0x80(%esi),%eax
+    1535:	99                   	cltd
+    1536:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    1539:	29 c8                	sub    %ecx,%eax
+    153b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    153e:	19 da                	sbb    %ebx,%edx
+        if (delta < 0)
+    1540:	85 d2                	test   %edx,%edx
+    1542:	79 0a                	jns    154e <max_share_deviation+0x9e>
+            delta = -delta;
+    1544:	89 c8                	mov    %ecx,%eax
+    1546:	89 da                	mov    %ebx,%edx
+    1548:	2b 45 d8             	sub    -0x28(%ebp),%eax
+    154b:	1b 55 dc             	sbb    -0x24(%ebp),%edx
+        int deviation = (int) (delta * 1000 / scaled_expected);
+    154e:	69 fa e8 03 00 00    	imul   $0x3e8,%edx,%edi
+    1554:	89 7d d8             	mov    %edi,-0x28(%ebp)
+    1557:	bf e8 03 00 00       	mov    $0x3e8,%edi
+    155c:	f7 e7                	mul    %edi
+    155e:	8b 7d d8             	mov    -0x28(%ebp),%edi
+    1561:	53                   	push   %ebx
+    1562:	51                   	push   %ecx
+    1563:	01 fa                	add    %edi,%edx
+    1565:	52                   	push   %edx
+    1566:	50                   	push   %eax
+    1567:	e8 04 f1 ff ff       	call   670 <__divdi3>
+    156c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    156f:	83 c4 10             	add    $0x10,%esp
+    1572:	39 c2                	cmp    %eax,%edx
+    1574:	0f 4d c2             	cmovge %edx,%eax
+    1577:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for (i = 0; i < test->num_children; ++i) {
+    157a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    157d:	83 c6 04             	add    $0x4,%esi
+    1580:	39 c6                	cmp    %eax,%esi
+    1582:	75 8c                	jne    1510 <max_share_deviation+0x60>
+    1584:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+}
+    1587:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    158a:	5b                   	pop    %ebx
+    158b:	5e                   	pop    %esi
+    158c:	5f                   	pop    %edi
+    158d:	5d                   	pop    %ebp
+    158e:	c3                   	ret
+    158f:	90                   	nop
+    1590:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    int i, max_deviation = 0;
+    1593:	31 c0                	xor    %eax,%eax
+}
+    1595:	5b                   	pop    %ebx
+    1596:	5e                   	pop    %esi
+    1597:	5f                   	pop    %edi
+    1598:	5d                   	pop    %ebp
+    1599:	c3                   	ret
+    159a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000015a0 <compare_policies>:
+void compare_policies(void) {
+    15a0:	55                   	push   %ebp
+    15a1:	89 e5                	mov    %esp,%ebp
+    15a3:	57                   	push   %edi
+    15a4:	56                   	push   %esi
+    15a5:	53                   	push   %ebx
+    15a6:	81 ec b8 06 00 00    	sub    $0x6b8,%esp
+    int old_policy = setsched(SCHED_LOTTERY);
+    15ac:	6a 00                	push   $0x0
+    15ae:	e8 70 04 00 00       	call   1a23 <setsched>
+    printf(1, "max share deviation (%% of expected ticks)\n");
+    15b3:	5a                   	pop    %edx
+    15b4:	59                   	pop    %ecx
+    15b5:	68 c0 22 00 00       	push   $0x22c0
+    15ba:	6a 01                	push   $0x1
+    int old_policy = setsched(SCHED_LOTTERY);
+    15bc:	89 c7                	mov    %eax,%edi
+    printf(1, "max share deviation (%% of expected ticks)\n");
+    15be:	e8 2d 05 00 00       	call   1af0 <printf>
+    printf(1, "lottery\tstride\tscenario\n");
+    15c3:	5b                   	pop    %ebx
+    15c4:	5e                   	pop    %esi
+    15c5:	68 81 1e 00 00       	push   $0x1e81
+    15ca:	6a 01                	push   $0x1
+    15cc:	e8 1f 05 00 00       	call   1af0 <printf>
+    for (i = 0; tests[i].name; ++i) {
+    15d1:	a1 00 2d 00 00       	mov    0x2d00,%eax
+    15d6:	83 c4 10             	add    $0x10,%esp
+    15d9:	85 c0                	test   %eax,%eax
+    15db:	0f 84 fc 00 00 00    	je     16dd <compare_policies+0x13d>
+    15e1:	89 bd 50 f9 ff ff    	mov    %edi,-0x6b0(%ebp)
+    15e7:	be 00 2d 00 00       	mov    $0x2d00,%esi
+    15ec:	89 f3                	mov    %esi,%ebx
+    15ee:	66 90                	xchg   %ax,%ax
+        if (test->num_children < 2)
+    15f0:	83 7b 0c 01          	cmpl   $0x1,0xc(%ebx)
+    15f4:	0f 8e c9 00 00 00    	jle    16c3 <compare_policies+0x123>
+        for (policy = SCHED_LOTTERY; policy <= SCHED_STRIDE; ++policy) {
+    15fa:	31 d2                	xor    %edx,%edx
+    15fc:	8d b5 e4 fc ff ff    	lea    -0x31c(%ebp),%esi
+    1602:	8d bd e0 f9 ff ff    	lea    -0x620(%ebp),%edi
+            setsched(policy);
+    1608:	83 ec 0c             	sub    $0xc,%esp
+    160b:	52                   	push   %edx
+    160c:	89 95 54 f9 ff ff    	mov    %edx,-0x6ac(%ebp)
+    1612:	e8 0c 04 00 00       	call   1a23 <setsched>
+            execute_and_get_info(test, pids, &before, &after);
+    1617:	8d 85 60 f9 ff ff    	lea    -0x6a0(%ebp),%eax
+            test->total_tests = test->errors = 0;
+    161d:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    1624:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+            execute_and_get_info(test, pids, &before, &after);
+    162b:	56                   	push   %esi
+    162c:	57                   	push   %edi
+    162d:	50                   	push   %eax
+    162e:	53                   	push   %ebx
+    162f:	e8 8c f5 ff ff       	call   bc0 <execute_and_get_info>
+            count_ticks(test, pids, &before, &after);
+    1634:	83 c4 20             	add    $0x20,%esp
+    1637:	8d 85 60 f9 ff ff    	lea    -0x6a0(%ebp),%eax
+    163d:	56                   	push   %esi
+    163e:	57                   	push   %edi
+    163f:	50                   	push   %eax
+    1640:	53                   	push   %ebx
+    1641:	e8 aa f6 ff ff       	call   cf0 <count_ticks>
+            deviation[policy] = max_share_deviation(test);
+    1646:	89 1c 24             	mov    %ebx,(%esp)
+    1649:	e8 62 fe ff ff       	call   14b0 <max_share_deviation>
+    164e:	8b 95 54 f9 ff ff    	mov    -0x6ac(%ebp),%edx
+    1654:	83 c4 10             	add    $0x10,%esp
+    1657:	89 84 95 58 f9 ff ff 	mov    %eax,-0x6a8(%ebp,%edx,4)
+        for (policy = SCHED_LOTTERY; policy <= SCHED_STRIDE; ++policy) {
+    165e:	85 d2                	test   %edx,%edx
+    1660:	75 0e                	jne    1670 <compare_policies+0xd0>
+    1662:	ba 01 00 00 00       	mov    $0x1,%edx
+    1667:	eb 9f                	jmp    1608 <compare_policies+0x68>
+    1669:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+            deviation[SCHED_STRIDE] / 10, deviation[SCHED_STRIDE] % 10,
+    1670:	8b bd 5c f9 ff ff    	mov    -0x6a4(%ebp),%edi
+        printf(1, "%d.%d%%\t%d.%d%%\t%s\n",
+    1676:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+            deviation[SCHED_LOTTERY] / 10, deviation[SCHED_LOTTERY] % 10,
+    167b:	8b b5 58 f9 ff ff    	mov    -0x6a8(%ebp),%esi
+        printf(1, "%d.%d%%\t%d.%d%%\t%s\n",
+    1681:	83 ec 04             	sub    $0x4,%esp
+    1684:	ff 33                	push   (%ebx)
+    1686:	89 f8                	mov    %edi,%eax
+    1688:	f7 e9                	imul   %ecx
+    168a:	89 f8                	mov    %edi,%eax
+    168c:	c1 f8 1f             	sar    $0x1f,%eax
+    168f:	c1 fa 02             	sar    $0x2,%edx
+    1692:	29 c2                	sub    %eax,%edx
+    1694:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1697:	01 c0                	add    %eax,%eax
+    1699:	29 c7                	sub    %eax,%edi
+    169b:	89 f0                	mov    %esi,%eax
+    169d:	57                   	push   %edi
+    169e:	52                   	push   %edx
+    169f:	f7 e9                	imul   %ecx
+    16a1:	89 f0                	mov    %esi,%eax
+    16a3:	c1 f8 1f             	sar    $0x1f,%eax
+    16a6:	c1 fa 02             	sar    $0x2,%edx
+    16a9:	29 c2                	sub    %eax,%edx
+    16ab:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    16ae:	01 c0                	add    %eax,%eax
+    16b0:	29 c6                	sub    %eax,%esi
+    16b2:	56                   	push   %esi
+    16b3:	52                   	push   %edx
+    16b4:	68 9a 1e 00 00       	push   $0x1e9a
+    16b9:	6a 01                	push   $0x1
+    16bb:	e8 30 04 00 00       	call   1af0 <printf>
+    16c0:	83 c4 20             	add    $0x20,%esp
+    for (i = 0; tests[i].name; ++i) {
+    16c3:	8b 83 14 02 00 00    	mov    0x214(%ebx),%eax
+    16c9:	81 c3 14 02 00 00    	add    $0x214,%ebx
+    16cf:	85 c0                	test   %eax,%eax
+    16d1:	0f 85 19 ff ff ff    	jne    15f0 <compare_policies+0x50>
+    16d7:	8b bd 50 f9 ff ff    	mov    -0x6b0(%ebp),%edi
+    setsched(old_policy);
+    16dd:	83 ec 0c             	sub    $0xc,%esp
+    16e0:	57                   	push   %edi
+    16e1:	e8 3d 03 00 00       	call   1a23 <setsched>
+}
+    16e6:	83 c4 10             	add    $0x10,%esp
+    16e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    16ec:	5b                   	pop    %ebx
+    16ed:	5e                   	pop    %esi
+    16ee:	5f                   	pop    %edi
+    16ef:	5d                   	pop    %ebp
+    16f0:	c3                   	ret
+    16f1:	66 90                	xchg   %ax,%ax
+    16f3:	66 90                	xchg   %ax,%ax
+    16f5:	66 90                	xchg   %ax,%ax
+    16f7:	66 90                	xchg   %ax,%ax
+    16f9:	66 90                	xchg   %ax,%ax
+    16fb:	66 90                	xchg   %ax,%ax
+    16fd:	66 90                	xchg   %ax,%ax
+    16ff:	90                   	nop
+
+00001700 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    1700:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    1701:	31 c0                	xor    %eax,%eax
+{
+    1703:	89 e5                	mov    %esp,%ebp
+    1705:	53                   	push   %ebx
+    1706:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    1709:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    170c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    1710:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    1714:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    1717:	83 c0 01             	add    $0x1,%eax
+    171a:	84 d2                	test   %dl,%dl
+    171c:	75 f2                	jne    1710 <strcpy+0x10>
+    ;
+  return os;
+}
+    171e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1721:	89 c8                	mov    %ecx,%eax
+    1723:	c9                   	leave
+    1724:	c3                   	ret
+    1725:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    172c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001730 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1730:	55                   	push   %ebp
+    1731:	89 e5                	mov    %esp,%ebp
+    1733:	53                   	push   %ebx
+    1734:	8b 55 08             	mov    0x8(%ebp),%edx
+    1737:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    173a:	0f b6 02             	movzbl (%edx),%eax
+    173d:	84 c0                	test   %al,%al
+    173f:	75 17                	jne    1758 <strcmp+0x28>
+    1741:	eb 3a                	jmp    177d <strcmp+0x4d>
+    1743:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1747:	90                   	nop
+    1748:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    174c:	83 c2 01             	add    $0x1,%edx
+    174f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1752:	84 c0                	test   %al,%al
+    1754:	74 1a                	je     1770 <strcmp+0x40>
+    p++, q++;
+    1756:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1758:	0f b6 19             	movzbl (%ecx),%ebx
+    175b:	38 c3                	cmp    %al,%bl
+    175d:	74 e9                	je     1748 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    175f:	29 d8                	sub    %ebx,%eax
+}
+    1761:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1764:	c9                   	leave
+    1765:	c3                   	ret
+    1766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    176d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1770:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1774:	31 c0                	xor    %eax,%eax
+    1776:	29 d8                	sub    %ebx,%eax
+}
+    1778:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    177b:	c9                   	leave
+    177c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    177d:	0f b6 19             	movzbl (%ecx),%ebx
+    1780:	31 c0                	xor    %eax,%eax
+    1782:	eb db                	jmp    175f <strcmp+0x2f>
+    1784:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    178b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    178f:	90                   	nop
+
+00001790 <strlen>:
+
+uint
+strlen(char *s)
+{
+    1790:	55                   	push   %ebp
+    1791:	89 e5                	mov    %esp,%ebp
+    1793:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1796:	80 3a 00             	cmpb   $0x0,(%edx)
+    1799:	74 15                	je     17b0 <strlen+0x20>
+    179b:	31 c0                	xor    %eax,%eax
+    179d:	8d 76 00             	lea    0x0(%esi),%esi
+    17a0:	83 c0 01             	add    $0x1,%eax
+    17a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    17a7:	89 c1                	mov    %eax,%ecx
+    17a9:	75 f5                	jne    17a0 <strlen+0x10>
+    ;
+  return n;
+}
+    17ab:	89 c8                	mov    %ecx,%eax
+    17ad:	5d                   	pop    %ebp
+    17ae:	c3                   	ret
+    17af:	90                   	nop
+  for(n = 0; s[n]; n++)
+    17b0:	31 c9                	xor    %ecx,%ecx
+}
+    17b2:	5d                   	pop    %ebp
+    17b3:	89 c8                	mov    %ecx,%eax
+    17b5:	c3                   	ret
+    17b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000017c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    17c0:	55                   	push   %ebp
+    17c1:	89 e5                	mov    %esp,%ebp
+    17c3:	57                   	push   %edi
+    17c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    17c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    17ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+    17cd:	89 d7                	mov    %edx,%edi
+    17cf:	fc                   	cld
+    17d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    17d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    17d5:	89 d0                	mov    %edx,%eax
+    17d7:	c9                   	leave
+    17d8:	c3                   	ret
+    17d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000017e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    17e0:	55                   	push   %ebp
+    17e1:	89 e5                	mov    %esp,%ebp
+    17e3:	8b 45 08             	mov    0x8(%ebp),%eax
+    17e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    17ea:	0f b6 10             	movzbl (%eax),%edx
+    17ed:	84 d2                	test   %dl,%dl
+    17ef:	75 12                	jne    1803 <strchr+0x23>
+    17f1:	eb 1d                	jmp    1810 <strchr+0x30>
+    17f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    17f7:	90                   	nop
+    17f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    17fc:	83 c0 01             	add    $0x1,%eax
+    17ff:	84 d2                	test   %dl,%dl
+    1801:	74 0d                	je     1810 <strchr+0x30>
+    if(*s == c)
+    1803:	38 d1                	cmp    %dl,%cl
+    1805:	75 f1                	jne    17f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    1807:	5d                   	pop    %ebp
+    1808:	c3                   	ret
+    1809:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    1810:	31 c0                	xor    %eax,%eax
+}
+    1812:	5d                   	pop    %ebp
+    1813:	c3                   	ret
+    1814:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    181b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    181f:	90                   	nop
+
+00001820 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    1820:	55                   	push   %ebp
+    1821:	89 e5                	mov    %esp,%ebp
+    1823:	57                   	push   %edi
+    1824:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    1825:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    1828:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    1829:	31 db                	xor    %ebx,%ebx
+{
+    182b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    182e:	eb 27                	jmp    1857 <gets+0x37>
+    cc = read(0, &c, 1);
+    1830:	83 ec 04             	sub    $0x4,%esp
+    1833:	6a 01                	push   $0x1
+    1835:	56                   	push   %esi
+    1836:	6a 00                	push   $0x0
+    1838:	e8 1e 01 00 00       	call   195b <read>
+    if(cc < 1)
+    183d:	83 c4 10             	add    $0x10,%esp
+    1840:	85 c0                	test   %eax,%eax
+    1842:	7e 1d                	jle    1861 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1844:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1848:	8b 55 08             	mov    0x8(%ebp),%edx
+    184b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    184f:	3c 0a                	cmp    $0xa,%al
+    1851:	74 10                	je     1863 <gets+0x43>
+    1853:	3c 0d                	cmp    $0xd,%al
+    1855:	74 0c                	je     1863 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1857:	89 df                	mov    %ebx,%edi
+    1859:	83 c3 01             	add    $0x1,%ebx
+    185c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    185f:	7c cf                	jl     1830 <gets+0x10>
+    1861:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1863:	8b 45 08             	mov    0x8(%ebp),%eax
+    1866:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    186a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    186d:	5b                   	pop    %ebx
+    186e:	5e                   	pop    %esi
+    186f:	5f                   	pop    %edi
+    1870:	5d                   	pop    %ebp
+    1871:	c3                   	ret
+    1872:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1879:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001880 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    1880:	55                   	push   %ebp
+    1881:	89 e5                	mov    %esp,%ebp
+    1883:	56                   	push   %esi
+    1884:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1885:	83 ec 08             	sub    $0x8,%esp
+    1888:	6a 00                	push   $0x0
+    188a:	ff 75 08             	push   0x8(%ebp)
+    188d:	e8 f1 00 00 00       	call   1983 <open>
+  if(fd < 0)
+    1892:	83 c4 10             	add    $0x10,%esp
+    1895:	85 c0                	test   %eax,%eax
+    1897:	78 27                	js     18c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1899:	83 ec 08             	sub    $0x8,%esp
+    189c:	ff 75 0c             	push   0xc(%ebp)
+    189f:	89 c3                	mov    %eax,%ebx
+    18a1:	50                   	push   %eax
+    18a2:	e8 f4 00 00 00       	call   199b <fstat>
+  close(fd);
+    18a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    18aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+    18ac:	e8 ba 00 00 00       	call   196b <close>
+  return r;
+    18b1:	83 c4 10             	add    $0x10,%esp
+}
+    18b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    18b7:	89 f0                	mov    %esi,%eax
+    18b9:	5b                   	pop    %ebx
+    18ba:	5e                   	pop    %esi
+    18bb:	5d                   	pop    %ebp
+    18bc:	c3                   	ret
+    18bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    18c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    18c5:	eb ed                	jmp    18b4 <stat+0x34>
+    18c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ce:	66 90                	xchg   %ax,%ax
+
+000018d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    18d0:	55                   	push   %ebp
+    18d1:	89 e5                	mov    %esp,%ebp
+    18d3:	53                   	push   %ebx
+    18d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    18d7:	0f be 02             	movsbl (%edx),%eax
+    18da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    18dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    18e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    18e5:	77 1e                	ja     1905 <atoi+0x35>
+    18e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    18f0:	83 c2 01             	add    $0x1,%edx
+    18f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    18f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    18fa:	0f be 02             	movsbl (%edx),%eax
+    18fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    1900:	80 fb 09             	cmp    $0x9,%bl
+    1903:	76 eb                	jbe    18f0 <atoi+0x20>
+  return n;
+}
+    1905:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1908:	89 c8                	mov    %ecx,%eax
+    190a:	c9                   	leave
+    190b:	c3                   	ret
+    190c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001910 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    1910:	55                   	push   %ebp
+    1911:	89 e5                	mov    %esp,%ebp
+    1913:	57                   	push   %edi
+    1914:	56                   	push   %esi
+    1915:	8b 45 10             	mov    0x10(%ebp),%eax
+    1918:	8b 55 08             	mov    0x8(%ebp),%edx
+    191b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    191e:	85 c0                	test   %eax,%eax
+    1920:	7e 13                	jle    1935 <memmove+0x25>
+    1922:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    1924:	89 d7                	mov    %edx,%edi
+    1926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    192d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1930:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1931:	39 f8                	cmp    %edi,%eax
+    1933:	75 fb                	jne    1930 <memmove+0x20>
+  return vdst;
+}
+    1935:	5e                   	pop    %esi
+    1936:	89 d0                	mov    %edx,%eax
+    1938:	5f                   	pop    %edi
+    1939:	5d                   	pop    %ebp
+    193a:	c3                   	ret
+
+0000193b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    193b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1940:	cd 40                	int    $0x40
+    1942:	c3                   	ret
+
+00001943 <exit>:
+SYSCALL(exit)
+    1943:	b8 02 00 00 00       	mov    $0x2,%eax
+    1948:	cd 40                	int    $0x40
+    194a:	c3                   	ret
+
+0000194b <wait>:
+SYSCALL(wait)
+    194b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1950:	cd 40                	int    $0x40
+    1952:	c3                   	ret
+
+00001953 <pipe>:
+SYSCALL(pipe)
+    1953:	b8 04 00 00 00       	mov    $0x4,%eax
+    1958:	cd 40                	int    $0x40
+    195a:	c3                   	ret
+
+0000195b <read>:
+SYSCALL(read)
+    195b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1960:	cd 40                	int    $0x40
+    1962:	c3                   	ret
+
+00001963 <write>:
+SYSCALL(write)
+    1963:	b8 10 00 00 00       	mov    $0x10,%eax
+    1968:	cd 40                	int    $0x40
+    196a:	c3                   	ret
+
+0000196b <close>:
+SYSCALL(close)
+    196b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1970:	cd 40                	int    $0x40
+    1972:	c3                   	ret
+
+00001973 <kill>:
+SYSCALL(kill)
+    1973:	b8 06 00 00 00       	mov    $0x6,%eax
+    1978:	cd 40                	int    $0x40
+    197a:	c3                   	ret
+
+0000197b <exec>:
+SYSCALL(exec)
+    197b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1980:	cd 40                	int    $0x40
+    1982:	c3                   	ret
+
+00001983 <open>:
+SYSCALL(open)
+    1983:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1988:	cd 40                	int    $0x40
+    198a:	c3                   	ret
+
+0000198b <mknod>:
+SYSCALL(mknod)
+    198b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1990:	cd 40                	int    $0x40
+    1992:	c3                   	ret
+
+00001993 <unlink>:
+SYSCALL(unlink)
+    1993:	b8 12 00 00 00       	mov    $0x12,%eax
+    1998:	cd 40                	int    $0x40
+    199a:	c3                   	ret
+
+0000199b <fstat>:
+SYSCALL(fstat)
+    199b:	b8 08 00 00 00       	mov    $0x8,%eax
+    19a0:	cd 40                	int    $0x40
+    19a2:	c3                   	ret
+
+000019a3 <link>:
+SYSCALL(link)
+    19a3:	b8 13 00 00 00       	mov    $0x13,%eax
+    19a8:	cd 40                	int    $0x40
+    19aa:	c3                   	ret
+
+000019ab <mkdir>:
+SYSCALL(mkdir)
+    19ab:	b8 14 00 00 00       	mov    $0x14,%eax
+    19b0:	cd 40                	int    $0x40
+    19b2:	c3                   	ret
+
+000019b3 <chdir>:
+SYSCALL(chdir)
+    19b3:	b8 09 00 00 00       	mov    $0x9,%eax
+    19b8:	cd 40                	int    $0x40
+    19ba:	c3                   	ret
+
+000019bb <dup>:
+SYSCALL(dup)
+    19bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    19c0:	cd 40                	int    $0x40
+    19c2:	c3                   	ret
+
+000019c3 <getpid>:
+SYSCALL(getpid)
+    19c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    19c8:	cd 40                	int    $0x40
+    19ca:	c3                   	ret
+
+000019cb <sbrk>:
+SYSCALL(sbrk)
+    19cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    19d0:	cd 40                	int    $0x40
+    19d2:	c3                   	ret
+
+000019d3 <sleep>:
+SYSCALL(sleep)
+    19d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    19d8:	cd 40                	int    $0x40
+    19da:	c3                   	ret
+
+000019db <uptime>:
+SYSCALL(uptime)
+    19db:	b8 0e 00 00 00       	mov    $0xe,%eax
+    19e0:	cd 40                	int    $0x40
+    19e2:	c3                   	ret
+
+000019e3 <trace>:
+SYSCALL(trace)
+    19e3:	b8 16 00 00 00       	mov    $0x16,%eax
+    19e8:	cd 40                	int    $0x40
+    19ea:	c3                   	ret
+
+000019eb <csinfo>:
+SYSCALL(csinfo)
+    19eb:	b8 17 00 00 00       	mov    $0x17,%eax
+    19f0:	cd 40                	int    $0x40
+    19f2:	c3                   	ret
+
+000019f3 <settickets>:
+SYSCALL(settickets)
+    19f3:	b8 18 00 00 00       	mov    $0x18,%eax
+    19f8:	cd 40                	int    $0x40
+    19fa:	c3                   	ret
+
+000019fb <getprocessesinfo>:
+SYSCALL(getprocessesinfo)
+    19fb:	b8 19 00 00 00       	mov    $0x19,%eax
+    1a00:	cd 40                	int    $0x40
+    1a02:	c3                   	ret
+
+00001a03 <yield>:
+SYSCALL(yield)
+    1a03:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1a08:	cd 40                	int    $0x40
+    1a0a:	c3                   	ret
+
+00001a0b <random>:
+SYSCALL(random)
+    1a0b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1a10:	cd 40                	int    $0x40
+    1a12:	c3                   	ret
+
+00001a13 <dumppagetable>:
+SYSCALL(dumppagetable)
+    1a13:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1a18:	cd 40                	int    $0x40
+    1a1a:	c3                   	ret
+
+00001a1b <getcpusinfo>:
+SYSCALL(getcpusinfo)
+    1a1b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1a20:	cd 40                	int    $0x40
+    1a22:	c3                   	ret
+
+00001a23 <setsched>:
+SYSCALL(setsched)
+    1a23:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1a28:	cd 40                	int    $0x40
+    1a2a:	c3                   	ret
+
+00001a2b <getbcacheinfo>:
+SYSCALL(getbcacheinfo)
+    1a2b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1a30:	cd 40                	int    $0x40
+    1a32:	c3                   	ret
+
+00001a33 <getballocinfo>:
+SYSCALL(getballocinfo)
+    1a33:	b8 20 00 00 00       	mov    $0x20,%eax
+    1a38:	cd 40                	int    $0x40
+    1a3a:	c3                   	ret
+
+00001a3b <getfaultinfo>:
+SYSCALL(getfaultinfo)
+    1a3b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1a40:	cd 40                	int    $0x40
+    1a42:	c3                   	ret
+    1a43:	66 90                	xchg   %ax,%ax
+    1a45:	66 90                	xchg   %ax,%ax
+    1a47:	66 90                	xchg   %ax,%ax
+    1a49:	66 90                	xchg   %ax,%ax
+    1a4b:	66 90                	xchg   %ax,%ax
+    1a4d:	66 90                	xchg   %ax,%ax
+    1a4f:	90                   	nop
+
+00001a50 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1a50:	55                   	push   %ebp
+    1a51:	89 e5                	mov    %esp,%ebp
+    1a53:	57                   	push   %edi
+    1a54:	56                   	push   %esi
+    1a55:	53                   	push   %ebx
+    1a56:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1a58:	89 d1                	mov    %edx,%ecx
+{
+    1a5a:	83 ec 3c             	sub    $0x3c,%esp
+    1a5d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1a60:	85 d2                	test   %edx,%edx
+    1a62:	0f 89 80 00 00 00    	jns    1ae8 <printint+0x98>
+    1a68:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    1a6c:	74 7a                	je     1ae8 <printint+0x98>
+    x = -xx;
+    1a6e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1a70:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1a75:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1a78:	31 f6                	xor    %esi,%esi
+    1a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1a80:	89 c8                	mov    %ecx,%eax
+    1a82:	31 d2                	xor    %edx,%edx
+    1a84:	89 f7                	mov    %esi,%edi
+    1a86:	f7 f3                	div    %ebx
+    1a88:	8d 76 01             	lea    0x1(%esi),%esi
+    1a8b:	0f b6 92 90 24 00 00 	movzbl 0x2490(%edx),%edx
+    1a92:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1a96:	89 ca                	mov    %ecx,%edx
+    1a98:	89 c1                	mov    %eax,%ecx
+    1a9a:	39 da                	cmp    %ebx,%edx
+    1a9c:	73 e2                	jae    1a80 <printint+0x30>
+  if(neg)
+    1a9e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1aa1:	85 c0                	test   %eax,%eax
+    1aa3:	74 07                	je     1aac <printint+0x5c>
+    buf[i++] = '-';
+    1aa5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    1aaa:	89 f7                	mov    %esi,%edi
+    1aac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    1aaf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1ab2:	01 df                	add    %ebx,%edi
+    1ab4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1ab8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    1abb:	83 ec 04             	sub    $0x4,%esp
+    1abe:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1ac1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1ac4:	6a 01                	push   $0x1
+    1ac6:	50                   	push   %eax
+    1ac7:	56                   	push   %esi
+    1ac8:	e8 96 fe ff ff       	call   1963 <write>
+  while(--i >= 0)
+    1acd:	89 f8                	mov    %edi,%eax
+    1acf:	83 c4 10             	add    $0x10,%esp
+    1ad2:	83 ef 01             	sub    $0x1,%edi
+    1ad5:	39 d8                	cmp    %ebx,%eax
+    1ad7:	75 df                	jne    1ab8 <printint+0x68>
+}
+    1ad9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1adc:	5b                   	pop    %ebx
+    1add:	5e                   	pop    %esi
+    1ade:	5f                   	pop    %edi
+    1adf:	5d                   	pop    %ebp
+    1ae0:	c3                   	ret
+    1ae1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1ae8:	31 c0                	xor    %eax,%eax
+    1aea:	eb 89                	jmp    1a75 <printint+0x25>
+    1aec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001af0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    1af0:	55                   	push   %ebp
+    1af1:	89 e5                	mov    %esp,%ebp
+    1af3:	57                   	push   %edi
+    1af4:	56                   	push   %esi
+    1af5:	53                   	push   %ebx
+    1af6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1af9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    1afc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    1aff:	0f b6 1e             	movzbl (%esi),%ebx
+    1b02:	83 c6 01             	add    $0x1,%esi
+    1b05:	84 db                	test   %bl,%bl
+    1b07:	74 67                	je     1b70 <printf+0x80>
+    1b09:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    1b0c:	31 d2                	xor    %edx,%edx
+    1b0e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1b11:	eb 34                	jmp    1b47 <printf+0x57>
+    1b13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1b17:	90                   	nop
+    1b18:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    1b1b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1b20:	83 f8 25             	cmp    $0x25,%eax
+    1b23:	74 18                	je     1b3d <printf+0x4d>
+  write(fd, &c, 1);
+    1b25:	83 ec 04             	sub    $0x4,%esp
+    1b28:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    1b2b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1b2e:	6a 01                	push   $0x1
+    1b30:	50                   	push   %eax
+    1b31:	57                   	push   %edi
+    1b32:	e8 2c fe ff ff       	call   1963 <write>
+    1b37:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    1b3a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    1b3d:	0f b6 1e             	movzbl (%esi),%ebx
+    1b40:	83 c6 01             	add    $0x1,%esi
+    1b43:	84 db                	test   %bl,%bl
+    1b45:	74 29                	je     1b70 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1b47:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    1b4a:	85 d2                	test   %edx,%edx
+    1b4c:	74 ca                	je     1b18 <printf+0x28>
+      }
+    } else if(state == '%'){
+    1b4e:	83 fa 25             	cmp    $0x25,%edx
+    1b51:	75 ea                	jne    1b3d <printf+0x4d>
+      if(c == 'd'){
+    1b53:	83 f8 25             	cmp    $0x25,%eax
+    1b56:	0f 84 24 01 00 00    	je     1c80 <printf+0x190>
+    1b5c:	83 e8 63             	sub    $0x63,%eax
+    1b5f:	83 f8 15             	cmp    $0x15,%eax
+    1b62:	77 1c                	ja     1b80 <printf+0x90>
+    1b64:	ff 24 85 38 24 00 00 	jmp    *0x2438(,%eax,4)
+    1b6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1b6f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1b70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b73:	5b                   	pop    %ebx
+    1b74:	5e                   	pop    %esi
+    1b75:	5f                   	pop    %edi
+    1b76:	5d                   	pop    %ebp
+    1b77:	c3                   	ret
+    1b78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b7f:	90                   	nop
+  write(fd, &c, 1);
+    1b80:	83 ec 04             	sub    $0x4,%esp
+    1b83:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1b86:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    1b8a:	6a 01                	push   $0x1
+    1b8c:	52                   	push   %edx
+    1b8d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1b90:	57                   	push   %edi
+    1b91:	e8 cd fd ff ff       	call   1963 <write>
+    1b96:	83 c4 0c             	add    $0xc,%esp
+    1b99:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1b9c:	6a 01                	push   $0x1
+    1b9e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1ba1:	52                   	push   %edx
+    1ba2:	57                   	push   %edi
+    1ba3:	e8 bb fd ff ff       	call   1963 <write>
+        putc(fd, c);
+    1ba8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1bab:	31 d2                	xor    %edx,%edx
+    1bad:	eb 8e                	jmp    1b3d <printf+0x4d>
+    1baf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1bb0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1bb3:	83 ec 0c             	sub    $0xc,%esp
+    1bb6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    1bbb:	8b 13                	mov    (%ebx),%edx
+    1bbd:	6a 00                	push   $0x0
+    1bbf:	89 f8                	mov    %edi,%eax
+        ap++;
+    1bc1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1bc4:	e8 87 fe ff ff       	call   1a50 <printint>
+        ap++;
+    1bc9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1bcc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1bcf:	31 d2                	xor    %edx,%edx
+    1bd1:	e9 67 ff ff ff       	jmp    1b3d <printf+0x4d>
+    1bd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bdd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1be0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1be3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1be5:	83 c0 04             	add    $0x4,%eax
+    1be8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    1beb:	85 db                	test   %ebx,%ebx
+    1bed:	0f 84 9d 00 00 00    	je     1c90 <printf+0x1a0>
+        while(*s != 0){
+    1bf3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1bf6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1bf8:	84 c0                	test   %al,%al
+    1bfa:	0f 84 3d ff ff ff    	je     1b3d <printf+0x4d>
+    1c00:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1c03:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1c06:	89 de                	mov    %ebx,%esi
+    1c08:	89 d3                	mov    %edx,%ebx
+    1c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1c10:	83 ec 04             	sub    $0x4,%esp
+    1c13:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1c16:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1c19:	6a 01                	push   $0x1
+    1c1b:	53                   	push   %ebx
+    1c1c:	57                   	push   %edi
+    1c1d:	e8 41 fd ff ff       	call   1963 <write>
+        while(*s != 0){
+    1c22:	0f b6 06             	movzbl (%esi),%eax
+    1c25:	83 c4 10             	add    $0x10,%esp
+    1c28:	84 c0                	test   %al,%al
+    1c2a:	75 e4                	jne    1c10 <printf+0x120>
+      state = 0;
+    1c2c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    1c2f:	31 d2                	xor    %edx,%edx
+    1c31:	e9 07 ff ff ff       	jmp    1b3d <printf+0x4d>
+    1c36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c3d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1c40:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1c43:	83 ec 0c             	sub    $0xc,%esp
+    1c46:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1c4b:	8b 13                	mov    (%ebx),%edx
+    1c4d:	6a 01                	push   $0x1
+    1c4f:	e9 6b ff ff ff       	jmp    1bbf <printf+0xcf>
+    1c54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1c58:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    1c5b:	83 ec 04             	sub    $0x4,%esp
+    1c5e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1c61:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1c63:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1c66:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1c69:	6a 01                	push   $0x1
+    1c6b:	52                   	push   %edx
+    1c6c:	57                   	push   %edi
+    1c6d:	e8 f1 fc ff ff       	call   1963 <write>
+        ap++;
+    1c72:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1c75:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1c78:	31 d2                	xor    %edx,%edx
+    1c7a:	e9 be fe ff ff       	jmp    1b3d <printf+0x4d>
+    1c7f:	90                   	nop
+  write(fd, &c, 1);
+    1c80:	83 ec 04             	sub    $0x4,%esp
+    1c83:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1c86:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1c89:	6a 01                	push   $0x1
+    1c8b:	e9 11 ff ff ff       	jmp    1ba1 <printf+0xb1>
+    1c90:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1c95:	bb 30 24 00 00       	mov    $0x2430,%ebx
+    1c9a:	e9 61 ff ff ff       	jmp    1c00 <printf+0x110>
+    1c9f:	90                   	nop
+
+00001ca0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1ca0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1ca1:	a1 f0 45 00 00       	mov    0x45f0,%eax
+{
+    1ca6:	89 e5                	mov    %esp,%ebp
+    1ca8:	57                   	push   %edi
+    1ca9:	56                   	push   %esi
+    1caa:	53                   	push   %ebx
+    1cab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    1cae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1cb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cb8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1cba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1cbc:	39 ca                	cmp    %ecx,%edx
+    1cbe:	73 30                	jae    1cf0 <free+0x50>
+    1cc0:	39 c1                	cmp    %eax,%ecx
+    1cc2:	72 04                	jb     1cc8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1cc4:	39 c2                	cmp    %eax,%edx
+    1cc6:	72 f0                	jb     1cb8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1cc8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    1ccb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    1cce:	39 f8                	cmp    %edi,%eax
+    1cd0:	74 2e                	je     1d00 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1cd2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1cd5:	8b 42 04             	mov    0x4(%edx),%eax
+    1cd8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1cdb:	39 f1                	cmp    %esi,%ecx
+    1cdd:	74 38                	je     1d17 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    1cdf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1ce1:	5b                   	pop    %ebx
+  freep = p;
+    1ce2:	89 15 f0 45 00 00    	mov    %edx,0x45f0
+}
+    1ce8:	5e                   	pop    %esi
+    1ce9:	5f                   	pop    %edi
+    1cea:	5d                   	pop    %ebp
+    1ceb:	c3                   	ret
+    1cec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1cf0:	39 c1                	cmp    %eax,%ecx
+    1cf2:	72 d0                	jb     1cc4 <free+0x24>
+    1cf4:	eb c2                	jmp    1cb8 <free+0x18>
+    1cf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1cfd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1d00:	03 70 04             	add    0x4(%eax),%esi
+    1d03:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1d06:	8b 02                	mov    (%edx),%eax
+    1d08:	8b 00                	mov    (%eax),%eax
+    1d0a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    1d0d:	8b 42 04             	mov    0x4(%edx),%eax
+    1d10:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1d13:	39 f1                	cmp    %esi,%ecx
+    1d15:	75 c8                	jne    1cdf <free+0x3f>
+    p->s.size += bp->s.size;
+    1d17:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    1d1a:	89 15 f0 45 00 00    	mov    %edx,0x45f0
+    p->s.size += bp->s.size;
+    1d20:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1d23:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1d26:	89 0a                	mov    %ecx,(%edx)
+}
+    1d28:	5b                   	pop    %ebx
+    1d29:	5e                   	pop    %esi
+    1d2a:	5f                   	pop    %edi
+    1d2b:	5d                   	pop    %ebp
+    1d2c:	c3                   	ret
+    1d2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001d30 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1d30:	55                   	push   %ebp
+    1d31:	89 e5                	mov    %esp,%ebp
+    1d33:	57                   	push   %edi
+    1d34:	56                   	push   %esi
+    1d35:	53                   	push   %ebx
+    1d36:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1d39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    1d3c:	8b 15 f0 45 00 00    	mov    0x45f0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1d42:	8d 78 07             	lea    0x7(%eax),%edi
+    1d45:	c1 ef 03             	shr    $0x3,%edi
+    1d48:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    1d4b:	85 d2                	test   %edx,%edx
+    1d4d:	0f 84 8d 00 00 00    	je     1de0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1d53:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1d55:	8b 48 04             	mov    0x4(%eax),%ecx
+    1d58:	39 f9                	cmp    %edi,%ecx
+    1d5a:	73 64                	jae    1dc0 <malloc+0x90>
+  if(nu < 4096)
+    1d5c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1d61:	39 df                	cmp    %ebx,%edi
+    1d63:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1d66:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    1d6d:	eb 0a                	jmp    1d79 <malloc+0x49>
+    1d6f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1d70:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1d72:	8b 48 04             	mov    0x4(%eax),%ecx
+    1d75:	39 f9                	cmp    %edi,%ecx
+    1d77:	73 47                	jae    1dc0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1d79:	89 c2                	mov    %eax,%edx
+    1d7b:	39 05 f0 45 00 00    	cmp    %eax,0x45f0
+    1d81:	75 ed                	jne    1d70 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1d83:	83 ec 0c             	sub    $0xc,%esp
+    1d86:	56                   	push   %esi
+    1d87:	e8 3f fc ff ff       	call   19cb <sbrk>
+  if(p == (char*)-1)
+    1d8c:	83 c4 10             	add    $0x10,%esp
+    1d8f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1d92:	74 1c                	je     1db0 <malloc+0x80>
+  hp->s.size = nu;
+    1d94:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1d97:	83 ec 0c             	sub    $0xc,%esp
+    1d9a:	83 c0 08             	add    $0x8,%eax
+    1d9d:	50                   	push   %eax
+    1d9e:	e8 fd fe ff ff       	call   1ca0 <free>
+  return freep;
+    1da3:	8b 15 f0 45 00 00    	mov    0x45f0,%edx
+      if((p = morecore(nunits)) == 0)
+    1da9:	83 c4 10             	add    $0x10,%esp
+    1dac:	85 d2                	test   %edx,%edx
+    1dae:	75 c0                	jne    1d70 <malloc+0x40>
+        return 0;
+  }
+}
+    1db0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1db3:	31 c0                	xor    %eax,%eax
+}
+    1db5:	5b                   	pop    %ebx
+    1db6:	5e                   	pop    %esi
+    1db7:	5f                   	pop    %edi
+    1db8:	5d                   	pop    %ebp
+    1db9:	c3                   	ret
+    1dba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1dc0:	39 cf                	cmp    %ecx,%edi
+    1dc2:	74 4c                	je     1e10 <malloc+0xe0>
+        p->s.size -= nunits;
+    1dc4:	29 f9                	sub    %edi,%ecx
+    1dc6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1dc9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    1dcc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    1dcf:	89 15 f0 45 00 00    	mov    %edx,0x45f0
+}
+    1dd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1dd8:	83 c0 08             	add    $0x8,%eax
+}
+    1ddb:	5b                   	pop    %ebx
+    1ddc:	5e                   	pop    %esi
+    1ddd:	5f                   	pop    %edi
+    1dde:	5d                   	pop    %ebp
+    1ddf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1de0:	c7 05 f0 45 00 00 f4 	movl   $0x45f4,0x45f0
+    1de7:	45 00 00 
+    base.s.size = 0;
+    1dea:	b8 f4 45 00 00       	mov    $0x45f4,%eax
+    base.s.ptr = freep = prevp = &base;
+    1def:	c7 05 f4 45 00 00 f4 	movl   $0x45f4,0x45f4
+    1df6:	45 00 00 
+    base.s.size = 0;
+    1df9:	c7 05 f8 45 00 00 00 	movl   $0x0,0x45f8
+    1e00:	00 00 00 
+    if(p->s.size >= nunits){
+    1e03:	e9 54 ff ff ff       	jmp    1d5c <malloc+0x2c>
+    1e08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e0f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1e10:	8b 08                	mov    (%eax),%ecx
+    1e12:	89 0a                	mov    %ecx,(%edx)
+    1e14:	eb b9                	jmp    1dcf <malloc+0x9f>
@@ -1,6 +1,7 @@
 #include "types.h"
 #include "mmu.h"
 #include "param.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "user.h"
 #include "arith64.c" 
@@ -493,11 +494,68 @@ void run_test_case(struct test_case* test) {
     printf(1, "%s: passed %d of %d\n", test->name, test->total_tests - test->errors, test->total_tests);
 }
 
+/* return the largest relative error between a child's observed and
+   expected share of ticks, in tenths of a percent. children expected
+   to get no ticks (io-wait, exit) are ignored.
+ */
+int max_share_deviation(struct test_case *test) {
+    int i, max_deviation = 0;
+    long long expect_ticks_total = 0;
+    for (i = 0; i < test->num_children; ++i) {
+        expect_ticks_total += test->expect_ticks_unscaled[i];
+    }
+    for (i = 0; i < test->num_children; ++i) {
+        long long scaled_expected = ((long long) test->expect_ticks_unscaled[i] * test->total_actual_ticks) / expect_ticks_total;
+        if (scaled_expected == 0)
+            continue;
+        long long delta = test->actual_ticks[i] - scaled_expected;
+        if (delta < 0)
+            delta = -delta;
+        int deviation = (int) (delta * 1000 / scaled_expected);
+        if (deviation > max_deviation)
+            max_deviation = deviation;
+    }
+    return max_deviation;
+}
+
+/* run every multi-process scenario once under each scheduling
+   policy and report the worst share deviation side by side.
+ */
+void compare_policies(void) {
+    int i, policy, deviation[2];
+    int old_policy = setsched(SCHED_LOTTERY);
+    printf(1, "max share deviation (%% of expected ticks)\n");
+    printf(1, "lottery\tstride\tscenario\n");
+    for (i = 0; tests[i].name; ++i) {
+        struct test_case *test = &tests[i];
+        if (test->num_children < 2)
+            continue;
+        for (policy = SCHED_LOTTERY; policy <= SCHED_STRIDE; ++policy) {
+            int pids[MAX_CHILDREN];
+            struct processes_info before, after;
+            setsched(policy);
+            test->total_tests = test->errors = 0;
+            execute_and_get_info(test, pids, &before, &after);
+            count_ticks(test, pids, &before, &after);
+            deviation[policy] = max_share_deviation(test);
+        }
+        printf(1, "%d.%d%%\t%d.%d%%\t%s\n",
+            deviation[SCHED_LOTTERY] / 10, deviation[SCHED_LOTTERY] % 10,
+            deviation[SCHED_STRIDE] / 10, deviation[SCHED_STRIDE] % 10,
+            test->name);
+    }
+    setsched(old_policy);
+}
+
 int main(int argc, char *argv[])
 {
     int total_tests = 0;
     int passed_tests = 0;
     int i;
+    if (argc > 1 && strcmp(argv[1], "-c") == 0) {
+        compare_policies();
+        exit();
+    }
     for (i = 0; tests[i].name; ++i) {
         struct test_case *test = &tests[i];
         run_test_case(test);
@@ -0,0 +1,1484 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 01 00 00 00       	mov    $0x1,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 1f                	jle    42 <main+0x42>
+  23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  27:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+  2e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+  31:	e8 ca 00 00 00       	call   100 <ls>
+  for(i=1; i<argc; i++)
+  36:	83 c4 10             	add    $0x10,%esp
+  39:	39 de                	cmp    %ebx,%esi
+  3b:	75 eb                	jne    28 <main+0x28>
+  exit();
+  3d:	e8 41 05 00 00       	call   583 <exit>
+    ls(".");
+  42:	83 ec 0c             	sub    $0xc,%esp
+  45:	68 a0 0a 00 00       	push   $0xaa0
+  4a:	e8 b1 00 00 00       	call   100 <ls>
+    exit();
+  4f:	e8 2f 05 00 00       	call   583 <exit>
+  54:	66 90                	xchg   %ax,%ax
+  56:	66 90                	xchg   %ax,%ax
+  58:	66 90                	xchg   %ax,%ax
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fmtname>:
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	56                   	push   %esi
+  64:	53                   	push   %ebx
+  65:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+  68:	83 ec 0c             	sub    $0xc,%esp
+  6b:	56                   	push   %esi
+  6c:	e8 5f 03 00 00       	call   3d0 <strlen>
+  71:	83 c4 10             	add    $0x10,%esp
+  74:	01 f0                	add    %esi,%eax
+  76:	89 c3                	mov    %eax,%ebx
+  78:	73 0f                	jae    89 <fmtname+0x29>
+  7a:	eb 12                	jmp    8e <fmtname+0x2e>
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  83:	39 f0                	cmp    %esi,%eax
+  85:	72 0a                	jb     91 <fmtname+0x31>
+  87:	89 c3                	mov    %eax,%ebx
+  89:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  8c:	75 f2                	jne    80 <fmtname+0x20>
+  p++;
+  8e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+  91:	83 ec 0c             	sub    $0xc,%esp
+  94:	53                   	push   %ebx
+  95:	e8 36 03 00 00       	call   3d0 <strlen>
+  9a:	83 c4 10             	add    $0x10,%esp
+  9d:	83 f8 0d             	cmp    $0xd,%eax
+  a0:	77 4a                	ja     ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+  a2:	83 ec 0c             	sub    $0xc,%esp
+  a5:	53                   	push   %ebx
+  a6:	e8 25 03 00 00       	call   3d0 <strlen>
+  ab:	83 c4 0c             	add    $0xc,%esp
+  ae:	50                   	push   %eax
+  af:	53                   	push   %ebx
+  b0:	68 28 0e 00 00       	push   $0xe28
+  b5:	e8 96 04 00 00       	call   550 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ba:	89 1c 24             	mov    %ebx,(%esp)
+  bd:	e8 0e 03 00 00       	call   3d0 <strlen>
+  c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+  c5:	bb 28 0e 00 00       	mov    $0xe28,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ca:	89 c6                	mov    %eax,%esi
+  cc:	e8 ff 02 00 00       	call   3d0 <strlen>
+  d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+  d6:	83 c4 0c             	add    $0xc,%esp
+  d9:	29 f2                	sub    %esi,%edx
+  db:	05 28 0e 00 00       	add    $0xe28,%eax
+  e0:	52                   	push   %edx
+  e1:	6a 20                	push   $0x20
+  e3:	50                   	push   %eax
+  e4:	e8 17 03 00 00       	call   400 <memset>
+  return buf;
+  e9:	83 c4 10             	add    $0x10,%esp
+}
+  ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  ef:	89 d8                	mov    %ebx,%eax
+  f1:	5b                   	pop    %ebx
+  f2:	5e                   	pop    %esi
+  f3:	5d                   	pop    %ebp
+  f4:	c3                   	ret
+  f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <ls>:
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	56                   	push   %esi
+ 105:	53                   	push   %ebx
+ 106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+ 10c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+ 10f:	6a 00                	push   $0x0
+ 111:	57                   	push   %edi
+ 112:	e8 ac 04 00 00       	call   5c3 <open>
+ 117:	83 c4 10             	add    $0x10,%esp
+ 11a:	85 c0                	test   %eax,%eax
+ 11c:	0f 88 9e 01 00 00    	js     2c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+ 122:	83 ec 08             	sub    $0x8,%esp
+ 125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+ 12b:	89 c3                	mov    %eax,%ebx
+ 12d:	56                   	push   %esi
+ 12e:	50                   	push   %eax
+ 12f:	e8 a7 04 00 00       	call   5db <fstat>
+ 134:	83 c4 10             	add    $0x10,%esp
+ 137:	85 c0                	test   %eax,%eax
+ 139:	0f 88 c1 01 00 00    	js     300 <ls+0x200>
+  switch(st.type){
+ 13f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+ 146:	66 83 f8 01          	cmp    $0x1,%ax
+ 14a:	74 64                	je     1b0 <ls+0xb0>
+ 14c:	66 83 f8 02          	cmp    $0x2,%ax
+ 150:	74 1e                	je     170 <ls+0x70>
+  close(fd);
+ 152:	83 ec 0c             	sub    $0xc,%esp
+ 155:	53                   	push   %ebx
+ 156:	e8 50 04 00 00       	call   5ab <close>
+ 15b:	83 c4 10             	add    $0x10,%esp
+}
+ 15e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 161:	5b                   	pop    %ebx
+ 162:	5e                   	pop    %esi
+ 163:	5f                   	pop    %edi
+ 164:	5d                   	pop    %ebp
+ 165:	c3                   	ret
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+ 176:	83 ec 0c             	sub    $0xc,%esp
+ 179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+ 17f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+ 185:	57                   	push   %edi
+ 186:	e8 d5 fe ff ff       	call   60 <fmtname>
+ 18b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+ 191:	59                   	pop    %ecx
+ 192:	5f                   	pop    %edi
+ 193:	52                   	push   %edx
+ 194:	56                   	push   %esi
+ 195:	6a 02                	push   $0x2
+ 197:	50                   	push   %eax
+ 198:	68 80 0a 00 00       	push   $0xa80
+ 19d:	6a 01                	push   $0x1
+ 19f:	e8 8c 05 00 00       	call   730 <printf>
+    break;
+ 1a4:	83 c4 20             	add    $0x20,%esp
+ 1a7:	eb a9                	jmp    152 <ls+0x52>
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 1b0:	83 ec 0c             	sub    $0xc,%esp
+ 1b3:	57                   	push   %edi
+ 1b4:	e8 17 02 00 00       	call   3d0 <strlen>
+ 1b9:	83 c4 10             	add    $0x10,%esp
+ 1bc:	83 c0 10             	add    $0x10,%eax
+ 1bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1c4:	0f 87 16 01 00 00    	ja     2e0 <ls+0x1e0>
+    strcpy(buf, path);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	57                   	push   %edi
+ 1ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+ 1d4:	57                   	push   %edi
+ 1d5:	e8 66 01 00 00       	call   340 <strcpy>
+    p = buf+strlen(buf);
+ 1da:	89 3c 24             	mov    %edi,(%esp)
+ 1dd:	e8 ee 01 00 00       	call   3d0 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+ 1e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+ 1e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+ 1ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+ 1f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+ 1f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 200:	83 ec 04             	sub    $0x4,%esp
+ 203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+ 209:	6a 10                	push   $0x10
+ 20b:	50                   	push   %eax
+ 20c:	53                   	push   %ebx
+ 20d:	e8 89 03 00 00       	call   59b <read>
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	83 f8 10             	cmp    $0x10,%eax
+ 218:	0f 85 34 ff ff ff    	jne    152 <ls+0x52>
+      if(de.inum == 0)
+ 21e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+ 225:	00 
+ 226:	74 d8                	je     200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+ 228:	83 ec 04             	sub    $0x4,%esp
+ 22b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+ 231:	6a 0e                	push   $0xe
+ 233:	50                   	push   %eax
+ 234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+ 23a:	e8 11 03 00 00       	call   550 <memmove>
+      p[DIRSIZ] = 0;
+ 23f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+ 245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+ 249:	58                   	pop    %eax
+ 24a:	5a                   	pop    %edx
+ 24b:	56                   	push   %esi
+ 24c:	57                   	push   %edi
+ 24d:	e8 6e 02 00 00       	call   4c0 <stat>
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	0f 88 cb 00 00 00    	js     328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 25d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+ 263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+ 269:	83 ec 0c             	sub    $0xc,%esp
+ 26c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+ 273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+ 279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+ 27f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+ 285:	57                   	push   %edi
+ 286:	e8 d5 fd ff ff       	call   60 <fmtname>
+ 28b:	5a                   	pop    %edx
+ 28c:	59                   	pop    %ecx
+ 28d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+ 293:	51                   	push   %ecx
+ 294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+ 29a:	52                   	push   %edx
+ 29b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 2a1:	50                   	push   %eax
+ 2a2:	68 80 0a 00 00       	push   $0xa80
+ 2a7:	6a 01                	push   $0x1
+ 2a9:	e8 82 04 00 00       	call   730 <printf>
+ 2ae:	83 c4 20             	add    $0x20,%esp
+ 2b1:	e9 4a ff ff ff       	jmp    200 <ls+0x100>
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	57                   	push   %edi
+ 2c4:	68 58 0a 00 00       	push   $0xa58
+ 2c9:	6a 02                	push   $0x2
+ 2cb:	e8 60 04 00 00       	call   730 <printf>
+    return;
+ 2d0:	83 c4 10             	add    $0x10,%esp
+}
+ 2d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2d6:	5b                   	pop    %ebx
+ 2d7:	5e                   	pop    %esi
+ 2d8:	5f                   	pop    %edi
+ 2d9:	5d                   	pop    %ebp
+ 2da:	c3                   	ret
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+      printf(1, "ls: path too long\n");
+ 2e0:	83 ec 08             	sub    $0x8,%esp
+ 2e3:	68 8d 0a 00 00       	push   $0xa8d
+ 2e8:	6a 01                	push   $0x1
+ 2ea:	e8 41 04 00 00       	call   730 <printf>
+      break;
+ 2ef:	83 c4 10             	add    $0x10,%esp
+ 2f2:	e9 5b fe ff ff       	jmp    152 <ls+0x52>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	57                   	push   %edi
+ 304:	68 6c 0a 00 00       	push   $0xa6c
+ 309:	6a 02                	push   $0x2
+ 30b:	e8 20 04 00 00       	call   730 <printf>
+    close(fd);
+ 310:	89 1c 24             	mov    %ebx,(%esp)
+ 313:	e8 93 02 00 00       	call   5ab <close>
+    return;
+ 318:	83 c4 10             	add    $0x10,%esp
+}
+ 31b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 31e:	5b                   	pop    %ebx
+ 31f:	5e                   	pop    %esi
+ 320:	5f                   	pop    %edi
+ 321:	5d                   	pop    %ebp
+ 322:	c3                   	ret
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+ 328:	83 ec 04             	sub    $0x4,%esp
+ 32b:	57                   	push   %edi
+ 32c:	68 6c 0a 00 00       	push   $0xa6c
+ 331:	6a 01                	push   $0x1
+ 333:	e8 f8 03 00 00       	call   730 <printf>
+        continue;
+ 338:	83 c4 10             	add    $0x10,%esp
+ 33b:	e9 c0 fe ff ff       	jmp    200 <ls+0x100>
+
+00000340 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 340:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 341:	31 c0                	xor    %eax,%eax
+{
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	53                   	push   %ebx
+ 346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 357:	83 c0 01             	add    $0x1,%eax
+ 35a:	84 d2                	test   %dl,%dl
+ 35c:	75 f2                	jne    350 <strcpy+0x10>
+    ;
+  return os;
+}
+ 35e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 361:	89 c8                	mov    %ecx,%eax
+ 363:	c9                   	leave
+ 364:	c3                   	ret
+ 365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	53                   	push   %ebx
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+ 377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 37a:	0f b6 02             	movzbl (%edx),%eax
+ 37d:	84 c0                	test   %al,%al
+ 37f:	75 17                	jne    398 <strcmp+0x28>
+ 381:	eb 3a                	jmp    3bd <strcmp+0x4d>
+ 383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 387:	90                   	nop
+ 388:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 38c:	83 c2 01             	add    $0x1,%edx
+ 38f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 392:	84 c0                	test   %al,%al
+ 394:	74 1a                	je     3b0 <strcmp+0x40>
+    p++, q++;
+ 396:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 398:	0f b6 19             	movzbl (%ecx),%ebx
+ 39b:	38 c3                	cmp    %al,%bl
+ 39d:	74 e9                	je     388 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 39f:	29 d8                	sub    %ebx,%eax
+}
+ 3a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a4:	c9                   	leave
+ 3a5:	c3                   	ret
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3b4:	31 c0                	xor    %eax,%eax
+ 3b6:	29 d8                	sub    %ebx,%eax
+}
+ 3b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3bb:	c9                   	leave
+ 3bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3c0:	31 c0                	xor    %eax,%eax
+ 3c2:	eb db                	jmp    39f <strcmp+0x2f>
+ 3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3d9:	74 15                	je     3f0 <strlen+0x20>
+ 3db:	31 c0                	xor    %eax,%eax
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3e0:	83 c0 01             	add    $0x1,%eax
+ 3e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3e7:	89 c1                	mov    %eax,%ecx
+ 3e9:	75 f5                	jne    3e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3eb:	89 c8                	mov    %ecx,%eax
+ 3ed:	5d                   	pop    %ebp
+ 3ee:	c3                   	ret
+ 3ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3f0:	31 c9                	xor    %ecx,%ecx
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	89 c8                	mov    %ecx,%eax
+ 3f5:	c3                   	ret
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 407:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 40a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40d:	89 d7                	mov    %edx,%edi
+ 40f:	fc                   	cld
+ 410:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 412:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 415:	89 d0                	mov    %edx,%eax
+ 417:	c9                   	leave
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 42a:	0f b6 10             	movzbl (%eax),%edx
+ 42d:	84 d2                	test   %dl,%dl
+ 42f:	75 12                	jne    443 <strchr+0x23>
+ 431:	eb 1d                	jmp    450 <strchr+0x30>
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+ 438:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 43c:	83 c0 01             	add    $0x1,%eax
+ 43f:	84 d2                	test   %dl,%dl
+ 441:	74 0d                	je     450 <strchr+0x30>
+    if(*s == c)
+ 443:	38 d1                	cmp    %dl,%cl
+ 445:	75 f1                	jne    438 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 447:	5d                   	pop    %ebp
+ 448:	c3                   	ret
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 450:	31 c0                	xor    %eax,%eax
+}
+ 452:	5d                   	pop    %ebp
+ 453:	c3                   	ret
+ 454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 465:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 468:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 469:	31 db                	xor    %ebx,%ebx
+{
+ 46b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 46e:	eb 27                	jmp    497 <gets+0x37>
+    cc = read(0, &c, 1);
+ 470:	83 ec 04             	sub    $0x4,%esp
+ 473:	6a 01                	push   $0x1
+ 475:	56                   	push   %esi
+ 476:	6a 00                	push   $0x0
+ 478:	e8 1e 01 00 00       	call   59b <read>
+    if(cc < 1)
+ 47d:	83 c4 10             	add    $0x10,%esp
+ 480:	85 c0                	test   %eax,%eax
+ 482:	7e 1d                	jle    4a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 484:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 48f:	3c 0a                	cmp    $0xa,%al
+ 491:	74 10                	je     4a3 <gets+0x43>
+ 493:	3c 0d                	cmp    $0xd,%al
+ 495:	74 0c                	je     4a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 497:	89 df                	mov    %ebx,%edi
+ 499:	83 c3 01             	add    $0x1,%ebx
+ 49c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 49f:	7c cf                	jl     470 <gets+0x10>
+ 4a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ad:	5b                   	pop    %ebx
+ 4ae:	5e                   	pop    %esi
+ 4af:	5f                   	pop    %edi
+ 4b0:	5d                   	pop    %ebp
+ 4b1:	c3                   	ret
+ 4b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	56                   	push   %esi
+ 4c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4c5:	83 ec 08             	sub    $0x8,%esp
+ 4c8:	6a 00                	push   $0x0
+ 4ca:	ff 75 08             	push   0x8(%ebp)
+ 4cd:	e8 f1 00 00 00       	call   5c3 <open>
+  if(fd < 0)
+ 4d2:	83 c4 10             	add    $0x10,%esp
+ 4d5:	85 c0                	test   %eax,%eax
+ 4d7:	78 27                	js     500 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4d9:	83 ec 08             	sub    $0x8,%esp
+ 4dc:	ff 75 0c             	push   0xc(%ebp)
+ 4df:	89 c3                	mov    %eax,%ebx
+ 4e1:	50                   	push   %eax
+ 4e2:	e8 f4 00 00 00       	call   5db <fstat>
+  close(fd);
+ 4e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4ec:	e8 ba 00 00 00       	call   5ab <close>
+  return r;
+ 4f1:	83 c4 10             	add    $0x10,%esp
+}
+ 4f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4f7:	89 f0                	mov    %esi,%eax
+ 4f9:	5b                   	pop    %ebx
+ 4fa:	5e                   	pop    %esi
+ 4fb:	5d                   	pop    %ebp
+ 4fc:	c3                   	ret
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 505:	eb ed                	jmp    4f4 <stat+0x34>
+ 507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50e:	66 90                	xchg   %ax,%ax
+
+00000510 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	53                   	push   %ebx
+ 514:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 517:	0f be 02             	movsbl (%edx),%eax
+ 51a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 51d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 520:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 525:	77 1e                	ja     545 <atoi+0x35>
+ 527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 530:	83 c2 01             	add    $0x1,%edx
+ 533:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 536:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 53a:	0f be 02             	movsbl (%edx),%eax
+ 53d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 540:	80 fb 09             	cmp    $0x9,%bl
+ 543:	76 eb                	jbe    530 <atoi+0x20>
+  return n;
+}
+ 545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 548:	89 c8                	mov    %ecx,%eax
+ 54a:	c9                   	leave
+ 54b:	c3                   	ret
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	8b 45 10             	mov    0x10(%ebp),%eax
+ 558:	8b 55 08             	mov    0x8(%ebp),%edx
+ 55b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 55e:	85 c0                	test   %eax,%eax
+ 560:	7e 13                	jle    575 <memmove+0x25>
+ 562:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 564:	89 d7                	mov    %edx,%edi
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 570:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 571:	39 f8                	cmp    %edi,%eax
+ 573:	75 fb                	jne    570 <memmove+0x20>
+  return vdst;
+}
+ 575:	5e                   	pop    %esi
+ 576:	89 d0                	mov    %edx,%eax
+ 578:	5f                   	pop    %edi
+ 579:	5d                   	pop    %ebp
+ 57a:	c3                   	ret
+
+0000057b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 57b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <exit>:
+SYSCALL(exit)
+ 583:	b8 02 00 00 00       	mov    $0x2,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <wait>:
+SYSCALL(wait)
+ 58b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <pipe>:
+SYSCALL(pipe)
+ 593:	b8 04 00 00 00       	mov    $0x4,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <read>:
+SYSCALL(read)
+ 59b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <write>:
+SYSCALL(write)
+ 5a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <close>:
+SYSCALL(close)
+ 5ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <kill>:
+SYSCALL(kill)
+ 5b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <exec>:
+SYSCALL(exec)
+ 5bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <open>:
+SYSCALL(open)
+ 5c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <mknod>:
+SYSCALL(mknod)
+ 5cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <unlink>:
+SYSCALL(unlink)
+ 5d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <fstat>:
+SYSCALL(fstat)
+ 5db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <link>:
+SYSCALL(link)
+ 5e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <mkdir>:
+SYSCALL(mkdir)
+ 5eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <chdir>:
+SYSCALL(chdir)
+ 5f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <dup>:
+SYSCALL(dup)
+ 5fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <getpid>:
+SYSCALL(getpid)
+ 603:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <sbrk>:
+SYSCALL(sbrk)
+ 60b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <sleep>:
+SYSCALL(sleep)
+ 613:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <uptime>:
+SYSCALL(uptime)
+ 61b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <trace>:
+SYSCALL(trace)
+ 623:	b8 16 00 00 00       	mov    $0x16,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <csinfo>:
+SYSCALL(csinfo)
+ 62b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <settickets>:
+SYSCALL(settickets)
+ 633:	b8 18 00 00 00       	mov    $0x18,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <getprocessesinfo>:
+SYSCALL(getprocessesinfo)
+ 63b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <yield>:
+SYSCALL(yield)
+ 643:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <random>:
+SYSCALL(random)
+ 64b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <dumppagetable>:
+SYSCALL(dumppagetable)
+ 653:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <getcpusinfo>:
+SYSCALL(getcpusinfo)
+ 65b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <setsched>:
+SYSCALL(setsched)
+ 663:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <getbcacheinfo>:
+SYSCALL(getbcacheinfo)
+ 66b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <getballocinfo>:
+SYSCALL(getballocinfo)
+ 673:	b8 20 00 00 00       	mov    $0x20,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <getfaultinfo>:
+SYSCALL(getfaultinfo)
+ 67b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+ 683:	66 90                	xchg   %ax,%ax
+ 685:	66 90                	xchg   %ax,%ax
+ 687:	66 90                	xchg   %ax,%ax
+ 689:	66 90                	xchg   %ax,%ax
+ 68b:	66 90                	xchg   %ax,%ax
+ 68d:	66 90                	xchg   %ax,%ax
+ 68f:	90                   	nop
+
+00000690 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	57                   	push   %edi
+ 694:	56                   	push   %esi
+ 695:	53                   	push   %ebx
+ 696:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 698:	89 d1                	mov    %edx,%ecx
+{
+ 69a:	83 ec 3c             	sub    $0x3c,%esp
+ 69d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6a0:	85 d2                	test   %edx,%edx
+ 6a2:	0f 89 80 00 00 00    	jns    728 <printint+0x98>
+ 6a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6ac:	74 7a                	je     728 <printint+0x98>
+    x = -xx;
+ 6ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6b8:	31 f6                	xor    %esi,%esi
+ 6ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6c0:	89 c8                	mov    %ecx,%eax
+ 6c2:	31 d2                	xor    %edx,%edx
+ 6c4:	89 f7                	mov    %esi,%edi
+ 6c6:	f7 f3                	div    %ebx
+ 6c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6cb:	0f b6 92 04 0b 00 00 	movzbl 0xb04(%edx),%edx
+ 6d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6d6:	89 ca                	mov    %ecx,%edx
+ 6d8:	89 c1                	mov    %eax,%ecx
+ 6da:	39 da                	cmp    %ebx,%edx
+ 6dc:	73 e2                	jae    6c0 <printint+0x30>
+  if(neg)
+ 6de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6e1:	85 c0                	test   %eax,%eax
+ 6e3:	74 07                	je     6ec <printint+0x5c>
+    buf[i++] = '-';
+ 6e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6ea:	89 f7                	mov    %esi,%edi
+ 6ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6f2:	01 df                	add    %ebx,%edi
+ 6f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6fb:	83 ec 04             	sub    $0x4,%esp
+ 6fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 701:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 704:	6a 01                	push   $0x1
+ 706:	50                   	push   %eax
+ 707:	56                   	push   %esi
+ 708:	e8 96 fe ff ff       	call   5a3 <write>
+  while(--i >= 0)
+ 70d:	89 f8                	mov    %edi,%eax
+ 70f:	83 c4 10             	add    $0x10,%esp
+ 712:	83 ef 01             	sub    $0x1,%edi
+ 715:	39 d8                	cmp    %ebx,%eax
+ 717:	75 df                	jne    6f8 <printint+0x68>
+}
+ 719:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 71c:	5b                   	pop    %ebx
+ 71d:	5e                   	pop    %esi
+ 71e:	5f                   	pop    %edi
+ 71f:	5d                   	pop    %ebp
+ 720:	c3                   	ret
+ 721:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 728:	31 c0                	xor    %eax,%eax
+ 72a:	eb 89                	jmp    6b5 <printint+0x25>
+ 72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000730 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	57                   	push   %edi
+ 734:	56                   	push   %esi
+ 735:	53                   	push   %ebx
+ 736:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 739:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 73c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 73f:	0f b6 1e             	movzbl (%esi),%ebx
+ 742:	83 c6 01             	add    $0x1,%esi
+ 745:	84 db                	test   %bl,%bl
+ 747:	74 67                	je     7b0 <printf+0x80>
+ 749:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 74c:	31 d2                	xor    %edx,%edx
+ 74e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 751:	eb 34                	jmp    787 <printf+0x57>
+ 753:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 757:	90                   	nop
+ 758:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 75b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 760:	83 f8 25             	cmp    $0x25,%eax
+ 763:	74 18                	je     77d <printf+0x4d>
+  write(fd, &c, 1);
+ 765:	83 ec 04             	sub    $0x4,%esp
+ 768:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 76b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 76e:	6a 01                	push   $0x1
+ 770:	50                   	push   %eax
+ 771:	57                   	push   %edi
+ 772:	e8 2c fe ff ff       	call   5a3 <write>
+ 777:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 77a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 77d:	0f b6 1e             	movzbl (%esi),%ebx
+ 780:	83 c6 01             	add    $0x1,%esi
+ 783:	84 db                	test   %bl,%bl
+ 785:	74 29                	je     7b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 787:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 78a:	85 d2                	test   %edx,%edx
+ 78c:	74 ca                	je     758 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 78e:	83 fa 25             	cmp    $0x25,%edx
+ 791:	75 ea                	jne    77d <printf+0x4d>
+      if(c == 'd'){
+ 793:	83 f8 25             	cmp    $0x25,%eax
+ 796:	0f 84 24 01 00 00    	je     8c0 <printf+0x190>
+ 79c:	83 e8 63             	sub    $0x63,%eax
+ 79f:	83 f8 15             	cmp    $0x15,%eax
+ 7a2:	77 1c                	ja     7c0 <printf+0x90>
+ 7a4:	ff 24 85 ac 0a 00 00 	jmp    *0xaac(,%eax,4)
+ 7ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7b3:	5b                   	pop    %ebx
+ 7b4:	5e                   	pop    %esi
+ 7b5:	5f                   	pop    %edi
+ 7b6:	5d                   	pop    %ebp
+ 7b7:	c3                   	ret
+ 7b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bf:	90                   	nop
+  write(fd, &c, 1);
+ 7c0:	83 ec 04             	sub    $0x4,%esp
+ 7c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7ca:	6a 01                	push   $0x1
+ 7cc:	52                   	push   %edx
+ 7cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7d0:	57                   	push   %edi
+ 7d1:	e8 cd fd ff ff       	call   5a3 <write>
+ 7d6:	83 c4 0c             	add    $0xc,%esp
+ 7d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7dc:	6a 01                	push   $0x1
+ 7de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7e1:	52                   	push   %edx
+ 7e2:	57                   	push   %edi
+ 7e3:	e8 bb fd ff ff       	call   5a3 <write>
+        putc(fd, c);
+ 7e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7eb:	31 d2                	xor    %edx,%edx
+ 7ed:	eb 8e                	jmp    77d <printf+0x4d>
+ 7ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7f3:	83 ec 0c             	sub    $0xc,%esp
+ 7f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7fb:	8b 13                	mov    (%ebx),%edx
+ 7fd:	6a 00                	push   $0x0
+ 7ff:	89 f8                	mov    %edi,%eax
+        ap++;
+ 801:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 804:	e8 87 fe ff ff       	call   690 <printint>
+        ap++;
+ 809:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 80c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 80f:	31 d2                	xor    %edx,%edx
+ 811:	e9 67 ff ff ff       	jmp    77d <printf+0x4d>
+ 816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 820:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 823:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 825:	83 c0 04             	add    $0x4,%eax
+ 828:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 82b:	85 db                	test   %ebx,%ebx
+ 82d:	0f 84 9d 00 00 00    	je     8d0 <printf+0x1a0>
+        while(*s != 0){
+ 833:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 836:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 838:	84 c0                	test   %al,%al
+ 83a:	0f 84 3d ff ff ff    	je     77d <printf+0x4d>
+ 840:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 843:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 846:	89 de                	mov    %ebx,%esi
+ 848:	89 d3                	mov    %edx,%ebx
+ 84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 850:	83 ec 04             	sub    $0x4,%esp
+ 853:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 856:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 859:	6a 01                	push   $0x1
+ 85b:	53                   	push   %ebx
+ 85c:	57                   	push   %edi
+ 85d:	e8 41 fd ff ff       	call   5a3 <write>
+        while(*s != 0){
+ 862:	0f b6 06             	movzbl (%esi),%eax
+ 865:	83 c4 10             	add    $0x10,%esp
+ 868:	84 c0                	test   %al,%al
+ 86a:	75 e4                	jne    850 <printf+0x120>
+      state = 0;
+ 86c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 86f:	31 d2                	xor    %edx,%edx
+ 871:	e9 07 ff ff ff       	jmp    77d <printf+0x4d>
+ 876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 880:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 883:	83 ec 0c             	sub    $0xc,%esp
+ 886:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 88b:	8b 13                	mov    (%ebx),%edx
+ 88d:	6a 01                	push   $0x1
+ 88f:	e9 6b ff ff ff       	jmp    7ff <printf+0xcf>
+ 894:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 898:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 89b:	83 ec 04             	sub    $0x4,%esp
+ 89e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8a9:	6a 01                	push   $0x1
+ 8ab:	52                   	push   %edx
+ 8ac:	57                   	push   %edi
+ 8ad:	e8 f1 fc ff ff       	call   5a3 <write>
+        ap++;
+ 8b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8b8:	31 d2                	xor    %edx,%edx
+ 8ba:	e9 be fe ff ff       	jmp    77d <printf+0x4d>
+ 8bf:	90                   	nop
+  write(fd, &c, 1);
+ 8c0:	83 ec 04             	sub    $0x4,%esp
+ 8c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8c9:	6a 01                	push   $0x1
+ 8cb:	e9 11 ff ff ff       	jmp    7e1 <printf+0xb1>
+ 8d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8d5:	bb a2 0a 00 00       	mov    $0xaa2,%ebx
+ 8da:	e9 61 ff ff ff       	jmp    840 <printf+0x110>
+ 8df:	90                   	nop
+
+000008e0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8e0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8e1:	a1 38 0e 00 00       	mov    0xe38,%eax
+{
+ 8e6:	89 e5                	mov    %esp,%ebp
+ 8e8:	57                   	push   %edi
+ 8e9:	56                   	push   %esi
+ 8ea:	53                   	push   %ebx
+ 8eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 8ee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8f8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8fa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8fc:	39 ca                	cmp    %ecx,%edx
+ 8fe:	73 30                	jae    930 <free+0x50>
+ 900:	39 c1                	cmp    %eax,%ecx
+ 902:	72 04                	jb     908 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 904:	39 c2                	cmp    %eax,%edx
+ 906:	72 f0                	jb     8f8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 908:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 90b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 90e:	39 f8                	cmp    %edi,%eax
+ 910:	74 2e                	je     940 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 912:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 915:	8b 42 04             	mov    0x4(%edx),%eax
+ 918:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 91b:	39 f1                	cmp    %esi,%ecx
+ 91d:	74 38                	je     957 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 91f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 921:	5b                   	pop    %ebx
+  freep = p;
+ 922:	89 15 38 0e 00 00    	mov    %edx,0xe38
+}
+ 928:	5e                   	pop    %esi
+ 929:	5f                   	pop    %edi
+ 92a:	5d                   	pop    %ebp
+ 92b:	c3                   	ret
+ 92c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 930:	39 c1                	cmp    %eax,%ecx
+ 932:	72 d0                	jb     904 <free+0x24>
+ 934:	eb c2                	jmp    8f8 <free+0x18>
+ 936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 940:	03 70 04             	add    0x4(%eax),%esi
+ 943:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 946:	8b 02                	mov    (%edx),%eax
+ 948:	8b 00                	mov    (%eax),%eax
+ 94a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 94d:	8b 42 04             	mov    0x4(%edx),%eax
+ 950:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 953:	39 f1                	cmp    %esi,%ecx
+ 955:	75 c8                	jne    91f <free+0x3f>
+    p->s.size += bp->s.size;
+ 957:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 95a:	89 15 38 0e 00 00    	mov    %edx,0xe38
+    p->s.size += bp->s.size;
+ 960:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 963:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 966:	89 0a                	mov    %ecx,(%edx)
+}
+ 968:	5b                   	pop    %ebx
+ 969:	5e                   	pop    %esi
+ 96a:	5f                   	pop    %edi
+ 96b:	5d                   	pop    %ebp
+ 96c:	c3                   	ret
+ 96d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000970 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	57                   	push   %edi
+ 974:	56                   	push   %esi
+ 975:	53                   	push   %ebx
+ 976:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 979:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 97c:	8b 15 38 0e 00 00    	mov    0xe38,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 982:	8d 78 07             	lea    0x7(%eax),%edi
+ 985:	c1 ef 03             	shr    $0x3,%edi
+ 988:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 98b:	85 d2                	test   %edx,%edx
+ 98d:	0f 84 8d 00 00 00    	je     a20 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 993:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 995:	8b 48 04             	mov    0x4(%eax),%ecx
+ 998:	39 f9                	cmp    %edi,%ecx
+ 99a:	73 64                	jae    a00 <malloc+0x90>
+  if(nu < 4096)
+ 99c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 9a1:	39 df                	cmp    %ebx,%edi
+ 9a3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 9a6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9ad:	eb 0a                	jmp    9b9 <malloc+0x49>
+ 9af:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9b0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9b2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9b5:	39 f9                	cmp    %edi,%ecx
+ 9b7:	73 47                	jae    a00 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 9b9:	89 c2                	mov    %eax,%edx
+ 9bb:	39 05 38 0e 00 00    	cmp    %eax,0xe38
+ 9c1:	75 ed                	jne    9b0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 9c3:	83 ec 0c             	sub    $0xc,%esp
+ 9c6:	56                   	push   %esi
+ 9c7:	e8 3f fc ff ff       	call   60b <sbrk>
+  if(p == (char*)-1)
+ 9cc:	83 c4 10             	add    $0x10,%esp
+ 9cf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9d2:	74 1c                	je     9f0 <malloc+0x80>
+  hp->s.size = nu;
+ 9d4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9d7:	83 ec 0c             	sub    $0xc,%esp
+ 9da:	83 c0 08             	add    $0x8,%eax
+ 9dd:	50                   	push   %eax
+ 9de:	e8 fd fe ff ff       	call   8e0 <free>
+  return freep;
+ 9e3:	8b 15 38 0e 00 00    	mov    0xe38,%edx
+      if((p = morecore(nunits)) == 0)
+ 9e9:	83 c4 10             	add    $0x10,%esp
+ 9ec:	85 d2                	test   %edx,%edx
+ 9ee:	75 c0                	jne    9b0 <malloc+0x40>
+        return 0;
+  }
+}
+ 9f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9f3:	31 c0                	xor    %eax,%eax
+}
+ 9f5:	5b                   	pop    %ebx
+ 9f6:	5e                   	pop    %esi
+ 9f7:	5f                   	pop    %edi
+ 9f8:	5d                   	pop    %ebp
+ 9f9:	c3                   	ret
+ 9fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a00:	39 cf                	cmp    %ecx,%edi
+ a02:	74 4c                	je     a50 <malloc+0xe0>
+        p->s.size -= nunits;
+ a04:	29 f9                	sub    %edi,%ecx
+ a06:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a09:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a0c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a0f:	89 15 38 0e 00 00    	mov    %edx,0xe38
+}
+ a15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a18:	83 c0 08             	add    $0x8,%eax
+}
+ a1b:	5b                   	pop    %ebx
+ a1c:	5e                   	pop    %esi
+ a1d:	5f                   	pop    %edi
+ a1e:	5d                   	pop    %ebp
+ a1f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a20:	c7 05 38 0e 00 00 3c 	movl   $0xe3c,0xe38
+ a27:	0e 00 00 
+    base.s.size = 0;
+ a2a:	b8 3c 0e 00 00       	mov    $0xe3c,%eax
+    base.s.ptr = freep = prevp = &base;
+ a2f:	c7 05 3c 0e 00 00 3c 	movl   $0xe3c,0xe3c
+ a36:	0e 00 00 
+    base.s.size = 0;
+ a39:	c7 05 40 0e 00 00 00 	movl   $0x0,0xe40
+ a40:	00 00 00 
+    if(p->s.size >= nunits){
+ a43:	e9 54 ff ff ff       	jmp    99c <malloc+0x2c>
+ a48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a50:	8b 08                	mov    (%eax),%ecx
+ a52:	89 0a                	mov    %ecx,(%edx)
+ a54:	eb b9                	jmp    a0f <malloc+0x9f>
@@ -15,14 +15,14 @@
 #define static_assert(a, b) do { switch (0) case 0: case (a): ; } while (0)
 #endif
 
-#define NINODES 200
+#define NINODES 4096
 
 // Disk layout:
 // [ boot block | sb block | log | inode blocks | free bit map | data blocks ]
 
 int nbitmap = FSSIZE/(BSIZE*8) + 1;
 int ninodeblocks = NINODES / IPB + 1;
-int nlog = LOGSIZE;
+int nlog;     // Number of log blocks, header included; about 1/32 of the disk
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
 
@@ -40,6 +40,7 @@ void rinode(uint inum, struct dinode *ip);
 void rsect(uint sec, void *buf);
 uint ialloc(ushort type);
 void iappend(uint inum, void *p, int n);
+void writedir(uint inum, struct dirent *de, int n);
 
 // convert to intel byte order
 ushort
@@ -67,11 +68,10 @@ xint(uint x)
 int
 main(int argc, char *argv[])
 {
-  int i, cc, fd;
-  uint rootino, inum, off;
-  struct dirent de;
+  int i, cc, fd, nde;
+  uint rootino, inum;
+  struct dirent *de;
   char buf[BSIZE];
-  struct dinode din;
 
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
@@ -90,6 +90,12 @@ main(int argc, char *argv[])
     exit(1);
   }
 
+  nlog = FSSIZE / 32;
+  if(nlog < LOGSIZE)
+    nlog = LOGSIZE;
+  if(nlog > MAXLOGSLOTS + 1)
+    nlog = MAXLOGSLOTS + 1;
+
   // 1 fs block = 1 disk sector
   nmeta = 2 + nlog + ninodeblocks + nbitmap;
   nblocks = FSSIZE - nmeta;
@@ -101,9 +107,10 @@ main(int argc, char *argv[])
   sb.logstart = xint(2);
   sb.inodestart = xint(2+nlog);
   sb.bmapstart = xint(2+nlog+ninodeblocks);
+  sb.bsize = xint(BSIZE);
 
-  printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
-         nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE);
+  printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d of %d bytes\n",
+         nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE, BSIZE);
 
   freeblock = nmeta;     // the first free block that we can allocate
 
@@ -117,15 +124,13 @@ main(int argc, char *argv[])
   rootino = ialloc(T_DIR);
   assert(rootino == ROOTINO);
 
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, ".");
-  iappend(rootino, &de, sizeof(de));
-
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, "..");
-  iappend(rootino, &de, sizeof(de));
+  de = calloc(argc, sizeof(*de));
+  assert(de != 0);
+  de[0].inum = xshort(rootino);
+  strcpy(de[0].name, ".");
+  de[1].inum = xshort(rootino);
+  strcpy(de[1].name, "..");
+  nde = 2;
 
   for(i = 2; i < argc; i++){
     assert(index(argv[i], '/') == 0);
@@ -144,10 +149,9 @@ main(int argc, char *argv[])
 
     inum = ialloc(T_FILE);
 
-    bzero(&de, sizeof(de));
-    de.inum = xshort(inum);
-    strncpy(de.name, argv[i], DIRSIZ);
-    iappend(rootino, &de, sizeof(de));
+    de[nde].inum = xshort(inum);
+    strncpy(de[nde].name, argv[i], DIRSIZ);
+    nde++;
 
     while((cc = read(fd, buf, sizeof(buf))) > 0)
       iappend(inum, buf, cc);
@@ -155,12 +159,7 @@ main(int argc, char *argv[])
     close(fd);
   }
 
-  // fix size of root inode dir
-  rinode(rootino, &din);
-  off = xint(din.size);
-  off = ((off/BSIZE) + 1) * BSIZE;
-  din.size = xint(off);
-  winode(rootino, &din);
+  writedir(rootino, de, nde);
 
   balloc(freeblock);
 
@@ -260,7 +259,7 @@ iappend(uint inum, void *xp, int n)
   struct dinode din;
   char buf[BSIZE];
   uint indirect[NINDIRECT];
-  uint x;
+  uint x, ind, leaf;
 
   rinode(inum, &din);
   off = xint(din.size);
@@ -274,15 +273,33 @@ iappend(uint inum, void *xp, int n)
       }
       x = xint(din.addrs[fbn]);
     } else {
-      if(xint(din.addrs[NDIRECT]) == 0){
-        din.addrs[NDIRECT] = xint(freeblock++);
+      // Find the indirect block listing fbn: the single
+      // indirect block, or one listed in the doubly-indirect.
+      ind = fbn - NDIRECT;
+      if(ind < NINDIRECT){
+        if(xint(din.addrs[NDIRECT]) == 0){
+          din.addrs[NDIRECT] = xint(freeblock++);
+        }
+        leaf = xint(din.addrs[NDIRECT]);
+      } else {
+        ind -= NINDIRECT;
+        if(xint(din.addrs[NDIRECT+1]) == 0){
+          din.addrs[NDIRECT+1] = xint(freeblock++);
+        }
+        rsect(xint(din.addrs[NDIRECT+1]), (char*)indirect);
+        if(indirect[ind / NINDIRECT] == 0){
+          indirect[ind / NINDIRECT] = xint(freeblock++);
+          wsect(xint(din.addrs[NDIRECT+1]), (char*)indirect);
+        }
+        leaf = xint(indirect[ind / NINDIRECT]);
+        ind %= NINDIRECT;
       }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
+      rsect(leaf, (char*)indirect);
+      if(indirect[ind] == 0){
+        indirect[ind] = xint(freeblock++);
+        wsect(leaf, (char*)indirect);
       }
-      x = xint(indirect[fbn-NDIRECT]);
+      x = xint(indirect[ind]);
     }
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
@@ -295,3 +312,62 @@ iappend(uint inum, void *xp, int n)
   din.size = xint(off);
   winode(inum, &din);
 }
+
+// Write the n entries de[] ("." and ".." first) into directory
+// inum: flat if they fit in DIRFLAT blocks, the way the kernel
+// would leave them, else in the indexed format described in fs.h.
+void
+writedir(uint inum, struct dirent *de, int n)
+{
+  int i, j, nb, nblk;
+  uint off, blk;
+  ushort *link;
+  struct dirent *d;
+  struct dinode din;
+
+  if(n <= DIRFLAT*DPB){
+    iappend(inum, de, n * sizeof(*de));
+
+    // fix size of the directory
+    rinode(inum, &din);
+    off = xint(din.size);
+    off = ((off/BSIZE) + 1) * BSIZE;
+    din.size = xint(off);
+    winode(inum, &din);
+    return;
+  }
+
+  // About half full, as after the kernel's linear hashing.
+  nb = 2 * (n / (DPB-1)) + 1;
+  if(nb > DIRNTAB)
+    nb = DIRNTAB;
+  d = calloc(nb + 1 + n, BSIZE);  // at worst one block per entry overflows
+  assert(d != 0);
+  nblk = nb + 1;
+  d[0] = de[0];
+  d[1] = de[1];
+  for(i = 0; i < nb; i++)
+    ((ushort*)d[2 + i/DIRTPE].name)[i%DIRTPE] = xshort(i + 1);
+  for(i = 2; i < n; i++){
+    blk = dirbucket(dirhash(de[i].name), nb) + 1;
+    for(;;){
+      for(j = 0; j < DPB - 1 && d[blk*DPB + j].inum; j++)
+        ;
+      if(j < DPB - 1)
+        break;
+      link = (ushort*)d[blk*DPB + DPB-1].name;
+      if(*link == 0)
+        *link = xshort(nblk++);
+      blk = xshort(*link);
+    }
+    d[blk*DPB + j] = de[i];
+  }
+  iappend(inum, d, nblk * BSIZE);
+  free(d);
+
+  rinode(inum, &din);
+  din.major = xshort(DIRINDEX);
+  din.minor = xshort(nb);
+  winode(inum, &din);
+}
+
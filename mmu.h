@@ -144,6 +144,11 @@ struct segdesc {
 #define PTE_PS          0x080   // Page Size
 #define PTE_MBZ         0x180   // Bits must be zero
 
+// Page fault error code bits (trapframe err)
+#define FEC_PR          0x1     // Page was present
+#define FEC_WR          0x2     // Fault was a write
+#define FEC_U           0x4     // Fault was in user mode
+
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
 #define PTE_FLAGS(pte)  ((uint)(pte) &  0xFFF)
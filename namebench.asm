@@ -0,0 +1,1482 @@
+
+_namebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be e8 03 00 00       	mov    $0x3e8,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  int i, n, fd, len;
+  uint start;
+
+  n = NOPEN;
+  if(argc > 1)
+  19:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  1c:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+  1f:	7e 10                	jle    31 <main+0x31>
+    n = atoi(argv[1]);
+  21:	83 ec 0c             	sub    $0xc,%esp
+  24:	ff 70 04             	push   0x4(%eax)
+  27:	e8 94 04 00 00       	call   4c0 <atoi>
+  2c:	83 c4 10             	add    $0x10,%esp
+  2f:	89 c6                	mov    %eax,%esi
+
+  // nb/a/b/.../h
+  strcpy(path, "nb");
+  31:	83 ec 08             	sub    $0x8,%esp
+  34:	bb 61 00 00 00       	mov    $0x61,%ebx
+  len = 2;
+  39:	bf 02 00 00 00       	mov    $0x2,%edi
+  strcpy(path, "nb");
+  3e:	68 4b 0a 00 00       	push   $0xa4b
+  43:	68 20 0e 00 00       	push   $0xe20
+  48:	e8 a3 02 00 00       	call   2f0 <strcpy>
+  if(mkdir(path) < 0){
+  4d:	c7 04 24 20 0e 00 00 	movl   $0xe20,(%esp)
+  54:	e8 42 05 00 00       	call   59b <mkdir>
+  59:	83 c4 10             	add    $0x10,%esp
+  5c:	85 c0                	test   %eax,%eax
+  5e:	0f 88 e5 00 00 00    	js     149 <main+0x149>
+  64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  }
+  for(i = 0; i < DEPTH; i++){
+    path[len++] = '/';
+    path[len++] = 'a' + i;
+    path[len] = 0;
+    if(mkdir(path) < 0){
+  68:	83 ec 0c             	sub    $0xc,%esp
+    path[len++] = '/';
+  6b:	c6 87 20 0e 00 00 2f 	movb   $0x2f,0xe20(%edi)
+    path[len++] = 'a' + i;
+  72:	83 c7 02             	add    $0x2,%edi
+    if(mkdir(path) < 0){
+  75:	68 20 0e 00 00       	push   $0xe20
+    path[len++] = 'a' + i;
+  7a:	88 9f 1f 0e 00 00    	mov    %bl,0xe1f(%edi)
+    path[len] = 0;
+  80:	c6 87 20 0e 00 00 00 	movb   $0x0,0xe20(%edi)
+    if(mkdir(path) < 0){
+  87:	e8 0f 05 00 00       	call   59b <mkdir>
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	85 c0                	test   %eax,%eax
+  91:	0f 88 b2 00 00 00    	js     149 <main+0x149>
+  for(i = 0; i < DEPTH; i++){
+  97:	83 c3 01             	add    $0x1,%ebx
+  9a:	83 ff 12             	cmp    $0x12,%edi
+  9d:	75 c9                	jne    68 <main+0x68>
+      printf(1, "namebench: mkdir %s failed\n", path);
+      exit();
+    }
+  }
+  strcpy(path + len, "/file");
+  9f:	50                   	push   %eax
+  a0:	50                   	push   %eax
+  a1:	68 6a 0a 00 00       	push   $0xa6a
+  a6:	68 32 0e 00 00       	push   $0xe32
+  ab:	e8 40 02 00 00       	call   2f0 <strcpy>
+  if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+  b0:	58                   	pop    %eax
+  b1:	5a                   	pop    %edx
+  b2:	68 02 02 00 00       	push   $0x202
+  b7:	68 20 0e 00 00       	push   $0xe20
+  bc:	e8 b2 04 00 00       	call   573 <open>
+  c1:	83 c4 10             	add    $0x10,%esp
+  c4:	85 c0                	test   %eax,%eax
+  c6:	78 6a                	js     132 <main+0x132>
+    printf(1, "namebench: create %s failed\n", path);
+    exit();
+  }
+  close(fd);
+  c8:	83 ec 0c             	sub    $0xc,%esp
+  cb:	50                   	push   %eax
+  cc:	e8 8a 04 00 00       	call   55b <close>
+
+  start = uptime();
+  d1:	e8 f5 04 00 00       	call   5cb <uptime>
+  for(i = 0; i < n; i++){
+  d6:	83 c4 10             	add    $0x10,%esp
+  start = uptime();
+  d9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < n; i++){
+  dc:	85 f6                	test   %esi,%esi
+  de:	0f 8e 60 01 00 00    	jle    244 <main+0x244>
+  e4:	31 db                	xor    %ebx,%ebx
+  e6:	eb 1d                	jmp    105 <main+0x105>
+  e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+    if((fd = open(path, O_RDONLY)) < 0){
+      printf(1, "namebench: open %s failed\n", path);
+      exit();
+    }
+    close(fd);
+  f0:	83 ec 0c             	sub    $0xc,%esp
+  f3:	50                   	push   %eax
+  f4:	e8 62 04 00 00       	call   55b <close>
+  for(i = 0; i < n; i++){
+  f9:	8d 43 01             	lea    0x1(%ebx),%eax
+  fc:	83 c4 10             	add    $0x10,%esp
+  ff:	39 c6                	cmp    %eax,%esi
+ 101:	74 5d                	je     160 <main+0x160>
+ 103:	89 c3                	mov    %eax,%ebx
+    if((fd = open(path, O_RDONLY)) < 0){
+ 105:	83 ec 08             	sub    $0x8,%esp
+ 108:	6a 00                	push   $0x0
+ 10a:	68 20 0e 00 00       	push   $0xe20
+ 10f:	e8 5f 04 00 00       	call   573 <open>
+ 114:	83 c4 10             	add    $0x10,%esp
+ 117:	85 c0                	test   %eax,%eax
+ 119:	79 d5                	jns    f0 <main+0xf0>
+      printf(1, "namebench: open %s failed\n", path);
+ 11b:	50                   	push   %eax
+ 11c:	68 20 0e 00 00       	push   $0xe20
+ 121:	68 8d 0a 00 00       	push   $0xa8d
+ 126:	6a 01                	push   $0x1
+ 128:	e8 b3 05 00 00       	call   6e0 <printf>
+      exit();
+ 12d:	e8 01 04 00 00       	call   533 <exit>
+    printf(1, "namebench: create %s failed\n", path);
+ 132:	50                   	push   %eax
+ 133:	68 20 0e 00 00       	push   $0xe20
+ 138:	68 70 0a 00 00       	push   $0xa70
+ 13d:	6a 01                	push   $0x1
+ 13f:	e8 9c 05 00 00       	call   6e0 <printf>
+    exit();
+ 144:	e8 ea 03 00 00       	call   533 <exit>
+    printf(1, "namebench: mkdir %s failed\n", path);
+ 149:	51                   	push   %ecx
+ 14a:	68 20 0e 00 00       	push   $0xe20
+ 14f:	68 4e 0a 00 00       	push   $0xa4e
+ 154:	6a 01                	push   $0x1
+ 156:	e8 85 05 00 00       	call   6e0 <printf>
+    exit();
+ 15b:	e8 d3 03 00 00       	call   533 <exit>
+  }
+  report("found", n, uptime() - start);
+ 160:	e8 66 04 00 00       	call   5cb <uptime>
+ 165:	52                   	push   %edx
+ 166:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 169:	29 d0                	sub    %edx,%eax
+ 16b:	50                   	push   %eax
+ 16c:	56                   	push   %esi
+ 16d:	68 a8 0a 00 00       	push   $0xaa8
+ 172:	e8 09 01 00 00       	call   280 <report>
+
+  strcpy(path + len, "/none");
+ 177:	59                   	pop    %ecx
+ 178:	58                   	pop    %eax
+ 179:	68 ae 0a 00 00       	push   $0xaae
+ 17e:	68 32 0e 00 00       	push   $0xe32
+ 183:	e8 68 01 00 00       	call   2f0 <strcpy>
+  start = uptime();
+ 188:	e8 3e 04 00 00       	call   5cb <uptime>
+ 18d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+ 190:	31 c9                	xor    %ecx,%ecx
+  start = uptime();
+ 192:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(i = 0; i < n; i++)
+ 195:	eb 12                	jmp    1a9 <main+0x1a9>
+ 197:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19e:	66 90                	xchg   %ax,%ax
+ 1a0:	8d 41 01             	lea    0x1(%ecx),%eax
+ 1a3:	39 cb                	cmp    %ecx,%ebx
+ 1a5:	74 35                	je     1dc <main+0x1dc>
+ 1a7:	89 c1                	mov    %eax,%ecx
+    if(open(path, O_RDONLY) >= 0){
+ 1a9:	83 ec 08             	sub    $0x8,%esp
+ 1ac:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 1af:	6a 00                	push   $0x0
+ 1b1:	68 20 0e 00 00       	push   $0xe20
+ 1b6:	e8 b8 03 00 00       	call   573 <open>
+ 1bb:	83 c4 10             	add    $0x10,%esp
+ 1be:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 1c1:	85 c0                	test   %eax,%eax
+ 1c3:	78 db                	js     1a0 <main+0x1a0>
+      printf(1, "namebench: open %s succeeded\n", path);
+ 1c5:	56                   	push   %esi
+ 1c6:	68 20 0e 00 00       	push   $0xe20
+ 1cb:	68 b4 0a 00 00       	push   $0xab4
+ 1d0:	6a 01                	push   $0x1
+ 1d2:	e8 09 05 00 00       	call   6e0 <printf>
+      exit();
+ 1d7:	e8 57 03 00 00       	call   533 <exit>
+  start = uptime();
+ 1dc:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    }
+  report("missing", n, uptime() - start);
+ 1df:	e8 e7 03 00 00       	call   5cb <uptime>
+ 1e4:	29 d8                	sub    %ebx,%eax
+ 1e6:	52                   	push   %edx
+ 1e7:	50                   	push   %eax
+ 1e8:	56                   	push   %esi
+ 1e9:	68 d2 0a 00 00       	push   $0xad2
+ 1ee:	e8 8d 00 00 00       	call   280 <report>
+
+  strcpy(path + len, "/file");
+ 1f3:	59                   	pop    %ecx
+ 1f4:	5b                   	pop    %ebx
+ 1f5:	68 6a 0a 00 00       	push   $0xa6a
+ 1fa:	68 32 0e 00 00       	push   $0xe32
+ 1ff:	e8 ec 00 00 00       	call   2f0 <strcpy>
+  unlink(path);
+ 204:	c7 04 24 20 0e 00 00 	movl   $0xe20,(%esp)
+ 20b:	e8 73 03 00 00       	call   583 <unlink>
+ 210:	83 c4 10             	add    $0x10,%esp
+  for(; len > 2; len -= 2){
+    path[len] = 0;
+    unlink(path);
+ 213:	83 ec 0c             	sub    $0xc,%esp
+    path[len] = 0;
+ 216:	c6 87 20 0e 00 00 00 	movb   $0x0,0xe20(%edi)
+  for(; len > 2; len -= 2){
+ 21d:	83 ef 02             	sub    $0x2,%edi
+    unlink(path);
+ 220:	68 20 0e 00 00       	push   $0xe20
+ 225:	e8 59 03 00 00       	call   583 <unlink>
+  for(; len > 2; len -= 2){
+ 22a:	83 c4 10             	add    $0x10,%esp
+ 22d:	83 ff 02             	cmp    $0x2,%edi
+ 230:	75 e1                	jne    213 <main+0x213>
+  }
+  unlink("nb");
+ 232:	83 ec 0c             	sub    $0xc,%esp
+ 235:	68 4b 0a 00 00       	push   $0xa4b
+ 23a:	e8 44 03 00 00       	call   583 <unlink>
+  exit();
+ 23f:	e8 ef 02 00 00       	call   533 <exit>
+  report("found", n, uptime() - start);
+ 244:	e8 82 03 00 00       	call   5cb <uptime>
+ 249:	52                   	push   %edx
+ 24a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 24d:	29 d0                	sub    %edx,%eax
+ 24f:	50                   	push   %eax
+ 250:	56                   	push   %esi
+ 251:	68 a8 0a 00 00       	push   $0xaa8
+ 256:	e8 25 00 00 00       	call   280 <report>
+  strcpy(path + len, "/none");
+ 25b:	59                   	pop    %ecx
+ 25c:	5b                   	pop    %ebx
+ 25d:	68 ae 0a 00 00       	push   $0xaae
+ 262:	68 32 0e 00 00       	push   $0xe32
+ 267:	e8 84 00 00 00       	call   2f0 <strcpy>
+  start = uptime();
+ 26c:	e8 5a 03 00 00       	call   5cb <uptime>
+ 271:	83 c4 10             	add    $0x10,%esp
+ 274:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < n; i++)
+ 276:	e9 64 ff ff ff       	jmp    1df <main+0x1df>
+ 27b:	66 90                	xchg   %ax,%ax
+ 27d:	66 90                	xchg   %ax,%ax
+ 27f:	90                   	nop
+
+00000280 <report>:
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	56                   	push   %esi
+ 284:	53                   	push   %ebx
+ 285:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 288:	8b 75 10             	mov    0x10(%ebp),%esi
+  printf(1, "namebench: %d %s opens (%d lookups) in %d ticks",
+ 28b:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+ 28e:	83 ec 08             	sub    $0x8,%esp
+ 291:	01 db                	add    %ebx,%ebx
+ 293:	56                   	push   %esi
+ 294:	53                   	push   %ebx
+ 295:	ff 75 08             	push   0x8(%ebp)
+ 298:	50                   	push   %eax
+ 299:	68 08 0a 00 00       	push   $0xa08
+ 29e:	6a 01                	push   $0x1
+ 2a0:	e8 3b 04 00 00       	call   6e0 <printf>
+  if(elapsed > 0)
+ 2a5:	83 c4 20             	add    $0x20,%esp
+ 2a8:	85 f6                	test   %esi,%esi
+ 2aa:	75 1c                	jne    2c8 <report+0x48>
+  printf(1, "\n");
+ 2ac:	c7 45 0c d0 0a 00 00 	movl   $0xad0,0xc(%ebp)
+ 2b3:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ 2ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2bd:	5b                   	pop    %ebx
+ 2be:	5e                   	pop    %esi
+ 2bf:	5d                   	pop    %ebp
+  printf(1, "\n");
+ 2c0:	e9 1b 04 00 00       	jmp    6e0 <printf>
+ 2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " (%d lookups/tick)", n * (DEPTH + 2) / elapsed);
+ 2c8:	89 d8                	mov    %ebx,%eax
+ 2ca:	31 d2                	xor    %edx,%edx
+ 2cc:	83 ec 04             	sub    $0x4,%esp
+ 2cf:	f7 f6                	div    %esi
+ 2d1:	50                   	push   %eax
+ 2d2:	68 38 0a 00 00       	push   $0xa38
+ 2d7:	6a 01                	push   $0x1
+ 2d9:	e8 02 04 00 00       	call   6e0 <printf>
+ 2de:	83 c4 10             	add    $0x10,%esp
+ 2e1:	eb c9                	jmp    2ac <report+0x2c>
+ 2e3:	66 90                	xchg   %ax,%ax
+ 2e5:	66 90                	xchg   %ax,%ax
+ 2e7:	66 90                	xchg   %ax,%ax
+ 2e9:	66 90                	xchg   %ax,%ax
+ 2eb:	66 90                	xchg   %ax,%ax
+ 2ed:	66 90                	xchg   %ax,%ax
+ 2ef:	90                   	nop
+
+000002f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 2f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2f1:	31 c0                	xor    %eax,%eax
+{
+ 2f3:	89 e5                	mov    %esp,%ebp
+ 2f5:	53                   	push   %ebx
+ 2f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 300:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 304:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 307:	83 c0 01             	add    $0x1,%eax
+ 30a:	84 d2                	test   %dl,%dl
+ 30c:	75 f2                	jne    300 <strcpy+0x10>
+    ;
+  return os;
+}
+ 30e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 311:	89 c8                	mov    %ecx,%eax
+ 313:	c9                   	leave
+ 314:	c3                   	ret
+ 315:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	53                   	push   %ebx
+ 324:	8b 55 08             	mov    0x8(%ebp),%edx
+ 327:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 32a:	0f b6 02             	movzbl (%edx),%eax
+ 32d:	84 c0                	test   %al,%al
+ 32f:	75 17                	jne    348 <strcmp+0x28>
+ 331:	eb 3a                	jmp    36d <strcmp+0x4d>
+ 333:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 337:	90                   	nop
+ 338:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 33c:	83 c2 01             	add    $0x1,%edx
+ 33f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 342:	84 c0                	test   %al,%al
+ 344:	74 1a                	je     360 <strcmp+0x40>
+    p++, q++;
+ 346:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 348:	0f b6 19             	movzbl (%ecx),%ebx
+ 34b:	38 c3                	cmp    %al,%bl
+ 34d:	74 e9                	je     338 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 34f:	29 d8                	sub    %ebx,%eax
+}
+ 351:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 354:	c9                   	leave
+ 355:	c3                   	ret
+ 356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 360:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 364:	31 c0                	xor    %eax,%eax
+ 366:	29 d8                	sub    %ebx,%eax
+}
+ 368:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 36b:	c9                   	leave
+ 36c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 36d:	0f b6 19             	movzbl (%ecx),%ebx
+ 370:	31 c0                	xor    %eax,%eax
+ 372:	eb db                	jmp    34f <strcmp+0x2f>
+ 374:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 37f:	90                   	nop
+
+00000380 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 386:	80 3a 00             	cmpb   $0x0,(%edx)
+ 389:	74 15                	je     3a0 <strlen+0x20>
+ 38b:	31 c0                	xor    %eax,%eax
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+ 390:	83 c0 01             	add    $0x1,%eax
+ 393:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 397:	89 c1                	mov    %eax,%ecx
+ 399:	75 f5                	jne    390 <strlen+0x10>
+    ;
+  return n;
+}
+ 39b:	89 c8                	mov    %ecx,%eax
+ 39d:	5d                   	pop    %ebp
+ 39e:	c3                   	ret
+ 39f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3a0:	31 c9                	xor    %ecx,%ecx
+}
+ 3a2:	5d                   	pop    %ebp
+ 3a3:	89 c8                	mov    %ecx,%eax
+ 3a5:	c3                   	ret
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	57                   	push   %edi
+ 3b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3bd:	89 d7                	mov    %edx,%edi
+ 3bf:	fc                   	cld
+ 3c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3c5:	89 d0                	mov    %edx,%eax
+ 3c7:	c9                   	leave
+ 3c8:	c3                   	ret
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3da:	0f b6 10             	movzbl (%eax),%edx
+ 3dd:	84 d2                	test   %dl,%dl
+ 3df:	75 12                	jne    3f3 <strchr+0x23>
+ 3e1:	eb 1d                	jmp    400 <strchr+0x30>
+ 3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3e7:	90                   	nop
+ 3e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3ec:	83 c0 01             	add    $0x1,%eax
+ 3ef:	84 d2                	test   %dl,%dl
+ 3f1:	74 0d                	je     400 <strchr+0x30>
+    if(*s == c)
+ 3f3:	38 d1                	cmp    %dl,%cl
+ 3f5:	75 f1                	jne    3e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3f7:	5d                   	pop    %ebp
+ 3f8:	c3                   	ret
+ 3f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 400:	31 c0                	xor    %eax,%eax
+}
+ 402:	5d                   	pop    %ebp
+ 403:	c3                   	ret
+ 404:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 40f:	90                   	nop
+
+00000410 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 415:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 418:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 419:	31 db                	xor    %ebx,%ebx
+{
+ 41b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 41e:	eb 27                	jmp    447 <gets+0x37>
+    cc = read(0, &c, 1);
+ 420:	83 ec 04             	sub    $0x4,%esp
+ 423:	6a 01                	push   $0x1
+ 425:	56                   	push   %esi
+ 426:	6a 00                	push   $0x0
+ 428:	e8 1e 01 00 00       	call   54b <read>
+    if(cc < 1)
+ 42d:	83 c4 10             	add    $0x10,%esp
+ 430:	85 c0                	test   %eax,%eax
+ 432:	7e 1d                	jle    451 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 434:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 438:	8b 55 08             	mov    0x8(%ebp),%edx
+ 43b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 43f:	3c 0a                	cmp    $0xa,%al
+ 441:	74 10                	je     453 <gets+0x43>
+ 443:	3c 0d                	cmp    $0xd,%al
+ 445:	74 0c                	je     453 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 447:	89 df                	mov    %ebx,%edi
+ 449:	83 c3 01             	add    $0x1,%ebx
+ 44c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 44f:	7c cf                	jl     420 <gets+0x10>
+ 451:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 453:	8b 45 08             	mov    0x8(%ebp),%eax
+ 456:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 45a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 45d:	5b                   	pop    %ebx
+ 45e:	5e                   	pop    %esi
+ 45f:	5f                   	pop    %edi
+ 460:	5d                   	pop    %ebp
+ 461:	c3                   	ret
+ 462:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	56                   	push   %esi
+ 474:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 475:	83 ec 08             	sub    $0x8,%esp
+ 478:	6a 00                	push   $0x0
+ 47a:	ff 75 08             	push   0x8(%ebp)
+ 47d:	e8 f1 00 00 00       	call   573 <open>
+  if(fd < 0)
+ 482:	83 c4 10             	add    $0x10,%esp
+ 485:	85 c0                	test   %eax,%eax
+ 487:	78 27                	js     4b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 489:	83 ec 08             	sub    $0x8,%esp
+ 48c:	ff 75 0c             	push   0xc(%ebp)
+ 48f:	89 c3                	mov    %eax,%ebx
+ 491:	50                   	push   %eax
+ 492:	e8 f4 00 00 00       	call   58b <fstat>
+  close(fd);
+ 497:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 49a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 49c:	e8 ba 00 00 00       	call   55b <close>
+  return r;
+ 4a1:	83 c4 10             	add    $0x10,%esp
+}
+ 4a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4a7:	89 f0                	mov    %esi,%eax
+ 4a9:	5b                   	pop    %ebx
+ 4aa:	5e                   	pop    %esi
+ 4ab:	5d                   	pop    %ebp
+ 4ac:	c3                   	ret
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4b5:	eb ed                	jmp    4a4 <stat+0x34>
+ 4b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4be:	66 90                	xchg   %ax,%ax
+
+000004c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	53                   	push   %ebx
+ 4c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4c7:	0f be 02             	movsbl (%edx),%eax
+ 4ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4d5:	77 1e                	ja     4f5 <atoi+0x35>
+ 4d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4e0:	83 c2 01             	add    $0x1,%edx
+ 4e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4ea:	0f be 02             	movsbl (%edx),%eax
+ 4ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4f0:	80 fb 09             	cmp    $0x9,%bl
+ 4f3:	76 eb                	jbe    4e0 <atoi+0x20>
+  return n;
+}
+ 4f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4f8:	89 c8                	mov    %ecx,%eax
+ 4fa:	c9                   	leave
+ 4fb:	c3                   	ret
+ 4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	57                   	push   %edi
+ 504:	56                   	push   %esi
+ 505:	8b 45 10             	mov    0x10(%ebp),%eax
+ 508:	8b 55 08             	mov    0x8(%ebp),%edx
+ 50b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 50e:	85 c0                	test   %eax,%eax
+ 510:	7e 13                	jle    525 <memmove+0x25>
+ 512:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 514:	89 d7                	mov    %edx,%edi
+ 516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 520:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 521:	39 f8                	cmp    %edi,%eax
+ 523:	75 fb                	jne    520 <memmove+0x20>
+  return vdst;
+}
+ 525:	5e                   	pop    %esi
+ 526:	89 d0                	mov    %edx,%eax
+ 528:	5f                   	pop    %edi
+ 529:	5d                   	pop    %ebp
+ 52a:	c3                   	ret
+
+0000052b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 52b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <exit>:
+SYSCALL(exit)
+ 533:	b8 02 00 00 00       	mov    $0x2,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <wait>:
+SYSCALL(wait)
+ 53b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <pipe>:
+SYSCALL(pipe)
+ 543:	b8 04 00 00 00       	mov    $0x4,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <read>:
+SYSCALL(read)
+ 54b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <write>:
+SYSCALL(write)
+ 553:	b8 10 00 00 00       	mov    $0x10,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <close>:
+SYSCALL(close)
+ 55b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <kill>:
+SYSCALL(kill)
+ 563:	b8 06 00 00 00       	mov    $0x6,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <exec>:
+SYSCALL(exec)
+ 56b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <open>:
+SYSCALL(open)
+ 573:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <mknod>:
+SYSCALL(mknod)
+ 57b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <unlink>:
+SYSCALL(unlink)
+ 583:	b8 12 00 00 00       	mov    $0x12,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <fstat>:
+SYSCALL(fstat)
+ 58b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <link>:
+SYSCALL(link)
+ 593:	b8 13 00 00 00       	mov    $0x13,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <mkdir>:
+SYSCALL(mkdir)
+ 59b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <chdir>:
+SYSCALL(chdir)
+ 5a3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <dup>:
+SYSCALL(dup)
+ 5ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <getpid>:
+SYSCALL(getpid)
+ 5b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <sbrk>:
+SYSCALL(sbrk)
+ 5bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <sleep>:
+SYSCALL(sleep)
+ 5c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <uptime>:
+SYSCALL(uptime)
+ 5cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <trace>:
+SYSCALL(trace)
+ 5d3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <csinfo>:
+SYSCALL(csinfo)
+ 5db:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <settickets>:
+SYSCALL(settickets)
+ 5e3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <getprocessesinfo>:
+SYSCALL(getprocessesinfo)
+ 5eb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <yield>:
+SYSCALL(yield)
+ 5f3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <random>:
+SYSCALL(random)
+ 5fb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <dumppagetable>:
+SYSCALL(dumppagetable)
+ 603:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <getcpusinfo>:
+SYSCALL(getcpusinfo)
+ 60b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <setsched>:
+SYSCALL(setsched)
+ 613:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <getbcacheinfo>:
+SYSCALL(getbcacheinfo)
+ 61b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <getballocinfo>:
+SYSCALL(getballocinfo)
+ 623:	b8 20 00 00 00       	mov    $0x20,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <getfaultinfo>:
+SYSCALL(getfaultinfo)
+ 62b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+ 633:	66 90                	xchg   %ax,%ax
+ 635:	66 90                	xchg   %ax,%ax
+ 637:	66 90                	xchg   %ax,%ax
+ 639:	66 90                	xchg   %ax,%ax
+ 63b:	66 90                	xchg   %ax,%ax
+ 63d:	66 90                	xchg   %ax,%ax
+ 63f:	90                   	nop
+
+00000640 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	57                   	push   %edi
+ 644:	56                   	push   %esi
+ 645:	53                   	push   %ebx
+ 646:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 648:	89 d1                	mov    %edx,%ecx
+{
+ 64a:	83 ec 3c             	sub    $0x3c,%esp
+ 64d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 650:	85 d2                	test   %edx,%edx
+ 652:	0f 89 80 00 00 00    	jns    6d8 <printint+0x98>
+ 658:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 65c:	74 7a                	je     6d8 <printint+0x98>
+    x = -xx;
+ 65e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 660:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 665:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 668:	31 f6                	xor    %esi,%esi
+ 66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 670:	89 c8                	mov    %ecx,%eax
+ 672:	31 d2                	xor    %edx,%edx
+ 674:	89 f7                	mov    %esi,%edi
+ 676:	f7 f3                	div    %ebx
+ 678:	8d 76 01             	lea    0x1(%esi),%esi
+ 67b:	0f b6 92 3c 0b 00 00 	movzbl 0xb3c(%edx),%edx
+ 682:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 686:	89 ca                	mov    %ecx,%edx
+ 688:	89 c1                	mov    %eax,%ecx
+ 68a:	39 da                	cmp    %ebx,%edx
+ 68c:	73 e2                	jae    670 <printint+0x30>
+  if(neg)
+ 68e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 691:	85 c0                	test   %eax,%eax
+ 693:	74 07                	je     69c <printint+0x5c>
+    buf[i++] = '-';
+ 695:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 69a:	89 f7                	mov    %esi,%edi
+ 69c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 69f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6a2:	01 df                	add    %ebx,%edi
+ 6a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6ab:	83 ec 04             	sub    $0x4,%esp
+ 6ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6b4:	6a 01                	push   $0x1
+ 6b6:	50                   	push   %eax
+ 6b7:	56                   	push   %esi
+ 6b8:	e8 96 fe ff ff       	call   553 <write>
+  while(--i >= 0)
+ 6bd:	89 f8                	mov    %edi,%eax
+ 6bf:	83 c4 10             	add    $0x10,%esp
+ 6c2:	83 ef 01             	sub    $0x1,%edi
+ 6c5:	39 d8                	cmp    %ebx,%eax
+ 6c7:	75 df                	jne    6a8 <printint+0x68>
+}
+ 6c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6cc:	5b                   	pop    %ebx
+ 6cd:	5e                   	pop    %esi
+ 6ce:	5f                   	pop    %edi
+ 6cf:	5d                   	pop    %ebp
+ 6d0:	c3                   	ret
+ 6d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6d8:	31 c0                	xor    %eax,%eax
+ 6da:	eb 89                	jmp    665 <printint+0x25>
+ 6dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	57                   	push   %edi
+ 6e4:	56                   	push   %esi
+ 6e5:	53                   	push   %ebx
+ 6e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 6f2:	83 c6 01             	add    $0x1,%esi
+ 6f5:	84 db                	test   %bl,%bl
+ 6f7:	74 67                	je     760 <printf+0x80>
+ 6f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6fc:	31 d2                	xor    %edx,%edx
+ 6fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 701:	eb 34                	jmp    737 <printf+0x57>
+ 703:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 707:	90                   	nop
+ 708:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 70b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 710:	83 f8 25             	cmp    $0x25,%eax
+ 713:	74 18                	je     72d <printf+0x4d>
+  write(fd, &c, 1);
+ 715:	83 ec 04             	sub    $0x4,%esp
+ 718:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 71b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 71e:	6a 01                	push   $0x1
+ 720:	50                   	push   %eax
+ 721:	57                   	push   %edi
+ 722:	e8 2c fe ff ff       	call   553 <write>
+ 727:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 72a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 72d:	0f b6 1e             	movzbl (%esi),%ebx
+ 730:	83 c6 01             	add    $0x1,%esi
+ 733:	84 db                	test   %bl,%bl
+ 735:	74 29                	je     760 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 737:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 73a:	85 d2                	test   %edx,%edx
+ 73c:	74 ca                	je     708 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 73e:	83 fa 25             	cmp    $0x25,%edx
+ 741:	75 ea                	jne    72d <printf+0x4d>
+      if(c == 'd'){
+ 743:	83 f8 25             	cmp    $0x25,%eax
+ 746:	0f 84 24 01 00 00    	je     870 <printf+0x190>
+ 74c:	83 e8 63             	sub    $0x63,%eax
+ 74f:	83 f8 15             	cmp    $0x15,%eax
+ 752:	77 1c                	ja     770 <printf+0x90>
+ 754:	ff 24 85 e4 0a 00 00 	jmp    *0xae4(,%eax,4)
+ 75b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 75f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 760:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 763:	5b                   	pop    %ebx
+ 764:	5e                   	pop    %esi
+ 765:	5f                   	pop    %edi
+ 766:	5d                   	pop    %ebp
+ 767:	c3                   	ret
+ 768:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76f:	90                   	nop
+  write(fd, &c, 1);
+ 770:	83 ec 04             	sub    $0x4,%esp
+ 773:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 776:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 77a:	6a 01                	push   $0x1
+ 77c:	52                   	push   %edx
+ 77d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 780:	57                   	push   %edi
+ 781:	e8 cd fd ff ff       	call   553 <write>
+ 786:	83 c4 0c             	add    $0xc,%esp
+ 789:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 78c:	6a 01                	push   $0x1
+ 78e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 791:	52                   	push   %edx
+ 792:	57                   	push   %edi
+ 793:	e8 bb fd ff ff       	call   553 <write>
+        putc(fd, c);
+ 798:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 79b:	31 d2                	xor    %edx,%edx
+ 79d:	eb 8e                	jmp    72d <printf+0x4d>
+ 79f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7a3:	83 ec 0c             	sub    $0xc,%esp
+ 7a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7ab:	8b 13                	mov    (%ebx),%edx
+ 7ad:	6a 00                	push   $0x0
+ 7af:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7b4:	e8 87 fe ff ff       	call   640 <printint>
+        ap++;
+ 7b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7bf:	31 d2                	xor    %edx,%edx
+ 7c1:	e9 67 ff ff ff       	jmp    72d <printf+0x4d>
+ 7c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7d5:	83 c0 04             	add    $0x4,%eax
+ 7d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7db:	85 db                	test   %ebx,%ebx
+ 7dd:	0f 84 9d 00 00 00    	je     880 <printf+0x1a0>
+        while(*s != 0){
+ 7e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7e8:	84 c0                	test   %al,%al
+ 7ea:	0f 84 3d ff ff ff    	je     72d <printf+0x4d>
+ 7f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7f6:	89 de                	mov    %ebx,%esi
+ 7f8:	89 d3                	mov    %edx,%ebx
+ 7fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 806:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 809:	6a 01                	push   $0x1
+ 80b:	53                   	push   %ebx
+ 80c:	57                   	push   %edi
+ 80d:	e8 41 fd ff ff       	call   553 <write>
+        while(*s != 0){
+ 812:	0f b6 06             	movzbl (%esi),%eax
+ 815:	83 c4 10             	add    $0x10,%esp
+ 818:	84 c0                	test   %al,%al
+ 81a:	75 e4                	jne    800 <printf+0x120>
+      state = 0;
+ 81c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 81f:	31 d2                	xor    %edx,%edx
+ 821:	e9 07 ff ff ff       	jmp    72d <printf+0x4d>
+ 826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 830:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 833:	83 ec 0c             	sub    $0xc,%esp
+ 836:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 83b:	8b 13                	mov    (%ebx),%edx
+ 83d:	6a 01                	push   $0x1
+ 83f:	e9 6b ff ff ff       	jmp    7af <printf+0xcf>
+ 844:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 848:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 84b:	83 ec 04             	sub    $0x4,%esp
+ 84e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 851:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 853:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 856:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 859:	6a 01                	push   $0x1
+ 85b:	52                   	push   %edx
+ 85c:	57                   	push   %edi
+ 85d:	e8 f1 fc ff ff       	call   553 <write>
+        ap++;
+ 862:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 865:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 868:	31 d2                	xor    %edx,%edx
+ 86a:	e9 be fe ff ff       	jmp    72d <printf+0x4d>
+ 86f:	90                   	nop
+  write(fd, &c, 1);
+ 870:	83 ec 04             	sub    $0x4,%esp
+ 873:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 876:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 879:	6a 01                	push   $0x1
+ 87b:	e9 11 ff ff ff       	jmp    791 <printf+0xb1>
+ 880:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 885:	bb da 0a 00 00       	mov    $0xada,%ebx
+ 88a:	e9 61 ff ff ff       	jmp    7f0 <printf+0x110>
+ 88f:	90                   	nop
+
+00000890 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 890:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 891:	a1 48 0e 00 00       	mov    0xe48,%eax
+{
+ 896:	89 e5                	mov    %esp,%ebp
+ 898:	57                   	push   %edi
+ 899:	56                   	push   %esi
+ 89a:	53                   	push   %ebx
+ 89b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 89e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8a8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8aa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8ac:	39 ca                	cmp    %ecx,%edx
+ 8ae:	73 30                	jae    8e0 <free+0x50>
+ 8b0:	39 c1                	cmp    %eax,%ecx
+ 8b2:	72 04                	jb     8b8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8b4:	39 c2                	cmp    %eax,%edx
+ 8b6:	72 f0                	jb     8a8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8b8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8bb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8be:	39 f8                	cmp    %edi,%eax
+ 8c0:	74 2e                	je     8f0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8c2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8c5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8c8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8cb:	39 f1                	cmp    %esi,%ecx
+ 8cd:	74 38                	je     907 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8cf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8d1:	5b                   	pop    %ebx
+  freep = p;
+ 8d2:	89 15 48 0e 00 00    	mov    %edx,0xe48
+}
+ 8d8:	5e                   	pop    %esi
+ 8d9:	5f                   	pop    %edi
+ 8da:	5d                   	pop    %ebp
+ 8db:	c3                   	ret
+ 8dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8e0:	39 c1                	cmp    %eax,%ecx
+ 8e2:	72 d0                	jb     8b4 <free+0x24>
+ 8e4:	eb c2                	jmp    8a8 <free+0x18>
+ 8e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ed:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8f0:	03 70 04             	add    0x4(%eax),%esi
+ 8f3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8f6:	8b 02                	mov    (%edx),%eax
+ 8f8:	8b 00                	mov    (%eax),%eax
+ 8fa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8fd:	8b 42 04             	mov    0x4(%edx),%eax
+ 900:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 903:	39 f1                	cmp    %esi,%ecx
+ 905:	75 c8                	jne    8cf <free+0x3f>
+    p->s.size += bp->s.size;
+ 907:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 90a:	89 15 48 0e 00 00    	mov    %edx,0xe48
+    p->s.size += bp->s.size;
+ 910:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 913:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 916:	89 0a                	mov    %ecx,(%edx)
+}
+ 918:	5b                   	pop    %ebx
+ 919:	5e                   	pop    %esi
+ 91a:	5f                   	pop    %edi
+ 91b:	5d                   	pop    %ebp
+ 91c:	c3                   	ret
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000920 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	57                   	push   %edi
+ 924:	56                   	push   %esi
+ 925:	53                   	push   %ebx
+ 926:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 929:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 92c:	8b 15 48 0e 00 00    	mov    0xe48,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 932:	8d 78 07             	lea    0x7(%eax),%edi
+ 935:	c1 ef 03             	shr    $0x3,%edi
+ 938:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 93b:	85 d2                	test   %edx,%edx
+ 93d:	0f 84 8d 00 00 00    	je     9d0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 943:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 945:	8b 48 04             	mov    0x4(%eax),%ecx
+ 948:	39 f9                	cmp    %edi,%ecx
+ 94a:	73 64                	jae    9b0 <malloc+0x90>
+  if(nu < 4096)
+ 94c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 951:	39 df                	cmp    %ebx,%edi
+ 953:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 956:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 95d:	eb 0a                	jmp    969 <malloc+0x49>
+ 95f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 960:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 962:	8b 48 04             	mov    0x4(%eax),%ecx
+ 965:	39 f9                	cmp    %edi,%ecx
+ 967:	73 47                	jae    9b0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 969:	89 c2                	mov    %eax,%edx
+ 96b:	39 05 48 0e 00 00    	cmp    %eax,0xe48
+ 971:	75 ed                	jne    960 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 973:	83 ec 0c             	sub    $0xc,%esp
+ 976:	56                   	push   %esi
+ 977:	e8 3f fc ff ff       	call   5bb <sbrk>
+  if(p == (char*)-1)
+ 97c:	83 c4 10             	add    $0x10,%esp
+ 97f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 982:	74 1c                	je     9a0 <malloc+0x80>
+  hp->s.size = nu;
+ 984:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 987:	83 ec 0c             	sub    $0xc,%esp
+ 98a:	83 c0 08             	add    $0x8,%eax
+ 98d:	50                   	push   %eax
+ 98e:	e8 fd fe ff ff       	call   890 <free>
+  return freep;
+ 993:	8b 15 48 0e 00 00    	mov    0xe48,%edx
+      if((p = morecore(nunits)) == 0)
+ 999:	83 c4 10             	add    $0x10,%esp
+ 99c:	85 d2                	test   %edx,%edx
+ 99e:	75 c0                	jne    960 <malloc+0x40>
+        return 0;
+  }
+}
+ 9a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9a3:	31 c0                	xor    %eax,%eax
+}
+ 9a5:	5b                   	pop    %ebx
+ 9a6:	5e                   	pop    %esi
+ 9a7:	5f                   	pop    %edi
+ 9a8:	5d                   	pop    %ebp
+ 9a9:	c3                   	ret
+ 9aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9b0:	39 cf                	cmp    %ecx,%edi
+ 9b2:	74 4c                	je     a00 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9b4:	29 f9                	sub    %edi,%ecx
+ 9b6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9b9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9bc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9bf:	89 15 48 0e 00 00    	mov    %edx,0xe48
+}
+ 9c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9c8:	83 c0 08             	add    $0x8,%eax
+}
+ 9cb:	5b                   	pop    %ebx
+ 9cc:	5e                   	pop    %esi
+ 9cd:	5f                   	pop    %edi
+ 9ce:	5d                   	pop    %ebp
+ 9cf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9d0:	c7 05 48 0e 00 00 4c 	movl   $0xe4c,0xe48
+ 9d7:	0e 00 00 
+    base.s.size = 0;
+ 9da:	b8 4c 0e 00 00       	mov    $0xe4c,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9df:	c7 05 4c 0e 00 00 4c 	movl   $0xe4c,0xe4c
+ 9e6:	0e 00 00 
+    base.s.size = 0;
+ 9e9:	c7 05 50 0e 00 00 00 	movl   $0x0,0xe50
+ 9f0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9f3:	e9 54 ff ff ff       	jmp    94c <malloc+0x2c>
+ 9f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a00:	8b 08                	mov    (%eax),%ecx
+ a02:	89 0a                	mov    %ecx,(%edx)
+ a04:	eb b9                	jmp    9bf <malloc+0x9f>
@@ -0,0 +1,86 @@
+// Path lookup benchmark.
+// Builds a directory chain DEPTH deep with a file at the bottom,
+// then opens the file, and a name that does not exist beside it,
+// over and over, and reports path components looked up per tick.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define DEPTH  8
+#define NOPEN  1000
+
+char path[3*DEPTH + 16];
+
+void
+report(char *what, int n, uint elapsed)
+{
+  printf(1, "namebench: %d %s opens (%d lookups) in %d ticks",
+         n, what, n * (DEPTH + 2), elapsed);
+  if(elapsed > 0)
+    printf(1, " (%d lookups/tick)", n * (DEPTH + 2) / elapsed);
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, n, fd, len;
+  uint start;
+
+  n = NOPEN;
+  if(argc > 1)
+    n = atoi(argv[1]);
+
+  // nb/a/b/.../h
+  strcpy(path, "nb");
+  len = 2;
+  if(mkdir(path) < 0){
+    printf(1, "namebench: mkdir %s failed\n", path);
+    exit();
+  }
+  for(i = 0; i < DEPTH; i++){
+    path[len++] = '/';
+    path[len++] = 'a' + i;
+    path[len] = 0;
+    if(mkdir(path) < 0){
+      printf(1, "namebench: mkdir %s failed\n", path);
+      exit();
+    }
+  }
+  strcpy(path + len, "/file");
+  if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+    printf(1, "namebench: create %s failed\n", path);
+    exit();
+  }
+  close(fd);
+
+  start = uptime();
+  for(i = 0; i < n; i++){
+    if((fd = open(path, O_RDONLY)) < 0){
+      printf(1, "namebench: open %s failed\n", path);
+      exit();
+    }
+    close(fd);
+  }
+  report("found", n, uptime() - start);
+
+  strcpy(path + len, "/none");
+  start = uptime();
+  for(i = 0; i < n; i++)
+    if(open(path, O_RDONLY) >= 0){
+      printf(1, "namebench: open %s succeeded\n", path);
+      exit();
+    }
+  report("missing", n, uptime() - start);
+
+  strcpy(path + len, "/file");
+  unlink(path);
+  for(; len > 2; len -= 2){
+    path[len] = 0;
+    unlink(path);
+  }
+  unlink("nb");
+  exit();
+}
@@ -3,12 +3,18 @@
 #define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
 #define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define NINODE      200  // size of the in-memory i-node cache
+#define NDCACHE     512  // entries in the directory name cache
+#define NTEXT       256  // pages in the program text cache
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
+#define NSEG          4  // max loadable segments in a program
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
-
+#define LOGSIZE      (MAXOPBLOCKS*3)  // min blocks in on-disk log; mkfs scales it up
+#define NBUF        4096  // maximum size of disk block cache
+#ifndef FSSIZE
+#define FSSIZE      (12*1024*1024/BSIZE)  // mkfs's file system size in blocks
+#endif
+#define MAXTICKETS   (1<<24)  // max lottery tickets per process
+#define SCHEDPOLICY  0  // boot-time scheduling policy (SCHED_* in proc.h)
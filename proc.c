@@ -4,9 +4,11 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
 #define PHI 0x9e3779
+#define STRIDE1 MAXTICKETS      // stride of a one-ticket process
+#define NOPASS  (~0ULL)         // pass[] value of an empty slot
 
 struct {
   struct spinlock lock;
@@ -14,13 +16,12 @@ struct {
 } ptable;
 
 static struct proc *initproc;
+static int schedpolicy = SCHEDPOLICY;
 
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
-
 
 /* The following code is added by haoda le and netid hxl180046 
 **Random function. 
@@ -60,33 +61,186 @@ uint rand(void)
 }
 /* End of code added*/
 
-// Binary Search for upper bound
-int bin_search(int * arr, int value, int low, int high)
-{
-   int mid = -1;
-   while (low <= high)
-   {
-	mid = (low+high)/2;
-        if (arr[mid] == value)
-	{
-	    return mid;
-        }
-	else if (arr[mid] < value)
-	{
-	    low = mid + 1;
-	}
-	else {
-	    high = mid - 1;
-	}
-   }
-   return mid;
+//PAGEBREAK: 40
+// Per-CPU run queues.
+// Every RUNNABLE process sits on exactly one CPU's run queue,
+// whose Fenwick tree lets that CPU draw a lottery winner in
+// O(log NPROC) without scanning ptable, and whose pass tree
+// yields the stride scheduling choice at its root.  Newly
+// runnable processes go to the queue with the fewest tickets,
+// so each CPU hands out roughly the same number of tickets per
+// tick and the lottery stays proportional across the whole
+// machine; a yielding process stays on its own CPU, and an idle
+// CPU steals from the busiest queue.
+//
+// Locking.  A process's p->lock guards its state and chan, so
+// every transition goes through setstate() with p->lock held,
+// and sleep() and wakeup() meet on it.  A queue's lock guards
+// only the queue and is taken after p->lock; the scheduler
+// picks under the queue lock alone and then claims the winner
+// with its p->lock, so CPUs never serialize on ptable.lock,
+// which guards only slot allocation and the parent links
+// used by exit() and wait().  Lock order: ptable.lock, p->lock,
+// queue lock.  nproc and total may be read without the lock as
+// hints.
+
+// Add delta tickets to p's slot in rq's tree.
+static void
+rq_add(struct runqueue *rq, struct proc *p, int delta)
+{
+  int i;
+
+  rq->total += delta;
+  for(i = p - ptable.proc + 1; i <= NPROC; i += i & -i)
+    rq->tickets[i] += delta;
+}
+
+// Return the process in rq holding ticket n,
+// where 1 <= n <= rq->total.
+static struct proc*
+rq_pick(struct runqueue *rq, int n)
+{
+  int i, step;
+
+  for(step = 1; step <= NPROC/2; step <<= 1)
+    ;
+  // Descend to the largest i whose prefix sum is below n;
+  // the winner then lives in slot i+1, i.e. ptable.proc[i].
+  i = 0;
+  for(; step > 0; step >>= 1){
+    if(i + step <= NPROC && rq->tickets[i + step] < n){
+      i += step;
+      n -= rq->tickets[i];
+    }
+  }
+  return &ptable.proc[i];
+}
+
+// Set p's slot in rq's pass tree to pass.
+static void
+rq_setpass(struct runqueue *rq, struct proc *p, unsigned long long pass)
+{
+  int i;
+
+  i = NPROC + (p - ptable.proc);
+  rq->pass[i] = pass;
+  for(i >>= 1; i > 0; i >>= 1){
+    if(rq->pass[2*i] < rq->pass[2*i+1])
+      rq->pass[i] = rq->pass[2*i];
+    else
+      rq->pass[i] = rq->pass[2*i+1];
+  }
 }
 
+// Return the process in rq with the smallest pass.
+// rq must not be empty.
+static struct proc*
+rq_minpass(struct runqueue *rq)
+{
+  int i;
+
+  for(i = 1; i < NPROC; )
+    i = rq->pass[2*i] == rq->pass[i] ? 2*i : 2*i+1;
+  return &ptable.proc[i - NPROC];
+}
+
+static void
+enqueue(struct runqueue *rq, struct proc *p)
+{
+  acquire(&rq->lock);
+  // Don't let a process that slept or moved here
+  // claim the CPU time it missed.
+  if(p->pass < rq->vtime)
+    p->pass = rq->vtime;
+  rq_setpass(rq, p, p->pass);
+  rq_add(rq, p, p->ticket_count);
+  rq->nproc++;
+  p->rq = rq;
+  release(&rq->lock);
+}
+
+// Take p off its queue.  If p is leaving to run, charge it
+// its stride and advance the queue's clock to its pass.
+static void
+dequeue(struct proc *p, int run)
+{
+  struct runqueue *rq;
+
+  rq = p->rq;
+  acquire(&rq->lock);
+  if(run){
+    rq->vtime = p->pass;
+    p->pass += STRIDE1 / p->ticket_count;
+  }
+  rq_setpass(rq, p, NOPASS);
+  rq_add(rq, p, -p->ticket_count);
+  rq->nproc--;
+  p->rq = 0;
+  release(&rq->lock);
+}
+
+// Return the run queue with the fewest tickets.
+static struct runqueue*
+rq_lightest(void)
+{
+  struct cpu *c, *best;
+
+  best = cpus;
+  for(c = cpus; c < cpus+ncpu; c++)
+    if(c->rq.total < best->rq.total)
+      best = c;
+  return &best->rq;
+}
+
+// Return the run queue with the most waiting processes,
+// or 0 if every queue is empty.
+static struct runqueue*
+rq_busiest(void)
+{
+  struct cpu *c, *best;
+
+  best = 0;
+  for(c = cpus; c < cpus+ncpu; c++)
+    if(c->rq.nproc > 0 && (best == 0 || c->rq.nproc > best->rq.nproc))
+      best = c;
+  return best ? &best->rq : 0;
+}
+
+// Move p to state, keeping the run queues in sync.
+// Caller must hold p->lock.
+static void
+setstate(struct proc *p, enum procstate state)
+{
+  if(!holding(&p->lock))
+    panic("setstate");
+  if(p->state == RUNNABLE)
+    dequeue(p, state == RUNNING);
+  if(state == RUNNABLE){
+    // A preempted process keeps its CPU; anything
+    // else goes where it will get the fairest share.
+    if(p->state == RUNNING && p == proc)
+      enqueue(&cpu->rq, p);
+    else
+      enqueue(rq_lightest(), p);
+  }
+  p->state = state;
+}
 
 void
 pinit(void)
 {
+  struct cpu *c;
+  struct proc *p;
+  int i;
+
   initlock(&ptable.lock, "ptable");
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    initlock(&p->lock, "proc");
+  for(c = cpus; c < cpus+NCPU; c++){
+    initlock(&c->rq.lock, "runqueue");
+    for(i = 0; i < 2*NPROC; i++)
+      c->rq.pass[i] = NOPASS;
+  }
 }
 
 //PAGEBREAK: 32
@@ -117,6 +271,7 @@ found:
   p->context_switch_count = 0;
   p->scheduled_count = 0;
   p->ticket_count = 10;
+  p->pass = 0;
   release(&ptable.lock);
 
   // Allocate kernel stack.
@@ -145,6 +300,30 @@ found:
   return p;
 }
 
+// Start a kernel thread that runs fn(), which must never return.
+// It has no user memory, so it runs on a kernel-only page table.
+void
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0)
+    panic("kthread");
+  if((p->pgdir = setupkvm()) == 0)
+    panic("kthread: out of memory");
+  p->sz = 0;
+  p->parent = 0;
+  p->cwd = 0;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  // forkret() returns to fn instead of trapret.
+  *(uint*)(p->context + 1) = (uint)fn;
+
+  acquire(&p->lock);
+  setstate(p, RUNNABLE);
+  release(&p->lock);
+}
+
 //PAGEBREAK: 32
 // Set up first user process.
 void
@@ -176,11 +355,11 @@ userinit(void)
   // run this process. the acquire forces the above
   // writes to be visible, and the lock is also needed
   // because the assignment might not be atomic.
-  acquire(&ptable.lock);
+  acquire(&p->lock);
 
-  p->state = RUNNABLE;
+  setstate(p, RUNNABLE);
 
-  release(&ptable.lock);
+  release(&p->lock);
 }
 
 // Grow current process's memory by n bytes.
@@ -203,13 +382,24 @@ old_growproc(int n)
   return 0;
 }
 //new growproc
+// Growing only moves proc->sz; pagefault() zero-fills each new
+// page when it is first touched.  Shrinking frees the pages
+// that were touched.
 int
 growproc(int n)
 {
-  uint sz;
+  uint sz, newsz;
 
   sz = proc->sz;
-  proc->sz = sz+n;
+  newsz = sz + n;
+  if(n > 0 && (newsz < sz || newsz >= KERNBASE))
+    return -1;
+  if(n < 0){
+    if(newsz > sz)
+      return -1;
+    deallocuvm(proc->pgdir, sz, newsz);
+  }
+  proc->sz = newsz;
   switchuvm(proc);
   return 0;
 }
@@ -247,16 +437,21 @@ fork(void)
     if(proc->ofile[i])
       np->ofile[i] = filedup(proc->ofile[i]);
   np->cwd = idup(proc->cwd);
+  if(proc->exe){
+    np->exe = idup(proc->exe);
+    iexec(np->exe, 1);
+  }
+  memmove(np->seg, proc->seg, sizeof(np->seg));
 
   safestrcpy(np->name, proc->name, sizeof(proc->name));
 
   pid = np->pid;
 
-  acquire(&ptable.lock);
+  acquire(&np->lock);
 
-  np->state = RUNNABLE;
+  setstate(np, RUNNABLE);
 
-  release(&ptable.lock);
+  release(&np->lock);
 
   return pid;
 }
@@ -281,31 +476,74 @@ exit(void)
     }
   }
 
+  if(proc->exe)
+    iexec(proc->exe, -1);
   begin_op();
   iput(proc->cwd);
+  if(proc->exe)
+    iput(proc->exe);
   end_op();
   proc->cwd = 0;
+  proc->exe = 0;
 
   acquire(&ptable.lock);
 
   // Parent might be sleeping in wait().
-  wakeup1(proc->parent);
+  wakeup(proc->parent);
 
-  // Pass abandoned children to init.
+  // Pass abandoned children to init, which may
+  // have zombies among them to collect.
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->parent == proc){
       p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
+      wakeup(initproc);
     }
   }
 
-  // Jump into the scheduler, never to return.
-  proc->state = ZOMBIE;
+  // Jump into the scheduler, never to return.  Our
+  // p->lock is held until the scheduler has switched
+  // off this stack, so wait() cannot free it under us.
+  acquire(&proc->lock);
+  setstate(proc, ZOMBIE);
+  release(&ptable.lock);
   sched();
   panic("zombie exit");
 }
 
+// Set the current process's ticket count.
+// Returns the new count, or -1 if n is out of range.
+int
+settickets(int n)
+{
+  if(n < 1 || n > MAXTICKETS)
+    return -1;
+  acquire(&proc->lock);
+  if(proc->state == RUNNABLE){
+    acquire(&proc->rq->lock);
+    rq_add(proc->rq, proc, n - proc->ticket_count);
+    release(&proc->rq->lock);
+  }
+  proc->ticket_count = n;
+  release(&proc->lock);
+  return n;
+}
+
+// Select the scheduling policy (SCHED_LOTTERY or SCHED_STRIDE).
+// Returns the previous policy, or -1 if policy is unknown.
+int
+setsched(int policy)
+{
+  int old;
+
+  if(policy != SCHED_LOTTERY && policy != SCHED_STRIDE)
+    return -1;
+  acquire(&ptable.lock);
+  old = schedpolicy;
+  schedpolicy = policy;
+  release(&ptable.lock);
+  return old;
+}
+
 void
 count_processes(struct processes_info *pi)
 {
@@ -325,6 +563,20 @@ count_processes(struct processes_info *pi)
   release(&ptable.lock);
 }
 
+void
+count_cpus(struct cpus_info *ci)
+{
+  int i;
+
+  acquire(&ptable.lock);
+  for(i = 0; i < ncpu; i++){
+    ci->switches[i] = cpus[i].nswitch;
+    ci->steals[i] = cpus[i].nsteal;
+    ci->runnable[i] = cpus[i].rq.nproc;
+  }
+  ci->num_cpus = ncpu;
+  release(&ptable.lock);
+}
 
 // Wait for a child process to exit and return its pid.
 // Return -1 if this process has no children.
@@ -342,6 +594,7 @@ wait(void)
       if(p->parent != proc)
         continue;
       havekids = 1;
+      acquire(&p->lock);
       if(p->state == ZOMBIE){
         // Found one.
         pid = p->pid;
@@ -352,10 +605,12 @@ wait(void)
         p->parent = 0;
         p->name[0] = 0;
         p->killed = 0;
-        p->state = UNUSED;
+        setstate(p, UNUSED);
+        release(&p->lock);
         release(&ptable.lock);
         return pid;
       }
+      release(&p->lock);
     }
 
     // No point waiting if we don't have any children.
@@ -364,7 +619,7 @@ wait(void)
       return -1;
     }
 
-    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
+    // Wait for children to exit.  (See wakeup call in exit.)
     sleep(proc, &ptable.lock);  //DOC: wait-sleep
   }
 }
@@ -387,17 +642,19 @@ old_scheduler(void)
     sti();
 
     // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
     for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
+      acquire(&p->lock);
+      if(p->state != RUNNABLE){
+        release(&p->lock);
         continue;
+      }
 
       // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
+      // to release p->lock and then reacquire it
       // before jumping back to us.
       proc = p;
       switchuvm(p);
-      p->state = RUNNING;
+      setstate(p, RUNNING);
       p->scheduled_count++;
       swtch(&cpu->scheduler, p->context);
       switchkvm();
@@ -405,84 +662,90 @@ old_scheduler(void)
       // Process is done running for now.
       // It should have changed its p->state before coming back.
       proc = 0;
+      release(&p->lock);
     }
-    release(&ptable.lock);
 
   }
 }
-//new scheduler -> lottery ticket scheduling
+// Proportional-share scheduler.  Under SCHED_LOTTERY, draw a
+// ticket uniformly among the tickets on this CPU's run queue and
+// run its holder; under SCHED_STRIDE, run the queued process with
+// the smallest pass.  Either way the winner's pass then advances
+// by its stride, so the policy can be switched at any time.  An
+// idle CPU picks from the busiest queue instead.  The pick
+// holds only that queue's lock; the winner is then claimed
+// under its p->lock, and if another CPU claimed it first the
+// loop simply picks again.  While nothing is runnable anywhere
+// the loop only reads the queue counters, so idle CPUs spin on
+// no lock at all.
 void
 scheduler(void)
 {
   struct proc *p;
-  struct processes_info *pi;
-  struct processes_info obj_pi = {};
-  pi = &obj_pi;
-  int total_tickets, i, count;
-  //int idx;
-  //unsigned int * rand_arg;
-  long randval = 0;
-
+  struct runqueue *rq;
   static int have_seeded = 0;
   const int seed = 1323;
+
   if(!have_seeded)
   {
       srand(seed);
       have_seeded = 1;
   }
-  /* End of code added */
-  //rand_arg = (unsigned int *) kalloc();
-  //cprintf("before infinite loop\n");
   for(;;){
     // Enable interrupts on this processor.
     sti();
-    //pi = (struct processes_info *) kalloc();
-    count_processes(pi);
-    total_tickets = pi->tickets[0];
-    count = 0;
-    //cprintf("before num_processes loop, num processes: %d\n", pi->num_processes);
-    for (i = 1; i < pi->num_processes; i++)
-    {
-        pi->tickets[i] += pi->tickets[i-1];
-	total_tickets = pi->tickets[i];
+
+    rq = &cpu->rq;
+    if(rq->nproc == 0 && (rq = rq_busiest()) == 0){
+      kzerofill();  // nothing to run: clear a page for later
+      continue;
     }
-    //cprintf("after num_processes loop, total tickets: %d\n", total_tickets);
-    if (total_tickets) randval = (rand()%total_tickets) + 1;
-    //idx = bin_search(pi->tickets, randval,0, pi->num_processes-1);
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
-      if (count + p->ticket_count < randval)
-      {
-        count += p->ticket_count; 
-        continue;
-      }
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
-      else { 
-	      proc = p;
-	      switchuvm(p);
-	      p->state = RUNNING;
-	      p->scheduled_count++;
-	      swtch(&cpu->scheduler, p->context);
-	      switchkvm();
-
-	      // Process is done running for now.
-	      // It should have changed its p->state before coming back.
-	      proc = 0;
-              break;
-      }
+
+    // rand() is shared by all CPUs; a racing draw only
+    // perturbs the sequence, and the result stays in range.
+    p = 0;
+    acquire(&rq->lock);
+    if(rq->nproc > 0){
+      if(schedpolicy == SCHED_STRIDE)
+        p = rq_minpass(rq);
+      else
+        p = rq_pick(rq, rand() % rq->total + 1);
     }
-    release(&ptable.lock);
+    release(&rq->lock);
+    if(p == 0)
+      continue;
 
+    // Claim the winner.  Between the pick and here another
+    // CPU may have taken it; dequeueing needs p->lock, so
+    // the state check below settles the race.
+    acquire(&p->lock);
+    if(p->state != RUNNABLE || p->rq != rq){
+      release(&p->lock);
+      continue;
+    }
+    if(rq != &cpu->rq)
+      cpu->nsteal++;
+
+    // Switch to chosen process.  It is the process's job
+    // to release p->lock and then reacquire it
+    // before jumping back to us.
+    proc = p;
+    switchuvm(p);
+    setstate(p, RUNNING);
+    p->scheduled_count++;
+    cpu->nswitch++;
+    swtch(&cpu->scheduler, p->context);
+    switchkvm();
+
+    // Process is done running for now.
+    // It should have changed its p->state before coming back.
+    proc = 0;
+    release(&p->lock);
   }
 }
 
 
-// Enter scheduler.  Must hold only ptable.lock
+// Enter scheduler.  Must hold only proc->lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
 // kernel thread, not this CPU. It should
@@ -494,8 +757,8 @@ sched(void)
 {
   int intena;
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(&proc->lock))
+    panic("sched proc->lock");
   if(cpu->ncli != 1)
     panic("sched locks");
   if(proc->state == RUNNING)
@@ -512,10 +775,10 @@ sched(void)
 void
 yield(void)
 {
-  acquire(&ptable.lock);  //DOC: yieldlock
-  proc->state = RUNNABLE;
+  acquire(&proc->lock);  //DOC: yieldlock
+  setstate(proc, RUNNABLE);
   sched();
-  release(&ptable.lock);
+  release(&proc->lock);
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -524,8 +787,8 @@ void
 forkret(void)
 {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding proc->lock from scheduler.
+  release(&proc->lock);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -534,6 +797,7 @@ forkret(void)
     first = 0;
     iinit(ROOTDEV);
     initlog(ROOTDEV);
+    ballocinit(ROOTDEV);
   }
 
   // Return to "caller", actually trapret (see allocproc).
@@ -550,52 +814,44 @@ sleep(void *chan, struct spinlock *lk)
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
+  // Must acquire proc->lock in order to
   // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
+  // Once we hold proc->lock, we can be
   // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
+  // (wakeup locks each p->lock),
   // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1
-    release(lk);
-  }
+  acquire(&proc->lock);  //DOC: sleeplock1
+  release(lk);
 
   // Go to sleep.
   proc->chan = chan;
-  proc->state = SLEEPING;
+  setstate(proc, SLEEPING);
   sched();
 
   // Tidy up.
   proc->chan = 0;
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  release(&proc->lock);
+  acquire(lk);
 }
 
 //PAGEBREAK!
 // Wake up all processes sleeping on chan.
-// The ptable lock must be held.
-static void
-wakeup1(void *chan)
+// Must be called without any p->lock held.
+void
+wakeup(void *chan)
 {
   struct proc *p;
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p == proc)
+      continue;
+    acquire(&p->lock);
     if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
-}
-
-// Wake up all processes sleeping on chan.
-void
-wakeup(void *chan)
-{
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+      setstate(p, RUNNABLE);
+    release(&p->lock);
+  }
 }
 
 // Kill the process with the given pid.
@@ -606,18 +862,18 @@ kill(int pid)
 {
   struct proc *p;
 
-  acquire(&ptable.lock);
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    acquire(&p->lock);
     if(p->pid == pid){
       p->killed = 1;
       // Wake process from sleep if necessary.
       if(p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
+        setstate(p, RUNNABLE);
+      release(&p->lock);
       return 0;
     }
+    release(&p->lock);
   }
-  release(&ptable.lock);
   return -1;
 }
 
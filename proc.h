@@ -1,3 +1,20 @@
+// Scheduling policies, see setsched().
+#define SCHED_LOTTERY 0
+#define SCHED_STRIDE  1
+
+// Per-CPU run queue.  tickets[] is a Fenwick (binary indexed)
+// tree over the slots of ptable.proc holding the ticket count of
+// every RUNNABLE process queued on this CPU; pass[] is a min tree
+// over the same slots holding their stride scheduling pass values.
+struct runqueue {
+  struct spinlock lock;
+  int tickets[NPROC+1];
+  unsigned long long pass[2*NPROC];
+  unsigned long long vtime;    // Pass of the last process picked here
+  int total;                   // Sum of tickets queued here
+  volatile int nproc;          // Number of processes queued here
+};
+
 // Per-CPU state
 struct cpu {
   uchar apicid;                // Local APIC ID
@@ -7,6 +24,12 @@ struct cpu {
   volatile uint started;       // Has the CPU started?
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
+  struct runqueue rq;          // RUNNABLE processes waiting for this CPU
+  uint nswitch;                // Number of switches into a process
+  uint nsteal;                 // Processes taken from another CPU's rq
+  struct spinlock flock;       // Guards freelist and nfree
+  struct run *freelist;        // Per-CPU cache of free pages (kalloc.c)
+  int nfree;                   // Number of pages in freelist
 
   // Cpu-local storage variables; see below
   struct cpu *cpu;
@@ -46,10 +69,20 @@ struct context {
   uint eip;
 };
 
+// Part of a process's memory that is read from its program file
+// the first time each page is touched, see exec() and loadpage().
+struct segment {
+  uint va;                     // First address, page-aligned
+  uint memsz;                  // Bytes of memory (0 if unused)
+  uint off;                    // File offset of the byte at va
+  uint filesz;                 // Bytes from the file; the rest are zero
+};
+
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
 // Per-process state
 struct proc {
+  struct spinlock lock;        // Guards state and chan, see proc.c
   uint sz;                     // Size of process memory (bytes)
   pde_t* pgdir;                // Page table
   char *kstack;                // Bottom of kernel stack for this process
@@ -62,12 +95,16 @@ struct proc {
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
+  struct inode *exe;           // Program file, if segments load from it
+  struct segment seg[NSEG];    // Segments not yet read in are paged from exe
   char name[16];               // Process name (debugging)
   int is_traced;
   int syscall_count;
   int context_switch_count;
   int ticket_count;
   int scheduled_count;
+  struct runqueue *rq;         // Run queue holding this proc if RUNNABLE
+  unsigned long long pass;     // Stride scheduling virtual time
 };
 
 
@@ -84,7 +121,27 @@ struct processes_info {
     int tickets[NPROC];     // tickets = number of tickets set by settickets()
 };
 
+struct cpus_info {
+    int num_cpus;
+    int switches[NCPU];     // switches = number of processes run on each cpu
+    int steals[NCPU];       // steals = processes taken from another cpu's queue
+    int runnable[NCPU];     // runnable = processes now queued on each cpu
+};
+
+// Page fault counters, see pagefault() in trap.c.
+struct fault_info {
+    uint zero;              // zero = heap and stack pages zero-filled on first write
+    uint zeroread;          // zeroread = first reads that mapped the shared zero page
+    uint exec;              // exec = program pages mapped from the file
+    uint copy;              // copy = copy-on-write faults that copied the page
+    uint reuse;             // reuse = copy-on-write faults on a page no longer shared
+    uint bad;               // bad = faults on addresses the process may not touch
+    uint zpool;             // zpool = zeroed pages taken from the idle-time pool
+    uint zclear;            // zclear = zeroed pages cleared on demand, pool empty
+};
+
 void count_processes(struct processes_info *pi);
+void count_cpus(struct cpus_info *ci);
 struct proc * getProcByPid(int pid);
 
 #ifndef DEF_YIELD
@@ -0,0 +1,1236 @@
+
+_processlist:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "param.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "user.h"
+int main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+    struct processes_info info;
+    info.num_processes = -9999;  // to make sure getprocessesinfo() doesn't
+                                 // depend on its initial value
+    getprocessesinfo(&info);
+   f:	8d b5 e4 fc ff ff    	lea    -0x31c(%ebp),%esi
+{
+  15:	51                   	push   %ecx
+  16:	81 ec 28 03 00 00    	sub    $0x328,%esp
+    info.num_processes = -9999;  // to make sure getprocessesinfo() doesn't
+  1c:	c7 85 e4 fc ff ff f1 	movl   $0xffffd8f1,-0x31c(%ebp)
+  23:	d8 ff ff 
+    getprocessesinfo(&info);
+  26:	56                   	push   %esi
+  27:	e8 8f 03 00 00       	call   3bb <getprocessesinfo>
+    if (info.num_processes < 0) {
+  2c:	8b 85 e4 fc ff ff    	mov    -0x31c(%ebp),%eax
+  32:	83 c4 10             	add    $0x10,%esp
+  35:	85 c0                	test   %eax,%eax
+  37:	78 6b                	js     a4 <main+0xa4>
+        printf(1, "ERROR: negative number of processes!\n"
+                  "Myabe getprocessesinfo() assumes that num_processes is\n"
+                  "always initialized to 0?\n");
+    }
+    printf(1, "%d running processes\n", info.num_processes);
+  39:	83 ec 04             	sub    $0x4,%esp
+    printf(1, "PID\tTICKETS\tTICKS\n");
+    int i;
+    for (i = 0; i < info.num_processes; ++i) {
+  3c:	31 db                	xor    %ebx,%ebx
+    printf(1, "%d running processes\n", info.num_processes);
+  3e:	50                   	push   %eax
+  3f:	68 4e 08 00 00       	push   $0x84e
+  44:	6a 01                	push   $0x1
+  46:	e8 65 04 00 00       	call   4b0 <printf>
+    printf(1, "PID\tTICKETS\tTICKS\n");
+  4b:	58                   	pop    %eax
+  4c:	5a                   	pop    %edx
+  4d:	68 64 08 00 00       	push   $0x864
+  52:	6a 01                	push   $0x1
+  54:	e8 57 04 00 00       	call   4b0 <printf>
+    for (i = 0; i < info.num_processes; ++i) {
+  59:	8b 8d e4 fc ff ff    	mov    -0x31c(%ebp),%ecx
+  5f:	83 c4 10             	add    $0x10,%esp
+  62:	85 c9                	test   %ecx,%ecx
+  64:	7e 39                	jle    9f <main+0x9f>
+  66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6d:	8d 76 00             	lea    0x0(%esi),%esi
+        printf(1, "%d\t%d\t%d\n", info.pids[i], info.tickets[i], info.ticks[i]);
+  70:	83 ec 0c             	sub    $0xc,%esp
+  73:	ff b4 9e 04 01 00 00 	push   0x104(%esi,%ebx,4)
+  7a:	ff b4 9e 04 02 00 00 	push   0x204(%esi,%ebx,4)
+  81:	ff 74 9e 04          	push   0x4(%esi,%ebx,4)
+    for (i = 0; i < info.num_processes; ++i) {
+  85:	83 c3 01             	add    $0x1,%ebx
+        printf(1, "%d\t%d\t%d\n", info.pids[i], info.tickets[i], info.ticks[i]);
+  88:	68 77 08 00 00       	push   $0x877
+  8d:	6a 01                	push   $0x1
+  8f:	e8 1c 04 00 00       	call   4b0 <printf>
+    for (i = 0; i < info.num_processes; ++i) {
+  94:	83 c4 20             	add    $0x20,%esp
+  97:	39 9d e4 fc ff ff    	cmp    %ebx,-0x31c(%ebp)
+  9d:	7f d1                	jg     70 <main+0x70>
+    }
+    exit();
+  9f:	e8 5f 02 00 00       	call   303 <exit>
+        printf(1, "ERROR: negative number of processes!\n"
+  a4:	53                   	push   %ebx
+  a5:	53                   	push   %ebx
+  a6:	68 d8 07 00 00       	push   $0x7d8
+  ab:	6a 01                	push   $0x1
+  ad:	e8 fe 03 00 00       	call   4b0 <printf>
+    printf(1, "%d running processes\n", info.num_processes);
+  b2:	8b 85 e4 fc ff ff    	mov    -0x31c(%ebp),%eax
+  b8:	83 c4 10             	add    $0x10,%esp
+  bb:	e9 79 ff ff ff       	jmp    39 <main+0x39>
+
+000000c0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  c1:	31 c0                	xor    %eax,%eax
+{
+  c3:	89 e5                	mov    %esp,%ebp
+  c5:	53                   	push   %ebx
+  c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  d7:	83 c0 01             	add    $0x1,%eax
+  da:	84 d2                	test   %dl,%dl
+  dc:	75 f2                	jne    d0 <strcpy+0x10>
+    ;
+  return os;
+}
+  de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e1:	89 c8                	mov    %ecx,%eax
+  e3:	c9                   	leave
+  e4:	c3                   	ret
+  e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	53                   	push   %ebx
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  fa:	0f b6 02             	movzbl (%edx),%eax
+  fd:	84 c0                	test   %al,%al
+  ff:	75 17                	jne    118 <strcmp+0x28>
+ 101:	eb 3a                	jmp    13d <strcmp+0x4d>
+ 103:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 107:	90                   	nop
+ 108:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 10c:	83 c2 01             	add    $0x1,%edx
+ 10f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 112:	84 c0                	test   %al,%al
+ 114:	74 1a                	je     130 <strcmp+0x40>
+    p++, q++;
+ 116:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 118:	0f b6 19             	movzbl (%ecx),%ebx
+ 11b:	38 c3                	cmp    %al,%bl
+ 11d:	74 e9                	je     108 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 11f:	29 d8                	sub    %ebx,%eax
+}
+ 121:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 124:	c9                   	leave
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 130:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 134:	31 c0                	xor    %eax,%eax
+ 136:	29 d8                	sub    %ebx,%eax
+}
+ 138:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 13b:	c9                   	leave
+ 13c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 13d:	0f b6 19             	movzbl (%ecx),%ebx
+ 140:	31 c0                	xor    %eax,%eax
+ 142:	eb db                	jmp    11f <strcmp+0x2f>
+ 144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 156:	80 3a 00             	cmpb   $0x0,(%edx)
+ 159:	74 15                	je     170 <strlen+0x20>
+ 15b:	31 c0                	xor    %eax,%eax
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+ 160:	83 c0 01             	add    $0x1,%eax
+ 163:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 167:	89 c1                	mov    %eax,%ecx
+ 169:	75 f5                	jne    160 <strlen+0x10>
+    ;
+  return n;
+}
+ 16b:	89 c8                	mov    %ecx,%eax
+ 16d:	5d                   	pop    %ebp
+ 16e:	c3                   	ret
+ 16f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 170:	31 c9                	xor    %ecx,%ecx
+}
+ 172:	5d                   	pop    %ebp
+ 173:	89 c8                	mov    %ecx,%eax
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000180 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 187:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 18a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18d:	89 d7                	mov    %edx,%edi
+ 18f:	fc                   	cld
+ 190:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 192:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 195:	89 d0                	mov    %edx,%eax
+ 197:	c9                   	leave
+ 198:	c3                   	ret
+ 199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1aa:	0f b6 10             	movzbl (%eax),%edx
+ 1ad:	84 d2                	test   %dl,%dl
+ 1af:	75 12                	jne    1c3 <strchr+0x23>
+ 1b1:	eb 1d                	jmp    1d0 <strchr+0x30>
+ 1b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1b7:	90                   	nop
+ 1b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1bc:	83 c0 01             	add    $0x1,%eax
+ 1bf:	84 d2                	test   %dl,%dl
+ 1c1:	74 0d                	je     1d0 <strchr+0x30>
+    if(*s == c)
+ 1c3:	38 d1                	cmp    %dl,%cl
+ 1c5:	75 f1                	jne    1b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1c7:	5d                   	pop    %ebp
+ 1c8:	c3                   	ret
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1d0:	31 c0                	xor    %eax,%eax
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	c3                   	ret
+ 1d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+
+000001e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1e9:	31 db                	xor    %ebx,%ebx
+{
+ 1eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ee:	eb 27                	jmp    217 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1f0:	83 ec 04             	sub    $0x4,%esp
+ 1f3:	6a 01                	push   $0x1
+ 1f5:	56                   	push   %esi
+ 1f6:	6a 00                	push   $0x0
+ 1f8:	e8 1e 01 00 00       	call   31b <read>
+    if(cc < 1)
+ 1fd:	83 c4 10             	add    $0x10,%esp
+ 200:	85 c0                	test   %eax,%eax
+ 202:	7e 1d                	jle    221 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 204:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 208:	8b 55 08             	mov    0x8(%ebp),%edx
+ 20b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 20f:	3c 0a                	cmp    $0xa,%al
+ 211:	74 10                	je     223 <gets+0x43>
+ 213:	3c 0d                	cmp    $0xd,%al
+ 215:	74 0c                	je     223 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 217:	89 df                	mov    %ebx,%edi
+ 219:	83 c3 01             	add    $0x1,%ebx
+ 21c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 21f:	7c cf                	jl     1f0 <gets+0x10>
+ 221:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+ 226:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 22a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 22d:	5b                   	pop    %ebx
+ 22e:	5e                   	pop    %esi
+ 22f:	5f                   	pop    %edi
+ 230:	5d                   	pop    %ebp
+ 231:	c3                   	ret
+ 232:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	56                   	push   %esi
+ 244:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 245:	83 ec 08             	sub    $0x8,%esp
+ 248:	6a 00                	push   $0x0
+ 24a:	ff 75 08             	push   0x8(%ebp)
+ 24d:	e8 f1 00 00 00       	call   343 <open>
+  if(fd < 0)
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	78 27                	js     280 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 259:	83 ec 08             	sub    $0x8,%esp
+ 25c:	ff 75 0c             	push   0xc(%ebp)
+ 25f:	89 c3                	mov    %eax,%ebx
+ 261:	50                   	push   %eax
+ 262:	e8 f4 00 00 00       	call   35b <fstat>
+  close(fd);
+ 267:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 26a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 26c:	e8 ba 00 00 00       	call   32b <close>
+  return r;
+ 271:	83 c4 10             	add    $0x10,%esp
+}
+ 274:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 277:	89 f0                	mov    %esi,%eax
+ 279:	5b                   	pop    %ebx
+ 27a:	5e                   	pop    %esi
+ 27b:	5d                   	pop    %ebp
+ 27c:	c3                   	ret
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 280:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 285:	eb ed                	jmp    274 <stat+0x34>
+ 287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28e:	66 90                	xchg   %ax,%ax
+
+00000290 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	53                   	push   %ebx
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 297:	0f be 02             	movsbl (%edx),%eax
+ 29a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 29d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2a5:	77 1e                	ja     2c5 <atoi+0x35>
+ 2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2b0:	83 c2 01             	add    $0x1,%edx
+ 2b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2ba:	0f be 02             	movsbl (%edx),%eax
+ 2bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2c0:	80 fb 09             	cmp    $0x9,%bl
+ 2c3:	76 eb                	jbe    2b0 <atoi+0x20>
+  return n;
+}
+ 2c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2c8:	89 c8                	mov    %ecx,%eax
+ 2ca:	c9                   	leave
+ 2cb:	c3                   	ret
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	57                   	push   %edi
+ 2d4:	56                   	push   %esi
+ 2d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2de:	85 c0                	test   %eax,%eax
+ 2e0:	7e 13                	jle    2f5 <memmove+0x25>
+ 2e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2e4:	89 d7                	mov    %edx,%edi
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2f1:	39 f8                	cmp    %edi,%eax
+ 2f3:	75 fb                	jne    2f0 <memmove+0x20>
+  return vdst;
+}
+ 2f5:	5e                   	pop    %esi
+ 2f6:	89 d0                	mov    %edx,%eax
+ 2f8:	5f                   	pop    %edi
+ 2f9:	5d                   	pop    %ebp
+ 2fa:	c3                   	ret
+
+000002fb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2fb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <exit>:
+SYSCALL(exit)
+ 303:	b8 02 00 00 00       	mov    $0x2,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <wait>:
+SYSCALL(wait)
+ 30b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <pipe>:
+SYSCALL(pipe)
+ 313:	b8 04 00 00 00       	mov    $0x4,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <read>:
+SYSCALL(read)
+ 31b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <write>:
+SYSCALL(write)
+ 323:	b8 10 00 00 00       	mov    $0x10,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <close>:
+SYSCALL(close)
+ 32b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <kill>:
+SYSCALL(kill)
+ 333:	b8 06 00 00 00       	mov    $0x6,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <exec>:
+SYSCALL(exec)
+ 33b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <open>:
+SYSCALL(open)
+ 343:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <mknod>:
+SYSCALL(mknod)
+ 34b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <unlink>:
+SYSCALL(unlink)
+ 353:	b8 12 00 00 00       	mov    $0x12,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <fstat>:
+SYSCALL(fstat)
+ 35b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <link>:
+SYSCALL(link)
+ 363:	b8 13 00 00 00       	mov    $0x13,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <mkdir>:
+SYSCALL(mkdir)
+ 36b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <chdir>:
+SYSCALL(chdir)
+ 373:	b8 09 00 00 00       	mov    $0x9,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <dup>:
+SYSCALL(dup)
+ 37b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <getpid>:
+SYSCALL(getpid)
+ 383:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <sbrk>:
+SYSCALL(sbrk)
+ 38b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <sleep>:
+SYSCALL(sleep)
+ 393:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <uptime>:
+SYSCALL(uptime)
+ 39b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <trace>:
+SYSCALL(trace)
+ 3a3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <csinfo>:
+SYSCALL(csinfo)
+ 3ab:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <settickets>:
+SYSCALL(settickets)
+ 3b3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <getprocessesinfo>:
+SYSCALL(getprocessesinfo)
+ 3bb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <yield>:
+SYSCALL(yield)
+ 3c3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <random>:
+SYSCALL(random)
+ 3cb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <dumppagetable>:
+SYSCALL(dumppagetable)
+ 3d3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <getcpusinfo>:
+SYSCALL(getcpusinfo)
+ 3db:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <setsched>:
+SYSCALL(setsched)
+ 3e3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <getbcacheinfo>:
+SYSCALL(getbcacheinfo)
+ 3eb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <getballocinfo>:
+SYSCALL(getballocinfo)
+ 3f3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <getfaultinfo>:
+SYSCALL(getfaultinfo)
+ 3fb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+ 403:	66 90                	xchg   %ax,%ax
+ 405:	66 90                	xchg   %ax,%ax
+ 407:	66 90                	xchg   %ax,%ax
+ 409:	66 90                	xchg   %ax,%ax
+ 40b:	66 90                	xchg   %ax,%ax
+ 40d:	66 90                	xchg   %ax,%ax
+ 40f:	90                   	nop
+
+00000410 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	56                   	push   %esi
+ 415:	53                   	push   %ebx
+ 416:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 418:	89 d1                	mov    %edx,%ecx
+{
+ 41a:	83 ec 3c             	sub    $0x3c,%esp
+ 41d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 420:	85 d2                	test   %edx,%edx
+ 422:	0f 89 80 00 00 00    	jns    4a8 <printint+0x98>
+ 428:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 42c:	74 7a                	je     4a8 <printint+0x98>
+    x = -xx;
+ 42e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 430:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 435:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 438:	31 f6                	xor    %esi,%esi
+ 43a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 440:	89 c8                	mov    %ecx,%eax
+ 442:	31 d2                	xor    %edx,%edx
+ 444:	89 f7                	mov    %esi,%edi
+ 446:	f7 f3                	div    %ebx
+ 448:	8d 76 01             	lea    0x1(%esi),%esi
+ 44b:	0f b6 92 e0 08 00 00 	movzbl 0x8e0(%edx),%edx
+ 452:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 456:	89 ca                	mov    %ecx,%edx
+ 458:	89 c1                	mov    %eax,%ecx
+ 45a:	39 da                	cmp    %ebx,%edx
+ 45c:	73 e2                	jae    440 <printint+0x30>
+  if(neg)
+ 45e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 461:	85 c0                	test   %eax,%eax
+ 463:	74 07                	je     46c <printint+0x5c>
+    buf[i++] = '-';
+ 465:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 46a:	89 f7                	mov    %esi,%edi
+ 46c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 46f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 472:	01 df                	add    %ebx,%edi
+ 474:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 478:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 47b:	83 ec 04             	sub    $0x4,%esp
+ 47e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 481:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 484:	6a 01                	push   $0x1
+ 486:	50                   	push   %eax
+ 487:	56                   	push   %esi
+ 488:	e8 96 fe ff ff       	call   323 <write>
+  while(--i >= 0)
+ 48d:	89 f8                	mov    %edi,%eax
+ 48f:	83 c4 10             	add    $0x10,%esp
+ 492:	83 ef 01             	sub    $0x1,%edi
+ 495:	39 d8                	cmp    %ebx,%eax
+ 497:	75 df                	jne    478 <printint+0x68>
+}
+ 499:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 49c:	5b                   	pop    %ebx
+ 49d:	5e                   	pop    %esi
+ 49e:	5f                   	pop    %edi
+ 49f:	5d                   	pop    %ebp
+ 4a0:	c3                   	ret
+ 4a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 4a8:	31 c0                	xor    %eax,%eax
+ 4aa:	eb 89                	jmp    435 <printint+0x25>
+ 4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	56                   	push   %esi
+ 4b5:	53                   	push   %ebx
+ 4b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 4c2:	83 c6 01             	add    $0x1,%esi
+ 4c5:	84 db                	test   %bl,%bl
+ 4c7:	74 67                	je     530 <printf+0x80>
+ 4c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4cc:	31 d2                	xor    %edx,%edx
+ 4ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 4d1:	eb 34                	jmp    507 <printf+0x57>
+ 4d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4d7:	90                   	nop
+ 4d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 4db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 4e0:	83 f8 25             	cmp    $0x25,%eax
+ 4e3:	74 18                	je     4fd <printf+0x4d>
+  write(fd, &c, 1);
+ 4e5:	83 ec 04             	sub    $0x4,%esp
+ 4e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4ee:	6a 01                	push   $0x1
+ 4f0:	50                   	push   %eax
+ 4f1:	57                   	push   %edi
+ 4f2:	e8 2c fe ff ff       	call   323 <write>
+ 4f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 500:	83 c6 01             	add    $0x1,%esi
+ 503:	84 db                	test   %bl,%bl
+ 505:	74 29                	je     530 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 507:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 50a:	85 d2                	test   %edx,%edx
+ 50c:	74 ca                	je     4d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 50e:	83 fa 25             	cmp    $0x25,%edx
+ 511:	75 ea                	jne    4fd <printf+0x4d>
+      if(c == 'd'){
+ 513:	83 f8 25             	cmp    $0x25,%eax
+ 516:	0f 84 24 01 00 00    	je     640 <printf+0x190>
+ 51c:	83 e8 63             	sub    $0x63,%eax
+ 51f:	83 f8 15             	cmp    $0x15,%eax
+ 522:	77 1c                	ja     540 <printf+0x90>
+ 524:	ff 24 85 88 08 00 00 	jmp    *0x888(,%eax,4)
+ 52b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 52f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 530:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 533:	5b                   	pop    %ebx
+ 534:	5e                   	pop    %esi
+ 535:	5f                   	pop    %edi
+ 536:	5d                   	pop    %ebp
+ 537:	c3                   	ret
+ 538:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53f:	90                   	nop
+  write(fd, &c, 1);
+ 540:	83 ec 04             	sub    $0x4,%esp
+ 543:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 546:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 54a:	6a 01                	push   $0x1
+ 54c:	52                   	push   %edx
+ 54d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 550:	57                   	push   %edi
+ 551:	e8 cd fd ff ff       	call   323 <write>
+ 556:	83 c4 0c             	add    $0xc,%esp
+ 559:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 55c:	6a 01                	push   $0x1
+ 55e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 561:	52                   	push   %edx
+ 562:	57                   	push   %edi
+ 563:	e8 bb fd ff ff       	call   323 <write>
+        putc(fd, c);
+ 568:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 56b:	31 d2                	xor    %edx,%edx
+ 56d:	eb 8e                	jmp    4fd <printf+0x4d>
+ 56f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 570:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 573:	83 ec 0c             	sub    $0xc,%esp
+ 576:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 57b:	8b 13                	mov    (%ebx),%edx
+ 57d:	6a 00                	push   $0x0
+ 57f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 581:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 584:	e8 87 fe ff ff       	call   410 <printint>
+        ap++;
+ 589:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 58c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 58f:	31 d2                	xor    %edx,%edx
+ 591:	e9 67 ff ff ff       	jmp    4fd <printf+0x4d>
+ 596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 5a5:	83 c0 04             	add    $0x4,%eax
+ 5a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 5ab:	85 db                	test   %ebx,%ebx
+ 5ad:	0f 84 9d 00 00 00    	je     650 <printf+0x1a0>
+        while(*s != 0){
+ 5b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5b8:	84 c0                	test   %al,%al
+ 5ba:	0f 84 3d ff ff ff    	je     4fd <printf+0x4d>
+ 5c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5c6:	89 de                	mov    %ebx,%esi
+ 5c8:	89 d3                	mov    %edx,%ebx
+ 5ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 5d0:	83 ec 04             	sub    $0x4,%esp
+ 5d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 5d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 5d9:	6a 01                	push   $0x1
+ 5db:	53                   	push   %ebx
+ 5dc:	57                   	push   %edi
+ 5dd:	e8 41 fd ff ff       	call   323 <write>
+        while(*s != 0){
+ 5e2:	0f b6 06             	movzbl (%esi),%eax
+ 5e5:	83 c4 10             	add    $0x10,%esp
+ 5e8:	84 c0                	test   %al,%al
+ 5ea:	75 e4                	jne    5d0 <printf+0x120>
+      state = 0;
+ 5ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5ef:	31 d2                	xor    %edx,%edx
+ 5f1:	e9 07 ff ff ff       	jmp    4fd <printf+0x4d>
+ 5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 600:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 603:	83 ec 0c             	sub    $0xc,%esp
+ 606:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 60b:	8b 13                	mov    (%ebx),%edx
+ 60d:	6a 01                	push   $0x1
+ 60f:	e9 6b ff ff ff       	jmp    57f <printf+0xcf>
+ 614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 618:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 61b:	83 ec 04             	sub    $0x4,%esp
+ 61e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 621:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 623:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 626:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 629:	6a 01                	push   $0x1
+ 62b:	52                   	push   %edx
+ 62c:	57                   	push   %edi
+ 62d:	e8 f1 fc ff ff       	call   323 <write>
+        ap++;
+ 632:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 635:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 638:	31 d2                	xor    %edx,%edx
+ 63a:	e9 be fe ff ff       	jmp    4fd <printf+0x4d>
+ 63f:	90                   	nop
+  write(fd, &c, 1);
+ 640:	83 ec 04             	sub    $0x4,%esp
+ 643:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 646:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 649:	6a 01                	push   $0x1
+ 64b:	e9 11 ff ff ff       	jmp    561 <printf+0xb1>
+ 650:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 655:	bb 81 08 00 00       	mov    $0x881,%ebx
+ 65a:	e9 61 ff ff ff       	jmp    5c0 <printf+0x110>
+ 65f:	90                   	nop
+
+00000660 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 660:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 661:	a1 84 0b 00 00       	mov    0xb84,%eax
+{
+ 666:	89 e5                	mov    %esp,%ebp
+ 668:	57                   	push   %edi
+ 669:	56                   	push   %esi
+ 66a:	53                   	push   %ebx
+ 66b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 66e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 671:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 678:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 67a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 67c:	39 ca                	cmp    %ecx,%edx
+ 67e:	73 30                	jae    6b0 <free+0x50>
+ 680:	39 c1                	cmp    %eax,%ecx
+ 682:	72 04                	jb     688 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 684:	39 c2                	cmp    %eax,%edx
+ 686:	72 f0                	jb     678 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 688:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 68b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 68e:	39 f8                	cmp    %edi,%eax
+ 690:	74 2e                	je     6c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 692:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 695:	8b 42 04             	mov    0x4(%edx),%eax
+ 698:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 69b:	39 f1                	cmp    %esi,%ecx
+ 69d:	74 38                	je     6d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 69f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 6a1:	5b                   	pop    %ebx
+  freep = p;
+ 6a2:	89 15 84 0b 00 00    	mov    %edx,0xb84
+}
+ 6a8:	5e                   	pop    %esi
+ 6a9:	5f                   	pop    %edi
+ 6aa:	5d                   	pop    %ebp
+ 6ab:	c3                   	ret
+ 6ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6b0:	39 c1                	cmp    %eax,%ecx
+ 6b2:	72 d0                	jb     684 <free+0x24>
+ 6b4:	eb c2                	jmp    678 <free+0x18>
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 6c0:	03 70 04             	add    0x4(%eax),%esi
+ 6c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6c6:	8b 02                	mov    (%edx),%eax
+ 6c8:	8b 00                	mov    (%eax),%eax
+ 6ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 6cd:	8b 42 04             	mov    0x4(%edx),%eax
+ 6d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6d3:	39 f1                	cmp    %esi,%ecx
+ 6d5:	75 c8                	jne    69f <free+0x3f>
+    p->s.size += bp->s.size;
+ 6d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 6da:	89 15 84 0b 00 00    	mov    %edx,0xb84
+    p->s.size += bp->s.size;
+ 6e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 6e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6e6:	89 0a                	mov    %ecx,(%edx)
+}
+ 6e8:	5b                   	pop    %ebx
+ 6e9:	5e                   	pop    %esi
+ 6ea:	5f                   	pop    %edi
+ 6eb:	5d                   	pop    %ebp
+ 6ec:	c3                   	ret
+ 6ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+ 6f3:	57                   	push   %edi
+ 6f4:	56                   	push   %esi
+ 6f5:	53                   	push   %ebx
+ 6f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 6fc:	8b 15 84 0b 00 00    	mov    0xb84,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 702:	8d 78 07             	lea    0x7(%eax),%edi
+ 705:	c1 ef 03             	shr    $0x3,%edi
+ 708:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 70b:	85 d2                	test   %edx,%edx
+ 70d:	0f 84 8d 00 00 00    	je     7a0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 713:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 715:	8b 48 04             	mov    0x4(%eax),%ecx
+ 718:	39 f9                	cmp    %edi,%ecx
+ 71a:	73 64                	jae    780 <malloc+0x90>
+  if(nu < 4096)
+ 71c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 721:	39 df                	cmp    %ebx,%edi
+ 723:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 726:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 72d:	eb 0a                	jmp    739 <malloc+0x49>
+ 72f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 730:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 732:	8b 48 04             	mov    0x4(%eax),%ecx
+ 735:	39 f9                	cmp    %edi,%ecx
+ 737:	73 47                	jae    780 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 739:	89 c2                	mov    %eax,%edx
+ 73b:	39 05 84 0b 00 00    	cmp    %eax,0xb84
+ 741:	75 ed                	jne    730 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	56                   	push   %esi
+ 747:	e8 3f fc ff ff       	call   38b <sbrk>
+  if(p == (char*)-1)
+ 74c:	83 c4 10             	add    $0x10,%esp
+ 74f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 752:	74 1c                	je     770 <malloc+0x80>
+  hp->s.size = nu;
+ 754:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 757:	83 ec 0c             	sub    $0xc,%esp
+ 75a:	83 c0 08             	add    $0x8,%eax
+ 75d:	50                   	push   %eax
+ 75e:	e8 fd fe ff ff       	call   660 <free>
+  return freep;
+ 763:	8b 15 84 0b 00 00    	mov    0xb84,%edx
+      if((p = morecore(nunits)) == 0)
+ 769:	83 c4 10             	add    $0x10,%esp
+ 76c:	85 d2                	test   %edx,%edx
+ 76e:	75 c0                	jne    730 <malloc+0x40>
+        return 0;
+  }
+}
+ 770:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 773:	31 c0                	xor    %eax,%eax
+}
+ 775:	5b                   	pop    %ebx
+ 776:	5e                   	pop    %esi
+ 777:	5f                   	pop    %edi
+ 778:	5d                   	pop    %ebp
+ 779:	c3                   	ret
+ 77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 780:	39 cf                	cmp    %ecx,%edi
+ 782:	74 4c                	je     7d0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 784:	29 f9                	sub    %edi,%ecx
+ 786:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 789:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 78c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 78f:	89 15 84 0b 00 00    	mov    %edx,0xb84
+}
+ 795:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 798:	83 c0 08             	add    $0x8,%eax
+}
+ 79b:	5b                   	pop    %ebx
+ 79c:	5e                   	pop    %esi
+ 79d:	5f                   	pop    %edi
+ 79e:	5d                   	pop    %ebp
+ 79f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 7a0:	c7 05 84 0b 00 00 88 	movl   $0xb88,0xb84
+ 7a7:	0b 00 00 
+    base.s.size = 0;
+ 7aa:	b8 88 0b 00 00       	mov    $0xb88,%eax
+    base.s.ptr = freep = prevp = &base;
+ 7af:	c7 05 88 0b 00 00 88 	movl   $0xb88,0xb88
+ 7b6:	0b 00 00 
+    base.s.size = 0;
+ 7b9:	c7 05 8c 0b 00 00 00 	movl   $0x0,0xb8c
+ 7c0:	00 00 00 
+    if(p->s.size >= nunits){
+ 7c3:	e9 54 ff ff ff       	jmp    71c <malloc+0x2c>
+ 7c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 7d0:	8b 08                	mov    (%eax),%ecx
+ 7d2:	89 0a                	mov    %ecx,(%edx)
+ 7d4:	eb b9                	jmp    78f <malloc+0x9f>
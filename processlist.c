@@ -1,6 +1,7 @@
 #include "types.h"
 #include "mmu.h"
 #include "param.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "user.h"
 int main(int argc, char *argv[])
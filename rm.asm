@@ -0,0 +1,1219 @@
+
+_rm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: rm files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(unlink(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 cf 02 00 00       	call   313 <unlink>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 ac 07 00 00       	push   $0x7ac
+  53:	6a 02                	push   $0x2
+  55:	e8 16 04 00 00       	call   470 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 61 02 00 00       	call   2c3 <exit>
+    printf(2, "Usage: rm files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 98 07 00 00       	push   $0x798
+  69:	6a 02                	push   $0x2
+  6b:	e8 00 04 00 00       	call   470 <printf>
+    exit();
+  70:	e8 4e 02 00 00       	call   2c3 <exit>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  80:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  81:	31 c0                	xor    %eax,%eax
+{
+  83:	89 e5                	mov    %esp,%ebp
+  85:	53                   	push   %ebx
+  86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  90:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  94:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  97:	83 c0 01             	add    $0x1,%eax
+  9a:	84 d2                	test   %dl,%dl
+  9c:	75 f2                	jne    90 <strcpy+0x10>
+    ;
+  return os;
+}
+  9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a1:	89 c8                	mov    %ecx,%eax
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	53                   	push   %ebx
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ba:	0f b6 02             	movzbl (%edx),%eax
+  bd:	84 c0                	test   %al,%al
+  bf:	75 17                	jne    d8 <strcmp+0x28>
+  c1:	eb 3a                	jmp    fd <strcmp+0x4d>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  cc:	83 c2 01             	add    $0x1,%edx
+  cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  d2:	84 c0                	test   %al,%al
+  d4:	74 1a                	je     f0 <strcmp+0x40>
+    p++, q++;
+  d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  d8:	0f b6 19             	movzbl (%ecx),%ebx
+  db:	38 c3                	cmp    %al,%bl
+  dd:	74 e9                	je     c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  df:	29 d8                	sub    %ebx,%eax
+}
+  e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  f4:	31 c0                	xor    %eax,%eax
+  f6:	29 d8                	sub    %ebx,%eax
+}
+  f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  fb:	c9                   	leave
+  fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 100:	31 c0                	xor    %eax,%eax
+ 102:	eb db                	jmp    df <strcmp+0x2f>
+ 104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+
+00000110 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 116:	80 3a 00             	cmpb   $0x0,(%edx)
+ 119:	74 15                	je     130 <strlen+0x20>
+ 11b:	31 c0                	xor    %eax,%eax
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+ 120:	83 c0 01             	add    $0x1,%eax
+ 123:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 127:	89 c1                	mov    %eax,%ecx
+ 129:	75 f5                	jne    120 <strlen+0x10>
+    ;
+  return n;
+}
+ 12b:	89 c8                	mov    %ecx,%eax
+ 12d:	5d                   	pop    %ebp
+ 12e:	c3                   	ret
+ 12f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 130:	31 c9                	xor    %ecx,%ecx
+}
+ 132:	5d                   	pop    %ebp
+ 133:	89 c8                	mov    %ecx,%eax
+ 135:	c3                   	ret
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000140 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 147:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 14a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14d:	89 d7                	mov    %edx,%edi
+ 14f:	fc                   	cld
+ 150:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 152:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 155:	89 d0                	mov    %edx,%eax
+ 157:	c9                   	leave
+ 158:	c3                   	ret
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 16a:	0f b6 10             	movzbl (%eax),%edx
+ 16d:	84 d2                	test   %dl,%dl
+ 16f:	75 12                	jne    183 <strchr+0x23>
+ 171:	eb 1d                	jmp    190 <strchr+0x30>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 17c:	83 c0 01             	add    $0x1,%eax
+ 17f:	84 d2                	test   %dl,%dl
+ 181:	74 0d                	je     190 <strchr+0x30>
+    if(*s == c)
+ 183:	38 d1                	cmp    %dl,%cl
+ 185:	75 f1                	jne    178 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 187:	5d                   	pop    %ebp
+ 188:	c3                   	ret
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 190:	31 c0                	xor    %eax,%eax
+}
+ 192:	5d                   	pop    %ebp
+ 193:	c3                   	ret
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1a9:	31 db                	xor    %ebx,%ebx
+{
+ 1ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ae:	eb 27                	jmp    1d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1b0:	83 ec 04             	sub    $0x4,%esp
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	56                   	push   %esi
+ 1b6:	6a 00                	push   $0x0
+ 1b8:	e8 1e 01 00 00       	call   2db <read>
+    if(cc < 1)
+ 1bd:	83 c4 10             	add    $0x10,%esp
+ 1c0:	85 c0                	test   %eax,%eax
+ 1c2:	7e 1d                	jle    1e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1cf:	3c 0a                	cmp    $0xa,%al
+ 1d1:	74 10                	je     1e3 <gets+0x43>
+ 1d3:	3c 0d                	cmp    $0xd,%al
+ 1d5:	74 0c                	je     1e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1d7:	89 df                	mov    %ebx,%edi
+ 1d9:	83 c3 01             	add    $0x1,%ebx
+ 1dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1df:	7c cf                	jl     1b0 <gets+0x10>
+ 1e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ed:	5b                   	pop    %ebx
+ 1ee:	5e                   	pop    %esi
+ 1ef:	5f                   	pop    %edi
+ 1f0:	5d                   	pop    %ebp
+ 1f1:	c3                   	ret
+ 1f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	56                   	push   %esi
+ 204:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 205:	83 ec 08             	sub    $0x8,%esp
+ 208:	6a 00                	push   $0x0
+ 20a:	ff 75 08             	push   0x8(%ebp)
+ 20d:	e8 f1 00 00 00       	call   303 <open>
+  if(fd < 0)
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	85 c0                	test   %eax,%eax
+ 217:	78 27                	js     240 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 219:	83 ec 08             	sub    $0x8,%esp
+ 21c:	ff 75 0c             	push   0xc(%ebp)
+ 21f:	89 c3                	mov    %eax,%ebx
+ 221:	50                   	push   %eax
+ 222:	e8 f4 00 00 00       	call   31b <fstat>
+  close(fd);
+ 227:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 22a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 22c:	e8 ba 00 00 00       	call   2eb <close>
+  return r;
+ 231:	83 c4 10             	add    $0x10,%esp
+}
+ 234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 237:	89 f0                	mov    %esi,%eax
+ 239:	5b                   	pop    %ebx
+ 23a:	5e                   	pop    %esi
+ 23b:	5d                   	pop    %ebp
+ 23c:	c3                   	ret
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 245:	eb ed                	jmp    234 <stat+0x34>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 257:	0f be 02             	movsbl (%edx),%eax
+ 25a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 25d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 265:	77 1e                	ja     285 <atoi+0x35>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 270:	83 c2 01             	add    $0x1,%edx
+ 273:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 276:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 27a:	0f be 02             	movsbl (%edx),%eax
+ 27d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 280:	80 fb 09             	cmp    $0x9,%bl
+ 283:	76 eb                	jbe    270 <atoi+0x20>
+  return n;
+}
+ 285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 288:	89 c8                	mov    %ecx,%eax
+ 28a:	c9                   	leave
+ 28b:	c3                   	ret
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	8b 45 10             	mov    0x10(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	7e 13                	jle    2b5 <memmove+0x25>
+ 2a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2a4:	89 d7                	mov    %edx,%edi
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2b1:	39 f8                	cmp    %edi,%eax
+ 2b3:	75 fb                	jne    2b0 <memmove+0x20>
+  return vdst;
+}
+ 2b5:	5e                   	pop    %esi
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	5f                   	pop    %edi
+ 2b9:	5d                   	pop    %ebp
+ 2ba:	c3                   	ret
+
+000002bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <exit>:
+SYSCALL(exit)
+ 2c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <wait>:
+SYSCALL(wait)
+ 2cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <pipe>:
+SYSCALL(pipe)
+ 2d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <read>:
+SYSCALL(read)
+ 2db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <write>:
+SYSCALL(write)
+ 2e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <close>:
+SYSCALL(close)
+ 2eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <kill>:
+SYSCALL(kill)
+ 2f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <exec>:
+SYSCALL(exec)
+ 2fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <open>:
+SYSCALL(open)
+ 303:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <mknod>:
+SYSCALL(mknod)
+ 30b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <unlink>:
+SYSCALL(unlink)
+ 313:	b8 12 00 00 00       	mov    $0x12,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <fstat>:
+SYSCALL(fstat)
+ 31b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <link>:
+SYSCALL(link)
+ 323:	b8 13 00 00 00       	mov    $0x13,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <mkdir>:
+SYSCALL(mkdir)
+ 32b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <chdir>:
+SYSCALL(chdir)
+ 333:	b8 09 00 00 00       	mov    $0x9,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <dup>:
+SYSCALL(dup)
+ 33b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <getpid>:
+SYSCALL(getpid)
+ 343:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <sbrk>:
+SYSCALL(sbrk)
+ 34b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <sleep>:
+SYSCALL(sleep)
+ 353:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <uptime>:
+SYSCALL(uptime)
+ 35b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <trace>:
+SYSCALL(trace)
+ 363:	b8 16 00 00 00       	mov    $0x16,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <csinfo>:
+SYSCALL(csinfo)
+ 36b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <settickets>:
+SYSCALL(settickets)
+ 373:	b8 18 00 00 00       	mov    $0x18,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <getprocessesinfo>:
+SYSCALL(getprocessesinfo)
+ 37b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <yield>:
+SYSCALL(yield)
+ 383:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <random>:
+SYSCALL(random)
+ 38b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <dumppagetable>:
+SYSCALL(dumppagetable)
+ 393:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <getcpusinfo>:
+SYSCALL(getcpusinfo)
+ 39b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <setsched>:
+SYSCALL(setsched)
+ 3a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <getbcacheinfo>:
+SYSCALL(getbcacheinfo)
+ 3ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <getballocinfo>:
+SYSCALL(getballocinfo)
+ 3b3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <getfaultinfo>:
+SYSCALL(getfaultinfo)
+ 3bb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+ 3c3:	66 90                	xchg   %ax,%ax
+ 3c5:	66 90                	xchg   %ax,%ax
+ 3c7:	66 90                	xchg   %ax,%ax
+ 3c9:	66 90                	xchg   %ax,%ax
+ 3cb:	66 90                	xchg   %ax,%ax
+ 3cd:	66 90                	xchg   %ax,%ax
+ 3cf:	90                   	nop
+
+000003d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	53                   	push   %ebx
+ 3d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 3d8:	89 d1                	mov    %edx,%ecx
+{
+ 3da:	83 ec 3c             	sub    $0x3c,%esp
+ 3dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 3e0:	85 d2                	test   %edx,%edx
+ 3e2:	0f 89 80 00 00 00    	jns    468 <printint+0x98>
+ 3e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 3ec:	74 7a                	je     468 <printint+0x98>
+    x = -xx;
+ 3ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3f8:	31 f6                	xor    %esi,%esi
+ 3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 400:	89 c8                	mov    %ecx,%eax
+ 402:	31 d2                	xor    %edx,%edx
+ 404:	89 f7                	mov    %esi,%edi
+ 406:	f7 f3                	div    %ebx
+ 408:	8d 76 01             	lea    0x1(%esi),%esi
+ 40b:	0f b6 92 24 08 00 00 	movzbl 0x824(%edx),%edx
+ 412:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 416:	89 ca                	mov    %ecx,%edx
+ 418:	89 c1                	mov    %eax,%ecx
+ 41a:	39 da                	cmp    %ebx,%edx
+ 41c:	73 e2                	jae    400 <printint+0x30>
+  if(neg)
+ 41e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 421:	85 c0                	test   %eax,%eax
+ 423:	74 07                	je     42c <printint+0x5c>
+    buf[i++] = '-';
+ 425:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 42a:	89 f7                	mov    %esi,%edi
+ 42c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 42f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 432:	01 df                	add    %ebx,%edi
+ 434:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 438:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 43b:	83 ec 04             	sub    $0x4,%esp
+ 43e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 441:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 444:	6a 01                	push   $0x1
+ 446:	50                   	push   %eax
+ 447:	56                   	push   %esi
+ 448:	e8 96 fe ff ff       	call   2e3 <write>
+  while(--i >= 0)
+ 44d:	89 f8                	mov    %edi,%eax
+ 44f:	83 c4 10             	add    $0x10,%esp
+ 452:	83 ef 01             	sub    $0x1,%edi
+ 455:	39 d8                	cmp    %ebx,%eax
+ 457:	75 df                	jne    438 <printint+0x68>
+}
+ 459:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 45c:	5b                   	pop    %ebx
+ 45d:	5e                   	pop    %esi
+ 45e:	5f                   	pop    %edi
+ 45f:	5d                   	pop    %ebp
+ 460:	c3                   	ret
+ 461:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 468:	31 c0                	xor    %eax,%eax
+ 46a:	eb 89                	jmp    3f5 <printint+0x25>
+ 46c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000470 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+ 475:	53                   	push   %ebx
+ 476:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 479:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 47c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 47f:	0f b6 1e             	movzbl (%esi),%ebx
+ 482:	83 c6 01             	add    $0x1,%esi
+ 485:	84 db                	test   %bl,%bl
+ 487:	74 67                	je     4f0 <printf+0x80>
+ 489:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 48c:	31 d2                	xor    %edx,%edx
+ 48e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 491:	eb 34                	jmp    4c7 <printf+0x57>
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+ 498:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 49b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 4a0:	83 f8 25             	cmp    $0x25,%eax
+ 4a3:	74 18                	je     4bd <printf+0x4d>
+  write(fd, &c, 1);
+ 4a5:	83 ec 04             	sub    $0x4,%esp
+ 4a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4ae:	6a 01                	push   $0x1
+ 4b0:	50                   	push   %eax
+ 4b1:	57                   	push   %edi
+ 4b2:	e8 2c fe ff ff       	call   2e3 <write>
+ 4b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 4c0:	83 c6 01             	add    $0x1,%esi
+ 4c3:	84 db                	test   %bl,%bl
+ 4c5:	74 29                	je     4f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4ca:	85 d2                	test   %edx,%edx
+ 4cc:	74 ca                	je     498 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4ce:	83 fa 25             	cmp    $0x25,%edx
+ 4d1:	75 ea                	jne    4bd <printf+0x4d>
+      if(c == 'd'){
+ 4d3:	83 f8 25             	cmp    $0x25,%eax
+ 4d6:	0f 84 24 01 00 00    	je     600 <printf+0x190>
+ 4dc:	83 e8 63             	sub    $0x63,%eax
+ 4df:	83 f8 15             	cmp    $0x15,%eax
+ 4e2:	77 1c                	ja     500 <printf+0x90>
+ 4e4:	ff 24 85 cc 07 00 00 	jmp    *0x7cc(,%eax,4)
+ 4eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 4f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4f3:	5b                   	pop    %ebx
+ 4f4:	5e                   	pop    %esi
+ 4f5:	5f                   	pop    %edi
+ 4f6:	5d                   	pop    %ebp
+ 4f7:	c3                   	ret
+ 4f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ff:	90                   	nop
+  write(fd, &c, 1);
+ 500:	83 ec 04             	sub    $0x4,%esp
+ 503:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 506:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 50a:	6a 01                	push   $0x1
+ 50c:	52                   	push   %edx
+ 50d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 510:	57                   	push   %edi
+ 511:	e8 cd fd ff ff       	call   2e3 <write>
+ 516:	83 c4 0c             	add    $0xc,%esp
+ 519:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 51c:	6a 01                	push   $0x1
+ 51e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 521:	52                   	push   %edx
+ 522:	57                   	push   %edi
+ 523:	e8 bb fd ff ff       	call   2e3 <write>
+        putc(fd, c);
+ 528:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 52b:	31 d2                	xor    %edx,%edx
+ 52d:	eb 8e                	jmp    4bd <printf+0x4d>
+ 52f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 530:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 533:	83 ec 0c             	sub    $0xc,%esp
+ 536:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 53b:	8b 13                	mov    (%ebx),%edx
+ 53d:	6a 00                	push   $0x0
+ 53f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 541:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 544:	e8 87 fe ff ff       	call   3d0 <printint>
+        ap++;
+ 549:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 54c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 54f:	31 d2                	xor    %edx,%edx
+ 551:	e9 67 ff ff ff       	jmp    4bd <printf+0x4d>
+ 556:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 560:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 563:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 565:	83 c0 04             	add    $0x4,%eax
+ 568:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 56b:	85 db                	test   %ebx,%ebx
+ 56d:	0f 84 9d 00 00 00    	je     610 <printf+0x1a0>
+        while(*s != 0){
+ 573:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 576:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 578:	84 c0                	test   %al,%al
+ 57a:	0f 84 3d ff ff ff    	je     4bd <printf+0x4d>
+ 580:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 583:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 586:	89 de                	mov    %ebx,%esi
+ 588:	89 d3                	mov    %edx,%ebx
+ 58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 590:	83 ec 04             	sub    $0x4,%esp
+ 593:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 596:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 599:	6a 01                	push   $0x1
+ 59b:	53                   	push   %ebx
+ 59c:	57                   	push   %edi
+ 59d:	e8 41 fd ff ff       	call   2e3 <write>
+        while(*s != 0){
+ 5a2:	0f b6 06             	movzbl (%esi),%eax
+ 5a5:	83 c4 10             	add    $0x10,%esp
+ 5a8:	84 c0                	test   %al,%al
+ 5aa:	75 e4                	jne    590 <printf+0x120>
+      state = 0;
+ 5ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5af:	31 d2                	xor    %edx,%edx
+ 5b1:	e9 07 ff ff ff       	jmp    4bd <printf+0x4d>
+ 5b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5c3:	83 ec 0c             	sub    $0xc,%esp
+ 5c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5cb:	8b 13                	mov    (%ebx),%edx
+ 5cd:	6a 01                	push   $0x1
+ 5cf:	e9 6b ff ff ff       	jmp    53f <printf+0xcf>
+ 5d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 5d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 5db:	83 ec 04             	sub    $0x4,%esp
+ 5de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 5e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 5e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 5e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5e9:	6a 01                	push   $0x1
+ 5eb:	52                   	push   %edx
+ 5ec:	57                   	push   %edi
+ 5ed:	e8 f1 fc ff ff       	call   2e3 <write>
+        ap++;
+ 5f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5f8:	31 d2                	xor    %edx,%edx
+ 5fa:	e9 be fe ff ff       	jmp    4bd <printf+0x4d>
+ 5ff:	90                   	nop
+  write(fd, &c, 1);
+ 600:	83 ec 04             	sub    $0x4,%esp
+ 603:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 606:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 609:	6a 01                	push   $0x1
+ 60b:	e9 11 ff ff ff       	jmp    521 <printf+0xb1>
+ 610:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 615:	bb c5 07 00 00       	mov    $0x7c5,%ebx
+ 61a:	e9 61 ff ff ff       	jmp    580 <printf+0x110>
+ 61f:	90                   	nop
+
+00000620 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 620:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 621:	a1 d0 0a 00 00       	mov    0xad0,%eax
+{
+ 626:	89 e5                	mov    %esp,%ebp
+ 628:	57                   	push   %edi
+ 629:	56                   	push   %esi
+ 62a:	53                   	push   %ebx
+ 62b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 62e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 631:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 638:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 63a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 63c:	39 ca                	cmp    %ecx,%edx
+ 63e:	73 30                	jae    670 <free+0x50>
+ 640:	39 c1                	cmp    %eax,%ecx
+ 642:	72 04                	jb     648 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 644:	39 c2                	cmp    %eax,%edx
+ 646:	72 f0                	jb     638 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 648:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 64b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 64e:	39 f8                	cmp    %edi,%eax
+ 650:	74 2e                	je     680 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 652:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 655:	8b 42 04             	mov    0x4(%edx),%eax
+ 658:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 65b:	39 f1                	cmp    %esi,%ecx
+ 65d:	74 38                	je     697 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 65f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 661:	5b                   	pop    %ebx
+  freep = p;
+ 662:	89 15 d0 0a 00 00    	mov    %edx,0xad0
+}
+ 668:	5e                   	pop    %esi
+ 669:	5f                   	pop    %edi
+ 66a:	5d                   	pop    %ebp
+ 66b:	c3                   	ret
+ 66c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 670:	39 c1                	cmp    %eax,%ecx
+ 672:	72 d0                	jb     644 <free+0x24>
+ 674:	eb c2                	jmp    638 <free+0x18>
+ 676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 680:	03 70 04             	add    0x4(%eax),%esi
+ 683:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 686:	8b 02                	mov    (%edx),%eax
+ 688:	8b 00                	mov    (%eax),%eax
+ 68a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 68d:	8b 42 04             	mov    0x4(%edx),%eax
+ 690:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 693:	39 f1                	cmp    %esi,%ecx
+ 695:	75 c8                	jne    65f <free+0x3f>
+    p->s.size += bp->s.size;
+ 697:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 69a:	89 15 d0 0a 00 00    	mov    %edx,0xad0
+    p->s.size += bp->s.size;
+ 6a0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 6a3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6a6:	89 0a                	mov    %ecx,(%edx)
+}
+ 6a8:	5b                   	pop    %ebx
+ 6a9:	5e                   	pop    %esi
+ 6aa:	5f                   	pop    %edi
+ 6ab:	5d                   	pop    %ebp
+ 6ac:	c3                   	ret
+ 6ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006b0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	57                   	push   %edi
+ 6b4:	56                   	push   %esi
+ 6b5:	53                   	push   %ebx
+ 6b6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 6bc:	8b 15 d0 0a 00 00    	mov    0xad0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6c2:	8d 78 07             	lea    0x7(%eax),%edi
+ 6c5:	c1 ef 03             	shr    $0x3,%edi
+ 6c8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 6cb:	85 d2                	test   %edx,%edx
+ 6cd:	0f 84 8d 00 00 00    	je     760 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6d3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6d5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6d8:	39 f9                	cmp    %edi,%ecx
+ 6da:	73 64                	jae    740 <malloc+0x90>
+  if(nu < 4096)
+ 6dc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 6e1:	39 df                	cmp    %ebx,%edi
+ 6e3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 6e6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 6ed:	eb 0a                	jmp    6f9 <malloc+0x49>
+ 6ef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6f0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6f2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6f5:	39 f9                	cmp    %edi,%ecx
+ 6f7:	73 47                	jae    740 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 6f9:	89 c2                	mov    %eax,%edx
+ 6fb:	39 05 d0 0a 00 00    	cmp    %eax,0xad0
+ 701:	75 ed                	jne    6f0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 703:	83 ec 0c             	sub    $0xc,%esp
+ 706:	56                   	push   %esi
+ 707:	e8 3f fc ff ff       	call   34b <sbrk>
+  if(p == (char*)-1)
+ 70c:	83 c4 10             	add    $0x10,%esp
+ 70f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 712:	74 1c                	je     730 <malloc+0x80>
+  hp->s.size = nu;
+ 714:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 717:	83 ec 0c             	sub    $0xc,%esp
+ 71a:	83 c0 08             	add    $0x8,%eax
+ 71d:	50                   	push   %eax
+ 71e:	e8 fd fe ff ff       	call   620 <free>
+  return freep;
+ 723:	8b 15 d0 0a 00 00    	mov    0xad0,%edx
+      if((p = morecore(nunits)) == 0)
+ 729:	83 c4 10             	add    $0x10,%esp
+ 72c:	85 d2                	test   %edx,%edx
+ 72e:	75 c0                	jne    6f0 <malloc+0x40>
+        return 0;
+  }
+}
+ 730:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 733:	31 c0                	xor    %eax,%eax
+}
+ 735:	5b                   	pop    %ebx
+ 736:	5e                   	pop    %esi
+ 737:	5f                   	pop    %edi
+ 738:	5d                   	pop    %ebp
+ 739:	c3                   	ret
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 740:	39 cf                	cmp    %ecx,%edi
+ 742:	74 4c                	je     790 <malloc+0xe0>
+        p->s.size -= nunits;
+ 744:	29 f9                	sub    %edi,%ecx
+ 746:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 749:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 74c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 74f:	89 15 d0 0a 00 00    	mov    %edx,0xad0
+}
+ 755:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 758:	83 c0 08             	add    $0x8,%eax
+}
+ 75b:	5b                   	pop    %ebx
+ 75c:	5e                   	pop    %esi
+ 75d:	5f                   	pop    %edi
+ 75e:	5d                   	pop    %ebp
+ 75f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 760:	c7 05 d0 0a 00 00 d4 	movl   $0xad4,0xad0
+ 767:	0a 00 00 
+    base.s.size = 0;
+ 76a:	b8 d4 0a 00 00       	mov    $0xad4,%eax
+    base.s.ptr = freep = prevp = &base;
+ 76f:	c7 05 d4 0a 00 00 d4 	movl   $0xad4,0xad4
+ 776:	0a 00 00 
+    base.s.size = 0;
+ 779:	c7 05 d8 0a 00 00 00 	movl   $0x0,0xad8
+ 780:	00 00 00 
+    if(p->s.size >= nunits){
+ 783:	e9 54 ff ff ff       	jmp    6dc <malloc+0x2c>
+ 788:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 790:	8b 08                	mov    (%eax),%ecx
+ 792:	89 0a                	mov    %ecx,(%edx)
+ 794:	eb b9                	jmp    74f <malloc+0x9f>
@@ -0,0 +1,1398 @@
+
+_sbrkbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#define HEAPSZ  (16*MB)
+#define PCT     1
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 68             	sub    $0x68,%esp
+  uint start, tgrow, ttouch, tread, tshrink;
+  struct fault_info before, after;
+  char *a;
+
+  pct = PCT;
+  if(argc > 1)
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+  1a:	0f 8f 9a 01 00 00    	jg     1ba <main+0x1ba>
+  pct = PCT;
+  20:	bf 01 00 00 00       	mov    $0x1,%edi
+  if(pct < 1 || pct > 100)
+    pct = PCT;
+  npage = HEAPSZ / PGSIZE;
+  stride = 100 / pct;
+
+  getfaultinfo(&before);
+  25:	83 ec 0c             	sub    $0xc,%esp
+  28:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  2b:	50                   	push   %eax
+  2c:	e8 fa 04 00 00       	call   52b <getfaultinfo>
+  start = uptime();
+  31:	e8 95 04 00 00       	call   4cb <uptime>
+  36:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(HEAPSZ);
+  39:	c7 04 24 00 00 00 01 	movl   $0x1000000,(%esp)
+  40:	e8 76 04 00 00       	call   4bb <sbrk>
+  45:	89 c3                	mov    %eax,%ebx
+  tgrow = uptime() - start;
+  47:	e8 7f 04 00 00       	call   4cb <uptime>
+  if(a == (char*)-1){
+  4c:	83 c4 10             	add    $0x10,%esp
+  tgrow = uptime() - start;
+  4f:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  if(a == (char*)-1){
+  52:	83 fb ff             	cmp    $0xffffffff,%ebx
+  55:	0f 84 80 01 00 00    	je     1db <main+0x1db>
+  stride = 100 / pct;
+  5b:	b8 64 00 00 00       	mov    $0x64,%eax
+  60:	31 d2                	xor    %edx,%edx
+  62:	f7 ff                	idiv   %edi
+  64:	89 c6                	mov    %eax,%esi
+    printf(1, "sbrkbench: sbrk failed\n");
+    exit();
+  }
+
+  start = uptime();
+  66:	e8 60 04 00 00       	call   4cb <uptime>
+  6b:	89 45 9c             	mov    %eax,-0x64(%ebp)
+  for(i = 0; i < npage; i += stride)
+  6e:	31 c0                	xor    %eax,%eax
+    a[i * PGSIZE] = 1;
+  70:	89 c2                	mov    %eax,%edx
+  for(i = 0; i < npage; i += stride)
+  72:	01 f0                	add    %esi,%eax
+    a[i * PGSIZE] = 1;
+  74:	c1 e2 0c             	shl    $0xc,%edx
+  77:	c6 04 13 01          	movb   $0x1,(%ebx,%edx,1)
+  for(i = 0; i < npage; i += stride)
+  7b:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80:	7e ee                	jle    70 <main+0x70>
+  ttouch = uptime() - start;
+  82:	e8 44 04 00 00       	call   4cb <uptime>
+  87:	8d bb 00 00 00 01    	lea    0x1000000(%ebx),%edi
+  8d:	89 45 98             	mov    %eax,-0x68(%ebp)
+
+  start = uptime();
+  90:	e8 36 04 00 00       	call   4cb <uptime>
+  95:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  sum = 0;
+  for(i = 0; i < npage; i++)
+  98:	89 d8                	mov    %ebx,%eax
+  sum = 0;
+  9a:	31 db                	xor    %ebx,%ebx
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    sum += a[i * PGSIZE];
+  a0:	0f be 10             	movsbl (%eax),%edx
+  for(i = 0; i < npage; i++)
+  a3:	05 00 10 00 00       	add    $0x1000,%eax
+    sum += a[i * PGSIZE];
+  a8:	01 d3                	add    %edx,%ebx
+  for(i = 0; i < npage; i++)
+  aa:	39 c7                	cmp    %eax,%edi
+  ac:	75 f2                	jne    a0 <main+0xa0>
+  tread = uptime() - start;
+  ae:	e8 18 04 00 00       	call   4cb <uptime>
+  b3:	89 45 90             	mov    %eax,-0x70(%ebp)
+
+  start = uptime();
+  b6:	e8 10 04 00 00       	call   4cb <uptime>
+  if(sbrk(-HEAPSZ) == (char*)-1){
+  bb:	83 ec 0c             	sub    $0xc,%esp
+  be:	68 00 00 00 ff       	push   $0xff000000
+  start = uptime();
+  c3:	89 c7                	mov    %eax,%edi
+  if(sbrk(-HEAPSZ) == (char*)-1){
+  c5:	e8 f1 03 00 00       	call   4bb <sbrk>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	83 f8 ff             	cmp    $0xffffffff,%eax
+  d0:	0f 84 d1 00 00 00    	je     1a7 <main+0x1a7>
+    printf(1, "sbrkbench: sbrk shrink failed\n");
+    exit();
+  }
+  tshrink = uptime() - start;
+  d6:	e8 f0 03 00 00       	call   4cb <uptime>
+  getfaultinfo(&after);
+  db:	83 ec 0c             	sub    $0xc,%esp
+  tshrink = uptime() - start;
+  de:	29 f8                	sub    %edi,%eax
+  e0:	89 45 8c             	mov    %eax,-0x74(%ebp)
+  getfaultinfo(&after);
+  e3:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  e6:	50                   	push   %eax
+  e7:	e8 3f 04 00 00       	call   52b <getfaultinfo>
+
+  printf(1, "sbrkbench: %d KB heap, touched %d of %d pages\n",
+         HEAPSZ / 1024, (npage + stride - 1) / stride, npage);
+  ec:	8d 86 ff 0f 00 00    	lea    0xfff(%esi),%eax
+  printf(1, "sbrkbench: %d KB heap, touched %d of %d pages\n",
+  f2:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  f9:	99                   	cltd
+  fa:	f7 fe                	idiv   %esi
+  fc:	50                   	push   %eax
+  fd:	89 c7                	mov    %eax,%edi
+  ff:	68 00 40 00 00       	push   $0x4000
+ 104:	68 40 09 00 00       	push   $0x940
+ 109:	6a 01                	push   $0x1
+ 10b:	e8 d0 04 00 00       	call   5e0 <printf>
+  printf(1, "sbrkbench: grow %d ticks, touch %d ticks, read %d ticks, "
+ 110:	83 c4 18             	add    $0x18,%esp
+ 113:	ff 75 8c             	push   -0x74(%ebp)
+  tread = uptime() - start;
+ 116:	8b 4d 94             	mov    -0x6c(%ebp),%ecx
+ 119:	8b 45 90             	mov    -0x70(%ebp),%eax
+ 11c:	29 c8                	sub    %ecx,%eax
+  printf(1, "sbrkbench: grow %d ticks, touch %d ticks, read %d ticks, "
+ 11e:	50                   	push   %eax
+  ttouch = uptime() - start;
+ 11f:	8b 4d 9c             	mov    -0x64(%ebp),%ecx
+ 122:	8b 45 98             	mov    -0x68(%ebp),%eax
+ 125:	29 c8                	sub    %ecx,%eax
+  printf(1, "sbrkbench: grow %d ticks, touch %d ticks, read %d ticks, "
+ 127:	50                   	push   %eax
+  tgrow = uptime() - start;
+ 128:	8b 45 a0             	mov    -0x60(%ebp),%eax
+ 12b:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+ 12e:	29 c8                	sub    %ecx,%eax
+  printf(1, "sbrkbench: grow %d ticks, touch %d ticks, read %d ticks, "
+ 130:	50                   	push   %eax
+ 131:	68 70 09 00 00       	push   $0x970
+ 136:	6a 01                	push   $0x1
+ 138:	e8 a3 04 00 00       	call   5e0 <printf>
+         "shrink %d ticks\n", tgrow, ttouch, tread, tshrink);
+  if(sum != (npage + stride - 1) / stride)
+ 13d:	83 c4 20             	add    $0x20,%esp
+ 140:	39 df                	cmp    %ebx,%edi
+ 142:	74 11                	je     155 <main+0x155>
+    printf(1, "sbrkbench: read back %d, wrong\n", sum);
+ 144:	52                   	push   %edx
+ 145:	53                   	push   %ebx
+ 146:	68 bc 09 00 00       	push   $0x9bc
+ 14b:	6a 01                	push   $0x1
+ 14d:	e8 8e 04 00 00       	call   5e0 <printf>
+ 152:	83 c4 10             	add    $0x10,%esp
+  printf(1, "sbrkbench: %d zero-fill faults, %d zero page maps, "
+ 155:	50                   	push   %eax
+ 156:	50                   	push   %eax
+ 157:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 15a:	03 45 d4             	add    -0x2c(%ebp),%eax
+ 15d:	2b 45 b4             	sub    -0x4c(%ebp),%eax
+ 160:	2b 45 b8             	sub    -0x48(%ebp),%eax
+ 163:	50                   	push   %eax
+ 164:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 167:	2b 45 b0             	sub    -0x50(%ebp),%eax
+ 16a:	50                   	push   %eax
+ 16b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 16e:	2b 45 ac             	sub    -0x54(%ebp),%eax
+ 171:	50                   	push   %eax
+ 172:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 175:	2b 45 a8             	sub    -0x58(%ebp),%eax
+ 178:	50                   	push   %eax
+ 179:	68 dc 09 00 00       	push   $0x9dc
+ 17e:	6a 01                	push   $0x1
+ 180:	e8 5b 04 00 00       	call   5e0 <printf>
+         "%d program faults, %d copy-on-write faults\n",
+         after.zero - before.zero, after.zeroread - before.zeroread,
+         after.exec - before.exec,
+         (after.copy - before.copy) + (after.reuse - before.reuse));
+  printf(1, "sbrkbench: %d zeroed pages from the idle pool, %d cleared on demand\n",
+ 185:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 188:	83 c4 20             	add    $0x20,%esp
+ 18b:	2b 45 c4             	sub    -0x3c(%ebp),%eax
+ 18e:	50                   	push   %eax
+ 18f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 192:	2b 45 c0             	sub    -0x40(%ebp),%eax
+ 195:	50                   	push   %eax
+ 196:	68 3c 0a 00 00       	push   $0xa3c
+ 19b:	6a 01                	push   $0x1
+ 19d:	e8 3e 04 00 00       	call   5e0 <printf>
+         after.zpool - before.zpool, after.zclear - before.zclear);
+  exit();
+ 1a2:	e8 8c 02 00 00       	call   433 <exit>
+    printf(1, "sbrkbench: sbrk shrink failed\n");
+ 1a7:	51                   	push   %ecx
+ 1a8:	51                   	push   %ecx
+ 1a9:	68 20 09 00 00       	push   $0x920
+ 1ae:	6a 01                	push   $0x1
+ 1b0:	e8 2b 04 00 00       	call   5e0 <printf>
+    exit();
+ 1b5:	e8 79 02 00 00       	call   433 <exit>
+    pct = atoi(argv[1]);
+ 1ba:	83 ec 0c             	sub    $0xc,%esp
+ 1bd:	ff 70 04             	push   0x4(%eax)
+ 1c0:	e8 fb 01 00 00       	call   3c0 <atoi>
+  if(pct < 1 || pct > 100)
+ 1c5:	83 c4 10             	add    $0x10,%esp
+    pct = atoi(argv[1]);
+ 1c8:	89 c7                	mov    %eax,%edi
+  if(pct < 1 || pct > 100)
+ 1ca:	8d 40 ff             	lea    -0x1(%eax),%eax
+ 1cd:	83 f8 63             	cmp    $0x63,%eax
+ 1d0:	0f 87 4a fe ff ff    	ja     20 <main+0x20>
+ 1d6:	e9 4a fe ff ff       	jmp    25 <main+0x25>
+    printf(1, "sbrkbench: sbrk failed\n");
+ 1db:	53                   	push   %ebx
+ 1dc:	53                   	push   %ebx
+ 1dd:	68 08 09 00 00       	push   $0x908
+ 1e2:	6a 01                	push   $0x1
+ 1e4:	e8 f7 03 00 00       	call   5e0 <printf>
+    exit();
+ 1e9:	e8 45 02 00 00       	call   433 <exit>
+ 1ee:	66 90                	xchg   %ax,%ax
+
+000001f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1f1:	31 c0                	xor    %eax,%eax
+{
+ 1f3:	89 e5                	mov    %esp,%ebp
+ 1f5:	53                   	push   %ebx
+ 1f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 200:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 204:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 207:	83 c0 01             	add    $0x1,%eax
+ 20a:	84 d2                	test   %dl,%dl
+ 20c:	75 f2                	jne    200 <strcpy+0x10>
+    ;
+  return os;
+}
+ 20e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 211:	89 c8                	mov    %ecx,%eax
+ 213:	c9                   	leave
+ 214:	c3                   	ret
+ 215:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	53                   	push   %ebx
+ 224:	8b 55 08             	mov    0x8(%ebp),%edx
+ 227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 22a:	0f b6 02             	movzbl (%edx),%eax
+ 22d:	84 c0                	test   %al,%al
+ 22f:	75 17                	jne    248 <strcmp+0x28>
+ 231:	eb 3a                	jmp    26d <strcmp+0x4d>
+ 233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 237:	90                   	nop
+ 238:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 23c:	83 c2 01             	add    $0x1,%edx
+ 23f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 242:	84 c0                	test   %al,%al
+ 244:	74 1a                	je     260 <strcmp+0x40>
+    p++, q++;
+ 246:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 248:	0f b6 19             	movzbl (%ecx),%ebx
+ 24b:	38 c3                	cmp    %al,%bl
+ 24d:	74 e9                	je     238 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 24f:	29 d8                	sub    %ebx,%eax
+}
+ 251:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 254:	c9                   	leave
+ 255:	c3                   	ret
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 260:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 264:	31 c0                	xor    %eax,%eax
+ 266:	29 d8                	sub    %ebx,%eax
+}
+ 268:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 26b:	c9                   	leave
+ 26c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 26d:	0f b6 19             	movzbl (%ecx),%ebx
+ 270:	31 c0                	xor    %eax,%eax
+ 272:	eb db                	jmp    24f <strcmp+0x2f>
+ 274:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 286:	80 3a 00             	cmpb   $0x0,(%edx)
+ 289:	74 15                	je     2a0 <strlen+0x20>
+ 28b:	31 c0                	xor    %eax,%eax
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+ 290:	83 c0 01             	add    $0x1,%eax
+ 293:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 297:	89 c1                	mov    %eax,%ecx
+ 299:	75 f5                	jne    290 <strlen+0x10>
+    ;
+  return n;
+}
+ 29b:	89 c8                	mov    %ecx,%eax
+ 29d:	5d                   	pop    %ebp
+ 29e:	c3                   	ret
+ 29f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2a0:	31 c9                	xor    %ecx,%ecx
+}
+ 2a2:	5d                   	pop    %ebp
+ 2a3:	89 c8                	mov    %ecx,%eax
+ 2a5:	c3                   	ret
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2bd:	89 d7                	mov    %edx,%edi
+ 2bf:	fc                   	cld
+ 2c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2c5:	89 d0                	mov    %edx,%eax
+ 2c7:	c9                   	leave
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2da:	0f b6 10             	movzbl (%eax),%edx
+ 2dd:	84 d2                	test   %dl,%dl
+ 2df:	75 12                	jne    2f3 <strchr+0x23>
+ 2e1:	eb 1d                	jmp    300 <strchr+0x30>
+ 2e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2e7:	90                   	nop
+ 2e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2ec:	83 c0 01             	add    $0x1,%eax
+ 2ef:	84 d2                	test   %dl,%dl
+ 2f1:	74 0d                	je     300 <strchr+0x30>
+    if(*s == c)
+ 2f3:	38 d1                	cmp    %dl,%cl
+ 2f5:	75 f1                	jne    2e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2f7:	5d                   	pop    %ebp
+ 2f8:	c3                   	ret
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 300:	31 c0                	xor    %eax,%eax
+}
+ 302:	5d                   	pop    %ebp
+ 303:	c3                   	ret
+ 304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 315:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 318:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 319:	31 db                	xor    %ebx,%ebx
+{
+ 31b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 31e:	eb 27                	jmp    347 <gets+0x37>
+    cc = read(0, &c, 1);
+ 320:	83 ec 04             	sub    $0x4,%esp
+ 323:	6a 01                	push   $0x1
+ 325:	56                   	push   %esi
+ 326:	6a 00                	push   $0x0
+ 328:	e8 1e 01 00 00       	call   44b <read>
+    if(cc < 1)
+ 32d:	83 c4 10             	add    $0x10,%esp
+ 330:	85 c0                	test   %eax,%eax
+ 332:	7e 1d                	jle    351 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 334:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 33f:	3c 0a                	cmp    $0xa,%al
+ 341:	74 10                	je     353 <gets+0x43>
+ 343:	3c 0d                	cmp    $0xd,%al
+ 345:	74 0c                	je     353 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 347:	89 df                	mov    %ebx,%edi
+ 349:	83 c3 01             	add    $0x1,%ebx
+ 34c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 34f:	7c cf                	jl     320 <gets+0x10>
+ 351:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 35a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 35d:	5b                   	pop    %ebx
+ 35e:	5e                   	pop    %esi
+ 35f:	5f                   	pop    %edi
+ 360:	5d                   	pop    %ebp
+ 361:	c3                   	ret
+ 362:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	56                   	push   %esi
+ 374:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 375:	83 ec 08             	sub    $0x8,%esp
+ 378:	6a 00                	push   $0x0
+ 37a:	ff 75 08             	push   0x8(%ebp)
+ 37d:	e8 f1 00 00 00       	call   473 <open>
+  if(fd < 0)
+ 382:	83 c4 10             	add    $0x10,%esp
+ 385:	85 c0                	test   %eax,%eax
+ 387:	78 27                	js     3b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 389:	83 ec 08             	sub    $0x8,%esp
+ 38c:	ff 75 0c             	push   0xc(%ebp)
+ 38f:	89 c3                	mov    %eax,%ebx
+ 391:	50                   	push   %eax
+ 392:	e8 f4 00 00 00       	call   48b <fstat>
+  close(fd);
+ 397:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 39a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 39c:	e8 ba 00 00 00       	call   45b <close>
+  return r;
+ 3a1:	83 c4 10             	add    $0x10,%esp
+}
+ 3a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3a7:	89 f0                	mov    %esi,%eax
+ 3a9:	5b                   	pop    %ebx
+ 3aa:	5e                   	pop    %esi
+ 3ab:	5d                   	pop    %ebp
+ 3ac:	c3                   	ret
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3b5:	eb ed                	jmp    3a4 <stat+0x34>
+ 3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3be:	66 90                	xchg   %ax,%ax
+
+000003c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	53                   	push   %ebx
+ 3c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3c7:	0f be 02             	movsbl (%edx),%eax
+ 3ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3d5:	77 1e                	ja     3f5 <atoi+0x35>
+ 3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3e0:	83 c2 01             	add    $0x1,%edx
+ 3e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ea:	0f be 02             	movsbl (%edx),%eax
+ 3ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3f0:	80 fb 09             	cmp    $0x9,%bl
+ 3f3:	76 eb                	jbe    3e0 <atoi+0x20>
+  return n;
+}
+ 3f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3f8:	89 c8                	mov    %ecx,%eax
+ 3fa:	c9                   	leave
+ 3fb:	c3                   	ret
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+ 405:	8b 45 10             	mov    0x10(%ebp),%eax
+ 408:	8b 55 08             	mov    0x8(%ebp),%edx
+ 40b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 40e:	85 c0                	test   %eax,%eax
+ 410:	7e 13                	jle    425 <memmove+0x25>
+ 412:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 414:	89 d7                	mov    %edx,%edi
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 420:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 421:	39 f8                	cmp    %edi,%eax
+ 423:	75 fb                	jne    420 <memmove+0x20>
+  return vdst;
+}
+ 425:	5e                   	pop    %esi
+ 426:	89 d0                	mov    %edx,%eax
+ 428:	5f                   	pop    %edi
+ 429:	5d                   	pop    %ebp
+ 42a:	c3                   	ret
+
+0000042b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 42b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <exit>:
+SYSCALL(exit)
+ 433:	b8 02 00 00 00       	mov    $0x2,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <wait>:
+SYSCALL(wait)
+ 43b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <pipe>:
+SYSCALL(pipe)
+ 443:	b8 04 00 00 00       	mov    $0x4,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <read>:
+SYSCALL(read)
+ 44b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <write>:
+SYSCALL(write)
+ 453:	b8 10 00 00 00       	mov    $0x10,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <close>:
+SYSCALL(close)
+ 45b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <kill>:
+SYSCALL(kill)
+ 463:	b8 06 00 00 00       	mov    $0x6,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <exec>:
+SYSCALL(exec)
+ 46b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <open>:
+SYSCALL(open)
+ 473:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <mknod>:
+SYSCALL(mknod)
+ 47b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <unlink>:
+SYSCALL(unlink)
+ 483:	b8 12 00 00 00       	mov    $0x12,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <fstat>:
+SYSCALL(fstat)
+ 48b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <link>:
+SYSCALL(link)
+ 493:	b8 13 00 00 00       	mov    $0x13,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <mkdir>:
+SYSCALL(mkdir)
+ 49b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <chdir>:
+SYSCALL(chdir)
+ 4a3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <dup>:
+SYSCALL(dup)
+ 4ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <getpid>:
+SYSCALL(getpid)
+ 4b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <sbrk>:
+SYSCALL(sbrk)
+ 4bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <sleep>:
+SYSCALL(sleep)
+ 4c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <uptime>:
+SYSCALL(uptime)
+ 4cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <trace>:
+SYSCALL(trace)
+ 4d3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <csinfo>:
+SYSCALL(csinfo)
+ 4db:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <settickets>:
+SYSCALL(settickets)
+ 4e3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <getprocessesinfo>:
+SYSCALL(getprocessesinfo)
+ 4eb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <yield>:
+SYSCALL(yield)
+ 4f3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <random>:
+SYSCALL(random)
+ 4fb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <dumppagetable>:
+SYSCALL(dumppagetable)
+ 503:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <getcpusinfo>:
+SYSCALL(getcpusinfo)
+ 50b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <setsched>:
+SYSCALL(setsched)
+ 513:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <getbcacheinfo>:
+SYSCALL(getbcacheinfo)
+ 51b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <getballocinfo>:
+SYSCALL(getballocinfo)
+ 523:	b8 20 00 00 00       	mov    $0x20,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <getfaultinfo>:
+SYSCALL(getfaultinfo)
+ 52b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+ 533:	66 90                	xchg   %ax,%ax
+ 535:	66 90                	xchg   %ax,%ax
+ 537:	66 90                	xchg   %ax,%ax
+ 539:	66 90                	xchg   %ax,%ax
+ 53b:	66 90                	xchg   %ax,%ax
+ 53d:	66 90                	xchg   %ax,%ax
+ 53f:	90                   	nop
+
+00000540 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	57                   	push   %edi
+ 544:	56                   	push   %esi
+ 545:	53                   	push   %ebx
+ 546:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 548:	89 d1                	mov    %edx,%ecx
+{
+ 54a:	83 ec 3c             	sub    $0x3c,%esp
+ 54d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 550:	85 d2                	test   %edx,%edx
+ 552:	0f 89 80 00 00 00    	jns    5d8 <printint+0x98>
+ 558:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 55c:	74 7a                	je     5d8 <printint+0x98>
+    x = -xx;
+ 55e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 560:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 565:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 568:	31 f6                	xor    %esi,%esi
+ 56a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 570:	89 c8                	mov    %ecx,%eax
+ 572:	31 d2                	xor    %edx,%edx
+ 574:	89 f7                	mov    %esi,%edi
+ 576:	f7 f3                	div    %ebx
+ 578:	8d 76 01             	lea    0x1(%esi),%esi
+ 57b:	0f b6 92 e0 0a 00 00 	movzbl 0xae0(%edx),%edx
+ 582:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 586:	89 ca                	mov    %ecx,%edx
+ 588:	89 c1                	mov    %eax,%ecx
+ 58a:	39 da                	cmp    %ebx,%edx
+ 58c:	73 e2                	jae    570 <printint+0x30>
+  if(neg)
+ 58e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 591:	85 c0                	test   %eax,%eax
+ 593:	74 07                	je     59c <printint+0x5c>
+    buf[i++] = '-';
+ 595:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 59a:	89 f7                	mov    %esi,%edi
+ 59c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 59f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5a2:	01 df                	add    %ebx,%edi
+ 5a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5ab:	83 ec 04             	sub    $0x4,%esp
+ 5ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5b4:	6a 01                	push   $0x1
+ 5b6:	50                   	push   %eax
+ 5b7:	56                   	push   %esi
+ 5b8:	e8 96 fe ff ff       	call   453 <write>
+  while(--i >= 0)
+ 5bd:	89 f8                	mov    %edi,%eax
+ 5bf:	83 c4 10             	add    $0x10,%esp
+ 5c2:	83 ef 01             	sub    $0x1,%edi
+ 5c5:	39 d8                	cmp    %ebx,%eax
+ 5c7:	75 df                	jne    5a8 <printint+0x68>
+}
+ 5c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5cc:	5b                   	pop    %ebx
+ 5cd:	5e                   	pop    %esi
+ 5ce:	5f                   	pop    %edi
+ 5cf:	5d                   	pop    %ebp
+ 5d0:	c3                   	ret
+ 5d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5d8:	31 c0                	xor    %eax,%eax
+ 5da:	eb 89                	jmp    565 <printint+0x25>
+ 5dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	57                   	push   %edi
+ 5e4:	56                   	push   %esi
+ 5e5:	53                   	push   %ebx
+ 5e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 5f2:	83 c6 01             	add    $0x1,%esi
+ 5f5:	84 db                	test   %bl,%bl
+ 5f7:	74 67                	je     660 <printf+0x80>
+ 5f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5fc:	31 d2                	xor    %edx,%edx
+ 5fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 601:	eb 34                	jmp    637 <printf+0x57>
+ 603:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 607:	90                   	nop
+ 608:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 60b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 610:	83 f8 25             	cmp    $0x25,%eax
+ 613:	74 18                	je     62d <printf+0x4d>
+  write(fd, &c, 1);
+ 615:	83 ec 04             	sub    $0x4,%esp
+ 618:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 61b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 61e:	6a 01                	push   $0x1
+ 620:	50                   	push   %eax
+ 621:	57                   	push   %edi
+ 622:	e8 2c fe ff ff       	call   453 <write>
+ 627:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 62a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 62d:	0f b6 1e             	movzbl (%esi),%ebx
+ 630:	83 c6 01             	add    $0x1,%esi
+ 633:	84 db                	test   %bl,%bl
+ 635:	74 29                	je     660 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 637:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 63a:	85 d2                	test   %edx,%edx
+ 63c:	74 ca                	je     608 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 63e:	83 fa 25             	cmp    $0x25,%edx
+ 641:	75 ea                	jne    62d <printf+0x4d>
+      if(c == 'd'){
+ 643:	83 f8 25             	cmp    $0x25,%eax
+ 646:	0f 84 24 01 00 00    	je     770 <printf+0x190>
+ 64c:	83 e8 63             	sub    $0x63,%eax
+ 64f:	83 f8 15             	cmp    $0x15,%eax
+ 652:	77 1c                	ja     670 <printf+0x90>
+ 654:	ff 24 85 88 0a 00 00 	jmp    *0xa88(,%eax,4)
+ 65b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 65f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 660:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 663:	5b                   	pop    %ebx
+ 664:	5e                   	pop    %esi
+ 665:	5f                   	pop    %edi
+ 666:	5d                   	pop    %ebp
+ 667:	c3                   	ret
+ 668:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66f:	90                   	nop
+  write(fd, &c, 1);
+ 670:	83 ec 04             	sub    $0x4,%esp
+ 673:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 676:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 67a:	6a 01                	push   $0x1
+ 67c:	52                   	push   %edx
+ 67d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 680:	57                   	push   %edi
+ 681:	e8 cd fd ff ff       	call   453 <write>
+ 686:	83 c4 0c             	add    $0xc,%esp
+ 689:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 68c:	6a 01                	push   $0x1
+ 68e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 691:	52                   	push   %edx
+ 692:	57                   	push   %edi
+ 693:	e8 bb fd ff ff       	call   453 <write>
+        putc(fd, c);
+ 698:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 69b:	31 d2                	xor    %edx,%edx
+ 69d:	eb 8e                	jmp    62d <printf+0x4d>
+ 69f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6a3:	83 ec 0c             	sub    $0xc,%esp
+ 6a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6ab:	8b 13                	mov    (%ebx),%edx
+ 6ad:	6a 00                	push   $0x0
+ 6af:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6b4:	e8 87 fe ff ff       	call   540 <printint>
+        ap++;
+ 6b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6bf:	31 d2                	xor    %edx,%edx
+ 6c1:	e9 67 ff ff ff       	jmp    62d <printf+0x4d>
+ 6c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6d5:	83 c0 04             	add    $0x4,%eax
+ 6d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6db:	85 db                	test   %ebx,%ebx
+ 6dd:	0f 84 9d 00 00 00    	je     780 <printf+0x1a0>
+        while(*s != 0){
+ 6e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6e8:	84 c0                	test   %al,%al
+ 6ea:	0f 84 3d ff ff ff    	je     62d <printf+0x4d>
+ 6f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6f6:	89 de                	mov    %ebx,%esi
+ 6f8:	89 d3                	mov    %edx,%ebx
+ 6fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 700:	83 ec 04             	sub    $0x4,%esp
+ 703:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 706:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 709:	6a 01                	push   $0x1
+ 70b:	53                   	push   %ebx
+ 70c:	57                   	push   %edi
+ 70d:	e8 41 fd ff ff       	call   453 <write>
+        while(*s != 0){
+ 712:	0f b6 06             	movzbl (%esi),%eax
+ 715:	83 c4 10             	add    $0x10,%esp
+ 718:	84 c0                	test   %al,%al
+ 71a:	75 e4                	jne    700 <printf+0x120>
+      state = 0;
+ 71c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 71f:	31 d2                	xor    %edx,%edx
+ 721:	e9 07 ff ff ff       	jmp    62d <printf+0x4d>
+ 726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 730:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 733:	83 ec 0c             	sub    $0xc,%esp
+ 736:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 73b:	8b 13                	mov    (%ebx),%edx
+ 73d:	6a 01                	push   $0x1
+ 73f:	e9 6b ff ff ff       	jmp    6af <printf+0xcf>
+ 744:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 748:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 74b:	83 ec 04             	sub    $0x4,%esp
+ 74e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 751:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 753:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 756:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 759:	6a 01                	push   $0x1
+ 75b:	52                   	push   %edx
+ 75c:	57                   	push   %edi
+ 75d:	e8 f1 fc ff ff       	call   453 <write>
+        ap++;
+ 762:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 765:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 768:	31 d2                	xor    %edx,%edx
+ 76a:	e9 be fe ff ff       	jmp    62d <printf+0x4d>
+ 76f:	90                   	nop
+  write(fd, &c, 1);
+ 770:	83 ec 04             	sub    $0x4,%esp
+ 773:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 776:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 779:	6a 01                	push   $0x1
+ 77b:	e9 11 ff ff ff       	jmp    691 <printf+0xb1>
+ 780:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 785:	bb 81 0a 00 00       	mov    $0xa81,%ebx
+ 78a:	e9 61 ff ff ff       	jmp    6f0 <printf+0x110>
+ 78f:	90                   	nop
+
+00000790 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 790:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 791:	a1 88 0d 00 00       	mov    0xd88,%eax
+{
+ 796:	89 e5                	mov    %esp,%ebp
+ 798:	57                   	push   %edi
+ 799:	56                   	push   %esi
+ 79a:	53                   	push   %ebx
+ 79b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 79e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7a8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7aa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7ac:	39 ca                	cmp    %ecx,%edx
+ 7ae:	73 30                	jae    7e0 <free+0x50>
+ 7b0:	39 c1                	cmp    %eax,%ecx
+ 7b2:	72 04                	jb     7b8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7b4:	39 c2                	cmp    %eax,%edx
+ 7b6:	72 f0                	jb     7a8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7b8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7bb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7be:	39 f8                	cmp    %edi,%eax
+ 7c0:	74 2e                	je     7f0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7c2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7c5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7c8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7cb:	39 f1                	cmp    %esi,%ecx
+ 7cd:	74 38                	je     807 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7cf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7d1:	5b                   	pop    %ebx
+  freep = p;
+ 7d2:	89 15 88 0d 00 00    	mov    %edx,0xd88
+}
+ 7d8:	5e                   	pop    %esi
+ 7d9:	5f                   	pop    %edi
+ 7da:	5d                   	pop    %ebp
+ 7db:	c3                   	ret
+ 7dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7e0:	39 c1                	cmp    %eax,%ecx
+ 7e2:	72 d0                	jb     7b4 <free+0x24>
+ 7e4:	eb c2                	jmp    7a8 <free+0x18>
+ 7e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ed:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 7f0:	03 70 04             	add    0x4(%eax),%esi
+ 7f3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7f6:	8b 02                	mov    (%edx),%eax
+ 7f8:	8b 00                	mov    (%eax),%eax
+ 7fa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7fd:	8b 42 04             	mov    0x4(%edx),%eax
+ 800:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 803:	39 f1                	cmp    %esi,%ecx
+ 805:	75 c8                	jne    7cf <free+0x3f>
+    p->s.size += bp->s.size;
+ 807:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 80a:	89 15 88 0d 00 00    	mov    %edx,0xd88
+    p->s.size += bp->s.size;
+ 810:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 813:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 816:	89 0a                	mov    %ecx,(%edx)
+}
+ 818:	5b                   	pop    %ebx
+ 819:	5e                   	pop    %esi
+ 81a:	5f                   	pop    %edi
+ 81b:	5d                   	pop    %ebp
+ 81c:	c3                   	ret
+ 81d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000820 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	57                   	push   %edi
+ 824:	56                   	push   %esi
+ 825:	53                   	push   %ebx
+ 826:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 829:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 82c:	8b 15 88 0d 00 00    	mov    0xd88,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 832:	8d 78 07             	lea    0x7(%eax),%edi
+ 835:	c1 ef 03             	shr    $0x3,%edi
+ 838:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 83b:	85 d2                	test   %edx,%edx
+ 83d:	0f 84 8d 00 00 00    	je     8d0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 843:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 845:	8b 48 04             	mov    0x4(%eax),%ecx
+ 848:	39 f9                	cmp    %edi,%ecx
+ 84a:	73 64                	jae    8b0 <malloc+0x90>
+  if(nu < 4096)
+ 84c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 851:	39 df                	cmp    %ebx,%edi
+ 853:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 856:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 85d:	eb 0a                	jmp    869 <malloc+0x49>
+ 85f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 860:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 862:	8b 48 04             	mov    0x4(%eax),%ecx
+ 865:	39 f9                	cmp    %edi,%ecx
+ 867:	73 47                	jae    8b0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 869:	89 c2                	mov    %eax,%edx
+ 86b:	39 05 88 0d 00 00    	cmp    %eax,0xd88
+ 871:	75 ed                	jne    860 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 873:	83 ec 0c             	sub    $0xc,%esp
+ 876:	56                   	push   %esi
+ 877:	e8 3f fc ff ff       	call   4bb <sbrk>
+  if(p == (char*)-1)
+ 87c:	83 c4 10             	add    $0x10,%esp
+ 87f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 882:	74 1c                	je     8a0 <malloc+0x80>
+  hp->s.size = nu;
+ 884:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 887:	83 ec 0c             	sub    $0xc,%esp
+ 88a:	83 c0 08             	add    $0x8,%eax
+ 88d:	50                   	push   %eax
+ 88e:	e8 fd fe ff ff       	call   790 <free>
+  return freep;
+ 893:	8b 15 88 0d 00 00    	mov    0xd88,%edx
+      if((p = morecore(nunits)) == 0)
+ 899:	83 c4 10             	add    $0x10,%esp
+ 89c:	85 d2                	test   %edx,%edx
+ 89e:	75 c0                	jne    860 <malloc+0x40>
+        return 0;
+  }
+}
+ 8a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8a3:	31 c0                	xor    %eax,%eax
+}
+ 8a5:	5b                   	pop    %ebx
+ 8a6:	5e                   	pop    %esi
+ 8a7:	5f                   	pop    %edi
+ 8a8:	5d                   	pop    %ebp
+ 8a9:	c3                   	ret
+ 8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8b0:	39 cf                	cmp    %ecx,%edi
+ 8b2:	74 4c                	je     900 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8b4:	29 f9                	sub    %edi,%ecx
+ 8b6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8b9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8bc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8bf:	89 15 88 0d 00 00    	mov    %edx,0xd88
+}
+ 8c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8c8:	83 c0 08             	add    $0x8,%eax
+}
+ 8cb:	5b                   	pop    %ebx
+ 8cc:	5e                   	pop    %esi
+ 8cd:	5f                   	pop    %edi
+ 8ce:	5d                   	pop    %ebp
+ 8cf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8d0:	c7 05 88 0d 00 00 8c 	movl   $0xd8c,0xd88
+ 8d7:	0d 00 00 
+    base.s.size = 0;
+ 8da:	b8 8c 0d 00 00       	mov    $0xd8c,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8df:	c7 05 8c 0d 00 00 8c 	movl   $0xd8c,0xd8c
+ 8e6:	0d 00 00 
+    base.s.size = 0;
+ 8e9:	c7 05 90 0d 00 00 00 	movl   $0x0,0xd90
+ 8f0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8f3:	e9 54 ff ff ff       	jmp    84c <malloc+0x2c>
+ 8f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 900:	8b 08                	mov    (%eax),%ecx
+ 902:	89 0a                	mov    %ecx,(%edx)
+ 904:	eb b9                	jmp    8bf <malloc+0x9f>
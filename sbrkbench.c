@@ -0,0 +1,77 @@
+// Lazy heap benchmark.
+// Grows the heap by 16 MB, writes to PCT percent of its pages,
+// spread evenly, reads every page the way a program scanning a
+// calloc()ed array would, then gives the memory back, and
+// reports the ticks each step took and the page faults it
+// caused.
+
+#include "types.h"
+#include "mmu.h"
+#include "param.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "user.h"
+
+#define MB      (1024*1024)
+#define HEAPSZ  (16*MB)
+#define PCT     1
+
+int
+main(int argc, char *argv[])
+{
+  int pct, npage, stride, i, sum;
+  uint start, tgrow, ttouch, tread, tshrink;
+  struct fault_info before, after;
+  char *a;
+
+  pct = PCT;
+  if(argc > 1)
+    pct = atoi(argv[1]);
+  if(pct < 1 || pct > 100)
+    pct = PCT;
+  npage = HEAPSZ / PGSIZE;
+  stride = 100 / pct;
+
+  getfaultinfo(&before);
+  start = uptime();
+  a = sbrk(HEAPSZ);
+  tgrow = uptime() - start;
+  if(a == (char*)-1){
+    printf(1, "sbrkbench: sbrk failed\n");
+    exit();
+  }
+
+  start = uptime();
+  for(i = 0; i < npage; i += stride)
+    a[i * PGSIZE] = 1;
+  ttouch = uptime() - start;
+
+  start = uptime();
+  sum = 0;
+  for(i = 0; i < npage; i++)
+    sum += a[i * PGSIZE];
+  tread = uptime() - start;
+
+  start = uptime();
+  if(sbrk(-HEAPSZ) == (char*)-1){
+    printf(1, "sbrkbench: sbrk shrink failed\n");
+    exit();
+  }
+  tshrink = uptime() - start;
+  getfaultinfo(&after);
+
+  printf(1, "sbrkbench: %d KB heap, touched %d of %d pages\n",
+         HEAPSZ / 1024, (npage + stride - 1) / stride, npage);
+  printf(1, "sbrkbench: grow %d ticks, touch %d ticks, read %d ticks, "
+         "shrink %d ticks\n", tgrow, ttouch, tread, tshrink);
+  if(sum != (npage + stride - 1) / stride)
+    printf(1, "sbrkbench: read back %d, wrong\n", sum);
+  printf(1, "sbrkbench: %d zero-fill faults, %d zero page maps, "
+         "%d program faults, %d copy-on-write faults\n",
+         after.zero - before.zero, after.zeroread - before.zeroread,
+         after.exec - before.exec,
+         (after.copy - before.copy) + (after.reuse - before.reuse));
+  printf(1, "sbrkbench: %d zeroed pages from the idle pool, %d cleared on demand\n",
+         after.zpool - before.zpool, after.zclear - before.zclear);
+  exit();
+}
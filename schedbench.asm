@@ -0,0 +1,1460 @@
+
+_schedbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+        __asm__("");
+    }
+}
+
+int main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec 68 01 00 00    	sub    $0x168,%esp
+  17:	8b 19                	mov    (%ecx),%ebx
+  19:	8b 71 04             	mov    0x4(%ecx),%esi
+    int i, pid, num_children, num_ticks, total;
+    int pids[MAX_CHILDREN];
+    struct cpus_info before, after;
+
+    num_children = argc > 1 ? atoi(argv[1]) : DEFAULT_CHILDREN;
+  1c:	83 fb 01             	cmp    $0x1,%ebx
+  1f:	7f 59                	jg     7a <main+0x7a>
+        printf(2, "usage: %s [children (1-%d)] [ticks]\n", argv[0], MAX_CHILDREN);
+        exit();
+    }
+
+    /* give us a lot of tickets so we get to wake up on time */
+    settickets(LARGE_TICKET_COUNT);
+  21:	83 ec 0c             	sub    $0xc,%esp
+    num_children = argc > 1 ? atoi(argv[1]) : DEFAULT_CHILDREN;
+  24:	bf 10 00 00 00       	mov    $0x10,%edi
+    settickets(LARGE_TICKET_COUNT);
+  29:	68 a0 86 01 00       	push   $0x186a0
+  2e:	e8 80 05 00 00       	call   5b3 <settickets>
+  33:	83 c4 10             	add    $0x10,%esp
+    num_ticks = argc > 2 ? atoi(argv[2]) : SLEEP_TICKS;
+  36:	c7 85 94 fe ff ff f4 	movl   $0x1f4,-0x16c(%ebp)
+  3d:	01 00 00 
+    for (i = 0; i < num_children; ++i) {
+  40:	31 db                	xor    %ebx,%ebx
+  42:	eb 1e                	jmp    62 <main+0x62>
+  44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        pid = fork();
+        if (pid == 0) {
+            settickets(10);
+            run_forever();
+        }
+        if (pid < 0) {
+  48:	0f 88 b7 00 00 00    	js     105 <main+0x105>
+            printf(2, "error in fork\n");
+            num_children = i;
+            break;
+        }
+        pids[i] = pid;
+  4e:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+  54:	89 04 9e             	mov    %eax,(%esi,%ebx,4)
+    for (i = 0; i < num_children; ++i) {
+  57:	83 c3 01             	add    $0x1,%ebx
+  5a:	39 fb                	cmp    %edi,%ebx
+  5c:	0f 84 5f 01 00 00    	je     1c1 <main+0x1c1>
+        pid = fork();
+  62:	e8 94 04 00 00       	call   4fb <fork>
+        if (pid == 0) {
+  67:	85 c0                	test   %eax,%eax
+  69:	75 dd                	jne    48 <main+0x48>
+            settickets(10);
+  6b:	83 ec 0c             	sub    $0xc,%esp
+  6e:	6a 0a                	push   $0xa
+  70:	e8 3e 05 00 00       	call   5b3 <settickets>
+  75:	83 c4 10             	add    $0x10,%esp
+    while (1) {
+  78:	eb fe                	jmp    78 <main+0x78>
+    num_children = argc > 1 ? atoi(argv[1]) : DEFAULT_CHILDREN;
+  7a:	83 ec 0c             	sub    $0xc,%esp
+  7d:	ff 76 04             	push   0x4(%esi)
+  80:	e8 0b 04 00 00       	call   490 <atoi>
+    num_ticks = argc > 2 ? atoi(argv[2]) : SLEEP_TICKS;
+  85:	83 c4 10             	add    $0x10,%esp
+    num_children = argc > 1 ? atoi(argv[1]) : DEFAULT_CHILDREN;
+  88:	89 c7                	mov    %eax,%edi
+    num_ticks = argc > 2 ? atoi(argv[2]) : SLEEP_TICKS;
+  8a:	83 fb 02             	cmp    $0x2,%ebx
+  8d:	75 1d                	jne    ac <main+0xac>
+    if (num_children < 1 || num_children > MAX_CHILDREN || num_ticks < 1) {
+  8f:	8d 40 ff             	lea    -0x1(%eax),%eax
+  92:	83 f8 1f             	cmp    $0x1f,%eax
+  95:	76 4f                	jbe    e6 <main+0xe6>
+        printf(2, "usage: %s [children (1-%d)] [ticks]\n", argv[0], MAX_CHILDREN);
+  97:	6a 20                	push   $0x20
+  99:	ff 36                	push   (%esi)
+  9b:	68 d8 09 00 00       	push   $0x9d8
+  a0:	6a 02                	push   $0x2
+  a2:	e8 09 06 00 00       	call   6b0 <printf>
+        exit();
+  a7:	e8 57 04 00 00       	call   503 <exit>
+    num_ticks = argc > 2 ? atoi(argv[2]) : SLEEP_TICKS;
+  ac:	83 ec 0c             	sub    $0xc,%esp
+  af:	ff 76 08             	push   0x8(%esi)
+  b2:	e8 d9 03 00 00       	call   490 <atoi>
+    if (num_children < 1 || num_children > MAX_CHILDREN || num_ticks < 1) {
+  b7:	83 c4 10             	add    $0x10,%esp
+    num_ticks = argc > 2 ? atoi(argv[2]) : SLEEP_TICKS;
+  ba:	89 85 94 fe ff ff    	mov    %eax,-0x16c(%ebp)
+    if (num_children < 1 || num_children > MAX_CHILDREN || num_ticks < 1) {
+  c0:	8d 47 ff             	lea    -0x1(%edi),%eax
+  c3:	83 f8 1f             	cmp    $0x1f,%eax
+  c6:	77 cf                	ja     97 <main+0x97>
+  c8:	83 bd 94 fe ff ff 00 	cmpl   $0x0,-0x16c(%ebp)
+  cf:	7e c6                	jle    97 <main+0x97>
+    settickets(LARGE_TICKET_COUNT);
+  d1:	83 ec 0c             	sub    $0xc,%esp
+  d4:	68 a0 86 01 00       	push   $0x186a0
+  d9:	e8 d5 04 00 00       	call   5b3 <settickets>
+  de:	83 c4 10             	add    $0x10,%esp
+  e1:	e9 5a ff ff ff       	jmp    40 <main+0x40>
+  e6:	83 ec 0c             	sub    $0xc,%esp
+  e9:	68 a0 86 01 00       	push   $0x186a0
+  ee:	e8 c0 04 00 00       	call   5b3 <settickets>
+  f3:	83 c4 10             	add    $0x10,%esp
+    num_ticks = argc > 2 ? atoi(argv[2]) : SLEEP_TICKS;
+  f6:	c7 85 94 fe ff ff f4 	movl   $0x1f4,-0x16c(%ebp)
+  fd:	01 00 00 
+ 100:	e9 3b ff ff ff       	jmp    40 <main+0x40>
+            printf(2, "error in fork\n");
+ 105:	50                   	push   %eax
+ 106:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+ 10c:	50                   	push   %eax
+ 10d:	68 48 0a 00 00       	push   $0xa48
+ 112:	6a 02                	push   $0x2
+ 114:	e8 97 05 00 00       	call   6b0 <printf>
+    }
+
+    before.num_cpus = after.num_cpus = -1;
+    getcpusinfo(&before);
+ 119:	8d 85 a0 fe ff ff    	lea    -0x160(%ebp),%eax
+    before.num_cpus = after.num_cpus = -1;
+ 11f:	c7 85 04 ff ff ff ff 	movl   $0xffffffff,-0xfc(%ebp)
+ 126:	ff ff ff 
+ 129:	c7 85 a0 fe ff ff ff 	movl   $0xffffffff,-0x160(%ebp)
+ 130:	ff ff ff 
+    getcpusinfo(&before);
+ 133:	89 85 90 fe ff ff    	mov    %eax,-0x170(%ebp)
+ 139:	89 04 24             	mov    %eax,(%esp)
+ 13c:	e8 9a 04 00 00       	call   5db <getcpusinfo>
+    sleep(num_ticks);
+ 141:	58                   	pop    %eax
+ 142:	ff b5 94 fe ff ff    	push   -0x16c(%ebp)
+ 148:	e8 46 04 00 00       	call   593 <sleep>
+    getcpusinfo(&after);
+ 14d:	8d 85 04 ff ff ff    	lea    -0xfc(%ebp),%eax
+ 153:	89 85 8c fe ff ff    	mov    %eax,-0x174(%ebp)
+ 159:	89 04 24             	mov    %eax,(%esp)
+ 15c:	e8 7a 04 00 00       	call   5db <getcpusinfo>
+
+    for (i = 0; i < num_children; ++i) {
+ 161:	83 c4 10             	add    $0x10,%esp
+ 164:	85 db                	test   %ebx,%ebx
+ 166:	74 34                	je     19c <main+0x19c>
+ 168:	89 f7                	mov    %esi,%edi
+ 16a:	8d 34 9e             	lea    (%esi,%ebx,4),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+        kill(pids[i]);
+ 170:	83 ec 0c             	sub    $0xc,%esp
+ 173:	ff 37                	push   (%edi)
+    for (i = 0; i < num_children; ++i) {
+ 175:	83 c7 04             	add    $0x4,%edi
+        kill(pids[i]);
+ 178:	e8 b6 03 00 00       	call   533 <kill>
+    for (i = 0; i < num_children; ++i) {
+ 17d:	83 c4 10             	add    $0x10,%esp
+ 180:	39 fe                	cmp    %edi,%esi
+ 182:	75 ec                	jne    170 <main+0x170>
+    }
+    for (i = 0; i < num_children; ++i) {
+ 184:	31 f6                	xor    %esi,%esi
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+        wait();
+ 190:	e8 76 03 00 00       	call   50b <wait>
+    for (i = 0; i < num_children; ++i) {
+ 195:	83 c6 01             	add    $0x1,%esi
+ 198:	39 de                	cmp    %ebx,%esi
+ 19a:	75 f4                	jne    190 <main+0x190>
+    }
+
+    if (before.num_cpus < 1 || after.num_cpus != before.num_cpus) {
+ 19c:	8b 85 a0 fe ff ff    	mov    -0x160(%ebp),%eax
+ 1a2:	85 c0                	test   %eax,%eax
+ 1a4:	7e 08                	jle    1ae <main+0x1ae>
+ 1a6:	3b 85 04 ff ff ff    	cmp    -0xfc(%ebp),%eax
+ 1ac:	74 64                	je     212 <main+0x212>
+        printf(2, "getcpusinfo returned a bad cpu count\n");
+ 1ae:	50                   	push   %eax
+ 1af:	50                   	push   %eax
+ 1b0:	68 00 0a 00 00       	push   $0xa00
+ 1b5:	6a 02                	push   $0x2
+ 1b7:	e8 f4 04 00 00       	call   6b0 <printf>
+        exit();
+ 1bc:	e8 42 03 00 00       	call   503 <exit>
+    getcpusinfo(&before);
+ 1c1:	83 ec 0c             	sub    $0xc,%esp
+ 1c4:	8d 85 a0 fe ff ff    	lea    -0x160(%ebp),%eax
+    before.num_cpus = after.num_cpus = -1;
+ 1ca:	c7 85 04 ff ff ff ff 	movl   $0xffffffff,-0xfc(%ebp)
+ 1d1:	ff ff ff 
+ 1d4:	c7 85 a0 fe ff ff ff 	movl   $0xffffffff,-0x160(%ebp)
+ 1db:	ff ff ff 
+    getcpusinfo(&before);
+ 1de:	89 85 90 fe ff ff    	mov    %eax,-0x170(%ebp)
+ 1e4:	50                   	push   %eax
+ 1e5:	e8 f1 03 00 00       	call   5db <getcpusinfo>
+    sleep(num_ticks);
+ 1ea:	58                   	pop    %eax
+ 1eb:	ff b5 94 fe ff ff    	push   -0x16c(%ebp)
+ 1f1:	e8 9d 03 00 00       	call   593 <sleep>
+    getcpusinfo(&after);
+ 1f6:	8d 85 04 ff ff ff    	lea    -0xfc(%ebp),%eax
+ 1fc:	89 85 8c fe ff ff    	mov    %eax,-0x174(%ebp)
+ 202:	89 04 24             	mov    %eax,(%esp)
+ 205:	e8 d1 03 00 00       	call   5db <getcpusinfo>
+ 20a:	83 c4 10             	add    $0x10,%esp
+ 20d:	e9 56 ff ff ff       	jmp    168 <main+0x168>
+    }
+    printf(1, "%d children, %d cpus, %d ticks\n", num_children, after.num_cpus, num_ticks);
+ 212:	83 ec 0c             	sub    $0xc,%esp
+ 215:	ff b5 94 fe ff ff    	push   -0x16c(%ebp)
+    printf(1, "CPU\tSWITCH\tSWITCH/s\tSTEALS\n");
+    total = 0;
+    for (i = 0; i < after.num_cpus; ++i) {
+ 21b:	31 f6                	xor    %esi,%esi
+    printf(1, "%d children, %d cpus, %d ticks\n", num_children, after.num_cpus, num_ticks);
+ 21d:	50                   	push   %eax
+ 21e:	53                   	push   %ebx
+    total = 0;
+ 21f:	31 db                	xor    %ebx,%ebx
+    printf(1, "%d children, %d cpus, %d ticks\n", num_children, after.num_cpus, num_ticks);
+ 221:	68 28 0a 00 00       	push   $0xa28
+ 226:	6a 01                	push   $0x1
+ 228:	e8 83 04 00 00       	call   6b0 <printf>
+    printf(1, "CPU\tSWITCH\tSWITCH/s\tSTEALS\n");
+ 22d:	83 c4 18             	add    $0x18,%esp
+ 230:	68 57 0a 00 00       	push   $0xa57
+ 235:	6a 01                	push   $0x1
+ 237:	e8 74 04 00 00       	call   6b0 <printf>
+    for (i = 0; i < after.num_cpus; ++i) {
+ 23c:	8b bd 8c fe ff ff    	mov    -0x174(%ebp),%edi
+ 242:	83 c4 10             	add    $0x10,%esp
+ 245:	eb 3a                	jmp    281 <main+0x281>
+        int switches = after.switches[i] - before.switches[i];
+ 247:	8b 95 90 fe ff ff    	mov    -0x170(%ebp),%edx
+ 24d:	8b 4c b7 04          	mov    0x4(%edi,%esi,4),%ecx
+ 251:	2b 4c b2 04          	sub    0x4(%edx,%esi,4),%ecx
+        total += switches;
+        printf(1, "%d\t%d\t%d\t\t%d\n", i, switches,
+ 255:	50                   	push   %eax
+ 256:	50                   	push   %eax
+ 257:	8b 44 b7 24          	mov    0x24(%edi,%esi,4),%eax
+        total += switches;
+ 25b:	01 cb                	add    %ecx,%ebx
+        printf(1, "%d\t%d\t%d\t\t%d\n", i, switches,
+ 25d:	2b 44 b2 24          	sub    0x24(%edx,%esi,4),%eax
+ 261:	50                   	push   %eax
+               switches * TICKS_PER_SECOND / num_ticks,
+ 262:	6b c1 64             	imul   $0x64,%ecx,%eax
+        printf(1, "%d\t%d\t%d\t\t%d\n", i, switches,
+ 265:	99                   	cltd
+ 266:	f7 bd 94 fe ff ff    	idivl  -0x16c(%ebp)
+ 26c:	50                   	push   %eax
+ 26d:	51                   	push   %ecx
+ 26e:	56                   	push   %esi
+    for (i = 0; i < after.num_cpus; ++i) {
+ 26f:	83 c6 01             	add    $0x1,%esi
+        printf(1, "%d\t%d\t%d\t\t%d\n", i, switches,
+ 272:	68 73 0a 00 00       	push   $0xa73
+ 277:	6a 01                	push   $0x1
+ 279:	e8 32 04 00 00       	call   6b0 <printf>
+    for (i = 0; i < after.num_cpus; ++i) {
+ 27e:	83 c4 20             	add    $0x20,%esp
+ 281:	39 b5 04 ff ff ff    	cmp    %esi,-0xfc(%ebp)
+ 287:	7f be                	jg     247 <main+0x247>
+               after.steals[i] - before.steals[i]);
+    }
+    printf(1, "total\t%d\t%d\n", total, total * TICKS_PER_SECOND / num_ticks);
+ 289:	6b c3 64             	imul   $0x64,%ebx,%eax
+ 28c:	99                   	cltd
+ 28d:	f7 bd 94 fe ff ff    	idivl  -0x16c(%ebp)
+ 293:	50                   	push   %eax
+ 294:	53                   	push   %ebx
+ 295:	68 81 0a 00 00       	push   $0xa81
+ 29a:	6a 01                	push   $0x1
+ 29c:	e8 0f 04 00 00       	call   6b0 <printf>
+    exit();
+ 2a1:	e8 5d 02 00 00       	call   503 <exit>
+ 2a6:	66 90                	xchg   %ax,%ax
+ 2a8:	66 90                	xchg   %ax,%ax
+ 2aa:	66 90                	xchg   %ax,%ax
+ 2ac:	66 90                	xchg   %ax,%ax
+ 2ae:	66 90                	xchg   %ax,%ax
+
+000002b0 <run_forever>:
+    while (1) {
+ 2b0:	eb fe                	jmp    2b0 <run_forever>
+ 2b2:	66 90                	xchg   %ax,%ax
+ 2b4:	66 90                	xchg   %ax,%ax
+ 2b6:	66 90                	xchg   %ax,%ax
+ 2b8:	66 90                	xchg   %ax,%ax
+ 2ba:	66 90                	xchg   %ax,%ax
+ 2bc:	66 90                	xchg   %ax,%ax
+ 2be:	66 90                	xchg   %ax,%ax
+
+000002c0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 2c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2c1:	31 c0                	xor    %eax,%eax
+{
+ 2c3:	89 e5                	mov    %esp,%ebp
+ 2c5:	53                   	push   %ebx
+ 2c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2d7:	83 c0 01             	add    $0x1,%eax
+ 2da:	84 d2                	test   %dl,%dl
+ 2dc:	75 f2                	jne    2d0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e1:	89 c8                	mov    %ecx,%eax
+ 2e3:	c9                   	leave
+ 2e4:	c3                   	ret
+ 2e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2fa:	0f b6 02             	movzbl (%edx),%eax
+ 2fd:	84 c0                	test   %al,%al
+ 2ff:	75 17                	jne    318 <strcmp+0x28>
+ 301:	eb 3a                	jmp    33d <strcmp+0x4d>
+ 303:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 307:	90                   	nop
+ 308:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 30c:	83 c2 01             	add    $0x1,%edx
+ 30f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 312:	84 c0                	test   %al,%al
+ 314:	74 1a                	je     330 <strcmp+0x40>
+    p++, q++;
+ 316:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 318:	0f b6 19             	movzbl (%ecx),%ebx
+ 31b:	38 c3                	cmp    %al,%bl
+ 31d:	74 e9                	je     308 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 31f:	29 d8                	sub    %ebx,%eax
+}
+ 321:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 324:	c9                   	leave
+ 325:	c3                   	ret
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 330:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 334:	31 c0                	xor    %eax,%eax
+ 336:	29 d8                	sub    %ebx,%eax
+}
+ 338:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 33b:	c9                   	leave
+ 33c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 33d:	0f b6 19             	movzbl (%ecx),%ebx
+ 340:	31 c0                	xor    %eax,%eax
+ 342:	eb db                	jmp    31f <strcmp+0x2f>
+ 344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 356:	80 3a 00             	cmpb   $0x0,(%edx)
+ 359:	74 15                	je     370 <strlen+0x20>
+ 35b:	31 c0                	xor    %eax,%eax
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+ 360:	83 c0 01             	add    $0x1,%eax
+ 363:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 367:	89 c1                	mov    %eax,%ecx
+ 369:	75 f5                	jne    360 <strlen+0x10>
+    ;
+  return n;
+}
+ 36b:	89 c8                	mov    %ecx,%eax
+ 36d:	5d                   	pop    %ebp
+ 36e:	c3                   	ret
+ 36f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 370:	31 c9                	xor    %ecx,%ecx
+}
+ 372:	5d                   	pop    %ebp
+ 373:	89 c8                	mov    %ecx,%eax
+ 375:	c3                   	ret
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000380 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 387:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 38a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 38d:	89 d7                	mov    %edx,%edi
+ 38f:	fc                   	cld
+ 390:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 392:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 395:	89 d0                	mov    %edx,%eax
+ 397:	c9                   	leave
+ 398:	c3                   	ret
+ 399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3aa:	0f b6 10             	movzbl (%eax),%edx
+ 3ad:	84 d2                	test   %dl,%dl
+ 3af:	75 12                	jne    3c3 <strchr+0x23>
+ 3b1:	eb 1d                	jmp    3d0 <strchr+0x30>
+ 3b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3b7:	90                   	nop
+ 3b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3bc:	83 c0 01             	add    $0x1,%eax
+ 3bf:	84 d2                	test   %dl,%dl
+ 3c1:	74 0d                	je     3d0 <strchr+0x30>
+    if(*s == c)
+ 3c3:	38 d1                	cmp    %dl,%cl
+ 3c5:	75 f1                	jne    3b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3c7:	5d                   	pop    %ebp
+ 3c8:	c3                   	ret
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3d0:	31 c0                	xor    %eax,%eax
+}
+ 3d2:	5d                   	pop    %ebp
+ 3d3:	c3                   	ret
+ 3d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3df:	90                   	nop
+
+000003e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3e9:	31 db                	xor    %ebx,%ebx
+{
+ 3eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3ee:	eb 27                	jmp    417 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3f0:	83 ec 04             	sub    $0x4,%esp
+ 3f3:	6a 01                	push   $0x1
+ 3f5:	56                   	push   %esi
+ 3f6:	6a 00                	push   $0x0
+ 3f8:	e8 1e 01 00 00       	call   51b <read>
+    if(cc < 1)
+ 3fd:	83 c4 10             	add    $0x10,%esp
+ 400:	85 c0                	test   %eax,%eax
+ 402:	7e 1d                	jle    421 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 404:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 408:	8b 55 08             	mov    0x8(%ebp),%edx
+ 40b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 40f:	3c 0a                	cmp    $0xa,%al
+ 411:	74 10                	je     423 <gets+0x43>
+ 413:	3c 0d                	cmp    $0xd,%al
+ 415:	74 0c                	je     423 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 417:	89 df                	mov    %ebx,%edi
+ 419:	83 c3 01             	add    $0x1,%ebx
+ 41c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 41f:	7c cf                	jl     3f0 <gets+0x10>
+ 421:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 42a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 42d:	5b                   	pop    %ebx
+ 42e:	5e                   	pop    %esi
+ 42f:	5f                   	pop    %edi
+ 430:	5d                   	pop    %ebp
+ 431:	c3                   	ret
+ 432:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	56                   	push   %esi
+ 444:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 445:	83 ec 08             	sub    $0x8,%esp
+ 448:	6a 00                	push   $0x0
+ 44a:	ff 75 08             	push   0x8(%ebp)
+ 44d:	e8 f1 00 00 00       	call   543 <open>
+  if(fd < 0)
+ 452:	83 c4 10             	add    $0x10,%esp
+ 455:	85 c0                	test   %eax,%eax
+ 457:	78 27                	js     480 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 459:	83 ec 08             	sub    $0x8,%esp
+ 45c:	ff 75 0c             	push   0xc(%ebp)
+ 45f:	89 c3                	mov    %eax,%ebx
+ 461:	50                   	push   %eax
+ 462:	e8 f4 00 00 00       	call   55b <fstat>
+  close(fd);
+ 467:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 46a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 46c:	e8 ba 00 00 00       	call   52b <close>
+  return r;
+ 471:	83 c4 10             	add    $0x10,%esp
+}
+ 474:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 477:	89 f0                	mov    %esi,%eax
+ 479:	5b                   	pop    %ebx
+ 47a:	5e                   	pop    %esi
+ 47b:	5d                   	pop    %ebp
+ 47c:	c3                   	ret
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 480:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 485:	eb ed                	jmp    474 <stat+0x34>
+ 487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48e:	66 90                	xchg   %ax,%ax
+
+00000490 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	53                   	push   %ebx
+ 494:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 497:	0f be 02             	movsbl (%edx),%eax
+ 49a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 49d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4a5:	77 1e                	ja     4c5 <atoi+0x35>
+ 4a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4b0:	83 c2 01             	add    $0x1,%edx
+ 4b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4ba:	0f be 02             	movsbl (%edx),%eax
+ 4bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4c0:	80 fb 09             	cmp    $0x9,%bl
+ 4c3:	76 eb                	jbe    4b0 <atoi+0x20>
+  return n;
+}
+ 4c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4c8:	89 c8                	mov    %ecx,%eax
+ 4ca:	c9                   	leave
+ 4cb:	c3                   	ret
+ 4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+ 4d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4de:	85 c0                	test   %eax,%eax
+ 4e0:	7e 13                	jle    4f5 <memmove+0x25>
+ 4e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4e4:	89 d7                	mov    %edx,%edi
+ 4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4f1:	39 f8                	cmp    %edi,%eax
+ 4f3:	75 fb                	jne    4f0 <memmove+0x20>
+  return vdst;
+}
+ 4f5:	5e                   	pop    %esi
+ 4f6:	89 d0                	mov    %edx,%eax
+ 4f8:	5f                   	pop    %edi
+ 4f9:	5d                   	pop    %ebp
+ 4fa:	c3                   	ret
+
+000004fb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4fb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <exit>:
+SYSCALL(exit)
+ 503:	b8 02 00 00 00       	mov    $0x2,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <wait>:
+SYSCALL(wait)
+ 50b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <pipe>:
+SYSCALL(pipe)
+ 513:	b8 04 00 00 00       	mov    $0x4,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <read>:
+SYSCALL(read)
+ 51b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <write>:
+SYSCALL(write)
+ 523:	b8 10 00 00 00       	mov    $0x10,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <close>:
+SYSCALL(close)
+ 52b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <kill>:
+SYSCALL(kill)
+ 533:	b8 06 00 00 00       	mov    $0x6,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <exec>:
+SYSCALL(exec)
+ 53b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <open>:
+SYSCALL(open)
+ 543:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <mknod>:
+SYSCALL(mknod)
+ 54b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <unlink>:
+SYSCALL(unlink)
+ 553:	b8 12 00 00 00       	mov    $0x12,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <fstat>:
+SYSCALL(fstat)
+ 55b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <link>:
+SYSCALL(link)
+ 563:	b8 13 00 00 00       	mov    $0x13,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <mkdir>:
+SYSCALL(mkdir)
+ 56b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <chdir>:
+SYSCALL(chdir)
+ 573:	b8 09 00 00 00       	mov    $0x9,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <dup>:
+SYSCALL(dup)
+ 57b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <getpid>:
+SYSCALL(getpid)
+ 583:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <sbrk>:
+SYSCALL(sbrk)
+ 58b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <sleep>:
+SYSCALL(sleep)
+ 593:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <uptime>:
+SYSCALL(uptime)
+ 59b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <trace>:
+SYSCALL(trace)
+ 5a3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <csinfo>:
+SYSCALL(csinfo)
+ 5ab:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <settickets>:
+SYSCALL(settickets)
+ 5b3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <getprocessesinfo>:
+SYSCALL(getprocessesinfo)
+ 5bb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <yield>:
+SYSCALL(yield)
+ 5c3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <random>:
+SYSCALL(random)
+ 5cb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <dumppagetable>:
+SYSCALL(dumppagetable)
+ 5d3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <getcpusinfo>:
+SYSCALL(getcpusinfo)
+ 5db:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <setsched>:
+SYSCALL(setsched)
+ 5e3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <getbcacheinfo>:
+SYSCALL(getbcacheinfo)
+ 5eb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <getballocinfo>:
+SYSCALL(getballocinfo)
+ 5f3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <getfaultinfo>:
+SYSCALL(getfaultinfo)
+ 5fb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+ 603:	66 90                	xchg   %ax,%ax
+ 605:	66 90                	xchg   %ax,%ax
+ 607:	66 90                	xchg   %ax,%ax
+ 609:	66 90                	xchg   %ax,%ax
+ 60b:	66 90                	xchg   %ax,%ax
+ 60d:	66 90                	xchg   %ax,%ax
+ 60f:	90                   	nop
+
+00000610 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	57                   	push   %edi
+ 614:	56                   	push   %esi
+ 615:	53                   	push   %ebx
+ 616:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 618:	89 d1                	mov    %edx,%ecx
+{
+ 61a:	83 ec 3c             	sub    $0x3c,%esp
+ 61d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 620:	85 d2                	test   %edx,%edx
+ 622:	0f 89 80 00 00 00    	jns    6a8 <printint+0x98>
+ 628:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 62c:	74 7a                	je     6a8 <printint+0x98>
+    x = -xx;
+ 62e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 630:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 635:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 638:	31 f6                	xor    %esi,%esi
+ 63a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 640:	89 c8                	mov    %ecx,%eax
+ 642:	31 d2                	xor    %edx,%edx
+ 644:	89 f7                	mov    %esi,%edi
+ 646:	f7 f3                	div    %ebx
+ 648:	8d 76 01             	lea    0x1(%esi),%esi
+ 64b:	0f b6 92 f0 0a 00 00 	movzbl 0xaf0(%edx),%edx
+ 652:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 656:	89 ca                	mov    %ecx,%edx
+ 658:	89 c1                	mov    %eax,%ecx
+ 65a:	39 da                	cmp    %ebx,%edx
+ 65c:	73 e2                	jae    640 <printint+0x30>
+  if(neg)
+ 65e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 661:	85 c0                	test   %eax,%eax
+ 663:	74 07                	je     66c <printint+0x5c>
+    buf[i++] = '-';
+ 665:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 66a:	89 f7                	mov    %esi,%edi
+ 66c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 66f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 672:	01 df                	add    %ebx,%edi
+ 674:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 678:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 67b:	83 ec 04             	sub    $0x4,%esp
+ 67e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 681:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 684:	6a 01                	push   $0x1
+ 686:	50                   	push   %eax
+ 687:	56                   	push   %esi
+ 688:	e8 96 fe ff ff       	call   523 <write>
+  while(--i >= 0)
+ 68d:	89 f8                	mov    %edi,%eax
+ 68f:	83 c4 10             	add    $0x10,%esp
+ 692:	83 ef 01             	sub    $0x1,%edi
+ 695:	39 d8                	cmp    %ebx,%eax
+ 697:	75 df                	jne    678 <printint+0x68>
+}
+ 699:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 69c:	5b                   	pop    %ebx
+ 69d:	5e                   	pop    %esi
+ 69e:	5f                   	pop    %edi
+ 69f:	5d                   	pop    %ebp
+ 6a0:	c3                   	ret
+ 6a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6a8:	31 c0                	xor    %eax,%eax
+ 6aa:	eb 89                	jmp    635 <printint+0x25>
+ 6ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	57                   	push   %edi
+ 6b4:	56                   	push   %esi
+ 6b5:	53                   	push   %ebx
+ 6b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 6c2:	83 c6 01             	add    $0x1,%esi
+ 6c5:	84 db                	test   %bl,%bl
+ 6c7:	74 67                	je     730 <printf+0x80>
+ 6c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6cc:	31 d2                	xor    %edx,%edx
+ 6ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6d1:	eb 34                	jmp    707 <printf+0x57>
+ 6d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6d7:	90                   	nop
+ 6d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6e0:	83 f8 25             	cmp    $0x25,%eax
+ 6e3:	74 18                	je     6fd <printf+0x4d>
+  write(fd, &c, 1);
+ 6e5:	83 ec 04             	sub    $0x4,%esp
+ 6e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ee:	6a 01                	push   $0x1
+ 6f0:	50                   	push   %eax
+ 6f1:	57                   	push   %edi
+ 6f2:	e8 2c fe ff ff       	call   523 <write>
+ 6f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 700:	83 c6 01             	add    $0x1,%esi
+ 703:	84 db                	test   %bl,%bl
+ 705:	74 29                	je     730 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 707:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 70a:	85 d2                	test   %edx,%edx
+ 70c:	74 ca                	je     6d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 70e:	83 fa 25             	cmp    $0x25,%edx
+ 711:	75 ea                	jne    6fd <printf+0x4d>
+      if(c == 'd'){
+ 713:	83 f8 25             	cmp    $0x25,%eax
+ 716:	0f 84 24 01 00 00    	je     840 <printf+0x190>
+ 71c:	83 e8 63             	sub    $0x63,%eax
+ 71f:	83 f8 15             	cmp    $0x15,%eax
+ 722:	77 1c                	ja     740 <printf+0x90>
+ 724:	ff 24 85 98 0a 00 00 	jmp    *0xa98(,%eax,4)
+ 72b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 72f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 730:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 733:	5b                   	pop    %ebx
+ 734:	5e                   	pop    %esi
+ 735:	5f                   	pop    %edi
+ 736:	5d                   	pop    %ebp
+ 737:	c3                   	ret
+ 738:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73f:	90                   	nop
+  write(fd, &c, 1);
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 746:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 74a:	6a 01                	push   $0x1
+ 74c:	52                   	push   %edx
+ 74d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 750:	57                   	push   %edi
+ 751:	e8 cd fd ff ff       	call   523 <write>
+ 756:	83 c4 0c             	add    $0xc,%esp
+ 759:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 75c:	6a 01                	push   $0x1
+ 75e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 761:	52                   	push   %edx
+ 762:	57                   	push   %edi
+ 763:	e8 bb fd ff ff       	call   523 <write>
+        putc(fd, c);
+ 768:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 76b:	31 d2                	xor    %edx,%edx
+ 76d:	eb 8e                	jmp    6fd <printf+0x4d>
+ 76f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 770:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 773:	83 ec 0c             	sub    $0xc,%esp
+ 776:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 77b:	8b 13                	mov    (%ebx),%edx
+ 77d:	6a 00                	push   $0x0
+ 77f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 781:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 784:	e8 87 fe ff ff       	call   610 <printint>
+        ap++;
+ 789:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 78c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 78f:	31 d2                	xor    %edx,%edx
+ 791:	e9 67 ff ff ff       	jmp    6fd <printf+0x4d>
+ 796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7a5:	83 c0 04             	add    $0x4,%eax
+ 7a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7ab:	85 db                	test   %ebx,%ebx
+ 7ad:	0f 84 9d 00 00 00    	je     850 <printf+0x1a0>
+        while(*s != 0){
+ 7b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7b8:	84 c0                	test   %al,%al
+ 7ba:	0f 84 3d ff ff ff    	je     6fd <printf+0x4d>
+ 7c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7c6:	89 de                	mov    %ebx,%esi
+ 7c8:	89 d3                	mov    %edx,%ebx
+ 7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7d0:	83 ec 04             	sub    $0x4,%esp
+ 7d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7d9:	6a 01                	push   $0x1
+ 7db:	53                   	push   %ebx
+ 7dc:	57                   	push   %edi
+ 7dd:	e8 41 fd ff ff       	call   523 <write>
+        while(*s != 0){
+ 7e2:	0f b6 06             	movzbl (%esi),%eax
+ 7e5:	83 c4 10             	add    $0x10,%esp
+ 7e8:	84 c0                	test   %al,%al
+ 7ea:	75 e4                	jne    7d0 <printf+0x120>
+      state = 0;
+ 7ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7ef:	31 d2                	xor    %edx,%edx
+ 7f1:	e9 07 ff ff ff       	jmp    6fd <printf+0x4d>
+ 7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 800:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 803:	83 ec 0c             	sub    $0xc,%esp
+ 806:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 80b:	8b 13                	mov    (%ebx),%edx
+ 80d:	6a 01                	push   $0x1
+ 80f:	e9 6b ff ff ff       	jmp    77f <printf+0xcf>
+ 814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 818:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 81b:	83 ec 04             	sub    $0x4,%esp
+ 81e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 821:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 823:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 826:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 829:	6a 01                	push   $0x1
+ 82b:	52                   	push   %edx
+ 82c:	57                   	push   %edi
+ 82d:	e8 f1 fc ff ff       	call   523 <write>
+        ap++;
+ 832:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 835:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 838:	31 d2                	xor    %edx,%edx
+ 83a:	e9 be fe ff ff       	jmp    6fd <printf+0x4d>
+ 83f:	90                   	nop
+  write(fd, &c, 1);
+ 840:	83 ec 04             	sub    $0x4,%esp
+ 843:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 846:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 849:	6a 01                	push   $0x1
+ 84b:	e9 11 ff ff ff       	jmp    761 <printf+0xb1>
+ 850:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 855:	bb 8e 0a 00 00       	mov    $0xa8e,%ebx
+ 85a:	e9 61 ff ff ff       	jmp    7c0 <printf+0x110>
+ 85f:	90                   	nop
+
+00000860 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 860:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 861:	a1 ac 0d 00 00       	mov    0xdac,%eax
+{
+ 866:	89 e5                	mov    %esp,%ebp
+ 868:	57                   	push   %edi
+ 869:	56                   	push   %esi
+ 86a:	53                   	push   %ebx
+ 86b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 86e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 871:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 878:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 87a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 87c:	39 ca                	cmp    %ecx,%edx
+ 87e:	73 30                	jae    8b0 <free+0x50>
+ 880:	39 c1                	cmp    %eax,%ecx
+ 882:	72 04                	jb     888 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 884:	39 c2                	cmp    %eax,%edx
+ 886:	72 f0                	jb     878 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 888:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 88b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 88e:	39 f8                	cmp    %edi,%eax
+ 890:	74 2e                	je     8c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 892:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 895:	8b 42 04             	mov    0x4(%edx),%eax
+ 898:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 89b:	39 f1                	cmp    %esi,%ecx
+ 89d:	74 38                	je     8d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 89f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8a1:	5b                   	pop    %ebx
+  freep = p;
+ 8a2:	89 15 ac 0d 00 00    	mov    %edx,0xdac
+}
+ 8a8:	5e                   	pop    %esi
+ 8a9:	5f                   	pop    %edi
+ 8aa:	5d                   	pop    %ebp
+ 8ab:	c3                   	ret
+ 8ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8b0:	39 c1                	cmp    %eax,%ecx
+ 8b2:	72 d0                	jb     884 <free+0x24>
+ 8b4:	eb c2                	jmp    878 <free+0x18>
+ 8b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8c0:	03 70 04             	add    0x4(%eax),%esi
+ 8c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8c6:	8b 02                	mov    (%edx),%eax
+ 8c8:	8b 00                	mov    (%eax),%eax
+ 8ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8cd:	8b 42 04             	mov    0x4(%edx),%eax
+ 8d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8d3:	39 f1                	cmp    %esi,%ecx
+ 8d5:	75 c8                	jne    89f <free+0x3f>
+    p->s.size += bp->s.size;
+ 8d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8da:	89 15 ac 0d 00 00    	mov    %edx,0xdac
+    p->s.size += bp->s.size;
+ 8e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8e6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8e8:	5b                   	pop    %ebx
+ 8e9:	5e                   	pop    %esi
+ 8ea:	5f                   	pop    %edi
+ 8eb:	5d                   	pop    %ebp
+ 8ec:	c3                   	ret
+ 8ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	57                   	push   %edi
+ 8f4:	56                   	push   %esi
+ 8f5:	53                   	push   %ebx
+ 8f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8fc:	8b 15 ac 0d 00 00    	mov    0xdac,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 902:	8d 78 07             	lea    0x7(%eax),%edi
+ 905:	c1 ef 03             	shr    $0x3,%edi
+ 908:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 90b:	85 d2                	test   %edx,%edx
+ 90d:	0f 84 8d 00 00 00    	je     9a0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 913:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 915:	8b 48 04             	mov    0x4(%eax),%ecx
+ 918:	39 f9                	cmp    %edi,%ecx
+ 91a:	73 64                	jae    980 <malloc+0x90>
+  if(nu < 4096)
+ 91c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 921:	39 df                	cmp    %ebx,%edi
+ 923:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 926:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 92d:	eb 0a                	jmp    939 <malloc+0x49>
+ 92f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 930:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 932:	8b 48 04             	mov    0x4(%eax),%ecx
+ 935:	39 f9                	cmp    %edi,%ecx
+ 937:	73 47                	jae    980 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 939:	89 c2                	mov    %eax,%edx
+ 93b:	39 05 ac 0d 00 00    	cmp    %eax,0xdac
+ 941:	75 ed                	jne    930 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 943:	83 ec 0c             	sub    $0xc,%esp
+ 946:	56                   	push   %esi
+ 947:	e8 3f fc ff ff       	call   58b <sbrk>
+  if(p == (char*)-1)
+ 94c:	83 c4 10             	add    $0x10,%esp
+ 94f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 952:	74 1c                	je     970 <malloc+0x80>
+  hp->s.size = nu;
+ 954:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 957:	83 ec 0c             	sub    $0xc,%esp
+ 95a:	83 c0 08             	add    $0x8,%eax
+ 95d:	50                   	push   %eax
+ 95e:	e8 fd fe ff ff       	call   860 <free>
+  return freep;
+ 963:	8b 15 ac 0d 00 00    	mov    0xdac,%edx
+      if((p = morecore(nunits)) == 0)
+ 969:	83 c4 10             	add    $0x10,%esp
+ 96c:	85 d2                	test   %edx,%edx
+ 96e:	75 c0                	jne    930 <malloc+0x40>
+        return 0;
+  }
+}
+ 970:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 973:	31 c0                	xor    %eax,%eax
+}
+ 975:	5b                   	pop    %ebx
+ 976:	5e                   	pop    %esi
+ 977:	5f                   	pop    %edi
+ 978:	5d                   	pop    %ebp
+ 979:	c3                   	ret
+ 97a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 980:	39 cf                	cmp    %ecx,%edi
+ 982:	74 4c                	je     9d0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 984:	29 f9                	sub    %edi,%ecx
+ 986:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 989:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 98c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 98f:	89 15 ac 0d 00 00    	mov    %edx,0xdac
+}
+ 995:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 998:	83 c0 08             	add    $0x8,%eax
+}
+ 99b:	5b                   	pop    %ebx
+ 99c:	5e                   	pop    %esi
+ 99d:	5f                   	pop    %edi
+ 99e:	5d                   	pop    %ebp
+ 99f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9a0:	c7 05 ac 0d 00 00 b0 	movl   $0xdb0,0xdac
+ 9a7:	0d 00 00 
+    base.s.size = 0;
+ 9aa:	b8 b0 0d 00 00       	mov    $0xdb0,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9af:	c7 05 b0 0d 00 00 b0 	movl   $0xdb0,0xdb0
+ 9b6:	0d 00 00 
+    base.s.size = 0;
+ 9b9:	c7 05 b4 0d 00 00 00 	movl   $0x0,0xdb4
+ 9c0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9c3:	e9 54 ff ff ff       	jmp    91c <malloc+0x2c>
+ 9c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9d0:	8b 08                	mov    (%eax),%ecx
+ 9d2:	89 0a                	mov    %ecx,(%edx)
+ 9d4:	eb b9                	jmp    98f <malloc+0x9f>
@@ -0,0 +1,84 @@
+// Scheduler scalability benchmark.
+// Forks N CPU-bound children, lets them compete for SLEEP_TICKS
+// ticks, and reports how many context switches each CPU made.
+// Run it under "make qemu CPUS=8" to exercise the per-CPU run
+// queues and work stealing.
+
+#include "types.h"
+#include "mmu.h"
+#include "param.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "user.h"
+
+#define MAX_CHILDREN 32
+#define DEFAULT_CHILDREN 16
+#define SLEEP_TICKS 500
+#define TICKS_PER_SECOND 100
+#define LARGE_TICKET_COUNT 100000
+
+__attribute__((noreturn))
+void run_forever() {
+    while (1) {
+        __asm__("");
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int i, pid, num_children, num_ticks, total;
+    int pids[MAX_CHILDREN];
+    struct cpus_info before, after;
+
+    num_children = argc > 1 ? atoi(argv[1]) : DEFAULT_CHILDREN;
+    num_ticks = argc > 2 ? atoi(argv[2]) : SLEEP_TICKS;
+    if (num_children < 1 || num_children > MAX_CHILDREN || num_ticks < 1) {
+        printf(2, "usage: %s [children (1-%d)] [ticks]\n", argv[0], MAX_CHILDREN);
+        exit();
+    }
+
+    /* give us a lot of tickets so we get to wake up on time */
+    settickets(LARGE_TICKET_COUNT);
+    for (i = 0; i < num_children; ++i) {
+        pid = fork();
+        if (pid == 0) {
+            settickets(10);
+            run_forever();
+        }
+        if (pid < 0) {
+            printf(2, "error in fork\n");
+            num_children = i;
+            break;
+        }
+        pids[i] = pid;
+    }
+
+    before.num_cpus = after.num_cpus = -1;
+    getcpusinfo(&before);
+    sleep(num_ticks);
+    getcpusinfo(&after);
+
+    for (i = 0; i < num_children; ++i) {
+        kill(pids[i]);
+    }
+    for (i = 0; i < num_children; ++i) {
+        wait();
+    }
+
+    if (before.num_cpus < 1 || after.num_cpus != before.num_cpus) {
+        printf(2, "getcpusinfo returned a bad cpu count\n");
+        exit();
+    }
+    printf(1, "%d children, %d cpus, %d ticks\n", num_children, after.num_cpus, num_ticks);
+    printf(1, "CPU\tSWITCH\tSWITCH/s\tSTEALS\n");
+    total = 0;
+    for (i = 0; i < after.num_cpus; ++i) {
+        int switches = after.switches[i] - before.switches[i];
+        total += switches;
+        printf(1, "%d\t%d\t%d\t\t%d\n", i, switches,
+               switches * TICKS_PER_SECOND / num_ticks,
+               after.steals[i] - before.steals[i]);
+    }
+    printf(1, "total\t%d\t%d\n", total, total * TICKS_PER_SECOND / num_ticks);
+    exit();
+}
@@ -6,8 +6,8 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
 
 void
 initlock(struct spinlock *lk, char *name)
@@ -42,6 +42,24 @@ acquire(struct spinlock *lk)
   getcallerpcs(&lk, lk->pcs);
 }
 
+// Acquire the lock if it is free, without spinning.
+// Returns 1 if it was acquired, 0 if some CPU (maybe
+// this one) holds it.  Since it never waits, it adds no
+// lock-order constraint with the locks the caller holds.
+int
+tryacquire(struct spinlock *lk)
+{
+  pushcli();
+  if(holding(lk) || xchg(&lk->locked, 1) != 0){
+    popcli();
+    return 0;
+  }
+  __sync_synchronize();
+  lk->cpu = cpu;
+  getcallerpcs(&lk, lk->pcs);
+  return 1;
+}
+
 // Release the lock.
 void
 release(struct spinlock *lk)
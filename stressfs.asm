@@ -0,0 +1,1411 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+#define NCREATE 100
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+  char path[] = "stressfs0";
+  char name[] = "cf0_00";
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  memset(data, 'a', sizeof(data));
+   f:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+{
+  15:	53                   	push   %ebx
+
+  for(i = 0; i < 4; i++)
+  16:	31 db                	xor    %ebx,%ebx
+{
+  18:	51                   	push   %ecx
+  char path[] = "stressfs0";
+  19:	b9 30 00 00 00       	mov    $0x30,%ecx
+{
+  1e:	81 ec 40 02 00 00    	sub    $0x240,%esp
+  char path[] = "stressfs0";
+  24:	66 89 8d e6 fd ff ff 	mov    %cx,-0x21a(%ebp)
+  char name[] = "cf0_00";
+  2b:	c7 85 d7 fd ff ff 63 	movl   $0x5f306663,-0x229(%ebp)
+  32:	66 30 5f 
+  char path[] = "stressfs0";
+  35:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+  3c:	74 72 65 
+  3f:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+  46:	73 66 73 
+  char name[] = "cf0_00";
+  49:	c7 85 da fd ff ff 5f 	movl   $0x30305f,-0x226(%ebp)
+  50:	30 30 00 
+  printf(1, "stressfs starting\n");
+  53:	68 48 09 00 00       	push   $0x948
+  58:	6a 01                	push   $0x1
+  5a:	e8 c1 05 00 00       	call   620 <printf>
+  memset(data, 'a', sizeof(data));
+  5f:	83 c4 0c             	add    $0xc,%esp
+  62:	68 00 02 00 00       	push   $0x200
+  67:	6a 61                	push   $0x61
+  69:	56                   	push   %esi
+  6a:	e8 81 02 00 00       	call   2f0 <memset>
+  6f:	83 c4 10             	add    $0x10,%esp
+    if(fork() > 0)
+  72:	e8 f4 03 00 00       	call   46b <fork>
+  77:	85 c0                	test   %eax,%eax
+  79:	7f 08                	jg     83 <main+0x83>
+  for(i = 0; i < 4; i++)
+  7b:	83 c3 01             	add    $0x1,%ebx
+  7e:	83 fb 04             	cmp    $0x4,%ebx
+  81:	75 ef                	jne    72 <main+0x72>
+      break;
+
+  printf(1, "write %d\n", i);
+  83:	83 ec 04             	sub    $0x4,%esp
+  86:	53                   	push   %ebx
+  87:	68 5b 09 00 00       	push   $0x95b
+  8c:	6a 01                	push   $0x1
+  8e:	e8 8d 05 00 00       	call   620 <printf>
+
+  path[8] += i;
+  93:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  99:	58                   	pop    %eax
+  9a:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  a0:	5a                   	pop    %edx
+  a1:	68 02 02 00 00       	push   $0x202
+  a6:	bb 14 00 00 00       	mov    $0x14,%ebx
+  ab:	50                   	push   %eax
+  ac:	e8 02 04 00 00       	call   4b3 <open>
+  b1:	83 c4 10             	add    $0x10,%esp
+  b4:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+  b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bd:	8d 76 00             	lea    0x0(%esi),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  c0:	83 ec 04             	sub    $0x4,%esp
+  c3:	68 00 02 00 00       	push   $0x200
+  c8:	56                   	push   %esi
+  c9:	57                   	push   %edi
+  ca:	e8 c4 03 00 00       	call   493 <write>
+  for(i = 0; i < 20; i++)
+  cf:	83 c4 10             	add    $0x10,%esp
+  d2:	83 eb 01             	sub    $0x1,%ebx
+  d5:	75 e9                	jne    c0 <main+0xc0>
+  close(fd);
+  d7:	83 ec 0c             	sub    $0xc,%esp
+  da:	57                   	push   %edi
+  db:	e8 bb 03 00 00       	call   49b <close>
+
+  printf(1, "read\n");
+  e0:	5a                   	pop    %edx
+  e1:	59                   	pop    %ecx
+  e2:	68 65 09 00 00       	push   $0x965
+  e7:	6a 01                	push   $0x1
+  e9:	e8 32 05 00 00       	call   620 <printf>
+
+  fd = open(path, O_RDONLY);
+  ee:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  f4:	5b                   	pop    %ebx
+  f5:	5f                   	pop    %edi
+  f6:	6a 00                	push   $0x0
+  f8:	bb 14 00 00 00       	mov    $0x14,%ebx
+  fd:	50                   	push   %eax
+  fe:	e8 b0 03 00 00       	call   4b3 <open>
+ 103:	83 c4 10             	add    $0x10,%esp
+ 106:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+ 108:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+    read(fd, data, sizeof(data));
+ 110:	83 ec 04             	sub    $0x4,%esp
+ 113:	68 00 02 00 00       	push   $0x200
+ 118:	56                   	push   %esi
+ 119:	57                   	push   %edi
+ 11a:	e8 6c 03 00 00       	call   48b <read>
+  for (i = 0; i < 20; i++)
+ 11f:	83 c4 10             	add    $0x10,%esp
+ 122:	83 eb 01             	sub    $0x1,%ebx
+ 125:	75 e9                	jne    110 <main+0x110>
+  close(fd);
+ 127:	83 ec 0c             	sub    $0xc,%esp
+ 12a:	8d 9d d7 fd ff ff    	lea    -0x229(%ebp),%ebx
+
+  name[2] = path[8];
+  start = uptime();
+  for(i = 0; i < NCREATE; i++){
+    j = i % 100;
+    name[4] = '0' + j / 10;
+ 130:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+  close(fd);
+ 135:	57                   	push   %edi
+  for(i = 0; i < NCREATE; i++){
+ 136:	31 ff                	xor    %edi,%edi
+  close(fd);
+ 138:	e8 5e 03 00 00       	call   49b <close>
+  name[2] = path[8];
+ 13d:	0f b6 85 e6 fd ff ff 	movzbl -0x21a(%ebp),%eax
+ 144:	88 85 d9 fd ff ff    	mov    %al,-0x227(%ebp)
+  start = uptime();
+ 14a:	e8 bc 03 00 00       	call   50b <uptime>
+ 14f:	83 c4 10             	add    $0x10,%esp
+ 152:	89 85 c4 fd ff ff    	mov    %eax,-0x23c(%ebp)
+  for(i = 0; i < NCREATE; i++){
+ 158:	eb 22                	jmp    17c <main+0x17c>
+ 15a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE | O_RDWR);
+    if(fd < 0){
+      printf(1, "stressfs: create %s failed\n", name);
+      break;
+    }
+    close(fd);
+ 160:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NCREATE; i++){
+ 163:	83 c7 01             	add    $0x1,%edi
+    close(fd);
+ 166:	50                   	push   %eax
+ 167:	e8 2f 03 00 00       	call   49b <close>
+    unlink(name);
+ 16c:	89 1c 24             	mov    %ebx,(%esp)
+ 16f:	e8 4f 03 00 00       	call   4c3 <unlink>
+  for(i = 0; i < NCREATE; i++){
+ 174:	83 c4 10             	add    $0x10,%esp
+ 177:	83 ff 64             	cmp    $0x64,%edi
+ 17a:	74 4a                	je     1c6 <main+0x1c6>
+    name[4] = '0' + j / 10;
+ 17c:	89 f8                	mov    %edi,%eax
+    fd = open(name, O_CREATE | O_RDWR);
+ 17e:	83 ec 08             	sub    $0x8,%esp
+    name[4] = '0' + j / 10;
+ 181:	f7 e6                	mul    %esi
+ 183:	c1 ea 03             	shr    $0x3,%edx
+ 186:	8d 42 30             	lea    0x30(%edx),%eax
+    name[5] = '0' + j % 10;
+ 189:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[4] = '0' + j / 10;
+ 18c:	88 85 db fd ff ff    	mov    %al,-0x225(%ebp)
+    name[5] = '0' + j % 10;
+ 192:	01 d2                	add    %edx,%edx
+ 194:	89 f8                	mov    %edi,%eax
+ 196:	29 d0                	sub    %edx,%eax
+ 198:	83 c0 30             	add    $0x30,%eax
+ 19b:	88 85 dc fd ff ff    	mov    %al,-0x224(%ebp)
+    fd = open(name, O_CREATE | O_RDWR);
+ 1a1:	68 02 02 00 00       	push   $0x202
+ 1a6:	53                   	push   %ebx
+ 1a7:	e8 07 03 00 00       	call   4b3 <open>
+    if(fd < 0){
+ 1ac:	83 c4 10             	add    $0x10,%esp
+ 1af:	85 c0                	test   %eax,%eax
+ 1b1:	79 ad                	jns    160 <main+0x160>
+      printf(1, "stressfs: create %s failed\n", name);
+ 1b3:	83 ec 04             	sub    $0x4,%esp
+ 1b6:	53                   	push   %ebx
+ 1b7:	68 6b 09 00 00       	push   $0x96b
+ 1bc:	6a 01                	push   $0x1
+ 1be:	e8 5d 04 00 00       	call   620 <printf>
+      break;
+ 1c3:	83 c4 10             	add    $0x10,%esp
+  }
+  elapsed = uptime() - start;
+ 1c6:	e8 40 03 00 00       	call   50b <uptime>
+ 1cb:	8b 8d c4 fd ff ff    	mov    -0x23c(%ebp),%ecx
+  printf(1, "%s: %d creates in %d ticks", path, i, elapsed);
+ 1d1:	83 ec 0c             	sub    $0xc,%esp
+  elapsed = uptime() - start;
+ 1d4:	29 c8                	sub    %ecx,%eax
+  printf(1, "%s: %d creates in %d ticks", path, i, elapsed);
+ 1d6:	50                   	push   %eax
+  elapsed = uptime() - start;
+ 1d7:	89 c3                	mov    %eax,%ebx
+  printf(1, "%s: %d creates in %d ticks", path, i, elapsed);
+ 1d9:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+ 1df:	57                   	push   %edi
+ 1e0:	50                   	push   %eax
+ 1e1:	68 87 09 00 00       	push   $0x987
+ 1e6:	6a 01                	push   $0x1
+ 1e8:	e8 33 04 00 00       	call   620 <printf>
+  if(elapsed > 0)
+ 1ed:	83 c4 20             	add    $0x20,%esp
+ 1f0:	85 db                	test   %ebx,%ebx
+ 1f2:	75 19                	jne    20d <main+0x20d>
+    printf(1, " (%d creates/100 ticks)", i * 100 / elapsed);
+  printf(1, "\n");
+ 1f4:	83 ec 08             	sub    $0x8,%esp
+ 1f7:	68 63 09 00 00       	push   $0x963
+ 1fc:	6a 01                	push   $0x1
+ 1fe:	e8 1d 04 00 00       	call   620 <printf>
+
+  wait();
+ 203:	e8 73 02 00 00       	call   47b <wait>
+
+  exit();
+ 208:	e8 66 02 00 00       	call   473 <exit>
+    printf(1, " (%d creates/100 ticks)", i * 100 / elapsed);
+ 20d:	50                   	push   %eax
+ 20e:	6b c7 64             	imul   $0x64,%edi,%eax
+ 211:	31 d2                	xor    %edx,%edx
+ 213:	f7 f3                	div    %ebx
+ 215:	50                   	push   %eax
+ 216:	68 a2 09 00 00       	push   $0x9a2
+ 21b:	6a 01                	push   $0x1
+ 21d:	e8 fe 03 00 00       	call   620 <printf>
+ 222:	83 c4 10             	add    $0x10,%esp
+ 225:	eb cd                	jmp    1f4 <main+0x1f4>
+ 227:	66 90                	xchg   %ax,%ax
+ 229:	66 90                	xchg   %ax,%ax
+ 22b:	66 90                	xchg   %ax,%ax
+ 22d:	66 90                	xchg   %ax,%ax
+ 22f:	90                   	nop
+
+00000230 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 230:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 231:	31 c0                	xor    %eax,%eax
+{
+ 233:	89 e5                	mov    %esp,%ebp
+ 235:	53                   	push   %ebx
+ 236:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 239:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 240:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 244:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 247:	83 c0 01             	add    $0x1,%eax
+ 24a:	84 d2                	test   %dl,%dl
+ 24c:	75 f2                	jne    240 <strcpy+0x10>
+    ;
+  return os;
+}
+ 24e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 251:	89 c8                	mov    %ecx,%eax
+ 253:	c9                   	leave
+ 254:	c3                   	ret
+ 255:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	53                   	push   %ebx
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+ 267:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 26a:	0f b6 02             	movzbl (%edx),%eax
+ 26d:	84 c0                	test   %al,%al
+ 26f:	75 17                	jne    288 <strcmp+0x28>
+ 271:	eb 3a                	jmp    2ad <strcmp+0x4d>
+ 273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 277:	90                   	nop
+ 278:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 27c:	83 c2 01             	add    $0x1,%edx
+ 27f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 282:	84 c0                	test   %al,%al
+ 284:	74 1a                	je     2a0 <strcmp+0x40>
+    p++, q++;
+ 286:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 288:	0f b6 19             	movzbl (%ecx),%ebx
+ 28b:	38 c3                	cmp    %al,%bl
+ 28d:	74 e9                	je     278 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 28f:	29 d8                	sub    %ebx,%eax
+}
+ 291:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 294:	c9                   	leave
+ 295:	c3                   	ret
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2a4:	31 c0                	xor    %eax,%eax
+ 2a6:	29 d8                	sub    %ebx,%eax
+}
+ 2a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2ab:	c9                   	leave
+ 2ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2ad:	0f b6 19             	movzbl (%ecx),%ebx
+ 2b0:	31 c0                	xor    %eax,%eax
+ 2b2:	eb db                	jmp    28f <strcmp+0x2f>
+ 2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2c6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2c9:	74 15                	je     2e0 <strlen+0x20>
+ 2cb:	31 c0                	xor    %eax,%eax
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 2d0:	83 c0 01             	add    $0x1,%eax
+ 2d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2d7:	89 c1                	mov    %eax,%ecx
+ 2d9:	75 f5                	jne    2d0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2db:	89 c8                	mov    %ecx,%eax
+ 2dd:	5d                   	pop    %ebp
+ 2de:	c3                   	ret
+ 2df:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2e0:	31 c9                	xor    %ecx,%ecx
+}
+ 2e2:	5d                   	pop    %ebp
+ 2e3:	89 c8                	mov    %ecx,%eax
+ 2e5:	c3                   	ret
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2fd:	89 d7                	mov    %edx,%edi
+ 2ff:	fc                   	cld
+ 300:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 302:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 305:	89 d0                	mov    %edx,%eax
+ 307:	c9                   	leave
+ 308:	c3                   	ret
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	8b 45 08             	mov    0x8(%ebp),%eax
+ 316:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 31a:	0f b6 10             	movzbl (%eax),%edx
+ 31d:	84 d2                	test   %dl,%dl
+ 31f:	75 12                	jne    333 <strchr+0x23>
+ 321:	eb 1d                	jmp    340 <strchr+0x30>
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+ 328:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 32c:	83 c0 01             	add    $0x1,%eax
+ 32f:	84 d2                	test   %dl,%dl
+ 331:	74 0d                	je     340 <strchr+0x30>
+    if(*s == c)
+ 333:	38 d1                	cmp    %dl,%cl
+ 335:	75 f1                	jne    328 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 337:	5d                   	pop    %ebp
+ 338:	c3                   	ret
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 340:	31 c0                	xor    %eax,%eax
+}
+ 342:	5d                   	pop    %ebp
+ 343:	c3                   	ret
+ 344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 355:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 358:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 359:	31 db                	xor    %ebx,%ebx
+{
+ 35b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 35e:	eb 27                	jmp    387 <gets+0x37>
+    cc = read(0, &c, 1);
+ 360:	83 ec 04             	sub    $0x4,%esp
+ 363:	6a 01                	push   $0x1
+ 365:	56                   	push   %esi
+ 366:	6a 00                	push   $0x0
+ 368:	e8 1e 01 00 00       	call   48b <read>
+    if(cc < 1)
+ 36d:	83 c4 10             	add    $0x10,%esp
+ 370:	85 c0                	test   %eax,%eax
+ 372:	7e 1d                	jle    391 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 374:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 378:	8b 55 08             	mov    0x8(%ebp),%edx
+ 37b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 37f:	3c 0a                	cmp    $0xa,%al
+ 381:	74 10                	je     393 <gets+0x43>
+ 383:	3c 0d                	cmp    $0xd,%al
+ 385:	74 0c                	je     393 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 387:	89 df                	mov    %ebx,%edi
+ 389:	83 c3 01             	add    $0x1,%ebx
+ 38c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 38f:	7c cf                	jl     360 <gets+0x10>
+ 391:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 393:	8b 45 08             	mov    0x8(%ebp),%eax
+ 396:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 39a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 39d:	5b                   	pop    %ebx
+ 39e:	5e                   	pop    %esi
+ 39f:	5f                   	pop    %edi
+ 3a0:	5d                   	pop    %ebp
+ 3a1:	c3                   	ret
+ 3a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	56                   	push   %esi
+ 3b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3b5:	83 ec 08             	sub    $0x8,%esp
+ 3b8:	6a 00                	push   $0x0
+ 3ba:	ff 75 08             	push   0x8(%ebp)
+ 3bd:	e8 f1 00 00 00       	call   4b3 <open>
+  if(fd < 0)
+ 3c2:	83 c4 10             	add    $0x10,%esp
+ 3c5:	85 c0                	test   %eax,%eax
+ 3c7:	78 27                	js     3f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3c9:	83 ec 08             	sub    $0x8,%esp
+ 3cc:	ff 75 0c             	push   0xc(%ebp)
+ 3cf:	89 c3                	mov    %eax,%ebx
+ 3d1:	50                   	push   %eax
+ 3d2:	e8 f4 00 00 00       	call   4cb <fstat>
+  close(fd);
+ 3d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3dc:	e8 ba 00 00 00       	call   49b <close>
+  return r;
+ 3e1:	83 c4 10             	add    $0x10,%esp
+}
+ 3e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3e7:	89 f0                	mov    %esi,%eax
+ 3e9:	5b                   	pop    %ebx
+ 3ea:	5e                   	pop    %esi
+ 3eb:	5d                   	pop    %ebp
+ 3ec:	c3                   	ret
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3f5:	eb ed                	jmp    3e4 <stat+0x34>
+ 3f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fe:	66 90                	xchg   %ax,%ax
+
+00000400 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	53                   	push   %ebx
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 407:	0f be 02             	movsbl (%edx),%eax
+ 40a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 40d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 410:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 415:	77 1e                	ja     435 <atoi+0x35>
+ 417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 420:	83 c2 01             	add    $0x1,%edx
+ 423:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 426:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 42a:	0f be 02             	movsbl (%edx),%eax
+ 42d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 430:	80 fb 09             	cmp    $0x9,%bl
+ 433:	76 eb                	jbe    420 <atoi+0x20>
+  return n;
+}
+ 435:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 438:	89 c8                	mov    %ecx,%eax
+ 43a:	c9                   	leave
+ 43b:	c3                   	ret
+ 43c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	8b 45 10             	mov    0x10(%ebp),%eax
+ 448:	8b 55 08             	mov    0x8(%ebp),%edx
+ 44b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 44e:	85 c0                	test   %eax,%eax
+ 450:	7e 13                	jle    465 <memmove+0x25>
+ 452:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 454:	89 d7                	mov    %edx,%edi
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 460:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 461:	39 f8                	cmp    %edi,%eax
+ 463:	75 fb                	jne    460 <memmove+0x20>
+  return vdst;
+}
+ 465:	5e                   	pop    %esi
+ 466:	89 d0                	mov    %edx,%eax
+ 468:	5f                   	pop    %edi
+ 469:	5d                   	pop    %ebp
+ 46a:	c3                   	ret
+
+0000046b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 46b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <exit>:
+SYSCALL(exit)
+ 473:	b8 02 00 00 00       	mov    $0x2,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <wait>:
+SYSCALL(wait)
+ 47b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <pipe>:
+SYSCALL(pipe)
+ 483:	b8 04 00 00 00       	mov    $0x4,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <read>:
+SYSCALL(read)
+ 48b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <write>:
+SYSCALL(write)
+ 493:	b8 10 00 00 00       	mov    $0x10,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <close>:
+SYSCALL(close)
+ 49b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <kill>:
+SYSCALL(kill)
+ 4a3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <exec>:
+SYSCALL(exec)
+ 4ab:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <open>:
+SYSCALL(open)
+ 4b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <mknod>:
+SYSCALL(mknod)
+ 4bb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <unlink>:
+SYSCALL(unlink)
+ 4c3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <fstat>:
+SYSCALL(fstat)
+ 4cb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <link>:
+SYSCALL(link)
+ 4d3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <mkdir>:
+SYSCALL(mkdir)
+ 4db:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <chdir>:
+SYSCALL(chdir)
+ 4e3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <dup>:
+SYSCALL(dup)
+ 4eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <getpid>:
+SYSCALL(getpid)
+ 4f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <sbrk>:
+SYSCALL(sbrk)
+ 4fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <sleep>:
+SYSCALL(sleep)
+ 503:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <uptime>:
+SYSCALL(uptime)
+ 50b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <trace>:
+SYSCALL(trace)
+ 513:	b8 16 00 00 00       	mov    $0x16,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <csinfo>:
+SYSCALL(csinfo)
+ 51b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <settickets>:
+SYSCALL(settickets)
+ 523:	b8 18 00 00 00       	mov    $0x18,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <getprocessesinfo>:
+SYSCALL(getprocessesinfo)
+ 52b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <yield>:
+SYSCALL(yield)
+ 533:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <random>:
+SYSCALL(random)
+ 53b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <dumppagetable>:
+SYSCALL(dumppagetable)
+ 543:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <getcpusinfo>:
+SYSCALL(getcpusinfo)
+ 54b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <setsched>:
+SYSCALL(setsched)
+ 553:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <getbcacheinfo>:
+SYSCALL(getbcacheinfo)
+ 55b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <getballocinfo>:
+SYSCALL(getballocinfo)
+ 563:	b8 20 00 00 00       	mov    $0x20,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <getfaultinfo>:
+SYSCALL(getfaultinfo)
+ 56b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+ 573:	66 90                	xchg   %ax,%ax
+ 575:	66 90                	xchg   %ax,%ax
+ 577:	66 90                	xchg   %ax,%ax
+ 579:	66 90                	xchg   %ax,%ax
+ 57b:	66 90                	xchg   %ax,%ax
+ 57d:	66 90                	xchg   %ax,%ax
+ 57f:	90                   	nop
+
+00000580 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	53                   	push   %ebx
+ 586:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 588:	89 d1                	mov    %edx,%ecx
+{
+ 58a:	83 ec 3c             	sub    $0x3c,%esp
+ 58d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 590:	85 d2                	test   %edx,%edx
+ 592:	0f 89 80 00 00 00    	jns    618 <printint+0x98>
+ 598:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 59c:	74 7a                	je     618 <printint+0x98>
+    x = -xx;
+ 59e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5a8:	31 f6                	xor    %esi,%esi
+ 5aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5b0:	89 c8                	mov    %ecx,%eax
+ 5b2:	31 d2                	xor    %edx,%edx
+ 5b4:	89 f7                	mov    %esi,%edi
+ 5b6:	f7 f3                	div    %ebx
+ 5b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5bb:	0f b6 92 1c 0a 00 00 	movzbl 0xa1c(%edx),%edx
+ 5c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5c6:	89 ca                	mov    %ecx,%edx
+ 5c8:	89 c1                	mov    %eax,%ecx
+ 5ca:	39 da                	cmp    %ebx,%edx
+ 5cc:	73 e2                	jae    5b0 <printint+0x30>
+  if(neg)
+ 5ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5d1:	85 c0                	test   %eax,%eax
+ 5d3:	74 07                	je     5dc <printint+0x5c>
+    buf[i++] = '-';
+ 5d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5da:	89 f7                	mov    %esi,%edi
+ 5dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5e2:	01 df                	add    %ebx,%edi
+ 5e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5eb:	83 ec 04             	sub    $0x4,%esp
+ 5ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5f4:	6a 01                	push   $0x1
+ 5f6:	50                   	push   %eax
+ 5f7:	56                   	push   %esi
+ 5f8:	e8 96 fe ff ff       	call   493 <write>
+  while(--i >= 0)
+ 5fd:	89 f8                	mov    %edi,%eax
+ 5ff:	83 c4 10             	add    $0x10,%esp
+ 602:	83 ef 01             	sub    $0x1,%edi
+ 605:	39 d8                	cmp    %ebx,%eax
+ 607:	75 df                	jne    5e8 <printint+0x68>
+}
+ 609:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 60c:	5b                   	pop    %ebx
+ 60d:	5e                   	pop    %esi
+ 60e:	5f                   	pop    %edi
+ 60f:	5d                   	pop    %ebp
+ 610:	c3                   	ret
+ 611:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 618:	31 c0                	xor    %eax,%eax
+ 61a:	eb 89                	jmp    5a5 <printint+0x25>
+ 61c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	56                   	push   %esi
+ 625:	53                   	push   %ebx
+ 626:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 629:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 62c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 62f:	0f b6 1e             	movzbl (%esi),%ebx
+ 632:	83 c6 01             	add    $0x1,%esi
+ 635:	84 db                	test   %bl,%bl
+ 637:	74 67                	je     6a0 <printf+0x80>
+ 639:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 63c:	31 d2                	xor    %edx,%edx
+ 63e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 641:	eb 34                	jmp    677 <printf+0x57>
+ 643:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 647:	90                   	nop
+ 648:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 64b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 650:	83 f8 25             	cmp    $0x25,%eax
+ 653:	74 18                	je     66d <printf+0x4d>
+  write(fd, &c, 1);
+ 655:	83 ec 04             	sub    $0x4,%esp
+ 658:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 65b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 65e:	6a 01                	push   $0x1
+ 660:	50                   	push   %eax
+ 661:	57                   	push   %edi
+ 662:	e8 2c fe ff ff       	call   493 <write>
+ 667:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 66a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 66d:	0f b6 1e             	movzbl (%esi),%ebx
+ 670:	83 c6 01             	add    $0x1,%esi
+ 673:	84 db                	test   %bl,%bl
+ 675:	74 29                	je     6a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 677:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 67a:	85 d2                	test   %edx,%edx
+ 67c:	74 ca                	je     648 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 67e:	83 fa 25             	cmp    $0x25,%edx
+ 681:	75 ea                	jne    66d <printf+0x4d>
+      if(c == 'd'){
+ 683:	83 f8 25             	cmp    $0x25,%eax
+ 686:	0f 84 24 01 00 00    	je     7b0 <printf+0x190>
+ 68c:	83 e8 63             	sub    $0x63,%eax
+ 68f:	83 f8 15             	cmp    $0x15,%eax
+ 692:	77 1c                	ja     6b0 <printf+0x90>
+ 694:	ff 24 85 c4 09 00 00 	jmp    *0x9c4(,%eax,4)
+ 69b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 69f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6a3:	5b                   	pop    %ebx
+ 6a4:	5e                   	pop    %esi
+ 6a5:	5f                   	pop    %edi
+ 6a6:	5d                   	pop    %ebp
+ 6a7:	c3                   	ret
+ 6a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6af:	90                   	nop
+  write(fd, &c, 1);
+ 6b0:	83 ec 04             	sub    $0x4,%esp
+ 6b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ba:	6a 01                	push   $0x1
+ 6bc:	52                   	push   %edx
+ 6bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6c0:	57                   	push   %edi
+ 6c1:	e8 cd fd ff ff       	call   493 <write>
+ 6c6:	83 c4 0c             	add    $0xc,%esp
+ 6c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6cc:	6a 01                	push   $0x1
+ 6ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6d1:	52                   	push   %edx
+ 6d2:	57                   	push   %edi
+ 6d3:	e8 bb fd ff ff       	call   493 <write>
+        putc(fd, c);
+ 6d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6db:	31 d2                	xor    %edx,%edx
+ 6dd:	eb 8e                	jmp    66d <printf+0x4d>
+ 6df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6e3:	83 ec 0c             	sub    $0xc,%esp
+ 6e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6eb:	8b 13                	mov    (%ebx),%edx
+ 6ed:	6a 00                	push   $0x0
+ 6ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6f4:	e8 87 fe ff ff       	call   580 <printint>
+        ap++;
+ 6f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ff:	31 d2                	xor    %edx,%edx
+ 701:	e9 67 ff ff ff       	jmp    66d <printf+0x4d>
+ 706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 710:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 713:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 715:	83 c0 04             	add    $0x4,%eax
+ 718:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 71b:	85 db                	test   %ebx,%ebx
+ 71d:	0f 84 9d 00 00 00    	je     7c0 <printf+0x1a0>
+        while(*s != 0){
+ 723:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 726:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 728:	84 c0                	test   %al,%al
+ 72a:	0f 84 3d ff ff ff    	je     66d <printf+0x4d>
+ 730:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 733:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 736:	89 de                	mov    %ebx,%esi
+ 738:	89 d3                	mov    %edx,%ebx
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 746:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 749:	6a 01                	push   $0x1
+ 74b:	53                   	push   %ebx
+ 74c:	57                   	push   %edi
+ 74d:	e8 41 fd ff ff       	call   493 <write>
+        while(*s != 0){
+ 752:	0f b6 06             	movzbl (%esi),%eax
+ 755:	83 c4 10             	add    $0x10,%esp
+ 758:	84 c0                	test   %al,%al
+ 75a:	75 e4                	jne    740 <printf+0x120>
+      state = 0;
+ 75c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 75f:	31 d2                	xor    %edx,%edx
+ 761:	e9 07 ff ff ff       	jmp    66d <printf+0x4d>
+ 766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 770:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 773:	83 ec 0c             	sub    $0xc,%esp
+ 776:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 77b:	8b 13                	mov    (%ebx),%edx
+ 77d:	6a 01                	push   $0x1
+ 77f:	e9 6b ff ff ff       	jmp    6ef <printf+0xcf>
+ 784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 788:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 78b:	83 ec 04             	sub    $0x4,%esp
+ 78e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 791:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 793:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 796:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 799:	6a 01                	push   $0x1
+ 79b:	52                   	push   %edx
+ 79c:	57                   	push   %edi
+ 79d:	e8 f1 fc ff ff       	call   493 <write>
+        ap++;
+ 7a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7a8:	31 d2                	xor    %edx,%edx
+ 7aa:	e9 be fe ff ff       	jmp    66d <printf+0x4d>
+ 7af:	90                   	nop
+  write(fd, &c, 1);
+ 7b0:	83 ec 04             	sub    $0x4,%esp
+ 7b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7b9:	6a 01                	push   $0x1
+ 7bb:	e9 11 ff ff ff       	jmp    6d1 <printf+0xb1>
+ 7c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7c5:	bb ba 09 00 00       	mov    $0x9ba,%ebx
+ 7ca:	e9 61 ff ff ff       	jmp    730 <printf+0x110>
+ 7cf:	90                   	nop
+
+000007d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7d1:	a1 c8 0c 00 00       	mov    0xcc8,%eax
+{
+ 7d6:	89 e5                	mov    %esp,%ebp
+ 7d8:	57                   	push   %edi
+ 7d9:	56                   	push   %esi
+ 7da:	53                   	push   %ebx
+ 7db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7ec:	39 ca                	cmp    %ecx,%edx
+ 7ee:	73 30                	jae    820 <free+0x50>
+ 7f0:	39 c1                	cmp    %eax,%ecx
+ 7f2:	72 04                	jb     7f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7f4:	39 c2                	cmp    %eax,%edx
+ 7f6:	72 f0                	jb     7e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7fe:	39 f8                	cmp    %edi,%eax
+ 800:	74 2e                	je     830 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 802:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 805:	8b 42 04             	mov    0x4(%edx),%eax
+ 808:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 80b:	39 f1                	cmp    %esi,%ecx
+ 80d:	74 38                	je     847 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 80f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 811:	5b                   	pop    %ebx
+  freep = p;
+ 812:	89 15 c8 0c 00 00    	mov    %edx,0xcc8
+}
+ 818:	5e                   	pop    %esi
+ 819:	5f                   	pop    %edi
+ 81a:	5d                   	pop    %ebp
+ 81b:	c3                   	ret
+ 81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 820:	39 c1                	cmp    %eax,%ecx
+ 822:	72 d0                	jb     7f4 <free+0x24>
+ 824:	eb c2                	jmp    7e8 <free+0x18>
+ 826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 830:	03 70 04             	add    0x4(%eax),%esi
+ 833:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 836:	8b 02                	mov    (%edx),%eax
+ 838:	8b 00                	mov    (%eax),%eax
+ 83a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 83d:	8b 42 04             	mov    0x4(%edx),%eax
+ 840:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 843:	39 f1                	cmp    %esi,%ecx
+ 845:	75 c8                	jne    80f <free+0x3f>
+    p->s.size += bp->s.size;
+ 847:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 84a:	89 15 c8 0c 00 00    	mov    %edx,0xcc8
+    p->s.size += bp->s.size;
+ 850:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 853:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 856:	89 0a                	mov    %ecx,(%edx)
+}
+ 858:	5b                   	pop    %ebx
+ 859:	5e                   	pop    %esi
+ 85a:	5f                   	pop    %edi
+ 85b:	5d                   	pop    %ebp
+ 85c:	c3                   	ret
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000860 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 860:	55                   	push   %ebp
+ 861:	89 e5                	mov    %esp,%ebp
+ 863:	57                   	push   %edi
+ 864:	56                   	push   %esi
+ 865:	53                   	push   %ebx
+ 866:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 869:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 86c:	8b 15 c8 0c 00 00    	mov    0xcc8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 872:	8d 78 07             	lea    0x7(%eax),%edi
+ 875:	c1 ef 03             	shr    $0x3,%edi
+ 878:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 87b:	85 d2                	test   %edx,%edx
+ 87d:	0f 84 8d 00 00 00    	je     910 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 883:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 885:	8b 48 04             	mov    0x4(%eax),%ecx
+ 888:	39 f9                	cmp    %edi,%ecx
+ 88a:	73 64                	jae    8f0 <malloc+0x90>
+  if(nu < 4096)
+ 88c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 891:	39 df                	cmp    %ebx,%edi
+ 893:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 896:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 89d:	eb 0a                	jmp    8a9 <malloc+0x49>
+ 89f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8a2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8a5:	39 f9                	cmp    %edi,%ecx
+ 8a7:	73 47                	jae    8f0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8a9:	89 c2                	mov    %eax,%edx
+ 8ab:	39 05 c8 0c 00 00    	cmp    %eax,0xcc8
+ 8b1:	75 ed                	jne    8a0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8b3:	83 ec 0c             	sub    $0xc,%esp
+ 8b6:	56                   	push   %esi
+ 8b7:	e8 3f fc ff ff       	call   4fb <sbrk>
+  if(p == (char*)-1)
+ 8bc:	83 c4 10             	add    $0x10,%esp
+ 8bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8c2:	74 1c                	je     8e0 <malloc+0x80>
+  hp->s.size = nu;
+ 8c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8c7:	83 ec 0c             	sub    $0xc,%esp
+ 8ca:	83 c0 08             	add    $0x8,%eax
+ 8cd:	50                   	push   %eax
+ 8ce:	e8 fd fe ff ff       	call   7d0 <free>
+  return freep;
+ 8d3:	8b 15 c8 0c 00 00    	mov    0xcc8,%edx
+      if((p = morecore(nunits)) == 0)
+ 8d9:	83 c4 10             	add    $0x10,%esp
+ 8dc:	85 d2                	test   %edx,%edx
+ 8de:	75 c0                	jne    8a0 <malloc+0x40>
+        return 0;
+  }
+}
+ 8e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8e3:	31 c0                	xor    %eax,%eax
+}
+ 8e5:	5b                   	pop    %ebx
+ 8e6:	5e                   	pop    %esi
+ 8e7:	5f                   	pop    %edi
+ 8e8:	5d                   	pop    %ebp
+ 8e9:	c3                   	ret
+ 8ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8f0:	39 cf                	cmp    %ecx,%edi
+ 8f2:	74 4c                	je     940 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8f4:	29 f9                	sub    %edi,%ecx
+ 8f6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8f9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8fc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8ff:	89 15 c8 0c 00 00    	mov    %edx,0xcc8
+}
+ 905:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 908:	83 c0 08             	add    $0x8,%eax
+}
+ 90b:	5b                   	pop    %ebx
+ 90c:	5e                   	pop    %esi
+ 90d:	5f                   	pop    %edi
+ 90e:	5d                   	pop    %ebp
+ 90f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 910:	c7 05 c8 0c 00 00 cc 	movl   $0xccc,0xcc8
+ 917:	0c 00 00 
+    base.s.size = 0;
+ 91a:	b8 cc 0c 00 00       	mov    $0xccc,%eax
+    base.s.ptr = freep = prevp = &base;
+ 91f:	c7 05 cc 0c 00 00 cc 	movl   $0xccc,0xccc
+ 926:	0c 00 00 
+    base.s.size = 0;
+ 929:	c7 05 d0 0c 00 00 00 	movl   $0x0,0xcd0
+ 930:	00 00 00 
+    if(p->s.size >= nunits){
+ 933:	e9 54 ff ff ff       	jmp    88c <malloc+0x2c>
+ 938:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 940:	8b 08                	mov    (%eax),%ecx
+ 942:	89 0a                	mov    %ecx,(%edx)
+ 944:	eb b9                	jmp    8ff <malloc+0x9f>
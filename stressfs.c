@@ -1,5 +1,8 @@
 // Demonstrate that moving the "acquire" in iderw after the loop that
 // appends to the idequeue results in a race.
+//
+// Also times NCREATE file creates (and unlinks) in each of the
+// five processes, to compare logging schemes on several CPUs.
 
 // For this to work, you should also add a spin within iderw's
 // idequeue traversal loop.  Adding the following demonstrated a panic
@@ -13,11 +16,15 @@
 #include "fs.h"
 #include "fcntl.h"
 
+#define NCREATE 100
+
 int
 main(int argc, char *argv[])
 {
-  int fd, i;
+  int fd, i, j;
+  uint start, elapsed;
   char path[] = "stressfs0";
+  char name[] = "cf0_00";
   char data[512];
 
   printf(1, "stressfs starting\n");
@@ -43,6 +50,26 @@ main(int argc, char *argv[])
     read(fd, data, sizeof(data));
   close(fd);
 
+  name[2] = path[8];
+  start = uptime();
+  for(i = 0; i < NCREATE; i++){
+    j = i % 100;
+    name[4] = '0' + j / 10;
+    name[5] = '0' + j % 10;
+    fd = open(name, O_CREATE | O_RDWR);
+    if(fd < 0){
+      printf(1, "stressfs: create %s failed\n", name);
+      break;
+    }
+    close(fd);
+    unlink(name);
+  }
+  elapsed = uptime() - start;
+  printf(1, "%s: %d creates in %d ticks", path, i, elapsed);
+  if(elapsed > 0)
+    printf(1, " (%d creates/100 ticks)", i * 100 / elapsed);
+  printf(1, "\n");
+
   wait();
 
   exit();
@@ -3,6 +3,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
@@ -13,12 +14,19 @@
 // library system call function. The saved user %esp points
 // to a saved program counter, and then the first argument.
 
+// The kernel reads and writes user memory directly, so the
+// functions below fault in the pages they hand out (see
+// prefault()) and fail if that fails, rather than leave the
+// fault to happen later in the kernel, maybe holding locks.
+
 // Fetch the int at addr from the current process.
 int
 fetchint(uint addr, int *ip)
 {
   if(addr >= proc->sz || addr+4 > proc->sz)
     return -1;
+  if(prefault(proc, addr, 4, 0) < 0)
+    return -1;
   *ip = *(int*)(addr);
   return 0;
 }
@@ -35,9 +43,13 @@ fetchstr(uint addr, char **pp)
     return -1;
   *pp = (char*)addr;
   ep = (char*)proc->sz;
-  for(s = *pp; s < ep; s++)
+  for(s = *pp; s < ep; s++){
+    if((s == *pp || (uint)s % PGSIZE == 0) &&
+       prefault(proc, (uint)s, 1, 0) < 0)
+      return -1;
     if(*s == 0)
       return s - *pp;
+  }
   return -1;
 }
 
@@ -48,11 +60,8 @@ argint(int n, int *ip)
   return fetchint(proc->tf->esp + 4 + 4*n, ip);
 }
 
-// Fetch the nth word-sized system call argument as a pointer
-// to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
-int
-argptr(int n, char **pp, int size)
+static int
+argbuf(int n, char **pp, int size, int write)
 {
   int i;
 
@@ -60,10 +69,30 @@ argptr(int n, char **pp, int size)
     return -1;
   if(size < 0 || (uint)i >= proc->sz || (uint)i+size > proc->sz)
     return -1;
+  if(prefault(proc, i, size, write) < 0)
+    return -1;
   *pp = (char*)i;
   return 0;
 }
 
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+  return argbuf(n, pp, size, 0);
+}
+
+// Like argptr(), for a block the system call will write: its
+// pages are faulted in writable, so shared or zero pages are
+// copied now rather than by a fault in the kernel.
+int
+argout(int n, char **pp, int size)
+{
+  return argbuf(n, pp, size, 1);
+}
+
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
 // (There is no shared writable memory, so the string can't change
@@ -105,6 +134,11 @@ extern int sys_getprocessesinfo(void);
 extern int sys_yield(void);
 extern int sys_random(void);
 extern int sys_dumppagetable(void);
+extern int sys_getcpusinfo(void);
+extern int sys_setsched(void);
+extern int sys_getbcacheinfo(void);
+extern int sys_getballocinfo(void);
+extern int sys_getfaultinfo(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -135,6 +169,11 @@ static int (*syscalls[])(void) = {
 [SYS_yield]   sys_yield,
 [SYS_random]  sys_random,
 [SYS_dumppagetable]  sys_dumppagetable,
+[SYS_getcpusinfo]  sys_getcpusinfo,
+[SYS_setsched]  sys_setsched,
+[SYS_getbcacheinfo]  sys_getbcacheinfo,
+[SYS_getballocinfo]  sys_getballocinfo,
+[SYS_getfaultinfo]  sys_getfaultinfo,
 };
 
 static char* syscallnames[] = {
@@ -166,6 +205,11 @@ static char* syscallnames[] = {
 [SYS_yield]   "yield",
 [SYS_random]  "random",
 [SYS_dumppagetable]  "dumppagetable",
+[SYS_getcpusinfo]  "getcpusinfo",
+[SYS_setsched]  "setsched",
+[SYS_getbcacheinfo]  "getbcacheinfo",
+[SYS_getballocinfo]  "getballocinfo",
+[SYS_getfaultinfo]  "getfaultinfo",
 };
 
 
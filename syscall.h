@@ -27,3 +27,8 @@
 #define SYS_yield 26
 #define SYS_random 27
 #define SYS_dumppagetable 28
+#define SYS_getcpusinfo 29
+#define SYS_setsched 30
+#define SYS_getbcacheinfo 31
+#define SYS_getballocinfo 32
+#define SYS_getfaultinfo 33
@@ -9,12 +9,13 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "fs.h"
-#include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "buf.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -72,7 +73,7 @@ sys_read(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argout(1, &p, n) < 0)
     return -1;
   return fileread(f, p, n);
 }
@@ -108,7 +109,7 @@ sys_fstat(void)
   struct file *f;
   struct stat *st;
 
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argfd(0, 0, &f) < 0 || argout(1, (void*)&st, sizeof(*st)) < 0)
     return -1;
   return filestat(f, st);
 }
@@ -217,6 +218,7 @@ sys_unlink(void)
   memset(&de, 0, sizeof(de));
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("unlink: writei");
+  dcacheput(dp->dev, dp->inum, name, 0, 0);
   if(ip->type == T_DIR){
     dp->nlink--;
     iupdate(dp);
@@ -425,7 +427,7 @@ sys_pipe(void)
   struct file *rf, *wf;
   int fd0, fd1;
 
-  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+  if(argout(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
     return -1;
   if(pipealloc(&rf, &wf) < 0)
     return -1;
@@ -441,3 +443,25 @@ sys_pipe(void)
   fd[1] = fd1;
   return 0;
 }
+
+int
+sys_getbcacheinfo(void)
+{
+  struct bcache_info *bi;
+
+  if(argout(0, (void*)&bi, sizeof(*bi)) < 0)
+    return -1;
+  bcacheinfo(bi);
+  return 0;
+}
+
+int
+sys_getballocinfo(void)
+{
+  struct balloc_info *bi;
+
+  if(argout(0, (void*)&bi, sizeof(*bi)) < 0)
+    return -1;
+  ballocinfo(ROOTDEV, bi);
+  return 0;
+}
@@ -5,6 +5,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 
 int
@@ -112,15 +113,23 @@ int sys_settickets(void)
 
   if(argint(0, &ticket_count) < 0)
     return -1;
-  proc->ticket_count = ticket_count;
-  return proc->ticket_count;
+  return settickets(ticket_count);
+}
+
+int sys_setsched(void)
+{
+  int policy;
+
+  if(argint(0, &policy) < 0)
+    return -1;
+  return setsched(policy);
 }
 
 int sys_getprocessesinfo(void)
 {
   struct processes_info *pi;
   int i, total_tickets = 0;
-  if (argptr (0 , (void*)&pi ,sizeof(*pi)) < 0)
+  if (argout (0 , (void*)&pi ,sizeof(*pi)) < 0)
     return - 1;
   count_processes(pi);
   for (i = 0; i < pi->num_processes; i++)
@@ -130,6 +139,24 @@ int sys_getprocessesinfo(void)
   return total_tickets;
 }
 
+int sys_getcpusinfo(void)
+{
+  struct cpus_info *ci;
+  if (argout (0 , (void*)&ci ,sizeof(*ci)) < 0)
+    return - 1;
+  count_cpus(ci);
+  return ci->num_cpus;
+}
+
+int sys_getfaultinfo(void)
+{
+  struct fault_info *fi;
+  if (argout (0 , (void*)&fi ,sizeof(*fi)) < 0)
+    return - 1;
+  faultinfo(fi);
+  return 0;
+}
+
 int sys_yield(void)
 {
   yield();
@@ -141,7 +168,7 @@ int sys_random(void)
   static unsigned int z1 = 12345, z2 = 12345, z3 = 12345, z4 = 12345;
   unsigned int b;
   unsigned int * rand;
-  if (argptr (0 , (void*)&rand ,sizeof(*rand)) < 0)
+  if (argout (0 , (void*)&rand ,sizeof(*rand)) < 0)
     return - 1;
   b  = ((z1 << 6) ^ z1) >> 13;
   z1 = ((z1 & 4294967294U) << 18) ^ b;
@@ -166,7 +193,7 @@ int sys_dumppagetable(void)
   for (i = 0; i < ((p->sz)>>12); i++)
   {
       pte_t * pt_entry = walkpgdir(p->pgdir, (void *) (i<<12), 0);
-      if (!(*pt_entry)) continue;
+      if (pt_entry == 0 || !(*pt_entry)) continue;
       cprintf("%x ", i&0xff );
       if (*pt_entry & PTE_P) cprintf("P ");
       else cprintf("- ");
@@ -0,0 +1,1668 @@
+
+_timewithtickets:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+            break;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec 28 07 00 00    	sub    $0x728,%esp
+  17:	8b 01                	mov    (%ecx),%eax
+  19:	8b 51 04             	mov    0x4(%ecx),%edx
+  1c:	89 85 d0 f8 ff ff    	mov    %eax,-0x730(%ebp)
+  22:	89 95 d4 f8 ff ff    	mov    %edx,-0x72c(%ebp)
+    int i;
+    if (argc < 3) {
+  28:	83 f8 02             	cmp    $0x2,%eax
+  2b:	0f 8e 36 02 00 00    	jle    267 <main+0x267>
+                  argv[0]);
+        exit();
+    }
+    int tickets_for[MAX_CHILDREN];
+    int active_pids[MAX_CHILDREN];
+    int num_seconds = atoi(argv[1]);
+  31:	8b 85 d4 f8 ff ff    	mov    -0x72c(%ebp),%eax
+  37:	83 ec 0c             	sub    $0xc,%esp
+  3a:	ff 70 04             	push   0x4(%eax)
+  3d:	e8 4e 06 00 00       	call   690 <atoi>
+    int num_children = argc - 2;
+    if (num_children > MAX_CHILDREN) {
+  42:	83 c4 10             	add    $0x10,%esp
+    int num_seconds = atoi(argv[1]);
+  45:	89 85 cc f8 ff ff    	mov    %eax,-0x734(%ebp)
+    int num_children = argc - 2;
+  4b:	8b 85 d0 f8 ff ff    	mov    -0x730(%ebp),%eax
+  51:	8d 70 fe             	lea    -0x2(%eax),%esi
+    if (num_children > MAX_CHILDREN) {
+  54:	83 fe 20             	cmp    $0x20,%esi
+  57:	0f 8f f6 01 00 00    	jg     253 <main+0x253>
+        printf(2, "only up to %d supported\n", MAX_CHILDREN);
+        exit();
+    }
+    /* give us a lot of ticket so we don't get starved */
+    settickets(LARGE_TICKET_COUNT);
+  5d:	83 ec 0c             	sub    $0xc,%esp
+    for (i = 0; i < num_children; ++i) {
+  60:	31 db                	xor    %ebx,%ebx
+    settickets(LARGE_TICKET_COUNT);
+  62:	68 a0 86 01 00       	push   $0x186a0
+  67:	e8 47 07 00 00       	call   7b3 <settickets>
+  6c:	83 c4 10             	add    $0x10,%esp
+        int tickets = atoi(argv[i + 2]);
+  6f:	8b 85 d4 f8 ff ff    	mov    -0x72c(%ebp),%eax
+  75:	83 ec 0c             	sub    $0xc,%esp
+  78:	ff 74 98 08          	push   0x8(%eax,%ebx,4)
+  7c:	e8 0f 06 00 00       	call   690 <atoi>
+        tickets_for[i] = tickets;
+  81:	89 84 9d e0 f8 ff ff 	mov    %eax,-0x720(%ebp,%ebx,4)
+        int tickets = atoi(argv[i + 2]);
+  88:	89 c7                	mov    %eax,%edi
+    int pid = fork();
+  8a:	e8 6c 06 00 00       	call   6fb <fork>
+    if (pid == 0) {
+  8f:	83 c4 10             	add    $0x10,%esp
+  92:	85 c0                	test   %eax,%eax
+  94:	0f 84 ee 00 00 00    	je     188 <main+0x188>
+    } else if (pid != -1) {
+  9a:	83 f8 ff             	cmp    $0xffffffff,%eax
+  9d:	0f 84 0b 01 00 00    	je     1ae <main+0x1ae>
+        active_pids[i] = spawn(tickets);
+  a3:	89 84 9d 60 f9 ff ff 	mov    %eax,-0x6a0(%ebp,%ebx,4)
+    for (i = 0; i < num_children; ++i) {
+  aa:	83 c3 01             	add    $0x1,%ebx
+  ad:	39 de                	cmp    %ebx,%esi
+  af:	75 be                	jne    6f <main+0x6f>
+    }
+    wait_for_ticket_counts(num_children, active_pids, tickets_for);
+  b1:	50                   	push   %eax
+  b2:	8d 85 e0 f8 ff ff    	lea    -0x720(%ebp),%eax
+  b8:	8d bd 60 f9 ff ff    	lea    -0x6a0(%ebp),%edi
+  be:	50                   	push   %eax
+  bf:	8d 85 60 f9 ff ff    	lea    -0x6a0(%ebp),%eax
+  c5:	50                   	push   %eax
+  c6:	56                   	push   %esi
+  c7:	e8 34 03 00 00       	call   400 <wait_for_ticket_counts>
+    struct processes_info before, after;
+    before.num_processes = after.num_processes = -1;
+    getprocessesinfo(&before);
+  cc:	8d 85 e0 f9 ff ff    	lea    -0x620(%ebp),%eax
+    before.num_processes = after.num_processes = -1;
+  d2:	c7 85 e4 fc ff ff ff 	movl   $0xffffffff,-0x31c(%ebp)
+  d9:	ff ff ff 
+  dc:	c7 85 e0 f9 ff ff ff 	movl   $0xffffffff,-0x620(%ebp)
+  e3:	ff ff ff 
+    getprocessesinfo(&before);
+  e6:	89 04 24             	mov    %eax,(%esp)
+  e9:	e8 cd 06 00 00       	call   7bb <getprocessesinfo>
+    sleep(num_seconds);
+  ee:	5a                   	pop    %edx
+  ef:	ff b5 cc f8 ff ff    	push   -0x734(%ebp)
+  f5:	e8 99 06 00 00       	call   793 <sleep>
+    getprocessesinfo(&after);
+  fa:	8d 85 e4 fc ff ff    	lea    -0x31c(%ebp),%eax
+ 100:	89 04 24             	mov    %eax,(%esp)
+ 103:	e8 b3 06 00 00       	call   7bb <getprocessesinfo>
+    for (i = 0; i < num_children; ++i) {
+ 108:	8b 85 d0 f8 ff ff    	mov    -0x730(%ebp),%eax
+ 10e:	83 c4 10             	add    $0x10,%esp
+ 111:	8d 9c 85 58 f9 ff ff 	lea    -0x6a8(%ebp,%eax,4),%ebx
+ 118:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11f:	90                   	nop
+        kill(active_pids[i]);
+ 120:	83 ec 0c             	sub    $0xc,%esp
+ 123:	ff 37                	push   (%edi)
+    for (i = 0; i < num_children; ++i) {
+ 125:	83 c7 04             	add    $0x4,%edi
+        kill(active_pids[i]);
+ 128:	e8 06 06 00 00       	call   733 <kill>
+    for (i = 0; i < num_children; ++i) {
+ 12d:	83 c4 10             	add    $0x10,%esp
+ 130:	39 df                	cmp    %ebx,%edi
+ 132:	75 ec                	jne    120 <main+0x120>
+    }
+    for (i = 0; i < num_children; ++i) {
+ 134:	31 db                	xor    %ebx,%ebx
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+        wait();
+ 140:	e8 c6 05 00 00       	call   70b <wait>
+    for (i = 0; i < num_children; ++i) {
+ 145:	83 c3 01             	add    $0x1,%ebx
+ 148:	39 de                	cmp    %ebx,%esi
+ 14a:	75 f4                	jne    140 <main+0x140>
+    }
+    if (before.num_processes >= NPROC || after.num_processes >= NPROC) {
+ 14c:	8b 85 e0 f9 ff ff    	mov    -0x620(%ebp),%eax
+ 152:	83 f8 3f             	cmp    $0x3f,%eax
+ 155:	7f 44                	jg     19b <main+0x19b>
+ 157:	8b 95 e4 fc ff ff    	mov    -0x31c(%ebp),%edx
+ 15d:	83 fa 3f             	cmp    $0x3f,%edx
+ 160:	7f 39                	jg     19b <main+0x19b>
+        printf(2, "getprocessesinfo's num_processes is greater than NPROC before parent slept\n");
+        return 1;
+    }
+    if (before.num_processes < 0 || after.num_processes < 0) {
+ 162:	09 d0                	or     %edx,%eax
+ 164:	79 6a                	jns    1d0 <main+0x1d0>
+        printf(2, "getprocessesinfo's num_processes is negative -- not changed by syscall?\n");
+ 166:	50                   	push   %eax
+ 167:	50                   	push   %eax
+ 168:	68 20 0d 00 00       	push   $0xd20
+ 16d:	6a 02                	push   $0x2
+ 16f:	e8 3c 07 00 00       	call   8b0 <printf>
+        return 1;
+ 174:	83 c4 10             	add    $0x10,%esp
+            }
+            printf(1, "%d\t%d\n", tickets_for[i], after.ticks[after_index] - before.ticks[before_index]);
+        }
+    }
+    exit();
+}
+ 177:	8d 65 f0             	lea    -0x10(%ebp),%esp
+ 17a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 17f:	59                   	pop    %ecx
+ 180:	5b                   	pop    %ebx
+ 181:	5e                   	pop    %esi
+ 182:	5f                   	pop    %edi
+ 183:	5d                   	pop    %ebp
+ 184:	8d 61 fc             	lea    -0x4(%ecx),%esp
+ 187:	c3                   	ret
+        settickets(tickets);
+ 188:	83 ec 0c             	sub    $0xc,%esp
+ 18b:	57                   	push   %edi
+ 18c:	e8 22 06 00 00       	call   7b3 <settickets>
+	yield();
+ 191:	e8 2d 06 00 00       	call   7c3 <yield>
+ 196:	83 c4 10             	add    $0x10,%esp
+    while (1) {
+ 199:	eb fe                	jmp    199 <main+0x199>
+        printf(2, "getprocessesinfo's num_processes is greater than NPROC before parent slept\n");
+ 19b:	50                   	push   %eax
+ 19c:	50                   	push   %eax
+ 19d:	68 d4 0c 00 00       	push   $0xcd4
+ 1a2:	6a 02                	push   $0x2
+ 1a4:	e8 07 07 00 00       	call   8b0 <printf>
+        return 1;
+ 1a9:	83 c4 10             	add    $0x10,%esp
+ 1ac:	eb c9                	jmp    177 <main+0x177>
+ 1ae:	89 85 c8 f8 ff ff    	mov    %eax,-0x738(%ebp)
+        printf(2, "error in fork\n");
+ 1b4:	51                   	push   %ecx
+ 1b5:	51                   	push   %ecx
+ 1b6:	68 d8 0b 00 00       	push   $0xbd8
+ 1bb:	6a 02                	push   $0x2
+ 1bd:	e8 ee 06 00 00       	call   8b0 <printf>
+ 1c2:	8b 85 c8 f8 ff ff    	mov    -0x738(%ebp),%eax
+ 1c8:	83 c4 10             	add    $0x10,%esp
+ 1cb:	e9 d3 fe ff ff       	jmp    a3 <main+0xa3>
+    printf(1, "TICKETS\tTICKS\n");
+ 1d0:	50                   	push   %eax
+    for (i = 0; i < num_children; ++i) {
+ 1d1:	31 db                	xor    %ebx,%ebx
+    printf(1, "TICKETS\tTICKS\n");
+ 1d3:	50                   	push   %eax
+ 1d4:	68 00 0c 00 00       	push   $0xc00
+ 1d9:	6a 01                	push   $0x1
+ 1db:	e8 d0 06 00 00       	call   8b0 <printf>
+    for (i = 0; i < num_children; ++i) {
+ 1e0:	89 b5 d4 f8 ff ff    	mov    %esi,-0x72c(%ebp)
+    printf(1, "TICKETS\tTICKS\n");
+ 1e6:	83 c4 10             	add    $0x10,%esp
+        int before_index = find_index_of_pid(before.pids, before.num_processes, active_pids[i]);
+ 1e9:	8b 94 9d 60 f9 ff ff 	mov    -0x6a0(%ebp,%ebx,4),%edx
+ 1f0:	8b 85 e0 f9 ff ff    	mov    -0x620(%ebp),%eax
+    for (i = 0; i < list_size; ++i) {
+ 1f6:	31 ff                	xor    %edi,%edi
+ 1f8:	eb 0c                	jmp    206 <main+0x206>
+        if (list[i] == pid)
+ 1fa:	3b 94 bd e4 f9 ff ff 	cmp    -0x61c(%ebp,%edi,4),%edx
+ 201:	74 0a                	je     20d <main+0x20d>
+    for (i = 0; i < list_size; ++i) {
+ 203:	83 c7 01             	add    $0x1,%edi
+ 206:	39 f8                	cmp    %edi,%eax
+ 208:	7f f0                	jg     1fa <main+0x1fa>
+    return -1;
+ 20a:	83 cf ff             	or     $0xffffffff,%edi
+        int after_index = find_index_of_pid(after.pids, after.num_processes, active_pids[i]);
+ 20d:	8b 8d e4 fc ff ff    	mov    -0x31c(%ebp),%ecx
+    for (i = 0; i < list_size; ++i) {
+ 213:	31 f6                	xor    %esi,%esi
+ 215:	eb 0c                	jmp    223 <main+0x223>
+        if (list[i] == pid)
+ 217:	3b 94 b5 e8 fc ff ff 	cmp    -0x318(%ebp,%esi,4),%edx
+ 21e:	74 5b                	je     27b <main+0x27b>
+    for (i = 0; i < list_size; ++i) {
+ 220:	83 c6 01             	add    $0x1,%esi
+ 223:	39 f1                	cmp    %esi,%ecx
+ 225:	7f f0                	jg     217 <main+0x217>
+        if (before_index == -1)
+ 227:	83 c7 01             	add    $0x1,%edi
+ 22a:	75 11                	jne    23d <main+0x23d>
+            printf(2, "child %d did not exist for getprocessesinfo before parent slept\n", i);
+ 22c:	57                   	push   %edi
+ 22d:	53                   	push   %ebx
+ 22e:	68 ac 0d 00 00       	push   $0xdac
+ 233:	6a 02                	push   $0x2
+ 235:	e8 76 06 00 00       	call   8b0 <printf>
+ 23a:	83 c4 10             	add    $0x10,%esp
+            printf(2, "child %d did not exist for getprocessesinfo after parent slept\n", i);
+ 23d:	50                   	push   %eax
+ 23e:	53                   	push   %ebx
+ 23f:	68 6c 0d 00 00       	push   $0xd6c
+ 244:	6a 02                	push   $0x2
+ 246:	e8 65 06 00 00       	call   8b0 <printf>
+ 24b:	83 c4 10             	add    $0x10,%esp
+ 24e:	e9 c8 00 00 00       	jmp    31b <main+0x31b>
+        printf(2, "only up to %d supported\n", MAX_CHILDREN);
+ 253:	53                   	push   %ebx
+ 254:	6a 20                	push   $0x20
+ 256:	68 e7 0b 00 00       	push   $0xbe7
+ 25b:	6a 02                	push   $0x2
+ 25d:	e8 4e 06 00 00       	call   8b0 <printf>
+        exit();
+ 262:	e8 9c 04 00 00       	call   703 <exit>
+        printf(2, "usage: %s seconds tickets1 tickets2 ... ticketsN\n"
+ 267:	56                   	push   %esi
+ 268:	ff 32                	push   (%edx)
+ 26a:	68 28 0c 00 00       	push   $0xc28
+ 26f:	6a 02                	push   $0x2
+ 271:	e8 3a 06 00 00       	call   8b0 <printf>
+        exit();
+ 276:	e8 88 04 00 00       	call   703 <exit>
+        if (before_index == -1)
+ 27b:	83 ff ff             	cmp    $0xffffffff,%edi
+ 27e:	0f 84 86 00 00 00    	je     30a <main+0x30a>
+            if (before.tickets[before_index] != tickets_for[i]) {
+ 284:	8b 94 9d e0 f8 ff ff 	mov    -0x720(%ebp,%ebx,4),%edx
+ 28b:	39 94 bd e4 fb ff ff 	cmp    %edx,-0x41c(%ebp,%edi,4)
+ 292:	74 1d                	je     2b1 <main+0x2b1>
+ 294:	89 95 d0 f8 ff ff    	mov    %edx,-0x730(%ebp)
+                printf(2, "child %d had wrong number of tickets in getprocessinfo before parent slept\n", i);
+ 29a:	51                   	push   %ecx
+ 29b:	53                   	push   %ebx
+ 29c:	68 f0 0d 00 00       	push   $0xdf0
+ 2a1:	6a 02                	push   $0x2
+ 2a3:	e8 08 06 00 00       	call   8b0 <printf>
+ 2a8:	8b 95 d0 f8 ff ff    	mov    -0x730(%ebp),%edx
+ 2ae:	83 c4 10             	add    $0x10,%esp
+            if (after.tickets[after_index] != tickets_for[i]) {
+ 2b1:	3b 94 b5 e8 fe ff ff 	cmp    -0x118(%ebp,%esi,4),%edx
+ 2b8:	74 1d                	je     2d7 <main+0x2d7>
+ 2ba:	89 95 d0 f8 ff ff    	mov    %edx,-0x730(%ebp)
+                printf(2, "child %d had wrong number of tickets in getprocessinfo after parent slept\n", i);
+ 2c0:	52                   	push   %edx
+ 2c1:	53                   	push   %ebx
+ 2c2:	68 3c 0e 00 00       	push   $0xe3c
+ 2c7:	6a 02                	push   $0x2
+ 2c9:	e8 e2 05 00 00       	call   8b0 <printf>
+ 2ce:	8b 95 d0 f8 ff ff    	mov    -0x730(%ebp),%edx
+ 2d4:	83 c4 10             	add    $0x10,%esp
+            printf(1, "%d\t%d\n", tickets_for[i], after.ticks[after_index] - before.ticks[before_index]);
+ 2d7:	8b 84 b5 e8 fd ff ff 	mov    -0x218(%ebp,%esi,4),%eax
+ 2de:	2b 84 bd e4 fa ff ff 	sub    -0x51c(%ebp,%edi,4),%eax
+ 2e5:	50                   	push   %eax
+ 2e6:	52                   	push   %edx
+ 2e7:	68 1f 0c 00 00       	push   $0xc1f
+ 2ec:	6a 01                	push   $0x1
+ 2ee:	e8 bd 05 00 00       	call   8b0 <printf>
+ 2f3:	83 c4 10             	add    $0x10,%esp
+    for (i = 0; i < num_children; ++i) {
+ 2f6:	83 c3 01             	add    $0x1,%ebx
+ 2f9:	39 9d d4 f8 ff ff    	cmp    %ebx,-0x72c(%ebp)
+ 2ff:	0f 8f e4 fe ff ff    	jg     1e9 <main+0x1e9>
+    exit();
+ 305:	e8 f9 03 00 00       	call   703 <exit>
+            printf(2, "child %d did not exist for getprocessesinfo before parent slept\n", i);
+ 30a:	50                   	push   %eax
+ 30b:	53                   	push   %ebx
+ 30c:	68 ac 0d 00 00       	push   $0xdac
+ 311:	6a 02                	push   $0x2
+ 313:	e8 98 05 00 00       	call   8b0 <printf>
+ 318:	83 c4 10             	add    $0x10,%esp
+            printf(1, "%d\t--unknown--\n", tickets_for[i]);
+ 31b:	56                   	push   %esi
+ 31c:	ff b4 9d e0 f8 ff ff 	push   -0x720(%ebp,%ebx,4)
+ 323:	68 0f 0c 00 00       	push   $0xc0f
+ 328:	6a 01                	push   $0x1
+ 32a:	e8 81 05 00 00       	call   8b0 <printf>
+ 32f:	83 c4 10             	add    $0x10,%esp
+ 332:	eb c2                	jmp    2f6 <main+0x2f6>
+ 334:	66 90                	xchg   %ax,%ax
+ 336:	66 90                	xchg   %ax,%ax
+ 338:	66 90                	xchg   %ax,%ax
+ 33a:	66 90                	xchg   %ax,%ax
+ 33c:	66 90                	xchg   %ax,%ax
+ 33e:	66 90                	xchg   %ax,%ax
+
+00000340 <yield_forever>:
+void yield_forever() {
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	83 ec 08             	sub    $0x8,%esp
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+	yield();
+ 350:	e8 6e 04 00 00       	call   7c3 <yield>
+    while (1) {
+ 355:	eb f9                	jmp    350 <yield_forever+0x10>
+ 357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35e:	66 90                	xchg   %ax,%ax
+
+00000360 <run_forever>:
+    while (1) {
+ 360:	eb fe                	jmp    360 <run_forever>
+ 362:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <spawn>:
+int spawn(int tickets) {
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	83 ec 18             	sub    $0x18,%esp
+    int pid = fork();
+ 376:	e8 80 03 00 00       	call   6fb <fork>
+    if (pid == 0) {
+ 37b:	85 c0                	test   %eax,%eax
+ 37d:	74 07                	je     386 <spawn+0x16>
+    } else if (pid != -1) {
+ 37f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 382:	74 1c                	je     3a0 <spawn+0x30>
+}
+ 384:	c9                   	leave
+ 385:	c3                   	ret
+        settickets(tickets);
+ 386:	83 ec 0c             	sub    $0xc,%esp
+ 389:	ff 75 08             	push   0x8(%ebp)
+ 38c:	e8 22 04 00 00       	call   7b3 <settickets>
+	yield();
+ 391:	e8 2d 04 00 00       	call   7c3 <yield>
+ 396:	83 c4 10             	add    $0x10,%esp
+    while (1) {
+ 399:	eb fe                	jmp    399 <spawn+0x29>
+ 39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+        printf(2, "error in fork\n");
+ 3a0:	83 ec 08             	sub    $0x8,%esp
+ 3a3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 3a6:	68 d8 0b 00 00       	push   $0xbd8
+ 3ab:	6a 02                	push   $0x2
+ 3ad:	e8 fe 04 00 00       	call   8b0 <printf>
+ 3b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3b5:	83 c4 10             	add    $0x10,%esp
+}
+ 3b8:	c9                   	leave
+ 3b9:	c3                   	ret
+ 3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003c0 <find_index_of_pid>:
+int find_index_of_pid(int *list, int list_size, int pid) {
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	53                   	push   %ebx
+ 3c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 3c7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3ca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+    for (i = 0; i < list_size; ++i) {
+ 3cd:	85 d2                	test   %edx,%edx
+ 3cf:	7e 1f                	jle    3f0 <find_index_of_pid+0x30>
+ 3d1:	31 c0                	xor    %eax,%eax
+ 3d3:	eb 0a                	jmp    3df <find_index_of_pid+0x1f>
+ 3d5:	8d 76 00             	lea    0x0(%esi),%esi
+ 3d8:	83 c0 01             	add    $0x1,%eax
+ 3db:	39 c2                	cmp    %eax,%edx
+ 3dd:	74 11                	je     3f0 <find_index_of_pid+0x30>
+        if (list[i] == pid)
+ 3df:	39 1c 81             	cmp    %ebx,(%ecx,%eax,4)
+ 3e2:	75 f4                	jne    3d8 <find_index_of_pid+0x18>
+}
+ 3e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3e7:	c9                   	leave
+ 3e8:	c3                   	ret
+ 3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return -1;
+ 3f3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 3f8:	c9                   	leave
+ 3f9:	c3                   	ret
+ 3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000400 <wait_for_ticket_counts>:
+void wait_for_ticket_counts(int num_children, int *pids, int *tickets) {
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+ 405:	53                   	push   %ebx
+        getprocessesinfo(&info);
+ 406:	8d 9d e4 fc ff ff    	lea    -0x31c(%ebp),%ebx
+void wait_for_ticket_counts(int num_children, int *pids, int *tickets) {
+ 40c:	81 ec 2c 03 00 00    	sub    $0x32c,%esp
+	yield();
+ 412:	e8 ac 03 00 00       	call   7c3 <yield>
+        getprocessesinfo(&info);
+ 417:	83 ec 0c             	sub    $0xc,%esp
+ 41a:	53                   	push   %ebx
+ 41b:	e8 9b 03 00 00       	call   7bb <getprocessesinfo>
+        for (i = 0; i < num_children; ++i) {
+ 420:	8b 45 08             	mov    0x8(%ebp),%eax
+ 423:	83 c4 10             	add    $0x10,%esp
+ 426:	85 c0                	test   %eax,%eax
+ 428:	0f 8e 89 00 00 00    	jle    4b7 <wait_for_ticket_counts+0xb7>
+ 42e:	c7 85 d4 fc ff ff 64 	movl   $0x64,-0x32c(%ebp)
+ 435:	00 00 00 
+ 438:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43f:	90                   	nop
+            int index = find_index_of_pid(info.pids, info.num_processes, pids[i]);
+ 440:	8b 8d e4 fc ff ff    	mov    -0x31c(%ebp),%ecx
+        int done = 1;
+ 446:	bf 01 00 00 00       	mov    $0x1,%edi
+        for (i = 0; i < num_children; ++i) {
+ 44b:	31 f6                	xor    %esi,%esi
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+            int index = find_index_of_pid(info.pids, info.num_processes, pids[i]);
+ 450:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 453:	8b 14 b0             	mov    (%eax,%esi,4),%edx
+    for (i = 0; i < list_size; ++i) {
+ 456:	85 c9                	test   %ecx,%ecx
+ 458:	7e 56                	jle    4b0 <wait_for_ticket_counts+0xb0>
+ 45a:	31 c0                	xor    %eax,%eax
+ 45c:	eb 09                	jmp    467 <wait_for_ticket_counts+0x67>
+ 45e:	66 90                	xchg   %ax,%ax
+ 460:	83 c0 01             	add    $0x1,%eax
+ 463:	39 c1                	cmp    %eax,%ecx
+ 465:	74 49                	je     4b0 <wait_for_ticket_counts+0xb0>
+        if (list[i] == pid)
+ 467:	3b 54 83 04          	cmp    0x4(%ebx,%eax,4),%edx
+ 46b:	75 f3                	jne    460 <wait_for_ticket_counts+0x60>
+            if (info.tickets[index] != tickets[i]) done = 0;
+ 46d:	8b 55 10             	mov    0x10(%ebp),%edx
+ 470:	8b 14 b2             	mov    (%edx,%esi,4),%edx
+ 473:	39 94 85 e8 fe ff ff 	cmp    %edx,-0x118(%ebp,%eax,4)
+ 47a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 47f:	0f 45 f8             	cmovne %eax,%edi
+        for (i = 0; i < num_children; ++i) {
+ 482:	83 c6 01             	add    $0x1,%esi
+ 485:	39 75 08             	cmp    %esi,0x8(%ebp)
+ 488:	75 c6                	jne    450 <wait_for_ticket_counts+0x50>
+        if (done)
+ 48a:	85 ff                	test   %edi,%edi
+ 48c:	75 29                	jne    4b7 <wait_for_ticket_counts+0xb7>
+    for (yield_count = 0; yield_count < MAX_YIELDS_FOR_SETUP; ++yield_count) {
+ 48e:	83 ad d4 fc ff ff 01 	subl   $0x1,-0x32c(%ebp)
+ 495:	74 20                	je     4b7 <wait_for_ticket_counts+0xb7>
+	yield();
+ 497:	e8 27 03 00 00       	call   7c3 <yield>
+        getprocessesinfo(&info);
+ 49c:	83 ec 0c             	sub    $0xc,%esp
+ 49f:	53                   	push   %ebx
+ 4a0:	e8 16 03 00 00       	call   7bb <getprocessesinfo>
+ 4a5:	83 c4 10             	add    $0x10,%esp
+ 4a8:	eb 96                	jmp    440 <wait_for_ticket_counts+0x40>
+ 4aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+ 4b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4b5:	eb b6                	jmp    46d <wait_for_ticket_counts+0x6d>
+}
+ 4b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ba:	5b                   	pop    %ebx
+ 4bb:	5e                   	pop    %esi
+ 4bc:	5f                   	pop    %edi
+ 4bd:	5d                   	pop    %ebp
+ 4be:	c3                   	ret
+ 4bf:	90                   	nop
+
+000004c0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 4c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 4c1:	31 c0                	xor    %eax,%eax
+{
+ 4c3:	89 e5                	mov    %esp,%ebp
+ 4c5:	53                   	push   %ebx
+ 4c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 4c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 4d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 4d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 4d7:	83 c0 01             	add    $0x1,%eax
+ 4da:	84 d2                	test   %dl,%dl
+ 4dc:	75 f2                	jne    4d0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 4de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4e1:	89 c8                	mov    %ecx,%eax
+ 4e3:	c9                   	leave
+ 4e4:	c3                   	ret
+ 4e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	53                   	push   %ebx
+ 4f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 4fa:	0f b6 02             	movzbl (%edx),%eax
+ 4fd:	84 c0                	test   %al,%al
+ 4ff:	75 17                	jne    518 <strcmp+0x28>
+ 501:	eb 3a                	jmp    53d <strcmp+0x4d>
+ 503:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 507:	90                   	nop
+ 508:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 50c:	83 c2 01             	add    $0x1,%edx
+ 50f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 512:	84 c0                	test   %al,%al
+ 514:	74 1a                	je     530 <strcmp+0x40>
+    p++, q++;
+ 516:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 518:	0f b6 19             	movzbl (%ecx),%ebx
+ 51b:	38 c3                	cmp    %al,%bl
+ 51d:	74 e9                	je     508 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 51f:	29 d8                	sub    %ebx,%eax
+}
+ 521:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 524:	c9                   	leave
+ 525:	c3                   	ret
+ 526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 530:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 534:	31 c0                	xor    %eax,%eax
+ 536:	29 d8                	sub    %ebx,%eax
+}
+ 538:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 53b:	c9                   	leave
+ 53c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 53d:	0f b6 19             	movzbl (%ecx),%ebx
+ 540:	31 c0                	xor    %eax,%eax
+ 542:	eb db                	jmp    51f <strcmp+0x2f>
+ 544:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 54f:	90                   	nop
+
+00000550 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 556:	80 3a 00             	cmpb   $0x0,(%edx)
+ 559:	74 15                	je     570 <strlen+0x20>
+ 55b:	31 c0                	xor    %eax,%eax
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+ 560:	83 c0 01             	add    $0x1,%eax
+ 563:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 567:	89 c1                	mov    %eax,%ecx
+ 569:	75 f5                	jne    560 <strlen+0x10>
+    ;
+  return n;
+}
+ 56b:	89 c8                	mov    %ecx,%eax
+ 56d:	5d                   	pop    %ebp
+ 56e:	c3                   	ret
+ 56f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 570:	31 c9                	xor    %ecx,%ecx
+}
+ 572:	5d                   	pop    %ebp
+ 573:	89 c8                	mov    %ecx,%eax
+ 575:	c3                   	ret
+ 576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000580 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 587:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 58a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 58d:	89 d7                	mov    %edx,%edi
+ 58f:	fc                   	cld
+ 590:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 592:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 595:	89 d0                	mov    %edx,%eax
+ 597:	c9                   	leave
+ 598:	c3                   	ret
+ 599:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 5aa:	0f b6 10             	movzbl (%eax),%edx
+ 5ad:	84 d2                	test   %dl,%dl
+ 5af:	75 12                	jne    5c3 <strchr+0x23>
+ 5b1:	eb 1d                	jmp    5d0 <strchr+0x30>
+ 5b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5b7:	90                   	nop
+ 5b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 5bc:	83 c0 01             	add    $0x1,%eax
+ 5bf:	84 d2                	test   %dl,%dl
+ 5c1:	74 0d                	je     5d0 <strchr+0x30>
+    if(*s == c)
+ 5c3:	38 d1                	cmp    %dl,%cl
+ 5c5:	75 f1                	jne    5b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 5c7:	5d                   	pop    %ebp
+ 5c8:	c3                   	ret
+ 5c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 5d0:	31 c0                	xor    %eax,%eax
+}
+ 5d2:	5d                   	pop    %ebp
+ 5d3:	c3                   	ret
+ 5d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5df:	90                   	nop
+
+000005e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	57                   	push   %edi
+ 5e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 5e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 5e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 5e9:	31 db                	xor    %ebx,%ebx
+{
+ 5eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 5ee:	eb 27                	jmp    617 <gets+0x37>
+    cc = read(0, &c, 1);
+ 5f0:	83 ec 04             	sub    $0x4,%esp
+ 5f3:	6a 01                	push   $0x1
+ 5f5:	56                   	push   %esi
+ 5f6:	6a 00                	push   $0x0
+ 5f8:	e8 1e 01 00 00       	call   71b <read>
+    if(cc < 1)
+ 5fd:	83 c4 10             	add    $0x10,%esp
+ 600:	85 c0                	test   %eax,%eax
+ 602:	7e 1d                	jle    621 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 604:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 608:	8b 55 08             	mov    0x8(%ebp),%edx
+ 60b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 60f:	3c 0a                	cmp    $0xa,%al
+ 611:	74 10                	je     623 <gets+0x43>
+ 613:	3c 0d                	cmp    $0xd,%al
+ 615:	74 0c                	je     623 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 617:	89 df                	mov    %ebx,%edi
+ 619:	83 c3 01             	add    $0x1,%ebx
+ 61c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 61f:	7c cf                	jl     5f0 <gets+0x10>
+ 621:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 623:	8b 45 08             	mov    0x8(%ebp),%eax
+ 626:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 62a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 62d:	5b                   	pop    %ebx
+ 62e:	5e                   	pop    %esi
+ 62f:	5f                   	pop    %edi
+ 630:	5d                   	pop    %ebp
+ 631:	c3                   	ret
+ 632:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 639:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000640 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	56                   	push   %esi
+ 644:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 645:	83 ec 08             	sub    $0x8,%esp
+ 648:	6a 00                	push   $0x0
+ 64a:	ff 75 08             	push   0x8(%ebp)
+ 64d:	e8 f1 00 00 00       	call   743 <open>
+  if(fd < 0)
+ 652:	83 c4 10             	add    $0x10,%esp
+ 655:	85 c0                	test   %eax,%eax
+ 657:	78 27                	js     680 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 659:	83 ec 08             	sub    $0x8,%esp
+ 65c:	ff 75 0c             	push   0xc(%ebp)
+ 65f:	89 c3                	mov    %eax,%ebx
+ 661:	50                   	push   %eax
+ 662:	e8 f4 00 00 00       	call   75b <fstat>
+  close(fd);
+ 667:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 66a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 66c:	e8 ba 00 00 00       	call   72b <close>
+  return r;
+ 671:	83 c4 10             	add    $0x10,%esp
+}
+ 674:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 677:	89 f0                	mov    %esi,%eax
+ 679:	5b                   	pop    %ebx
+ 67a:	5e                   	pop    %esi
+ 67b:	5d                   	pop    %ebp
+ 67c:	c3                   	ret
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 680:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 685:	eb ed                	jmp    674 <stat+0x34>
+ 687:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68e:	66 90                	xchg   %ax,%ax
+
+00000690 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	53                   	push   %ebx
+ 694:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 697:	0f be 02             	movsbl (%edx),%eax
+ 69a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 69d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 6a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 6a5:	77 1e                	ja     6c5 <atoi+0x35>
+ 6a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 6b0:	83 c2 01             	add    $0x1,%edx
+ 6b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 6b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 6ba:	0f be 02             	movsbl (%edx),%eax
+ 6bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 6c0:	80 fb 09             	cmp    $0x9,%bl
+ 6c3:	76 eb                	jbe    6b0 <atoi+0x20>
+  return n;
+}
+ 6c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6c8:	89 c8                	mov    %ecx,%eax
+ 6ca:	c9                   	leave
+ 6cb:	c3                   	ret
+ 6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006d0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 6d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 6de:	85 c0                	test   %eax,%eax
+ 6e0:	7e 13                	jle    6f5 <memmove+0x25>
+ 6e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 6e4:	89 d7                	mov    %edx,%edi
+ 6e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 6f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 6f1:	39 f8                	cmp    %edi,%eax
+ 6f3:	75 fb                	jne    6f0 <memmove+0x20>
+  return vdst;
+}
+ 6f5:	5e                   	pop    %esi
+ 6f6:	89 d0                	mov    %edx,%eax
+ 6f8:	5f                   	pop    %edi
+ 6f9:	5d                   	pop    %ebp
+ 6fa:	c3                   	ret
+
+000006fb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 6fb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <exit>:
+SYSCALL(exit)
+ 703:	b8 02 00 00 00       	mov    $0x2,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <wait>:
+SYSCALL(wait)
+ 70b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <pipe>:
+SYSCALL(pipe)
+ 713:	b8 04 00 00 00       	mov    $0x4,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <read>:
+SYSCALL(read)
+ 71b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <write>:
+SYSCALL(write)
+ 723:	b8 10 00 00 00       	mov    $0x10,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <close>:
+SYSCALL(close)
+ 72b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <kill>:
+SYSCALL(kill)
+ 733:	b8 06 00 00 00       	mov    $0x6,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <exec>:
+SYSCALL(exec)
+ 73b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <open>:
+SYSCALL(open)
+ 743:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <mknod>:
+SYSCALL(mknod)
+ 74b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <unlink>:
+SYSCALL(unlink)
+ 753:	b8 12 00 00 00       	mov    $0x12,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <fstat>:
+SYSCALL(fstat)
+ 75b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <link>:
+SYSCALL(link)
+ 763:	b8 13 00 00 00       	mov    $0x13,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <mkdir>:
+SYSCALL(mkdir)
+ 76b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <chdir>:
+SYSCALL(chdir)
+ 773:	b8 09 00 00 00       	mov    $0x9,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <dup>:
+SYSCALL(dup)
+ 77b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <getpid>:
+SYSCALL(getpid)
+ 783:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <sbrk>:
+SYSCALL(sbrk)
+ 78b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <sleep>:
+SYSCALL(sleep)
+ 793:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <uptime>:
+SYSCALL(uptime)
+ 79b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <trace>:
+SYSCALL(trace)
+ 7a3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <csinfo>:
+SYSCALL(csinfo)
+ 7ab:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <settickets>:
+SYSCALL(settickets)
+ 7b3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <getprocessesinfo>:
+SYSCALL(getprocessesinfo)
+ 7bb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <yield>:
+SYSCALL(yield)
+ 7c3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <random>:
+SYSCALL(random)
+ 7cb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <dumppagetable>:
+SYSCALL(dumppagetable)
+ 7d3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <getcpusinfo>:
+SYSCALL(getcpusinfo)
+ 7db:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <setsched>:
+SYSCALL(setsched)
+ 7e3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <getbcacheinfo>:
+SYSCALL(getbcacheinfo)
+ 7eb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <getballocinfo>:
+SYSCALL(getballocinfo)
+ 7f3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <getfaultinfo>:
+SYSCALL(getfaultinfo)
+ 7fb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+ 803:	66 90                	xchg   %ax,%ax
+ 805:	66 90                	xchg   %ax,%ax
+ 807:	66 90                	xchg   %ax,%ax
+ 809:	66 90                	xchg   %ax,%ax
+ 80b:	66 90                	xchg   %ax,%ax
+ 80d:	66 90                	xchg   %ax,%ax
+ 80f:	90                   	nop
+
+00000810 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+ 815:	53                   	push   %ebx
+ 816:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 818:	89 d1                	mov    %edx,%ecx
+{
+ 81a:	83 ec 3c             	sub    $0x3c,%esp
+ 81d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 820:	85 d2                	test   %edx,%edx
+ 822:	0f 89 80 00 00 00    	jns    8a8 <printint+0x98>
+ 828:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 82c:	74 7a                	je     8a8 <printint+0x98>
+    x = -xx;
+ 82e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 830:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 835:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 838:	31 f6                	xor    %esi,%esi
+ 83a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 840:	89 c8                	mov    %ecx,%eax
+ 842:	31 d2                	xor    %edx,%edx
+ 844:	89 f7                	mov    %esi,%edi
+ 846:	f7 f3                	div    %ebx
+ 848:	8d 76 01             	lea    0x1(%esi),%esi
+ 84b:	0f b6 92 e8 0e 00 00 	movzbl 0xee8(%edx),%edx
+ 852:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 856:	89 ca                	mov    %ecx,%edx
+ 858:	89 c1                	mov    %eax,%ecx
+ 85a:	39 da                	cmp    %ebx,%edx
+ 85c:	73 e2                	jae    840 <printint+0x30>
+  if(neg)
+ 85e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 861:	85 c0                	test   %eax,%eax
+ 863:	74 07                	je     86c <printint+0x5c>
+    buf[i++] = '-';
+ 865:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 86a:	89 f7                	mov    %esi,%edi
+ 86c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 86f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 872:	01 df                	add    %ebx,%edi
+ 874:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 878:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 87b:	83 ec 04             	sub    $0x4,%esp
+ 87e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 881:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 884:	6a 01                	push   $0x1
+ 886:	50                   	push   %eax
+ 887:	56                   	push   %esi
+ 888:	e8 96 fe ff ff       	call   723 <write>
+  while(--i >= 0)
+ 88d:	89 f8                	mov    %edi,%eax
+ 88f:	83 c4 10             	add    $0x10,%esp
+ 892:	83 ef 01             	sub    $0x1,%edi
+ 895:	39 d8                	cmp    %ebx,%eax
+ 897:	75 df                	jne    878 <printint+0x68>
+}
+ 899:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 89c:	5b                   	pop    %ebx
+ 89d:	5e                   	pop    %esi
+ 89e:	5f                   	pop    %edi
+ 89f:	5d                   	pop    %ebp
+ 8a0:	c3                   	ret
+ 8a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 8a8:	31 c0                	xor    %eax,%eax
+ 8aa:	eb 89                	jmp    835 <printint+0x25>
+ 8ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	56                   	push   %esi
+ 8b5:	53                   	push   %ebx
+ 8b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 8b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 8bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 8bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 8c2:	83 c6 01             	add    $0x1,%esi
+ 8c5:	84 db                	test   %bl,%bl
+ 8c7:	74 67                	je     930 <printf+0x80>
+ 8c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 8cc:	31 d2                	xor    %edx,%edx
+ 8ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8d1:	eb 34                	jmp    907 <printf+0x57>
+ 8d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8d7:	90                   	nop
+ 8d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8e0:	83 f8 25             	cmp    $0x25,%eax
+ 8e3:	74 18                	je     8fd <printf+0x4d>
+  write(fd, &c, 1);
+ 8e5:	83 ec 04             	sub    $0x4,%esp
+ 8e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8ee:	6a 01                	push   $0x1
+ 8f0:	50                   	push   %eax
+ 8f1:	57                   	push   %edi
+ 8f2:	e8 2c fe ff ff       	call   723 <write>
+ 8f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 8fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 8fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 900:	83 c6 01             	add    $0x1,%esi
+ 903:	84 db                	test   %bl,%bl
+ 905:	74 29                	je     930 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 907:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 90a:	85 d2                	test   %edx,%edx
+ 90c:	74 ca                	je     8d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 90e:	83 fa 25             	cmp    $0x25,%edx
+ 911:	75 ea                	jne    8fd <printf+0x4d>
+      if(c == 'd'){
+ 913:	83 f8 25             	cmp    $0x25,%eax
+ 916:	0f 84 24 01 00 00    	je     a40 <printf+0x190>
+ 91c:	83 e8 63             	sub    $0x63,%eax
+ 91f:	83 f8 15             	cmp    $0x15,%eax
+ 922:	77 1c                	ja     940 <printf+0x90>
+ 924:	ff 24 85 90 0e 00 00 	jmp    *0xe90(,%eax,4)
+ 92b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 92f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 930:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 933:	5b                   	pop    %ebx
+ 934:	5e                   	pop    %esi
+ 935:	5f                   	pop    %edi
+ 936:	5d                   	pop    %ebp
+ 937:	c3                   	ret
+ 938:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+  write(fd, &c, 1);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 946:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 94a:	6a 01                	push   $0x1
+ 94c:	52                   	push   %edx
+ 94d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 950:	57                   	push   %edi
+ 951:	e8 cd fd ff ff       	call   723 <write>
+ 956:	83 c4 0c             	add    $0xc,%esp
+ 959:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 95c:	6a 01                	push   $0x1
+ 95e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 961:	52                   	push   %edx
+ 962:	57                   	push   %edi
+ 963:	e8 bb fd ff ff       	call   723 <write>
+        putc(fd, c);
+ 968:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 96b:	31 d2                	xor    %edx,%edx
+ 96d:	eb 8e                	jmp    8fd <printf+0x4d>
+ 96f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 970:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 973:	83 ec 0c             	sub    $0xc,%esp
+ 976:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 97b:	8b 13                	mov    (%ebx),%edx
+ 97d:	6a 00                	push   $0x0
+ 97f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 981:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 984:	e8 87 fe ff ff       	call   810 <printint>
+        ap++;
+ 989:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 98c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 98f:	31 d2                	xor    %edx,%edx
+ 991:	e9 67 ff ff ff       	jmp    8fd <printf+0x4d>
+ 996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 9a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 9a5:	83 c0 04             	add    $0x4,%eax
+ 9a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 9ab:	85 db                	test   %ebx,%ebx
+ 9ad:	0f 84 9d 00 00 00    	je     a50 <printf+0x1a0>
+        while(*s != 0){
+ 9b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 9b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 9b8:	84 c0                	test   %al,%al
+ 9ba:	0f 84 3d ff ff ff    	je     8fd <printf+0x4d>
+ 9c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 9c6:	89 de                	mov    %ebx,%esi
+ 9c8:	89 d3                	mov    %edx,%ebx
+ 9ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9d0:	83 ec 04             	sub    $0x4,%esp
+ 9d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9d9:	6a 01                	push   $0x1
+ 9db:	53                   	push   %ebx
+ 9dc:	57                   	push   %edi
+ 9dd:	e8 41 fd ff ff       	call   723 <write>
+        while(*s != 0){
+ 9e2:	0f b6 06             	movzbl (%esi),%eax
+ 9e5:	83 c4 10             	add    $0x10,%esp
+ 9e8:	84 c0                	test   %al,%al
+ 9ea:	75 e4                	jne    9d0 <printf+0x120>
+      state = 0;
+ 9ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9ef:	31 d2                	xor    %edx,%edx
+ 9f1:	e9 07 ff ff ff       	jmp    8fd <printf+0x4d>
+ 9f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a00:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a03:	83 ec 0c             	sub    $0xc,%esp
+ a06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a0b:	8b 13                	mov    (%ebx),%edx
+ a0d:	6a 01                	push   $0x1
+ a0f:	e9 6b ff ff ff       	jmp    97f <printf+0xcf>
+ a14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a18:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a1b:	83 ec 04             	sub    $0x4,%esp
+ a1e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a21:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a23:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a26:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a29:	6a 01                	push   $0x1
+ a2b:	52                   	push   %edx
+ a2c:	57                   	push   %edi
+ a2d:	e8 f1 fc ff ff       	call   723 <write>
+        ap++;
+ a32:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a35:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a38:	31 d2                	xor    %edx,%edx
+ a3a:	e9 be fe ff ff       	jmp    8fd <printf+0x4d>
+ a3f:	90                   	nop
+  write(fd, &c, 1);
+ a40:	83 ec 04             	sub    $0x4,%esp
+ a43:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a46:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a49:	6a 01                	push   $0x1
+ a4b:	e9 11 ff ff ff       	jmp    961 <printf+0xb1>
+ a50:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a55:	bb 87 0e 00 00       	mov    $0xe87,%ebx
+ a5a:	e9 61 ff ff ff       	jmp    9c0 <printf+0x110>
+ a5f:	90                   	nop
+
+00000a60 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a60:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a61:	a1 58 12 00 00       	mov    0x1258,%eax
+{
+ a66:	89 e5                	mov    %esp,%ebp
+ a68:	57                   	push   %edi
+ a69:	56                   	push   %esi
+ a6a:	53                   	push   %ebx
+ a6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a6e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a78:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a7a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a7c:	39 ca                	cmp    %ecx,%edx
+ a7e:	73 30                	jae    ab0 <free+0x50>
+ a80:	39 c1                	cmp    %eax,%ecx
+ a82:	72 04                	jb     a88 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a84:	39 c2                	cmp    %eax,%edx
+ a86:	72 f0                	jb     a78 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a88:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a8b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a8e:	39 f8                	cmp    %edi,%eax
+ a90:	74 2e                	je     ac0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a92:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a95:	8b 42 04             	mov    0x4(%edx),%eax
+ a98:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a9b:	39 f1                	cmp    %esi,%ecx
+ a9d:	74 38                	je     ad7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a9f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ aa1:	5b                   	pop    %ebx
+  freep = p;
+ aa2:	89 15 58 12 00 00    	mov    %edx,0x1258
+}
+ aa8:	5e                   	pop    %esi
+ aa9:	5f                   	pop    %edi
+ aaa:	5d                   	pop    %ebp
+ aab:	c3                   	ret
+ aac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ab0:	39 c1                	cmp    %eax,%ecx
+ ab2:	72 d0                	jb     a84 <free+0x24>
+ ab4:	eb c2                	jmp    a78 <free+0x18>
+ ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ac0:	03 70 04             	add    0x4(%eax),%esi
+ ac3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ac6:	8b 02                	mov    (%edx),%eax
+ ac8:	8b 00                	mov    (%eax),%eax
+ aca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ acd:	8b 42 04             	mov    0x4(%edx),%eax
+ ad0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ad3:	39 f1                	cmp    %esi,%ecx
+ ad5:	75 c8                	jne    a9f <free+0x3f>
+    p->s.size += bp->s.size;
+ ad7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ ada:	89 15 58 12 00 00    	mov    %edx,0x1258
+    p->s.size += bp->s.size;
+ ae0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ae3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ae6:	89 0a                	mov    %ecx,(%edx)
+}
+ ae8:	5b                   	pop    %ebx
+ ae9:	5e                   	pop    %esi
+ aea:	5f                   	pop    %edi
+ aeb:	5d                   	pop    %ebp
+ aec:	c3                   	ret
+ aed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000af0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ af0:	55                   	push   %ebp
+ af1:	89 e5                	mov    %esp,%ebp
+ af3:	57                   	push   %edi
+ af4:	56                   	push   %esi
+ af5:	53                   	push   %ebx
+ af6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ af9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ afc:	8b 15 58 12 00 00    	mov    0x1258,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b02:	8d 78 07             	lea    0x7(%eax),%edi
+ b05:	c1 ef 03             	shr    $0x3,%edi
+ b08:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b0b:	85 d2                	test   %edx,%edx
+ b0d:	0f 84 8d 00 00 00    	je     ba0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b13:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b15:	8b 48 04             	mov    0x4(%eax),%ecx
+ b18:	39 f9                	cmp    %edi,%ecx
+ b1a:	73 64                	jae    b80 <malloc+0x90>
+  if(nu < 4096)
+ b1c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b21:	39 df                	cmp    %ebx,%edi
+ b23:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b26:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b2d:	eb 0a                	jmp    b39 <malloc+0x49>
+ b2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b30:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b32:	8b 48 04             	mov    0x4(%eax),%ecx
+ b35:	39 f9                	cmp    %edi,%ecx
+ b37:	73 47                	jae    b80 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b39:	89 c2                	mov    %eax,%edx
+ b3b:	39 05 58 12 00 00    	cmp    %eax,0x1258
+ b41:	75 ed                	jne    b30 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b43:	83 ec 0c             	sub    $0xc,%esp
+ b46:	56                   	push   %esi
+ b47:	e8 3f fc ff ff       	call   78b <sbrk>
+  if(p == (char*)-1)
+ b4c:	83 c4 10             	add    $0x10,%esp
+ b4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b52:	74 1c                	je     b70 <malloc+0x80>
+  hp->s.size = nu;
+ b54:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ b57:	83 ec 0c             	sub    $0xc,%esp
+ b5a:	83 c0 08             	add    $0x8,%eax
+ b5d:	50                   	push   %eax
+ b5e:	e8 fd fe ff ff       	call   a60 <free>
+  return freep;
+ b63:	8b 15 58 12 00 00    	mov    0x1258,%edx
+      if((p = morecore(nunits)) == 0)
+ b69:	83 c4 10             	add    $0x10,%esp
+ b6c:	85 d2                	test   %edx,%edx
+ b6e:	75 c0                	jne    b30 <malloc+0x40>
+        return 0;
+  }
+}
+ b70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b73:	31 c0                	xor    %eax,%eax
+}
+ b75:	5b                   	pop    %ebx
+ b76:	5e                   	pop    %esi
+ b77:	5f                   	pop    %edi
+ b78:	5d                   	pop    %ebp
+ b79:	c3                   	ret
+ b7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b80:	39 cf                	cmp    %ecx,%edi
+ b82:	74 4c                	je     bd0 <malloc+0xe0>
+        p->s.size -= nunits;
+ b84:	29 f9                	sub    %edi,%ecx
+ b86:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b89:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b8c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b8f:	89 15 58 12 00 00    	mov    %edx,0x1258
+}
+ b95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b98:	83 c0 08             	add    $0x8,%eax
+}
+ b9b:	5b                   	pop    %ebx
+ b9c:	5e                   	pop    %esi
+ b9d:	5f                   	pop    %edi
+ b9e:	5d                   	pop    %ebp
+ b9f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ba0:	c7 05 58 12 00 00 5c 	movl   $0x125c,0x1258
+ ba7:	12 00 00 
+    base.s.size = 0;
+ baa:	b8 5c 12 00 00       	mov    $0x125c,%eax
+    base.s.ptr = freep = prevp = &base;
+ baf:	c7 05 5c 12 00 00 5c 	movl   $0x125c,0x125c
+ bb6:	12 00 00 
+    base.s.size = 0;
+ bb9:	c7 05 60 12 00 00 00 	movl   $0x0,0x1260
+ bc0:	00 00 00 
+    if(p->s.size >= nunits){
+ bc3:	e9 54 ff ff ff       	jmp    b1c <malloc+0x2c>
+ bc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bcf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ bd0:	8b 08                	mov    (%eax),%ecx
+ bd2:	89 0a                	mov    %ecx,(%edx)
+ bd4:	eb b9                	jmp    b8f <malloc+0x9f>
@@ -3,10 +3,10 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
-#include "spinlock.h"
 
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
@@ -14,110 +14,129 @@ extern uint vectors[];  // in vectors.S: array of 256 entry pointers
 struct spinlock tickslock;
 uint ticks;
 
+// Page fault counters, see getfaultinfo().  Updated with
+// lock-prefixed adds, since faults on different CPUs do not
+// share any lock.
+struct fault_info faults;
+
+// A page of zeros, mapped read-only wherever a process reads a
+// heap, bss or stack page it has never written.  Its first
+// reference, taken in tvinit(), is never dropped, so it always
+// looks shared and the first write to it makes a copy.
+char *zeropage;
+
+// Map a zeroed page at addr, a heap, bss or stack address that
+// has never been touched: the shared zero page if the fault
+// was a read, else a new page.  Returns 1 on success, 0 if out
+// of memory.
 int
-alloc_page(uint addr)
+alloc_page(uint addr, int write)
 {
   char *mem;
   uint a;
 
-  if(addr >= KERNBASE)
-    return 0;
-  if(addr > proc->sz)
-    return 0;
-
   a = PGROUNDDOWN(addr);
-  
-  mem = kalloc();
-  if(mem == 0){
-     cprintf("alloc_page out of memory\n");
-     
-     return 0;
+  if(!write){
+    if(mappages(proc->pgdir, (char*)a, PGSIZE, V2P(zeropage), PTE_U) < 0)
+      return 0;
+    increment_refcount(V2P(zeropage));
+    xadd(&faults.zeroread, 1);
+    return 1;
   }
-  memset(mem, 0, PGSIZE);
+  mem = kalloc_zeroed();
+  if(mem == 0)
+    return 0;
   if(mappages(proc->pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
-      cprintf("alloc_page out of memory (2)\n");
-      //deallocuvm(pgdir, newsz, oldsz);
-      kfree(mem);
-      return 0;
+    kfree(mem);
+    return 0;
   }
+  xadd(&faults.zero, 1);
   return 1;
 }
 
-void copyOnWrite()
-{ 
-
-   uint va = rcr2();       // get va
-
-  //errors taken care of
-  if(proc == 0)     // null process
-  { 
-      cprintf("Error in copyOnWrite: No user process for cr2=0x%x\n", va);
-      panic("PageFault");
-  }
-
-  pte_t *pte;
-
-  pte = walkpgdir(proc->pgdir, (void*)va, 0);
-
-  // page has write perm_S enabled
-  if(PTE_W & *pte)
-  {
-      cprintf("addr 0x%x\n already writeable", va);
-      
-      panic("Error in COW_handle_pgfault: Already writeable");
-  }
-
-  if( pte == 0  || !(*pte) || va >= KERNBASE || !PTE_U || ! PTE_P )
-  { 
-      proc->killed = 1;
-      cprintf("Error in COW_handle_pgfault: Illegal (virtual) addr at address 0x%x, killing proc %s id (pid) %d\n", va, proc->name, proc->pid);
-
-      return;
-  }
-
-  uint pa = PTE_ADDR(*pte);                     
-  uint refcount = get_refcount(pa);                
+// Give proc a writable copy of the shared page at va, whose PTE
+// is pte.  Returns 1 on success, 0 if out of memory.
+int
+copyOnWrite(uint va, pte_t *pte)
+{
+  uint pa = PTE_ADDR(*pte);
+  uint refcount = get_refcount(pa);
 
   if(refcount < 1)
   {
       panic("Error in copyOnWrite: Invalid Reference Count");
   }
 
-  else if(refcount == 1)
+  else if(refcount > 1)
   {
-      *pte = PTE_W | *pte;   
-      lcr3(V2P(proc->pgdir));
-      return;
-  }
 
-  else                      
-  {
+      char* mem = pa == V2P(zeropage) ? kalloc_zeroed() : kalloc();
 
-      char* mem = kalloc();
+      if(mem == 0)
+        return 0;
 
-      if(mem != 0)  
-      {   
+      if(pa != V2P(zeropage))
         memmove(mem, (char*)P2V(pa), PGSIZE);
 
+      // Other sharers may have copied or exited meanwhile; only
+      // switch to the copy if the page is still shared.
+      if(decrement_refcount_if_shared(pa))
+      {
         *pte =  PTE_U | PTE_W | PTE_P | V2P(mem);
 
-        decrement_refcount(pa);
-
-        lcr3(V2P(proc->pgdir));
-        return;
+        invlpg((void*)va);
+        xadd(&faults.copy, 1);
+        return 1;
       }
+      kfree(mem);
+  }
 
-      proc->killed = 1;
+  // Sole owner: just make the page writable again.
+  *pte = PTE_W | *pte;   
+  invlpg((void*)va);
+  xadd(&faults.reuse, 1);
+  return 1;
+}
 
-      cprintf("Error in copyOnWrite: Out of memory, kill proc %s with pid %d\n", proc->name, proc->pid);          
-      return;
+// Handle a fault by the current process on user address va,
+// from user code or from the kernel touching user memory, for
+// writing if write is set.  Pages below proc->sz that were
+// never mapped come from the program file if they hold part of
+// it, and are zero-filled otherwise, with the zero page for a
+// read; writes to shared pages copy them.  Returns 0 if the access can be
+// retried, -1 if va is not a valid address for writing or
+// reading, or memory ran out.
+int
+pagefault(uint va, int write)
+{
+  pte_t *pte;
+  int r;
 
+  if(va >= proc->sz)
+    return -1;
+  pte = walkpgdir(proc->pgdir, (void*)va, 0);
+  if(pte && (*pte & PTE_P)){
+    if(!(*pte & PTE_U))
+      return -1;  // the guard page below the stack
+    if(!write || (*pte & PTE_W))
+      return 0;
+    return copyOnWrite(PGROUNDDOWN(va), pte) ? 0 : -1;
   }
-
-   
-  lcr3(V2P(proc->pgdir));
+  if((r = loadpage(proc, va)) != 0){
+    if(r > 0)
+      xadd(&faults.exec, 1);
+    return r > 0 ? 0 : -1;
+  }
+  return alloc_page(va, write) ? 0 : -1;
 }
 
+// Copy the fault counters to fi.
+void
+faultinfo(struct fault_info *fi)
+{
+  *fi = faults;
+  kzeroinfo(&fi->zpool, &fi->zclear);
+}
 
 void
 tvinit(void)
@@ -129,6 +148,9 @@ tvinit(void)
   SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
 
   initlock(&tickslock, "time");
+
+  if((zeropage = kalloc_zeroed()) == 0)
+    panic("tvinit: zero page");
 }
 
 void
@@ -183,15 +205,13 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
   case T_PGFLT:
-    cprintf("Page fault occurred.\n");
-    cprintf("rcr2 = %d\n", rcr2());
-    pte_t * pt_entry = walkpgdir(proc->pgdir, (void *) PGROUNDDOWN(rcr2()),0);
-    if (pt_entry && !(*pt_entry & PTE_W) && (*pt_entry & PTE_P))
-    {
-	copyOnWrite();
-    }  
-    else if (!alloc_page(rcr2())) panic("trap");
-    break;
+    if(proc && pagefault(rcr2(), tf->err & FEC_WR) == 0)
+      break;
+    xadd(&faults.bad, 1);
+    // fall through: kill the process.  System calls fault in
+    // user memory before they touch it, and fail if that fails
+    // (see argptr() and copyout()), so a kernel fault that
+    // can't be satisfied is a kernel bug, and panics.
 
   //PAGEBREAK: 13
   default:
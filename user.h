@@ -1,6 +1,10 @@
 struct stat;
 struct rtcdate;
 struct processes_info;
+struct cpus_info;
+struct bcache_info;
+struct balloc_info;
+struct fault_info;
 
 // system calls
 int fork(void);
@@ -31,6 +35,11 @@ int getprocessesinfo(struct processes_info *p);
 void yield(void);
 void random(unsigned int * rand);
 int dumppagetable(int pid);
+int getcpusinfo(struct cpus_info *c);
+int setsched(int policy);
+int getbcacheinfo(struct bcache_info *b);
+int getballocinfo(struct balloc_info *b);
+int getfaultinfo(struct fault_info *f);
 
 // ulib.c
 int stat(char*, struct stat*);
@@ -0,0 +1,7240 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  if(argc > 1 && strcmp(argv[1], "-x") == 0)
+      11:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      14:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1 && strcmp(argv[1], "-x") == 0)
+      17:	7e 1a                	jle    33 <main+0x33>
+      19:	52                   	push   %edx
+      1a:	52                   	push   %edx
+      1b:	68 6b 55 00 00       	push   $0x556b
+      20:	ff 70 04             	push   0x4(%eax)
+      23:	e8 e8 3c 00 00       	call   3d10 <strcmp>
+      28:	83 c4 10             	add    $0x10,%esp
+      2b:	85 c0                	test   %eax,%eax
+      2d:	0f 84 09 01 00 00    	je     13c <main+0x13c>
+    exit();  // execbench times exec alone
+  printf(1, "usertests starting\n");
+      33:	83 ec 08             	sub    $0x8,%esp
+      36:	68 6e 55 00 00       	push   $0x556e
+      3b:	6a 01                	push   $0x1
+      3d:	e8 8e 40 00 00       	call   40d0 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      42:	59                   	pop    %ecx
+      43:	58                   	pop    %eax
+      44:	6a 00                	push   $0x0
+      46:	68 82 55 00 00       	push   $0x5582
+      4b:	e8 13 3f 00 00       	call   3f63 <open>
+      50:	83 c4 10             	add    $0x10,%esp
+      53:	85 c0                	test   %eax,%eax
+      55:	78 13                	js     6a <main+0x6a>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      57:	52                   	push   %edx
+      58:	52                   	push   %edx
+      59:	68 e4 5e 00 00       	push   $0x5ee4
+      5e:	6a 01                	push   $0x1
+      60:	e8 6b 40 00 00       	call   40d0 <printf>
+    exit();
+      65:	e8 b9 3e 00 00       	call   3f23 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      6a:	50                   	push   %eax
+      6b:	50                   	push   %eax
+      6c:	68 00 02 00 00       	push   $0x200
+      71:	68 82 55 00 00       	push   $0x5582
+      76:	e8 e8 3e 00 00       	call   3f63 <open>
+      7b:	89 04 24             	mov    %eax,(%esp)
+      7e:	e8 c8 3e 00 00       	call   3f4b <close>
+
+  bigargtest();
+      83:	e8 68 39 00 00       	call   39f0 <bigargtest>
+  bigwrite();
+      88:	e8 53 26 00 00       	call   26e0 <bigwrite>
+  bigargtest();
+      8d:	e8 5e 39 00 00       	call   39f0 <bigargtest>
+  bsstest();
+      92:	e8 e9 38 00 00       	call   3980 <bsstest>
+  sbrktest();
+      97:	e8 34 32 00 00       	call   32d0 <sbrktest>
+  lazytest();
+      9c:	e8 6f 36 00 00       	call   3710 <lazytest>
+  textbusytest();
+      a1:	e8 0a 0a 00 00       	call   ab0 <textbusytest>
+  validatetest();
+      a6:	e8 25 38 00 00       	call   38d0 <validatetest>
+
+  opentest();
+      ab:	e8 a0 00 00 00       	call   150 <opentest>
+  writetest();
+      b0:	e8 2b 01 00 00       	call   1e0 <writetest>
+  writetest1();
+      b5:	e8 06 03 00 00       	call   3c0 <writetest1>
+  writebench();
+      ba:	e8 d1 04 00 00       	call   590 <writebench>
+  readbench();
+      bf:	e8 0c 06 00 00       	call   6d0 <readbench>
+  createtest();
+      c4:	e8 e7 07 00 00       	call   8b0 <createtest>
+
+  mem();
+      c9:	e8 52 0e 00 00       	call   f20 <mem>
+  allocstress();
+      ce:	e8 1d 0f 00 00       	call   ff0 <allocstress>
+  pipe1();
+      d3:	e8 c8 0a 00 00       	call   ba0 <pipe1>
+  preempt();
+      d8:	e8 63 0c 00 00       	call   d40 <preempt>
+  exitwait();
+      dd:	e8 be 0d 00 00       	call   ea0 <exitwait>
+
+  rmdot();
+      e2:	e8 e9 29 00 00       	call   2ad0 <rmdot>
+  namecache();
+      e7:	e8 64 2b 00 00       	call   2c50 <namecache>
+  fourteen();
+      ec:	e8 9f 28 00 00       	call   2990 <fourteen>
+  bigfile();
+      f1:	e8 ca 26 00 00       	call   27c0 <bigfile>
+  subdir();
+      f6:	e8 05 1f 00 00       	call   2000 <subdir>
+  concreate();
+      fb:	e8 c0 19 00 00       	call   1ac0 <concreate>
+  linkunlink();
+     100:	e8 bb 1c 00 00       	call   1dc0 <linkunlink>
+  linktest();
+     105:	e8 a6 17 00 00       	call   18b0 <linktest>
+  unlinkread();
+     10a:	e8 11 16 00 00       	call   1720 <unlinkread>
+  createdelete();
+     10f:	e8 ec 13 00 00       	call   1500 <createdelete>
+  twofiles();
+     114:	e8 b7 11 00 00       	call   12d0 <twofiles>
+  sharedfd();
+     119:	e8 f2 0f 00 00       	call   1110 <sharedfd>
+  dirfile();
+     11e:	e8 dd 2d 00 00       	call   2f00 <dirfile>
+  iref();
+     123:	e8 d8 2f 00 00       	call   3100 <iref>
+  forktest();
+     128:	e8 f3 30 00 00       	call   3220 <forktest>
+  bigdir(); // slow
+     12d:	e8 9e 1d 00 00       	call   1ed0 <bigdir>
+
+  exectest();
+     132:	e8 29 09 00 00       	call   a60 <exectest>
+
+  exit();
+     137:	e8 e7 3d 00 00       	call   3f23 <exit>
+    exit();  // execbench times exec alone
+     13c:	e8 e2 3d 00 00       	call   3f23 <exit>
+     141:	66 90                	xchg   %ax,%ax
+     143:	66 90                	xchg   %ax,%ax
+     145:	66 90                	xchg   %ax,%ax
+     147:	66 90                	xchg   %ax,%ax
+     149:	66 90                	xchg   %ax,%ax
+     14b:	66 90                	xchg   %ax,%ax
+     14d:	66 90                	xchg   %ax,%ax
+     14f:	90                   	nop
+
+00000150 <opentest>:
+{
+     150:	55                   	push   %ebp
+     151:	89 e5                	mov    %esp,%ebp
+     153:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     156:	68 f8 43 00 00       	push   $0x43f8
+     15b:	ff 35 b4 68 00 00    	push   0x68b4
+     161:	e8 6a 3f 00 00       	call   40d0 <printf>
+  fd = open("echo", 0);
+     166:	58                   	pop    %eax
+     167:	5a                   	pop    %edx
+     168:	6a 00                	push   $0x0
+     16a:	68 03 44 00 00       	push   $0x4403
+     16f:	e8 ef 3d 00 00       	call   3f63 <open>
+  if(fd < 0){
+     174:	83 c4 10             	add    $0x10,%esp
+     177:	85 c0                	test   %eax,%eax
+     179:	78 36                	js     1b1 <opentest+0x61>
+  close(fd);
+     17b:	83 ec 0c             	sub    $0xc,%esp
+     17e:	50                   	push   %eax
+     17f:	e8 c7 3d 00 00       	call   3f4b <close>
+  fd = open("doesnotexist", 0);
+     184:	5a                   	pop    %edx
+     185:	59                   	pop    %ecx
+     186:	6a 00                	push   $0x0
+     188:	68 1b 44 00 00       	push   $0x441b
+     18d:	e8 d1 3d 00 00       	call   3f63 <open>
+  if(fd >= 0){
+     192:	83 c4 10             	add    $0x10,%esp
+     195:	85 c0                	test   %eax,%eax
+     197:	79 2f                	jns    1c8 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     199:	83 ec 08             	sub    $0x8,%esp
+     19c:	68 46 44 00 00       	push   $0x4446
+     1a1:	ff 35 b4 68 00 00    	push   0x68b4
+     1a7:	e8 24 3f 00 00       	call   40d0 <printf>
+}
+     1ac:	83 c4 10             	add    $0x10,%esp
+     1af:	c9                   	leave
+     1b0:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     1b1:	50                   	push   %eax
+     1b2:	50                   	push   %eax
+     1b3:	68 08 44 00 00       	push   $0x4408
+     1b8:	ff 35 b4 68 00 00    	push   0x68b4
+     1be:	e8 0d 3f 00 00       	call   40d0 <printf>
+    exit();
+     1c3:	e8 5b 3d 00 00       	call   3f23 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     1c8:	50                   	push   %eax
+     1c9:	50                   	push   %eax
+     1ca:	68 28 44 00 00       	push   $0x4428
+     1cf:	ff 35 b4 68 00 00    	push   0x68b4
+     1d5:	e8 f6 3e 00 00       	call   40d0 <printf>
+    exit();
+     1da:	e8 44 3d 00 00       	call   3f23 <exit>
+     1df:	90                   	nop
+
+000001e0 <writetest>:
+{
+     1e0:	55                   	push   %ebp
+     1e1:	89 e5                	mov    %esp,%ebp
+     1e3:	56                   	push   %esi
+     1e4:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     1e5:	83 ec 08             	sub    $0x8,%esp
+     1e8:	68 54 44 00 00       	push   $0x4454
+     1ed:	ff 35 b4 68 00 00    	push   0x68b4
+     1f3:	e8 d8 3e 00 00       	call   40d0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     1f8:	58                   	pop    %eax
+     1f9:	5a                   	pop    %edx
+     1fa:	68 02 02 00 00       	push   $0x202
+     1ff:	68 65 44 00 00       	push   $0x4465
+     204:	e8 5a 3d 00 00       	call   3f63 <open>
+  if(fd >= 0){
+     209:	83 c4 10             	add    $0x10,%esp
+     20c:	85 c0                	test   %eax,%eax
+     20e:	0f 88 88 01 00 00    	js     39c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     214:	83 ec 08             	sub    $0x8,%esp
+     217:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     219:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     21b:	68 6b 44 00 00       	push   $0x446b
+     220:	ff 35 b4 68 00 00    	push   0x68b4
+     226:	e8 a5 3e 00 00       	call   40d0 <printf>
+     22b:	83 c4 10             	add    $0x10,%esp
+     22e:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     230:	83 ec 04             	sub    $0x4,%esp
+     233:	6a 0a                	push   $0xa
+     235:	68 a2 44 00 00       	push   $0x44a2
+     23a:	56                   	push   %esi
+     23b:	e8 03 3d 00 00       	call   3f43 <write>
+     240:	83 c4 10             	add    $0x10,%esp
+     243:	83 f8 0a             	cmp    $0xa,%eax
+     246:	0f 85 d9 00 00 00    	jne    325 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     24c:	83 ec 04             	sub    $0x4,%esp
+     24f:	6a 0a                	push   $0xa
+     251:	68 ad 44 00 00       	push   $0x44ad
+     256:	56                   	push   %esi
+     257:	e8 e7 3c 00 00       	call   3f43 <write>
+     25c:	83 c4 10             	add    $0x10,%esp
+     25f:	83 f8 0a             	cmp    $0xa,%eax
+     262:	0f 85 d6 00 00 00    	jne    33e <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     268:	83 c3 01             	add    $0x1,%ebx
+     26b:	83 fb 64             	cmp    $0x64,%ebx
+     26e:	75 c0                	jne    230 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     270:	83 ec 08             	sub    $0x8,%esp
+     273:	68 b8 44 00 00       	push   $0x44b8
+     278:	ff 35 b4 68 00 00    	push   0x68b4
+     27e:	e8 4d 3e 00 00       	call   40d0 <printf>
+  close(fd);
+     283:	89 34 24             	mov    %esi,(%esp)
+     286:	e8 c0 3c 00 00       	call   3f4b <close>
+  fd = open("small", O_RDONLY);
+     28b:	5b                   	pop    %ebx
+     28c:	5e                   	pop    %esi
+     28d:	6a 00                	push   $0x0
+     28f:	68 65 44 00 00       	push   $0x4465
+     294:	e8 ca 3c 00 00       	call   3f63 <open>
+  if(fd >= 0){
+     299:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     29c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     29e:	85 c0                	test   %eax,%eax
+     2a0:	0f 88 b1 00 00 00    	js     357 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     2a6:	83 ec 08             	sub    $0x8,%esp
+     2a9:	68 c3 44 00 00       	push   $0x44c3
+     2ae:	ff 35 b4 68 00 00    	push   0x68b4
+     2b4:	e8 17 3e 00 00       	call   40d0 <printf>
+  i = read(fd, buf, 2000);
+     2b9:	83 c4 0c             	add    $0xc,%esp
+     2bc:	68 d0 07 00 00       	push   $0x7d0
+     2c1:	68 00 90 00 00       	push   $0x9000
+     2c6:	53                   	push   %ebx
+     2c7:	e8 6f 3c 00 00       	call   3f3b <read>
+  if(i == 2000){
+     2cc:	83 c4 10             	add    $0x10,%esp
+     2cf:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     2d4:	0f 85 94 00 00 00    	jne    36e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     2da:	83 ec 08             	sub    $0x8,%esp
+     2dd:	68 f7 44 00 00       	push   $0x44f7
+     2e2:	ff 35 b4 68 00 00    	push   0x68b4
+     2e8:	e8 e3 3d 00 00       	call   40d0 <printf>
+  close(fd);
+     2ed:	89 1c 24             	mov    %ebx,(%esp)
+     2f0:	e8 56 3c 00 00       	call   3f4b <close>
+  if(unlink("small") < 0){
+     2f5:	c7 04 24 65 44 00 00 	movl   $0x4465,(%esp)
+     2fc:	e8 72 3c 00 00       	call   3f73 <unlink>
+     301:	83 c4 10             	add    $0x10,%esp
+     304:	85 c0                	test   %eax,%eax
+     306:	78 7d                	js     385 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     308:	83 ec 08             	sub    $0x8,%esp
+     30b:	68 1f 45 00 00       	push   $0x451f
+     310:	ff 35 b4 68 00 00    	push   0x68b4
+     316:	e8 b5 3d 00 00       	call   40d0 <printf>
+}
+     31b:	83 c4 10             	add    $0x10,%esp
+     31e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     321:	5b                   	pop    %ebx
+     322:	5e                   	pop    %esi
+     323:	5d                   	pop    %ebp
+     324:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     325:	83 ec 04             	sub    $0x4,%esp
+     328:	53                   	push   %ebx
+     329:	68 a4 55 00 00       	push   $0x55a4
+     32e:	ff 35 b4 68 00 00    	push   0x68b4
+     334:	e8 97 3d 00 00       	call   40d0 <printf>
+      exit();
+     339:	e8 e5 3b 00 00       	call   3f23 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     33e:	83 ec 04             	sub    $0x4,%esp
+     341:	53                   	push   %ebx
+     342:	68 c8 55 00 00       	push   $0x55c8
+     347:	ff 35 b4 68 00 00    	push   0x68b4
+     34d:	e8 7e 3d 00 00       	call   40d0 <printf>
+      exit();
+     352:	e8 cc 3b 00 00       	call   3f23 <exit>
+    printf(stdout, "error: open small failed!\n");
+     357:	51                   	push   %ecx
+     358:	51                   	push   %ecx
+     359:	68 dc 44 00 00       	push   $0x44dc
+     35e:	ff 35 b4 68 00 00    	push   0x68b4
+     364:	e8 67 3d 00 00       	call   40d0 <printf>
+    exit();
+     369:	e8 b5 3b 00 00       	call   3f23 <exit>
+    printf(stdout, "read failed\n");
+     36e:	52                   	push   %edx
+     36f:	52                   	push   %edx
+     370:	68 a1 49 00 00       	push   $0x49a1
+     375:	ff 35 b4 68 00 00    	push   0x68b4
+     37b:	e8 50 3d 00 00       	call   40d0 <printf>
+    exit();
+     380:	e8 9e 3b 00 00       	call   3f23 <exit>
+    printf(stdout, "unlink small failed\n");
+     385:	50                   	push   %eax
+     386:	50                   	push   %eax
+     387:	68 0a 45 00 00       	push   $0x450a
+     38c:	ff 35 b4 68 00 00    	push   0x68b4
+     392:	e8 39 3d 00 00       	call   40d0 <printf>
+    exit();
+     397:	e8 87 3b 00 00       	call   3f23 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     39c:	50                   	push   %eax
+     39d:	50                   	push   %eax
+     39e:	68 86 44 00 00       	push   $0x4486
+     3a3:	ff 35 b4 68 00 00    	push   0x68b4
+     3a9:	e8 22 3d 00 00       	call   40d0 <printf>
+    exit();
+     3ae:	e8 70 3b 00 00       	call   3f23 <exit>
+     3b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003c0 <writetest1>:
+{
+     3c0:	55                   	push   %ebp
+     3c1:	89 e5                	mov    %esp,%ebp
+     3c3:	56                   	push   %esi
+     3c4:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     3c5:	83 ec 08             	sub    $0x8,%esp
+     3c8:	68 33 45 00 00       	push   $0x4533
+     3cd:	ff 35 b4 68 00 00    	push   0x68b4
+     3d3:	e8 f8 3c 00 00       	call   40d0 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     3d8:	58                   	pop    %eax
+     3d9:	5a                   	pop    %edx
+     3da:	68 02 02 00 00       	push   $0x202
+     3df:	68 ad 45 00 00       	push   $0x45ad
+     3e4:	e8 7a 3b 00 00       	call   3f63 <open>
+  if(fd < 0){
+     3e9:	83 c4 10             	add    $0x10,%esp
+     3ec:	85 c0                	test   %eax,%eax
+     3ee:	0f 88 61 01 00 00    	js     555 <writetest1+0x195>
+     3f4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NBIG; i++){
+     3f6:	31 db                	xor    %ebx,%ebx
+     3f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ff:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     400:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     403:	89 1d 00 90 00 00    	mov    %ebx,0x9000
+    if(write(fd, buf, 512) != 512){
+     409:	68 00 02 00 00       	push   $0x200
+     40e:	68 00 90 00 00       	push   $0x9000
+     413:	56                   	push   %esi
+     414:	e8 2a 3b 00 00       	call   3f43 <write>
+     419:	83 c4 10             	add    $0x10,%esp
+     41c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     421:	0f 85 b3 00 00 00    	jne    4da <writetest1+0x11a>
+  for(i = 0; i < NBIG; i++){
+     427:	83 c3 01             	add    $0x1,%ebx
+     42a:	81 fb 00 40 00 00    	cmp    $0x4000,%ebx
+     430:	75 ce                	jne    400 <writetest1+0x40>
+  close(fd);
+     432:	83 ec 0c             	sub    $0xc,%esp
+     435:	56                   	push   %esi
+     436:	e8 10 3b 00 00       	call   3f4b <close>
+  fd = open("big", O_RDONLY);
+     43b:	5b                   	pop    %ebx
+     43c:	5e                   	pop    %esi
+     43d:	6a 00                	push   $0x0
+     43f:	68 ad 45 00 00       	push   $0x45ad
+     444:	e8 1a 3b 00 00       	call   3f63 <open>
+  if(fd < 0){
+     449:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     44c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     44e:	85 c0                	test   %eax,%eax
+     450:	0f 88 e8 00 00 00    	js     53e <writetest1+0x17e>
+  n = 0;
+     456:	31 f6                	xor    %esi,%esi
+     458:	eb 1d                	jmp    477 <writetest1+0xb7>
+     45a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     460:	3d 00 02 00 00       	cmp    $0x200,%eax
+     465:	0f 85 9f 00 00 00    	jne    50a <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     46b:	a1 00 90 00 00       	mov    0x9000,%eax
+     470:	39 f0                	cmp    %esi,%eax
+     472:	75 7f                	jne    4f3 <writetest1+0x133>
+    n++;
+     474:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     477:	83 ec 04             	sub    $0x4,%esp
+     47a:	68 00 02 00 00       	push   $0x200
+     47f:	68 00 90 00 00       	push   $0x9000
+     484:	53                   	push   %ebx
+     485:	e8 b1 3a 00 00       	call   3f3b <read>
+    if(i == 0){
+     48a:	83 c4 10             	add    $0x10,%esp
+     48d:	85 c0                	test   %eax,%eax
+     48f:	75 cf                	jne    460 <writetest1+0xa0>
+      if(n == NBIG - 1){
+     491:	81 fe ff 3f 00 00    	cmp    $0x3fff,%esi
+     497:	0f 84 86 00 00 00    	je     523 <writetest1+0x163>
+  close(fd);
+     49d:	83 ec 0c             	sub    $0xc,%esp
+     4a0:	53                   	push   %ebx
+     4a1:	e8 a5 3a 00 00       	call   3f4b <close>
+  if(unlink("big") < 0){
+     4a6:	c7 04 24 ad 45 00 00 	movl   $0x45ad,(%esp)
+     4ad:	e8 c1 3a 00 00       	call   3f73 <unlink>
+     4b2:	83 c4 10             	add    $0x10,%esp
+     4b5:	85 c0                	test   %eax,%eax
+     4b7:	0f 88 af 00 00 00    	js     56c <writetest1+0x1ac>
+  printf(stdout, "big files ok\n");
+     4bd:	83 ec 08             	sub    $0x8,%esp
+     4c0:	68 d4 45 00 00       	push   $0x45d4
+     4c5:	ff 35 b4 68 00 00    	push   0x68b4
+     4cb:	e8 00 3c 00 00       	call   40d0 <printf>
+}
+     4d0:	83 c4 10             	add    $0x10,%esp
+     4d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4d6:	5b                   	pop    %ebx
+     4d7:	5e                   	pop    %esi
+     4d8:	5d                   	pop    %ebp
+     4d9:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     4da:	83 ec 04             	sub    $0x4,%esp
+     4dd:	53                   	push   %ebx
+     4de:	68 5d 45 00 00       	push   $0x455d
+     4e3:	ff 35 b4 68 00 00    	push   0x68b4
+     4e9:	e8 e2 3b 00 00       	call   40d0 <printf>
+      exit();
+     4ee:	e8 30 3a 00 00       	call   3f23 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     4f3:	50                   	push   %eax
+     4f4:	56                   	push   %esi
+     4f5:	68 ec 55 00 00       	push   $0x55ec
+     4fa:	ff 35 b4 68 00 00    	push   0x68b4
+     500:	e8 cb 3b 00 00       	call   40d0 <printf>
+      exit();
+     505:	e8 19 3a 00 00       	call   3f23 <exit>
+      printf(stdout, "read failed %d\n", i);
+     50a:	83 ec 04             	sub    $0x4,%esp
+     50d:	50                   	push   %eax
+     50e:	68 b1 45 00 00       	push   $0x45b1
+     513:	ff 35 b4 68 00 00    	push   0x68b4
+     519:	e8 b2 3b 00 00       	call   40d0 <printf>
+      exit();
+     51e:	e8 00 3a 00 00       	call   3f23 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     523:	52                   	push   %edx
+     524:	68 ff 3f 00 00       	push   $0x3fff
+     529:	68 94 45 00 00       	push   $0x4594
+     52e:	ff 35 b4 68 00 00    	push   0x68b4
+     534:	e8 97 3b 00 00       	call   40d0 <printf>
+        exit();
+     539:	e8 e5 39 00 00       	call   3f23 <exit>
+    printf(stdout, "error: open big failed!\n");
+     53e:	51                   	push   %ecx
+     53f:	51                   	push   %ecx
+     540:	68 7b 45 00 00       	push   $0x457b
+     545:	ff 35 b4 68 00 00    	push   0x68b4
+     54b:	e8 80 3b 00 00       	call   40d0 <printf>
+    exit();
+     550:	e8 ce 39 00 00       	call   3f23 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     555:	50                   	push   %eax
+     556:	50                   	push   %eax
+     557:	68 43 45 00 00       	push   $0x4543
+     55c:	ff 35 b4 68 00 00    	push   0x68b4
+     562:	e8 69 3b 00 00       	call   40d0 <printf>
+    exit();
+     567:	e8 b7 39 00 00       	call   3f23 <exit>
+    printf(stdout, "unlink big failed\n");
+     56c:	50                   	push   %eax
+     56d:	50                   	push   %eax
+     56e:	68 c1 45 00 00       	push   $0x45c1
+     573:	ff 35 b4 68 00 00    	push   0x68b4
+     579:	e8 52 3b 00 00       	call   40d0 <printf>
+    exit();
+     57e:	e8 a0 39 00 00       	call   3f23 <exit>
+     583:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000590 <writebench>:
+{
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	57                   	push   %edi
+     594:	56                   	push   %esi
+     595:	53                   	push   %ebx
+     596:	83 ec 24             	sub    $0x24,%esp
+  printf(stdout, "write throughput test\n");
+     599:	68 e2 45 00 00       	push   $0x45e2
+     59e:	ff 35 b4 68 00 00    	push   0x68b4
+     5a4:	e8 27 3b 00 00       	call   40d0 <printf>
+  memset(buf, 'w', sizeof(buf));
+     5a9:	83 c4 0c             	add    $0xc,%esp
+     5ac:	68 00 20 00 00       	push   $0x2000
+     5b1:	6a 77                	push   $0x77
+     5b3:	68 00 90 00 00       	push   $0x9000
+     5b8:	e8 e3 37 00 00       	call   3da0 <memset>
+  fd = open("writebench", O_CREATE|O_RDWR);
+     5bd:	5a                   	pop    %edx
+     5be:	59                   	pop    %ecx
+     5bf:	68 02 02 00 00       	push   $0x202
+     5c4:	68 f9 45 00 00       	push   $0x45f9
+     5c9:	e8 95 39 00 00       	call   3f63 <open>
+  if(fd < 0){
+     5ce:	83 c4 10             	add    $0x10,%esp
+     5d1:	85 c0                	test   %eax,%eax
+     5d3:	0f 88 de 00 00 00    	js     6b7 <writebench+0x127>
+     5d9:	89 c3                	mov    %eax,%ebx
+  for(tot = 0; tot < (NBIG - 1) * 512; tot += n){
+     5db:	31 ff                	xor    %edi,%edi
+  start = uptime();
+     5dd:	e8 d9 39 00 00       	call   3fbb <uptime>
+     5e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(tot = 0; tot < (NBIG - 1) * 512; tot += n){
+     5e5:	31 c0                	xor    %eax,%eax
+     5e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ee:	66 90                	xchg   %ax,%ax
+    n = (NBIG - 1) * 512 - tot;
+     5f0:	be 00 fe 7f 00       	mov    $0x7ffe00,%esi
+     5f5:	29 c6                	sub    %eax,%esi
+    if(n > sizeof(buf))
+     5f7:	b8 00 20 00 00       	mov    $0x2000,%eax
+     5fc:	39 c6                	cmp    %eax,%esi
+     5fe:	0f 47 f0             	cmova  %eax,%esi
+    if(write(fd, buf, n) != n){
+     601:	83 ec 04             	sub    $0x4,%esp
+     604:	56                   	push   %esi
+     605:	68 00 90 00 00       	push   $0x9000
+     60a:	53                   	push   %ebx
+     60b:	e8 33 39 00 00       	call   3f43 <write>
+     610:	83 c4 10             	add    $0x10,%esp
+     613:	39 f0                	cmp    %esi,%eax
+     615:	0f 85 84 00 00 00    	jne    69f <writebench+0x10f>
+  for(tot = 0; tot < (NBIG - 1) * 512; tot += n){
+     61b:	01 c7                	add    %eax,%edi
+     61d:	89 f8                	mov    %edi,%eax
+     61f:	81 ff ff fd 7f 00    	cmp    $0x7ffdff,%edi
+     625:	7e c9                	jle    5f0 <writebench+0x60>
+  close(fd);
+     627:	83 ec 0c             	sub    $0xc,%esp
+     62a:	53                   	push   %ebx
+     62b:	e8 1b 39 00 00       	call   3f4b <close>
+  elapsed = uptime() - start;
+     630:	e8 86 39 00 00       	call   3fbb <uptime>
+     635:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  unlink("writebench");
+     638:	c7 04 24 f9 45 00 00 	movl   $0x45f9,(%esp)
+  elapsed = uptime() - start;
+     63f:	29 c8                	sub    %ecx,%eax
+     641:	89 c3                	mov    %eax,%ebx
+  unlink("writebench");
+     643:	e8 2b 39 00 00       	call   3f73 <unlink>
+  printf(stdout, "wrote %d bytes in %d ticks", tot, elapsed);
+     648:	53                   	push   %ebx
+     649:	57                   	push   %edi
+     64a:	68 04 46 00 00       	push   $0x4604
+     64f:	ff 35 b4 68 00 00    	push   0x68b4
+     655:	e8 76 3a 00 00       	call   40d0 <printf>
+  if(elapsed > 0)
+     65a:	83 c4 20             	add    $0x20,%esp
+     65d:	85 db                	test   %ebx,%ebx
+     65f:	75 1f                	jne    680 <writebench+0xf0>
+  printf(stdout, "\nwrite throughput ok\n");
+     661:	83 ec 08             	sub    $0x8,%esp
+     664:	68 30 46 00 00       	push   $0x4630
+     669:	ff 35 b4 68 00 00    	push   0x68b4
+     66f:	e8 5c 3a 00 00       	call   40d0 <printf>
+}
+     674:	83 c4 10             	add    $0x10,%esp
+     677:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     67a:	5b                   	pop    %ebx
+     67b:	5e                   	pop    %esi
+     67c:	5f                   	pop    %edi
+     67d:	5d                   	pop    %ebp
+     67e:	c3                   	ret
+     67f:	90                   	nop
+    printf(stdout, " (%d bytes/tick)", tot / elapsed);
+     680:	89 f8                	mov    %edi,%eax
+     682:	31 d2                	xor    %edx,%edx
+     684:	83 ec 04             	sub    $0x4,%esp
+     687:	f7 f3                	div    %ebx
+     689:	50                   	push   %eax
+     68a:	68 1f 46 00 00       	push   $0x461f
+     68f:	ff 35 b4 68 00 00    	push   0x68b4
+     695:	e8 36 3a 00 00       	call   40d0 <printf>
+     69a:	83 c4 10             	add    $0x10,%esp
+     69d:	eb c2                	jmp    661 <writebench+0xd1>
+      printf(stdout, "error: write writebench failed\n");
+     69f:	83 ec 08             	sub    $0x8,%esp
+     6a2:	68 30 56 00 00       	push   $0x5630
+     6a7:	ff 35 b4 68 00 00    	push   0x68b4
+     6ad:	e8 1e 3a 00 00       	call   40d0 <printf>
+      exit();
+     6b2:	e8 6c 38 00 00       	call   3f23 <exit>
+    printf(stdout, "error: creat writebench failed!\n");
+     6b7:	50                   	push   %eax
+     6b8:	50                   	push   %eax
+     6b9:	68 0c 56 00 00       	push   $0x560c
+     6be:	ff 35 b4 68 00 00    	push   0x68b4
+     6c4:	e8 07 3a 00 00       	call   40d0 <printf>
+    exit();
+     6c9:	e8 55 38 00 00       	call   3f23 <exit>
+     6ce:	66 90                	xchg   %ax,%ax
+
+000006d0 <readbench>:
+{
+     6d0:	55                   	push   %ebp
+     6d1:	89 e5                	mov    %esp,%ebp
+     6d3:	57                   	push   %edi
+     6d4:	56                   	push   %esi
+     6d5:	53                   	push   %ebx
+     6d6:	83 ec 14             	sub    $0x14,%esp
+  printf(stdout, "read throughput test\n");
+     6d9:	68 46 46 00 00       	push   $0x4646
+     6de:	ff 35 b4 68 00 00    	push   0x68b4
+     6e4:	e8 e7 39 00 00       	call   40d0 <printf>
+  fd = open("readbench", O_CREATE|O_RDWR);
+     6e9:	5f                   	pop    %edi
+     6ea:	58                   	pop    %eax
+     6eb:	68 02 02 00 00       	push   $0x202
+     6f0:	68 5c 46 00 00       	push   $0x465c
+     6f5:	e8 69 38 00 00       	call   3f63 <open>
+  if(fd < 0){
+     6fa:	83 c4 10             	add    $0x10,%esp
+     6fd:	85 c0                	test   %eax,%eax
+     6ff:	0f 88 86 01 00 00    	js     88b <readbench+0x1bb>
+     705:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < NBIG - 1; i++){
+     707:	31 db                	xor    %ebx,%ebx
+     709:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(write(fd, buf, 512) != 512){
+     710:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     713:	89 1d 00 90 00 00    	mov    %ebx,0x9000
+    if(write(fd, buf, 512) != 512){
+     719:	68 00 02 00 00       	push   $0x200
+     71e:	68 00 90 00 00       	push   $0x9000
+     723:	56                   	push   %esi
+     724:	e8 1a 38 00 00       	call   3f43 <write>
+     729:	83 c4 10             	add    $0x10,%esp
+     72c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     731:	0f 85 f5 00 00 00    	jne    82c <readbench+0x15c>
+  for(i = 0; i < NBIG - 1; i++){
+     737:	83 c3 01             	add    $0x1,%ebx
+     73a:	81 fb ff 3f 00 00    	cmp    $0x3fff,%ebx
+     740:	75 ce                	jne    710 <readbench+0x40>
+  close(fd);
+     742:	83 ec 0c             	sub    $0xc,%esp
+     745:	56                   	push   %esi
+     746:	e8 00 38 00 00       	call   3f4b <close>
+  fd = open("readbench", O_RDONLY);
+     74b:	59                   	pop    %ecx
+     74c:	5b                   	pop    %ebx
+     74d:	6a 00                	push   $0x0
+     74f:	68 5c 46 00 00       	push   $0x465c
+     754:	e8 0a 38 00 00       	call   3f63 <open>
+  if(fd < 0){
+     759:	83 c4 10             	add    $0x10,%esp
+  fd = open("readbench", O_RDONLY);
+     75c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     75e:	85 c0                	test   %eax,%eax
+     760:	0f 88 f7 00 00 00    	js     85d <readbench+0x18d>
+  start = uptime();
+     766:	e8 50 38 00 00       	call   3fbb <uptime>
+  tot = 0;
+     76b:	31 f6                	xor    %esi,%esi
+  start = uptime();
+     76d:	89 c7                	mov    %eax,%edi
+  while((n = read(fd, buf, 512)) > 0){
+     76f:	eb 1a                	jmp    78b <readbench+0xbb>
+     771:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(((int*)buf)[0] != tot / 512){
+     778:	89 f1                	mov    %esi,%ecx
+     77a:	c1 f9 09             	sar    $0x9,%ecx
+     77d:	39 0d 00 90 00 00    	cmp    %ecx,0x9000
+     783:	0f 85 bb 00 00 00    	jne    844 <readbench+0x174>
+    tot += n;
+     789:	01 c6                	add    %eax,%esi
+  while((n = read(fd, buf, 512)) > 0){
+     78b:	83 ec 04             	sub    $0x4,%esp
+     78e:	68 00 02 00 00       	push   $0x200
+     793:	68 00 90 00 00       	push   $0x9000
+     798:	53                   	push   %ebx
+     799:	e8 9d 37 00 00       	call   3f3b <read>
+     79e:	83 c4 10             	add    $0x10,%esp
+     7a1:	85 c0                	test   %eax,%eax
+     7a3:	7f d3                	jg     778 <readbench+0xa8>
+  elapsed = uptime() - start;
+     7a5:	e8 11 38 00 00       	call   3fbb <uptime>
+  close(fd);
+     7aa:	83 ec 0c             	sub    $0xc,%esp
+     7ad:	53                   	push   %ebx
+  elapsed = uptime() - start;
+     7ae:	29 f8                	sub    %edi,%eax
+     7b0:	89 c7                	mov    %eax,%edi
+  close(fd);
+     7b2:	e8 94 37 00 00       	call   3f4b <close>
+  unlink("readbench");
+     7b7:	c7 04 24 5c 46 00 00 	movl   $0x465c,(%esp)
+     7be:	e8 b0 37 00 00       	call   3f73 <unlink>
+  if(tot != (NBIG - 1) * 512){
+     7c3:	83 c4 10             	add    $0x10,%esp
+     7c6:	81 fe 00 fe 7f 00    	cmp    $0x7ffe00,%esi
+     7cc:	0f 85 a2 00 00 00    	jne    874 <readbench+0x1a4>
+  printf(stdout, "read %d bytes in %d ticks", tot, elapsed);
+     7d2:	57                   	push   %edi
+     7d3:	68 00 fe 7f 00       	push   $0x7ffe00
+     7d8:	68 80 46 00 00       	push   $0x4680
+     7dd:	ff 35 b4 68 00 00    	push   0x68b4
+     7e3:	e8 e8 38 00 00       	call   40d0 <printf>
+  if(elapsed > 0)
+     7e8:	83 c4 10             	add    $0x10,%esp
+     7eb:	85 ff                	test   %edi,%edi
+     7ed:	75 1e                	jne    80d <readbench+0x13d>
+  printf(stdout, "\nread throughput ok\n");
+     7ef:	83 ec 08             	sub    $0x8,%esp
+     7f2:	68 9a 46 00 00       	push   $0x469a
+     7f7:	ff 35 b4 68 00 00    	push   0x68b4
+     7fd:	e8 ce 38 00 00       	call   40d0 <printf>
+}
+     802:	83 c4 10             	add    $0x10,%esp
+     805:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     808:	5b                   	pop    %ebx
+     809:	5e                   	pop    %esi
+     80a:	5f                   	pop    %edi
+     80b:	5d                   	pop    %ebp
+     80c:	c3                   	ret
+    printf(stdout, " (%d bytes/tick)", tot / elapsed);
+     80d:	89 f0                	mov    %esi,%eax
+     80f:	31 d2                	xor    %edx,%edx
+     811:	83 ec 04             	sub    $0x4,%esp
+     814:	f7 f7                	div    %edi
+     816:	50                   	push   %eax
+     817:	68 1f 46 00 00       	push   $0x461f
+     81c:	ff 35 b4 68 00 00    	push   0x68b4
+     822:	e8 a9 38 00 00       	call   40d0 <printf>
+     827:	83 c4 10             	add    $0x10,%esp
+     82a:	eb c3                	jmp    7ef <readbench+0x11f>
+      printf(stdout, "error: write readbench failed\n");
+     82c:	83 ec 08             	sub    $0x8,%esp
+     82f:	68 70 56 00 00       	push   $0x5670
+     834:	ff 35 b4 68 00 00    	push   0x68b4
+     83a:	e8 91 38 00 00       	call   40d0 <printf>
+      exit();
+     83f:	e8 df 36 00 00       	call   3f23 <exit>
+      printf(stdout, "readbench: bad content at block %d\n", tot / 512);
+     844:	83 ec 04             	sub    $0x4,%esp
+     847:	51                   	push   %ecx
+     848:	68 b0 56 00 00       	push   $0x56b0
+     84d:	ff 35 b4 68 00 00    	push   0x68b4
+     853:	e8 78 38 00 00       	call   40d0 <printf>
+      exit();
+     858:	e8 c6 36 00 00       	call   3f23 <exit>
+    printf(stdout, "error: open readbench failed!\n");
+     85d:	52                   	push   %edx
+     85e:	52                   	push   %edx
+     85f:	68 90 56 00 00       	push   $0x5690
+     864:	ff 35 b4 68 00 00    	push   0x68b4
+     86a:	e8 61 38 00 00       	call   40d0 <printf>
+    exit();
+     86f:	e8 af 36 00 00       	call   3f23 <exit>
+    printf(stdout, "readbench: read %d bytes\n", tot);
+     874:	50                   	push   %eax
+     875:	56                   	push   %esi
+     876:	68 66 46 00 00       	push   $0x4666
+     87b:	ff 35 b4 68 00 00    	push   0x68b4
+     881:	e8 4a 38 00 00       	call   40d0 <printf>
+    exit();
+     886:	e8 98 36 00 00       	call   3f23 <exit>
+    printf(stdout, "error: creat readbench failed!\n");
+     88b:	56                   	push   %esi
+     88c:	56                   	push   %esi
+     88d:	68 50 56 00 00       	push   $0x5650
+     892:	ff 35 b4 68 00 00    	push   0x68b4
+     898:	e8 33 38 00 00       	call   40d0 <printf>
+    exit();
+     89d:	e8 81 36 00 00       	call   3f23 <exit>
+     8a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000008b0 <createtest>:
+{
+     8b0:	55                   	push   %ebp
+     8b1:	89 e5                	mov    %esp,%ebp
+     8b3:	56                   	push   %esi
+     8b4:	53                   	push   %ebx
+  name[2] = '\0';
+     8b5:	bb 30 00 00 00       	mov    $0x30,%ebx
+  printf(stdout, "many creates, followed by unlink test\n");
+     8ba:	83 ec 08             	sub    $0x8,%esp
+     8bd:	68 d4 56 00 00       	push   $0x56d4
+     8c2:	ff 35 b4 68 00 00    	push   0x68b4
+     8c8:	e8 03 38 00 00       	call   40d0 <printf>
+  start = uptime();
+     8cd:	e8 e9 36 00 00       	call   3fbb <uptime>
+  name[0] = 'a';
+     8d2:	c6 05 f0 8f 00 00 61 	movb   $0x61,0x8ff0
+  name[2] = '\0';
+     8d9:	83 c4 10             	add    $0x10,%esp
+     8dc:	c6 05 f2 8f 00 00 00 	movb   $0x0,0x8ff2
+  start = uptime();
+     8e3:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 52; i++){
+     8e5:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     8e8:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     8eb:	88 1d f1 8f 00 00    	mov    %bl,0x8ff1
+  for(i = 0; i < 52; i++){
+     8f1:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     8f4:	68 02 02 00 00       	push   $0x202
+     8f9:	68 f0 8f 00 00       	push   $0x8ff0
+     8fe:	e8 60 36 00 00       	call   3f63 <open>
+    close(fd);
+     903:	89 04 24             	mov    %eax,(%esp)
+     906:	e8 40 36 00 00       	call   3f4b <close>
+  for(i = 0; i < 52; i++){
+     90b:	83 c4 10             	add    $0x10,%esp
+     90e:	80 fb 64             	cmp    $0x64,%bl
+     911:	75 d5                	jne    8e8 <createtest+0x38>
+  name[0] = 'a';
+     913:	c6 05 f0 8f 00 00 61 	movb   $0x61,0x8ff0
+  name[2] = '\0';
+     91a:	bb 30 00 00 00       	mov    $0x30,%ebx
+     91f:	c6 05 f2 8f 00 00 00 	movb   $0x0,0x8ff2
+  for(i = 0; i < 52; i++){
+     926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     92d:	8d 76 00             	lea    0x0(%esi),%esi
+    unlink(name);
+     930:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     933:	88 1d f1 8f 00 00    	mov    %bl,0x8ff1
+  for(i = 0; i < 52; i++){
+     939:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     93c:	68 f0 8f 00 00       	push   $0x8ff0
+     941:	e8 2d 36 00 00       	call   3f73 <unlink>
+  for(i = 0; i < 52; i++){
+     946:	83 c4 10             	add    $0x10,%esp
+     949:	80 fb 64             	cmp    $0x64,%bl
+     94c:	75 e2                	jne    930 <createtest+0x80>
+         uptime() - start);
+     94e:	e8 68 36 00 00       	call   3fbb <uptime>
+  printf(stdout, "many creates, followed by unlink; ok (%d ticks)\n",
+     953:	83 ec 04             	sub    $0x4,%esp
+     956:	29 f0                	sub    %esi,%eax
+     958:	50                   	push   %eax
+     959:	68 fc 56 00 00       	push   $0x56fc
+     95e:	ff 35 b4 68 00 00    	push   0x68b4
+     964:	e8 67 37 00 00       	call   40d0 <printf>
+}
+     969:	83 c4 10             	add    $0x10,%esp
+     96c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     96f:	5b                   	pop    %ebx
+     970:	5e                   	pop    %esi
+     971:	5d                   	pop    %ebp
+     972:	c3                   	ret
+     973:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     97a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000980 <dirtest>:
+{
+     980:	55                   	push   %ebp
+     981:	89 e5                	mov    %esp,%ebp
+     983:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     986:	68 af 46 00 00       	push   $0x46af
+     98b:	ff 35 b4 68 00 00    	push   0x68b4
+     991:	e8 3a 37 00 00       	call   40d0 <printf>
+  if(mkdir("dir0") < 0){
+     996:	c7 04 24 bb 46 00 00 	movl   $0x46bb,(%esp)
+     99d:	e8 e9 35 00 00       	call   3f8b <mkdir>
+     9a2:	83 c4 10             	add    $0x10,%esp
+     9a5:	85 c0                	test   %eax,%eax
+     9a7:	78 58                	js     a01 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     9a9:	83 ec 0c             	sub    $0xc,%esp
+     9ac:	68 bb 46 00 00       	push   $0x46bb
+     9b1:	e8 dd 35 00 00       	call   3f93 <chdir>
+     9b6:	83 c4 10             	add    $0x10,%esp
+     9b9:	85 c0                	test   %eax,%eax
+     9bb:	0f 88 85 00 00 00    	js     a46 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     9c1:	83 ec 0c             	sub    $0xc,%esp
+     9c4:	68 11 4d 00 00       	push   $0x4d11
+     9c9:	e8 c5 35 00 00       	call   3f93 <chdir>
+     9ce:	83 c4 10             	add    $0x10,%esp
+     9d1:	85 c0                	test   %eax,%eax
+     9d3:	78 5a                	js     a2f <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     9d5:	83 ec 0c             	sub    $0xc,%esp
+     9d8:	68 bb 46 00 00       	push   $0x46bb
+     9dd:	e8 91 35 00 00       	call   3f73 <unlink>
+     9e2:	83 c4 10             	add    $0x10,%esp
+     9e5:	85 c0                	test   %eax,%eax
+     9e7:	78 2f                	js     a18 <dirtest+0x98>
+  printf(stdout, "mkdir test\n");
+     9e9:	83 ec 08             	sub    $0x8,%esp
+     9ec:	68 af 46 00 00       	push   $0x46af
+     9f1:	ff 35 b4 68 00 00    	push   0x68b4
+     9f7:	e8 d4 36 00 00       	call   40d0 <printf>
+}
+     9fc:	83 c4 10             	add    $0x10,%esp
+     9ff:	c9                   	leave
+     a00:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     a01:	50                   	push   %eax
+     a02:	50                   	push   %eax
+     a03:	68 c0 46 00 00       	push   $0x46c0
+     a08:	ff 35 b4 68 00 00    	push   0x68b4
+     a0e:	e8 bd 36 00 00       	call   40d0 <printf>
+    exit();
+     a13:	e8 0b 35 00 00       	call   3f23 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     a18:	50                   	push   %eax
+     a19:	50                   	push   %eax
+     a1a:	68 f2 46 00 00       	push   $0x46f2
+     a1f:	ff 35 b4 68 00 00    	push   0x68b4
+     a25:	e8 a6 36 00 00       	call   40d0 <printf>
+    exit();
+     a2a:	e8 f4 34 00 00       	call   3f23 <exit>
+    printf(stdout, "chdir .. failed\n");
+     a2f:	52                   	push   %edx
+     a30:	52                   	push   %edx
+     a31:	68 e1 46 00 00       	push   $0x46e1
+     a36:	ff 35 b4 68 00 00    	push   0x68b4
+     a3c:	e8 8f 36 00 00       	call   40d0 <printf>
+    exit();
+     a41:	e8 dd 34 00 00       	call   3f23 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     a46:	51                   	push   %ecx
+     a47:	51                   	push   %ecx
+     a48:	68 ce 46 00 00       	push   $0x46ce
+     a4d:	ff 35 b4 68 00 00    	push   0x68b4
+     a53:	e8 78 36 00 00       	call   40d0 <printf>
+    exit();
+     a58:	e8 c6 34 00 00       	call   3f23 <exit>
+     a5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a60 <exectest>:
+{
+     a60:	55                   	push   %ebp
+     a61:	89 e5                	mov    %esp,%ebp
+     a63:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     a66:	68 06 47 00 00       	push   $0x4706
+     a6b:	ff 35 b4 68 00 00    	push   0x68b4
+     a71:	e8 5a 36 00 00       	call   40d0 <printf>
+  if(exec("echo", echoargv) < 0){
+     a76:	5a                   	pop    %edx
+     a77:	59                   	pop    %ecx
+     a78:	68 b8 68 00 00       	push   $0x68b8
+     a7d:	68 03 44 00 00       	push   $0x4403
+     a82:	e8 d4 34 00 00       	call   3f5b <exec>
+     a87:	83 c4 10             	add    $0x10,%esp
+     a8a:	85 c0                	test   %eax,%eax
+     a8c:	78 02                	js     a90 <exectest+0x30>
+}
+     a8e:	c9                   	leave
+     a8f:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     a90:	50                   	push   %eax
+     a91:	50                   	push   %eax
+     a92:	68 11 47 00 00       	push   $0x4711
+     a97:	ff 35 b4 68 00 00    	push   0x68b4
+     a9d:	e8 2e 36 00 00       	call   40d0 <printf>
+    exit();
+     aa2:	e8 7c 34 00 00       	call   3f23 <exit>
+     aa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aae:	66 90                	xchg   %ax,%ax
+
+00000ab0 <textbusytest>:
+{
+     ab0:	55                   	push   %ebp
+     ab1:	89 e5                	mov    %esp,%ebp
+     ab3:	56                   	push   %esi
+     ab4:	53                   	push   %ebx
+     ab5:	83 ec 18             	sub    $0x18,%esp
+  printf(stdout, "text busy test\n");
+     ab8:	68 23 47 00 00       	push   $0x4723
+     abd:	ff 35 b4 68 00 00    	push   0x68b4
+     ac3:	e8 08 36 00 00       	call   40d0 <printf>
+  fd = open("usertests", O_RDONLY);
+     ac8:	5b                   	pop    %ebx
+     ac9:	5e                   	pop    %esi
+     aca:	6a 00                	push   $0x0
+     acc:	68 33 47 00 00       	push   $0x4733
+     ad1:	e8 8d 34 00 00       	call   3f63 <open>
+  if(fd < 0 || read(fd, buf, sizeof(buf)) != sizeof(buf)){
+     ad6:	83 c4 10             	add    $0x10,%esp
+     ad9:	85 c0                	test   %eax,%eax
+     adb:	78 71                	js     b4e <textbusytest+0x9e>
+     add:	83 ec 04             	sub    $0x4,%esp
+     ae0:	8d 75 f4             	lea    -0xc(%ebp),%esi
+     ae3:	89 c3                	mov    %eax,%ebx
+     ae5:	6a 04                	push   $0x4
+     ae7:	56                   	push   %esi
+     ae8:	50                   	push   %eax
+     ae9:	e8 4d 34 00 00       	call   3f3b <read>
+     aee:	83 c4 10             	add    $0x10,%esp
+     af1:	83 f8 04             	cmp    $0x4,%eax
+     af4:	75 58                	jne    b4e <textbusytest+0x9e>
+  close(fd);
+     af6:	83 ec 0c             	sub    $0xc,%esp
+     af9:	53                   	push   %ebx
+     afa:	e8 4c 34 00 00       	call   3f4b <close>
+  fd = open("usertests", O_WRONLY);
+     aff:	58                   	pop    %eax
+     b00:	5a                   	pop    %edx
+     b01:	6a 01                	push   $0x1
+     b03:	68 33 47 00 00       	push   $0x4733
+     b08:	e8 56 34 00 00       	call   3f63 <open>
+  if(fd < 0){
+     b0d:	83 c4 10             	add    $0x10,%esp
+  fd = open("usertests", O_WRONLY);
+     b10:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     b12:	85 c0                	test   %eax,%eax
+     b14:	78 66                	js     b7c <textbusytest+0xcc>
+  if(write(fd, buf, sizeof(buf)) >= 0){
+     b16:	83 ec 04             	sub    $0x4,%esp
+     b19:	6a 04                	push   $0x4
+     b1b:	56                   	push   %esi
+     b1c:	50                   	push   %eax
+     b1d:	e8 21 34 00 00       	call   3f43 <write>
+     b22:	83 c4 10             	add    $0x10,%esp
+     b25:	85 c0                	test   %eax,%eax
+     b27:	79 3c                	jns    b65 <textbusytest+0xb5>
+  close(fd);
+     b29:	83 ec 0c             	sub    $0xc,%esp
+     b2c:	53                   	push   %ebx
+     b2d:	e8 19 34 00 00       	call   3f4b <close>
+  printf(stdout, "text busy test OK\n");
+     b32:	58                   	pop    %eax
+     b33:	5a                   	pop    %edx
+     b34:	68 70 47 00 00       	push   $0x4770
+     b39:	ff 35 b4 68 00 00    	push   0x68b4
+     b3f:	e8 8c 35 00 00       	call   40d0 <printf>
+}
+     b44:	83 c4 10             	add    $0x10,%esp
+     b47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b4a:	5b                   	pop    %ebx
+     b4b:	5e                   	pop    %esi
+     b4c:	5d                   	pop    %ebp
+     b4d:	c3                   	ret
+    printf(stdout, "cannot read usertests\n");
+     b4e:	51                   	push   %ecx
+     b4f:	51                   	push   %ecx
+     b50:	68 3d 47 00 00       	push   $0x473d
+     b55:	ff 35 b4 68 00 00    	push   0x68b4
+     b5b:	e8 70 35 00 00       	call   40d0 <printf>
+    exit();
+     b60:	e8 be 33 00 00       	call   3f23 <exit>
+    printf(stdout, "wrote to running usertests\n");
+     b65:	51                   	push   %ecx
+     b66:	51                   	push   %ecx
+     b67:	68 54 47 00 00       	push   $0x4754
+     b6c:	ff 35 b4 68 00 00    	push   0x68b4
+     b72:	e8 59 35 00 00       	call   40d0 <printf>
+    exit();
+     b77:	e8 a7 33 00 00       	call   3f23 <exit>
+    printf(stdout, "cannot open usertests for writing\n");
+     b7c:	53                   	push   %ebx
+     b7d:	53                   	push   %ebx
+     b7e:	68 30 57 00 00       	push   $0x5730
+     b83:	ff 35 b4 68 00 00    	push   0x68b4
+     b89:	e8 42 35 00 00       	call   40d0 <printf>
+    exit();
+     b8e:	e8 90 33 00 00       	call   3f23 <exit>
+     b93:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ba0 <pipe1>:
+{
+     ba0:	55                   	push   %ebp
+     ba1:	89 e5                	mov    %esp,%ebp
+     ba3:	57                   	push   %edi
+     ba4:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     ba5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     ba8:	53                   	push   %ebx
+     ba9:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     bac:	50                   	push   %eax
+     bad:	e8 81 33 00 00       	call   3f33 <pipe>
+     bb2:	83 c4 10             	add    $0x10,%esp
+     bb5:	85 c0                	test   %eax,%eax
+     bb7:	0f 85 41 01 00 00    	jne    cfe <pipe1+0x15e>
+     bbd:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     bbf:	e8 57 33 00 00       	call   3f1b <fork>
+  if(pid == 0){
+     bc4:	85 c0                	test   %eax,%eax
+     bc6:	0f 84 92 00 00 00    	je     c5e <pipe1+0xbe>
+  } else if(pid > 0){
+     bcc:	0f 8e 3f 01 00 00    	jle    d11 <pipe1+0x171>
+    close(fds[1]);
+     bd2:	83 ec 0c             	sub    $0xc,%esp
+     bd5:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     bd8:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     bda:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     bdf:	e8 67 33 00 00       	call   3f4b <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     be4:	83 c4 10             	add    $0x10,%esp
+     be7:	83 ec 04             	sub    $0x4,%esp
+     bea:	57                   	push   %edi
+     beb:	68 00 90 00 00       	push   $0x9000
+     bf0:	ff 75 e0             	push   -0x20(%ebp)
+     bf3:	e8 43 33 00 00       	call   3f3b <read>
+     bf8:	83 c4 10             	add    $0x10,%esp
+     bfb:	89 c1                	mov    %eax,%ecx
+     bfd:	85 c0                	test   %eax,%eax
+     bff:	0f 8e b8 00 00 00    	jle    cbd <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     c05:	89 f0                	mov    %esi,%eax
+     c07:	32 05 00 90 00 00    	xor    0x9000,%al
+     c0d:	0f b6 c0             	movzbl %al,%eax
+     c10:	85 c0                	test   %eax,%eax
+     c12:	75 30                	jne    c44 <pipe1+0xa4>
+     c14:	83 c6 01             	add    $0x1,%esi
+     c17:	eb 0f                	jmp    c28 <pipe1+0x88>
+     c19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c20:	38 90 00 90 00 00    	cmp    %dl,0x9000(%eax)
+     c26:	75 1c                	jne    c44 <pipe1+0xa4>
+     c28:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     c2b:	83 c0 01             	add    $0x1,%eax
+     c2e:	39 c1                	cmp    %eax,%ecx
+     c30:	75 ee                	jne    c20 <pipe1+0x80>
+      cc = cc * 2;
+     c32:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     c34:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     c39:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     c3b:	89 d6                	mov    %edx,%esi
+     c3d:	39 c7                	cmp    %eax,%edi
+     c3f:	0f 4f f8             	cmovg  %eax,%edi
+     c42:	eb a3                	jmp    be7 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     c44:	83 ec 08             	sub    $0x8,%esp
+     c47:	68 a0 47 00 00       	push   $0x47a0
+     c4c:	6a 01                	push   $0x1
+     c4e:	e8 7d 34 00 00       	call   40d0 <printf>
+     c53:	83 c4 10             	add    $0x10,%esp
+}
+     c56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c59:	5b                   	pop    %ebx
+     c5a:	5e                   	pop    %esi
+     c5b:	5f                   	pop    %edi
+     c5c:	5d                   	pop    %ebp
+     c5d:	c3                   	ret
+    close(fds[0]);
+     c5e:	83 ec 0c             	sub    $0xc,%esp
+     c61:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     c64:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     c66:	e8 e0 32 00 00       	call   3f4b <close>
+     c6b:	83 c4 10             	add    $0x10,%esp
+     c6e:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     c70:	31 c0                	xor    %eax,%eax
+     c72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     c78:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     c7b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     c7e:	88 90 ff 8f 00 00    	mov    %dl,0x8fff(%eax)
+      for(i = 0; i < 1033; i++)
+     c84:	3d 09 04 00 00       	cmp    $0x409,%eax
+     c89:	75 ed                	jne    c78 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     c8b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     c8e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     c94:	68 09 04 00 00       	push   $0x409
+     c99:	68 00 90 00 00       	push   $0x9000
+     c9e:	ff 75 e4             	push   -0x1c(%ebp)
+     ca1:	e8 9d 32 00 00       	call   3f43 <write>
+     ca6:	83 c4 10             	add    $0x10,%esp
+     ca9:	3d 09 04 00 00       	cmp    $0x409,%eax
+     cae:	75 74                	jne    d24 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     cb0:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     cb6:	75 b8                	jne    c70 <pipe1+0xd0>
+    exit();
+     cb8:	e8 66 32 00 00       	call   3f23 <exit>
+    if(total != 5 * 1033){
+     cbd:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     cc3:	75 26                	jne    ceb <pipe1+0x14b>
+    close(fds[0]);
+     cc5:	83 ec 0c             	sub    $0xc,%esp
+     cc8:	ff 75 e0             	push   -0x20(%ebp)
+     ccb:	e8 7b 32 00 00       	call   3f4b <close>
+    wait();
+     cd0:	e8 56 32 00 00       	call   3f2b <wait>
+  printf(1, "pipe1 ok\n");
+     cd5:	5a                   	pop    %edx
+     cd6:	59                   	pop    %ecx
+     cd7:	68 c5 47 00 00       	push   $0x47c5
+     cdc:	6a 01                	push   $0x1
+     cde:	e8 ed 33 00 00       	call   40d0 <printf>
+     ce3:	83 c4 10             	add    $0x10,%esp
+     ce6:	e9 6b ff ff ff       	jmp    c56 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     ceb:	56                   	push   %esi
+     cec:	53                   	push   %ebx
+     ced:	68 ae 47 00 00       	push   $0x47ae
+     cf2:	6a 01                	push   $0x1
+     cf4:	e8 d7 33 00 00       	call   40d0 <printf>
+      exit();
+     cf9:	e8 25 32 00 00       	call   3f23 <exit>
+    printf(1, "pipe() failed\n");
+     cfe:	50                   	push   %eax
+     cff:	50                   	push   %eax
+     d00:	68 83 47 00 00       	push   $0x4783
+     d05:	6a 01                	push   $0x1
+     d07:	e8 c4 33 00 00       	call   40d0 <printf>
+    exit();
+     d0c:	e8 12 32 00 00       	call   3f23 <exit>
+    printf(1, "fork() failed\n");
+     d11:	50                   	push   %eax
+     d12:	50                   	push   %eax
+     d13:	68 cf 47 00 00       	push   $0x47cf
+     d18:	6a 01                	push   $0x1
+     d1a:	e8 b1 33 00 00       	call   40d0 <printf>
+    exit();
+     d1f:	e8 ff 31 00 00       	call   3f23 <exit>
+        printf(1, "pipe1 oops 1\n");
+     d24:	57                   	push   %edi
+     d25:	57                   	push   %edi
+     d26:	68 92 47 00 00       	push   $0x4792
+     d2b:	6a 01                	push   $0x1
+     d2d:	e8 9e 33 00 00       	call   40d0 <printf>
+        exit();
+     d32:	e8 ec 31 00 00       	call   3f23 <exit>
+     d37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d3e:	66 90                	xchg   %ax,%ax
+
+00000d40 <preempt>:
+{
+     d40:	55                   	push   %ebp
+     d41:	89 e5                	mov    %esp,%ebp
+     d43:	57                   	push   %edi
+     d44:	56                   	push   %esi
+     d45:	53                   	push   %ebx
+     d46:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     d49:	68 de 47 00 00       	push   $0x47de
+     d4e:	6a 01                	push   $0x1
+     d50:	e8 7b 33 00 00       	call   40d0 <printf>
+  pid1 = fork();
+     d55:	e8 c1 31 00 00       	call   3f1b <fork>
+  if(pid1 == 0)
+     d5a:	83 c4 10             	add    $0x10,%esp
+     d5d:	85 c0                	test   %eax,%eax
+     d5f:	75 07                	jne    d68 <preempt+0x28>
+    for(;;)
+     d61:	eb fe                	jmp    d61 <preempt+0x21>
+     d63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d67:	90                   	nop
+     d68:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     d6a:	e8 ac 31 00 00       	call   3f1b <fork>
+     d6f:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     d71:	85 c0                	test   %eax,%eax
+     d73:	75 0b                	jne    d80 <preempt+0x40>
+    for(;;)
+     d75:	eb fe                	jmp    d75 <preempt+0x35>
+     d77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d7e:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     d80:	83 ec 0c             	sub    $0xc,%esp
+     d83:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     d86:	50                   	push   %eax
+     d87:	e8 a7 31 00 00       	call   3f33 <pipe>
+  pid3 = fork();
+     d8c:	e8 8a 31 00 00       	call   3f1b <fork>
+  if(pid3 == 0){
+     d91:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     d94:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     d96:	85 c0                	test   %eax,%eax
+     d98:	75 3e                	jne    dd8 <preempt+0x98>
+    close(pfds[0]);
+     d9a:	83 ec 0c             	sub    $0xc,%esp
+     d9d:	ff 75 e0             	push   -0x20(%ebp)
+     da0:	e8 a6 31 00 00       	call   3f4b <close>
+    if(write(pfds[1], "x", 1) != 1)
+     da5:	83 c4 0c             	add    $0xc,%esp
+     da8:	6a 01                	push   $0x1
+     daa:	68 6c 55 00 00       	push   $0x556c
+     daf:	ff 75 e4             	push   -0x1c(%ebp)
+     db2:	e8 8c 31 00 00       	call   3f43 <write>
+     db7:	83 c4 10             	add    $0x10,%esp
+     dba:	83 f8 01             	cmp    $0x1,%eax
+     dbd:	0f 85 b8 00 00 00    	jne    e7b <preempt+0x13b>
+    close(pfds[1]);
+     dc3:	83 ec 0c             	sub    $0xc,%esp
+     dc6:	ff 75 e4             	push   -0x1c(%ebp)
+     dc9:	e8 7d 31 00 00       	call   3f4b <close>
+     dce:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     dd1:	eb fe                	jmp    dd1 <preempt+0x91>
+     dd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     dd7:	90                   	nop
+  close(pfds[1]);
+     dd8:	83 ec 0c             	sub    $0xc,%esp
+     ddb:	ff 75 e4             	push   -0x1c(%ebp)
+     dde:	e8 68 31 00 00       	call   3f4b <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     de3:	83 c4 0c             	add    $0xc,%esp
+     de6:	68 00 20 00 00       	push   $0x2000
+     deb:	68 00 90 00 00       	push   $0x9000
+     df0:	ff 75 e0             	push   -0x20(%ebp)
+     df3:	e8 43 31 00 00       	call   3f3b <read>
+     df8:	83 c4 10             	add    $0x10,%esp
+     dfb:	83 f8 01             	cmp    $0x1,%eax
+     dfe:	75 67                	jne    e67 <preempt+0x127>
+  close(pfds[0]);
+     e00:	83 ec 0c             	sub    $0xc,%esp
+     e03:	ff 75 e0             	push   -0x20(%ebp)
+     e06:	e8 40 31 00 00       	call   3f4b <close>
+  printf(1, "kill... ");
+     e0b:	58                   	pop    %eax
+     e0c:	5a                   	pop    %edx
+     e0d:	68 0f 48 00 00       	push   $0x480f
+     e12:	6a 01                	push   $0x1
+     e14:	e8 b7 32 00 00       	call   40d0 <printf>
+  kill(pid1);
+     e19:	89 1c 24             	mov    %ebx,(%esp)
+     e1c:	e8 32 31 00 00       	call   3f53 <kill>
+  kill(pid2);
+     e21:	89 34 24             	mov    %esi,(%esp)
+     e24:	e8 2a 31 00 00       	call   3f53 <kill>
+  kill(pid3);
+     e29:	89 3c 24             	mov    %edi,(%esp)
+     e2c:	e8 22 31 00 00       	call   3f53 <kill>
+  printf(1, "wait... ");
+     e31:	59                   	pop    %ecx
+     e32:	5b                   	pop    %ebx
+     e33:	68 18 48 00 00       	push   $0x4818
+     e38:	6a 01                	push   $0x1
+     e3a:	e8 91 32 00 00       	call   40d0 <printf>
+  wait();
+     e3f:	e8 e7 30 00 00       	call   3f2b <wait>
+  wait();
+     e44:	e8 e2 30 00 00       	call   3f2b <wait>
+  wait();
+     e49:	e8 dd 30 00 00       	call   3f2b <wait>
+  printf(1, "preempt ok\n");
+     e4e:	5e                   	pop    %esi
+     e4f:	5f                   	pop    %edi
+     e50:	68 21 48 00 00       	push   $0x4821
+     e55:	6a 01                	push   $0x1
+     e57:	e8 74 32 00 00       	call   40d0 <printf>
+     e5c:	83 c4 10             	add    $0x10,%esp
+}
+     e5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e62:	5b                   	pop    %ebx
+     e63:	5e                   	pop    %esi
+     e64:	5f                   	pop    %edi
+     e65:	5d                   	pop    %ebp
+     e66:	c3                   	ret
+    printf(1, "preempt read error");
+     e67:	83 ec 08             	sub    $0x8,%esp
+     e6a:	68 fc 47 00 00       	push   $0x47fc
+     e6f:	6a 01                	push   $0x1
+     e71:	e8 5a 32 00 00       	call   40d0 <printf>
+     e76:	83 c4 10             	add    $0x10,%esp
+     e79:	eb e4                	jmp    e5f <preempt+0x11f>
+      printf(1, "preempt write error");
+     e7b:	83 ec 08             	sub    $0x8,%esp
+     e7e:	68 e8 47 00 00       	push   $0x47e8
+     e83:	6a 01                	push   $0x1
+     e85:	e8 46 32 00 00       	call   40d0 <printf>
+     e8a:	83 c4 10             	add    $0x10,%esp
+     e8d:	e9 31 ff ff ff       	jmp    dc3 <preempt+0x83>
+     e92:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ea0 <exitwait>:
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	56                   	push   %esi
+     ea4:	be 64 00 00 00       	mov    $0x64,%esi
+     ea9:	53                   	push   %ebx
+     eaa:	eb 14                	jmp    ec0 <exitwait+0x20>
+     eac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     eb0:	74 68                	je     f1a <exitwait+0x7a>
+      if(wait() != pid){
+     eb2:	e8 74 30 00 00       	call   3f2b <wait>
+     eb7:	39 d8                	cmp    %ebx,%eax
+     eb9:	75 2d                	jne    ee8 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     ebb:	83 ee 01             	sub    $0x1,%esi
+     ebe:	74 41                	je     f01 <exitwait+0x61>
+    pid = fork();
+     ec0:	e8 56 30 00 00       	call   3f1b <fork>
+     ec5:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     ec7:	85 c0                	test   %eax,%eax
+     ec9:	79 e5                	jns    eb0 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     ecb:	83 ec 08             	sub    $0x8,%esp
+     ece:	68 97 48 00 00       	push   $0x4897
+     ed3:	6a 01                	push   $0x1
+     ed5:	e8 f6 31 00 00       	call   40d0 <printf>
+      return;
+     eda:	83 c4 10             	add    $0x10,%esp
+}
+     edd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ee0:	5b                   	pop    %ebx
+     ee1:	5e                   	pop    %esi
+     ee2:	5d                   	pop    %ebp
+     ee3:	c3                   	ret
+     ee4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     ee8:	83 ec 08             	sub    $0x8,%esp
+     eeb:	68 2d 48 00 00       	push   $0x482d
+     ef0:	6a 01                	push   $0x1
+     ef2:	e8 d9 31 00 00       	call   40d0 <printf>
+        return;
+     ef7:	83 c4 10             	add    $0x10,%esp
+}
+     efa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     efd:	5b                   	pop    %ebx
+     efe:	5e                   	pop    %esi
+     eff:	5d                   	pop    %ebp
+     f00:	c3                   	ret
+  printf(1, "exitwait ok\n");
+     f01:	83 ec 08             	sub    $0x8,%esp
+     f04:	68 3d 48 00 00       	push   $0x483d
+     f09:	6a 01                	push   $0x1
+     f0b:	e8 c0 31 00 00       	call   40d0 <printf>
+     f10:	83 c4 10             	add    $0x10,%esp
+}
+     f13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f16:	5b                   	pop    %ebx
+     f17:	5e                   	pop    %esi
+     f18:	5d                   	pop    %ebp
+     f19:	c3                   	ret
+      exit();
+     f1a:	e8 04 30 00 00       	call   3f23 <exit>
+     f1f:	90                   	nop
+
+00000f20 <mem>:
+{
+     f20:	55                   	push   %ebp
+     f21:	89 e5                	mov    %esp,%ebp
+     f23:	56                   	push   %esi
+     f24:	31 f6                	xor    %esi,%esi
+     f26:	53                   	push   %ebx
+  printf(1, "mem test\n");
+     f27:	83 ec 08             	sub    $0x8,%esp
+     f2a:	68 4a 48 00 00       	push   $0x484a
+     f2f:	6a 01                	push   $0x1
+     f31:	e8 9a 31 00 00       	call   40d0 <printf>
+  ppid = getpid();
+     f36:	e8 68 30 00 00       	call   3fa3 <getpid>
+     f3b:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+     f3d:	e8 d9 2f 00 00       	call   3f1b <fork>
+     f42:	83 c4 10             	add    $0x10,%esp
+     f45:	85 c0                	test   %eax,%eax
+     f47:	74 0b                	je     f54 <mem+0x34>
+     f49:	e9 8a 00 00 00       	jmp    fd8 <mem+0xb8>
+     f4e:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+     f50:	89 30                	mov    %esi,(%eax)
+     f52:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+     f54:	83 ec 0c             	sub    $0xc,%esp
+     f57:	68 11 27 00 00       	push   $0x2711
+     f5c:	e8 af 33 00 00       	call   4310 <malloc>
+     f61:	83 c4 10             	add    $0x10,%esp
+     f64:	85 c0                	test   %eax,%eax
+     f66:	75 e8                	jne    f50 <mem+0x30>
+    while(m1){
+     f68:	85 f6                	test   %esi,%esi
+     f6a:	74 18                	je     f84 <mem+0x64>
+     f6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+     f70:	89 f0                	mov    %esi,%eax
+      free(m1);
+     f72:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+     f75:	8b 36                	mov    (%esi),%esi
+      free(m1);
+     f77:	50                   	push   %eax
+     f78:	e8 03 33 00 00       	call   4280 <free>
+    while(m1){
+     f7d:	83 c4 10             	add    $0x10,%esp
+     f80:	85 f6                	test   %esi,%esi
+     f82:	75 ec                	jne    f70 <mem+0x50>
+    m1 = malloc(1024*20);
+     f84:	83 ec 0c             	sub    $0xc,%esp
+     f87:	68 00 50 00 00       	push   $0x5000
+     f8c:	e8 7f 33 00 00       	call   4310 <malloc>
+    if(m1 == 0){
+     f91:	83 c4 10             	add    $0x10,%esp
+     f94:	85 c0                	test   %eax,%eax
+     f96:	74 20                	je     fb8 <mem+0x98>
+    free(m1);
+     f98:	83 ec 0c             	sub    $0xc,%esp
+     f9b:	50                   	push   %eax
+     f9c:	e8 df 32 00 00       	call   4280 <free>
+    printf(1, "mem ok\n");
+     fa1:	58                   	pop    %eax
+     fa2:	5a                   	pop    %edx
+     fa3:	68 6e 48 00 00       	push   $0x486e
+     fa8:	6a 01                	push   $0x1
+     faa:	e8 21 31 00 00       	call   40d0 <printf>
+    exit();
+     faf:	e8 6f 2f 00 00       	call   3f23 <exit>
+     fb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+     fb8:	83 ec 08             	sub    $0x8,%esp
+     fbb:	68 54 48 00 00       	push   $0x4854
+     fc0:	6a 01                	push   $0x1
+     fc2:	e8 09 31 00 00       	call   40d0 <printf>
+      kill(ppid);
+     fc7:	89 1c 24             	mov    %ebx,(%esp)
+     fca:	e8 84 2f 00 00       	call   3f53 <kill>
+      exit();
+     fcf:	e8 4f 2f 00 00       	call   3f23 <exit>
+     fd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+     fd8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     fdb:	5b                   	pop    %ebx
+     fdc:	5e                   	pop    %esi
+     fdd:	5d                   	pop    %ebp
+    wait();
+     fde:	e9 48 2f 00 00       	jmp    3f2b <wait>
+     fe3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ff0 <allocstress>:
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	57                   	push   %edi
+  start = uptime();
+     ff4:	bf 08 00 00 00       	mov    $0x8,%edi
+{
+     ff9:	56                   	push   %esi
+     ffa:	53                   	push   %ebx
+     ffb:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "alloc stress test\n");
+     ffe:	68 76 48 00 00       	push   $0x4876
+    1003:	6a 01                	push   $0x1
+    1005:	e8 c6 30 00 00       	call   40d0 <printf>
+  start = uptime();
+    100a:	e8 ac 2f 00 00       	call   3fbb <uptime>
+    100f:	83 c4 10             	add    $0x10,%esp
+    1012:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    1014:	e8 02 2f 00 00       	call   3f1b <fork>
+    1019:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    101b:	85 c0                	test   %eax,%eax
+    101d:	0f 88 d9 00 00 00    	js     10fc <allocstress+0x10c>
+    if(pid > 0)
+    1023:	75 2b                	jne    1050 <allocstress+0x60>
+    1025:	8d 76 00             	lea    0x0(%esi),%esi
+      if((pid = fork()) == 0){
+    1028:	e8 ee 2e 00 00       	call   3f1b <fork>
+    102d:	85 c0                	test   %eax,%eax
+    102f:	0f 84 83 00 00 00    	je     10b8 <allocstress+0xc8>
+      if(pid < 0){
+    1035:	0f 88 c1 00 00 00    	js     10fc <allocstress+0x10c>
+      wait();
+    103b:	e8 eb 2e 00 00       	call   3f2b <wait>
+    for(r = 0; r < STRESSROUNDS; r++){
+    1040:	83 c3 01             	add    $0x1,%ebx
+    1043:	83 fb 08             	cmp    $0x8,%ebx
+    1046:	75 e0                	jne    1028 <allocstress+0x38>
+        exit();
+    1048:	e8 d6 2e 00 00       	call   3f23 <exit>
+    104d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; i < NCPU; i++){
+    1050:	83 ef 01             	sub    $0x1,%edi
+    1053:	75 bf                	jne    1014 <allocstress+0x24>
+    1055:	bb 08 00 00 00       	mov    $0x8,%ebx
+    105a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+    1060:	e8 c6 2e 00 00       	call   3f2b <wait>
+  for(i = 0; i < NCPU; i++)
+    1065:	83 eb 01             	sub    $0x1,%ebx
+    1068:	75 f6                	jne    1060 <allocstress+0x70>
+  elapsed = uptime() - start;
+    106a:	e8 4c 2f 00 00       	call   3fbb <uptime>
+    106f:	29 f0                	sub    %esi,%eax
+    1071:	89 c1                	mov    %eax,%ecx
+    1073:	b8 01 00 00 00       	mov    $0x1,%eax
+    1078:	0f 44 c8             	cmove  %eax,%ecx
+  printf(1, "alloc stress: %d pages in %d ticks, %d pages/tick\n",
+    107b:	b8 00 40 00 00       	mov    $0x4000,%eax
+    1080:	31 d2                	xor    %edx,%edx
+    1082:	83 ec 0c             	sub    $0xc,%esp
+    1085:	f7 f1                	div    %ecx
+    1087:	50                   	push   %eax
+    1088:	51                   	push   %ecx
+    1089:	68 00 40 00 00       	push   $0x4000
+    108e:	68 54 57 00 00       	push   $0x5754
+    1093:	6a 01                	push   $0x1
+    1095:	e8 36 30 00 00       	call   40d0 <printf>
+  printf(1, "alloc stress ok\n");
+    109a:	83 c4 18             	add    $0x18,%esp
+    109d:	68 bf 48 00 00       	push   $0x48bf
+    10a2:	6a 01                	push   $0x1
+    10a4:	e8 27 30 00 00       	call   40d0 <printf>
+}
+    10a9:	83 c4 10             	add    $0x10,%esp
+    10ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10af:	5b                   	pop    %ebx
+    10b0:	5e                   	pop    %esi
+    10b1:	5f                   	pop    %edi
+    10b2:	5d                   	pop    %ebp
+    10b3:	c3                   	ret
+    10b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        a = sbrk(STRESSPAGES*4096);
+    10b8:	83 ec 0c             	sub    $0xc,%esp
+    10bb:	68 00 00 10 00       	push   $0x100000
+    10c0:	e8 e6 2e 00 00       	call   3fab <sbrk>
+        if(a == (char*)-1){
+    10c5:	83 c4 10             	add    $0x10,%esp
+    10c8:	83 f8 ff             	cmp    $0xffffffff,%eax
+    10cb:	74 1b                	je     10e8 <allocstress+0xf8>
+        for(p = a; p < a + STRESSPAGES*4096; p += 4096)
+    10cd:	8d 90 00 00 10 00    	lea    0x100000(%eax),%edx
+    10d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10d7:	90                   	nop
+          *p = r;
+    10d8:	88 18                	mov    %bl,(%eax)
+        for(p = a; p < a + STRESSPAGES*4096; p += 4096)
+    10da:	05 00 10 00 00       	add    $0x1000,%eax
+    10df:	39 d0                	cmp    %edx,%eax
+    10e1:	75 f5                	jne    10d8 <allocstress+0xe8>
+        exit();
+    10e3:	e8 3b 2e 00 00       	call   3f23 <exit>
+          printf(1, "alloc stress: sbrk failed\n");
+    10e8:	83 ec 08             	sub    $0x8,%esp
+    10eb:	68 a4 48 00 00       	push   $0x48a4
+    10f0:	6a 01                	push   $0x1
+    10f2:	e8 d9 2f 00 00       	call   40d0 <printf>
+          exit();
+    10f7:	e8 27 2e 00 00       	call   3f23 <exit>
+      printf(1, "alloc stress: fork failed\n");
+    10fc:	83 ec 08             	sub    $0x8,%esp
+    10ff:	68 89 48 00 00       	push   $0x4889
+    1104:	6a 01                	push   $0x1
+    1106:	e8 c5 2f 00 00       	call   40d0 <printf>
+      exit();
+    110b:	e8 13 2e 00 00       	call   3f23 <exit>
+
+00001110 <sharedfd>:
+{
+    1110:	55                   	push   %ebp
+    1111:	89 e5                	mov    %esp,%ebp
+    1113:	57                   	push   %edi
+    1114:	56                   	push   %esi
+    1115:	53                   	push   %ebx
+    1116:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+    1119:	68 d0 48 00 00       	push   $0x48d0
+    111e:	6a 01                	push   $0x1
+    1120:	e8 ab 2f 00 00       	call   40d0 <printf>
+  unlink("sharedfd");
+    1125:	c7 04 24 df 48 00 00 	movl   $0x48df,(%esp)
+    112c:	e8 42 2e 00 00       	call   3f73 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    1131:	5b                   	pop    %ebx
+    1132:	5e                   	pop    %esi
+    1133:	68 02 02 00 00       	push   $0x202
+    1138:	68 df 48 00 00       	push   $0x48df
+    113d:	e8 21 2e 00 00       	call   3f63 <open>
+  if(fd < 0){
+    1142:	83 c4 10             	add    $0x10,%esp
+    1145:	85 c0                	test   %eax,%eax
+    1147:	0f 88 2a 01 00 00    	js     1277 <sharedfd+0x167>
+    114d:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    114f:	8d 75 de             	lea    -0x22(%ebp),%esi
+    1152:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+    1157:	e8 bf 2d 00 00       	call   3f1b <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    115c:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+    115f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    1162:	19 c0                	sbb    %eax,%eax
+    1164:	83 ec 04             	sub    $0x4,%esp
+    1167:	83 e0 f3             	and    $0xfffffff3,%eax
+    116a:	6a 0a                	push   $0xa
+    116c:	83 c0 70             	add    $0x70,%eax
+    116f:	50                   	push   %eax
+    1170:	56                   	push   %esi
+    1171:	e8 2a 2c 00 00       	call   3da0 <memset>
+    1176:	83 c4 10             	add    $0x10,%esp
+    1179:	eb 0a                	jmp    1185 <sharedfd+0x75>
+    117b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    117f:	90                   	nop
+  for(i = 0; i < 1000; i++){
+    1180:	83 eb 01             	sub    $0x1,%ebx
+    1183:	74 26                	je     11ab <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    1185:	83 ec 04             	sub    $0x4,%esp
+    1188:	6a 0a                	push   $0xa
+    118a:	56                   	push   %esi
+    118b:	57                   	push   %edi
+    118c:	e8 b2 2d 00 00       	call   3f43 <write>
+    1191:	83 c4 10             	add    $0x10,%esp
+    1194:	83 f8 0a             	cmp    $0xa,%eax
+    1197:	74 e7                	je     1180 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    1199:	83 ec 08             	sub    $0x8,%esp
+    119c:	68 b4 57 00 00       	push   $0x57b4
+    11a1:	6a 01                	push   $0x1
+    11a3:	e8 28 2f 00 00       	call   40d0 <printf>
+      break;
+    11a8:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    11ab:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    11ae:	85 c9                	test   %ecx,%ecx
+    11b0:	0f 84 f5 00 00 00    	je     12ab <sharedfd+0x19b>
+    wait();
+    11b6:	e8 70 2d 00 00       	call   3f2b <wait>
+  close(fd);
+    11bb:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    11be:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    11c0:	57                   	push   %edi
+    11c1:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    11c4:	e8 82 2d 00 00       	call   3f4b <close>
+  fd = open("sharedfd", 0);
+    11c9:	58                   	pop    %eax
+    11ca:	5a                   	pop    %edx
+    11cb:	6a 00                	push   $0x0
+    11cd:	68 df 48 00 00       	push   $0x48df
+    11d2:	e8 8c 2d 00 00       	call   3f63 <open>
+  if(fd < 0){
+    11d7:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    11da:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    11dc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    11df:	85 c0                	test   %eax,%eax
+    11e1:	0f 88 aa 00 00 00    	js     1291 <sharedfd+0x181>
+    11e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11ee:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    11f0:	83 ec 04             	sub    $0x4,%esp
+    11f3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    11f6:	6a 0a                	push   $0xa
+    11f8:	56                   	push   %esi
+    11f9:	ff 75 d0             	push   -0x30(%ebp)
+    11fc:	e8 3a 2d 00 00       	call   3f3b <read>
+    1201:	83 c4 10             	add    $0x10,%esp
+    1204:	85 c0                	test   %eax,%eax
+    1206:	7e 28                	jle    1230 <sharedfd+0x120>
+    1208:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    120b:	89 f0                	mov    %esi,%eax
+    120d:	eb 13                	jmp    1222 <sharedfd+0x112>
+    120f:	90                   	nop
+        np++;
+    1210:	80 f9 70             	cmp    $0x70,%cl
+    1213:	0f 94 c1             	sete   %cl
+    1216:	0f b6 c9             	movzbl %cl,%ecx
+    1219:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    121b:	83 c0 01             	add    $0x1,%eax
+    121e:	39 f8                	cmp    %edi,%eax
+    1220:	74 ce                	je     11f0 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    1222:	0f b6 08             	movzbl (%eax),%ecx
+    1225:	80 f9 63             	cmp    $0x63,%cl
+    1228:	75 e6                	jne    1210 <sharedfd+0x100>
+        nc++;
+    122a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    122d:	eb ec                	jmp    121b <sharedfd+0x10b>
+    122f:	90                   	nop
+  close(fd);
+    1230:	83 ec 0c             	sub    $0xc,%esp
+    1233:	ff 75 d0             	push   -0x30(%ebp)
+    1236:	e8 10 2d 00 00       	call   3f4b <close>
+  unlink("sharedfd");
+    123b:	c7 04 24 df 48 00 00 	movl   $0x48df,(%esp)
+    1242:	e8 2c 2d 00 00       	call   3f73 <unlink>
+  if(nc == 10000 && np == 10000){
+    1247:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    124a:	83 c4 10             	add    $0x10,%esp
+    124d:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    1253:	75 5b                	jne    12b0 <sharedfd+0x1a0>
+    1255:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    125b:	75 53                	jne    12b0 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    125d:	83 ec 08             	sub    $0x8,%esp
+    1260:	68 e8 48 00 00       	push   $0x48e8
+    1265:	6a 01                	push   $0x1
+    1267:	e8 64 2e 00 00       	call   40d0 <printf>
+    126c:	83 c4 10             	add    $0x10,%esp
+}
+    126f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1272:	5b                   	pop    %ebx
+    1273:	5e                   	pop    %esi
+    1274:	5f                   	pop    %edi
+    1275:	5d                   	pop    %ebp
+    1276:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    1277:	83 ec 08             	sub    $0x8,%esp
+    127a:	68 88 57 00 00       	push   $0x5788
+    127f:	6a 01                	push   $0x1
+    1281:	e8 4a 2e 00 00       	call   40d0 <printf>
+    return;
+    1286:	83 c4 10             	add    $0x10,%esp
+}
+    1289:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    128c:	5b                   	pop    %ebx
+    128d:	5e                   	pop    %esi
+    128e:	5f                   	pop    %edi
+    128f:	5d                   	pop    %ebp
+    1290:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1291:	83 ec 08             	sub    $0x8,%esp
+    1294:	68 d4 57 00 00       	push   $0x57d4
+    1299:	6a 01                	push   $0x1
+    129b:	e8 30 2e 00 00       	call   40d0 <printf>
+    return;
+    12a0:	83 c4 10             	add    $0x10,%esp
+}
+    12a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12a6:	5b                   	pop    %ebx
+    12a7:	5e                   	pop    %esi
+    12a8:	5f                   	pop    %edi
+    12a9:	5d                   	pop    %ebp
+    12aa:	c3                   	ret
+    exit();
+    12ab:	e8 73 2c 00 00       	call   3f23 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    12b0:	53                   	push   %ebx
+    12b1:	52                   	push   %edx
+    12b2:	68 f5 48 00 00       	push   $0x48f5
+    12b7:	6a 01                	push   $0x1
+    12b9:	e8 12 2e 00 00       	call   40d0 <printf>
+    exit();
+    12be:	e8 60 2c 00 00       	call   3f23 <exit>
+    12c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000012d0 <twofiles>:
+{
+    12d0:	55                   	push   %ebp
+    12d1:	89 e5                	mov    %esp,%ebp
+    12d3:	57                   	push   %edi
+    12d4:	56                   	push   %esi
+    12d5:	53                   	push   %ebx
+    12d6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "twofiles test\n");
+    12d9:	68 0a 49 00 00       	push   $0x490a
+    12de:	6a 01                	push   $0x1
+    12e0:	e8 eb 2d 00 00       	call   40d0 <printf>
+  unlink("f1");
+    12e5:	c7 04 24 4b 4a 00 00 	movl   $0x4a4b,(%esp)
+    12ec:	e8 82 2c 00 00       	call   3f73 <unlink>
+  unlink("f2");
+    12f1:	c7 04 24 4f 4a 00 00 	movl   $0x4a4f,(%esp)
+    12f8:	e8 76 2c 00 00       	call   3f73 <unlink>
+  pid = fork();
+    12fd:	e8 19 2c 00 00       	call   3f1b <fork>
+  if(pid < 0){
+    1302:	83 c4 10             	add    $0x10,%esp
+    1305:	85 c0                	test   %eax,%eax
+    1307:	0f 88 a3 01 00 00    	js     14b0 <twofiles+0x1e0>
+    130d:	89 c7                	mov    %eax,%edi
+  fname = pid ? "f1" : "f2";
+    130f:	0f 85 ed 00 00 00    	jne    1402 <twofiles+0x132>
+  fd = open(fname, O_CREATE | O_RDWR);
+    1315:	83 ec 08             	sub    $0x8,%esp
+    1318:	68 02 02 00 00       	push   $0x202
+    131d:	68 4f 4a 00 00       	push   $0x4a4f
+    1322:	e8 3c 2c 00 00       	call   3f63 <open>
+  if(fd < 0){
+    1327:	83 c4 10             	add    $0x10,%esp
+  fd = open(fname, O_CREATE | O_RDWR);
+    132a:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    132c:	85 c0                	test   %eax,%eax
+    132e:	0f 88 8f 01 00 00    	js     14c3 <twofiles+0x1f3>
+  memset(buf, pid?'p':'c', 512);
+    1334:	b8 63 00 00 00       	mov    $0x63,%eax
+    1339:	83 ec 04             	sub    $0x4,%esp
+    133c:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    1341:	68 00 02 00 00       	push   $0x200
+    1346:	50                   	push   %eax
+    1347:	68 00 90 00 00       	push   $0x9000
+    134c:	e8 4f 2a 00 00       	call   3da0 <memset>
+    1351:	83 c4 10             	add    $0x10,%esp
+    1354:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((n = write(fd, buf, 500)) != 500){
+    1358:	83 ec 04             	sub    $0x4,%esp
+    135b:	68 f4 01 00 00       	push   $0x1f4
+    1360:	68 00 90 00 00       	push   $0x9000
+    1365:	56                   	push   %esi
+    1366:	e8 d8 2b 00 00       	call   3f43 <write>
+    136b:	83 c4 10             	add    $0x10,%esp
+    136e:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    1373:	0f 85 67 01 00 00    	jne    14e0 <twofiles+0x210>
+  for(i = 0; i < 12; i++){
+    1379:	83 eb 01             	sub    $0x1,%ebx
+    137c:	75 da                	jne    1358 <twofiles+0x88>
+  close(fd);
+    137e:	83 ec 0c             	sub    $0xc,%esp
+    1381:	56                   	push   %esi
+    1382:	e8 c4 2b 00 00       	call   3f4b <close>
+  if(pid)
+    1387:	83 c4 10             	add    $0x10,%esp
+    138a:	85 ff                	test   %edi,%edi
+    138c:	0f 84 06 01 00 00    	je     1498 <twofiles+0x1c8>
+    wait();
+    1392:	e8 94 2b 00 00       	call   3f2b <wait>
+  for(i = 0; i < 2; i++){
+    1397:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    fd = open(i?"f1":"f2", 0);
+    139e:	b8 4f 4a 00 00       	mov    $0x4a4f,%eax
+    13a3:	83 ec 08             	sub    $0x8,%esp
+    13a6:	6a 00                	push   $0x0
+    13a8:	50                   	push   %eax
+    13a9:	e8 b5 2b 00 00       	call   3f63 <open>
+    13ae:	83 c4 10             	add    $0x10,%esp
+    13b1:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    13b5:	19 f6                	sbb    %esi,%esi
+    13b7:	89 c7                	mov    %eax,%edi
+    total = 0;
+    13b9:	31 db                	xor    %ebx,%ebx
+    13bb:	83 e6 f3             	and    $0xfffffff3,%esi
+    13be:	83 c6 70             	add    $0x70,%esi
+    13c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    13c8:	83 ec 04             	sub    $0x4,%esp
+    13cb:	68 00 20 00 00       	push   $0x2000
+    13d0:	68 00 90 00 00       	push   $0x9000
+    13d5:	57                   	push   %edi
+    13d6:	e8 60 2b 00 00       	call   3f3b <read>
+    13db:	83 c4 10             	add    $0x10,%esp
+    13de:	85 c0                	test   %eax,%eax
+    13e0:	7e 49                	jle    142b <twofiles+0x15b>
+      for(j = 0; j < n; j++){
+    13e2:	31 d2                	xor    %edx,%edx
+    13e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        if(buf[j] != (i?'p':'c')){
+    13e8:	0f be 8a 00 90 00 00 	movsbl 0x9000(%edx),%ecx
+    13ef:	39 f1                	cmp    %esi,%ecx
+    13f1:	0f 85 8d 00 00 00    	jne    1484 <twofiles+0x1b4>
+      for(j = 0; j < n; j++){
+    13f7:	83 c2 01             	add    $0x1,%edx
+    13fa:	39 d0                	cmp    %edx,%eax
+    13fc:	75 ea                	jne    13e8 <twofiles+0x118>
+      total += n;
+    13fe:	01 c3                	add    %eax,%ebx
+    1400:	eb c6                	jmp    13c8 <twofiles+0xf8>
+  fd = open(fname, O_CREATE | O_RDWR);
+    1402:	83 ec 08             	sub    $0x8,%esp
+    1405:	68 02 02 00 00       	push   $0x202
+    140a:	68 4b 4a 00 00       	push   $0x4a4b
+    140f:	e8 4f 2b 00 00       	call   3f63 <open>
+  if(fd < 0){
+    1414:	83 c4 10             	add    $0x10,%esp
+  fd = open(fname, O_CREATE | O_RDWR);
+    1417:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    1419:	85 c0                	test   %eax,%eax
+    141b:	0f 88 a2 00 00 00    	js     14c3 <twofiles+0x1f3>
+  memset(buf, pid?'p':'c', 512);
+    1421:	b8 70 00 00 00       	mov    $0x70,%eax
+    1426:	e9 0e ff ff ff       	jmp    1339 <twofiles+0x69>
+    close(fd);
+    142b:	83 ec 0c             	sub    $0xc,%esp
+    142e:	57                   	push   %edi
+    142f:	e8 17 2b 00 00       	call   3f4b <close>
+    if(total != 12*500){
+    1434:	83 c4 10             	add    $0x10,%esp
+    1437:	81 fb 70 17 00 00    	cmp    $0x1770,%ebx
+    143d:	75 5e                	jne    149d <twofiles+0x1cd>
+  for(i = 0; i < 2; i++){
+    143f:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    fd = open(i?"f1":"f2", 0);
+    1443:	b8 4b 4a 00 00       	mov    $0x4a4b,%eax
+  for(i = 0; i < 2; i++){
+    1448:	74 0c                	je     1456 <twofiles+0x186>
+    144a:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+    1451:	e9 4d ff ff ff       	jmp    13a3 <twofiles+0xd3>
+  unlink("f1");
+    1456:	83 ec 0c             	sub    $0xc,%esp
+    1459:	50                   	push   %eax
+    145a:	e8 14 2b 00 00       	call   3f73 <unlink>
+  unlink("f2");
+    145f:	c7 04 24 4f 4a 00 00 	movl   $0x4a4f,(%esp)
+    1466:	e8 08 2b 00 00       	call   3f73 <unlink>
+  printf(1, "twofiles ok\n");
+    146b:	58                   	pop    %eax
+    146c:	5a                   	pop    %edx
+    146d:	68 47 49 00 00       	push   $0x4947
+    1472:	6a 01                	push   $0x1
+    1474:	e8 57 2c 00 00       	call   40d0 <printf>
+}
+    1479:	83 c4 10             	add    $0x10,%esp
+    147c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    147f:	5b                   	pop    %ebx
+    1480:	5e                   	pop    %esi
+    1481:	5f                   	pop    %edi
+    1482:	5d                   	pop    %ebp
+    1483:	c3                   	ret
+          printf(1, "wrong char\n");
+    1484:	83 ec 08             	sub    $0x8,%esp
+    1487:	68 2a 49 00 00       	push   $0x492a
+    148c:	6a 01                	push   $0x1
+    148e:	e8 3d 2c 00 00       	call   40d0 <printf>
+          exit();
+    1493:	e8 8b 2a 00 00       	call   3f23 <exit>
+    exit();
+    1498:	e8 86 2a 00 00       	call   3f23 <exit>
+      printf(1, "wrong length %d\n", total);
+    149d:	51                   	push   %ecx
+    149e:	53                   	push   %ebx
+    149f:	68 36 49 00 00       	push   $0x4936
+    14a4:	6a 01                	push   $0x1
+    14a6:	e8 25 2c 00 00       	call   40d0 <printf>
+      exit();
+    14ab:	e8 73 2a 00 00       	call   3f23 <exit>
+    printf(1, "fork failed\n");
+    14b0:	56                   	push   %esi
+    14b1:	56                   	push   %esi
+    14b2:	68 97 48 00 00       	push   $0x4897
+    14b7:	6a 01                	push   $0x1
+    14b9:	e8 12 2c 00 00       	call   40d0 <printf>
+    exit();
+    14be:	e8 60 2a 00 00       	call   3f23 <exit>
+    printf(1, "create failed\n");
+    14c3:	53                   	push   %ebx
+    14c4:	53                   	push   %ebx
+    14c5:	68 a3 4b 00 00       	push   $0x4ba3
+    14ca:	6a 01                	push   $0x1
+    14cc:	e8 ff 2b 00 00       	call   40d0 <printf>
+    exit();
+    14d1:	e8 4d 2a 00 00       	call   3f23 <exit>
+    14d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14dd:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(1, "write failed %d\n", n);
+    14e0:	83 ec 04             	sub    $0x4,%esp
+    14e3:	50                   	push   %eax
+    14e4:	68 19 49 00 00       	push   $0x4919
+    14e9:	6a 01                	push   $0x1
+    14eb:	e8 e0 2b 00 00       	call   40d0 <printf>
+      exit();
+    14f0:	e8 2e 2a 00 00       	call   3f23 <exit>
+    14f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001500 <createdelete>:
+{
+    1500:	55                   	push   %ebp
+    1501:	89 e5                	mov    %esp,%ebp
+    1503:	57                   	push   %edi
+    1504:	56                   	push   %esi
+    1505:	53                   	push   %ebx
+    1506:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "createdelete test\n");
+    1509:	68 54 49 00 00       	push   $0x4954
+    150e:	6a 01                	push   $0x1
+    1510:	e8 bb 2b 00 00       	call   40d0 <printf>
+  pid = fork();
+    1515:	e8 01 2a 00 00       	call   3f1b <fork>
+  if(pid < 0){
+    151a:	83 c4 10             	add    $0x10,%esp
+    151d:	85 c0                	test   %eax,%eax
+    151f:	0f 88 c6 01 00 00    	js     16eb <createdelete+0x1eb>
+  name[0] = pid ? 'p' : 'c';
+    1525:	83 f8 01             	cmp    $0x1,%eax
+    1528:	89 c7                	mov    %eax,%edi
+  name[2] = '\0';
+    152a:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    152e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+  name[0] = pid ? 'p' : 'c';
+    1531:	19 c0                	sbb    %eax,%eax
+  for(i = 0; i < N; i++){
+    1533:	31 db                	xor    %ebx,%ebx
+  name[0] = pid ? 'p' : 'c';
+    1535:	83 e0 f3             	and    $0xfffffff3,%eax
+    1538:	83 c0 70             	add    $0x70,%eax
+    153b:	88 45 c8             	mov    %al,-0x38(%ebp)
+  for(i = 0; i < N; i++){
+    153e:	66 90                	xchg   %ax,%ax
+    fd = open(name, O_CREATE | O_RDWR);
+    1540:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+    1543:	8d 43 30             	lea    0x30(%ebx),%eax
+    1546:	88 45 c9             	mov    %al,-0x37(%ebp)
+    fd = open(name, O_CREATE | O_RDWR);
+    1549:	68 02 02 00 00       	push   $0x202
+    154e:	56                   	push   %esi
+    154f:	e8 0f 2a 00 00       	call   3f63 <open>
+    if(fd < 0){
+    1554:	83 c4 10             	add    $0x10,%esp
+    1557:	85 c0                	test   %eax,%eax
+    1559:	0f 88 78 01 00 00    	js     16d7 <createdelete+0x1d7>
+    close(fd);
+    155f:	83 ec 0c             	sub    $0xc,%esp
+    1562:	50                   	push   %eax
+    1563:	e8 e3 29 00 00       	call   3f4b <close>
+    if(i > 0 && (i % 2 ) == 0){
+    1568:	83 c4 10             	add    $0x10,%esp
+    156b:	85 db                	test   %ebx,%ebx
+    156d:	0f 84 0d 01 00 00    	je     1680 <createdelete+0x180>
+    1573:	f6 c3 01             	test   $0x1,%bl
+    1576:	0f 84 14 01 00 00    	je     1690 <createdelete+0x190>
+  for(i = 0; i < N; i++){
+    157c:	83 c3 01             	add    $0x1,%ebx
+    157f:	83 fb 14             	cmp    $0x14,%ebx
+    1582:	75 bc                	jne    1540 <createdelete+0x40>
+  if(pid==0)
+    1584:	85 ff                	test   %edi,%edi
+    1586:	0f 84 85 01 00 00    	je     1711 <createdelete+0x211>
+    wait();
+    158c:	e8 9a 29 00 00       	call   3f2b <wait>
+  for(i = 0; i < N; i++){
+    1591:	31 db                	xor    %ebx,%ebx
+    1593:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1597:	90                   	nop
+    name[1] = '0' + i;
+    1598:	8d 7b 30             	lea    0x30(%ebx),%edi
+    fd = open(name, 0);
+    159b:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'p';
+    159e:	c6 45 c8 70          	movb   $0x70,-0x38(%ebp)
+    name[1] = '0' + i;
+    15a2:	89 f8                	mov    %edi,%eax
+    15a4:	88 45 c9             	mov    %al,-0x37(%ebp)
+    fd = open(name, 0);
+    15a7:	6a 00                	push   $0x0
+    15a9:	56                   	push   %esi
+    15aa:	e8 b4 29 00 00       	call   3f63 <open>
+    if((i == 0 || i >= N/2) && fd < 0){
+    15af:	83 c4 10             	add    $0x10,%esp
+    15b2:	85 db                	test   %ebx,%ebx
+    15b4:	74 3a                	je     15f0 <createdelete+0xf0>
+    15b6:	83 fb 09             	cmp    $0x9,%ebx
+    15b9:	7f 35                	jg     15f0 <createdelete+0xf0>
+    } else if((i >= 1 && i < N/2) && fd >= 0){
+    15bb:	85 c0                	test   %eax,%eax
+    15bd:	0f 89 3b 01 00 00    	jns    16fe <createdelete+0x1fe>
+    name[1] = '0' + i;
+    15c3:	89 f8                	mov    %edi,%eax
+    name[0] = 'c';
+    15c5:	c6 45 c8 63          	movb   $0x63,-0x38(%ebp)
+    name[1] = '0' + i;
+    15c9:	88 45 c9             	mov    %al,-0x37(%ebp)
+    fd = open(name, 0);
+    15cc:	50                   	push   %eax
+    15cd:	50                   	push   %eax
+    15ce:	6a 00                	push   $0x0
+    15d0:	56                   	push   %esi
+    15d1:	e8 8d 29 00 00       	call   3f63 <open>
+    } else if((i >= 1 && i < N/2) && fd >= 0){
+    15d6:	83 c4 10             	add    $0x10,%esp
+    15d9:	85 c0                	test   %eax,%eax
+    15db:	0f 89 1d 01 00 00    	jns    16fe <createdelete+0x1fe>
+  for(i = 0; i < N; i++){
+    15e1:	83 c3 01             	add    $0x1,%ebx
+    15e4:	eb b2                	jmp    1598 <createdelete+0x98>
+    15e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if((i == 0 || i >= N/2) && fd < 0){
+    15f0:	85 c0                	test   %eax,%eax
+    15f2:	0f 88 ca 00 00 00    	js     16c2 <createdelete+0x1c2>
+      close(fd);
+    15f8:	83 ec 0c             	sub    $0xc,%esp
+    15fb:	50                   	push   %eax
+    15fc:	e8 4a 29 00 00       	call   3f4b <close>
+    name[1] = '0' + i;
+    1601:	89 f8                	mov    %edi,%eax
+    name[0] = 'c';
+    1603:	c6 45 c8 63          	movb   $0x63,-0x38(%ebp)
+    name[1] = '0' + i;
+    1607:	88 45 c9             	mov    %al,-0x37(%ebp)
+    fd = open(name, 0);
+    160a:	59                   	pop    %ecx
+    160b:	5f                   	pop    %edi
+    160c:	6a 00                	push   $0x0
+    160e:	56                   	push   %esi
+    160f:	e8 4f 29 00 00       	call   3f63 <open>
+    if((i == 0 || i >= N/2) && fd < 0){
+    1614:	83 c4 10             	add    $0x10,%esp
+    1617:	85 c0                	test   %eax,%eax
+    1619:	0f 88 a3 00 00 00    	js     16c2 <createdelete+0x1c2>
+      close(fd);
+    161f:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < N; i++){
+    1622:	83 c3 01             	add    $0x1,%ebx
+      close(fd);
+    1625:	50                   	push   %eax
+    1626:	e8 20 29 00 00       	call   3f4b <close>
+  for(i = 0; i < N; i++){
+    162b:	83 c4 10             	add    $0x10,%esp
+    162e:	83 fb 14             	cmp    $0x14,%ebx
+    1631:	0f 85 61 ff ff ff    	jne    1598 <createdelete+0x98>
+    1637:	bb 30 00 00 00       	mov    $0x30,%ebx
+    163c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    unlink(name);
+    1640:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+    1643:	88 5d c9             	mov    %bl,-0x37(%ebp)
+  for(i = 0; i < N; i++){
+    1646:	83 c3 01             	add    $0x1,%ebx
+    name[0] = 'p';
+    1649:	c6 45 c8 70          	movb   $0x70,-0x38(%ebp)
+    unlink(name);
+    164d:	56                   	push   %esi
+    164e:	e8 20 29 00 00       	call   3f73 <unlink>
+    name[0] = 'c';
+    1653:	c6 45 c8 63          	movb   $0x63,-0x38(%ebp)
+    unlink(name);
+    1657:	89 34 24             	mov    %esi,(%esp)
+    165a:	e8 14 29 00 00       	call   3f73 <unlink>
+  for(i = 0; i < N; i++){
+    165f:	83 c4 10             	add    $0x10,%esp
+    1662:	80 fb 44             	cmp    $0x44,%bl
+    1665:	75 d9                	jne    1640 <createdelete+0x140>
+  printf(1, "createdelete ok\n");
+    1667:	83 ec 08             	sub    $0x8,%esp
+    166a:	68 67 49 00 00       	push   $0x4967
+    166f:	6a 01                	push   $0x1
+    1671:	e8 5a 2a 00 00       	call   40d0 <printf>
+}
+    1676:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1679:	5b                   	pop    %ebx
+    167a:	5e                   	pop    %esi
+    167b:	5f                   	pop    %edi
+    167c:	5d                   	pop    %ebp
+    167d:	c3                   	ret
+    167e:	66 90                	xchg   %ax,%ax
+  for(i = 0; i < N; i++){
+    1680:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1685:	e9 b6 fe ff ff       	jmp    1540 <createdelete+0x40>
+    168a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + (i / 2);
+    1690:	89 d8                	mov    %ebx,%eax
+      if(unlink(name) < 0){
+    1692:	83 ec 0c             	sub    $0xc,%esp
+      name[1] = '0' + (i / 2);
+    1695:	d1 f8                	sar    %eax
+    1697:	83 c0 30             	add    $0x30,%eax
+    169a:	88 45 c9             	mov    %al,-0x37(%ebp)
+      if(unlink(name) < 0){
+    169d:	56                   	push   %esi
+    169e:	e8 d0 28 00 00       	call   3f73 <unlink>
+    16a3:	83 c4 10             	add    $0x10,%esp
+    16a6:	85 c0                	test   %eax,%eax
+    16a8:	0f 89 ce fe ff ff    	jns    157c <createdelete+0x7c>
+        printf(1, "unlink failed\n");
+    16ae:	83 ec 08             	sub    $0x8,%esp
+    16b1:	68 9d 51 00 00       	push   $0x519d
+    16b6:	6a 01                	push   $0x1
+    16b8:	e8 13 2a 00 00       	call   40d0 <printf>
+        exit();
+    16bd:	e8 61 28 00 00       	call   3f23 <exit>
+      printf(1, "oops createdelete %s didn't exist\n", name);
+    16c2:	83 ec 04             	sub    $0x4,%esp
+    16c5:	56                   	push   %esi
+    16c6:	68 00 58 00 00       	push   $0x5800
+    16cb:	6a 01                	push   $0x1
+    16cd:	e8 fe 29 00 00       	call   40d0 <printf>
+      exit();
+    16d2:	e8 4c 28 00 00       	call   3f23 <exit>
+      printf(1, "create failed\n");
+    16d7:	83 ec 08             	sub    $0x8,%esp
+    16da:	68 a3 4b 00 00       	push   $0x4ba3
+    16df:	6a 01                	push   $0x1
+    16e1:	e8 ea 29 00 00       	call   40d0 <printf>
+      exit();
+    16e6:	e8 38 28 00 00       	call   3f23 <exit>
+    printf(1, "fork failed\n");
+    16eb:	50                   	push   %eax
+    16ec:	50                   	push   %eax
+    16ed:	68 97 48 00 00       	push   $0x4897
+    16f2:	6a 01                	push   $0x1
+    16f4:	e8 d7 29 00 00       	call   40d0 <printf>
+    exit();
+    16f9:	e8 25 28 00 00       	call   3f23 <exit>
+      printf(1, "oops createdelete %s did exist\n", name);
+    16fe:	52                   	push   %edx
+    16ff:	56                   	push   %esi
+    1700:	68 24 58 00 00       	push   $0x5824
+    1705:	6a 01                	push   $0x1
+    1707:	e8 c4 29 00 00       	call   40d0 <printf>
+      exit();
+    170c:	e8 12 28 00 00       	call   3f23 <exit>
+    exit();
+    1711:	e8 0d 28 00 00       	call   3f23 <exit>
+    1716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    171d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001720 <unlinkread>:
+{
+    1720:	55                   	push   %ebp
+    1721:	89 e5                	mov    %esp,%ebp
+    1723:	56                   	push   %esi
+    1724:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    1725:	83 ec 08             	sub    $0x8,%esp
+    1728:	68 78 49 00 00       	push   $0x4978
+    172d:	6a 01                	push   $0x1
+    172f:	e8 9c 29 00 00       	call   40d0 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1734:	5b                   	pop    %ebx
+    1735:	5e                   	pop    %esi
+    1736:	68 02 02 00 00       	push   $0x202
+    173b:	68 89 49 00 00       	push   $0x4989
+    1740:	e8 1e 28 00 00       	call   3f63 <open>
+  if(fd < 0){
+    1745:	83 c4 10             	add    $0x10,%esp
+    1748:	85 c0                	test   %eax,%eax
+    174a:	0f 88 e6 00 00 00    	js     1836 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    1750:	83 ec 04             	sub    $0x4,%esp
+    1753:	89 c3                	mov    %eax,%ebx
+    1755:	6a 05                	push   $0x5
+    1757:	68 ae 49 00 00       	push   $0x49ae
+    175c:	50                   	push   %eax
+    175d:	e8 e1 27 00 00       	call   3f43 <write>
+  close(fd);
+    1762:	89 1c 24             	mov    %ebx,(%esp)
+    1765:	e8 e1 27 00 00       	call   3f4b <close>
+  fd = open("unlinkread", O_RDWR);
+    176a:	58                   	pop    %eax
+    176b:	5a                   	pop    %edx
+    176c:	6a 02                	push   $0x2
+    176e:	68 89 49 00 00       	push   $0x4989
+    1773:	e8 eb 27 00 00       	call   3f63 <open>
+  if(fd < 0){
+    1778:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    177b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    177d:	85 c0                	test   %eax,%eax
+    177f:	0f 88 10 01 00 00    	js     1895 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    1785:	83 ec 0c             	sub    $0xc,%esp
+    1788:	68 89 49 00 00       	push   $0x4989
+    178d:	e8 e1 27 00 00       	call   3f73 <unlink>
+    1792:	83 c4 10             	add    $0x10,%esp
+    1795:	85 c0                	test   %eax,%eax
+    1797:	0f 85 e5 00 00 00    	jne    1882 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    179d:	83 ec 08             	sub    $0x8,%esp
+    17a0:	68 02 02 00 00       	push   $0x202
+    17a5:	68 89 49 00 00       	push   $0x4989
+    17aa:	e8 b4 27 00 00       	call   3f63 <open>
+  write(fd1, "yyy", 3);
+    17af:	83 c4 0c             	add    $0xc,%esp
+    17b2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    17b4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    17b6:	68 e6 49 00 00       	push   $0x49e6
+    17bb:	50                   	push   %eax
+    17bc:	e8 82 27 00 00       	call   3f43 <write>
+  close(fd1);
+    17c1:	89 34 24             	mov    %esi,(%esp)
+    17c4:	e8 82 27 00 00       	call   3f4b <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    17c9:	83 c4 0c             	add    $0xc,%esp
+    17cc:	68 00 20 00 00       	push   $0x2000
+    17d1:	68 00 90 00 00       	push   $0x9000
+    17d6:	53                   	push   %ebx
+    17d7:	e8 5f 27 00 00       	call   3f3b <read>
+    17dc:	83 c4 10             	add    $0x10,%esp
+    17df:	83 f8 05             	cmp    $0x5,%eax
+    17e2:	0f 85 87 00 00 00    	jne    186f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    17e8:	80 3d 00 90 00 00 68 	cmpb   $0x68,0x9000
+    17ef:	75 6b                	jne    185c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    17f1:	83 ec 04             	sub    $0x4,%esp
+    17f4:	6a 0a                	push   $0xa
+    17f6:	68 00 90 00 00       	push   $0x9000
+    17fb:	53                   	push   %ebx
+    17fc:	e8 42 27 00 00       	call   3f43 <write>
+    1801:	83 c4 10             	add    $0x10,%esp
+    1804:	83 f8 0a             	cmp    $0xa,%eax
+    1807:	75 40                	jne    1849 <unlinkread+0x129>
+  close(fd);
+    1809:	83 ec 0c             	sub    $0xc,%esp
+    180c:	53                   	push   %ebx
+    180d:	e8 39 27 00 00       	call   3f4b <close>
+  unlink("unlinkread");
+    1812:	c7 04 24 89 49 00 00 	movl   $0x4989,(%esp)
+    1819:	e8 55 27 00 00       	call   3f73 <unlink>
+  printf(1, "unlinkread ok\n");
+    181e:	58                   	pop    %eax
+    181f:	5a                   	pop    %edx
+    1820:	68 31 4a 00 00       	push   $0x4a31
+    1825:	6a 01                	push   $0x1
+    1827:	e8 a4 28 00 00       	call   40d0 <printf>
+}
+    182c:	83 c4 10             	add    $0x10,%esp
+    182f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1832:	5b                   	pop    %ebx
+    1833:	5e                   	pop    %esi
+    1834:	5d                   	pop    %ebp
+    1835:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1836:	51                   	push   %ecx
+    1837:	51                   	push   %ecx
+    1838:	68 94 49 00 00       	push   $0x4994
+    183d:	6a 01                	push   $0x1
+    183f:	e8 8c 28 00 00       	call   40d0 <printf>
+    exit();
+    1844:	e8 da 26 00 00       	call   3f23 <exit>
+    printf(1, "unlinkread write failed\n");
+    1849:	51                   	push   %ecx
+    184a:	51                   	push   %ecx
+    184b:	68 18 4a 00 00       	push   $0x4a18
+    1850:	6a 01                	push   $0x1
+    1852:	e8 79 28 00 00       	call   40d0 <printf>
+    exit();
+    1857:	e8 c7 26 00 00       	call   3f23 <exit>
+    printf(1, "unlinkread wrong data\n");
+    185c:	53                   	push   %ebx
+    185d:	53                   	push   %ebx
+    185e:	68 01 4a 00 00       	push   $0x4a01
+    1863:	6a 01                	push   $0x1
+    1865:	e8 66 28 00 00       	call   40d0 <printf>
+    exit();
+    186a:	e8 b4 26 00 00       	call   3f23 <exit>
+    printf(1, "unlinkread read failed");
+    186f:	56                   	push   %esi
+    1870:	56                   	push   %esi
+    1871:	68 ea 49 00 00       	push   $0x49ea
+    1876:	6a 01                	push   $0x1
+    1878:	e8 53 28 00 00       	call   40d0 <printf>
+    exit();
+    187d:	e8 a1 26 00 00       	call   3f23 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1882:	50                   	push   %eax
+    1883:	50                   	push   %eax
+    1884:	68 cc 49 00 00       	push   $0x49cc
+    1889:	6a 01                	push   $0x1
+    188b:	e8 40 28 00 00       	call   40d0 <printf>
+    exit();
+    1890:	e8 8e 26 00 00       	call   3f23 <exit>
+    printf(1, "open unlinkread failed\n");
+    1895:	50                   	push   %eax
+    1896:	50                   	push   %eax
+    1897:	68 b4 49 00 00       	push   $0x49b4
+    189c:	6a 01                	push   $0x1
+    189e:	e8 2d 28 00 00       	call   40d0 <printf>
+    exit();
+    18a3:	e8 7b 26 00 00       	call   3f23 <exit>
+    18a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18af:	90                   	nop
+
+000018b0 <linktest>:
+{
+    18b0:	55                   	push   %ebp
+    18b1:	89 e5                	mov    %esp,%ebp
+    18b3:	53                   	push   %ebx
+    18b4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    18b7:	68 40 4a 00 00       	push   $0x4a40
+    18bc:	6a 01                	push   $0x1
+    18be:	e8 0d 28 00 00       	call   40d0 <printf>
+  unlink("lf1");
+    18c3:	c7 04 24 4a 4a 00 00 	movl   $0x4a4a,(%esp)
+    18ca:	e8 a4 26 00 00       	call   3f73 <unlink>
+  unlink("lf2");
+    18cf:	c7 04 24 4e 4a 00 00 	movl   $0x4a4e,(%esp)
+    18d6:	e8 98 26 00 00       	call   3f73 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    18db:	58                   	pop    %eax
+    18dc:	5a                   	pop    %edx
+    18dd:	68 02 02 00 00       	push   $0x202
+    18e2:	68 4a 4a 00 00       	push   $0x4a4a
+    18e7:	e8 77 26 00 00       	call   3f63 <open>
+  if(fd < 0){
+    18ec:	83 c4 10             	add    $0x10,%esp
+    18ef:	85 c0                	test   %eax,%eax
+    18f1:	0f 88 1e 01 00 00    	js     1a15 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    18f7:	83 ec 04             	sub    $0x4,%esp
+    18fa:	89 c3                	mov    %eax,%ebx
+    18fc:	6a 05                	push   $0x5
+    18fe:	68 ae 49 00 00       	push   $0x49ae
+    1903:	50                   	push   %eax
+    1904:	e8 3a 26 00 00       	call   3f43 <write>
+    1909:	83 c4 10             	add    $0x10,%esp
+    190c:	83 f8 05             	cmp    $0x5,%eax
+    190f:	0f 85 98 01 00 00    	jne    1aad <linktest+0x1fd>
+  close(fd);
+    1915:	83 ec 0c             	sub    $0xc,%esp
+    1918:	53                   	push   %ebx
+    1919:	e8 2d 26 00 00       	call   3f4b <close>
+  if(link("lf1", "lf2") < 0){
+    191e:	5b                   	pop    %ebx
+    191f:	58                   	pop    %eax
+    1920:	68 4e 4a 00 00       	push   $0x4a4e
+    1925:	68 4a 4a 00 00       	push   $0x4a4a
+    192a:	e8 54 26 00 00       	call   3f83 <link>
+    192f:	83 c4 10             	add    $0x10,%esp
+    1932:	85 c0                	test   %eax,%eax
+    1934:	0f 88 60 01 00 00    	js     1a9a <linktest+0x1ea>
+  unlink("lf1");
+    193a:	83 ec 0c             	sub    $0xc,%esp
+    193d:	68 4a 4a 00 00       	push   $0x4a4a
+    1942:	e8 2c 26 00 00       	call   3f73 <unlink>
+  if(open("lf1", 0) >= 0){
+    1947:	58                   	pop    %eax
+    1948:	5a                   	pop    %edx
+    1949:	6a 00                	push   $0x0
+    194b:	68 4a 4a 00 00       	push   $0x4a4a
+    1950:	e8 0e 26 00 00       	call   3f63 <open>
+    1955:	83 c4 10             	add    $0x10,%esp
+    1958:	85 c0                	test   %eax,%eax
+    195a:	0f 89 27 01 00 00    	jns    1a87 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    1960:	83 ec 08             	sub    $0x8,%esp
+    1963:	6a 00                	push   $0x0
+    1965:	68 4e 4a 00 00       	push   $0x4a4e
+    196a:	e8 f4 25 00 00       	call   3f63 <open>
+  if(fd < 0){
+    196f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    1972:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1974:	85 c0                	test   %eax,%eax
+    1976:	0f 88 f8 00 00 00    	js     1a74 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    197c:	83 ec 04             	sub    $0x4,%esp
+    197f:	68 00 20 00 00       	push   $0x2000
+    1984:	68 00 90 00 00       	push   $0x9000
+    1989:	50                   	push   %eax
+    198a:	e8 ac 25 00 00       	call   3f3b <read>
+    198f:	83 c4 10             	add    $0x10,%esp
+    1992:	83 f8 05             	cmp    $0x5,%eax
+    1995:	0f 85 c6 00 00 00    	jne    1a61 <linktest+0x1b1>
+  close(fd);
+    199b:	83 ec 0c             	sub    $0xc,%esp
+    199e:	53                   	push   %ebx
+    199f:	e8 a7 25 00 00       	call   3f4b <close>
+  if(link("lf2", "lf2") >= 0){
+    19a4:	58                   	pop    %eax
+    19a5:	5a                   	pop    %edx
+    19a6:	68 4e 4a 00 00       	push   $0x4a4e
+    19ab:	68 4e 4a 00 00       	push   $0x4a4e
+    19b0:	e8 ce 25 00 00       	call   3f83 <link>
+    19b5:	83 c4 10             	add    $0x10,%esp
+    19b8:	85 c0                	test   %eax,%eax
+    19ba:	0f 89 8e 00 00 00    	jns    1a4e <linktest+0x19e>
+  unlink("lf2");
+    19c0:	83 ec 0c             	sub    $0xc,%esp
+    19c3:	68 4e 4a 00 00       	push   $0x4a4e
+    19c8:	e8 a6 25 00 00       	call   3f73 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    19cd:	59                   	pop    %ecx
+    19ce:	5b                   	pop    %ebx
+    19cf:	68 4a 4a 00 00       	push   $0x4a4a
+    19d4:	68 4e 4a 00 00       	push   $0x4a4e
+    19d9:	e8 a5 25 00 00       	call   3f83 <link>
+    19de:	83 c4 10             	add    $0x10,%esp
+    19e1:	85 c0                	test   %eax,%eax
+    19e3:	79 56                	jns    1a3b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    19e5:	83 ec 08             	sub    $0x8,%esp
+    19e8:	68 4a 4a 00 00       	push   $0x4a4a
+    19ed:	68 12 4d 00 00       	push   $0x4d12
+    19f2:	e8 8c 25 00 00       	call   3f83 <link>
+    19f7:	83 c4 10             	add    $0x10,%esp
+    19fa:	85 c0                	test   %eax,%eax
+    19fc:	79 2a                	jns    1a28 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    19fe:	83 ec 08             	sub    $0x8,%esp
+    1a01:	68 e8 4a 00 00       	push   $0x4ae8
+    1a06:	6a 01                	push   $0x1
+    1a08:	e8 c3 26 00 00       	call   40d0 <printf>
+}
+    1a0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1a10:	83 c4 10             	add    $0x10,%esp
+    1a13:	c9                   	leave
+    1a14:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1a15:	50                   	push   %eax
+    1a16:	50                   	push   %eax
+    1a17:	68 52 4a 00 00       	push   $0x4a52
+    1a1c:	6a 01                	push   $0x1
+    1a1e:	e8 ad 26 00 00       	call   40d0 <printf>
+    exit();
+    1a23:	e8 fb 24 00 00       	call   3f23 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1a28:	50                   	push   %eax
+    1a29:	50                   	push   %eax
+    1a2a:	68 cc 4a 00 00       	push   $0x4acc
+    1a2f:	6a 01                	push   $0x1
+    1a31:	e8 9a 26 00 00       	call   40d0 <printf>
+    exit();
+    1a36:	e8 e8 24 00 00       	call   3f23 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    1a3b:	52                   	push   %edx
+    1a3c:	52                   	push   %edx
+    1a3d:	68 6c 58 00 00       	push   $0x586c
+    1a42:	6a 01                	push   $0x1
+    1a44:	e8 87 26 00 00       	call   40d0 <printf>
+    exit();
+    1a49:	e8 d5 24 00 00       	call   3f23 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    1a4e:	50                   	push   %eax
+    1a4f:	50                   	push   %eax
+    1a50:	68 ae 4a 00 00       	push   $0x4aae
+    1a55:	6a 01                	push   $0x1
+    1a57:	e8 74 26 00 00       	call   40d0 <printf>
+    exit();
+    1a5c:	e8 c2 24 00 00       	call   3f23 <exit>
+    printf(1, "read lf2 failed\n");
+    1a61:	51                   	push   %ecx
+    1a62:	51                   	push   %ecx
+    1a63:	68 9d 4a 00 00       	push   $0x4a9d
+    1a68:	6a 01                	push   $0x1
+    1a6a:	e8 61 26 00 00       	call   40d0 <printf>
+    exit();
+    1a6f:	e8 af 24 00 00       	call   3f23 <exit>
+    printf(1, "open lf2 failed\n");
+    1a74:	53                   	push   %ebx
+    1a75:	53                   	push   %ebx
+    1a76:	68 8c 4a 00 00       	push   $0x4a8c
+    1a7b:	6a 01                	push   $0x1
+    1a7d:	e8 4e 26 00 00       	call   40d0 <printf>
+    exit();
+    1a82:	e8 9c 24 00 00       	call   3f23 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1a87:	50                   	push   %eax
+    1a88:	50                   	push   %eax
+    1a89:	68 44 58 00 00       	push   $0x5844
+    1a8e:	6a 01                	push   $0x1
+    1a90:	e8 3b 26 00 00       	call   40d0 <printf>
+    exit();
+    1a95:	e8 89 24 00 00       	call   3f23 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    1a9a:	51                   	push   %ecx
+    1a9b:	51                   	push   %ecx
+    1a9c:	68 77 4a 00 00       	push   $0x4a77
+    1aa1:	6a 01                	push   $0x1
+    1aa3:	e8 28 26 00 00       	call   40d0 <printf>
+    exit();
+    1aa8:	e8 76 24 00 00       	call   3f23 <exit>
+    printf(1, "write lf1 failed\n");
+    1aad:	50                   	push   %eax
+    1aae:	50                   	push   %eax
+    1aaf:	68 65 4a 00 00       	push   $0x4a65
+    1ab4:	6a 01                	push   $0x1
+    1ab6:	e8 15 26 00 00       	call   40d0 <printf>
+    exit();
+    1abb:	e8 63 24 00 00       	call   3f23 <exit>
+
+00001ac0 <concreate>:
+{
+    1ac0:	55                   	push   %ebp
+    1ac1:	89 e5                	mov    %esp,%ebp
+    1ac3:	57                   	push   %edi
+    1ac4:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    1ac5:	31 f6                	xor    %esi,%esi
+{
+    1ac7:	53                   	push   %ebx
+    1ac8:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    1acb:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    1ace:	68 f5 4a 00 00       	push   $0x4af5
+    1ad3:	6a 01                	push   $0x1
+    1ad5:	e8 f6 25 00 00       	call   40d0 <printf>
+  file[0] = 'C';
+    1ada:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    1ade:	83 c4 10             	add    $0x10,%esp
+    1ae1:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    1ae5:	eb 4c                	jmp    1b33 <concreate+0x73>
+    1ae7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1aee:	66 90                	xchg   %ax,%ax
+    1af0:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    1af6:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    1afb:	0f 83 8f 00 00 00    	jae    1b90 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    1b01:	83 ec 08             	sub    $0x8,%esp
+    1b04:	68 02 02 00 00       	push   $0x202
+    1b09:	53                   	push   %ebx
+    1b0a:	e8 54 24 00 00       	call   3f63 <open>
+      if(fd < 0){
+    1b0f:	83 c4 10             	add    $0x10,%esp
+    1b12:	85 c0                	test   %eax,%eax
+    1b14:	78 63                	js     1b79 <concreate+0xb9>
+      close(fd);
+    1b16:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1b19:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    1b1c:	50                   	push   %eax
+    1b1d:	e8 29 24 00 00       	call   3f4b <close>
+    1b22:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1b25:	e8 01 24 00 00       	call   3f2b <wait>
+  for(i = 0; i < 40; i++){
+    1b2a:	83 fe 28             	cmp    $0x28,%esi
+    1b2d:	0f 84 7f 00 00 00    	je     1bb2 <concreate+0xf2>
+    unlink(file);
+    1b33:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    1b36:	8d 46 30             	lea    0x30(%esi),%eax
+    1b39:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    1b3c:	53                   	push   %ebx
+    1b3d:	e8 31 24 00 00       	call   3f73 <unlink>
+    pid = fork();
+    1b42:	e8 d4 23 00 00       	call   3f1b <fork>
+    if(pid && (i % 3) == 1){
+    1b47:	83 c4 10             	add    $0x10,%esp
+    1b4a:	85 c0                	test   %eax,%eax
+    1b4c:	75 a2                	jne    1af0 <concreate+0x30>
+      link("C0", file);
+    1b4e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    1b54:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    1b5a:	0f 83 d0 00 00 00    	jae    1c30 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    1b60:	83 ec 08             	sub    $0x8,%esp
+    1b63:	68 02 02 00 00       	push   $0x202
+    1b68:	53                   	push   %ebx
+    1b69:	e8 f5 23 00 00       	call   3f63 <open>
+      if(fd < 0){
+    1b6e:	83 c4 10             	add    $0x10,%esp
+    1b71:	85 c0                	test   %eax,%eax
+    1b73:	0f 89 ea 01 00 00    	jns    1d63 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    1b79:	83 ec 04             	sub    $0x4,%esp
+    1b7c:	53                   	push   %ebx
+    1b7d:	68 08 4b 00 00       	push   $0x4b08
+    1b82:	6a 01                	push   $0x1
+    1b84:	e8 47 25 00 00       	call   40d0 <printf>
+        exit();
+    1b89:	e8 95 23 00 00       	call   3f23 <exit>
+    1b8e:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    1b90:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    1b93:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    1b96:	53                   	push   %ebx
+    1b97:	68 05 4b 00 00       	push   $0x4b05
+    1b9c:	e8 e2 23 00 00       	call   3f83 <link>
+    1ba1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1ba4:	e8 82 23 00 00       	call   3f2b <wait>
+  for(i = 0; i < 40; i++){
+    1ba9:	83 fe 28             	cmp    $0x28,%esi
+    1bac:	0f 85 81 ff ff ff    	jne    1b33 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    1bb2:	83 ec 04             	sub    $0x4,%esp
+    1bb5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    1bb8:	6a 28                	push   $0x28
+    1bba:	6a 00                	push   $0x0
+    1bbc:	50                   	push   %eax
+    1bbd:	e8 de 21 00 00       	call   3da0 <memset>
+  fd = open(".", 0);
+    1bc2:	5e                   	pop    %esi
+    1bc3:	5f                   	pop    %edi
+    1bc4:	6a 00                	push   $0x0
+    1bc6:	68 12 4d 00 00       	push   $0x4d12
+    1bcb:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    1bce:	e8 90 23 00 00       	call   3f63 <open>
+  n = 0;
+    1bd3:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    1bda:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    1bdd:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    1bdf:	90                   	nop
+    1be0:	83 ec 04             	sub    $0x4,%esp
+    1be3:	6a 10                	push   $0x10
+    1be5:	57                   	push   %edi
+    1be6:	56                   	push   %esi
+    1be7:	e8 4f 23 00 00       	call   3f3b <read>
+    1bec:	83 c4 10             	add    $0x10,%esp
+    1bef:	85 c0                	test   %eax,%eax
+    1bf1:	7e 5d                	jle    1c50 <concreate+0x190>
+    if(de.inum == 0)
+    1bf3:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    1bf8:	74 e6                	je     1be0 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1bfa:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    1bfe:	75 e0                	jne    1be0 <concreate+0x120>
+    1c00:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1c04:	75 da                	jne    1be0 <concreate+0x120>
+      i = de.name[1] - '0';
+    1c06:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    1c0a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    1c0d:	83 f8 27             	cmp    $0x27,%eax
+    1c10:	0f 87 5e 01 00 00    	ja     1d74 <concreate+0x2b4>
+      if(fa[i]){
+    1c16:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    1c1b:	0f 85 7e 01 00 00    	jne    1d9f <concreate+0x2df>
+      n++;
+    1c21:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1c25:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    1c2a:	eb b4                	jmp    1be0 <concreate+0x120>
+    1c2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    1c30:	83 ec 08             	sub    $0x8,%esp
+    1c33:	53                   	push   %ebx
+    1c34:	68 05 4b 00 00       	push   $0x4b05
+    1c39:	e8 45 23 00 00       	call   3f83 <link>
+    1c3e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1c41:	e8 dd 22 00 00       	call   3f23 <exit>
+    1c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c4d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    1c50:	83 ec 0c             	sub    $0xc,%esp
+    1c53:	56                   	push   %esi
+    1c54:	e8 f2 22 00 00       	call   3f4b <close>
+  if(n != 40){
+    1c59:	83 c4 10             	add    $0x10,%esp
+    1c5c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    1c60:	0f 85 26 01 00 00    	jne    1d8c <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    1c66:	31 f6                	xor    %esi,%esi
+    1c68:	eb 48                	jmp    1cb2 <concreate+0x1f2>
+    1c6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    1c70:	85 ff                	test   %edi,%edi
+    1c72:	74 05                	je     1c79 <concreate+0x1b9>
+    1c74:	83 f8 01             	cmp    $0x1,%eax
+    1c77:	74 68                	je     1ce1 <concreate+0x221>
+      unlink(file);
+    1c79:	83 ec 0c             	sub    $0xc,%esp
+    1c7c:	53                   	push   %ebx
+    1c7d:	e8 f1 22 00 00       	call   3f73 <unlink>
+      unlink(file);
+    1c82:	89 1c 24             	mov    %ebx,(%esp)
+    1c85:	e8 e9 22 00 00       	call   3f73 <unlink>
+      unlink(file);
+    1c8a:	89 1c 24             	mov    %ebx,(%esp)
+    1c8d:	e8 e1 22 00 00       	call   3f73 <unlink>
+      unlink(file);
+    1c92:	89 1c 24             	mov    %ebx,(%esp)
+    1c95:	e8 d9 22 00 00       	call   3f73 <unlink>
+    1c9a:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    1c9d:	85 ff                	test   %edi,%edi
+    1c9f:	74 a0                	je     1c41 <concreate+0x181>
+      wait();
+    1ca1:	e8 85 22 00 00       	call   3f2b <wait>
+  for(i = 0; i < 40; i++){
+    1ca6:	83 c6 01             	add    $0x1,%esi
+    1ca9:	83 fe 28             	cmp    $0x28,%esi
+    1cac:	0f 84 86 00 00 00    	je     1d38 <concreate+0x278>
+    file[1] = '0' + i;
+    1cb2:	8d 46 30             	lea    0x30(%esi),%eax
+    1cb5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    1cb8:	e8 5e 22 00 00       	call   3f1b <fork>
+    1cbd:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    1cbf:	85 c0                	test   %eax,%eax
+    1cc1:	0f 88 88 00 00 00    	js     1d4f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    1cc7:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    1ccc:	f7 e6                	mul    %esi
+    1cce:	89 d0                	mov    %edx,%eax
+    1cd0:	83 e2 fe             	and    $0xfffffffe,%edx
+    1cd3:	d1 e8                	shr    %eax
+    1cd5:	01 c2                	add    %eax,%edx
+    1cd7:	89 f0                	mov    %esi,%eax
+    1cd9:	29 d0                	sub    %edx,%eax
+    1cdb:	89 c1                	mov    %eax,%ecx
+    1cdd:	09 f9                	or     %edi,%ecx
+    1cdf:	75 8f                	jne    1c70 <concreate+0x1b0>
+      close(open(file, 0));
+    1ce1:	83 ec 08             	sub    $0x8,%esp
+    1ce4:	6a 00                	push   $0x0
+    1ce6:	53                   	push   %ebx
+    1ce7:	e8 77 22 00 00       	call   3f63 <open>
+    1cec:	89 04 24             	mov    %eax,(%esp)
+    1cef:	e8 57 22 00 00       	call   3f4b <close>
+      close(open(file, 0));
+    1cf4:	58                   	pop    %eax
+    1cf5:	5a                   	pop    %edx
+    1cf6:	6a 00                	push   $0x0
+    1cf8:	53                   	push   %ebx
+    1cf9:	e8 65 22 00 00       	call   3f63 <open>
+    1cfe:	89 04 24             	mov    %eax,(%esp)
+    1d01:	e8 45 22 00 00       	call   3f4b <close>
+      close(open(file, 0));
+    1d06:	59                   	pop    %ecx
+    1d07:	58                   	pop    %eax
+    1d08:	6a 00                	push   $0x0
+    1d0a:	53                   	push   %ebx
+    1d0b:	e8 53 22 00 00       	call   3f63 <open>
+    1d10:	89 04 24             	mov    %eax,(%esp)
+    1d13:	e8 33 22 00 00       	call   3f4b <close>
+      close(open(file, 0));
+    1d18:	58                   	pop    %eax
+    1d19:	5a                   	pop    %edx
+    1d1a:	6a 00                	push   $0x0
+    1d1c:	53                   	push   %ebx
+    1d1d:	e8 41 22 00 00       	call   3f63 <open>
+    1d22:	89 04 24             	mov    %eax,(%esp)
+    1d25:	e8 21 22 00 00       	call   3f4b <close>
+    1d2a:	83 c4 10             	add    $0x10,%esp
+    1d2d:	e9 6b ff ff ff       	jmp    1c9d <concreate+0x1dd>
+    1d32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1d38:	83 ec 08             	sub    $0x8,%esp
+    1d3b:	68 5a 4b 00 00       	push   $0x4b5a
+    1d40:	6a 01                	push   $0x1
+    1d42:	e8 89 23 00 00       	call   40d0 <printf>
+}
+    1d47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d4a:	5b                   	pop    %ebx
+    1d4b:	5e                   	pop    %esi
+    1d4c:	5f                   	pop    %edi
+    1d4d:	5d                   	pop    %ebp
+    1d4e:	c3                   	ret
+      printf(1, "fork failed\n");
+    1d4f:	83 ec 08             	sub    $0x8,%esp
+    1d52:	68 97 48 00 00       	push   $0x4897
+    1d57:	6a 01                	push   $0x1
+    1d59:	e8 72 23 00 00       	call   40d0 <printf>
+      exit();
+    1d5e:	e8 c0 21 00 00       	call   3f23 <exit>
+      close(fd);
+    1d63:	83 ec 0c             	sub    $0xc,%esp
+    1d66:	50                   	push   %eax
+    1d67:	e8 df 21 00 00       	call   3f4b <close>
+    1d6c:	83 c4 10             	add    $0x10,%esp
+    1d6f:	e9 cd fe ff ff       	jmp    1c41 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    1d74:	83 ec 04             	sub    $0x4,%esp
+    1d77:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1d7a:	50                   	push   %eax
+    1d7b:	68 24 4b 00 00       	push   $0x4b24
+    1d80:	6a 01                	push   $0x1
+    1d82:	e8 49 23 00 00       	call   40d0 <printf>
+        exit();
+    1d87:	e8 97 21 00 00       	call   3f23 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    1d8c:	51                   	push   %ecx
+    1d8d:	51                   	push   %ecx
+    1d8e:	68 90 58 00 00       	push   $0x5890
+    1d93:	6a 01                	push   $0x1
+    1d95:	e8 36 23 00 00       	call   40d0 <printf>
+    exit();
+    1d9a:	e8 84 21 00 00       	call   3f23 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1d9f:	83 ec 04             	sub    $0x4,%esp
+    1da2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1da5:	50                   	push   %eax
+    1da6:	68 3d 4b 00 00       	push   $0x4b3d
+    1dab:	6a 01                	push   $0x1
+    1dad:	e8 1e 23 00 00       	call   40d0 <printf>
+        exit();
+    1db2:	e8 6c 21 00 00       	call   3f23 <exit>
+    1db7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1dbe:	66 90                	xchg   %ax,%ax
+
+00001dc0 <linkunlink>:
+{
+    1dc0:	55                   	push   %ebp
+    1dc1:	89 e5                	mov    %esp,%ebp
+    1dc3:	57                   	push   %edi
+    1dc4:	56                   	push   %esi
+    1dc5:	53                   	push   %ebx
+    1dc6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    1dc9:	68 68 4b 00 00       	push   $0x4b68
+    1dce:	6a 01                	push   $0x1
+    1dd0:	e8 fb 22 00 00       	call   40d0 <printf>
+  unlink("x");
+    1dd5:	c7 04 24 6c 55 00 00 	movl   $0x556c,(%esp)
+    1ddc:	e8 92 21 00 00       	call   3f73 <unlink>
+  pid = fork();
+    1de1:	e8 35 21 00 00       	call   3f1b <fork>
+  if(pid < 0){
+    1de6:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1de9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    1dec:	85 c0                	test   %eax,%eax
+    1dee:	0f 88 b6 00 00 00    	js     1eaa <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    1df4:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    1df8:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    1dfd:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    1e02:	19 ff                	sbb    %edi,%edi
+    1e04:	83 e7 60             	and    $0x60,%edi
+    1e07:	83 c7 01             	add    $0x1,%edi
+    1e0a:	eb 1e                	jmp    1e2a <linkunlink+0x6a>
+    1e0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    1e10:	83 f8 01             	cmp    $0x1,%eax
+    1e13:	74 7b                	je     1e90 <linkunlink+0xd0>
+      unlink("x");
+    1e15:	83 ec 0c             	sub    $0xc,%esp
+    1e18:	68 6c 55 00 00       	push   $0x556c
+    1e1d:	e8 51 21 00 00       	call   3f73 <unlink>
+    1e22:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1e25:	83 eb 01             	sub    $0x1,%ebx
+    1e28:	74 41                	je     1e6b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    1e2a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    1e30:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    1e36:	89 f8                	mov    %edi,%eax
+    1e38:	f7 e6                	mul    %esi
+    1e3a:	89 d0                	mov    %edx,%eax
+    1e3c:	83 e2 fe             	and    $0xfffffffe,%edx
+    1e3f:	d1 e8                	shr    %eax
+    1e41:	01 c2                	add    %eax,%edx
+    1e43:	89 f8                	mov    %edi,%eax
+    1e45:	29 d0                	sub    %edx,%eax
+    1e47:	75 c7                	jne    1e10 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    1e49:	83 ec 08             	sub    $0x8,%esp
+    1e4c:	68 02 02 00 00       	push   $0x202
+    1e51:	68 6c 55 00 00       	push   $0x556c
+    1e56:	e8 08 21 00 00       	call   3f63 <open>
+    1e5b:	89 04 24             	mov    %eax,(%esp)
+    1e5e:	e8 e8 20 00 00       	call   3f4b <close>
+    1e63:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1e66:	83 eb 01             	sub    $0x1,%ebx
+    1e69:	75 bf                	jne    1e2a <linkunlink+0x6a>
+  if(pid)
+    1e6b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1e6e:	85 c0                	test   %eax,%eax
+    1e70:	74 4b                	je     1ebd <linkunlink+0xfd>
+    wait();
+    1e72:	e8 b4 20 00 00       	call   3f2b <wait>
+  printf(1, "linkunlink ok\n");
+    1e77:	83 ec 08             	sub    $0x8,%esp
+    1e7a:	68 7d 4b 00 00       	push   $0x4b7d
+    1e7f:	6a 01                	push   $0x1
+    1e81:	e8 4a 22 00 00       	call   40d0 <printf>
+}
+    1e86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e89:	5b                   	pop    %ebx
+    1e8a:	5e                   	pop    %esi
+    1e8b:	5f                   	pop    %edi
+    1e8c:	5d                   	pop    %ebp
+    1e8d:	c3                   	ret
+    1e8e:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    1e90:	83 ec 08             	sub    $0x8,%esp
+    1e93:	68 6c 55 00 00       	push   $0x556c
+    1e98:	68 79 4b 00 00       	push   $0x4b79
+    1e9d:	e8 e1 20 00 00       	call   3f83 <link>
+    1ea2:	83 c4 10             	add    $0x10,%esp
+    1ea5:	e9 7b ff ff ff       	jmp    1e25 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    1eaa:	52                   	push   %edx
+    1eab:	52                   	push   %edx
+    1eac:	68 97 48 00 00       	push   $0x4897
+    1eb1:	6a 01                	push   $0x1
+    1eb3:	e8 18 22 00 00       	call   40d0 <printf>
+    exit();
+    1eb8:	e8 66 20 00 00       	call   3f23 <exit>
+    exit();
+    1ebd:	e8 61 20 00 00       	call   3f23 <exit>
+    1ec2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ec9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001ed0 <bigdir>:
+{
+    1ed0:	55                   	push   %ebp
+    1ed1:	89 e5                	mov    %esp,%ebp
+    1ed3:	57                   	push   %edi
+    1ed4:	56                   	push   %esi
+    1ed5:	53                   	push   %ebx
+    1ed6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    1ed9:	68 8c 4b 00 00       	push   $0x4b8c
+    1ede:	6a 01                	push   $0x1
+    1ee0:	e8 eb 21 00 00       	call   40d0 <printf>
+  unlink("bd");
+    1ee5:	c7 04 24 99 4b 00 00 	movl   $0x4b99,(%esp)
+    1eec:	e8 82 20 00 00       	call   3f73 <unlink>
+  fd = open("bd", O_CREATE);
+    1ef1:	5a                   	pop    %edx
+    1ef2:	59                   	pop    %ecx
+    1ef3:	68 00 02 00 00       	push   $0x200
+    1ef8:	68 99 4b 00 00       	push   $0x4b99
+    1efd:	e8 61 20 00 00       	call   3f63 <open>
+  if(fd < 0){
+    1f02:	83 c4 10             	add    $0x10,%esp
+    1f05:	85 c0                	test   %eax,%eax
+    1f07:	0f 88 de 00 00 00    	js     1feb <bigdir+0x11b>
+  close(fd);
+    1f0d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    1f10:	31 f6                	xor    %esi,%esi
+    1f12:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    1f15:	50                   	push   %eax
+    1f16:	e8 30 20 00 00       	call   3f4b <close>
+    1f1b:	83 c4 10             	add    $0x10,%esp
+    1f1e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    1f20:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    1f22:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    1f25:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1f29:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1f2c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1f30:	83 c0 30             	add    $0x30,%eax
+    1f33:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1f36:	89 f0                	mov    %esi,%eax
+    1f38:	83 e0 3f             	and    $0x3f,%eax
+    1f3b:	83 c0 30             	add    $0x30,%eax
+    1f3e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    1f41:	57                   	push   %edi
+    1f42:	68 99 4b 00 00       	push   $0x4b99
+    1f47:	e8 37 20 00 00       	call   3f83 <link>
+    1f4c:	83 c4 10             	add    $0x10,%esp
+    1f4f:	89 c3                	mov    %eax,%ebx
+    1f51:	85 c0                	test   %eax,%eax
+    1f53:	75 6e                	jne    1fc3 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    1f55:	83 c6 01             	add    $0x1,%esi
+    1f58:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1f5e:	75 c0                	jne    1f20 <bigdir+0x50>
+  unlink("bd");
+    1f60:	83 ec 0c             	sub    $0xc,%esp
+    1f63:	68 99 4b 00 00       	push   $0x4b99
+    1f68:	e8 06 20 00 00       	call   3f73 <unlink>
+    1f6d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    1f70:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    1f72:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    1f75:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1f79:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1f7c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1f80:	83 c0 30             	add    $0x30,%eax
+    1f83:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1f86:	89 d8                	mov    %ebx,%eax
+    1f88:	83 e0 3f             	and    $0x3f,%eax
+    1f8b:	83 c0 30             	add    $0x30,%eax
+    1f8e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    1f91:	57                   	push   %edi
+    1f92:	e8 dc 1f 00 00       	call   3f73 <unlink>
+    1f97:	83 c4 10             	add    $0x10,%esp
+    1f9a:	85 c0                	test   %eax,%eax
+    1f9c:	75 39                	jne    1fd7 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    1f9e:	83 c3 01             	add    $0x1,%ebx
+    1fa1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1fa7:	75 c7                	jne    1f70 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    1fa9:	83 ec 08             	sub    $0x8,%esp
+    1fac:	68 db 4b 00 00       	push   $0x4bdb
+    1fb1:	6a 01                	push   $0x1
+    1fb3:	e8 18 21 00 00       	call   40d0 <printf>
+    1fb8:	83 c4 10             	add    $0x10,%esp
+}
+    1fbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1fbe:	5b                   	pop    %ebx
+    1fbf:	5e                   	pop    %esi
+    1fc0:	5f                   	pop    %edi
+    1fc1:	5d                   	pop    %ebp
+    1fc2:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    1fc3:	83 ec 08             	sub    $0x8,%esp
+    1fc6:	68 b2 4b 00 00       	push   $0x4bb2
+    1fcb:	6a 01                	push   $0x1
+    1fcd:	e8 fe 20 00 00       	call   40d0 <printf>
+      exit();
+    1fd2:	e8 4c 1f 00 00       	call   3f23 <exit>
+      printf(1, "bigdir unlink failed");
+    1fd7:	83 ec 08             	sub    $0x8,%esp
+    1fda:	68 c6 4b 00 00       	push   $0x4bc6
+    1fdf:	6a 01                	push   $0x1
+    1fe1:	e8 ea 20 00 00       	call   40d0 <printf>
+      exit();
+    1fe6:	e8 38 1f 00 00       	call   3f23 <exit>
+    printf(1, "bigdir create failed\n");
+    1feb:	50                   	push   %eax
+    1fec:	50                   	push   %eax
+    1fed:	68 9c 4b 00 00       	push   $0x4b9c
+    1ff2:	6a 01                	push   $0x1
+    1ff4:	e8 d7 20 00 00       	call   40d0 <printf>
+    exit();
+    1ff9:	e8 25 1f 00 00       	call   3f23 <exit>
+    1ffe:	66 90                	xchg   %ax,%ax
+
+00002000 <subdir>:
+{
+    2000:	55                   	push   %ebp
+    2001:	89 e5                	mov    %esp,%ebp
+    2003:	53                   	push   %ebx
+    2004:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    2007:	68 e6 4b 00 00       	push   $0x4be6
+    200c:	6a 01                	push   $0x1
+    200e:	e8 bd 20 00 00       	call   40d0 <printf>
+  unlink("ff");
+    2013:	c7 04 24 6f 4c 00 00 	movl   $0x4c6f,(%esp)
+    201a:	e8 54 1f 00 00       	call   3f73 <unlink>
+  if(mkdir("dd") != 0){
+    201f:	c7 04 24 0c 4d 00 00 	movl   $0x4d0c,(%esp)
+    2026:	e8 60 1f 00 00       	call   3f8b <mkdir>
+    202b:	83 c4 10             	add    $0x10,%esp
+    202e:	85 c0                	test   %eax,%eax
+    2030:	0f 85 b3 05 00 00    	jne    25e9 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    2036:	83 ec 08             	sub    $0x8,%esp
+    2039:	68 02 02 00 00       	push   $0x202
+    203e:	68 45 4c 00 00       	push   $0x4c45
+    2043:	e8 1b 1f 00 00       	call   3f63 <open>
+  if(fd < 0){
+    2048:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    204b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    204d:	85 c0                	test   %eax,%eax
+    204f:	0f 88 81 05 00 00    	js     25d6 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    2055:	83 ec 04             	sub    $0x4,%esp
+    2058:	6a 02                	push   $0x2
+    205a:	68 6f 4c 00 00       	push   $0x4c6f
+    205f:	50                   	push   %eax
+    2060:	e8 de 1e 00 00       	call   3f43 <write>
+  close(fd);
+    2065:	89 1c 24             	mov    %ebx,(%esp)
+    2068:	e8 de 1e 00 00       	call   3f4b <close>
+  if(unlink("dd") >= 0){
+    206d:	c7 04 24 0c 4d 00 00 	movl   $0x4d0c,(%esp)
+    2074:	e8 fa 1e 00 00       	call   3f73 <unlink>
+    2079:	83 c4 10             	add    $0x10,%esp
+    207c:	85 c0                	test   %eax,%eax
+    207e:	0f 89 3f 05 00 00    	jns    25c3 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    2084:	83 ec 0c             	sub    $0xc,%esp
+    2087:	68 20 4c 00 00       	push   $0x4c20
+    208c:	e8 fa 1e 00 00       	call   3f8b <mkdir>
+    2091:	83 c4 10             	add    $0x10,%esp
+    2094:	85 c0                	test   %eax,%eax
+    2096:	0f 85 14 05 00 00    	jne    25b0 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    209c:	83 ec 08             	sub    $0x8,%esp
+    209f:	68 02 02 00 00       	push   $0x202
+    20a4:	68 42 4c 00 00       	push   $0x4c42
+    20a9:	e8 b5 1e 00 00       	call   3f63 <open>
+  if(fd < 0){
+    20ae:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    20b1:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    20b3:	85 c0                	test   %eax,%eax
+    20b5:	0f 88 24 04 00 00    	js     24df <subdir+0x4df>
+  write(fd, "FF", 2);
+    20bb:	83 ec 04             	sub    $0x4,%esp
+    20be:	6a 02                	push   $0x2
+    20c0:	68 63 4c 00 00       	push   $0x4c63
+    20c5:	50                   	push   %eax
+    20c6:	e8 78 1e 00 00       	call   3f43 <write>
+  close(fd);
+    20cb:	89 1c 24             	mov    %ebx,(%esp)
+    20ce:	e8 78 1e 00 00       	call   3f4b <close>
+  fd = open("dd/dd/../ff", 0);
+    20d3:	58                   	pop    %eax
+    20d4:	5a                   	pop    %edx
+    20d5:	6a 00                	push   $0x0
+    20d7:	68 66 4c 00 00       	push   $0x4c66
+    20dc:	e8 82 1e 00 00       	call   3f63 <open>
+  if(fd < 0){
+    20e1:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    20e4:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    20e6:	85 c0                	test   %eax,%eax
+    20e8:	0f 88 de 03 00 00    	js     24cc <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    20ee:	83 ec 04             	sub    $0x4,%esp
+    20f1:	68 00 20 00 00       	push   $0x2000
+    20f6:	68 00 90 00 00       	push   $0x9000
+    20fb:	50                   	push   %eax
+    20fc:	e8 3a 1e 00 00       	call   3f3b <read>
+  if(cc != 2 || buf[0] != 'f'){
+    2101:	83 c4 10             	add    $0x10,%esp
+    2104:	83 f8 02             	cmp    $0x2,%eax
+    2107:	0f 85 3a 03 00 00    	jne    2447 <subdir+0x447>
+    210d:	80 3d 00 90 00 00 66 	cmpb   $0x66,0x9000
+    2114:	0f 85 2d 03 00 00    	jne    2447 <subdir+0x447>
+  close(fd);
+    211a:	83 ec 0c             	sub    $0xc,%esp
+    211d:	53                   	push   %ebx
+    211e:	e8 28 1e 00 00       	call   3f4b <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    2123:	59                   	pop    %ecx
+    2124:	5b                   	pop    %ebx
+    2125:	68 a6 4c 00 00       	push   $0x4ca6
+    212a:	68 42 4c 00 00       	push   $0x4c42
+    212f:	e8 4f 1e 00 00       	call   3f83 <link>
+    2134:	83 c4 10             	add    $0x10,%esp
+    2137:	85 c0                	test   %eax,%eax
+    2139:	0f 85 c6 03 00 00    	jne    2505 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    213f:	83 ec 0c             	sub    $0xc,%esp
+    2142:	68 42 4c 00 00       	push   $0x4c42
+    2147:	e8 27 1e 00 00       	call   3f73 <unlink>
+    214c:	83 c4 10             	add    $0x10,%esp
+    214f:	85 c0                	test   %eax,%eax
+    2151:	0f 85 16 03 00 00    	jne    246d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2157:	83 ec 08             	sub    $0x8,%esp
+    215a:	6a 00                	push   $0x0
+    215c:	68 42 4c 00 00       	push   $0x4c42
+    2161:	e8 fd 1d 00 00       	call   3f63 <open>
+    2166:	83 c4 10             	add    $0x10,%esp
+    2169:	85 c0                	test   %eax,%eax
+    216b:	0f 89 2c 04 00 00    	jns    259d <subdir+0x59d>
+  if(chdir("dd") != 0){
+    2171:	83 ec 0c             	sub    $0xc,%esp
+    2174:	68 0c 4d 00 00       	push   $0x4d0c
+    2179:	e8 15 1e 00 00       	call   3f93 <chdir>
+    217e:	83 c4 10             	add    $0x10,%esp
+    2181:	85 c0                	test   %eax,%eax
+    2183:	0f 85 01 04 00 00    	jne    258a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    2189:	83 ec 0c             	sub    $0xc,%esp
+    218c:	68 da 4c 00 00       	push   $0x4cda
+    2191:	e8 fd 1d 00 00       	call   3f93 <chdir>
+    2196:	83 c4 10             	add    $0x10,%esp
+    2199:	85 c0                	test   %eax,%eax
+    219b:	0f 85 b9 02 00 00    	jne    245a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    21a1:	83 ec 0c             	sub    $0xc,%esp
+    21a4:	68 00 4d 00 00       	push   $0x4d00
+    21a9:	e8 e5 1d 00 00       	call   3f93 <chdir>
+    21ae:	83 c4 10             	add    $0x10,%esp
+    21b1:	85 c0                	test   %eax,%eax
+    21b3:	0f 85 a1 02 00 00    	jne    245a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    21b9:	83 ec 0c             	sub    $0xc,%esp
+    21bc:	68 0f 4d 00 00       	push   $0x4d0f
+    21c1:	e8 cd 1d 00 00       	call   3f93 <chdir>
+    21c6:	83 c4 10             	add    $0x10,%esp
+    21c9:	85 c0                	test   %eax,%eax
+    21cb:	0f 85 21 03 00 00    	jne    24f2 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    21d1:	83 ec 08             	sub    $0x8,%esp
+    21d4:	6a 00                	push   $0x0
+    21d6:	68 a6 4c 00 00       	push   $0x4ca6
+    21db:	e8 83 1d 00 00       	call   3f63 <open>
+  if(fd < 0){
+    21e0:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    21e3:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    21e5:	85 c0                	test   %eax,%eax
+    21e7:	0f 88 e0 04 00 00    	js     26cd <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    21ed:	83 ec 04             	sub    $0x4,%esp
+    21f0:	68 00 20 00 00       	push   $0x2000
+    21f5:	68 00 90 00 00       	push   $0x9000
+    21fa:	50                   	push   %eax
+    21fb:	e8 3b 1d 00 00       	call   3f3b <read>
+    2200:	83 c4 10             	add    $0x10,%esp
+    2203:	83 f8 02             	cmp    $0x2,%eax
+    2206:	0f 85 ae 04 00 00    	jne    26ba <subdir+0x6ba>
+  close(fd);
+    220c:	83 ec 0c             	sub    $0xc,%esp
+    220f:	53                   	push   %ebx
+    2210:	e8 36 1d 00 00       	call   3f4b <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2215:	58                   	pop    %eax
+    2216:	5a                   	pop    %edx
+    2217:	6a 00                	push   $0x0
+    2219:	68 42 4c 00 00       	push   $0x4c42
+    221e:	e8 40 1d 00 00       	call   3f63 <open>
+    2223:	83 c4 10             	add    $0x10,%esp
+    2226:	85 c0                	test   %eax,%eax
+    2228:	0f 89 65 02 00 00    	jns    2493 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    222e:	83 ec 08             	sub    $0x8,%esp
+    2231:	68 02 02 00 00       	push   $0x202
+    2236:	68 5a 4d 00 00       	push   $0x4d5a
+    223b:	e8 23 1d 00 00       	call   3f63 <open>
+    2240:	83 c4 10             	add    $0x10,%esp
+    2243:	85 c0                	test   %eax,%eax
+    2245:	0f 89 35 02 00 00    	jns    2480 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    224b:	83 ec 08             	sub    $0x8,%esp
+    224e:	68 02 02 00 00       	push   $0x202
+    2253:	68 7f 4d 00 00       	push   $0x4d7f
+    2258:	e8 06 1d 00 00       	call   3f63 <open>
+    225d:	83 c4 10             	add    $0x10,%esp
+    2260:	85 c0                	test   %eax,%eax
+    2262:	0f 89 0f 03 00 00    	jns    2577 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    2268:	83 ec 08             	sub    $0x8,%esp
+    226b:	68 00 02 00 00       	push   $0x200
+    2270:	68 0c 4d 00 00       	push   $0x4d0c
+    2275:	e8 e9 1c 00 00       	call   3f63 <open>
+    227a:	83 c4 10             	add    $0x10,%esp
+    227d:	85 c0                	test   %eax,%eax
+    227f:	0f 89 df 02 00 00    	jns    2564 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    2285:	83 ec 08             	sub    $0x8,%esp
+    2288:	6a 02                	push   $0x2
+    228a:	68 0c 4d 00 00       	push   $0x4d0c
+    228f:	e8 cf 1c 00 00       	call   3f63 <open>
+    2294:	83 c4 10             	add    $0x10,%esp
+    2297:	85 c0                	test   %eax,%eax
+    2299:	0f 89 b2 02 00 00    	jns    2551 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    229f:	83 ec 08             	sub    $0x8,%esp
+    22a2:	6a 01                	push   $0x1
+    22a4:	68 0c 4d 00 00       	push   $0x4d0c
+    22a9:	e8 b5 1c 00 00       	call   3f63 <open>
+    22ae:	83 c4 10             	add    $0x10,%esp
+    22b1:	85 c0                	test   %eax,%eax
+    22b3:	0f 89 85 02 00 00    	jns    253e <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    22b9:	83 ec 08             	sub    $0x8,%esp
+    22bc:	68 ee 4d 00 00       	push   $0x4dee
+    22c1:	68 5a 4d 00 00       	push   $0x4d5a
+    22c6:	e8 b8 1c 00 00       	call   3f83 <link>
+    22cb:	83 c4 10             	add    $0x10,%esp
+    22ce:	85 c0                	test   %eax,%eax
+    22d0:	0f 84 55 02 00 00    	je     252b <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    22d6:	83 ec 08             	sub    $0x8,%esp
+    22d9:	68 ee 4d 00 00       	push   $0x4dee
+    22de:	68 7f 4d 00 00       	push   $0x4d7f
+    22e3:	e8 9b 1c 00 00       	call   3f83 <link>
+    22e8:	83 c4 10             	add    $0x10,%esp
+    22eb:	85 c0                	test   %eax,%eax
+    22ed:	0f 84 25 02 00 00    	je     2518 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    22f3:	83 ec 08             	sub    $0x8,%esp
+    22f6:	68 a6 4c 00 00       	push   $0x4ca6
+    22fb:	68 45 4c 00 00       	push   $0x4c45
+    2300:	e8 7e 1c 00 00       	call   3f83 <link>
+    2305:	83 c4 10             	add    $0x10,%esp
+    2308:	85 c0                	test   %eax,%eax
+    230a:	0f 84 a9 01 00 00    	je     24b9 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    2310:	83 ec 0c             	sub    $0xc,%esp
+    2313:	68 5a 4d 00 00       	push   $0x4d5a
+    2318:	e8 6e 1c 00 00       	call   3f8b <mkdir>
+    231d:	83 c4 10             	add    $0x10,%esp
+    2320:	85 c0                	test   %eax,%eax
+    2322:	0f 84 7e 01 00 00    	je     24a6 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    2328:	83 ec 0c             	sub    $0xc,%esp
+    232b:	68 7f 4d 00 00       	push   $0x4d7f
+    2330:	e8 56 1c 00 00       	call   3f8b <mkdir>
+    2335:	83 c4 10             	add    $0x10,%esp
+    2338:	85 c0                	test   %eax,%eax
+    233a:	0f 84 67 03 00 00    	je     26a7 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    2340:	83 ec 0c             	sub    $0xc,%esp
+    2343:	68 a6 4c 00 00       	push   $0x4ca6
+    2348:	e8 3e 1c 00 00       	call   3f8b <mkdir>
+    234d:	83 c4 10             	add    $0x10,%esp
+    2350:	85 c0                	test   %eax,%eax
+    2352:	0f 84 3c 03 00 00    	je     2694 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    2358:	83 ec 0c             	sub    $0xc,%esp
+    235b:	68 7f 4d 00 00       	push   $0x4d7f
+    2360:	e8 0e 1c 00 00       	call   3f73 <unlink>
+    2365:	83 c4 10             	add    $0x10,%esp
+    2368:	85 c0                	test   %eax,%eax
+    236a:	0f 84 11 03 00 00    	je     2681 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    2370:	83 ec 0c             	sub    $0xc,%esp
+    2373:	68 5a 4d 00 00       	push   $0x4d5a
+    2378:	e8 f6 1b 00 00       	call   3f73 <unlink>
+    237d:	83 c4 10             	add    $0x10,%esp
+    2380:	85 c0                	test   %eax,%eax
+    2382:	0f 84 e6 02 00 00    	je     266e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    2388:	83 ec 0c             	sub    $0xc,%esp
+    238b:	68 45 4c 00 00       	push   $0x4c45
+    2390:	e8 fe 1b 00 00       	call   3f93 <chdir>
+    2395:	83 c4 10             	add    $0x10,%esp
+    2398:	85 c0                	test   %eax,%eax
+    239a:	0f 84 bb 02 00 00    	je     265b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    23a0:	83 ec 0c             	sub    $0xc,%esp
+    23a3:	68 f1 4d 00 00       	push   $0x4df1
+    23a8:	e8 e6 1b 00 00       	call   3f93 <chdir>
+    23ad:	83 c4 10             	add    $0x10,%esp
+    23b0:	85 c0                	test   %eax,%eax
+    23b2:	0f 84 90 02 00 00    	je     2648 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    23b8:	83 ec 0c             	sub    $0xc,%esp
+    23bb:	68 a6 4c 00 00       	push   $0x4ca6
+    23c0:	e8 ae 1b 00 00       	call   3f73 <unlink>
+    23c5:	83 c4 10             	add    $0x10,%esp
+    23c8:	85 c0                	test   %eax,%eax
+    23ca:	0f 85 9d 00 00 00    	jne    246d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    23d0:	83 ec 0c             	sub    $0xc,%esp
+    23d3:	68 45 4c 00 00       	push   $0x4c45
+    23d8:	e8 96 1b 00 00       	call   3f73 <unlink>
+    23dd:	83 c4 10             	add    $0x10,%esp
+    23e0:	85 c0                	test   %eax,%eax
+    23e2:	0f 85 4d 02 00 00    	jne    2635 <subdir+0x635>
+  if(unlink("dd") == 0){
+    23e8:	83 ec 0c             	sub    $0xc,%esp
+    23eb:	68 0c 4d 00 00       	push   $0x4d0c
+    23f0:	e8 7e 1b 00 00       	call   3f73 <unlink>
+    23f5:	83 c4 10             	add    $0x10,%esp
+    23f8:	85 c0                	test   %eax,%eax
+    23fa:	0f 84 22 02 00 00    	je     2622 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    2400:	83 ec 0c             	sub    $0xc,%esp
+    2403:	68 21 4c 00 00       	push   $0x4c21
+    2408:	e8 66 1b 00 00       	call   3f73 <unlink>
+    240d:	83 c4 10             	add    $0x10,%esp
+    2410:	85 c0                	test   %eax,%eax
+    2412:	0f 88 f7 01 00 00    	js     260f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    2418:	83 ec 0c             	sub    $0xc,%esp
+    241b:	68 0c 4d 00 00       	push   $0x4d0c
+    2420:	e8 4e 1b 00 00       	call   3f73 <unlink>
+    2425:	83 c4 10             	add    $0x10,%esp
+    2428:	85 c0                	test   %eax,%eax
+    242a:	0f 88 cc 01 00 00    	js     25fc <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    2430:	83 ec 08             	sub    $0x8,%esp
+    2433:	68 ee 4e 00 00       	push   $0x4eee
+    2438:	6a 01                	push   $0x1
+    243a:	e8 91 1c 00 00       	call   40d0 <printf>
+}
+    243f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2442:	83 c4 10             	add    $0x10,%esp
+    2445:	c9                   	leave
+    2446:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    2447:	50                   	push   %eax
+    2448:	50                   	push   %eax
+    2449:	68 8b 4c 00 00       	push   $0x4c8b
+    244e:	6a 01                	push   $0x1
+    2450:	e8 7b 1c 00 00       	call   40d0 <printf>
+    exit();
+    2455:	e8 c9 1a 00 00       	call   3f23 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    245a:	50                   	push   %eax
+    245b:	50                   	push   %eax
+    245c:	68 e6 4c 00 00       	push   $0x4ce6
+    2461:	6a 01                	push   $0x1
+    2463:	e8 68 1c 00 00       	call   40d0 <printf>
+    exit();
+    2468:	e8 b6 1a 00 00       	call   3f23 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    246d:	50                   	push   %eax
+    246e:	50                   	push   %eax
+    246f:	68 b1 4c 00 00       	push   $0x4cb1
+    2474:	6a 01                	push   $0x1
+    2476:	e8 55 1c 00 00       	call   40d0 <printf>
+    exit();
+    247b:	e8 a3 1a 00 00       	call   3f23 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2480:	51                   	push   %ecx
+    2481:	51                   	push   %ecx
+    2482:	68 63 4d 00 00       	push   $0x4d63
+    2487:	6a 01                	push   $0x1
+    2489:	e8 42 1c 00 00       	call   40d0 <printf>
+    exit();
+    248e:	e8 90 1a 00 00       	call   3f23 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2493:	53                   	push   %ebx
+    2494:	53                   	push   %ebx
+    2495:	68 34 59 00 00       	push   $0x5934
+    249a:	6a 01                	push   $0x1
+    249c:	e8 2f 1c 00 00       	call   40d0 <printf>
+    exit();
+    24a1:	e8 7d 1a 00 00       	call   3f23 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    24a6:	51                   	push   %ecx
+    24a7:	51                   	push   %ecx
+    24a8:	68 f7 4d 00 00       	push   $0x4df7
+    24ad:	6a 01                	push   $0x1
+    24af:	e8 1c 1c 00 00       	call   40d0 <printf>
+    exit();
+    24b4:	e8 6a 1a 00 00       	call   3f23 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    24b9:	53                   	push   %ebx
+    24ba:	53                   	push   %ebx
+    24bb:	68 a4 59 00 00       	push   $0x59a4
+    24c0:	6a 01                	push   $0x1
+    24c2:	e8 09 1c 00 00       	call   40d0 <printf>
+    exit();
+    24c7:	e8 57 1a 00 00       	call   3f23 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    24cc:	50                   	push   %eax
+    24cd:	50                   	push   %eax
+    24ce:	68 72 4c 00 00       	push   $0x4c72
+    24d3:	6a 01                	push   $0x1
+    24d5:	e8 f6 1b 00 00       	call   40d0 <printf>
+    exit();
+    24da:	e8 44 1a 00 00       	call   3f23 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    24df:	51                   	push   %ecx
+    24e0:	51                   	push   %ecx
+    24e1:	68 4b 4c 00 00       	push   $0x4c4b
+    24e6:	6a 01                	push   $0x1
+    24e8:	e8 e3 1b 00 00       	call   40d0 <printf>
+    exit();
+    24ed:	e8 31 1a 00 00       	call   3f23 <exit>
+    printf(1, "chdir ./.. failed\n");
+    24f2:	50                   	push   %eax
+    24f3:	50                   	push   %eax
+    24f4:	68 14 4d 00 00       	push   $0x4d14
+    24f9:	6a 01                	push   $0x1
+    24fb:	e8 d0 1b 00 00       	call   40d0 <printf>
+    exit();
+    2500:	e8 1e 1a 00 00       	call   3f23 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2505:	52                   	push   %edx
+    2506:	52                   	push   %edx
+    2507:	68 ec 58 00 00       	push   $0x58ec
+    250c:	6a 01                	push   $0x1
+    250e:	e8 bd 1b 00 00       	call   40d0 <printf>
+    exit();
+    2513:	e8 0b 1a 00 00       	call   3f23 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    2518:	50                   	push   %eax
+    2519:	50                   	push   %eax
+    251a:	68 80 59 00 00       	push   $0x5980
+    251f:	6a 01                	push   $0x1
+    2521:	e8 aa 1b 00 00       	call   40d0 <printf>
+    exit();
+    2526:	e8 f8 19 00 00       	call   3f23 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    252b:	50                   	push   %eax
+    252c:	50                   	push   %eax
+    252d:	68 5c 59 00 00       	push   $0x595c
+    2532:	6a 01                	push   $0x1
+    2534:	e8 97 1b 00 00       	call   40d0 <printf>
+    exit();
+    2539:	e8 e5 19 00 00       	call   3f23 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    253e:	50                   	push   %eax
+    253f:	50                   	push   %eax
+    2540:	68 d3 4d 00 00       	push   $0x4dd3
+    2545:	6a 01                	push   $0x1
+    2547:	e8 84 1b 00 00       	call   40d0 <printf>
+    exit();
+    254c:	e8 d2 19 00 00       	call   3f23 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    2551:	50                   	push   %eax
+    2552:	50                   	push   %eax
+    2553:	68 ba 4d 00 00       	push   $0x4dba
+    2558:	6a 01                	push   $0x1
+    255a:	e8 71 1b 00 00       	call   40d0 <printf>
+    exit();
+    255f:	e8 bf 19 00 00       	call   3f23 <exit>
+    printf(1, "create dd succeeded!\n");
+    2564:	50                   	push   %eax
+    2565:	50                   	push   %eax
+    2566:	68 a4 4d 00 00       	push   $0x4da4
+    256b:	6a 01                	push   $0x1
+    256d:	e8 5e 1b 00 00       	call   40d0 <printf>
+    exit();
+    2572:	e8 ac 19 00 00       	call   3f23 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2577:	52                   	push   %edx
+    2578:	52                   	push   %edx
+    2579:	68 88 4d 00 00       	push   $0x4d88
+    257e:	6a 01                	push   $0x1
+    2580:	e8 4b 1b 00 00       	call   40d0 <printf>
+    exit();
+    2585:	e8 99 19 00 00       	call   3f23 <exit>
+    printf(1, "chdir dd failed\n");
+    258a:	50                   	push   %eax
+    258b:	50                   	push   %eax
+    258c:	68 c9 4c 00 00       	push   $0x4cc9
+    2591:	6a 01                	push   $0x1
+    2593:	e8 38 1b 00 00       	call   40d0 <printf>
+    exit();
+    2598:	e8 86 19 00 00       	call   3f23 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    259d:	50                   	push   %eax
+    259e:	50                   	push   %eax
+    259f:	68 10 59 00 00       	push   $0x5910
+    25a4:	6a 01                	push   $0x1
+    25a6:	e8 25 1b 00 00       	call   40d0 <printf>
+    exit();
+    25ab:	e8 73 19 00 00       	call   3f23 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    25b0:	53                   	push   %ebx
+    25b1:	53                   	push   %ebx
+    25b2:	68 27 4c 00 00       	push   $0x4c27
+    25b7:	6a 01                	push   $0x1
+    25b9:	e8 12 1b 00 00       	call   40d0 <printf>
+    exit();
+    25be:	e8 60 19 00 00       	call   3f23 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    25c3:	50                   	push   %eax
+    25c4:	50                   	push   %eax
+    25c5:	68 c4 58 00 00       	push   $0x58c4
+    25ca:	6a 01                	push   $0x1
+    25cc:	e8 ff 1a 00 00       	call   40d0 <printf>
+    exit();
+    25d1:	e8 4d 19 00 00       	call   3f23 <exit>
+    printf(1, "create dd/ff failed\n");
+    25d6:	50                   	push   %eax
+    25d7:	50                   	push   %eax
+    25d8:	68 0b 4c 00 00       	push   $0x4c0b
+    25dd:	6a 01                	push   $0x1
+    25df:	e8 ec 1a 00 00       	call   40d0 <printf>
+    exit();
+    25e4:	e8 3a 19 00 00       	call   3f23 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    25e9:	50                   	push   %eax
+    25ea:	50                   	push   %eax
+    25eb:	68 f3 4b 00 00       	push   $0x4bf3
+    25f0:	6a 01                	push   $0x1
+    25f2:	e8 d9 1a 00 00       	call   40d0 <printf>
+    exit();
+    25f7:	e8 27 19 00 00       	call   3f23 <exit>
+    printf(1, "unlink dd failed\n");
+    25fc:	50                   	push   %eax
+    25fd:	50                   	push   %eax
+    25fe:	68 dc 4e 00 00       	push   $0x4edc
+    2603:	6a 01                	push   $0x1
+    2605:	e8 c6 1a 00 00       	call   40d0 <printf>
+    exit();
+    260a:	e8 14 19 00 00       	call   3f23 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    260f:	52                   	push   %edx
+    2610:	52                   	push   %edx
+    2611:	68 c7 4e 00 00       	push   $0x4ec7
+    2616:	6a 01                	push   $0x1
+    2618:	e8 b3 1a 00 00       	call   40d0 <printf>
+    exit();
+    261d:	e8 01 19 00 00       	call   3f23 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2622:	51                   	push   %ecx
+    2623:	51                   	push   %ecx
+    2624:	68 c8 59 00 00       	push   $0x59c8
+    2629:	6a 01                	push   $0x1
+    262b:	e8 a0 1a 00 00       	call   40d0 <printf>
+    exit();
+    2630:	e8 ee 18 00 00       	call   3f23 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    2635:	53                   	push   %ebx
+    2636:	53                   	push   %ebx
+    2637:	68 b2 4e 00 00       	push   $0x4eb2
+    263c:	6a 01                	push   $0x1
+    263e:	e8 8d 1a 00 00       	call   40d0 <printf>
+    exit();
+    2643:	e8 db 18 00 00       	call   3f23 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    2648:	50                   	push   %eax
+    2649:	50                   	push   %eax
+    264a:	68 9a 4e 00 00       	push   $0x4e9a
+    264f:	6a 01                	push   $0x1
+    2651:	e8 7a 1a 00 00       	call   40d0 <printf>
+    exit();
+    2656:	e8 c8 18 00 00       	call   3f23 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    265b:	50                   	push   %eax
+    265c:	50                   	push   %eax
+    265d:	68 82 4e 00 00       	push   $0x4e82
+    2662:	6a 01                	push   $0x1
+    2664:	e8 67 1a 00 00       	call   40d0 <printf>
+    exit();
+    2669:	e8 b5 18 00 00       	call   3f23 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    266e:	50                   	push   %eax
+    266f:	50                   	push   %eax
+    2670:	68 66 4e 00 00       	push   $0x4e66
+    2675:	6a 01                	push   $0x1
+    2677:	e8 54 1a 00 00       	call   40d0 <printf>
+    exit();
+    267c:	e8 a2 18 00 00       	call   3f23 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2681:	50                   	push   %eax
+    2682:	50                   	push   %eax
+    2683:	68 4a 4e 00 00       	push   $0x4e4a
+    2688:	6a 01                	push   $0x1
+    268a:	e8 41 1a 00 00       	call   40d0 <printf>
+    exit();
+    268f:	e8 8f 18 00 00       	call   3f23 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    2694:	50                   	push   %eax
+    2695:	50                   	push   %eax
+    2696:	68 2d 4e 00 00       	push   $0x4e2d
+    269b:	6a 01                	push   $0x1
+    269d:	e8 2e 1a 00 00       	call   40d0 <printf>
+    exit();
+    26a2:	e8 7c 18 00 00       	call   3f23 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    26a7:	52                   	push   %edx
+    26a8:	52                   	push   %edx
+    26a9:	68 12 4e 00 00       	push   $0x4e12
+    26ae:	6a 01                	push   $0x1
+    26b0:	e8 1b 1a 00 00       	call   40d0 <printf>
+    exit();
+    26b5:	e8 69 18 00 00       	call   3f23 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    26ba:	51                   	push   %ecx
+    26bb:	51                   	push   %ecx
+    26bc:	68 3f 4d 00 00       	push   $0x4d3f
+    26c1:	6a 01                	push   $0x1
+    26c3:	e8 08 1a 00 00       	call   40d0 <printf>
+    exit();
+    26c8:	e8 56 18 00 00       	call   3f23 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    26cd:	53                   	push   %ebx
+    26ce:	53                   	push   %ebx
+    26cf:	68 27 4d 00 00       	push   $0x4d27
+    26d4:	6a 01                	push   $0x1
+    26d6:	e8 f5 19 00 00       	call   40d0 <printf>
+    exit();
+    26db:	e8 43 18 00 00       	call   3f23 <exit>
+
+000026e0 <bigwrite>:
+{
+    26e0:	55                   	push   %ebp
+    26e1:	89 e5                	mov    %esp,%ebp
+    26e3:	56                   	push   %esi
+    26e4:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    26e5:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    26ea:	83 ec 08             	sub    $0x8,%esp
+    26ed:	68 f9 4e 00 00       	push   $0x4ef9
+    26f2:	6a 01                	push   $0x1
+    26f4:	e8 d7 19 00 00       	call   40d0 <printf>
+  unlink("bigwrite");
+    26f9:	c7 04 24 08 4f 00 00 	movl   $0x4f08,(%esp)
+    2700:	e8 6e 18 00 00       	call   3f73 <unlink>
+    2705:	83 c4 10             	add    $0x10,%esp
+    2708:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    270f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2710:	83 ec 08             	sub    $0x8,%esp
+    2713:	68 02 02 00 00       	push   $0x202
+    2718:	68 08 4f 00 00       	push   $0x4f08
+    271d:	e8 41 18 00 00       	call   3f63 <open>
+    if(fd < 0){
+    2722:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2725:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    2727:	85 c0                	test   %eax,%eax
+    2729:	78 7e                	js     27a9 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    272b:	83 ec 04             	sub    $0x4,%esp
+    272e:	53                   	push   %ebx
+    272f:	68 00 90 00 00       	push   $0x9000
+    2734:	50                   	push   %eax
+    2735:	e8 09 18 00 00       	call   3f43 <write>
+      if(cc != sz){
+    273a:	83 c4 10             	add    $0x10,%esp
+    273d:	39 d8                	cmp    %ebx,%eax
+    273f:	75 55                	jne    2796 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    2741:	83 ec 04             	sub    $0x4,%esp
+    2744:	53                   	push   %ebx
+    2745:	68 00 90 00 00       	push   $0x9000
+    274a:	56                   	push   %esi
+    274b:	e8 f3 17 00 00       	call   3f43 <write>
+      if(cc != sz){
+    2750:	83 c4 10             	add    $0x10,%esp
+    2753:	39 c3                	cmp    %eax,%ebx
+    2755:	75 3f                	jne    2796 <bigwrite+0xb6>
+    close(fd);
+    2757:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    275a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    2760:	56                   	push   %esi
+    2761:	e8 e5 17 00 00       	call   3f4b <close>
+    unlink("bigwrite");
+    2766:	c7 04 24 08 4f 00 00 	movl   $0x4f08,(%esp)
+    276d:	e8 01 18 00 00       	call   3f73 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2772:	83 c4 10             	add    $0x10,%esp
+    2775:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    277b:	75 93                	jne    2710 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    277d:	83 ec 08             	sub    $0x8,%esp
+    2780:	68 3b 4f 00 00       	push   $0x4f3b
+    2785:	6a 01                	push   $0x1
+    2787:	e8 44 19 00 00       	call   40d0 <printf>
+}
+    278c:	83 c4 10             	add    $0x10,%esp
+    278f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2792:	5b                   	pop    %ebx
+    2793:	5e                   	pop    %esi
+    2794:	5d                   	pop    %ebp
+    2795:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2796:	50                   	push   %eax
+    2797:	53                   	push   %ebx
+    2798:	68 29 4f 00 00       	push   $0x4f29
+    279d:	6a 01                	push   $0x1
+    279f:	e8 2c 19 00 00       	call   40d0 <printf>
+        exit();
+    27a4:	e8 7a 17 00 00       	call   3f23 <exit>
+      printf(1, "cannot create bigwrite\n");
+    27a9:	83 ec 08             	sub    $0x8,%esp
+    27ac:	68 11 4f 00 00       	push   $0x4f11
+    27b1:	6a 01                	push   $0x1
+    27b3:	e8 18 19 00 00       	call   40d0 <printf>
+      exit();
+    27b8:	e8 66 17 00 00       	call   3f23 <exit>
+    27bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000027c0 <bigfile>:
+{
+    27c0:	55                   	push   %ebp
+    27c1:	89 e5                	mov    %esp,%ebp
+    27c3:	57                   	push   %edi
+    27c4:	56                   	push   %esi
+    27c5:	53                   	push   %ebx
+    27c6:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    27c9:	68 48 4f 00 00       	push   $0x4f48
+    27ce:	6a 01                	push   $0x1
+    27d0:	e8 fb 18 00 00       	call   40d0 <printf>
+  unlink("bigfile");
+    27d5:	c7 04 24 64 4f 00 00 	movl   $0x4f64,(%esp)
+    27dc:	e8 92 17 00 00       	call   3f73 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    27e1:	58                   	pop    %eax
+    27e2:	5a                   	pop    %edx
+    27e3:	68 02 02 00 00       	push   $0x202
+    27e8:	68 64 4f 00 00       	push   $0x4f64
+    27ed:	e8 71 17 00 00       	call   3f63 <open>
+  if(fd < 0){
+    27f2:	83 c4 10             	add    $0x10,%esp
+    27f5:	85 c0                	test   %eax,%eax
+    27f7:	0f 88 5e 01 00 00    	js     295b <bigfile+0x19b>
+    27fd:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    27ff:	31 db                	xor    %ebx,%ebx
+    2801:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    2808:	83 ec 04             	sub    $0x4,%esp
+    280b:	68 58 02 00 00       	push   $0x258
+    2810:	53                   	push   %ebx
+    2811:	68 00 90 00 00       	push   $0x9000
+    2816:	e8 85 15 00 00       	call   3da0 <memset>
+    if(write(fd, buf, 600) != 600){
+    281b:	83 c4 0c             	add    $0xc,%esp
+    281e:	68 58 02 00 00       	push   $0x258
+    2823:	68 00 90 00 00       	push   $0x9000
+    2828:	56                   	push   %esi
+    2829:	e8 15 17 00 00       	call   3f43 <write>
+    282e:	83 c4 10             	add    $0x10,%esp
+    2831:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2836:	0f 85 f8 00 00 00    	jne    2934 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    283c:	83 c3 01             	add    $0x1,%ebx
+    283f:	83 fb 14             	cmp    $0x14,%ebx
+    2842:	75 c4                	jne    2808 <bigfile+0x48>
+  close(fd);
+    2844:	83 ec 0c             	sub    $0xc,%esp
+    2847:	56                   	push   %esi
+    2848:	e8 fe 16 00 00       	call   3f4b <close>
+  fd = open("bigfile", 0);
+    284d:	5e                   	pop    %esi
+    284e:	5f                   	pop    %edi
+    284f:	6a 00                	push   $0x0
+    2851:	68 64 4f 00 00       	push   $0x4f64
+    2856:	e8 08 17 00 00       	call   3f63 <open>
+  if(fd < 0){
+    285b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    285e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    2860:	85 c0                	test   %eax,%eax
+    2862:	0f 88 e0 00 00 00    	js     2948 <bigfile+0x188>
+  total = 0;
+    2868:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    286a:	31 ff                	xor    %edi,%edi
+    286c:	eb 30                	jmp    289e <bigfile+0xde>
+    286e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    2870:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    2875:	0f 85 91 00 00 00    	jne    290c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    287b:	89 fa                	mov    %edi,%edx
+    287d:	0f be 05 00 90 00 00 	movsbl 0x9000,%eax
+    2884:	d1 fa                	sar    %edx
+    2886:	39 d0                	cmp    %edx,%eax
+    2888:	75 6e                	jne    28f8 <bigfile+0x138>
+    288a:	0f be 15 2b 91 00 00 	movsbl 0x912b,%edx
+    2891:	39 d0                	cmp    %edx,%eax
+    2893:	75 63                	jne    28f8 <bigfile+0x138>
+    total += cc;
+    2895:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    289b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    289e:	83 ec 04             	sub    $0x4,%esp
+    28a1:	68 2c 01 00 00       	push   $0x12c
+    28a6:	68 00 90 00 00       	push   $0x9000
+    28ab:	56                   	push   %esi
+    28ac:	e8 8a 16 00 00       	call   3f3b <read>
+    if(cc < 0){
+    28b1:	83 c4 10             	add    $0x10,%esp
+    28b4:	85 c0                	test   %eax,%eax
+    28b6:	78 68                	js     2920 <bigfile+0x160>
+    if(cc == 0)
+    28b8:	75 b6                	jne    2870 <bigfile+0xb0>
+  close(fd);
+    28ba:	83 ec 0c             	sub    $0xc,%esp
+    28bd:	56                   	push   %esi
+    28be:	e8 88 16 00 00       	call   3f4b <close>
+  if(total != 20*600){
+    28c3:	83 c4 10             	add    $0x10,%esp
+    28c6:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    28cc:	0f 85 9c 00 00 00    	jne    296e <bigfile+0x1ae>
+  unlink("bigfile");
+    28d2:	83 ec 0c             	sub    $0xc,%esp
+    28d5:	68 64 4f 00 00       	push   $0x4f64
+    28da:	e8 94 16 00 00       	call   3f73 <unlink>
+  printf(1, "bigfile test ok\n");
+    28df:	58                   	pop    %eax
+    28e0:	5a                   	pop    %edx
+    28e1:	68 f3 4f 00 00       	push   $0x4ff3
+    28e6:	6a 01                	push   $0x1
+    28e8:	e8 e3 17 00 00       	call   40d0 <printf>
+}
+    28ed:	83 c4 10             	add    $0x10,%esp
+    28f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    28f3:	5b                   	pop    %ebx
+    28f4:	5e                   	pop    %esi
+    28f5:	5f                   	pop    %edi
+    28f6:	5d                   	pop    %ebp
+    28f7:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    28f8:	83 ec 08             	sub    $0x8,%esp
+    28fb:	68 c0 4f 00 00       	push   $0x4fc0
+    2900:	6a 01                	push   $0x1
+    2902:	e8 c9 17 00 00       	call   40d0 <printf>
+      exit();
+    2907:	e8 17 16 00 00       	call   3f23 <exit>
+      printf(1, "short read bigfile\n");
+    290c:	83 ec 08             	sub    $0x8,%esp
+    290f:	68 ac 4f 00 00       	push   $0x4fac
+    2914:	6a 01                	push   $0x1
+    2916:	e8 b5 17 00 00       	call   40d0 <printf>
+      exit();
+    291b:	e8 03 16 00 00       	call   3f23 <exit>
+      printf(1, "read bigfile failed\n");
+    2920:	83 ec 08             	sub    $0x8,%esp
+    2923:	68 97 4f 00 00       	push   $0x4f97
+    2928:	6a 01                	push   $0x1
+    292a:	e8 a1 17 00 00       	call   40d0 <printf>
+      exit();
+    292f:	e8 ef 15 00 00       	call   3f23 <exit>
+      printf(1, "write bigfile failed\n");
+    2934:	83 ec 08             	sub    $0x8,%esp
+    2937:	68 6c 4f 00 00       	push   $0x4f6c
+    293c:	6a 01                	push   $0x1
+    293e:	e8 8d 17 00 00       	call   40d0 <printf>
+      exit();
+    2943:	e8 db 15 00 00       	call   3f23 <exit>
+    printf(1, "cannot open bigfile\n");
+    2948:	53                   	push   %ebx
+    2949:	53                   	push   %ebx
+    294a:	68 82 4f 00 00       	push   $0x4f82
+    294f:	6a 01                	push   $0x1
+    2951:	e8 7a 17 00 00       	call   40d0 <printf>
+    exit();
+    2956:	e8 c8 15 00 00       	call   3f23 <exit>
+    printf(1, "cannot create bigfile");
+    295b:	50                   	push   %eax
+    295c:	50                   	push   %eax
+    295d:	68 56 4f 00 00       	push   $0x4f56
+    2962:	6a 01                	push   $0x1
+    2964:	e8 67 17 00 00       	call   40d0 <printf>
+    exit();
+    2969:	e8 b5 15 00 00       	call   3f23 <exit>
+    printf(1, "read bigfile wrong total\n");
+    296e:	51                   	push   %ecx
+    296f:	51                   	push   %ecx
+    2970:	68 d9 4f 00 00       	push   $0x4fd9
+    2975:	6a 01                	push   $0x1
+    2977:	e8 54 17 00 00       	call   40d0 <printf>
+    exit();
+    297c:	e8 a2 15 00 00       	call   3f23 <exit>
+    2981:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    298f:	90                   	nop
+
+00002990 <fourteen>:
+{
+    2990:	55                   	push   %ebp
+    2991:	89 e5                	mov    %esp,%ebp
+    2993:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    2996:	68 04 50 00 00       	push   $0x5004
+    299b:	6a 01                	push   $0x1
+    299d:	e8 2e 17 00 00       	call   40d0 <printf>
+  if(mkdir("12345678901234") != 0){
+    29a2:	c7 04 24 3f 50 00 00 	movl   $0x503f,(%esp)
+    29a9:	e8 dd 15 00 00       	call   3f8b <mkdir>
+    29ae:	83 c4 10             	add    $0x10,%esp
+    29b1:	85 c0                	test   %eax,%eax
+    29b3:	0f 85 97 00 00 00    	jne    2a50 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    29b9:	83 ec 0c             	sub    $0xc,%esp
+    29bc:	68 e8 59 00 00       	push   $0x59e8
+    29c1:	e8 c5 15 00 00       	call   3f8b <mkdir>
+    29c6:	83 c4 10             	add    $0x10,%esp
+    29c9:	85 c0                	test   %eax,%eax
+    29cb:	0f 85 de 00 00 00    	jne    2aaf <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    29d1:	83 ec 08             	sub    $0x8,%esp
+    29d4:	68 00 02 00 00       	push   $0x200
+    29d9:	68 38 5a 00 00       	push   $0x5a38
+    29de:	e8 80 15 00 00       	call   3f63 <open>
+  if(fd < 0){
+    29e3:	83 c4 10             	add    $0x10,%esp
+    29e6:	85 c0                	test   %eax,%eax
+    29e8:	0f 88 ae 00 00 00    	js     2a9c <fourteen+0x10c>
+  close(fd);
+    29ee:	83 ec 0c             	sub    $0xc,%esp
+    29f1:	50                   	push   %eax
+    29f2:	e8 54 15 00 00       	call   3f4b <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    29f7:	58                   	pop    %eax
+    29f8:	5a                   	pop    %edx
+    29f9:	6a 00                	push   $0x0
+    29fb:	68 a8 5a 00 00       	push   $0x5aa8
+    2a00:	e8 5e 15 00 00       	call   3f63 <open>
+  if(fd < 0){
+    2a05:	83 c4 10             	add    $0x10,%esp
+    2a08:	85 c0                	test   %eax,%eax
+    2a0a:	78 7d                	js     2a89 <fourteen+0xf9>
+  close(fd);
+    2a0c:	83 ec 0c             	sub    $0xc,%esp
+    2a0f:	50                   	push   %eax
+    2a10:	e8 36 15 00 00       	call   3f4b <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2a15:	c7 04 24 30 50 00 00 	movl   $0x5030,(%esp)
+    2a1c:	e8 6a 15 00 00       	call   3f8b <mkdir>
+    2a21:	83 c4 10             	add    $0x10,%esp
+    2a24:	85 c0                	test   %eax,%eax
+    2a26:	74 4e                	je     2a76 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    2a28:	83 ec 0c             	sub    $0xc,%esp
+    2a2b:	68 44 5b 00 00       	push   $0x5b44
+    2a30:	e8 56 15 00 00       	call   3f8b <mkdir>
+    2a35:	83 c4 10             	add    $0x10,%esp
+    2a38:	85 c0                	test   %eax,%eax
+    2a3a:	74 27                	je     2a63 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    2a3c:	83 ec 08             	sub    $0x8,%esp
+    2a3f:	68 4e 50 00 00       	push   $0x504e
+    2a44:	6a 01                	push   $0x1
+    2a46:	e8 85 16 00 00       	call   40d0 <printf>
+}
+    2a4b:	83 c4 10             	add    $0x10,%esp
+    2a4e:	c9                   	leave
+    2a4f:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    2a50:	50                   	push   %eax
+    2a51:	50                   	push   %eax
+    2a52:	68 13 50 00 00       	push   $0x5013
+    2a57:	6a 01                	push   $0x1
+    2a59:	e8 72 16 00 00       	call   40d0 <printf>
+    exit();
+    2a5e:	e8 c0 14 00 00       	call   3f23 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    2a63:	50                   	push   %eax
+    2a64:	50                   	push   %eax
+    2a65:	68 64 5b 00 00       	push   $0x5b64
+    2a6a:	6a 01                	push   $0x1
+    2a6c:	e8 5f 16 00 00       	call   40d0 <printf>
+    exit();
+    2a71:	e8 ad 14 00 00       	call   3f23 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    2a76:	52                   	push   %edx
+    2a77:	52                   	push   %edx
+    2a78:	68 14 5b 00 00       	push   $0x5b14
+    2a7d:	6a 01                	push   $0x1
+    2a7f:	e8 4c 16 00 00       	call   40d0 <printf>
+    exit();
+    2a84:	e8 9a 14 00 00       	call   3f23 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    2a89:	51                   	push   %ecx
+    2a8a:	51                   	push   %ecx
+    2a8b:	68 d8 5a 00 00       	push   $0x5ad8
+    2a90:	6a 01                	push   $0x1
+    2a92:	e8 39 16 00 00       	call   40d0 <printf>
+    exit();
+    2a97:	e8 87 14 00 00       	call   3f23 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    2a9c:	51                   	push   %ecx
+    2a9d:	51                   	push   %ecx
+    2a9e:	68 68 5a 00 00       	push   $0x5a68
+    2aa3:	6a 01                	push   $0x1
+    2aa5:	e8 26 16 00 00       	call   40d0 <printf>
+    exit();
+    2aaa:	e8 74 14 00 00       	call   3f23 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    2aaf:	50                   	push   %eax
+    2ab0:	50                   	push   %eax
+    2ab1:	68 08 5a 00 00       	push   $0x5a08
+    2ab6:	6a 01                	push   $0x1
+    2ab8:	e8 13 16 00 00       	call   40d0 <printf>
+    exit();
+    2abd:	e8 61 14 00 00       	call   3f23 <exit>
+    2ac2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2ac9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002ad0 <rmdot>:
+{
+    2ad0:	55                   	push   %ebp
+    2ad1:	89 e5                	mov    %esp,%ebp
+    2ad3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    2ad6:	68 5b 50 00 00       	push   $0x505b
+    2adb:	6a 01                	push   $0x1
+    2add:	e8 ee 15 00 00       	call   40d0 <printf>
+  if(mkdir("dots") != 0){
+    2ae2:	c7 04 24 67 50 00 00 	movl   $0x5067,(%esp)
+    2ae9:	e8 9d 14 00 00       	call   3f8b <mkdir>
+    2aee:	83 c4 10             	add    $0x10,%esp
+    2af1:	85 c0                	test   %eax,%eax
+    2af3:	0f 85 b0 00 00 00    	jne    2ba9 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    2af9:	83 ec 0c             	sub    $0xc,%esp
+    2afc:	68 67 50 00 00       	push   $0x5067
+    2b01:	e8 8d 14 00 00       	call   3f93 <chdir>
+    2b06:	83 c4 10             	add    $0x10,%esp
+    2b09:	85 c0                	test   %eax,%eax
+    2b0b:	0f 85 1d 01 00 00    	jne    2c2e <rmdot+0x15e>
+  if(unlink(".") == 0){
+    2b11:	83 ec 0c             	sub    $0xc,%esp
+    2b14:	68 12 4d 00 00       	push   $0x4d12
+    2b19:	e8 55 14 00 00       	call   3f73 <unlink>
+    2b1e:	83 c4 10             	add    $0x10,%esp
+    2b21:	85 c0                	test   %eax,%eax
+    2b23:	0f 84 f2 00 00 00    	je     2c1b <rmdot+0x14b>
+  if(unlink("..") == 0){
+    2b29:	83 ec 0c             	sub    $0xc,%esp
+    2b2c:	68 11 4d 00 00       	push   $0x4d11
+    2b31:	e8 3d 14 00 00       	call   3f73 <unlink>
+    2b36:	83 c4 10             	add    $0x10,%esp
+    2b39:	85 c0                	test   %eax,%eax
+    2b3b:	0f 84 c7 00 00 00    	je     2c08 <rmdot+0x138>
+  if(chdir("/") != 0){
+    2b41:	83 ec 0c             	sub    $0xc,%esp
+    2b44:	68 af 50 00 00       	push   $0x50af
+    2b49:	e8 45 14 00 00       	call   3f93 <chdir>
+    2b4e:	83 c4 10             	add    $0x10,%esp
+    2b51:	85 c0                	test   %eax,%eax
+    2b53:	0f 85 9c 00 00 00    	jne    2bf5 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    2b59:	83 ec 0c             	sub    $0xc,%esp
+    2b5c:	68 c1 50 00 00       	push   $0x50c1
+    2b61:	e8 0d 14 00 00       	call   3f73 <unlink>
+    2b66:	83 c4 10             	add    $0x10,%esp
+    2b69:	85 c0                	test   %eax,%eax
+    2b6b:	74 75                	je     2be2 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    2b6d:	83 ec 0c             	sub    $0xc,%esp
+    2b70:	68 df 50 00 00       	push   $0x50df
+    2b75:	e8 f9 13 00 00       	call   3f73 <unlink>
+    2b7a:	83 c4 10             	add    $0x10,%esp
+    2b7d:	85 c0                	test   %eax,%eax
+    2b7f:	74 4e                	je     2bcf <rmdot+0xff>
+  if(unlink("dots") != 0){
+    2b81:	83 ec 0c             	sub    $0xc,%esp
+    2b84:	68 67 50 00 00       	push   $0x5067
+    2b89:	e8 e5 13 00 00       	call   3f73 <unlink>
+    2b8e:	83 c4 10             	add    $0x10,%esp
+    2b91:	85 c0                	test   %eax,%eax
+    2b93:	75 27                	jne    2bbc <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    2b95:	83 ec 08             	sub    $0x8,%esp
+    2b98:	68 14 51 00 00       	push   $0x5114
+    2b9d:	6a 01                	push   $0x1
+    2b9f:	e8 2c 15 00 00       	call   40d0 <printf>
+}
+    2ba4:	83 c4 10             	add    $0x10,%esp
+    2ba7:	c9                   	leave
+    2ba8:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    2ba9:	50                   	push   %eax
+    2baa:	50                   	push   %eax
+    2bab:	68 6c 50 00 00       	push   $0x506c
+    2bb0:	6a 01                	push   $0x1
+    2bb2:	e8 19 15 00 00       	call   40d0 <printf>
+    exit();
+    2bb7:	e8 67 13 00 00       	call   3f23 <exit>
+    printf(1, "unlink dots failed!\n");
+    2bbc:	50                   	push   %eax
+    2bbd:	50                   	push   %eax
+    2bbe:	68 ff 50 00 00       	push   $0x50ff
+    2bc3:	6a 01                	push   $0x1
+    2bc5:	e8 06 15 00 00       	call   40d0 <printf>
+    exit();
+    2bca:	e8 54 13 00 00       	call   3f23 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    2bcf:	52                   	push   %edx
+    2bd0:	52                   	push   %edx
+    2bd1:	68 e7 50 00 00       	push   $0x50e7
+    2bd6:	6a 01                	push   $0x1
+    2bd8:	e8 f3 14 00 00       	call   40d0 <printf>
+    exit();
+    2bdd:	e8 41 13 00 00       	call   3f23 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    2be2:	51                   	push   %ecx
+    2be3:	51                   	push   %ecx
+    2be4:	68 c8 50 00 00       	push   $0x50c8
+    2be9:	6a 01                	push   $0x1
+    2beb:	e8 e0 14 00 00       	call   40d0 <printf>
+    exit();
+    2bf0:	e8 2e 13 00 00       	call   3f23 <exit>
+    printf(1, "chdir / failed\n");
+    2bf5:	50                   	push   %eax
+    2bf6:	50                   	push   %eax
+    2bf7:	68 b1 50 00 00       	push   $0x50b1
+    2bfc:	6a 01                	push   $0x1
+    2bfe:	e8 cd 14 00 00       	call   40d0 <printf>
+    exit();
+    2c03:	e8 1b 13 00 00       	call   3f23 <exit>
+    printf(1, "rm .. worked!\n");
+    2c08:	50                   	push   %eax
+    2c09:	50                   	push   %eax
+    2c0a:	68 a0 50 00 00       	push   $0x50a0
+    2c0f:	6a 01                	push   $0x1
+    2c11:	e8 ba 14 00 00       	call   40d0 <printf>
+    exit();
+    2c16:	e8 08 13 00 00       	call   3f23 <exit>
+    printf(1, "rm . worked!\n");
+    2c1b:	50                   	push   %eax
+    2c1c:	50                   	push   %eax
+    2c1d:	68 92 50 00 00       	push   $0x5092
+    2c22:	6a 01                	push   $0x1
+    2c24:	e8 a7 14 00 00       	call   40d0 <printf>
+    exit();
+    2c29:	e8 f5 12 00 00       	call   3f23 <exit>
+    printf(1, "chdir dots failed\n");
+    2c2e:	50                   	push   %eax
+    2c2f:	50                   	push   %eax
+    2c30:	68 7f 50 00 00       	push   $0x507f
+    2c35:	6a 01                	push   $0x1
+    2c37:	e8 94 14 00 00       	call   40d0 <printf>
+    exit();
+    2c3c:	e8 e2 12 00 00       	call   3f23 <exit>
+    2c41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2c4f:	90                   	nop
+
+00002c50 <namecache>:
+{
+    2c50:	55                   	push   %ebp
+    2c51:	89 e5                	mov    %esp,%ebp
+    2c53:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "name cache test\n");
+    2c56:	68 1e 51 00 00       	push   $0x511e
+    2c5b:	6a 01                	push   $0x1
+    2c5d:	e8 6e 14 00 00       	call   40d0 <printf>
+  if(mkdir("nc") != 0 || open("nc/f", O_RDONLY) >= 0){
+    2c62:	c7 04 24 2f 51 00 00 	movl   $0x512f,(%esp)
+    2c69:	e8 1d 13 00 00       	call   3f8b <mkdir>
+    2c6e:	83 c4 10             	add    $0x10,%esp
+    2c71:	85 c0                	test   %eax,%eax
+    2c73:	0f 85 ab 01 00 00    	jne    2e24 <namecache+0x1d4>
+    2c79:	83 ec 08             	sub    $0x8,%esp
+    2c7c:	6a 00                	push   $0x0
+    2c7e:	68 4e 51 00 00       	push   $0x514e
+    2c83:	e8 db 12 00 00       	call   3f63 <open>
+    2c88:	83 c4 10             	add    $0x10,%esp
+    2c8b:	85 c0                	test   %eax,%eax
+    2c8d:	0f 89 91 01 00 00    	jns    2e24 <namecache+0x1d4>
+  if((fd = open("nc/f", O_CREATE|O_RDWR)) < 0){
+    2c93:	83 ec 08             	sub    $0x8,%esp
+    2c96:	68 02 02 00 00       	push   $0x202
+    2c9b:	68 4e 51 00 00       	push   $0x514e
+    2ca0:	e8 be 12 00 00       	call   3f63 <open>
+    2ca5:	83 c4 10             	add    $0x10,%esp
+    2ca8:	85 c0                	test   %eax,%eax
+    2caa:	0f 88 e6 01 00 00    	js     2e96 <namecache+0x246>
+  close(fd);
+    2cb0:	83 ec 0c             	sub    $0xc,%esp
+    2cb3:	50                   	push   %eax
+    2cb4:	e8 92 12 00 00       	call   3f4b <close>
+  if((fd = open("nc/f", O_RDONLY)) < 0){
+    2cb9:	58                   	pop    %eax
+    2cba:	5a                   	pop    %edx
+    2cbb:	6a 00                	push   $0x0
+    2cbd:	68 4e 51 00 00       	push   $0x514e
+    2cc2:	e8 9c 12 00 00       	call   3f63 <open>
+    2cc7:	83 c4 10             	add    $0x10,%esp
+    2cca:	85 c0                	test   %eax,%eax
+    2ccc:	0f 88 b1 01 00 00    	js     2e83 <namecache+0x233>
+  close(fd);
+    2cd2:	83 ec 0c             	sub    $0xc,%esp
+    2cd5:	50                   	push   %eax
+    2cd6:	e8 70 12 00 00       	call   3f4b <close>
+  if(link("nc/f", "nc/g") != 0 || open("nc/g", O_RDONLY) < 0){
+    2cdb:	5a                   	pop    %edx
+    2cdc:	59                   	pop    %ecx
+    2cdd:	68 70 51 00 00       	push   $0x5170
+    2ce2:	68 4e 51 00 00       	push   $0x514e
+    2ce7:	e8 97 12 00 00       	call   3f83 <link>
+    2cec:	83 c4 10             	add    $0x10,%esp
+    2cef:	85 c0                	test   %eax,%eax
+    2cf1:	0f 85 79 01 00 00    	jne    2e70 <namecache+0x220>
+    2cf7:	83 ec 08             	sub    $0x8,%esp
+    2cfa:	6a 00                	push   $0x0
+    2cfc:	68 70 51 00 00       	push   $0x5170
+    2d01:	e8 5d 12 00 00       	call   3f63 <open>
+    2d06:	83 c4 10             	add    $0x10,%esp
+    2d09:	85 c0                	test   %eax,%eax
+    2d0b:	0f 88 5f 01 00 00    	js     2e70 <namecache+0x220>
+  if(unlink("nc/f") != 0 || unlink("nc/g") != 0){
+    2d11:	83 ec 0c             	sub    $0xc,%esp
+    2d14:	68 4e 51 00 00       	push   $0x514e
+    2d19:	e8 55 12 00 00       	call   3f73 <unlink>
+    2d1e:	83 c4 10             	add    $0x10,%esp
+    2d21:	85 c0                	test   %eax,%eax
+    2d23:	0f 85 34 01 00 00    	jne    2e5d <namecache+0x20d>
+    2d29:	83 ec 0c             	sub    $0xc,%esp
+    2d2c:	68 70 51 00 00       	push   $0x5170
+    2d31:	e8 3d 12 00 00       	call   3f73 <unlink>
+    2d36:	83 c4 10             	add    $0x10,%esp
+    2d39:	85 c0                	test   %eax,%eax
+    2d3b:	0f 85 1c 01 00 00    	jne    2e5d <namecache+0x20d>
+  if(open("nc/f", O_RDONLY) >= 0 || open("nc/g", O_RDONLY) >= 0){
+    2d41:	83 ec 08             	sub    $0x8,%esp
+    2d44:	6a 00                	push   $0x0
+    2d46:	68 4e 51 00 00       	push   $0x514e
+    2d4b:	e8 13 12 00 00       	call   3f63 <open>
+    2d50:	83 c4 10             	add    $0x10,%esp
+    2d53:	85 c0                	test   %eax,%eax
+    2d55:	0f 89 ef 00 00 00    	jns    2e4a <namecache+0x1fa>
+    2d5b:	83 ec 08             	sub    $0x8,%esp
+    2d5e:	6a 00                	push   $0x0
+    2d60:	68 70 51 00 00       	push   $0x5170
+    2d65:	e8 f9 11 00 00       	call   3f63 <open>
+    2d6a:	83 c4 10             	add    $0x10,%esp
+    2d6d:	85 c0                	test   %eax,%eax
+    2d6f:	0f 89 d5 00 00 00    	jns    2e4a <namecache+0x1fa>
+  if((fd = open("nc/f", O_CREATE|O_RDWR)) < 0){
+    2d75:	83 ec 08             	sub    $0x8,%esp
+    2d78:	68 02 02 00 00       	push   $0x202
+    2d7d:	68 4e 51 00 00       	push   $0x514e
+    2d82:	e8 dc 11 00 00       	call   3f63 <open>
+    2d87:	83 c4 10             	add    $0x10,%esp
+    2d8a:	85 c0                	test   %eax,%eax
+    2d8c:	0f 88 2a 01 00 00    	js     2ebc <namecache+0x26c>
+  close(fd);
+    2d92:	83 ec 0c             	sub    $0xc,%esp
+    2d95:	50                   	push   %eax
+    2d96:	e8 b0 11 00 00       	call   3f4b <close>
+  if(unlink("nc/f") != 0 || unlink("nc") != 0){
+    2d9b:	c7 04 24 4e 51 00 00 	movl   $0x514e,(%esp)
+    2da2:	e8 cc 11 00 00       	call   3f73 <unlink>
+    2da7:	83 c4 10             	add    $0x10,%esp
+    2daa:	85 c0                	test   %eax,%eax
+    2dac:	0f 85 85 00 00 00    	jne    2e37 <namecache+0x1e7>
+    2db2:	83 ec 0c             	sub    $0xc,%esp
+    2db5:	68 2f 51 00 00       	push   $0x512f
+    2dba:	e8 b4 11 00 00       	call   3f73 <unlink>
+    2dbf:	83 c4 10             	add    $0x10,%esp
+    2dc2:	85 c0                	test   %eax,%eax
+    2dc4:	75 71                	jne    2e37 <namecache+0x1e7>
+  if(mkdir("nc") != 0){
+    2dc6:	83 ec 0c             	sub    $0xc,%esp
+    2dc9:	68 2f 51 00 00       	push   $0x512f
+    2dce:	e8 b8 11 00 00       	call   3f8b <mkdir>
+    2dd3:	83 c4 10             	add    $0x10,%esp
+    2dd6:	85 c0                	test   %eax,%eax
+    2dd8:	0f 85 cb 00 00 00    	jne    2ea9 <namecache+0x259>
+  if(open("nc/f", O_RDONLY) >= 0){
+    2dde:	83 ec 08             	sub    $0x8,%esp
+    2de1:	6a 00                	push   $0x0
+    2de3:	68 4e 51 00 00       	push   $0x514e
+    2de8:	e8 76 11 00 00       	call   3f63 <open>
+    2ded:	83 c4 10             	add    $0x10,%esp
+    2df0:	85 c0                	test   %eax,%eax
+    2df2:	0f 89 ea 00 00 00    	jns    2ee2 <namecache+0x292>
+  if(unlink("nc") != 0){
+    2df8:	83 ec 0c             	sub    $0xc,%esp
+    2dfb:	68 2f 51 00 00       	push   $0x512f
+    2e00:	e8 6e 11 00 00       	call   3f73 <unlink>
+    2e05:	83 c4 10             	add    $0x10,%esp
+    2e08:	85 c0                	test   %eax,%eax
+    2e0a:	0f 85 bf 00 00 00    	jne    2ecf <namecache+0x27f>
+  printf(1, "name cache ok\n");
+    2e10:	83 ec 08             	sub    $0x8,%esp
+    2e13:	68 c9 51 00 00       	push   $0x51c9
+    2e18:	6a 01                	push   $0x1
+    2e1a:	e8 b1 12 00 00       	call   40d0 <printf>
+}
+    2e1f:	83 c4 10             	add    $0x10,%esp
+    2e22:	c9                   	leave
+    2e23:	c3                   	ret
+    printf(1, "namecache: mkdir nc failed\n");
+    2e24:	50                   	push   %eax
+    2e25:	50                   	push   %eax
+    2e26:	68 32 51 00 00       	push   $0x5132
+    2e2b:	6a 01                	push   $0x1
+    2e2d:	e8 9e 12 00 00       	call   40d0 <printf>
+    exit();
+    2e32:	e8 ec 10 00 00       	call   3f23 <exit>
+    printf(1, "namecache: unlink nc failed\n");
+    2e37:	50                   	push   %eax
+    2e38:	50                   	push   %eax
+    2e39:	68 ac 51 00 00       	push   $0x51ac
+    2e3e:	6a 01                	push   $0x1
+    2e40:	e8 8b 12 00 00       	call   40d0 <printf>
+    exit();
+    2e45:	e8 d9 10 00 00       	call   3f23 <exit>
+    printf(1, "namecache: open of unlinked file worked\n");
+    2e4a:	50                   	push   %eax
+    2e4b:	50                   	push   %eax
+    2e4c:	68 cc 5b 00 00       	push   $0x5bcc
+    2e51:	6a 01                	push   $0x1
+    2e53:	e8 78 12 00 00       	call   40d0 <printf>
+    exit();
+    2e58:	e8 c6 10 00 00       	call   3f23 <exit>
+    printf(1, "namecache: unlink failed\n");
+    2e5d:	50                   	push   %eax
+    2e5e:	50                   	push   %eax
+    2e5f:	68 92 51 00 00       	push   $0x5192
+    2e64:	6a 01                	push   $0x1
+    2e66:	e8 65 12 00 00       	call   40d0 <printf>
+    exit();
+    2e6b:	e8 b3 10 00 00       	call   3f23 <exit>
+    printf(1, "namecache: link nc/g failed\n");
+    2e70:	50                   	push   %eax
+    2e71:	50                   	push   %eax
+    2e72:	68 75 51 00 00       	push   $0x5175
+    2e77:	6a 01                	push   $0x1
+    2e79:	e8 52 12 00 00       	call   40d0 <printf>
+    exit();
+    2e7e:	e8 a0 10 00 00       	call   3f23 <exit>
+    printf(1, "namecache: open nc/f failed\n");
+    2e83:	50                   	push   %eax
+    2e84:	50                   	push   %eax
+    2e85:	68 53 51 00 00       	push   $0x5153
+    2e8a:	6a 01                	push   $0x1
+    2e8c:	e8 3f 12 00 00       	call   40d0 <printf>
+    exit();
+    2e91:	e8 8d 10 00 00       	call   3f23 <exit>
+    printf(1, "namecache: create nc/f after failed open failed\n");
+    2e96:	51                   	push   %ecx
+    2e97:	51                   	push   %ecx
+    2e98:	68 98 5b 00 00       	push   $0x5b98
+    2e9d:	6a 01                	push   $0x1
+    2e9f:	e8 2c 12 00 00       	call   40d0 <printf>
+    exit();
+    2ea4:	e8 7a 10 00 00       	call   3f23 <exit>
+    printf(1, "namecache: mkdir nc again failed\n");
+    2ea9:	51                   	push   %ecx
+    2eaa:	51                   	push   %ecx
+    2eab:	68 1c 5c 00 00       	push   $0x5c1c
+    2eb0:	6a 01                	push   $0x1
+    2eb2:	e8 19 12 00 00       	call   40d0 <printf>
+    exit();
+    2eb7:	e8 67 10 00 00       	call   3f23 <exit>
+    printf(1, "namecache: re-create nc/f failed\n");
+    2ebc:	50                   	push   %eax
+    2ebd:	50                   	push   %eax
+    2ebe:	68 f8 5b 00 00       	push   $0x5bf8
+    2ec3:	6a 01                	push   $0x1
+    2ec5:	e8 06 12 00 00       	call   40d0 <printf>
+    exit();
+    2eca:	e8 54 10 00 00       	call   3f23 <exit>
+    printf(1, "namecache: final unlink nc failed\n");
+    2ecf:	50                   	push   %eax
+    2ed0:	50                   	push   %eax
+    2ed1:	68 64 5c 00 00       	push   $0x5c64
+    2ed6:	6a 01                	push   $0x1
+    2ed8:	e8 f3 11 00 00       	call   40d0 <printf>
+    exit();
+    2edd:	e8 41 10 00 00       	call   3f23 <exit>
+    printf(1, "namecache: new nc has old nc's f\n");
+    2ee2:	52                   	push   %edx
+    2ee3:	52                   	push   %edx
+    2ee4:	68 40 5c 00 00       	push   $0x5c40
+    2ee9:	6a 01                	push   $0x1
+    2eeb:	e8 e0 11 00 00       	call   40d0 <printf>
+    exit();
+    2ef0:	e8 2e 10 00 00       	call   3f23 <exit>
+    2ef5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2efc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002f00 <dirfile>:
+{
+    2f00:	55                   	push   %ebp
+    2f01:	89 e5                	mov    %esp,%ebp
+    2f03:	53                   	push   %ebx
+    2f04:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    2f07:	68 d8 51 00 00       	push   $0x51d8
+    2f0c:	6a 01                	push   $0x1
+    2f0e:	e8 bd 11 00 00       	call   40d0 <printf>
+  fd = open("dirfile", O_CREATE);
+    2f13:	5b                   	pop    %ebx
+    2f14:	58                   	pop    %eax
+    2f15:	68 00 02 00 00       	push   $0x200
+    2f1a:	68 e5 51 00 00       	push   $0x51e5
+    2f1f:	e8 3f 10 00 00       	call   3f63 <open>
+  if(fd < 0){
+    2f24:	83 c4 10             	add    $0x10,%esp
+    2f27:	85 c0                	test   %eax,%eax
+    2f29:	0f 88 43 01 00 00    	js     3072 <dirfile+0x172>
+  close(fd);
+    2f2f:	83 ec 0c             	sub    $0xc,%esp
+    2f32:	50                   	push   %eax
+    2f33:	e8 13 10 00 00       	call   3f4b <close>
+  if(chdir("dirfile") == 0){
+    2f38:	c7 04 24 e5 51 00 00 	movl   $0x51e5,(%esp)
+    2f3f:	e8 4f 10 00 00       	call   3f93 <chdir>
+    2f44:	83 c4 10             	add    $0x10,%esp
+    2f47:	85 c0                	test   %eax,%eax
+    2f49:	0f 84 10 01 00 00    	je     305f <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    2f4f:	83 ec 08             	sub    $0x8,%esp
+    2f52:	6a 00                	push   $0x0
+    2f54:	68 1e 52 00 00       	push   $0x521e
+    2f59:	e8 05 10 00 00       	call   3f63 <open>
+  if(fd >= 0){
+    2f5e:	83 c4 10             	add    $0x10,%esp
+    2f61:	85 c0                	test   %eax,%eax
+    2f63:	0f 89 e3 00 00 00    	jns    304c <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    2f69:	83 ec 08             	sub    $0x8,%esp
+    2f6c:	68 00 02 00 00       	push   $0x200
+    2f71:	68 1e 52 00 00       	push   $0x521e
+    2f76:	e8 e8 0f 00 00       	call   3f63 <open>
+  if(fd >= 0){
+    2f7b:	83 c4 10             	add    $0x10,%esp
+    2f7e:	85 c0                	test   %eax,%eax
+    2f80:	0f 89 c6 00 00 00    	jns    304c <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    2f86:	83 ec 0c             	sub    $0xc,%esp
+    2f89:	68 1e 52 00 00       	push   $0x521e
+    2f8e:	e8 f8 0f 00 00       	call   3f8b <mkdir>
+    2f93:	83 c4 10             	add    $0x10,%esp
+    2f96:	85 c0                	test   %eax,%eax
+    2f98:	0f 84 46 01 00 00    	je     30e4 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    2f9e:	83 ec 0c             	sub    $0xc,%esp
+    2fa1:	68 1e 52 00 00       	push   $0x521e
+    2fa6:	e8 c8 0f 00 00       	call   3f73 <unlink>
+    2fab:	83 c4 10             	add    $0x10,%esp
+    2fae:	85 c0                	test   %eax,%eax
+    2fb0:	0f 84 1b 01 00 00    	je     30d1 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    2fb6:	83 ec 08             	sub    $0x8,%esp
+    2fb9:	68 1e 52 00 00       	push   $0x521e
+    2fbe:	68 82 52 00 00       	push   $0x5282
+    2fc3:	e8 bb 0f 00 00       	call   3f83 <link>
+    2fc8:	83 c4 10             	add    $0x10,%esp
+    2fcb:	85 c0                	test   %eax,%eax
+    2fcd:	0f 84 eb 00 00 00    	je     30be <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    2fd3:	83 ec 0c             	sub    $0xc,%esp
+    2fd6:	68 e5 51 00 00       	push   $0x51e5
+    2fdb:	e8 93 0f 00 00       	call   3f73 <unlink>
+    2fe0:	83 c4 10             	add    $0x10,%esp
+    2fe3:	85 c0                	test   %eax,%eax
+    2fe5:	0f 85 c0 00 00 00    	jne    30ab <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    2feb:	83 ec 08             	sub    $0x8,%esp
+    2fee:	6a 02                	push   $0x2
+    2ff0:	68 12 4d 00 00       	push   $0x4d12
+    2ff5:	e8 69 0f 00 00       	call   3f63 <open>
+  if(fd >= 0){
+    2ffa:	83 c4 10             	add    $0x10,%esp
+    2ffd:	85 c0                	test   %eax,%eax
+    2fff:	0f 89 93 00 00 00    	jns    3098 <dirfile+0x198>
+  fd = open(".", 0);
+    3005:	83 ec 08             	sub    $0x8,%esp
+    3008:	6a 00                	push   $0x0
+    300a:	68 12 4d 00 00       	push   $0x4d12
+    300f:	e8 4f 0f 00 00       	call   3f63 <open>
+  if(write(fd, "x", 1) > 0){
+    3014:	83 c4 0c             	add    $0xc,%esp
+    3017:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    3019:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    301b:	68 6c 55 00 00       	push   $0x556c
+    3020:	50                   	push   %eax
+    3021:	e8 1d 0f 00 00       	call   3f43 <write>
+    3026:	83 c4 10             	add    $0x10,%esp
+    3029:	85 c0                	test   %eax,%eax
+    302b:	7f 58                	jg     3085 <dirfile+0x185>
+  close(fd);
+    302d:	83 ec 0c             	sub    $0xc,%esp
+    3030:	53                   	push   %ebx
+    3031:	e8 15 0f 00 00       	call   3f4b <close>
+  printf(1, "dir vs file OK\n");
+    3036:	58                   	pop    %eax
+    3037:	5a                   	pop    %edx
+    3038:	68 b5 52 00 00       	push   $0x52b5
+    303d:	6a 01                	push   $0x1
+    303f:	e8 8c 10 00 00       	call   40d0 <printf>
+}
+    3044:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3047:	83 c4 10             	add    $0x10,%esp
+    304a:	c9                   	leave
+    304b:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    304c:	50                   	push   %eax
+    304d:	50                   	push   %eax
+    304e:	68 29 52 00 00       	push   $0x5229
+    3053:	6a 01                	push   $0x1
+    3055:	e8 76 10 00 00       	call   40d0 <printf>
+    exit();
+    305a:	e8 c4 0e 00 00       	call   3f23 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    305f:	52                   	push   %edx
+    3060:	52                   	push   %edx
+    3061:	68 04 52 00 00       	push   $0x5204
+    3066:	6a 01                	push   $0x1
+    3068:	e8 63 10 00 00       	call   40d0 <printf>
+    exit();
+    306d:	e8 b1 0e 00 00       	call   3f23 <exit>
+    printf(1, "create dirfile failed\n");
+    3072:	51                   	push   %ecx
+    3073:	51                   	push   %ecx
+    3074:	68 ed 51 00 00       	push   $0x51ed
+    3079:	6a 01                	push   $0x1
+    307b:	e8 50 10 00 00       	call   40d0 <printf>
+    exit();
+    3080:	e8 9e 0e 00 00       	call   3f23 <exit>
+    printf(1, "write . succeeded!\n");
+    3085:	51                   	push   %ecx
+    3086:	51                   	push   %ecx
+    3087:	68 a1 52 00 00       	push   $0x52a1
+    308c:	6a 01                	push   $0x1
+    308e:	e8 3d 10 00 00       	call   40d0 <printf>
+    exit();
+    3093:	e8 8b 0e 00 00       	call   3f23 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    3098:	53                   	push   %ebx
+    3099:	53                   	push   %ebx
+    309a:	68 a8 5c 00 00       	push   $0x5ca8
+    309f:	6a 01                	push   $0x1
+    30a1:	e8 2a 10 00 00       	call   40d0 <printf>
+    exit();
+    30a6:	e8 78 0e 00 00       	call   3f23 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    30ab:	50                   	push   %eax
+    30ac:	50                   	push   %eax
+    30ad:	68 89 52 00 00       	push   $0x5289
+    30b2:	6a 01                	push   $0x1
+    30b4:	e8 17 10 00 00       	call   40d0 <printf>
+    exit();
+    30b9:	e8 65 0e 00 00       	call   3f23 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    30be:	50                   	push   %eax
+    30bf:	50                   	push   %eax
+    30c0:	68 88 5c 00 00       	push   $0x5c88
+    30c5:	6a 01                	push   $0x1
+    30c7:	e8 04 10 00 00       	call   40d0 <printf>
+    exit();
+    30cc:	e8 52 0e 00 00       	call   3f23 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    30d1:	50                   	push   %eax
+    30d2:	50                   	push   %eax
+    30d3:	68 64 52 00 00       	push   $0x5264
+    30d8:	6a 01                	push   $0x1
+    30da:	e8 f1 0f 00 00       	call   40d0 <printf>
+    exit();
+    30df:	e8 3f 0e 00 00       	call   3f23 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    30e4:	50                   	push   %eax
+    30e5:	50                   	push   %eax
+    30e6:	68 47 52 00 00       	push   $0x5247
+    30eb:	6a 01                	push   $0x1
+    30ed:	e8 de 0f 00 00       	call   40d0 <printf>
+    exit();
+    30f2:	e8 2c 0e 00 00       	call   3f23 <exit>
+    30f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    30fe:	66 90                	xchg   %ax,%ax
+
+00003100 <iref>:
+{
+    3100:	55                   	push   %ebp
+    3101:	89 e5                	mov    %esp,%ebp
+    3103:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    3104:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    3109:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    310c:	68 c5 52 00 00       	push   $0x52c5
+    3111:	6a 01                	push   $0x1
+    3113:	e8 b8 0f 00 00       	call   40d0 <printf>
+    3118:	83 c4 10             	add    $0x10,%esp
+    311b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    311f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    3120:	83 ec 0c             	sub    $0xc,%esp
+    3123:	68 d6 52 00 00       	push   $0x52d6
+    3128:	e8 5e 0e 00 00       	call   3f8b <mkdir>
+    312d:	83 c4 10             	add    $0x10,%esp
+    3130:	85 c0                	test   %eax,%eax
+    3132:	0f 85 bb 00 00 00    	jne    31f3 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    3138:	83 ec 0c             	sub    $0xc,%esp
+    313b:	68 d6 52 00 00       	push   $0x52d6
+    3140:	e8 4e 0e 00 00       	call   3f93 <chdir>
+    3145:	83 c4 10             	add    $0x10,%esp
+    3148:	85 c0                	test   %eax,%eax
+    314a:	0f 85 b7 00 00 00    	jne    3207 <iref+0x107>
+    mkdir("");
+    3150:	83 ec 0c             	sub    $0xc,%esp
+    3153:	68 6d 48 00 00       	push   $0x486d
+    3158:	e8 2e 0e 00 00       	call   3f8b <mkdir>
+    link("README", "");
+    315d:	59                   	pop    %ecx
+    315e:	58                   	pop    %eax
+    315f:	68 6d 48 00 00       	push   $0x486d
+    3164:	68 82 52 00 00       	push   $0x5282
+    3169:	e8 15 0e 00 00       	call   3f83 <link>
+    fd = open("", O_CREATE);
+    316e:	58                   	pop    %eax
+    316f:	5a                   	pop    %edx
+    3170:	68 00 02 00 00       	push   $0x200
+    3175:	68 6d 48 00 00       	push   $0x486d
+    317a:	e8 e4 0d 00 00       	call   3f63 <open>
+    if(fd >= 0)
+    317f:	83 c4 10             	add    $0x10,%esp
+    3182:	85 c0                	test   %eax,%eax
+    3184:	78 0c                	js     3192 <iref+0x92>
+      close(fd);
+    3186:	83 ec 0c             	sub    $0xc,%esp
+    3189:	50                   	push   %eax
+    318a:	e8 bc 0d 00 00       	call   3f4b <close>
+    318f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    3192:	83 ec 08             	sub    $0x8,%esp
+    3195:	68 00 02 00 00       	push   $0x200
+    319a:	68 f4 4d 00 00       	push   $0x4df4
+    319f:	e8 bf 0d 00 00       	call   3f63 <open>
+    if(fd >= 0)
+    31a4:	83 c4 10             	add    $0x10,%esp
+    31a7:	85 c0                	test   %eax,%eax
+    31a9:	78 0c                	js     31b7 <iref+0xb7>
+      close(fd);
+    31ab:	83 ec 0c             	sub    $0xc,%esp
+    31ae:	50                   	push   %eax
+    31af:	e8 97 0d 00 00       	call   3f4b <close>
+    31b4:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    31b7:	83 ec 0c             	sub    $0xc,%esp
+    31ba:	68 f4 4d 00 00       	push   $0x4df4
+    31bf:	e8 af 0d 00 00       	call   3f73 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    31c4:	83 c4 10             	add    $0x10,%esp
+    31c7:	83 eb 01             	sub    $0x1,%ebx
+    31ca:	0f 85 50 ff ff ff    	jne    3120 <iref+0x20>
+  chdir("/");
+    31d0:	83 ec 0c             	sub    $0xc,%esp
+    31d3:	68 af 50 00 00       	push   $0x50af
+    31d8:	e8 b6 0d 00 00       	call   3f93 <chdir>
+  printf(1, "empty file name OK\n");
+    31dd:	58                   	pop    %eax
+    31de:	5a                   	pop    %edx
+    31df:	68 04 53 00 00       	push   $0x5304
+    31e4:	6a 01                	push   $0x1
+    31e6:	e8 e5 0e 00 00       	call   40d0 <printf>
+}
+    31eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    31ee:	83 c4 10             	add    $0x10,%esp
+    31f1:	c9                   	leave
+    31f2:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    31f3:	83 ec 08             	sub    $0x8,%esp
+    31f6:	68 dc 52 00 00       	push   $0x52dc
+    31fb:	6a 01                	push   $0x1
+    31fd:	e8 ce 0e 00 00       	call   40d0 <printf>
+      exit();
+    3202:	e8 1c 0d 00 00       	call   3f23 <exit>
+      printf(1, "chdir irefd failed\n");
+    3207:	83 ec 08             	sub    $0x8,%esp
+    320a:	68 f0 52 00 00       	push   $0x52f0
+    320f:	6a 01                	push   $0x1
+    3211:	e8 ba 0e 00 00       	call   40d0 <printf>
+      exit();
+    3216:	e8 08 0d 00 00       	call   3f23 <exit>
+    321b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    321f:	90                   	nop
+
+00003220 <forktest>:
+{
+    3220:	55                   	push   %ebp
+    3221:	89 e5                	mov    %esp,%ebp
+    3223:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    3224:	31 db                	xor    %ebx,%ebx
+{
+    3226:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    3229:	68 18 53 00 00       	push   $0x5318
+    322e:	6a 01                	push   $0x1
+    3230:	e8 9b 0e 00 00       	call   40d0 <printf>
+    3235:	83 c4 10             	add    $0x10,%esp
+    3238:	eb 13                	jmp    324d <forktest+0x2d>
+    323a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    3240:	74 4d                	je     328f <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    3242:	83 c3 01             	add    $0x1,%ebx
+    3245:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    324b:	74 6e                	je     32bb <forktest+0x9b>
+    pid = fork();
+    324d:	e8 c9 0c 00 00       	call   3f1b <fork>
+    if(pid < 0)
+    3252:	85 c0                	test   %eax,%eax
+    3254:	79 ea                	jns    3240 <forktest+0x20>
+  for(; n > 0; n--){
+    3256:	85 db                	test   %ebx,%ebx
+    3258:	74 14                	je     326e <forktest+0x4e>
+    325a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    3260:	e8 c6 0c 00 00       	call   3f2b <wait>
+    3265:	85 c0                	test   %eax,%eax
+    3267:	78 2b                	js     3294 <forktest+0x74>
+  for(; n > 0; n--){
+    3269:	83 eb 01             	sub    $0x1,%ebx
+    326c:	75 f2                	jne    3260 <forktest+0x40>
+  if(wait() != -1){
+    326e:	e8 b8 0c 00 00       	call   3f2b <wait>
+    3273:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3276:	75 30                	jne    32a8 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    3278:	83 ec 08             	sub    $0x8,%esp
+    327b:	68 4a 53 00 00       	push   $0x534a
+    3280:	6a 01                	push   $0x1
+    3282:	e8 49 0e 00 00       	call   40d0 <printf>
+}
+    3287:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    328a:	83 c4 10             	add    $0x10,%esp
+    328d:	c9                   	leave
+    328e:	c3                   	ret
+      exit();
+    328f:	e8 8f 0c 00 00       	call   3f23 <exit>
+      printf(1, "wait stopped early\n");
+    3294:	83 ec 08             	sub    $0x8,%esp
+    3297:	68 23 53 00 00       	push   $0x5323
+    329c:	6a 01                	push   $0x1
+    329e:	e8 2d 0e 00 00       	call   40d0 <printf>
+      exit();
+    32a3:	e8 7b 0c 00 00       	call   3f23 <exit>
+    printf(1, "wait got too many\n");
+    32a8:	50                   	push   %eax
+    32a9:	50                   	push   %eax
+    32aa:	68 37 53 00 00       	push   $0x5337
+    32af:	6a 01                	push   $0x1
+    32b1:	e8 1a 0e 00 00       	call   40d0 <printf>
+    exit();
+    32b6:	e8 68 0c 00 00       	call   3f23 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    32bb:	52                   	push   %edx
+    32bc:	52                   	push   %edx
+    32bd:	68 c8 5c 00 00       	push   $0x5cc8
+    32c2:	6a 01                	push   $0x1
+    32c4:	e8 07 0e 00 00       	call   40d0 <printf>
+    exit();
+    32c9:	e8 55 0c 00 00       	call   3f23 <exit>
+    32ce:	66 90                	xchg   %ax,%ax
+
+000032d0 <sbrktest>:
+{
+    32d0:	55                   	push   %ebp
+    32d1:	89 e5                	mov    %esp,%ebp
+    32d3:	57                   	push   %edi
+    32d4:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){ 
+    32d5:	31 f6                	xor    %esi,%esi
+{
+    32d7:	53                   	push   %ebx
+    32d8:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    32db:	68 fa 53 00 00       	push   $0x53fa
+    32e0:	ff 35 b4 68 00 00    	push   0x68b4
+    32e6:	e8 e5 0d 00 00       	call   40d0 <printf>
+  oldbrk = sbrk(0);
+    32eb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    32f2:	e8 b4 0c 00 00       	call   3fab <sbrk>
+    32f7:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    32fa:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3301:	e8 a5 0c 00 00       	call   3fab <sbrk>
+    3306:	83 c4 10             	add    $0x10,%esp
+    3309:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){ 
+    330b:	eb 05                	jmp    3312 <sbrktest+0x42>
+    330d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    3310:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    3312:	83 ec 0c             	sub    $0xc,%esp
+    3315:	6a 01                	push   $0x1
+    3317:	e8 8f 0c 00 00       	call   3fab <sbrk>
+    if(b != a){
+    331c:	83 c4 10             	add    $0x10,%esp
+    331f:	39 d8                	cmp    %ebx,%eax
+    3321:	0f 85 9c 02 00 00    	jne    35c3 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){ 
+    3327:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    332a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    332d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){ 
+    3330:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    3336:	75 d8                	jne    3310 <sbrktest+0x40>
+  pid = fork();
+    3338:	e8 de 0b 00 00       	call   3f1b <fork>
+    333d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    333f:	85 c0                	test   %eax,%eax
+    3341:	0f 88 02 03 00 00    	js     3649 <sbrktest+0x379>
+  c = sbrk(1);
+    3347:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    334a:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    334d:	6a 01                	push   $0x1
+    334f:	e8 57 0c 00 00       	call   3fab <sbrk>
+  c = sbrk(1);
+    3354:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    335b:	e8 4b 0c 00 00       	call   3fab <sbrk>
+  if(c != a + 1){
+    3360:	83 c4 10             	add    $0x10,%esp
+    3363:	39 c3                	cmp    %eax,%ebx
+    3365:	0f 85 3b 03 00 00    	jne    36a6 <sbrktest+0x3d6>
+  if(pid == 0)
+    336b:	85 f6                	test   %esi,%esi
+    336d:	0f 84 2e 03 00 00    	je     36a1 <sbrktest+0x3d1>
+  wait();
+    3373:	e8 b3 0b 00 00       	call   3f2b <wait>
+  a = sbrk(0);
+    3378:	83 ec 0c             	sub    $0xc,%esp
+    337b:	6a 00                	push   $0x0
+    337d:	e8 29 0c 00 00       	call   3fab <sbrk>
+    3382:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    3384:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3389:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    338b:	89 04 24             	mov    %eax,(%esp)
+    338e:	e8 18 0c 00 00       	call   3fab <sbrk>
+  if (p != a) { 
+    3393:	83 c4 10             	add    $0x10,%esp
+    3396:	39 c3                	cmp    %eax,%ebx
+    3398:	0f 85 94 02 00 00    	jne    3632 <sbrktest+0x362>
+  a = sbrk(0);
+    339e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    33a1:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    33a8:	6a 00                	push   $0x0
+    33aa:	e8 fc 0b 00 00       	call   3fab <sbrk>
+  c = sbrk(-4096);
+    33af:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    33b6:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    33b8:	e8 ee 0b 00 00       	call   3fab <sbrk>
+  if(c == (char*)0xffffffff){
+    33bd:	83 c4 10             	add    $0x10,%esp
+    33c0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    33c3:	0f 84 22 03 00 00    	je     36eb <sbrktest+0x41b>
+  c = sbrk(0);
+    33c9:	83 ec 0c             	sub    $0xc,%esp
+    33cc:	6a 00                	push   $0x0
+    33ce:	e8 d8 0b 00 00       	call   3fab <sbrk>
+  if(c != a - 4096){
+    33d3:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    33d9:	83 c4 10             	add    $0x10,%esp
+    33dc:	39 d0                	cmp    %edx,%eax
+    33de:	0f 85 f0 02 00 00    	jne    36d4 <sbrktest+0x404>
+  a = sbrk(0);
+    33e4:	83 ec 0c             	sub    $0xc,%esp
+    33e7:	6a 00                	push   $0x0
+    33e9:	e8 bd 0b 00 00       	call   3fab <sbrk>
+  c = sbrk(4096);
+    33ee:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    33f5:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    33f7:	e8 af 0b 00 00       	call   3fab <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    33fc:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    33ff:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    3401:	39 c3                	cmp    %eax,%ebx
+    3403:	0f 85 b4 02 00 00    	jne    36bd <sbrktest+0x3ed>
+    3409:	83 ec 0c             	sub    $0xc,%esp
+    340c:	6a 00                	push   $0x0
+    340e:	e8 98 0b 00 00       	call   3fab <sbrk>
+    3413:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    3419:	83 c4 10             	add    $0x10,%esp
+    341c:	39 c2                	cmp    %eax,%edx
+    341e:	0f 85 99 02 00 00    	jne    36bd <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    3424:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    342b:	0f 84 2f 02 00 00    	je     3660 <sbrktest+0x390>
+  a = sbrk(0);
+    3431:	83 ec 0c             	sub    $0xc,%esp
+    3434:	6a 00                	push   $0x0
+    3436:	e8 70 0b 00 00       	call   3fab <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    343b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    3442:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3444:	e8 62 0b 00 00       	call   3fab <sbrk>
+    3449:	89 c2                	mov    %eax,%edx
+    344b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    344e:	29 d0                	sub    %edx,%eax
+    3450:	89 04 24             	mov    %eax,(%esp)
+    3453:	e8 53 0b 00 00       	call   3fab <sbrk>
+  if(c != a){
+    3458:	83 c4 10             	add    $0x10,%esp
+    345b:	39 c3                	cmp    %eax,%ebx
+    345d:	0f 85 b8 01 00 00    	jne    361b <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3463:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    3468:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    346f:	90                   	nop
+    ppid = getpid();
+    3470:	e8 2e 0b 00 00       	call   3fa3 <getpid>
+    3475:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    3477:	e8 9f 0a 00 00       	call   3f1b <fork>
+    if(pid < 0){
+    347c:	85 c0                	test   %eax,%eax
+    347e:	0f 88 5d 01 00 00    	js     35e1 <sbrktest+0x311>
+    if(pid == 0){
+    3484:	0f 84 6f 01 00 00    	je     35f9 <sbrktest+0x329>
+    wait();
+    348a:	e8 9c 0a 00 00       	call   3f2b <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    348f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    3495:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    349b:	75 d3                	jne    3470 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    349d:	83 ec 0c             	sub    $0xc,%esp
+    34a0:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    34a3:	50                   	push   %eax
+    34a4:	e8 8a 0a 00 00       	call   3f33 <pipe>
+    34a9:	83 c4 10             	add    $0x10,%esp
+    34ac:	85 c0                	test   %eax,%eax
+    34ae:	0f 85 da 01 00 00    	jne    368e <sbrktest+0x3be>
+    34b4:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    34b7:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    34ba:	89 df                	mov    %ebx,%edi
+    34bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    34c0:	e8 56 0a 00 00       	call   3f1b <fork>
+    34c5:	89 07                	mov    %eax,(%edi)
+    34c7:	85 c0                	test   %eax,%eax
+    34c9:	0f 84 91 00 00 00    	je     3560 <sbrktest+0x290>
+    if(pids[i] != -1)
+    34cf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    34d2:	74 14                	je     34e8 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    34d4:	83 ec 04             	sub    $0x4,%esp
+    34d7:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    34da:	6a 01                	push   $0x1
+    34dc:	50                   	push   %eax
+    34dd:	ff 75 b8             	push   -0x48(%ebp)
+    34e0:	e8 56 0a 00 00       	call   3f3b <read>
+    34e5:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    34e8:	83 c7 04             	add    $0x4,%edi
+    34eb:	39 f7                	cmp    %esi,%edi
+    34ed:	75 d1                	jne    34c0 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    34ef:	83 ec 0c             	sub    $0xc,%esp
+    34f2:	68 00 10 00 00       	push   $0x1000
+    34f7:	e8 af 0a 00 00       	call   3fab <sbrk>
+    34fc:	83 c4 10             	add    $0x10,%esp
+    34ff:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3501:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    3508:	8b 03                	mov    (%ebx),%eax
+    350a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    350d:	74 11                	je     3520 <sbrktest+0x250>
+    kill(pids[i]);
+    350f:	83 ec 0c             	sub    $0xc,%esp
+    3512:	50                   	push   %eax
+    3513:	e8 3b 0a 00 00       	call   3f53 <kill>
+    wait();
+    3518:	e8 0e 0a 00 00       	call   3f2b <wait>
+    351d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3520:	83 c3 04             	add    $0x4,%ebx
+    3523:	39 f3                	cmp    %esi,%ebx
+    3525:	75 e1                	jne    3508 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    3527:	83 ff ff             	cmp    $0xffffffff,%edi
+    352a:	0f 84 47 01 00 00    	je     3677 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    3530:	83 ec 0c             	sub    $0xc,%esp
+    3533:	6a 00                	push   $0x0
+    3535:	e8 71 0a 00 00       	call   3fab <sbrk>
+    353a:	83 c4 10             	add    $0x10,%esp
+    353d:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    3540:	72 60                	jb     35a2 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    3542:	83 ec 08             	sub    $0x8,%esp
+    3545:	68 51 54 00 00       	push   $0x5451
+    354a:	ff 35 b4 68 00 00    	push   0x68b4
+    3550:	e8 7b 0b 00 00       	call   40d0 <printf>
+}
+    3555:	83 c4 10             	add    $0x10,%esp
+    3558:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    355b:	5b                   	pop    %ebx
+    355c:	5e                   	pop    %esi
+    355d:	5f                   	pop    %edi
+    355e:	5d                   	pop    %ebp
+    355f:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    3560:	83 ec 0c             	sub    $0xc,%esp
+    3563:	6a 00                	push   $0x0
+    3565:	e8 41 0a 00 00       	call   3fab <sbrk>
+    356a:	89 c2                	mov    %eax,%edx
+    356c:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3571:	29 d0                	sub    %edx,%eax
+    3573:	89 04 24             	mov    %eax,(%esp)
+    3576:	e8 30 0a 00 00       	call   3fab <sbrk>
+      write(fds[1], "x", 1);
+    357b:	83 c4 0c             	add    $0xc,%esp
+    357e:	6a 01                	push   $0x1
+    3580:	68 6c 55 00 00       	push   $0x556c
+    3585:	ff 75 bc             	push   -0x44(%ebp)
+    3588:	e8 b6 09 00 00       	call   3f43 <write>
+    358d:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    3590:	83 ec 0c             	sub    $0xc,%esp
+    3593:	68 e8 03 00 00       	push   $0x3e8
+    3598:	e8 16 0a 00 00       	call   3fb3 <sleep>
+    359d:	83 c4 10             	add    $0x10,%esp
+    35a0:	eb ee                	jmp    3590 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    35a2:	83 ec 0c             	sub    $0xc,%esp
+    35a5:	6a 00                	push   $0x0
+    35a7:	e8 ff 09 00 00       	call   3fab <sbrk>
+    35ac:	89 c2                	mov    %eax,%edx
+    35ae:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    35b1:	29 d0                	sub    %edx,%eax
+    35b3:	89 04 24             	mov    %eax,(%esp)
+    35b6:	e8 f0 09 00 00       	call   3fab <sbrk>
+    35bb:	83 c4 10             	add    $0x10,%esp
+    35be:	e9 7f ff ff ff       	jmp    3542 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    35c3:	83 ec 0c             	sub    $0xc,%esp
+    35c6:	50                   	push   %eax
+    35c7:	53                   	push   %ebx
+    35c8:	56                   	push   %esi
+    35c9:	68 58 53 00 00       	push   $0x5358
+    35ce:	ff 35 b4 68 00 00    	push   0x68b4
+    35d4:	e8 f7 0a 00 00       	call   40d0 <printf>
+      exit();
+    35d9:	83 c4 20             	add    $0x20,%esp
+    35dc:	e8 42 09 00 00       	call   3f23 <exit>
+      printf(stdout, "fork failed\n");
+    35e1:	83 ec 08             	sub    $0x8,%esp
+    35e4:	68 97 48 00 00       	push   $0x4897
+    35e9:	ff 35 b4 68 00 00    	push   0x68b4
+    35ef:	e8 dc 0a 00 00       	call   40d0 <printf>
+      exit();
+    35f4:	e8 2a 09 00 00       	call   3f23 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    35f9:	0f be 03             	movsbl (%ebx),%eax
+    35fc:	50                   	push   %eax
+    35fd:	53                   	push   %ebx
+    35fe:	68 c1 53 00 00       	push   $0x53c1
+    3603:	ff 35 b4 68 00 00    	push   0x68b4
+    3609:	e8 c2 0a 00 00       	call   40d0 <printf>
+      kill(ppid);
+    360e:	89 34 24             	mov    %esi,(%esp)
+    3611:	e8 3d 09 00 00       	call   3f53 <kill>
+      exit();
+    3616:	e8 08 09 00 00       	call   3f23 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    361b:	50                   	push   %eax
+    361c:	53                   	push   %ebx
+    361d:	68 bc 5d 00 00       	push   $0x5dbc
+    3622:	ff 35 b4 68 00 00    	push   0x68b4
+    3628:	e8 a3 0a 00 00       	call   40d0 <printf>
+    exit();
+    362d:	e8 f1 08 00 00       	call   3f23 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3632:	56                   	push   %esi
+    3633:	56                   	push   %esi
+    3634:	68 ec 5c 00 00       	push   $0x5cec
+    3639:	ff 35 b4 68 00 00    	push   0x68b4
+    363f:	e8 8c 0a 00 00       	call   40d0 <printf>
+    exit();
+    3644:	e8 da 08 00 00       	call   3f23 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    3649:	50                   	push   %eax
+    364a:	50                   	push   %eax
+    364b:	68 73 53 00 00       	push   $0x5373
+    3650:	ff 35 b4 68 00 00    	push   0x68b4
+    3656:	e8 75 0a 00 00       	call   40d0 <printf>
+    exit();
+    365b:	e8 c3 08 00 00       	call   3f23 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3660:	51                   	push   %ecx
+    3661:	51                   	push   %ecx
+    3662:	68 8c 5d 00 00       	push   $0x5d8c
+    3667:	ff 35 b4 68 00 00    	push   0x68b4
+    366d:	e8 5e 0a 00 00       	call   40d0 <printf>
+    exit();
+    3672:	e8 ac 08 00 00       	call   3f23 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    3677:	50                   	push   %eax
+    3678:	50                   	push   %eax
+    3679:	68 da 53 00 00       	push   $0x53da
+    367e:	ff 35 b4 68 00 00    	push   0x68b4
+    3684:	e8 47 0a 00 00       	call   40d0 <printf>
+    exit();
+    3689:	e8 95 08 00 00       	call   3f23 <exit>
+    printf(1, "pipe() failed\n");
+    368e:	52                   	push   %edx
+    368f:	52                   	push   %edx
+    3690:	68 83 47 00 00       	push   $0x4783
+    3695:	6a 01                	push   $0x1
+    3697:	e8 34 0a 00 00       	call   40d0 <printf>
+    exit();
+    369c:	e8 82 08 00 00       	call   3f23 <exit>
+    exit();
+    36a1:	e8 7d 08 00 00       	call   3f23 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    36a6:	57                   	push   %edi
+    36a7:	57                   	push   %edi
+    36a8:	68 8a 53 00 00       	push   $0x538a
+    36ad:	ff 35 b4 68 00 00    	push   0x68b4
+    36b3:	e8 18 0a 00 00       	call   40d0 <printf>
+    exit();
+    36b8:	e8 66 08 00 00       	call   3f23 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    36bd:	56                   	push   %esi
+    36be:	53                   	push   %ebx
+    36bf:	68 64 5d 00 00       	push   $0x5d64
+    36c4:	ff 35 b4 68 00 00    	push   0x68b4
+    36ca:	e8 01 0a 00 00       	call   40d0 <printf>
+    exit();
+    36cf:	e8 4f 08 00 00       	call   3f23 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    36d4:	50                   	push   %eax
+    36d5:	53                   	push   %ebx
+    36d6:	68 2c 5d 00 00       	push   $0x5d2c
+    36db:	ff 35 b4 68 00 00    	push   0x68b4
+    36e1:	e8 ea 09 00 00       	call   40d0 <printf>
+    exit();
+    36e6:	e8 38 08 00 00       	call   3f23 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    36eb:	53                   	push   %ebx
+    36ec:	53                   	push   %ebx
+    36ed:	68 a6 53 00 00       	push   $0x53a6
+    36f2:	ff 35 b4 68 00 00    	push   0x68b4
+    36f8:	e8 d3 09 00 00       	call   40d0 <printf>
+    exit();
+    36fd:	e8 21 08 00 00       	call   3f23 <exit>
+    3702:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3709:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003710 <lazytest>:
+{
+    3710:	55                   	push   %ebp
+    3711:	89 e5                	mov    %esp,%ebp
+    3713:	57                   	push   %edi
+    3714:	56                   	push   %esi
+    3715:	53                   	push   %ebx
+    3716:	83 ec 24             	sub    $0x24,%esp
+  printf(stdout, "lazy sbrk test\n");
+    3719:	68 f5 53 00 00       	push   $0x53f5
+    371e:	ff 35 b4 68 00 00    	push   0x68b4
+    3724:	e8 a7 09 00 00       	call   40d0 <printf>
+  oldbrk = sbrk(0);
+    3729:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3730:	e8 76 08 00 00       	call   3fab <sbrk>
+  a = sbrk(8*1024*1024);
+    3735:	c7 04 24 00 00 80 00 	movl   $0x800000,(%esp)
+  oldbrk = sbrk(0);
+    373c:	89 c6                	mov    %eax,%esi
+  a = sbrk(8*1024*1024);
+    373e:	e8 68 08 00 00       	call   3fab <sbrk>
+  if(a == (char*)0xffffffff){
+    3743:	83 c4 10             	add    $0x10,%esp
+    3746:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3749:	0f 84 02 01 00 00    	je     3851 <lazytest+0x141>
+  if(pipe(fds) != 0){
+    374f:	83 ec 0c             	sub    $0xc,%esp
+    3752:	89 c3                	mov    %eax,%ebx
+  p = a + 4*1024*1024 + 4090;
+    3754:	8d b8 fa 0f 40 00    	lea    0x400ffa(%eax),%edi
+  if(pipe(fds) != 0){
+    375a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    375d:	50                   	push   %eax
+    375e:	e8 d0 07 00 00       	call   3f33 <pipe>
+    3763:	83 c4 10             	add    $0x10,%esp
+    3766:	85 c0                	test   %eax,%eax
+    3768:	0f 85 cc 00 00 00    	jne    383a <lazytest+0x12a>
+  write(fds[1], "lazy", 5);
+    376e:	83 ec 04             	sub    $0x4,%esp
+    3771:	6a 05                	push   $0x5
+    3773:	68 17 54 00 00       	push   $0x5417
+    3778:	ff 75 e4             	push   -0x1c(%ebp)
+    377b:	e8 c3 07 00 00       	call   3f43 <write>
+  if(read(fds[0], p, 5) != 5 || strcmp(p, "lazy") != 0){
+    3780:	83 c4 0c             	add    $0xc,%esp
+    3783:	6a 05                	push   $0x5
+    3785:	57                   	push   %edi
+    3786:	ff 75 e0             	push   -0x20(%ebp)
+    3789:	e8 ad 07 00 00       	call   3f3b <read>
+    378e:	83 c4 10             	add    $0x10,%esp
+    3791:	83 f8 05             	cmp    $0x5,%eax
+    3794:	0f 85 89 00 00 00    	jne    3823 <lazytest+0x113>
+    379a:	83 ec 08             	sub    $0x8,%esp
+    379d:	68 17 54 00 00       	push   $0x5417
+    37a2:	57                   	push   %edi
+    37a3:	e8 68 05 00 00       	call   3d10 <strcmp>
+    37a8:	83 c4 10             	add    $0x10,%esp
+    37ab:	85 c0                	test   %eax,%eax
+    37ad:	75 74                	jne    3823 <lazytest+0x113>
+  close(fds[0]);
+    37af:	83 ec 0c             	sub    $0xc,%esp
+    37b2:	ff 75 e0             	push   -0x20(%ebp)
+    37b5:	e8 91 07 00 00       	call   3f4b <close>
+  close(fds[1]);
+    37ba:	58                   	pop    %eax
+    37bb:	ff 75 e4             	push   -0x1c(%ebp)
+    37be:	e8 88 07 00 00       	call   3f4b <close>
+  if(a[8*1024*1024 - 1] != 0){
+    37c3:	83 c4 10             	add    $0x10,%esp
+    37c6:	80 bb ff ff 7f 00 00 	cmpb   $0x0,0x7fffff(%ebx)
+    37cd:	0f 85 d2 00 00 00    	jne    38a5 <lazytest+0x195>
+  sbrk(-(sbrk(0) - oldbrk));
+    37d3:	83 ec 0c             	sub    $0xc,%esp
+    37d6:	6a 00                	push   $0x0
+    37d8:	e8 ce 07 00 00       	call   3fab <sbrk>
+    37dd:	29 c6                	sub    %eax,%esi
+    37df:	89 34 24             	mov    %esi,(%esp)
+    37e2:	e8 c4 07 00 00       	call   3fab <sbrk>
+  ppid = getpid();
+    37e7:	e8 b7 07 00 00       	call   3fa3 <getpid>
+    37ec:	89 c6                	mov    %eax,%esi
+  pid = fork();
+    37ee:	e8 28 07 00 00       	call   3f1b <fork>
+  if(pid < 0){
+    37f3:	83 c4 10             	add    $0x10,%esp
+    37f6:	85 c0                	test   %eax,%eax
+    37f8:	0f 88 90 00 00 00    	js     388e <lazytest+0x17e>
+  if(pid == 0){
+    37fe:	74 68                	je     3868 <lazytest+0x158>
+  wait();
+    3800:	e8 26 07 00 00       	call   3f2b <wait>
+  printf(stdout, "lazy sbrk test OK\n");
+    3805:	83 ec 08             	sub    $0x8,%esp
+    3808:	68 4c 54 00 00       	push   $0x544c
+    380d:	ff 35 b4 68 00 00    	push   0x68b4
+    3813:	e8 b8 08 00 00       	call   40d0 <printf>
+}
+    3818:	83 c4 10             	add    $0x10,%esp
+    381b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    381e:	5b                   	pop    %ebx
+    381f:	5e                   	pop    %esi
+    3820:	5f                   	pop    %edi
+    3821:	5d                   	pop    %ebp
+    3822:	c3                   	ret
+    printf(stdout, "read into lazy page failed\n");
+    3823:	50                   	push   %eax
+    3824:	50                   	push   %eax
+    3825:	68 1c 54 00 00       	push   $0x541c
+    382a:	ff 35 b4 68 00 00    	push   0x68b4
+    3830:	e8 9b 08 00 00       	call   40d0 <printf>
+    exit();
+    3835:	e8 e9 06 00 00       	call   3f23 <exit>
+    printf(stdout, "pipe() failed\n");
+    383a:	50                   	push   %eax
+    383b:	50                   	push   %eax
+    383c:	68 83 47 00 00       	push   $0x4783
+    3841:	ff 35 b4 68 00 00    	push   0x68b4
+    3847:	e8 84 08 00 00       	call   40d0 <printf>
+    exit();
+    384c:	e8 d2 06 00 00       	call   3f23 <exit>
+    printf(stdout, "lazy sbrk failed\n");
+    3851:	50                   	push   %eax
+    3852:	50                   	push   %eax
+    3853:	68 05 54 00 00       	push   $0x5405
+    3858:	ff 35 b4 68 00 00    	push   0x68b4
+    385e:	e8 6d 08 00 00       	call   40d0 <printf>
+    exit();
+    3863:	e8 bb 06 00 00       	call   3f23 <exit>
+    p[0] = 1;
+    3868:	c6 83 fa 0f 40 00 01 	movb   $0x1,0x400ffa(%ebx)
+    printf(stdout, "oops could write freed heap at %x\n", p);
+    386f:	50                   	push   %eax
+    3870:	57                   	push   %edi
+    3871:	68 e0 5d 00 00       	push   $0x5de0
+    3876:	ff 35 b4 68 00 00    	push   0x68b4
+    387c:	e8 4f 08 00 00       	call   40d0 <printf>
+    kill(ppid);
+    3881:	89 34 24             	mov    %esi,(%esp)
+    3884:	e8 ca 06 00 00       	call   3f53 <kill>
+    exit();
+    3889:	e8 95 06 00 00       	call   3f23 <exit>
+    printf(stdout, "fork failed\n");
+    388e:	52                   	push   %edx
+    388f:	52                   	push   %edx
+    3890:	68 97 48 00 00       	push   $0x4897
+    3895:	ff 35 b4 68 00 00    	push   0x68b4
+    389b:	e8 30 08 00 00       	call   40d0 <printf>
+    exit();
+    38a0:	e8 7e 06 00 00       	call   3f23 <exit>
+    printf(stdout, "lazy page not zero\n");
+    38a5:	51                   	push   %ecx
+    38a6:	51                   	push   %ecx
+    38a7:	68 38 54 00 00       	push   $0x5438
+    38ac:	ff 35 b4 68 00 00    	push   0x68b4
+    38b2:	e8 19 08 00 00       	call   40d0 <printf>
+    exit();
+    38b7:	e8 67 06 00 00       	call   3f23 <exit>
+    38bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000038c0 <validateint>:
+}
+    38c0:	c3                   	ret
+    38c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    38c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    38cf:	90                   	nop
+
+000038d0 <validatetest>:
+{
+    38d0:	55                   	push   %ebp
+    38d1:	89 e5                	mov    %esp,%ebp
+    38d3:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    38d4:	31 f6                	xor    %esi,%esi
+{
+    38d6:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    38d7:	83 ec 08             	sub    $0x8,%esp
+    38da:	68 5f 54 00 00       	push   $0x545f
+    38df:	ff 35 b4 68 00 00    	push   0x68b4
+    38e5:	e8 e6 07 00 00       	call   40d0 <printf>
+    38ea:	83 c4 10             	add    $0x10,%esp
+    38ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    38f0:	e8 26 06 00 00       	call   3f1b <fork>
+    38f5:	89 c3                	mov    %eax,%ebx
+    38f7:	85 c0                	test   %eax,%eax
+    38f9:	74 63                	je     395e <validatetest+0x8e>
+    sleep(0);
+    38fb:	83 ec 0c             	sub    $0xc,%esp
+    38fe:	6a 00                	push   $0x0
+    3900:	e8 ae 06 00 00       	call   3fb3 <sleep>
+    sleep(0);
+    3905:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    390c:	e8 a2 06 00 00       	call   3fb3 <sleep>
+    kill(pid);
+    3911:	89 1c 24             	mov    %ebx,(%esp)
+    3914:	e8 3a 06 00 00       	call   3f53 <kill>
+    wait();
+    3919:	e8 0d 06 00 00       	call   3f2b <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    391e:	58                   	pop    %eax
+    391f:	5a                   	pop    %edx
+    3920:	56                   	push   %esi
+    3921:	68 6e 54 00 00       	push   $0x546e
+    3926:	e8 58 06 00 00       	call   3f83 <link>
+    392b:	83 c4 10             	add    $0x10,%esp
+    392e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3931:	75 30                	jne    3963 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3933:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    3939:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    393f:	75 af                	jne    38f0 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    3941:	83 ec 08             	sub    $0x8,%esp
+    3944:	68 92 54 00 00       	push   $0x5492
+    3949:	ff 35 b4 68 00 00    	push   0x68b4
+    394f:	e8 7c 07 00 00       	call   40d0 <printf>
+}
+    3954:	83 c4 10             	add    $0x10,%esp
+    3957:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    395a:	5b                   	pop    %ebx
+    395b:	5e                   	pop    %esi
+    395c:	5d                   	pop    %ebp
+    395d:	c3                   	ret
+      exit();
+    395e:	e8 c0 05 00 00       	call   3f23 <exit>
+      printf(stdout, "link should not succeed\n");
+    3963:	83 ec 08             	sub    $0x8,%esp
+    3966:	68 79 54 00 00       	push   $0x5479
+    396b:	ff 35 b4 68 00 00    	push   0x68b4
+    3971:	e8 5a 07 00 00       	call   40d0 <printf>
+      exit();
+    3976:	e8 a8 05 00 00       	call   3f23 <exit>
+    397b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    397f:	90                   	nop
+
+00003980 <bsstest>:
+{
+    3980:	55                   	push   %ebp
+    3981:	89 e5                	mov    %esp,%ebp
+    3983:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    3986:	68 9f 54 00 00       	push   $0x549f
+    398b:	ff 35 b4 68 00 00    	push   0x68b4
+    3991:	e8 3a 07 00 00       	call   40d0 <printf>
+    3996:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3999:	31 c0                	xor    %eax,%eax
+    399b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    399f:	90                   	nop
+    if(uninit[i] != '\0'){
+    39a0:	80 b8 e0 68 00 00 00 	cmpb   $0x0,0x68e0(%eax)
+    39a7:	75 22                	jne    39cb <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    39a9:	83 c0 01             	add    $0x1,%eax
+    39ac:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    39b1:	75 ed                	jne    39a0 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    39b3:	83 ec 08             	sub    $0x8,%esp
+    39b6:	68 ba 54 00 00       	push   $0x54ba
+    39bb:	ff 35 b4 68 00 00    	push   0x68b4
+    39c1:	e8 0a 07 00 00       	call   40d0 <printf>
+}
+    39c6:	83 c4 10             	add    $0x10,%esp
+    39c9:	c9                   	leave
+    39ca:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    39cb:	83 ec 08             	sub    $0x8,%esp
+    39ce:	68 a9 54 00 00       	push   $0x54a9
+    39d3:	ff 35 b4 68 00 00    	push   0x68b4
+    39d9:	e8 f2 06 00 00       	call   40d0 <printf>
+      exit();
+    39de:	e8 40 05 00 00       	call   3f23 <exit>
+    39e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    39ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000039f0 <bigargtest>:
+{
+    39f0:	55                   	push   %ebp
+    39f1:	89 e5                	mov    %esp,%ebp
+    39f3:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    39f6:	68 c7 54 00 00       	push   $0x54c7
+    39fb:	e8 73 05 00 00       	call   3f73 <unlink>
+  pid = fork();
+    3a00:	e8 16 05 00 00       	call   3f1b <fork>
+  if(pid == 0){
+    3a05:	83 c4 10             	add    $0x10,%esp
+    3a08:	85 c0                	test   %eax,%eax
+    3a0a:	74 44                	je     3a50 <bigargtest+0x60>
+  } else if(pid < 0){
+    3a0c:	0f 88 c3 00 00 00    	js     3ad5 <bigargtest+0xe5>
+  wait();
+    3a12:	e8 14 05 00 00       	call   3f2b <wait>
+  fd = open("bigarg-ok", 0);
+    3a17:	83 ec 08             	sub    $0x8,%esp
+    3a1a:	6a 00                	push   $0x0
+    3a1c:	68 c7 54 00 00       	push   $0x54c7
+    3a21:	e8 3d 05 00 00       	call   3f63 <open>
+  if(fd < 0){
+    3a26:	83 c4 10             	add    $0x10,%esp
+    3a29:	85 c0                	test   %eax,%eax
+    3a2b:	0f 88 8d 00 00 00    	js     3abe <bigargtest+0xce>
+  close(fd);
+    3a31:	83 ec 0c             	sub    $0xc,%esp
+    3a34:	50                   	push   %eax
+    3a35:	e8 11 05 00 00       	call   3f4b <close>
+  unlink("bigarg-ok");
+    3a3a:	c7 04 24 c7 54 00 00 	movl   $0x54c7,(%esp)
+    3a41:	e8 2d 05 00 00       	call   3f73 <unlink>
+}
+    3a46:	83 c4 10             	add    $0x10,%esp
+    3a49:	c9                   	leave
+    3a4a:	c3                   	ret
+    3a4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3a4f:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    3a50:	c7 04 85 00 b0 00 00 	movl   $0x5e04,0xb000(,%eax,4)
+    3a57:	04 5e 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    3a5b:	83 c0 01             	add    $0x1,%eax
+    3a5e:	83 f8 1f             	cmp    $0x1f,%eax
+    3a61:	75 ed                	jne    3a50 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    3a63:	31 c9                	xor    %ecx,%ecx
+    3a65:	89 0d 7c b0 00 00    	mov    %ecx,0xb07c
+    printf(stdout, "bigarg test\n");
+    3a6b:	50                   	push   %eax
+    3a6c:	50                   	push   %eax
+    3a6d:	68 d1 54 00 00       	push   $0x54d1
+    3a72:	ff 35 b4 68 00 00    	push   0x68b4
+    3a78:	e8 53 06 00 00       	call   40d0 <printf>
+    exec("echo", args);
+    3a7d:	58                   	pop    %eax
+    3a7e:	5a                   	pop    %edx
+    3a7f:	68 00 b0 00 00       	push   $0xb000
+    3a84:	68 03 44 00 00       	push   $0x4403
+    3a89:	e8 cd 04 00 00       	call   3f5b <exec>
+    printf(stdout, "bigarg test ok\n");
+    3a8e:	59                   	pop    %ecx
+    3a8f:	58                   	pop    %eax
+    3a90:	68 de 54 00 00       	push   $0x54de
+    3a95:	ff 35 b4 68 00 00    	push   0x68b4
+    3a9b:	e8 30 06 00 00       	call   40d0 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3aa0:	58                   	pop    %eax
+    3aa1:	5a                   	pop    %edx
+    3aa2:	68 00 02 00 00       	push   $0x200
+    3aa7:	68 c7 54 00 00       	push   $0x54c7
+    3aac:	e8 b2 04 00 00       	call   3f63 <open>
+    close(fd);
+    3ab1:	89 04 24             	mov    %eax,(%esp)
+    3ab4:	e8 92 04 00 00       	call   3f4b <close>
+    exit();
+    3ab9:	e8 65 04 00 00       	call   3f23 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    3abe:	50                   	push   %eax
+    3abf:	50                   	push   %eax
+    3ac0:	68 07 55 00 00       	push   $0x5507
+    3ac5:	ff 35 b4 68 00 00    	push   0x68b4
+    3acb:	e8 00 06 00 00       	call   40d0 <printf>
+    exit();
+    3ad0:	e8 4e 04 00 00       	call   3f23 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    3ad5:	52                   	push   %edx
+    3ad6:	52                   	push   %edx
+    3ad7:	68 ee 54 00 00       	push   $0x54ee
+    3adc:	ff 35 b4 68 00 00    	push   0x68b4
+    3ae2:	e8 e9 05 00 00       	call   40d0 <printf>
+    exit();
+    3ae7:	e8 37 04 00 00       	call   3f23 <exit>
+    3aec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003af0 <fsfull>:
+{
+    3af0:	55                   	push   %ebp
+    3af1:	89 e5                	mov    %esp,%ebp
+    3af3:	57                   	push   %edi
+    3af4:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    3af5:	31 f6                	xor    %esi,%esi
+{
+    3af7:	53                   	push   %ebx
+    3af8:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    3afb:	68 1c 55 00 00       	push   $0x551c
+    3b00:	6a 01                	push   $0x1
+    3b02:	e8 c9 05 00 00       	call   40d0 <printf>
+    3b07:	83 c4 10             	add    $0x10,%esp
+    3b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    3b10:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3b15:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    3b1a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    3b1d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3b21:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    3b23:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3b27:	c1 ea 06             	shr    $0x6,%edx
+    3b2a:	8d 42 30             	lea    0x30(%edx),%eax
+    3b2d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3b30:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    3b36:	89 f2                	mov    %esi,%edx
+    3b38:	29 c2                	sub    %eax,%edx
+    3b3a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    3b3f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    3b41:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3b46:	c1 ea 05             	shr    $0x5,%edx
+    3b49:	83 c2 30             	add    $0x30,%edx
+    3b4c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3b4f:	f7 e6                	mul    %esi
+    3b51:	c1 ea 05             	shr    $0x5,%edx
+    3b54:	6b c2 64             	imul   $0x64,%edx,%eax
+    3b57:	89 f2                	mov    %esi,%edx
+    3b59:	29 c2                	sub    %eax,%edx
+    3b5b:	89 d0                	mov    %edx,%eax
+    3b5d:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    3b5f:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3b61:	c1 ea 03             	shr    $0x3,%edx
+    3b64:	83 c2 30             	add    $0x30,%edx
+    3b67:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3b6a:	f7 e1                	mul    %ecx
+    3b6c:	89 f0                	mov    %esi,%eax
+    3b6e:	c1 ea 03             	shr    $0x3,%edx
+    3b71:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3b74:	01 d2                	add    %edx,%edx
+    3b76:	29 d0                	sub    %edx,%eax
+    3b78:	83 c0 30             	add    $0x30,%eax
+    3b7b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    3b7e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3b81:	50                   	push   %eax
+    3b82:	68 29 55 00 00       	push   $0x5529
+    3b87:	6a 01                	push   $0x1
+    3b89:	e8 42 05 00 00       	call   40d0 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    3b8e:	58                   	pop    %eax
+    3b8f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3b92:	5a                   	pop    %edx
+    3b93:	68 02 02 00 00       	push   $0x202
+    3b98:	50                   	push   %eax
+    3b99:	e8 c5 03 00 00       	call   3f63 <open>
+    if(fd < 0){
+    3b9e:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    3ba1:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    3ba3:	85 c0                	test   %eax,%eax
+    3ba5:	78 4f                	js     3bf6 <fsfull+0x106>
+    int total = 0;
+    3ba7:	31 db                	xor    %ebx,%ebx
+    3ba9:	eb 07                	jmp    3bb2 <fsfull+0xc2>
+    3bab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3baf:	90                   	nop
+      total += cc;
+    3bb0:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    3bb2:	83 ec 04             	sub    $0x4,%esp
+    3bb5:	68 00 02 00 00       	push   $0x200
+    3bba:	68 00 90 00 00       	push   $0x9000
+    3bbf:	57                   	push   %edi
+    3bc0:	e8 7e 03 00 00       	call   3f43 <write>
+      if(cc < 512)
+    3bc5:	83 c4 10             	add    $0x10,%esp
+    3bc8:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    3bcd:	7f e1                	jg     3bb0 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    3bcf:	83 ec 04             	sub    $0x4,%esp
+    3bd2:	53                   	push   %ebx
+    3bd3:	68 45 55 00 00       	push   $0x5545
+    3bd8:	6a 01                	push   $0x1
+    3bda:	e8 f1 04 00 00       	call   40d0 <printf>
+    close(fd);
+    3bdf:	89 3c 24             	mov    %edi,(%esp)
+    3be2:	e8 64 03 00 00       	call   3f4b <close>
+    if(total == 0)
+    3be7:	83 c4 10             	add    $0x10,%esp
+    3bea:	85 db                	test   %ebx,%ebx
+    3bec:	74 1e                	je     3c0c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    3bee:	83 c6 01             	add    $0x1,%esi
+    3bf1:	e9 1a ff ff ff       	jmp    3b10 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    3bf6:	83 ec 04             	sub    $0x4,%esp
+    3bf9:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3bfc:	50                   	push   %eax
+    3bfd:	68 35 55 00 00       	push   $0x5535
+    3c02:	6a 01                	push   $0x1
+    3c04:	e8 c7 04 00 00       	call   40d0 <printf>
+      break;
+    3c09:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    3c0c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3c11:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    3c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3c1d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    3c20:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    3c22:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    3c25:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3c29:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    3c2b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3c2f:	c1 ea 06             	shr    $0x6,%edx
+    3c32:	8d 42 30             	lea    0x30(%edx),%eax
+    3c35:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3c38:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    3c3e:	89 f2                	mov    %esi,%edx
+    3c40:	29 c2                	sub    %eax,%edx
+    3c42:	89 d0                	mov    %edx,%eax
+    3c44:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    3c46:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3c48:	c1 ea 05             	shr    $0x5,%edx
+    3c4b:	83 c2 30             	add    $0x30,%edx
+    3c4e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3c51:	f7 e3                	mul    %ebx
+    3c53:	c1 ea 05             	shr    $0x5,%edx
+    3c56:	6b ca 64             	imul   $0x64,%edx,%ecx
+    3c59:	89 f2                	mov    %esi,%edx
+    3c5b:	29 ca                	sub    %ecx,%edx
+    3c5d:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    3c62:	89 d0                	mov    %edx,%eax
+    3c64:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    3c66:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3c68:	c1 ea 03             	shr    $0x3,%edx
+    3c6b:	83 c2 30             	add    $0x30,%edx
+    3c6e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3c71:	f7 e1                	mul    %ecx
+    3c73:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    3c75:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    3c78:	c1 ea 03             	shr    $0x3,%edx
+    3c7b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3c7e:	01 d2                	add    %edx,%edx
+    3c80:	29 d0                	sub    %edx,%eax
+    3c82:	83 c0 30             	add    $0x30,%eax
+    3c85:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    3c88:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3c8b:	50                   	push   %eax
+    3c8c:	e8 e2 02 00 00       	call   3f73 <unlink>
+  while(nfiles >= 0){
+    3c91:	83 c4 10             	add    $0x10,%esp
+    3c94:	83 fe ff             	cmp    $0xffffffff,%esi
+    3c97:	75 87                	jne    3c20 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    3c99:	83 ec 08             	sub    $0x8,%esp
+    3c9c:	68 55 55 00 00       	push   $0x5555
+    3ca1:	6a 01                	push   $0x1
+    3ca3:	e8 28 04 00 00       	call   40d0 <printf>
+}
+    3ca8:	83 c4 10             	add    $0x10,%esp
+    3cab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3cae:	5b                   	pop    %ebx
+    3caf:	5e                   	pop    %esi
+    3cb0:	5f                   	pop    %edi
+    3cb1:	5d                   	pop    %ebp
+    3cb2:	c3                   	ret
+    3cb3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003cc0 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    3cc0:	69 05 b0 68 00 00 0d 	imul   $0x19660d,0x68b0,%eax
+    3cc7:	66 19 00 
+    3cca:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    3ccf:	a3 b0 68 00 00       	mov    %eax,0x68b0
+}
+    3cd4:	c3                   	ret
+    3cd5:	66 90                	xchg   %ax,%ax
+    3cd7:	66 90                	xchg   %ax,%ax
+    3cd9:	66 90                	xchg   %ax,%ax
+    3cdb:	66 90                	xchg   %ax,%ax
+    3cdd:	66 90                	xchg   %ax,%ax
+    3cdf:	90                   	nop
+
+00003ce0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    3ce0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    3ce1:	31 c0                	xor    %eax,%eax
+{
+    3ce3:	89 e5                	mov    %esp,%ebp
+    3ce5:	53                   	push   %ebx
+    3ce6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    3ce9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    3cec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    3cf0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    3cf4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    3cf7:	83 c0 01             	add    $0x1,%eax
+    3cfa:	84 d2                	test   %dl,%dl
+    3cfc:	75 f2                	jne    3cf0 <strcpy+0x10>
+    ;
+  return os;
+}
+    3cfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3d01:	89 c8                	mov    %ecx,%eax
+    3d03:	c9                   	leave
+    3d04:	c3                   	ret
+    3d05:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003d10 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    3d10:	55                   	push   %ebp
+    3d11:	89 e5                	mov    %esp,%ebp
+    3d13:	53                   	push   %ebx
+    3d14:	8b 55 08             	mov    0x8(%ebp),%edx
+    3d17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    3d1a:	0f b6 02             	movzbl (%edx),%eax
+    3d1d:	84 c0                	test   %al,%al
+    3d1f:	75 17                	jne    3d38 <strcmp+0x28>
+    3d21:	eb 3a                	jmp    3d5d <strcmp+0x4d>
+    3d23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3d27:	90                   	nop
+    3d28:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    3d2c:	83 c2 01             	add    $0x1,%edx
+    3d2f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    3d32:	84 c0                	test   %al,%al
+    3d34:	74 1a                	je     3d50 <strcmp+0x40>
+    p++, q++;
+    3d36:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    3d38:	0f b6 19             	movzbl (%ecx),%ebx
+    3d3b:	38 c3                	cmp    %al,%bl
+    3d3d:	74 e9                	je     3d28 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    3d3f:	29 d8                	sub    %ebx,%eax
+}
+    3d41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3d44:	c9                   	leave
+    3d45:	c3                   	ret
+    3d46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d4d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    3d50:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    3d54:	31 c0                	xor    %eax,%eax
+    3d56:	29 d8                	sub    %ebx,%eax
+}
+    3d58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3d5b:	c9                   	leave
+    3d5c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    3d5d:	0f b6 19             	movzbl (%ecx),%ebx
+    3d60:	31 c0                	xor    %eax,%eax
+    3d62:	eb db                	jmp    3d3f <strcmp+0x2f>
+    3d64:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3d6f:	90                   	nop
+
+00003d70 <strlen>:
+
+uint
+strlen(char *s)
+{
+    3d70:	55                   	push   %ebp
+    3d71:	89 e5                	mov    %esp,%ebp
+    3d73:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    3d76:	80 3a 00             	cmpb   $0x0,(%edx)
+    3d79:	74 15                	je     3d90 <strlen+0x20>
+    3d7b:	31 c0                	xor    %eax,%eax
+    3d7d:	8d 76 00             	lea    0x0(%esi),%esi
+    3d80:	83 c0 01             	add    $0x1,%eax
+    3d83:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    3d87:	89 c1                	mov    %eax,%ecx
+    3d89:	75 f5                	jne    3d80 <strlen+0x10>
+    ;
+  return n;
+}
+    3d8b:	89 c8                	mov    %ecx,%eax
+    3d8d:	5d                   	pop    %ebp
+    3d8e:	c3                   	ret
+    3d8f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    3d90:	31 c9                	xor    %ecx,%ecx
+}
+    3d92:	5d                   	pop    %ebp
+    3d93:	89 c8                	mov    %ecx,%eax
+    3d95:	c3                   	ret
+    3d96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003da0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    3da0:	55                   	push   %ebp
+    3da1:	89 e5                	mov    %esp,%ebp
+    3da3:	57                   	push   %edi
+    3da4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    3da7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    3daa:	8b 45 0c             	mov    0xc(%ebp),%eax
+    3dad:	89 d7                	mov    %edx,%edi
+    3daf:	fc                   	cld
+    3db0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    3db2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    3db5:	89 d0                	mov    %edx,%eax
+    3db7:	c9                   	leave
+    3db8:	c3                   	ret
+    3db9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003dc0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    3dc0:	55                   	push   %ebp
+    3dc1:	89 e5                	mov    %esp,%ebp
+    3dc3:	8b 45 08             	mov    0x8(%ebp),%eax
+    3dc6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    3dca:	0f b6 10             	movzbl (%eax),%edx
+    3dcd:	84 d2                	test   %dl,%dl
+    3dcf:	75 12                	jne    3de3 <strchr+0x23>
+    3dd1:	eb 1d                	jmp    3df0 <strchr+0x30>
+    3dd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3dd7:	90                   	nop
+    3dd8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    3ddc:	83 c0 01             	add    $0x1,%eax
+    3ddf:	84 d2                	test   %dl,%dl
+    3de1:	74 0d                	je     3df0 <strchr+0x30>
+    if(*s == c)
+    3de3:	38 d1                	cmp    %dl,%cl
+    3de5:	75 f1                	jne    3dd8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    3de7:	5d                   	pop    %ebp
+    3de8:	c3                   	ret
+    3de9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    3df0:	31 c0                	xor    %eax,%eax
+}
+    3df2:	5d                   	pop    %ebp
+    3df3:	c3                   	ret
+    3df4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3dff:	90                   	nop
+
+00003e00 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    3e00:	55                   	push   %ebp
+    3e01:	89 e5                	mov    %esp,%ebp
+    3e03:	57                   	push   %edi
+    3e04:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    3e05:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    3e08:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    3e09:	31 db                	xor    %ebx,%ebx
+{
+    3e0b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    3e0e:	eb 27                	jmp    3e37 <gets+0x37>
+    cc = read(0, &c, 1);
+    3e10:	83 ec 04             	sub    $0x4,%esp
+    3e13:	6a 01                	push   $0x1
+    3e15:	56                   	push   %esi
+    3e16:	6a 00                	push   $0x0
+    3e18:	e8 1e 01 00 00       	call   3f3b <read>
+    if(cc < 1)
+    3e1d:	83 c4 10             	add    $0x10,%esp
+    3e20:	85 c0                	test   %eax,%eax
+    3e22:	7e 1d                	jle    3e41 <gets+0x41>
+      break;
+    buf[i++] = c;
+    3e24:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    3e28:	8b 55 08             	mov    0x8(%ebp),%edx
+    3e2b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    3e2f:	3c 0a                	cmp    $0xa,%al
+    3e31:	74 10                	je     3e43 <gets+0x43>
+    3e33:	3c 0d                	cmp    $0xd,%al
+    3e35:	74 0c                	je     3e43 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    3e37:	89 df                	mov    %ebx,%edi
+    3e39:	83 c3 01             	add    $0x1,%ebx
+    3e3c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    3e3f:	7c cf                	jl     3e10 <gets+0x10>
+    3e41:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    3e43:	8b 45 08             	mov    0x8(%ebp),%eax
+    3e46:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    3e4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3e4d:	5b                   	pop    %ebx
+    3e4e:	5e                   	pop    %esi
+    3e4f:	5f                   	pop    %edi
+    3e50:	5d                   	pop    %ebp
+    3e51:	c3                   	ret
+    3e52:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003e60 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    3e60:	55                   	push   %ebp
+    3e61:	89 e5                	mov    %esp,%ebp
+    3e63:	56                   	push   %esi
+    3e64:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    3e65:	83 ec 08             	sub    $0x8,%esp
+    3e68:	6a 00                	push   $0x0
+    3e6a:	ff 75 08             	push   0x8(%ebp)
+    3e6d:	e8 f1 00 00 00       	call   3f63 <open>
+  if(fd < 0)
+    3e72:	83 c4 10             	add    $0x10,%esp
+    3e75:	85 c0                	test   %eax,%eax
+    3e77:	78 27                	js     3ea0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    3e79:	83 ec 08             	sub    $0x8,%esp
+    3e7c:	ff 75 0c             	push   0xc(%ebp)
+    3e7f:	89 c3                	mov    %eax,%ebx
+    3e81:	50                   	push   %eax
+    3e82:	e8 f4 00 00 00       	call   3f7b <fstat>
+  close(fd);
+    3e87:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    3e8a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    3e8c:	e8 ba 00 00 00       	call   3f4b <close>
+  return r;
+    3e91:	83 c4 10             	add    $0x10,%esp
+}
+    3e94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3e97:	89 f0                	mov    %esi,%eax
+    3e99:	5b                   	pop    %ebx
+    3e9a:	5e                   	pop    %esi
+    3e9b:	5d                   	pop    %ebp
+    3e9c:	c3                   	ret
+    3e9d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    3ea0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    3ea5:	eb ed                	jmp    3e94 <stat+0x34>
+    3ea7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3eae:	66 90                	xchg   %ax,%ax
+
+00003eb0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    3eb0:	55                   	push   %ebp
+    3eb1:	89 e5                	mov    %esp,%ebp
+    3eb3:	53                   	push   %ebx
+    3eb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    3eb7:	0f be 02             	movsbl (%edx),%eax
+    3eba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    3ebd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    3ec0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    3ec5:	77 1e                	ja     3ee5 <atoi+0x35>
+    3ec7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3ece:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    3ed0:	83 c2 01             	add    $0x1,%edx
+    3ed3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    3ed6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    3eda:	0f be 02             	movsbl (%edx),%eax
+    3edd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    3ee0:	80 fb 09             	cmp    $0x9,%bl
+    3ee3:	76 eb                	jbe    3ed0 <atoi+0x20>
+  return n;
+}
+    3ee5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3ee8:	89 c8                	mov    %ecx,%eax
+    3eea:	c9                   	leave
+    3eeb:	c3                   	ret
+    3eec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003ef0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    3ef0:	55                   	push   %ebp
+    3ef1:	89 e5                	mov    %esp,%ebp
+    3ef3:	57                   	push   %edi
+    3ef4:	56                   	push   %esi
+    3ef5:	8b 45 10             	mov    0x10(%ebp),%eax
+    3ef8:	8b 55 08             	mov    0x8(%ebp),%edx
+    3efb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    3efe:	85 c0                	test   %eax,%eax
+    3f00:	7e 13                	jle    3f15 <memmove+0x25>
+    3f02:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    3f04:	89 d7                	mov    %edx,%edi
+    3f06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f0d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    3f10:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    3f11:	39 f8                	cmp    %edi,%eax
+    3f13:	75 fb                	jne    3f10 <memmove+0x20>
+  return vdst;
+}
+    3f15:	5e                   	pop    %esi
+    3f16:	89 d0                	mov    %edx,%eax
+    3f18:	5f                   	pop    %edi
+    3f19:	5d                   	pop    %ebp
+    3f1a:	c3                   	ret
+
+00003f1b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    3f1b:	b8 01 00 00 00       	mov    $0x1,%eax
+    3f20:	cd 40                	int    $0x40
+    3f22:	c3                   	ret
+
+00003f23 <exit>:
+SYSCALL(exit)
+    3f23:	b8 02 00 00 00       	mov    $0x2,%eax
+    3f28:	cd 40                	int    $0x40
+    3f2a:	c3                   	ret
+
+00003f2b <wait>:
+SYSCALL(wait)
+    3f2b:	b8 03 00 00 00       	mov    $0x3,%eax
+    3f30:	cd 40                	int    $0x40
+    3f32:	c3                   	ret
+
+00003f33 <pipe>:
+SYSCALL(pipe)
+    3f33:	b8 04 00 00 00       	mov    $0x4,%eax
+    3f38:	cd 40                	int    $0x40
+    3f3a:	c3                   	ret
+
+00003f3b <read>:
+SYSCALL(read)
+    3f3b:	b8 05 00 00 00       	mov    $0x5,%eax
+    3f40:	cd 40                	int    $0x40
+    3f42:	c3                   	ret
+
+00003f43 <write>:
+SYSCALL(write)
+    3f43:	b8 10 00 00 00       	mov    $0x10,%eax
+    3f48:	cd 40                	int    $0x40
+    3f4a:	c3                   	ret
+
+00003f4b <close>:
+SYSCALL(close)
+    3f4b:	b8 15 00 00 00       	mov    $0x15,%eax
+    3f50:	cd 40                	int    $0x40
+    3f52:	c3                   	ret
+
+00003f53 <kill>:
+SYSCALL(kill)
+    3f53:	b8 06 00 00 00       	mov    $0x6,%eax
+    3f58:	cd 40                	int    $0x40
+    3f5a:	c3                   	ret
+
+00003f5b <exec>:
+SYSCALL(exec)
+    3f5b:	b8 07 00 00 00       	mov    $0x7,%eax
+    3f60:	cd 40                	int    $0x40
+    3f62:	c3                   	ret
+
+00003f63 <open>:
+SYSCALL(open)
+    3f63:	b8 0f 00 00 00       	mov    $0xf,%eax
+    3f68:	cd 40                	int    $0x40
+    3f6a:	c3                   	ret
+
+00003f6b <mknod>:
+SYSCALL(mknod)
+    3f6b:	b8 11 00 00 00       	mov    $0x11,%eax
+    3f70:	cd 40                	int    $0x40
+    3f72:	c3                   	ret
+
+00003f73 <unlink>:
+SYSCALL(unlink)
+    3f73:	b8 12 00 00 00       	mov    $0x12,%eax
+    3f78:	cd 40                	int    $0x40
+    3f7a:	c3                   	ret
+
+00003f7b <fstat>:
+SYSCALL(fstat)
+    3f7b:	b8 08 00 00 00       	mov    $0x8,%eax
+    3f80:	cd 40                	int    $0x40
+    3f82:	c3                   	ret
+
+00003f83 <link>:
+SYSCALL(link)
+    3f83:	b8 13 00 00 00       	mov    $0x13,%eax
+    3f88:	cd 40                	int    $0x40
+    3f8a:	c3                   	ret
+
+00003f8b <mkdir>:
+SYSCALL(mkdir)
+    3f8b:	b8 14 00 00 00       	mov    $0x14,%eax
+    3f90:	cd 40                	int    $0x40
+    3f92:	c3                   	ret
+
+00003f93 <chdir>:
+SYSCALL(chdir)
+    3f93:	b8 09 00 00 00       	mov    $0x9,%eax
+    3f98:	cd 40                	int    $0x40
+    3f9a:	c3                   	ret
+
+00003f9b <dup>:
+SYSCALL(dup)
+    3f9b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    3fa0:	cd 40                	int    $0x40
+    3fa2:	c3                   	ret
+
+00003fa3 <getpid>:
+SYSCALL(getpid)
+    3fa3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    3fa8:	cd 40                	int    $0x40
+    3faa:	c3                   	ret
+
+00003fab <sbrk>:
+SYSCALL(sbrk)
+    3fab:	b8 0c 00 00 00       	mov    $0xc,%eax
+    3fb0:	cd 40                	int    $0x40
+    3fb2:	c3                   	ret
+
+00003fb3 <sleep>:
+SYSCALL(sleep)
+    3fb3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    3fb8:	cd 40                	int    $0x40
+    3fba:	c3                   	ret
+
+00003fbb <uptime>:
+SYSCALL(uptime)
+    3fbb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    3fc0:	cd 40                	int    $0x40
+    3fc2:	c3                   	ret
+
+00003fc3 <trace>:
+SYSCALL(trace)
+    3fc3:	b8 16 00 00 00       	mov    $0x16,%eax
+    3fc8:	cd 40                	int    $0x40
+    3fca:	c3                   	ret
+
+00003fcb <csinfo>:
+SYSCALL(csinfo)
+    3fcb:	b8 17 00 00 00       	mov    $0x17,%eax
+    3fd0:	cd 40                	int    $0x40
+    3fd2:	c3                   	ret
+
+00003fd3 <settickets>:
+SYSCALL(settickets)
+    3fd3:	b8 18 00 00 00       	mov    $0x18,%eax
+    3fd8:	cd 40                	int    $0x40
+    3fda:	c3                   	ret
+
+00003fdb <getprocessesinfo>:
+SYSCALL(getprocessesinfo)
+    3fdb:	b8 19 00 00 00       	mov    $0x19,%eax
+    3fe0:	cd 40                	int    $0x40
+    3fe2:	c3                   	ret
+
+00003fe3 <yield>:
+SYSCALL(yield)
+    3fe3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    3fe8:	cd 40                	int    $0x40
+    3fea:	c3                   	ret
+
+00003feb <random>:
+SYSCALL(random)
+    3feb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    3ff0:	cd 40                	int    $0x40
+    3ff2:	c3                   	ret
+
+00003ff3 <dumppagetable>:
+SYSCALL(dumppagetable)
+    3ff3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    3ff8:	cd 40                	int    $0x40
+    3ffa:	c3                   	ret
+
+00003ffb <getcpusinfo>:
+SYSCALL(getcpusinfo)
+    3ffb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    4000:	cd 40                	int    $0x40
+    4002:	c3                   	ret
+
+00004003 <setsched>:
+SYSCALL(setsched)
+    4003:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    4008:	cd 40                	int    $0x40
+    400a:	c3                   	ret
+
+0000400b <getbcacheinfo>:
+SYSCALL(getbcacheinfo)
+    400b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    4010:	cd 40                	int    $0x40
+    4012:	c3                   	ret
+
+00004013 <getballocinfo>:
+SYSCALL(getballocinfo)
+    4013:	b8 20 00 00 00       	mov    $0x20,%eax
+    4018:	cd 40                	int    $0x40
+    401a:	c3                   	ret
+
+0000401b <getfaultinfo>:
+SYSCALL(getfaultinfo)
+    401b:	b8 21 00 00 00       	mov    $0x21,%eax
+    4020:	cd 40                	int    $0x40
+    4022:	c3                   	ret
+    4023:	66 90                	xchg   %ax,%ax
+    4025:	66 90                	xchg   %ax,%ax
+    4027:	66 90                	xchg   %ax,%ax
+    4029:	66 90                	xchg   %ax,%ax
+    402b:	66 90                	xchg   %ax,%ax
+    402d:	66 90                	xchg   %ax,%ax
+    402f:	90                   	nop
+
+00004030 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    4030:	55                   	push   %ebp
+    4031:	89 e5                	mov    %esp,%ebp
+    4033:	57                   	push   %edi
+    4034:	56                   	push   %esi
+    4035:	53                   	push   %ebx
+    4036:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    4038:	89 d1                	mov    %edx,%ecx
+{
+    403a:	83 ec 3c             	sub    $0x3c,%esp
+    403d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    4040:	85 d2                	test   %edx,%edx
+    4042:	0f 89 80 00 00 00    	jns    40c8 <printint+0x98>
+    4048:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    404c:	74 7a                	je     40c8 <printint+0x98>
+    x = -xx;
+    404e:	f7 d9                	neg    %ecx
+    neg = 1;
+    4050:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    4055:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    4058:	31 f6                	xor    %esi,%esi
+    405a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    4060:	89 c8                	mov    %ecx,%eax
+    4062:	31 d2                	xor    %edx,%edx
+    4064:	89 f7                	mov    %esi,%edi
+    4066:	f7 f3                	div    %ebx
+    4068:	8d 76 01             	lea    0x1(%esi),%esi
+    406b:	0f b6 92 70 5f 00 00 	movzbl 0x5f70(%edx),%edx
+    4072:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    4076:	89 ca                	mov    %ecx,%edx
+    4078:	89 c1                	mov    %eax,%ecx
+    407a:	39 da                	cmp    %ebx,%edx
+    407c:	73 e2                	jae    4060 <printint+0x30>
+  if(neg)
+    407e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    4081:	85 c0                	test   %eax,%eax
+    4083:	74 07                	je     408c <printint+0x5c>
+    buf[i++] = '-';
+    4085:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    408a:	89 f7                	mov    %esi,%edi
+    408c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    408f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    4092:	01 df                	add    %ebx,%edi
+    4094:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    4098:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    409b:	83 ec 04             	sub    $0x4,%esp
+    409e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    40a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    40a4:	6a 01                	push   $0x1
+    40a6:	50                   	push   %eax
+    40a7:	56                   	push   %esi
+    40a8:	e8 96 fe ff ff       	call   3f43 <write>
+  while(--i >= 0)
+    40ad:	89 f8                	mov    %edi,%eax
+    40af:	83 c4 10             	add    $0x10,%esp
+    40b2:	83 ef 01             	sub    $0x1,%edi
+    40b5:	39 d8                	cmp    %ebx,%eax
+    40b7:	75 df                	jne    4098 <printint+0x68>
+}
+    40b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    40bc:	5b                   	pop    %ebx
+    40bd:	5e                   	pop    %esi
+    40be:	5f                   	pop    %edi
+    40bf:	5d                   	pop    %ebp
+    40c0:	c3                   	ret
+    40c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    40c8:	31 c0                	xor    %eax,%eax
+    40ca:	eb 89                	jmp    4055 <printint+0x25>
+    40cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000040d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    40d0:	55                   	push   %ebp
+    40d1:	89 e5                	mov    %esp,%ebp
+    40d3:	57                   	push   %edi
+    40d4:	56                   	push   %esi
+    40d5:	53                   	push   %ebx
+    40d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    40d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    40dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    40df:	0f b6 1e             	movzbl (%esi),%ebx
+    40e2:	83 c6 01             	add    $0x1,%esi
+    40e5:	84 db                	test   %bl,%bl
+    40e7:	74 67                	je     4150 <printf+0x80>
+    40e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    40ec:	31 d2                	xor    %edx,%edx
+    40ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    40f1:	eb 34                	jmp    4127 <printf+0x57>
+    40f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    40f7:	90                   	nop
+    40f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    40fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    4100:	83 f8 25             	cmp    $0x25,%eax
+    4103:	74 18                	je     411d <printf+0x4d>
+  write(fd, &c, 1);
+    4105:	83 ec 04             	sub    $0x4,%esp
+    4108:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    410b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    410e:	6a 01                	push   $0x1
+    4110:	50                   	push   %eax
+    4111:	57                   	push   %edi
+    4112:	e8 2c fe ff ff       	call   3f43 <write>
+    4117:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    411a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    411d:	0f b6 1e             	movzbl (%esi),%ebx
+    4120:	83 c6 01             	add    $0x1,%esi
+    4123:	84 db                	test   %bl,%bl
+    4125:	74 29                	je     4150 <printf+0x80>
+    c = fmt[i] & 0xff;
+    4127:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    412a:	85 d2                	test   %edx,%edx
+    412c:	74 ca                	je     40f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    412e:	83 fa 25             	cmp    $0x25,%edx
+    4131:	75 ea                	jne    411d <printf+0x4d>
+      if(c == 'd'){
+    4133:	83 f8 25             	cmp    $0x25,%eax
+    4136:	0f 84 24 01 00 00    	je     4260 <printf+0x190>
+    413c:	83 e8 63             	sub    $0x63,%eax
+    413f:	83 f8 15             	cmp    $0x15,%eax
+    4142:	77 1c                	ja     4160 <printf+0x90>
+    4144:	ff 24 85 18 5f 00 00 	jmp    *0x5f18(,%eax,4)
+    414b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    414f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    4150:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4153:	5b                   	pop    %ebx
+    4154:	5e                   	pop    %esi
+    4155:	5f                   	pop    %edi
+    4156:	5d                   	pop    %ebp
+    4157:	c3                   	ret
+    4158:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    415f:	90                   	nop
+  write(fd, &c, 1);
+    4160:	83 ec 04             	sub    $0x4,%esp
+    4163:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4166:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    416a:	6a 01                	push   $0x1
+    416c:	52                   	push   %edx
+    416d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    4170:	57                   	push   %edi
+    4171:	e8 cd fd ff ff       	call   3f43 <write>
+    4176:	83 c4 0c             	add    $0xc,%esp
+    4179:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    417c:	6a 01                	push   $0x1
+    417e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    4181:	52                   	push   %edx
+    4182:	57                   	push   %edi
+    4183:	e8 bb fd ff ff       	call   3f43 <write>
+        putc(fd, c);
+    4188:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    418b:	31 d2                	xor    %edx,%edx
+    418d:	eb 8e                	jmp    411d <printf+0x4d>
+    418f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    4190:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4193:	83 ec 0c             	sub    $0xc,%esp
+    4196:	b9 10 00 00 00       	mov    $0x10,%ecx
+    419b:	8b 13                	mov    (%ebx),%edx
+    419d:	6a 00                	push   $0x0
+    419f:	89 f8                	mov    %edi,%eax
+        ap++;
+    41a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    41a4:	e8 87 fe ff ff       	call   4030 <printint>
+        ap++;
+    41a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    41ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    41af:	31 d2                	xor    %edx,%edx
+    41b1:	e9 67 ff ff ff       	jmp    411d <printf+0x4d>
+    41b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    41bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    41c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    41c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    41c5:	83 c0 04             	add    $0x4,%eax
+    41c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    41cb:	85 db                	test   %ebx,%ebx
+    41cd:	0f 84 9d 00 00 00    	je     4270 <printf+0x1a0>
+        while(*s != 0){
+    41d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    41d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    41d8:	84 c0                	test   %al,%al
+    41da:	0f 84 3d ff ff ff    	je     411d <printf+0x4d>
+    41e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    41e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    41e6:	89 de                	mov    %ebx,%esi
+    41e8:	89 d3                	mov    %edx,%ebx
+    41ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    41f0:	83 ec 04             	sub    $0x4,%esp
+    41f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    41f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    41f9:	6a 01                	push   $0x1
+    41fb:	53                   	push   %ebx
+    41fc:	57                   	push   %edi
+    41fd:	e8 41 fd ff ff       	call   3f43 <write>
+        while(*s != 0){
+    4202:	0f b6 06             	movzbl (%esi),%eax
+    4205:	83 c4 10             	add    $0x10,%esp
+    4208:	84 c0                	test   %al,%al
+    420a:	75 e4                	jne    41f0 <printf+0x120>
+      state = 0;
+    420c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    420f:	31 d2                	xor    %edx,%edx
+    4211:	e9 07 ff ff ff       	jmp    411d <printf+0x4d>
+    4216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    421d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    4220:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4223:	83 ec 0c             	sub    $0xc,%esp
+    4226:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    422b:	8b 13                	mov    (%ebx),%edx
+    422d:	6a 01                	push   $0x1
+    422f:	e9 6b ff ff ff       	jmp    419f <printf+0xcf>
+    4234:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    4238:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    423b:	83 ec 04             	sub    $0x4,%esp
+    423e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    4241:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    4243:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    4246:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    4249:	6a 01                	push   $0x1
+    424b:	52                   	push   %edx
+    424c:	57                   	push   %edi
+    424d:	e8 f1 fc ff ff       	call   3f43 <write>
+        ap++;
+    4252:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4255:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4258:	31 d2                	xor    %edx,%edx
+    425a:	e9 be fe ff ff       	jmp    411d <printf+0x4d>
+    425f:	90                   	nop
+  write(fd, &c, 1);
+    4260:	83 ec 04             	sub    $0x4,%esp
+    4263:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4266:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4269:	6a 01                	push   $0x1
+    426b:	e9 11 ff ff ff       	jmp    4181 <printf+0xb1>
+    4270:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    4275:	bb 0e 5f 00 00       	mov    $0x5f0e,%ebx
+    427a:	e9 61 ff ff ff       	jmp    41e0 <printf+0x110>
+    427f:	90                   	nop
+
+00004280 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    4280:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4281:	a1 80 b0 00 00       	mov    0xb080,%eax
+{
+    4286:	89 e5                	mov    %esp,%ebp
+    4288:	57                   	push   %edi
+    4289:	56                   	push   %esi
+    428a:	53                   	push   %ebx
+    428b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    428e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4291:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4298:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    429a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    429c:	39 ca                	cmp    %ecx,%edx
+    429e:	73 30                	jae    42d0 <free+0x50>
+    42a0:	39 c1                	cmp    %eax,%ecx
+    42a2:	72 04                	jb     42a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    42a4:	39 c2                	cmp    %eax,%edx
+    42a6:	72 f0                	jb     4298 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    42a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    42ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    42ae:	39 f8                	cmp    %edi,%eax
+    42b0:	74 2e                	je     42e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    42b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    42b5:	8b 42 04             	mov    0x4(%edx),%eax
+    42b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    42bb:	39 f1                	cmp    %esi,%ecx
+    42bd:	74 38                	je     42f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    42bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    42c1:	5b                   	pop    %ebx
+  freep = p;
+    42c2:	89 15 80 b0 00 00    	mov    %edx,0xb080
+}
+    42c8:	5e                   	pop    %esi
+    42c9:	5f                   	pop    %edi
+    42ca:	5d                   	pop    %ebp
+    42cb:	c3                   	ret
+    42cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    42d0:	39 c1                	cmp    %eax,%ecx
+    42d2:	72 d0                	jb     42a4 <free+0x24>
+    42d4:	eb c2                	jmp    4298 <free+0x18>
+    42d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    42dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    42e0:	03 70 04             	add    0x4(%eax),%esi
+    42e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    42e6:	8b 02                	mov    (%edx),%eax
+    42e8:	8b 00                	mov    (%eax),%eax
+    42ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    42ed:	8b 42 04             	mov    0x4(%edx),%eax
+    42f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    42f3:	39 f1                	cmp    %esi,%ecx
+    42f5:	75 c8                	jne    42bf <free+0x3f>
+    p->s.size += bp->s.size;
+    42f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    42fa:	89 15 80 b0 00 00    	mov    %edx,0xb080
+    p->s.size += bp->s.size;
+    4300:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    4303:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    4306:	89 0a                	mov    %ecx,(%edx)
+}
+    4308:	5b                   	pop    %ebx
+    4309:	5e                   	pop    %esi
+    430a:	5f                   	pop    %edi
+    430b:	5d                   	pop    %ebp
+    430c:	c3                   	ret
+    430d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004310 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    4310:	55                   	push   %ebp
+    4311:	89 e5                	mov    %esp,%ebp
+    4313:	57                   	push   %edi
+    4314:	56                   	push   %esi
+    4315:	53                   	push   %ebx
+    4316:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4319:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    431c:	8b 15 80 b0 00 00    	mov    0xb080,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4322:	8d 78 07             	lea    0x7(%eax),%edi
+    4325:	c1 ef 03             	shr    $0x3,%edi
+    4328:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    432b:	85 d2                	test   %edx,%edx
+    432d:	0f 84 8d 00 00 00    	je     43c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4333:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4335:	8b 48 04             	mov    0x4(%eax),%ecx
+    4338:	39 f9                	cmp    %edi,%ecx
+    433a:	73 64                	jae    43a0 <malloc+0x90>
+  if(nu < 4096)
+    433c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    4341:	39 df                	cmp    %ebx,%edi
+    4343:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    4346:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    434d:	eb 0a                	jmp    4359 <malloc+0x49>
+    434f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4350:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4352:	8b 48 04             	mov    0x4(%eax),%ecx
+    4355:	39 f9                	cmp    %edi,%ecx
+    4357:	73 47                	jae    43a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    4359:	89 c2                	mov    %eax,%edx
+    435b:	39 05 80 b0 00 00    	cmp    %eax,0xb080
+    4361:	75 ed                	jne    4350 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    4363:	83 ec 0c             	sub    $0xc,%esp
+    4366:	56                   	push   %esi
+    4367:	e8 3f fc ff ff       	call   3fab <sbrk>
+  if(p == (char*)-1)
+    436c:	83 c4 10             	add    $0x10,%esp
+    436f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4372:	74 1c                	je     4390 <malloc+0x80>
+  hp->s.size = nu;
+    4374:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    4377:	83 ec 0c             	sub    $0xc,%esp
+    437a:	83 c0 08             	add    $0x8,%eax
+    437d:	50                   	push   %eax
+    437e:	e8 fd fe ff ff       	call   4280 <free>
+  return freep;
+    4383:	8b 15 80 b0 00 00    	mov    0xb080,%edx
+      if((p = morecore(nunits)) == 0)
+    4389:	83 c4 10             	add    $0x10,%esp
+    438c:	85 d2                	test   %edx,%edx
+    438e:	75 c0                	jne    4350 <malloc+0x40>
+        return 0;
+  }
+}
+    4390:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    4393:	31 c0                	xor    %eax,%eax
+}
+    4395:	5b                   	pop    %ebx
+    4396:	5e                   	pop    %esi
+    4397:	5f                   	pop    %edi
+    4398:	5d                   	pop    %ebp
+    4399:	c3                   	ret
+    439a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    43a0:	39 cf                	cmp    %ecx,%edi
+    43a2:	74 4c                	je     43f0 <malloc+0xe0>
+        p->s.size -= nunits;
+    43a4:	29 f9                	sub    %edi,%ecx
+    43a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    43a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    43ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    43af:	89 15 80 b0 00 00    	mov    %edx,0xb080
+}
+    43b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    43b8:	83 c0 08             	add    $0x8,%eax
+}
+    43bb:	5b                   	pop    %ebx
+    43bc:	5e                   	pop    %esi
+    43bd:	5f                   	pop    %edi
+    43be:	5d                   	pop    %ebp
+    43bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    43c0:	c7 05 80 b0 00 00 84 	movl   $0xb084,0xb080
+    43c7:	b0 00 00 
+    base.s.size = 0;
+    43ca:	b8 84 b0 00 00       	mov    $0xb084,%eax
+    base.s.ptr = freep = prevp = &base;
+    43cf:	c7 05 84 b0 00 00 84 	movl   $0xb084,0xb084
+    43d6:	b0 00 00 
+    base.s.size = 0;
+    43d9:	c7 05 88 b0 00 00 00 	movl   $0x0,0xb088
+    43e0:	00 00 00 
+    if(p->s.size >= nunits){
+    43e3:	e9 54 ff ff ff       	jmp    433c <malloc+0x2c>
+    43e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    43ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    43f0:	8b 08                	mov    (%eax),%ecx
+    43f2:	89 0a                	mov    %ecx,(%edx)
+    43f4:	eb b9                	jmp    43af <malloc+0x9f>
@@ -9,6 +9,11 @@
 #include "memlayout.h"
 
 char buf[8192];
+
+// The big-file tests write this many 512-byte chunks: MAXFILE
+// blocks' worth, but no more than 8MB, which the default disk holds
+// at any BSIZE.
+#define NBIG (MAXFILE*(BSIZE/512) < 16384 ? MAXFILE*(BSIZE/512) : 16384)
 char name[3];
 char *echoargv[] = { "echo", "ALL", "TESTS", "PASSED", 0 };
 int stdout = 1;
@@ -97,7 +102,7 @@ writetest1(void)
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  for(i = 0; i < NBIG; i++){
     ((int*)buf)[0] = i;
     if(write(fd, buf, 512) != 512){
       printf(stdout, "error: write big file failed\n", i);
@@ -117,7 +122,7 @@ writetest1(void)
   for(;;){
     i = read(fd, buf, 512);
     if(i == 0){
-      if(n == MAXFILE - 1){
+      if(n == NBIG - 1){
         printf(stdout, "read only %d blocks from big", n);
         exit();
       }
@@ -141,13 +146,104 @@ writetest1(void)
   printf(stdout, "big files ok\n");
 }
 
+// Time writing a file of nearly NBIG chunks in big
+// write()s; filewrite() splits each into as few transactions
+// as the log size allows.
+void
+writebench(void)
+{
+  int fd, n, tot;
+  uint start, elapsed;
+
+  printf(stdout, "write throughput test\n");
+
+  memset(buf, 'w', sizeof(buf));
+  fd = open("writebench", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(stdout, "error: creat writebench failed!\n");
+    exit();
+  }
+  start = uptime();
+  for(tot = 0; tot < (NBIG - 1) * 512; tot += n){
+    n = (NBIG - 1) * 512 - tot;
+    if(n > sizeof(buf))
+      n = sizeof(buf);
+    if(write(fd, buf, n) != n){
+      printf(stdout, "error: write writebench failed\n");
+      exit();
+    }
+  }
+  close(fd);
+  elapsed = uptime() - start;
+  unlink("writebench");
+
+  printf(stdout, "wrote %d bytes in %d ticks", tot, elapsed);
+  if(elapsed > 0)
+    printf(stdout, " (%d bytes/tick)", tot / elapsed);
+  printf(stdout, "\nwrite throughput ok\n");
+}
+
+// Time sequential 512-byte reads of a file of nearly NBIG
+// chunks, the way cat reads, to see what read-ahead buys.
+void
+readbench(void)
+{
+  int i, fd, n, tot;
+  uint start, elapsed;
+
+  printf(stdout, "read throughput test\n");
+
+  fd = open("readbench", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(stdout, "error: creat readbench failed!\n");
+    exit();
+  }
+  for(i = 0; i < NBIG - 1; i++){
+    ((int*)buf)[0] = i;
+    if(write(fd, buf, 512) != 512){
+      printf(stdout, "error: write readbench failed\n");
+      exit();
+    }
+  }
+  close(fd);
+
+  fd = open("readbench", O_RDONLY);
+  if(fd < 0){
+    printf(stdout, "error: open readbench failed!\n");
+    exit();
+  }
+  tot = 0;
+  start = uptime();
+  while((n = read(fd, buf, 512)) > 0){
+    if(((int*)buf)[0] != tot / 512){
+      printf(stdout, "readbench: bad content at block %d\n", tot / 512);
+      exit();
+    }
+    tot += n;
+  }
+  elapsed = uptime() - start;
+  close(fd);
+  unlink("readbench");
+  if(tot != (NBIG - 1) * 512){
+    printf(stdout, "readbench: read %d bytes\n", tot);
+    exit();
+  }
+
+  printf(stdout, "read %d bytes in %d ticks", tot, elapsed);
+  if(elapsed > 0)
+    printf(stdout, " (%d bytes/tick)", tot / elapsed);
+  printf(stdout, "\nread throughput ok\n");
+}
+
 void
 createtest(void)
 {
   int i, fd;
+  uint start;
 
   printf(stdout, "many creates, followed by unlink test\n");
 
+  start = uptime();
   name[0] = 'a';
   name[2] = '\0';
   for(i = 0; i < 52; i++){
@@ -161,7 +257,8 @@ createtest(void)
     name[1] = '0' + i;
     unlink(name);
   }
-  printf(stdout, "many creates, followed by unlink; ok\n");
+  printf(stdout, "many creates, followed by unlink; ok (%d ticks)\n",
+         uptime() - start);
 }
 
 void dirtest(void)
@@ -200,6 +297,35 @@ exectest(void)
   }
 }
 
+// A running program's file pages in for as long as it runs,
+// so writes to it must fail.  Rewrites usertests' own first
+// bytes with the same bytes, so it is harmless if they succeed.
+void
+textbusytest(void)
+{
+  char buf[4];
+  int fd;
+
+  printf(stdout, "text busy test\n");
+  fd = open("usertests", O_RDONLY);
+  if(fd < 0 || read(fd, buf, sizeof(buf)) != sizeof(buf)){
+    printf(stdout, "cannot read usertests\n");
+    exit();
+  }
+  close(fd);
+  fd = open("usertests", O_WRONLY);
+  if(fd < 0){
+    printf(stdout, "cannot open usertests for writing\n");
+    exit();
+  }
+  if(write(fd, buf, sizeof(buf)) >= 0){
+    printf(stdout, "wrote to running usertests\n");
+    exit();
+  }
+  close(fd);
+  printf(stdout, "text busy test OK\n");
+}
+
 // simple fork and pipe read/write
 
 void
@@ -357,6 +483,59 @@ mem(void)
   }
 }
 
+// one child per CPU repeatedly grows a heap and touches
+// every page, stressing kalloc()/kfree() from all CPUs at once.
+#define STRESSPAGES 256
+#define STRESSROUNDS 8
+void
+allocstress(void)
+{
+  int i, r, pid, total;
+  uint start, elapsed;
+  char *a, *p;
+
+  printf(1, "alloc stress test\n");
+  start = uptime();
+  for(i = 0; i < NCPU; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(1, "alloc stress: fork failed\n");
+      exit();
+    }
+    if(pid > 0)
+      continue;
+    for(r = 0; r < STRESSROUNDS; r++){
+      // each round runs in a fresh process so that
+      // exit() hands every page back to kfree().
+      if((pid = fork()) == 0){
+        a = sbrk(STRESSPAGES*4096);
+        if(a == (char*)-1){
+          printf(1, "alloc stress: sbrk failed\n");
+          exit();
+        }
+        for(p = a; p < a + STRESSPAGES*4096; p += 4096)
+          *p = r;
+        exit();
+      }
+      if(pid < 0){
+        printf(1, "alloc stress: fork failed\n");
+        exit();
+      }
+      wait();
+    }
+    exit();
+  }
+  for(i = 0; i < NCPU; i++)
+    wait();
+  elapsed = uptime() - start;
+  if(elapsed == 0)
+    elapsed = 1;
+  total = NCPU * STRESSROUNDS * STRESSPAGES;
+  printf(1, "alloc stress: %d pages in %d ticks, %d pages/tick\n",
+         total, elapsed, total / elapsed);
+  printf(1, "alloc stress ok\n");
+}
+
 // More file system tests
 
 // two processes write to the same file descriptor
@@ -1182,6 +1361,65 @@ rmdot(void)
   printf(1, "rmdot ok\n");
 }
 
+// The directory name cache must follow creates and unlinks,
+// and must not carry a freed directory's entries over to a new
+// directory that gets its i-number.
+void
+namecache(void)
+{
+  int fd;
+
+  printf(1, "name cache test\n");
+  if(mkdir("nc") != 0 || open("nc/f", O_RDONLY) >= 0){
+    printf(1, "namecache: mkdir nc failed\n");
+    exit();
+  }
+  if((fd = open("nc/f", O_CREATE|O_RDWR)) < 0){
+    printf(1, "namecache: create nc/f after failed open failed\n");
+    exit();
+  }
+  close(fd);
+  if((fd = open("nc/f", O_RDONLY)) < 0){
+    printf(1, "namecache: open nc/f failed\n");
+    exit();
+  }
+  close(fd);
+  if(link("nc/f", "nc/g") != 0 || open("nc/g", O_RDONLY) < 0){
+    printf(1, "namecache: link nc/g failed\n");
+    exit();
+  }
+  if(unlink("nc/f") != 0 || unlink("nc/g") != 0){
+    printf(1, "namecache: unlink failed\n");
+    exit();
+  }
+  if(open("nc/f", O_RDONLY) >= 0 || open("nc/g", O_RDONLY) >= 0){
+    printf(1, "namecache: open of unlinked file worked\n");
+    exit();
+  }
+  if((fd = open("nc/f", O_CREATE|O_RDWR)) < 0){
+    printf(1, "namecache: re-create nc/f failed\n");
+    exit();
+  }
+  close(fd);
+  if(unlink("nc/f") != 0 || unlink("nc") != 0){
+    printf(1, "namecache: unlink nc failed\n");
+    exit();
+  }
+  if(mkdir("nc") != 0){
+    printf(1, "namecache: mkdir nc again failed\n");
+    exit();
+  }
+  if(open("nc/f", O_RDONLY) >= 0){
+    printf(1, "namecache: new nc has old nc's f\n");
+    exit();
+  }
+  if(unlink("nc") != 0){
+    printf(1, "namecache: final unlink nc failed\n");
+    exit();
+  }
+  printf(1, "name cache ok\n");
+}
+
 void
 dirfile(void)
 {
@@ -1448,6 +1686,59 @@ sbrktest(void)
   printf(stdout, "sbrk test OK\n");
 }
 
+// The heap is allocated a page at a time on first touch: system
+// calls must fault in the pages they are handed, and touching
+// past the end of the heap must kill the process, not the kernel.
+void
+lazytest(void)
+{
+  int fds[2], pid, ppid;
+  char *a, *p, *oldbrk;
+
+  printf(stdout, "lazy sbrk test\n");
+  oldbrk = sbrk(0);
+  a = sbrk(8*1024*1024);
+  if(a == (char*)0xffffffff){
+    printf(stdout, "lazy sbrk failed\n");
+    exit();
+  }
+
+  // read() into a page nothing has touched yet, from a pipe
+  // whose copy loop runs holding a spinlock.
+  p = a + 4*1024*1024 + 4090;
+  if(pipe(fds) != 0){
+    printf(stdout, "pipe() failed\n");
+    exit();
+  }
+  write(fds[1], "lazy", 5);
+  if(read(fds[0], p, 5) != 5 || strcmp(p, "lazy") != 0){
+    printf(stdout, "read into lazy page failed\n");
+    exit();
+  }
+  close(fds[0]);
+  close(fds[1]);
+  if(a[8*1024*1024 - 1] != 0){
+    printf(stdout, "lazy page not zero\n");
+    exit();
+  }
+
+  sbrk(-(sbrk(0) - oldbrk));
+  ppid = getpid();
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    p[0] = 1;
+    printf(stdout, "oops could write freed heap at %x\n", p);
+    kill(ppid);
+    exit();
+  }
+  wait();
+  printf(stdout, "lazy sbrk test OK\n");
+}
+
 void
 validateint(int *p)
 {
@@ -1608,6 +1899,8 @@ rand()
 int
 main(int argc, char *argv[])
 {
+  if(argc > 1 && strcmp(argv[1], "-x") == 0)
+    exit();  // execbench times exec alone
   printf(1, "usertests starting\n");
 
   if(open("usertests.ran", 0) >= 0){
@@ -1621,19 +1914,25 @@ main(int argc, char *argv[])
   bigargtest();
   bsstest();
   sbrktest();
+  lazytest();
+  textbusytest();
   validatetest();
 
   opentest();
   writetest();
   writetest1();
+  writebench();
+  readbench();
   createtest();
 
   mem();
+  allocstress();
   pipe1();
   preempt();
   exitwait();
 
   rmdot();
+  namecache();
   fourteen();
   bigfile();
   subdir();
@@ -0,0 +1,1383 @@
+
+_uthread:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+}
+
+
+int 
+main(int argc, char *argv[]) 
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 10             	sub    $0x10,%esp
+  current_thread = &all_thread[0];
+  11:	c7 05 24 0d 00 00 40 	movl   $0xd40,0xd24
+  18:	0d 00 00 
+  current_thread->state = RUNNING;
+  1b:	c7 05 44 2d 00 00 01 	movl   $0x1,0x2d44
+  22:	00 00 00 
+  thread_init();
+  thread_create(mythread);
+  25:	68 e0 00 00 00       	push   $0xe0
+  2a:	e8 51 01 00 00       	call   180 <thread_create>
+  thread_create(mythread);
+  2f:	c7 04 24 e0 00 00 00 	movl   $0xe0,(%esp)
+  36:	e8 45 01 00 00       	call   180 <thread_create>
+  thread_schedule();
+  3b:	e8 10 00 00 00       	call   50 <thread_schedule>
+  return 0;
+}
+  40:	8b 4d fc             	mov    -0x4(%ebp),%ecx
+  43:	31 c0                	xor    %eax,%eax
+  45:	c9                   	leave
+  46:	8d 61 fc             	lea    -0x4(%ecx),%esp
+  49:	c3                   	ret
+  4a:	66 90                	xchg   %ax,%ax
+  4c:	66 90                	xchg   %ax,%ax
+  4e:	66 90                	xchg   %ax,%ax
+
+00000050 <thread_schedule>:
+    if (t->state == RUNNABLE && t != current_thread) {
+  50:	8b 15 24 0d 00 00    	mov    0xd24,%edx
+  for (t = all_thread; t < all_thread + MAX_THREAD; t++) {
+  56:	b8 40 0d 00 00       	mov    $0xd40,%eax
+    if (t->state == RUNNABLE && t != current_thread) {
+  5b:	83 b8 04 20 00 00 02 	cmpl   $0x2,0x2004(%eax)
+  62:	74 34                	je     98 <thread_schedule+0x48>
+  for (t = all_thread; t < all_thread + MAX_THREAD; t++) {
+  64:	05 08 20 00 00       	add    $0x2008,%eax
+  69:	3d 60 8d 00 00       	cmp    $0x8d60,%eax
+  6e:	75 eb                	jne    5b <thread_schedule+0xb>
+  if (t >= all_thread + MAX_THREAD && current_thread->state == RUNNABLE) {
+  70:	83 ba 04 20 00 00 02 	cmpl   $0x2,0x2004(%edx)
+  77:	74 38                	je     b1 <thread_schedule+0x61>
+  if (next_thread == 0) {
+  79:	a1 20 0d 00 00       	mov    0xd20,%eax
+  7e:	85 c0                	test   %eax,%eax
+  80:	74 3a                	je     bc <thread_schedule+0x6c>
+  if (current_thread != next_thread) {         /* switch threads?  */
+  82:	39 c2                	cmp    %eax,%edx
+  84:	74 2b                	je     b1 <thread_schedule+0x61>
+    next_thread->state = RUNNING;
+  86:	c7 80 04 20 00 00 01 	movl   $0x1,0x2004(%eax)
+  8d:	00 00 00 
+    thread_switch();
+  90:	e9 3f 01 00 00       	jmp    1d4 <thread_switch>
+  95:	8d 76 00             	lea    0x0(%esi),%esi
+    if (t->state == RUNNABLE && t != current_thread) {
+  98:	39 c2                	cmp    %eax,%edx
+  9a:	74 c8                	je     64 <thread_schedule+0x14>
+      next_thread = t;
+  9c:	a3 20 0d 00 00       	mov    %eax,0xd20
+  if (t >= all_thread + MAX_THREAD && current_thread->state == RUNNABLE) {
+  a1:	3d 60 8d 00 00       	cmp    $0x8d60,%eax
+  a6:	72 de                	jb     86 <thread_schedule+0x36>
+  a8:	83 ba 04 20 00 00 02 	cmpl   $0x2,0x2004(%edx)
+  af:	75 d1                	jne    82 <thread_schedule+0x32>
+    next_thread = 0;
+  b1:	c7 05 20 0d 00 00 00 	movl   $0x0,0xd20
+  b8:	00 00 00 
+  bb:	c3                   	ret
+{
+  bc:	55                   	push   %ebp
+  bd:	89 e5                	mov    %esp,%ebp
+  bf:	83 ec 10             	sub    $0x10,%esp
+    printf(2, "thread_schedule: no runnable threads; deadlock\n");
+  c2:	68 18 09 00 00       	push   $0x918
+  c7:	6a 02                	push   $0x2
+  c9:	e8 22 05 00 00       	call   5f0 <printf>
+    exit();
+  ce:	e8 70 03 00 00       	call   443 <exit>
+  d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000000e0 <mythread>:
+{
+  e0:	55                   	push   %ebp
+  e1:	89 e5                	mov    %esp,%ebp
+  e3:	53                   	push   %ebx
+  printf(1, "my thread running\n");
+  e4:	bb 64 00 00 00       	mov    $0x64,%ebx
+{
+  e9:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "my thread running\n");
+  ec:	68 48 09 00 00       	push   $0x948
+  f1:	6a 01                	push   $0x1
+  f3:	e8 f8 04 00 00       	call   5f0 <printf>
+  f8:	83 c4 10             	add    $0x10,%esp
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+    printf(1, "my thread 0x%x\n", (int) current_thread);
+ 100:	83 ec 04             	sub    $0x4,%esp
+ 103:	ff 35 24 0d 00 00    	push   0xd24
+ 109:	68 5b 09 00 00       	push   $0x95b
+ 10e:	6a 01                	push   $0x1
+ 110:	e8 db 04 00 00       	call   5f0 <printf>
+  current_thread->state = RUNNABLE;
+ 115:	a1 24 0d 00 00       	mov    0xd24,%eax
+ 11a:	c7 80 04 20 00 00 02 	movl   $0x2,0x2004(%eax)
+ 121:	00 00 00 
+  thread_schedule();
+ 124:	e8 27 ff ff ff       	call   50 <thread_schedule>
+  for (i = 0; i < 100; i++) {
+ 129:	83 c4 10             	add    $0x10,%esp
+ 12c:	83 eb 01             	sub    $0x1,%ebx
+ 12f:	75 cf                	jne    100 <mythread+0x20>
+  printf(1, "my thread: exit\n");
+ 131:	83 ec 08             	sub    $0x8,%esp
+ 134:	68 6b 09 00 00       	push   $0x96b
+ 139:	6a 01                	push   $0x1
+ 13b:	e8 b0 04 00 00       	call   5f0 <printf>
+  current_thread->state = FREE;
+ 140:	a1 24 0d 00 00       	mov    0xd24,%eax
+  thread_schedule();
+ 145:	83 c4 10             	add    $0x10,%esp
+  current_thread->state = FREE;
+ 148:	c7 80 04 20 00 00 00 	movl   $0x0,0x2004(%eax)
+ 14f:	00 00 00 
+}
+ 152:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 155:	c9                   	leave
+  thread_schedule();
+ 156:	e9 f5 fe ff ff       	jmp    50 <thread_schedule>
+ 15b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 15f:	90                   	nop
+
+00000160 <thread_init>:
+  current_thread = &all_thread[0];
+ 160:	c7 05 24 0d 00 00 40 	movl   $0xd40,0xd24
+ 167:	0d 00 00 
+  current_thread->state = RUNNING;
+ 16a:	c7 05 44 2d 00 00 01 	movl   $0x1,0x2d44
+ 171:	00 00 00 
+}
+ 174:	c3                   	ret
+ 175:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000180 <thread_create>:
+{
+ 180:	55                   	push   %ebp
+  for (t = all_thread; t < all_thread + MAX_THREAD; t++) {
+ 181:	b8 40 0d 00 00       	mov    $0xd40,%eax
+{
+ 186:	89 e5                	mov    %esp,%ebp
+    if (t->state == FREE) break;
+ 188:	8b 90 04 20 00 00    	mov    0x2004(%eax),%edx
+ 18e:	85 d2                	test   %edx,%edx
+ 190:	74 0c                	je     19e <thread_create+0x1e>
+  for (t = all_thread; t < all_thread + MAX_THREAD; t++) {
+ 192:	05 08 20 00 00       	add    $0x2008,%eax
+ 197:	3d 60 8d 00 00       	cmp    $0x8d60,%eax
+ 19c:	75 ea                	jne    188 <thread_create+0x8>
+  t->state = RUNNABLE;
+ 19e:	c7 80 04 20 00 00 02 	movl   $0x2,0x2004(%eax)
+ 1a5:	00 00 00 
+  t->sp -= 4;                              // space for return address
+ 1a8:	8d 90 00 20 00 00    	lea    0x2000(%eax),%edx
+ 1ae:	89 10                	mov    %edx,(%eax)
+  * (int *) (t->sp) = (int)func;           // push return address on stack
+ 1b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  t->sp -= 32;                             // space for registers that thread_switch will push
+ 1b3:	83 28 20             	subl   $0x20,(%eax)
+  * (int *) (t->sp) = (int)func;           // push return address on stack
+ 1b6:	89 90 00 20 00 00    	mov    %edx,0x2000(%eax)
+}
+ 1bc:	5d                   	pop    %ebp
+ 1bd:	c3                   	ret
+ 1be:	66 90                	xchg   %ax,%ax
+
+000001c0 <thread_yield>:
+  current_thread->state = RUNNABLE;
+ 1c0:	a1 24 0d 00 00       	mov    0xd24,%eax
+ 1c5:	c7 80 04 20 00 00 02 	movl   $0x2,0x2004(%eax)
+ 1cc:	00 00 00 
+  thread_schedule();
+ 1cf:	e9 7c fe ff ff       	jmp    50 <thread_schedule>
+
+000001d4 <thread_switch>:
+ * the current_thread, and set next_thread to 0.
+ * Use eax as a temporary register, which should be caller saved.
+ */
+	.globl thread_switch
+thread_switch:
+	pushal
+ 1d4:	60                   	pusha
+	movl current_thread, %eax
+ 1d5:	a1 24 0d 00 00       	mov    0xd24,%eax
+	movl %esp, (%eax)
+ 1da:	89 20                	mov    %esp,(%eax)
+
+	movl next_thread, %eax
+ 1dc:	a1 20 0d 00 00       	mov    0xd20,%eax
+	movl (%eax), %esp
+ 1e1:	8b 20                	mov    (%eax),%esp
+	
+	
+	movl %eax, current_thread
+ 1e3:	a3 24 0d 00 00       	mov    %eax,0xd24
+	movl $0, next_thread
+ 1e8:	c7 05 20 0d 00 00 00 	movl   $0x0,0xd20
+ 1ef:	00 00 00 
+
+	popal
+ 1f2:	61                   	popa
+	
+
+	ret
+ 1f3:	c3                   	ret
+ 1f4:	66 90                	xchg   %ax,%ax
+ 1f6:	66 90                	xchg   %ax,%ax
+ 1f8:	66 90                	xchg   %ax,%ax
+ 1fa:	66 90                	xchg   %ax,%ax
+ 1fc:	66 90                	xchg   %ax,%ax
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 200:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 201:	31 c0                	xor    %eax,%eax
+{
+ 203:	89 e5                	mov    %esp,%ebp
+ 205:	53                   	push   %ebx
+ 206:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 209:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 20c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 210:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 214:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 217:	83 c0 01             	add    $0x1,%eax
+ 21a:	84 d2                	test   %dl,%dl
+ 21c:	75 f2                	jne    210 <strcpy+0x10>
+    ;
+  return os;
+}
+ 21e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 221:	89 c8                	mov    %ecx,%eax
+ 223:	c9                   	leave
+ 224:	c3                   	ret
+ 225:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	53                   	push   %ebx
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+ 237:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 23a:	0f b6 02             	movzbl (%edx),%eax
+ 23d:	84 c0                	test   %al,%al
+ 23f:	75 17                	jne    258 <strcmp+0x28>
+ 241:	eb 3a                	jmp    27d <strcmp+0x4d>
+ 243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 247:	90                   	nop
+ 248:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 24c:	83 c2 01             	add    $0x1,%edx
+ 24f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 252:	84 c0                	test   %al,%al
+ 254:	74 1a                	je     270 <strcmp+0x40>
+    p++, q++;
+ 256:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 258:	0f b6 19             	movzbl (%ecx),%ebx
+ 25b:	38 c3                	cmp    %al,%bl
+ 25d:	74 e9                	je     248 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 25f:	29 d8                	sub    %ebx,%eax
+}
+ 261:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 264:	c9                   	leave
+ 265:	c3                   	ret
+ 266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 270:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 274:	31 c0                	xor    %eax,%eax
+ 276:	29 d8                	sub    %ebx,%eax
+}
+ 278:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 27b:	c9                   	leave
+ 27c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 27d:	0f b6 19             	movzbl (%ecx),%ebx
+ 280:	31 c0                	xor    %eax,%eax
+ 282:	eb db                	jmp    25f <strcmp+0x2f>
+ 284:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+
+00000290 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 296:	80 3a 00             	cmpb   $0x0,(%edx)
+ 299:	74 15                	je     2b0 <strlen+0x20>
+ 29b:	31 c0                	xor    %eax,%eax
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+ 2a0:	83 c0 01             	add    $0x1,%eax
+ 2a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2a7:	89 c1                	mov    %eax,%ecx
+ 2a9:	75 f5                	jne    2a0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2ab:	89 c8                	mov    %ecx,%eax
+ 2ad:	5d                   	pop    %ebp
+ 2ae:	c3                   	ret
+ 2af:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2b0:	31 c9                	xor    %ecx,%ecx
+}
+ 2b2:	5d                   	pop    %ebp
+ 2b3:	89 c8                	mov    %ecx,%eax
+ 2b5:	c3                   	ret
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	57                   	push   %edi
+ 2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2cd:	89 d7                	mov    %edx,%edi
+ 2cf:	fc                   	cld
+ 2d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2d5:	89 d0                	mov    %edx,%eax
+ 2d7:	c9                   	leave
+ 2d8:	c3                   	ret
+ 2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2ea:	0f b6 10             	movzbl (%eax),%edx
+ 2ed:	84 d2                	test   %dl,%dl
+ 2ef:	75 12                	jne    303 <strchr+0x23>
+ 2f1:	eb 1d                	jmp    310 <strchr+0x30>
+ 2f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2f7:	90                   	nop
+ 2f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2fc:	83 c0 01             	add    $0x1,%eax
+ 2ff:	84 d2                	test   %dl,%dl
+ 301:	74 0d                	je     310 <strchr+0x30>
+    if(*s == c)
+ 303:	38 d1                	cmp    %dl,%cl
+ 305:	75 f1                	jne    2f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 307:	5d                   	pop    %ebp
+ 308:	c3                   	ret
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 310:	31 c0                	xor    %eax,%eax
+}
+ 312:	5d                   	pop    %ebp
+ 313:	c3                   	ret
+ 314:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+
+00000320 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 325:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 328:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 329:	31 db                	xor    %ebx,%ebx
+{
+ 32b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 32e:	eb 27                	jmp    357 <gets+0x37>
+    cc = read(0, &c, 1);
+ 330:	83 ec 04             	sub    $0x4,%esp
+ 333:	6a 01                	push   $0x1
+ 335:	56                   	push   %esi
+ 336:	6a 00                	push   $0x0
+ 338:	e8 1e 01 00 00       	call   45b <read>
+    if(cc < 1)
+ 33d:	83 c4 10             	add    $0x10,%esp
+ 340:	85 c0                	test   %eax,%eax
+ 342:	7e 1d                	jle    361 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 344:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 348:	8b 55 08             	mov    0x8(%ebp),%edx
+ 34b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 34f:	3c 0a                	cmp    $0xa,%al
+ 351:	74 10                	je     363 <gets+0x43>
+ 353:	3c 0d                	cmp    $0xd,%al
+ 355:	74 0c                	je     363 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 357:	89 df                	mov    %ebx,%edi
+ 359:	83 c3 01             	add    $0x1,%ebx
+ 35c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 35f:	7c cf                	jl     330 <gets+0x10>
+ 361:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 363:	8b 45 08             	mov    0x8(%ebp),%eax
+ 366:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 36a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 36d:	5b                   	pop    %ebx
+ 36e:	5e                   	pop    %esi
+ 36f:	5f                   	pop    %edi
+ 370:	5d                   	pop    %ebp
+ 371:	c3                   	ret
+ 372:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	56                   	push   %esi
+ 384:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 385:	83 ec 08             	sub    $0x8,%esp
+ 388:	6a 00                	push   $0x0
+ 38a:	ff 75 08             	push   0x8(%ebp)
+ 38d:	e8 f1 00 00 00       	call   483 <open>
+  if(fd < 0)
+ 392:	83 c4 10             	add    $0x10,%esp
+ 395:	85 c0                	test   %eax,%eax
+ 397:	78 27                	js     3c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 399:	83 ec 08             	sub    $0x8,%esp
+ 39c:	ff 75 0c             	push   0xc(%ebp)
+ 39f:	89 c3                	mov    %eax,%ebx
+ 3a1:	50                   	push   %eax
+ 3a2:	e8 f4 00 00 00       	call   49b <fstat>
+  close(fd);
+ 3a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3ac:	e8 ba 00 00 00       	call   46b <close>
+  return r;
+ 3b1:	83 c4 10             	add    $0x10,%esp
+}
+ 3b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3b7:	89 f0                	mov    %esi,%eax
+ 3b9:	5b                   	pop    %ebx
+ 3ba:	5e                   	pop    %esi
+ 3bb:	5d                   	pop    %ebp
+ 3bc:	c3                   	ret
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3c5:	eb ed                	jmp    3b4 <stat+0x34>
+ 3c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ce:	66 90                	xchg   %ax,%ax
+
+000003d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3d7:	0f be 02             	movsbl (%edx),%eax
+ 3da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3e5:	77 1e                	ja     405 <atoi+0x35>
+ 3e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3f0:	83 c2 01             	add    $0x1,%edx
+ 3f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3fa:	0f be 02             	movsbl (%edx),%eax
+ 3fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 400:	80 fb 09             	cmp    $0x9,%bl
+ 403:	76 eb                	jbe    3f0 <atoi+0x20>
+  return n;
+}
+ 405:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 408:	89 c8                	mov    %ecx,%eax
+ 40a:	c9                   	leave
+ 40b:	c3                   	ret
+ 40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	56                   	push   %esi
+ 415:	8b 45 10             	mov    0x10(%ebp),%eax
+ 418:	8b 55 08             	mov    0x8(%ebp),%edx
+ 41b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 41e:	85 c0                	test   %eax,%eax
+ 420:	7e 13                	jle    435 <memmove+0x25>
+ 422:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 424:	89 d7                	mov    %edx,%edi
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 430:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 431:	39 f8                	cmp    %edi,%eax
+ 433:	75 fb                	jne    430 <memmove+0x20>
+  return vdst;
+}
+ 435:	5e                   	pop    %esi
+ 436:	89 d0                	mov    %edx,%eax
+ 438:	5f                   	pop    %edi
+ 439:	5d                   	pop    %ebp
+ 43a:	c3                   	ret
+
+0000043b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 43b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <exit>:
+SYSCALL(exit)
+ 443:	b8 02 00 00 00       	mov    $0x2,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <wait>:
+SYSCALL(wait)
+ 44b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <pipe>:
+SYSCALL(pipe)
+ 453:	b8 04 00 00 00       	mov    $0x4,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <read>:
+SYSCALL(read)
+ 45b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <write>:
+SYSCALL(write)
+ 463:	b8 10 00 00 00       	mov    $0x10,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <close>:
+SYSCALL(close)
+ 46b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <kill>:
+SYSCALL(kill)
+ 473:	b8 06 00 00 00       	mov    $0x6,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <exec>:
+SYSCALL(exec)
+ 47b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <open>:
+SYSCALL(open)
+ 483:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <mknod>:
+SYSCALL(mknod)
+ 48b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <unlink>:
+SYSCALL(unlink)
+ 493:	b8 12 00 00 00       	mov    $0x12,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <fstat>:
+SYSCALL(fstat)
+ 49b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <link>:
+SYSCALL(link)
+ 4a3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <mkdir>:
+SYSCALL(mkdir)
+ 4ab:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <chdir>:
+SYSCALL(chdir)
+ 4b3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <dup>:
+SYSCALL(dup)
+ 4bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <getpid>:
+SYSCALL(getpid)
+ 4c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <sbrk>:
+SYSCALL(sbrk)
+ 4cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <sleep>:
+SYSCALL(sleep)
+ 4d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <uptime>:
+SYSCALL(uptime)
+ 4db:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <trace>:
+SYSCALL(trace)
+ 4e3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <csinfo>:
+SYSCALL(csinfo)
+ 4eb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <settickets>:
+SYSCALL(settickets)
+ 4f3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <getprocessesinfo>:
+SYSCALL(getprocessesinfo)
+ 4fb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <yield>:
+SYSCALL(yield)
+ 503:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <random>:
+SYSCALL(random)
+ 50b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <dumppagetable>:
+SYSCALL(dumppagetable)
+ 513:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <getcpusinfo>:
+SYSCALL(getcpusinfo)
+ 51b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <setsched>:
+SYSCALL(setsched)
+ 523:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <getbcacheinfo>:
+SYSCALL(getbcacheinfo)
+ 52b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <getballocinfo>:
+SYSCALL(getballocinfo)
+ 533:	b8 20 00 00 00       	mov    $0x20,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <getfaultinfo>:
+SYSCALL(getfaultinfo)
+ 53b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+ 543:	66 90                	xchg   %ax,%ax
+ 545:	66 90                	xchg   %ax,%ax
+ 547:	66 90                	xchg   %ax,%ax
+ 549:	66 90                	xchg   %ax,%ax
+ 54b:	66 90                	xchg   %ax,%ax
+ 54d:	66 90                	xchg   %ax,%ax
+ 54f:	90                   	nop
+
+00000550 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 558:	89 d1                	mov    %edx,%ecx
+{
+ 55a:	83 ec 3c             	sub    $0x3c,%esp
+ 55d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 560:	85 d2                	test   %edx,%edx
+ 562:	0f 89 80 00 00 00    	jns    5e8 <printint+0x98>
+ 568:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 56c:	74 7a                	je     5e8 <printint+0x98>
+    x = -xx;
+ 56e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 570:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 575:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 578:	31 f6                	xor    %esi,%esi
+ 57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 580:	89 c8                	mov    %ecx,%eax
+ 582:	31 d2                	xor    %edx,%edx
+ 584:	89 f7                	mov    %esi,%edi
+ 586:	f7 f3                	div    %ebx
+ 588:	8d 76 01             	lea    0x1(%esi),%esi
+ 58b:	0f b6 92 dc 09 00 00 	movzbl 0x9dc(%edx),%edx
+ 592:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 596:	89 ca                	mov    %ecx,%edx
+ 598:	89 c1                	mov    %eax,%ecx
+ 59a:	39 da                	cmp    %ebx,%edx
+ 59c:	73 e2                	jae    580 <printint+0x30>
+  if(neg)
+ 59e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5a1:	85 c0                	test   %eax,%eax
+ 5a3:	74 07                	je     5ac <printint+0x5c>
+    buf[i++] = '-';
+ 5a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5aa:	89 f7                	mov    %esi,%edi
+ 5ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5b2:	01 df                	add    %ebx,%edi
+ 5b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5bb:	83 ec 04             	sub    $0x4,%esp
+ 5be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5c4:	6a 01                	push   $0x1
+ 5c6:	50                   	push   %eax
+ 5c7:	56                   	push   %esi
+ 5c8:	e8 96 fe ff ff       	call   463 <write>
+  while(--i >= 0)
+ 5cd:	89 f8                	mov    %edi,%eax
+ 5cf:	83 c4 10             	add    $0x10,%esp
+ 5d2:	83 ef 01             	sub    $0x1,%edi
+ 5d5:	39 d8                	cmp    %ebx,%eax
+ 5d7:	75 df                	jne    5b8 <printint+0x68>
+}
+ 5d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5dc:	5b                   	pop    %ebx
+ 5dd:	5e                   	pop    %esi
+ 5de:	5f                   	pop    %edi
+ 5df:	5d                   	pop    %ebp
+ 5e0:	c3                   	ret
+ 5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5e8:	31 c0                	xor    %eax,%eax
+ 5ea:	eb 89                	jmp    575 <printint+0x25>
+ 5ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	56                   	push   %esi
+ 5f5:	53                   	push   %ebx
+ 5f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 602:	83 c6 01             	add    $0x1,%esi
+ 605:	84 db                	test   %bl,%bl
+ 607:	74 67                	je     670 <printf+0x80>
+ 609:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 60c:	31 d2                	xor    %edx,%edx
+ 60e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 611:	eb 34                	jmp    647 <printf+0x57>
+ 613:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 617:	90                   	nop
+ 618:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 61b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 620:	83 f8 25             	cmp    $0x25,%eax
+ 623:	74 18                	je     63d <printf+0x4d>
+  write(fd, &c, 1);
+ 625:	83 ec 04             	sub    $0x4,%esp
+ 628:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 62b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 62e:	6a 01                	push   $0x1
+ 630:	50                   	push   %eax
+ 631:	57                   	push   %edi
+ 632:	e8 2c fe ff ff       	call   463 <write>
+ 637:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 63a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 63d:	0f b6 1e             	movzbl (%esi),%ebx
+ 640:	83 c6 01             	add    $0x1,%esi
+ 643:	84 db                	test   %bl,%bl
+ 645:	74 29                	je     670 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 647:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 64a:	85 d2                	test   %edx,%edx
+ 64c:	74 ca                	je     618 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 64e:	83 fa 25             	cmp    $0x25,%edx
+ 651:	75 ea                	jne    63d <printf+0x4d>
+      if(c == 'd'){
+ 653:	83 f8 25             	cmp    $0x25,%eax
+ 656:	0f 84 24 01 00 00    	je     780 <printf+0x190>
+ 65c:	83 e8 63             	sub    $0x63,%eax
+ 65f:	83 f8 15             	cmp    $0x15,%eax
+ 662:	77 1c                	ja     680 <printf+0x90>
+ 664:	ff 24 85 84 09 00 00 	jmp    *0x984(,%eax,4)
+ 66b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 66f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 670:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 673:	5b                   	pop    %ebx
+ 674:	5e                   	pop    %esi
+ 675:	5f                   	pop    %edi
+ 676:	5d                   	pop    %ebp
+ 677:	c3                   	ret
+ 678:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+  write(fd, &c, 1);
+ 680:	83 ec 04             	sub    $0x4,%esp
+ 683:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 686:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 68a:	6a 01                	push   $0x1
+ 68c:	52                   	push   %edx
+ 68d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 690:	57                   	push   %edi
+ 691:	e8 cd fd ff ff       	call   463 <write>
+ 696:	83 c4 0c             	add    $0xc,%esp
+ 699:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 69c:	6a 01                	push   $0x1
+ 69e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6a1:	52                   	push   %edx
+ 6a2:	57                   	push   %edi
+ 6a3:	e8 bb fd ff ff       	call   463 <write>
+        putc(fd, c);
+ 6a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ab:	31 d2                	xor    %edx,%edx
+ 6ad:	eb 8e                	jmp    63d <printf+0x4d>
+ 6af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6b3:	83 ec 0c             	sub    $0xc,%esp
+ 6b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6bb:	8b 13                	mov    (%ebx),%edx
+ 6bd:	6a 00                	push   $0x0
+ 6bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6c4:	e8 87 fe ff ff       	call   550 <printint>
+        ap++;
+ 6c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6cf:	31 d2                	xor    %edx,%edx
+ 6d1:	e9 67 ff ff ff       	jmp    63d <printf+0x4d>
+ 6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6e5:	83 c0 04             	add    $0x4,%eax
+ 6e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6eb:	85 db                	test   %ebx,%ebx
+ 6ed:	0f 84 9d 00 00 00    	je     790 <printf+0x1a0>
+        while(*s != 0){
+ 6f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6f8:	84 c0                	test   %al,%al
+ 6fa:	0f 84 3d ff ff ff    	je     63d <printf+0x4d>
+ 700:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 703:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 706:	89 de                	mov    %ebx,%esi
+ 708:	89 d3                	mov    %edx,%ebx
+ 70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 716:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 719:	6a 01                	push   $0x1
+ 71b:	53                   	push   %ebx
+ 71c:	57                   	push   %edi
+ 71d:	e8 41 fd ff ff       	call   463 <write>
+        while(*s != 0){
+ 722:	0f b6 06             	movzbl (%esi),%eax
+ 725:	83 c4 10             	add    $0x10,%esp
+ 728:	84 c0                	test   %al,%al
+ 72a:	75 e4                	jne    710 <printf+0x120>
+      state = 0;
+ 72c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 72f:	31 d2                	xor    %edx,%edx
+ 731:	e9 07 ff ff ff       	jmp    63d <printf+0x4d>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 740:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 74b:	8b 13                	mov    (%ebx),%edx
+ 74d:	6a 01                	push   $0x1
+ 74f:	e9 6b ff ff ff       	jmp    6bf <printf+0xcf>
+ 754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 758:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 75b:	83 ec 04             	sub    $0x4,%esp
+ 75e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 761:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 763:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 766:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 769:	6a 01                	push   $0x1
+ 76b:	52                   	push   %edx
+ 76c:	57                   	push   %edi
+ 76d:	e8 f1 fc ff ff       	call   463 <write>
+        ap++;
+ 772:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 775:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 778:	31 d2                	xor    %edx,%edx
+ 77a:	e9 be fe ff ff       	jmp    63d <printf+0x4d>
+ 77f:	90                   	nop
+  write(fd, &c, 1);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 786:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 789:	6a 01                	push   $0x1
+ 78b:	e9 11 ff ff ff       	jmp    6a1 <printf+0xb1>
+ 790:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 795:	bb 7c 09 00 00       	mov    $0x97c,%ebx
+ 79a:	e9 61 ff ff ff       	jmp    700 <printf+0x110>
+ 79f:	90                   	nop
+
+000007a0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7a1:	a1 60 8d 00 00       	mov    0x8d60,%eax
+{
+ 7a6:	89 e5                	mov    %esp,%ebp
+ 7a8:	57                   	push   %edi
+ 7a9:	56                   	push   %esi
+ 7aa:	53                   	push   %ebx
+ 7ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7ae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7b8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7ba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7bc:	39 ca                	cmp    %ecx,%edx
+ 7be:	73 30                	jae    7f0 <free+0x50>
+ 7c0:	39 c1                	cmp    %eax,%ecx
+ 7c2:	72 04                	jb     7c8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7c4:	39 c2                	cmp    %eax,%edx
+ 7c6:	72 f0                	jb     7b8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7c8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7cb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7ce:	39 f8                	cmp    %edi,%eax
+ 7d0:	74 2e                	je     800 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7d2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7d5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7d8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7db:	39 f1                	cmp    %esi,%ecx
+ 7dd:	74 38                	je     817 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7df:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7e1:	5b                   	pop    %ebx
+  freep = p;
+ 7e2:	89 15 60 8d 00 00    	mov    %edx,0x8d60
+}
+ 7e8:	5e                   	pop    %esi
+ 7e9:	5f                   	pop    %edi
+ 7ea:	5d                   	pop    %ebp
+ 7eb:	c3                   	ret
+ 7ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7f0:	39 c1                	cmp    %eax,%ecx
+ 7f2:	72 d0                	jb     7c4 <free+0x24>
+ 7f4:	eb c2                	jmp    7b8 <free+0x18>
+ 7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 800:	03 70 04             	add    0x4(%eax),%esi
+ 803:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 806:	8b 02                	mov    (%edx),%eax
+ 808:	8b 00                	mov    (%eax),%eax
+ 80a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 80d:	8b 42 04             	mov    0x4(%edx),%eax
+ 810:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 813:	39 f1                	cmp    %esi,%ecx
+ 815:	75 c8                	jne    7df <free+0x3f>
+    p->s.size += bp->s.size;
+ 817:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 81a:	89 15 60 8d 00 00    	mov    %edx,0x8d60
+    p->s.size += bp->s.size;
+ 820:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 823:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 826:	89 0a                	mov    %ecx,(%edx)
+}
+ 828:	5b                   	pop    %ebx
+ 829:	5e                   	pop    %esi
+ 82a:	5f                   	pop    %edi
+ 82b:	5d                   	pop    %ebp
+ 82c:	c3                   	ret
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000830 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	57                   	push   %edi
+ 834:	56                   	push   %esi
+ 835:	53                   	push   %ebx
+ 836:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 839:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 83c:	8b 15 60 8d 00 00    	mov    0x8d60,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 842:	8d 78 07             	lea    0x7(%eax),%edi
+ 845:	c1 ef 03             	shr    $0x3,%edi
+ 848:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 84b:	85 d2                	test   %edx,%edx
+ 84d:	0f 84 8d 00 00 00    	je     8e0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 853:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 855:	8b 48 04             	mov    0x4(%eax),%ecx
+ 858:	39 f9                	cmp    %edi,%ecx
+ 85a:	73 64                	jae    8c0 <malloc+0x90>
+  if(nu < 4096)
+ 85c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 861:	39 df                	cmp    %ebx,%edi
+ 863:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 866:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 86d:	eb 0a                	jmp    879 <malloc+0x49>
+ 86f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 870:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 872:	8b 48 04             	mov    0x4(%eax),%ecx
+ 875:	39 f9                	cmp    %edi,%ecx
+ 877:	73 47                	jae    8c0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 879:	89 c2                	mov    %eax,%edx
+ 87b:	39 05 60 8d 00 00    	cmp    %eax,0x8d60
+ 881:	75 ed                	jne    870 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 883:	83 ec 0c             	sub    $0xc,%esp
+ 886:	56                   	push   %esi
+ 887:	e8 3f fc ff ff       	call   4cb <sbrk>
+  if(p == (char*)-1)
+ 88c:	83 c4 10             	add    $0x10,%esp
+ 88f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 892:	74 1c                	je     8b0 <malloc+0x80>
+  hp->s.size = nu;
+ 894:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 897:	83 ec 0c             	sub    $0xc,%esp
+ 89a:	83 c0 08             	add    $0x8,%eax
+ 89d:	50                   	push   %eax
+ 89e:	e8 fd fe ff ff       	call   7a0 <free>
+  return freep;
+ 8a3:	8b 15 60 8d 00 00    	mov    0x8d60,%edx
+      if((p = morecore(nunits)) == 0)
+ 8a9:	83 c4 10             	add    $0x10,%esp
+ 8ac:	85 d2                	test   %edx,%edx
+ 8ae:	75 c0                	jne    870 <malloc+0x40>
+        return 0;
+  }
+}
+ 8b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8b3:	31 c0                	xor    %eax,%eax
+}
+ 8b5:	5b                   	pop    %ebx
+ 8b6:	5e                   	pop    %esi
+ 8b7:	5f                   	pop    %edi
+ 8b8:	5d                   	pop    %ebp
+ 8b9:	c3                   	ret
+ 8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8c0:	39 cf                	cmp    %ecx,%edi
+ 8c2:	74 4c                	je     910 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8c4:	29 f9                	sub    %edi,%ecx
+ 8c6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8c9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8cc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8cf:	89 15 60 8d 00 00    	mov    %edx,0x8d60
+}
+ 8d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8d8:	83 c0 08             	add    $0x8,%eax
+}
+ 8db:	5b                   	pop    %ebx
+ 8dc:	5e                   	pop    %esi
+ 8dd:	5f                   	pop    %edi
+ 8de:	5d                   	pop    %ebp
+ 8df:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8e0:	c7 05 60 8d 00 00 64 	movl   $0x8d64,0x8d60
+ 8e7:	8d 00 00 
+    base.s.size = 0;
+ 8ea:	b8 64 8d 00 00       	mov    $0x8d64,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8ef:	c7 05 64 8d 00 00 64 	movl   $0x8d64,0x8d64
+ 8f6:	8d 00 00 
+    base.s.size = 0;
+ 8f9:	c7 05 68 8d 00 00 00 	movl   $0x0,0x8d68
+ 900:	00 00 00 
+    if(p->s.size >= nunits){
+ 903:	e9 54 ff ff ff       	jmp    85c <malloc+0x2c>
+ 908:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 910:	8b 08                	mov    (%eax),%ecx
+ 912:	89 0a                	mov    %ecx,(%edx)
+ 914:	eb b9                	jmp    8cf <malloc+0x9f>
@@ -4,12 +4,27 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "elf.h"
+#include "fs.h"
+#include "sleeplock.h"
+#include "file.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
 
+#define TLBBATCH 32  // max pages flushed one by one before reloading cr3
+
+// User pages whose PTEs changed and must leave the TLB.
+// A page table is only ever loaded on the CPU running its
+// process (switchkvm/switchuvm reload cr3 on every switch),
+// so flushing the local TLB is enough.
+struct tlbbatch {
+  int n;
+  uint va[TLBBATCH];
+};
+
 // Set up CPU's kernel segment descriptors.
 // Run once on entry on each CPU.
 void
@@ -51,10 +66,9 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   if(*pde & PTE_P){
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
-      return 0;
     // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
+    if(!alloc || (pgtab = (pte_t*)kalloc_zeroed()) == 0)
+      return 0;
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -88,6 +102,35 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
   return 0;
 }
 
+// Record that the PTE for va changed.
+static void
+tlbadd(struct tlbbatch *b, uint va)
+{
+  if(b->n < TLBBATCH)
+    b->va[b->n] = va;
+  b->n++;
+}
+
+// Flush the pages recorded in b if pgdir is the live page
+// table: page by page while the batch is small, otherwise
+// with a single cr3 reload.
+static void
+tlbflush(pde_t *pgdir, struct tlbbatch *b)
+{
+  int i;
+
+  if(b->n == 0 || proc == 0 || pgdir != proc->pgdir){
+    b->n = 0;
+    return;
+  }
+  if(b->n > TLBBATCH)
+    lcr3(V2P(pgdir));
+  else
+    for(i = 0; i < b->n; i++)
+      invlpg((void*)b->va[i]);
+  b->n = 0;
+}
+
 // There is one page table per process, plus one that's used when
 // a CPU is not running any process (kpgdir). The kernel uses the
 // current process's page table during system calls and interrupts;
@@ -130,9 +173,8 @@ setupkvm(void)
   pde_t *pgdir;
   struct kmap *k;
 
-  if((pgdir = (pde_t*)kalloc()) == 0)
+  if((pgdir = (pde_t*)kalloc_zeroed()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
   if (P2V(PHYSTOP) > (void*)DEVSPACE)
     panic("PHYSTOP too high");
   for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
@@ -187,8 +229,7 @@ inituvm(pde_t *pgdir, char *init, uint sz)
 
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = kalloc();
-  memset(mem, 0, PGSIZE);
+  mem = kalloc_zeroed();
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
   memmove(mem, init, sz);
 }
@@ -217,6 +258,172 @@ loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
   return 0;
 }
 
+// Pages of program files, shared read-only by every process
+// that runs the program.  A process that writes to one gets a
+// private copy from copyOnWrite(), since the cache's reference
+// keeps the page shared.  Direct-mapped on (dev, inum, off): a
+// new page evicts whatever was in its slot.  The last page of a
+// segment holds fewer than PGSIZE bytes of the file and zeros
+// after them, so the number of bytes is part of the key.
+//
+// Inodes with pages here have I_TEXT set; writei() and itrunc()
+// call textpurge() so no process sees a stale page after the
+// file changes, and so does iget() before it recycles the
+// inode's cache entry and loses the flag.
+struct textpage {
+  uint dev;
+  uint inum;
+  uint off;      // File offset of the page's first byte
+  uint n;        // Bytes of the file in it; 0 if the slot is free
+  char *mem;
+};
+
+struct {
+  struct spinlock lock;
+  struct textpage page[NTEXT];
+} textcache;
+
+void
+textinit(void)
+{
+  initlock(&textcache.lock, "textcache");
+}
+
+static struct textpage*
+textslot(uint dev, uint inum, uint off)
+{
+  return &textcache.page[(dev*31 + inum*131 + off/PGSIZE) % NTEXT];
+}
+
+// Return the cached page of ip holding n bytes at off, with a
+// reference for the caller, reading it in if necessary.
+// Caller must hold ip's lock.
+static char*
+textpage(struct inode *ip, uint off, uint n)
+{
+  struct textpage *t;
+  char *mem, *old;
+
+  acquire(&textcache.lock);
+  t = textslot(ip->dev, ip->inum, off);
+  if(t->n == n && t->dev == ip->dev && t->inum == ip->inum && t->off == off){
+    mem = t->mem;
+    increment_refcount(V2P(mem));
+    release(&textcache.lock);
+    return mem;
+  }
+  release(&textcache.lock);
+
+  if((mem = kalloc()) == 0)
+    return 0;
+  if(n < PGSIZE)
+    memset(mem + n, 0, PGSIZE - n);
+  if(readi(ip, mem, off, n) != n){
+    kfree(mem);
+    return 0;
+  }
+
+  // Another process running the program may have read the
+  // same page meanwhile; the inode lock keeps it from having
+  // put in a different version of it.
+  acquire(&textcache.lock);
+  old = t->n ? t->mem : 0;
+  t->dev = ip->dev;
+  t->inum = ip->inum;
+  t->off = off;
+  t->n = n;
+  t->mem = mem;
+  increment_refcount(V2P(mem));
+  release(&textcache.lock);
+  ip->flags |= I_TEXT;
+  if(old)
+    kfree(old);
+  return mem;
+}
+
+// Drop the cached pages of inode inum on dev.  Processes that
+// have them mapped keep their references.
+void
+textpurge(uint dev, uint inum)
+{
+  struct textpage *t;
+
+  acquire(&textcache.lock);
+  for(t = textcache.page; t < &textcache.page[NTEXT]; t++){
+    if(t->n && t->dev == dev && t->inum == inum){
+      t->n = 0;
+      kfree(t->mem);
+    }
+  }
+  release(&textcache.lock);
+}
+
+// Map the page holding va if it holds part of the file content
+// of one of p's segments and is not mapped yet.  The page comes
+// from the text cache, read-only.  (The rest of a segment, the
+// bss, is zero-filled like the heap, see pagefault().)  Returns
+// 1 if it mapped a page, 0 if there was nothing to do, -1 if out
+// of memory or the read failed.  Sleeps, so the caller must hold no spinlock
+// and no inode lock; see prefault().
+int
+loadpage(struct proc *p, uint va)
+{
+  struct segment *s;
+  pte_t *pte;
+  char *mem;
+  uint a, off, n;
+
+  if(p->exe == 0 || va >= p->sz)
+    return 0;
+  a = PGROUNDDOWN(va);
+  for(s = p->seg; s < &p->seg[NSEG]; s++)
+    if(s->filesz && a >= s->va && a - s->va < s->filesz)
+      break;
+  if(s == &p->seg[NSEG])
+    return 0;
+  if((pte = walkpgdir(p->pgdir, (char*)a, 0)) != 0 && (*pte & PTE_P))
+    return 0;
+
+  off = a - s->va;
+  n = s->filesz - off;
+  if(n > PGSIZE)
+    n = PGSIZE;
+  ilock(p->exe);
+  mem = textpage(p->exe, s->off + off, n);
+  iunlock(p->exe);
+  if(mem == 0)
+    return -1;
+  if(mappages(p->pgdir, (char*)a, PGSIZE, V2P(mem), PTE_U) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 1;
+}
+
+// Fault in the pages of [va, va+n) that p has not touched yet,
+// and make them writable if write is set.  System calls do this
+// to user buffers up front, because they touch them holding
+// locks, and reading a page in from the program file or copying
+// a shared page from there could sleep in a spinlock, take
+// inode locks in the wrong order, or run out of memory with no
+// way to fail.  p must be the current process.
+int
+prefault(struct proc *p, uint va, uint n, int write)
+{
+  uint a, last;
+
+  if(n == 0)
+    return 0;
+  last = PGROUNDDOWN(va + n - 1);
+  for(a = PGROUNDDOWN(va); ; a += PGSIZE){
+    if(pagefault(a, write) < 0)
+      return -1;
+    if(a == last)
+      break;
+  }
+  return 0;
+}
+
 // Allocate page tables and physical memory to grow process from oldsz to
 // newsz, which need not be page aligned.  Returns new size or 0 on error.
 int
@@ -232,13 +439,12 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    mem = kalloc_zeroed();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
     if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
       cprintf("allocuvm out of memory (2)\n");
       deallocuvm(pgdir, newsz, oldsz);
@@ -258,15 +464,17 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
   pte_t *pte;
   uint a, pa;
+  struct tlbbatch tlb;
 
   if(newsz >= oldsz)
     return oldsz;
 
+  tlb.n = 0;
   a = PGROUNDUP(newsz);
   for(; a  < oldsz; a += PGSIZE){
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
-      a += (NPTENTRIES - 1) * PGSIZE;
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;  // no page table: skip it
     else if((*pte & PTE_P) != 0){
       pa = PTE_ADDR(*pte);
       if(pa == 0)
@@ -274,8 +482,10 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
       char *v = P2V(pa);
       kfree(v);
       *pte = 0;
+      tlbadd(&tlb, a);
     }
   }
+  tlbflush(pgdir, &tlb);
   return newsz;
 }
 
@@ -352,10 +562,12 @@ copyuvm(pde_t *pgdir, uint sz)
   pde_t *d;
   pte_t *pte;
   uint pa, i, flags;
+  struct tlbbatch tlb;
   //char *mem;
 
   if((d = setupkvm()) == 0)
     return 0;
+  tlb.n = 0;
   for(i = 0; i < sz; i += PGSIZE){
     if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
 	continue;      
@@ -366,7 +578,10 @@ copyuvm(pde_t *pgdir, uint sz)
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
     flags &= ~ PTE_W;
-    *pte &= ~ PTE_W;
+    if(*pte & PTE_W){
+      *pte &= ~ PTE_W;
+      tlbadd(&tlb, i);
+    }
     //if((mem = kalloc()) == 0)
       //goto bad;
     //memmove(mem, (char*)P2V(pa), PGSIZE);
@@ -375,11 +590,11 @@ copyuvm(pde_t *pgdir, uint sz)
     increment_refcount(pa);
   }
 
-  lcr3(V2P(pgdir));
+  tlbflush(pgdir, &tlb);
   return d;
 
 bad:
-  lcr3(V2P(pgdir));
+  tlbflush(pgdir, &tlb);
   freevm(d);
   return 0;
 }
@@ -393,7 +608,7 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
@@ -402,7 +617,9 @@ uva2ka(pde_t *pgdir, char *uva)
 
 // Copy len bytes from p to user address va in page table pgdir.
 // Most useful when pgdir is not the current page table.
-// uva2ka ensures this only works for PTE_U pages.
+// uva2ka ensures this only works for PTE_U pages.  In the
+// current process's page table, pages not touched yet are
+// faulted in and shared pages copied first.
 int
 copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
@@ -412,6 +629,8 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    if(proc && pgdir == proc->pgdir && pagefault(va0, 1) < 0)
+      return -1;
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;
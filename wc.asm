@@ -0,0 +1,1342 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 28                	jg     51 <main+0x51>
+  29:	eb 54                	jmp    7f <main+0x7f>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+  35:	83 c6 01             	add    $0x1,%esi
+  38:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+  3b:	50                   	push   %eax
+  3c:	e8 5f 00 00 00       	call   a0 <wc>
+    close(fd);
+  41:	89 3c 24             	mov    %edi,(%esp)
+  44:	e8 a2 03 00 00       	call   3eb <close>
+  for(i = 1; i < argc; i++){
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4f:	74 29                	je     7a <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+  51:	83 ec 08             	sub    $0x8,%esp
+  54:	6a 00                	push   $0x0
+  56:	ff 33                	push   (%ebx)
+  58:	e8 a6 03 00 00       	call   403 <open>
+  5d:	83 c4 10             	add    $0x10,%esp
+  60:	89 c7                	mov    %eax,%edi
+  62:	85 c0                	test   %eax,%eax
+  64:	79 ca                	jns    30 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+  66:	50                   	push   %eax
+  67:	ff 33                	push   (%ebx)
+  69:	68 bb 08 00 00       	push   $0x8bb
+  6e:	6a 01                	push   $0x1
+  70:	e8 fb 04 00 00       	call   570 <printf>
+      exit();
+  75:	e8 49 03 00 00       	call   3c3 <exit>
+  }
+  exit();
+  7a:	e8 44 03 00 00       	call   3c3 <exit>
+    wc(0, "");
+  7f:	52                   	push   %edx
+  80:	52                   	push   %edx
+  81:	68 ad 08 00 00       	push   $0x8ad
+  86:	6a 00                	push   $0x0
+  88:	e8 13 00 00 00       	call   a0 <wc>
+    exit();
+  8d:	e8 31 03 00 00       	call   3c3 <exit>
+  92:	66 90                	xchg   %ax,%ax
+  94:	66 90                	xchg   %ax,%ax
+  96:	66 90                	xchg   %ax,%ax
+  98:	66 90                	xchg   %ax,%ax
+  9a:	66 90                	xchg   %ax,%ax
+  9c:	66 90                	xchg   %ax,%ax
+  9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <wc>:
+{
+  a0:	55                   	push   %ebp
+  l = w = c = 0;
+  a1:	31 d2                	xor    %edx,%edx
+{
+  a3:	89 e5                	mov    %esp,%ebp
+  a5:	57                   	push   %edi
+  a6:	56                   	push   %esi
+  inword = 0;
+  a7:	31 f6                	xor    %esi,%esi
+{
+  a9:	53                   	push   %ebx
+  l = w = c = 0;
+  aa:	31 db                	xor    %ebx,%ebx
+{
+  ac:	83 ec 1c             	sub    $0x1c,%esp
+  l = w = c = 0;
+  af:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  c0:	83 ec 04             	sub    $0x4,%esp
+  c3:	68 00 02 00 00       	push   $0x200
+  c8:	68 20 0c 00 00       	push   $0xc20
+  cd:	ff 75 08             	push   0x8(%ebp)
+  d0:	e8 06 03 00 00       	call   3db <read>
+  d5:	83 c4 10             	add    $0x10,%esp
+  d8:	89 c1                	mov    %eax,%ecx
+  da:	85 c0                	test   %eax,%eax
+  dc:	7e 62                	jle    140 <wc+0xa0>
+    for(i=0; i<n; i++){
+  de:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  e1:	31 ff                	xor    %edi,%edi
+  e3:	eb 0d                	jmp    f2 <wc+0x52>
+  e5:	8d 76 00             	lea    0x0(%esi),%esi
+        inword = 0;
+  e8:	31 f6                	xor    %esi,%esi
+    for(i=0; i<n; i++){
+  ea:	83 c7 01             	add    $0x1,%edi
+  ed:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  f0:	74 3e                	je     130 <wc+0x90>
+      if(buf[i] == '\n')
+  f2:	0f be 87 20 0c 00 00 	movsbl 0xc20(%edi),%eax
+        l++;
+  f9:	31 c9                	xor    %ecx,%ecx
+  fb:	3c 0a                	cmp    $0xa,%al
+  fd:	0f 94 c1             	sete   %cl
+      if(strchr(" \r\t\n\v", buf[i]))
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	50                   	push   %eax
+        l++;
+ 104:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", buf[i]))
+ 106:	68 98 08 00 00       	push   $0x898
+ 10b:	e8 50 01 00 00       	call   260 <strchr>
+ 110:	83 c4 10             	add    $0x10,%esp
+ 113:	85 c0                	test   %eax,%eax
+ 115:	75 d1                	jne    e8 <wc+0x48>
+      else if(!inword){
+ 117:	85 f6                	test   %esi,%esi
+ 119:	75 cf                	jne    ea <wc+0x4a>
+        w++;
+ 11b:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+ 11f:	be 01 00 00 00       	mov    $0x1,%esi
+    for(i=0; i<n; i++){
+ 124:	83 c7 01             	add    $0x1,%edi
+ 127:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 12a:	75 c6                	jne    f2 <wc+0x52>
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c++;
+ 130:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 133:	01 4d dc             	add    %ecx,-0x24(%ebp)
+ 136:	eb 88                	jmp    c0 <wc+0x20>
+ 138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+  if(n < 0){
+ 140:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 143:	75 22                	jne    167 <wc+0xc7>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 145:	83 ec 08             	sub    $0x8,%esp
+ 148:	ff 75 0c             	push   0xc(%ebp)
+ 14b:	52                   	push   %edx
+ 14c:	ff 75 e0             	push   -0x20(%ebp)
+ 14f:	53                   	push   %ebx
+ 150:	68 ae 08 00 00       	push   $0x8ae
+ 155:	6a 01                	push   $0x1
+ 157:	e8 14 04 00 00       	call   570 <printf>
+}
+ 15c:	83 c4 20             	add    $0x20,%esp
+ 15f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 162:	5b                   	pop    %ebx
+ 163:	5e                   	pop    %esi
+ 164:	5f                   	pop    %edi
+ 165:	5d                   	pop    %ebp
+ 166:	c3                   	ret
+    printf(1, "wc: read error\n");
+ 167:	50                   	push   %eax
+ 168:	50                   	push   %eax
+ 169:	68 9e 08 00 00       	push   $0x89e
+ 16e:	6a 01                	push   $0x1
+ 170:	e8 fb 03 00 00       	call   570 <printf>
+    exit();
+ 175:	e8 49 02 00 00       	call   3c3 <exit>
+ 17a:	66 90                	xchg   %ax,%ax
+ 17c:	66 90                	xchg   %ax,%ax
+ 17e:	66 90                	xchg   %ax,%ax
+
+00000180 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 180:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 181:	31 c0                	xor    %eax,%eax
+{
+ 183:	89 e5                	mov    %esp,%ebp
+ 185:	53                   	push   %ebx
+ 186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 190:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 194:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 197:	83 c0 01             	add    $0x1,%eax
+ 19a:	84 d2                	test   %dl,%dl
+ 19c:	75 f2                	jne    190 <strcpy+0x10>
+    ;
+  return os;
+}
+ 19e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a1:	89 c8                	mov    %ecx,%eax
+ 1a3:	c9                   	leave
+ 1a4:	c3                   	ret
+ 1a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	53                   	push   %ebx
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1ba:	0f b6 02             	movzbl (%edx),%eax
+ 1bd:	84 c0                	test   %al,%al
+ 1bf:	75 17                	jne    1d8 <strcmp+0x28>
+ 1c1:	eb 3a                	jmp    1fd <strcmp+0x4d>
+ 1c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1c7:	90                   	nop
+ 1c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1cc:	83 c2 01             	add    $0x1,%edx
+ 1cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1d2:	84 c0                	test   %al,%al
+ 1d4:	74 1a                	je     1f0 <strcmp+0x40>
+    p++, q++;
+ 1d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1db:	38 c3                	cmp    %al,%bl
+ 1dd:	74 e9                	je     1c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1df:	29 d8                	sub    %ebx,%eax
+}
+ 1e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e4:	c9                   	leave
+ 1e5:	c3                   	ret
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1f4:	31 c0                	xor    %eax,%eax
+ 1f6:	29 d8                	sub    %ebx,%eax
+}
+ 1f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1fb:	c9                   	leave
+ 1fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 200:	31 c0                	xor    %eax,%eax
+ 202:	eb db                	jmp    1df <strcmp+0x2f>
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 216:	80 3a 00             	cmpb   $0x0,(%edx)
+ 219:	74 15                	je     230 <strlen+0x20>
+ 21b:	31 c0                	xor    %eax,%eax
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+ 220:	83 c0 01             	add    $0x1,%eax
+ 223:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 227:	89 c1                	mov    %eax,%ecx
+ 229:	75 f5                	jne    220 <strlen+0x10>
+    ;
+  return n;
+}
+ 22b:	89 c8                	mov    %ecx,%eax
+ 22d:	5d                   	pop    %ebp
+ 22e:	c3                   	ret
+ 22f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 230:	31 c9                	xor    %ecx,%ecx
+}
+ 232:	5d                   	pop    %ebp
+ 233:	89 c8                	mov    %ecx,%eax
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000240 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 247:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	89 d7                	mov    %edx,%edi
+ 24f:	fc                   	cld
+ 250:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 252:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 255:	89 d0                	mov    %edx,%eax
+ 257:	c9                   	leave
+ 258:	c3                   	ret
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 45 08             	mov    0x8(%ebp),%eax
+ 266:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 26a:	0f b6 10             	movzbl (%eax),%edx
+ 26d:	84 d2                	test   %dl,%dl
+ 26f:	75 12                	jne    283 <strchr+0x23>
+ 271:	eb 1d                	jmp    290 <strchr+0x30>
+ 273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 277:	90                   	nop
+ 278:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 27c:	83 c0 01             	add    $0x1,%eax
+ 27f:	84 d2                	test   %dl,%dl
+ 281:	74 0d                	je     290 <strchr+0x30>
+    if(*s == c)
+ 283:	38 d1                	cmp    %dl,%cl
+ 285:	75 f1                	jne    278 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 287:	5d                   	pop    %ebp
+ 288:	c3                   	ret
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 290:	31 c0                	xor    %eax,%eax
+}
+ 292:	5d                   	pop    %ebp
+ 293:	c3                   	ret
+ 294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2a9:	31 db                	xor    %ebx,%ebx
+{
+ 2ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ae:	eb 27                	jmp    2d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	6a 01                	push   $0x1
+ 2b5:	56                   	push   %esi
+ 2b6:	6a 00                	push   $0x0
+ 2b8:	e8 1e 01 00 00       	call   3db <read>
+    if(cc < 1)
+ 2bd:	83 c4 10             	add    $0x10,%esp
+ 2c0:	85 c0                	test   %eax,%eax
+ 2c2:	7e 1d                	jle    2e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2cf:	3c 0a                	cmp    $0xa,%al
+ 2d1:	74 10                	je     2e3 <gets+0x43>
+ 2d3:	3c 0d                	cmp    $0xd,%al
+ 2d5:	74 0c                	je     2e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2d7:	89 df                	mov    %ebx,%edi
+ 2d9:	83 c3 01             	add    $0x1,%ebx
+ 2dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2df:	7c cf                	jl     2b0 <gets+0x10>
+ 2e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ed:	5b                   	pop    %ebx
+ 2ee:	5e                   	pop    %esi
+ 2ef:	5f                   	pop    %edi
+ 2f0:	5d                   	pop    %ebp
+ 2f1:	c3                   	ret
+ 2f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	56                   	push   %esi
+ 304:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 305:	83 ec 08             	sub    $0x8,%esp
+ 308:	6a 00                	push   $0x0
+ 30a:	ff 75 08             	push   0x8(%ebp)
+ 30d:	e8 f1 00 00 00       	call   403 <open>
+  if(fd < 0)
+ 312:	83 c4 10             	add    $0x10,%esp
+ 315:	85 c0                	test   %eax,%eax
+ 317:	78 27                	js     340 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 319:	83 ec 08             	sub    $0x8,%esp
+ 31c:	ff 75 0c             	push   0xc(%ebp)
+ 31f:	89 c3                	mov    %eax,%ebx
+ 321:	50                   	push   %eax
+ 322:	e8 f4 00 00 00       	call   41b <fstat>
+  close(fd);
+ 327:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 32a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 32c:	e8 ba 00 00 00       	call   3eb <close>
+  return r;
+ 331:	83 c4 10             	add    $0x10,%esp
+}
+ 334:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 337:	89 f0                	mov    %esi,%eax
+ 339:	5b                   	pop    %ebx
+ 33a:	5e                   	pop    %esi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 345:	eb ed                	jmp    334 <stat+0x34>
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	53                   	push   %ebx
+ 354:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 357:	0f be 02             	movsbl (%edx),%eax
+ 35a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 35d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 360:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 365:	77 1e                	ja     385 <atoi+0x35>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 370:	83 c2 01             	add    $0x1,%edx
+ 373:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 376:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 37a:	0f be 02             	movsbl (%edx),%eax
+ 37d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 380:	80 fb 09             	cmp    $0x9,%bl
+ 383:	76 eb                	jbe    370 <atoi+0x20>
+  return n;
+}
+ 385:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 388:	89 c8                	mov    %ecx,%eax
+ 38a:	c9                   	leave
+ 38b:	c3                   	ret
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+ 395:	8b 45 10             	mov    0x10(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 39e:	85 c0                	test   %eax,%eax
+ 3a0:	7e 13                	jle    3b5 <memmove+0x25>
+ 3a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3a4:	89 d7                	mov    %edx,%edi
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3b1:	39 f8                	cmp    %edi,%eax
+ 3b3:	75 fb                	jne    3b0 <memmove+0x20>
+  return vdst;
+}
+ 3b5:	5e                   	pop    %esi
+ 3b6:	89 d0                	mov    %edx,%eax
+ 3b8:	5f                   	pop    %edi
+ 3b9:	5d                   	pop    %ebp
+ 3ba:	c3                   	ret
+
+000003bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <exit>:
+SYSCALL(exit)
+ 3c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <wait>:
+SYSCALL(wait)
+ 3cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <pipe>:
+SYSCALL(pipe)
+ 3d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <read>:
+SYSCALL(read)
+ 3db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <write>:
+SYSCALL(write)
+ 3e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <close>:
+SYSCALL(close)
+ 3eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <kill>:
+SYSCALL(kill)
+ 3f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <exec>:
+SYSCALL(exec)
+ 3fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <open>:
+SYSCALL(open)
+ 403:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <mknod>:
+SYSCALL(mknod)
+ 40b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <unlink>:
+SYSCALL(unlink)
+ 413:	b8 12 00 00 00       	mov    $0x12,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <fstat>:
+SYSCALL(fstat)
+ 41b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <link>:
+SYSCALL(link)
+ 423:	b8 13 00 00 00       	mov    $0x13,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <mkdir>:
+SYSCALL(mkdir)
+ 42b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <chdir>:
+SYSCALL(chdir)
+ 433:	b8 09 00 00 00       	mov    $0x9,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <dup>:
+SYSCALL(dup)
+ 43b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <getpid>:
+SYSCALL(getpid)
+ 443:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <sbrk>:
+SYSCALL(sbrk)
+ 44b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <sleep>:
+SYSCALL(sleep)
+ 453:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <uptime>:
+SYSCALL(uptime)
+ 45b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <trace>:
+SYSCALL(trace)
+ 463:	b8 16 00 00 00       	mov    $0x16,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <csinfo>:
+SYSCALL(csinfo)
+ 46b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <settickets>:
+SYSCALL(settickets)
+ 473:	b8 18 00 00 00       	mov    $0x18,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <getprocessesinfo>:
+SYSCALL(getprocessesinfo)
+ 47b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <yield>:
+SYSCALL(yield)
+ 483:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <random>:
+SYSCALL(random)
+ 48b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <dumppagetable>:
+SYSCALL(dumppagetable)
+ 493:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <getcpusinfo>:
+SYSCALL(getcpusinfo)
+ 49b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <setsched>:
+SYSCALL(setsched)
+ 4a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <getbcacheinfo>:
+SYSCALL(getbcacheinfo)
+ 4ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <getballocinfo>:
+SYSCALL(getballocinfo)
+ 4b3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <getfaultinfo>:
+SYSCALL(getfaultinfo)
+ 4bb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+ 4c3:	66 90                	xchg   %ax,%ax
+ 4c5:	66 90                	xchg   %ax,%ax
+ 4c7:	66 90                	xchg   %ax,%ax
+ 4c9:	66 90                	xchg   %ax,%ax
+ 4cb:	66 90                	xchg   %ax,%ax
+ 4cd:	66 90                	xchg   %ax,%ax
+ 4cf:	90                   	nop
+
+000004d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+ 4d5:	53                   	push   %ebx
+ 4d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4d8:	89 d1                	mov    %edx,%ecx
+{
+ 4da:	83 ec 3c             	sub    $0x3c,%esp
+ 4dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4e0:	85 d2                	test   %edx,%edx
+ 4e2:	0f 89 80 00 00 00    	jns    568 <printint+0x98>
+ 4e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4ec:	74 7a                	je     568 <printint+0x98>
+    x = -xx;
+ 4ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4f8:	31 f6                	xor    %esi,%esi
+ 4fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 500:	89 c8                	mov    %ecx,%eax
+ 502:	31 d2                	xor    %edx,%edx
+ 504:	89 f7                	mov    %esi,%edi
+ 506:	f7 f3                	div    %ebx
+ 508:	8d 76 01             	lea    0x1(%esi),%esi
+ 50b:	0f b6 92 30 09 00 00 	movzbl 0x930(%edx),%edx
+ 512:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 516:	89 ca                	mov    %ecx,%edx
+ 518:	89 c1                	mov    %eax,%ecx
+ 51a:	39 da                	cmp    %ebx,%edx
+ 51c:	73 e2                	jae    500 <printint+0x30>
+  if(neg)
+ 51e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 521:	85 c0                	test   %eax,%eax
+ 523:	74 07                	je     52c <printint+0x5c>
+    buf[i++] = '-';
+ 525:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 52a:	89 f7                	mov    %esi,%edi
+ 52c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 52f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 532:	01 df                	add    %ebx,%edi
+ 534:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 538:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 53b:	83 ec 04             	sub    $0x4,%esp
+ 53e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 541:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 544:	6a 01                	push   $0x1
+ 546:	50                   	push   %eax
+ 547:	56                   	push   %esi
+ 548:	e8 96 fe ff ff       	call   3e3 <write>
+  while(--i >= 0)
+ 54d:	89 f8                	mov    %edi,%eax
+ 54f:	83 c4 10             	add    $0x10,%esp
+ 552:	83 ef 01             	sub    $0x1,%edi
+ 555:	39 d8                	cmp    %ebx,%eax
+ 557:	75 df                	jne    538 <printint+0x68>
+}
+ 559:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 55c:	5b                   	pop    %ebx
+ 55d:	5e                   	pop    %esi
+ 55e:	5f                   	pop    %edi
+ 55f:	5d                   	pop    %ebp
+ 560:	c3                   	ret
+ 561:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 568:	31 c0                	xor    %eax,%eax
+ 56a:	eb 89                	jmp    4f5 <printint+0x25>
+ 56c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	57                   	push   %edi
+ 574:	56                   	push   %esi
+ 575:	53                   	push   %ebx
+ 576:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 579:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 57c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 57f:	0f b6 1e             	movzbl (%esi),%ebx
+ 582:	83 c6 01             	add    $0x1,%esi
+ 585:	84 db                	test   %bl,%bl
+ 587:	74 67                	je     5f0 <printf+0x80>
+ 589:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 58c:	31 d2                	xor    %edx,%edx
+ 58e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 591:	eb 34                	jmp    5c7 <printf+0x57>
+ 593:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 597:	90                   	nop
+ 598:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 59b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5a0:	83 f8 25             	cmp    $0x25,%eax
+ 5a3:	74 18                	je     5bd <printf+0x4d>
+  write(fd, &c, 1);
+ 5a5:	83 ec 04             	sub    $0x4,%esp
+ 5a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5ae:	6a 01                	push   $0x1
+ 5b0:	50                   	push   %eax
+ 5b1:	57                   	push   %edi
+ 5b2:	e8 2c fe ff ff       	call   3e3 <write>
+ 5b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 5c0:	83 c6 01             	add    $0x1,%esi
+ 5c3:	84 db                	test   %bl,%bl
+ 5c5:	74 29                	je     5f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5ca:	85 d2                	test   %edx,%edx
+ 5cc:	74 ca                	je     598 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5ce:	83 fa 25             	cmp    $0x25,%edx
+ 5d1:	75 ea                	jne    5bd <printf+0x4d>
+      if(c == 'd'){
+ 5d3:	83 f8 25             	cmp    $0x25,%eax
+ 5d6:	0f 84 24 01 00 00    	je     700 <printf+0x190>
+ 5dc:	83 e8 63             	sub    $0x63,%eax
+ 5df:	83 f8 15             	cmp    $0x15,%eax
+ 5e2:	77 1c                	ja     600 <printf+0x90>
+ 5e4:	ff 24 85 d8 08 00 00 	jmp    *0x8d8(,%eax,4)
+ 5eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5f3:	5b                   	pop    %ebx
+ 5f4:	5e                   	pop    %esi
+ 5f5:	5f                   	pop    %edi
+ 5f6:	5d                   	pop    %ebp
+ 5f7:	c3                   	ret
+ 5f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ff:	90                   	nop
+  write(fd, &c, 1);
+ 600:	83 ec 04             	sub    $0x4,%esp
+ 603:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 606:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 60a:	6a 01                	push   $0x1
+ 60c:	52                   	push   %edx
+ 60d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 610:	57                   	push   %edi
+ 611:	e8 cd fd ff ff       	call   3e3 <write>
+ 616:	83 c4 0c             	add    $0xc,%esp
+ 619:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 61c:	6a 01                	push   $0x1
+ 61e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 621:	52                   	push   %edx
+ 622:	57                   	push   %edi
+ 623:	e8 bb fd ff ff       	call   3e3 <write>
+        putc(fd, c);
+ 628:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 62b:	31 d2                	xor    %edx,%edx
+ 62d:	eb 8e                	jmp    5bd <printf+0x4d>
+ 62f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 630:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 633:	83 ec 0c             	sub    $0xc,%esp
+ 636:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 63b:	8b 13                	mov    (%ebx),%edx
+ 63d:	6a 00                	push   $0x0
+ 63f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 641:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 644:	e8 87 fe ff ff       	call   4d0 <printint>
+        ap++;
+ 649:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 64c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 64f:	31 d2                	xor    %edx,%edx
+ 651:	e9 67 ff ff ff       	jmp    5bd <printf+0x4d>
+ 656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 660:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 663:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 665:	83 c0 04             	add    $0x4,%eax
+ 668:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 66b:	85 db                	test   %ebx,%ebx
+ 66d:	0f 84 9d 00 00 00    	je     710 <printf+0x1a0>
+        while(*s != 0){
+ 673:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 676:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 678:	84 c0                	test   %al,%al
+ 67a:	0f 84 3d ff ff ff    	je     5bd <printf+0x4d>
+ 680:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 683:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 686:	89 de                	mov    %ebx,%esi
+ 688:	89 d3                	mov    %edx,%ebx
+ 68a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 690:	83 ec 04             	sub    $0x4,%esp
+ 693:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 696:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 699:	6a 01                	push   $0x1
+ 69b:	53                   	push   %ebx
+ 69c:	57                   	push   %edi
+ 69d:	e8 41 fd ff ff       	call   3e3 <write>
+        while(*s != 0){
+ 6a2:	0f b6 06             	movzbl (%esi),%eax
+ 6a5:	83 c4 10             	add    $0x10,%esp
+ 6a8:	84 c0                	test   %al,%al
+ 6aa:	75 e4                	jne    690 <printf+0x120>
+      state = 0;
+ 6ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6af:	31 d2                	xor    %edx,%edx
+ 6b1:	e9 07 ff ff ff       	jmp    5bd <printf+0x4d>
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6c3:	83 ec 0c             	sub    $0xc,%esp
+ 6c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6cb:	8b 13                	mov    (%ebx),%edx
+ 6cd:	6a 01                	push   $0x1
+ 6cf:	e9 6b ff ff ff       	jmp    63f <printf+0xcf>
+ 6d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6db:	83 ec 04             	sub    $0x4,%esp
+ 6de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6e9:	6a 01                	push   $0x1
+ 6eb:	52                   	push   %edx
+ 6ec:	57                   	push   %edi
+ 6ed:	e8 f1 fc ff ff       	call   3e3 <write>
+        ap++;
+ 6f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6f8:	31 d2                	xor    %edx,%edx
+ 6fa:	e9 be fe ff ff       	jmp    5bd <printf+0x4d>
+ 6ff:	90                   	nop
+  write(fd, &c, 1);
+ 700:	83 ec 04             	sub    $0x4,%esp
+ 703:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 706:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 709:	6a 01                	push   $0x1
+ 70b:	e9 11 ff ff ff       	jmp    621 <printf+0xb1>
+ 710:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 715:	bb cf 08 00 00       	mov    $0x8cf,%ebx
+ 71a:	e9 61 ff ff ff       	jmp    680 <printf+0x110>
+ 71f:	90                   	nop
+
+00000720 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 720:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 721:	a1 20 0e 00 00       	mov    0xe20,%eax
+{
+ 726:	89 e5                	mov    %esp,%ebp
+ 728:	57                   	push   %edi
+ 729:	56                   	push   %esi
+ 72a:	53                   	push   %ebx
+ 72b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 72e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 731:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 738:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 73a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 73c:	39 ca                	cmp    %ecx,%edx
+ 73e:	73 30                	jae    770 <free+0x50>
+ 740:	39 c1                	cmp    %eax,%ecx
+ 742:	72 04                	jb     748 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 744:	39 c2                	cmp    %eax,%edx
+ 746:	72 f0                	jb     738 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 748:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 74b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 74e:	39 f8                	cmp    %edi,%eax
+ 750:	74 2e                	je     780 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 752:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 755:	8b 42 04             	mov    0x4(%edx),%eax
+ 758:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 75b:	39 f1                	cmp    %esi,%ecx
+ 75d:	74 38                	je     797 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 75f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 761:	5b                   	pop    %ebx
+  freep = p;
+ 762:	89 15 20 0e 00 00    	mov    %edx,0xe20
+}
+ 768:	5e                   	pop    %esi
+ 769:	5f                   	pop    %edi
+ 76a:	5d                   	pop    %ebp
+ 76b:	c3                   	ret
+ 76c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 770:	39 c1                	cmp    %eax,%ecx
+ 772:	72 d0                	jb     744 <free+0x24>
+ 774:	eb c2                	jmp    738 <free+0x18>
+ 776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 780:	03 70 04             	add    0x4(%eax),%esi
+ 783:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 786:	8b 02                	mov    (%edx),%eax
+ 788:	8b 00                	mov    (%eax),%eax
+ 78a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 78d:	8b 42 04             	mov    0x4(%edx),%eax
+ 790:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 793:	39 f1                	cmp    %esi,%ecx
+ 795:	75 c8                	jne    75f <free+0x3f>
+    p->s.size += bp->s.size;
+ 797:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 79a:	89 15 20 0e 00 00    	mov    %edx,0xe20
+    p->s.size += bp->s.size;
+ 7a0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7a3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 7a6:	89 0a                	mov    %ecx,(%edx)
+}
+ 7a8:	5b                   	pop    %ebx
+ 7a9:	5e                   	pop    %esi
+ 7aa:	5f                   	pop    %edi
+ 7ab:	5d                   	pop    %ebp
+ 7ac:	c3                   	ret
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007b0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	56                   	push   %esi
+ 7b5:	53                   	push   %ebx
+ 7b6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 7bc:	8b 15 20 0e 00 00    	mov    0xe20,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7c2:	8d 78 07             	lea    0x7(%eax),%edi
+ 7c5:	c1 ef 03             	shr    $0x3,%edi
+ 7c8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 7cb:	85 d2                	test   %edx,%edx
+ 7cd:	0f 84 8d 00 00 00    	je     860 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7d3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7d5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7d8:	39 f9                	cmp    %edi,%ecx
+ 7da:	73 64                	jae    840 <malloc+0x90>
+  if(nu < 4096)
+ 7dc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 7e1:	39 df                	cmp    %ebx,%edi
+ 7e3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 7e6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 7ed:	eb 0a                	jmp    7f9 <malloc+0x49>
+ 7ef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7f0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7f2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7f5:	39 f9                	cmp    %edi,%ecx
+ 7f7:	73 47                	jae    840 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 7f9:	89 c2                	mov    %eax,%edx
+ 7fb:	39 05 20 0e 00 00    	cmp    %eax,0xe20
+ 801:	75 ed                	jne    7f0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 803:	83 ec 0c             	sub    $0xc,%esp
+ 806:	56                   	push   %esi
+ 807:	e8 3f fc ff ff       	call   44b <sbrk>
+  if(p == (char*)-1)
+ 80c:	83 c4 10             	add    $0x10,%esp
+ 80f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 812:	74 1c                	je     830 <malloc+0x80>
+  hp->s.size = nu;
+ 814:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 817:	83 ec 0c             	sub    $0xc,%esp
+ 81a:	83 c0 08             	add    $0x8,%eax
+ 81d:	50                   	push   %eax
+ 81e:	e8 fd fe ff ff       	call   720 <free>
+  return freep;
+ 823:	8b 15 20 0e 00 00    	mov    0xe20,%edx
+      if((p = morecore(nunits)) == 0)
+ 829:	83 c4 10             	add    $0x10,%esp
+ 82c:	85 d2                	test   %edx,%edx
+ 82e:	75 c0                	jne    7f0 <malloc+0x40>
+        return 0;
+  }
+}
+ 830:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 833:	31 c0                	xor    %eax,%eax
+}
+ 835:	5b                   	pop    %ebx
+ 836:	5e                   	pop    %esi
+ 837:	5f                   	pop    %edi
+ 838:	5d                   	pop    %ebp
+ 839:	c3                   	ret
+ 83a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 840:	39 cf                	cmp    %ecx,%edi
+ 842:	74 4c                	je     890 <malloc+0xe0>
+        p->s.size -= nunits;
+ 844:	29 f9                	sub    %edi,%ecx
+ 846:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 849:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 84c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 84f:	89 15 20 0e 00 00    	mov    %edx,0xe20
+}
+ 855:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 858:	83 c0 08             	add    $0x8,%eax
+}
+ 85b:	5b                   	pop    %ebx
+ 85c:	5e                   	pop    %esi
+ 85d:	5f                   	pop    %edi
+ 85e:	5d                   	pop    %ebp
+ 85f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 860:	c7 05 20 0e 00 00 24 	movl   $0xe24,0xe20
+ 867:	0e 00 00 
+    base.s.size = 0;
+ 86a:	b8 24 0e 00 00       	mov    $0xe24,%eax
+    base.s.ptr = freep = prevp = &base;
+ 86f:	c7 05 24 0e 00 00 24 	movl   $0xe24,0xe24
+ 876:	0e 00 00 
+    base.s.size = 0;
+ 879:	c7 05 28 0e 00 00 00 	movl   $0x0,0xe28
+ 880:	00 00 00 
+    if(p->s.size >= nunits){
+ 883:	e9 54 ff ff ff       	jmp    7dc <malloc+0x2c>
+ 888:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 890:	8b 08                	mov    (%eax),%ecx
+ 892:	89 0a                	mov    %ecx,(%edx)
+ 894:	eb b9                	jmp    84f <malloc+0x9f>
@@ -130,6 +130,40 @@ xchg(volatile uint *addr, uint newval)
   return result;
 }
 
+// Atomically add v to *addr and return the old value.
+static inline uint
+xadd(volatile uint *addr, uint v)
+{
+  asm volatile("lock; xaddl %0, %1" :
+               "+r" (v), "+m" (*addr) :
+               :
+               "memory", "cc");
+  return v;
+}
+
+// Atomically set *addr to newval if it equals old.
+// Returns the value *addr held before.
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+               "=a" (result), "+m" (*addr) :
+               "r" (newval), "0" (old) :
+               "memory", "cc");
+  return result;
+}
+
+// Read the time-stamp counter.
+static inline unsigned long long
+rdtsc(void)
+{
+  unsigned long long val;
+  asm volatile("rdtsc" : "=A" (val));
+  return val;
+}
+
 static inline uint
 rcr2(void)
 {
@@ -144,6 +178,13 @@ lcr3(uint val)
   asm volatile("movl %0,%%cr3" : : "r" (val));
 }
 
+// Invalidate the TLB entry for the page holding va.
+static inline void
+invlpg(void *va)
+{
+  asm volatile("invlpg (%0)" : : "r" (va) : "memory");
+}
+
 //PAGEBREAK: 36
 // Layout of the trap frame built on the stack by the
 // hardware and by trapasm.S, and passed to trap().